@@ -0,0 +1,263 @@
+#pragma once
+
+namespace F4SE::log
+{
+	/**
+	 * An opt-in structured log which defers formatting.
+	 *
+	 * <p>
+	 * Each call records its call site id, a time stamp counter reading and raw arguments into a ring
+	 * buffer owned by the calling thread, without locking or formatting. A background thread persists the rings, and the text is
+	 * only rendered afterwards by <code>DecodeBinaryLog</code>. When a ring is full the record is
+	 * dropped and counted rather than blocking the caller.
+	 * </p>
+	 *
+	 * <p>
+	 * The log is never destroyed, so its thread runs until <code>close</code> is called.
+	 * </p>
+	 */
+	class BinaryLog
+	{
+	public:
+		enum class Level : std::uint8_t
+		{
+			kTrace,
+			kDebug,
+			kInfo,
+			kWarn,
+			kError,
+			kCritical
+		};
+
+		enum class ArgType : std::uint8_t
+		{
+			kSigned,
+			kUnsigned,
+			kFloat,
+			kBool,
+			kChar,
+			kString
+		};
+
+		struct site_t
+		{
+			std::string_view fmt;
+			std::source_location loc;
+			Level level;
+		};
+
+		static constexpr std::uint32_t MAGIC = 0x4C423446;  // F4BL
+		static constexpr std::uint32_t VERSION = 2;
+		static constexpr std::size_t RING_SIZE = 1u << 16;
+		static constexpr std::size_t MAX_RECORD = 512;
+
+		[[nodiscard]] static BinaryLog& get() noexcept;
+
+		BinaryLog(const BinaryLog&) = delete;
+		BinaryLog(BinaryLog&&) = delete;
+
+		BinaryLog& operator=(const BinaryLog&) = delete;
+		BinaryLog& operator=(BinaryLog&&) = delete;
+
+		/**
+		 * Starts persisting records to <code>a_path</code>. Records made before this are discarded.
+		 */
+		bool open(const std::filesystem::path& a_path);
+
+		/**
+		 * Drains every ring, then stops the background thread and closes the file. F4SE sends no
+		 * exit message, so a plugin must call this from its own shutdown path to keep the last few
+		 * milliseconds of records. It must not be called from a static destructor or DllMain, where
+		 * joining under the loader lock can deadlock.
+		 */
+		void close();
+
+		[[nodiscard]] bool is_open() const noexcept { return _open.load(std::memory_order_relaxed); }
+
+		template <class... Args>
+		void write(const site_t& a_site, const Args&... a_args)
+		{
+			if (!is_open()) {
+				return;
+			}
+
+			record_t record;
+			(encode(record, a_args), ...);
+			commit(a_site, record);
+		}
+
+	private:
+		struct ring_t;
+		struct ring_owner_t;
+
+		struct site_key_t
+		{
+			const char* fmt;
+			const char* file;
+			std::uint32_t line;
+			Level level;
+
+			[[nodiscard]] bool operator==(const site_key_t&) const noexcept = default;
+		};
+
+		struct site_key_hash
+		{
+			[[nodiscard]] std::size_t operator()(const site_key_t& a_key) const noexcept
+			{
+				auto hash = std::hash<const void*>{}(a_key.fmt);
+				hash ^= std::hash<const void*>{}(a_key.file) + 0x9E3779B97F4A7C15 + (hash << 6) + (hash >> 2);
+				hash ^= (static_cast<std::size_t>(a_key.line) << 8 | static_cast<std::size_t>(a_key.level)) + 0x9E3779B97F4A7C15 + (hash << 6) + (hash >> 2);
+				return hash;
+			}
+		};
+
+		// size, site id, ticks
+		static constexpr std::size_t HEADER_SIZE = sizeof(std::uint32_t) * 2 + sizeof(std::int64_t);
+
+		struct record_t
+		{
+			/**
+			 * Appends a whole argument, or drops it and every argument after it if the record is full.
+			 */
+			bool put(std::initializer_list<std::span<const std::byte>> a_parts) noexcept
+			{
+				std::size_t size = 0;
+				for (const auto& part : a_parts) {
+					size += part.size();
+				}
+
+				if (full || buf.size() - len < size) {
+					full = true;
+					return false;
+				}
+
+				for (const auto& part : a_parts) {
+					std::memcpy(buf.data() + len, part.data(), part.size());
+					len += part.size();
+				}
+				return true;
+			}
+
+			std::array<std::byte, MAX_RECORD> buf;
+			std::size_t len{ HEADER_SIZE };
+			bool full{ false };
+		};
+
+		BinaryLog() = default;
+
+		template <class T>
+		static void put_arg(record_t& a_record, ArgType a_type, T a_value) noexcept
+		{
+			a_record.put({ std::as_bytes(std::span{ std::addressof(a_type), 1 }), std::as_bytes(std::span{ std::addressof(a_value), 1 }) });
+		}
+
+		static void encode(record_t& a_record, std::string_view a_value) noexcept
+		{
+			// strings are truncated to whatever fits into the record
+			const auto type = ArgType::kString;
+			const auto header = sizeof(type) + sizeof(std::uint16_t);
+			const auto room = a_record.buf.size() - a_record.len;
+			const auto size = static_cast<std::uint16_t>(room > header ? std::min(a_value.size(), room - header) : 0);
+			a_record.put({
+				std::as_bytes(std::span{ std::addressof(type), 1 }),
+				std::as_bytes(std::span{ std::addressof(size), 1 }),
+				std::as_bytes(std::span{ a_value.data(), size }),
+			});
+		}
+
+		template <class T>
+		static void encode(record_t& a_record, const T& a_value) noexcept
+		{
+			if constexpr (std::is_same_v<T, bool>) {
+				put_arg(a_record, ArgType::kBool, static_cast<std::uint8_t>(a_value));
+			}
+			else if constexpr (std::is_same_v<T, char>) {
+				put_arg(a_record, ArgType::kChar, a_value);
+			}
+			else if constexpr (std::is_enum_v<T>) {
+				encode(a_record, static_cast<std::underlying_type_t<T>>(a_value));
+			}
+			else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+				put_arg(a_record, ArgType::kSigned, static_cast<std::int64_t>(a_value));
+			}
+			else if constexpr (std::is_integral_v<T>) {
+				put_arg(a_record, ArgType::kUnsigned, static_cast<std::uint64_t>(a_value));
+			}
+			else if constexpr (std::is_floating_point_v<T>) {
+				put_arg(a_record, ArgType::kFloat, static_cast<double>(a_value));
+			}
+			else if constexpr (std::is_array_v<T> && std::is_convertible_v<const T&, std::string_view>) {
+				encode(a_record, std::string_view(a_value));
+			}
+			else if constexpr (std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>) {
+				encode(a_record, a_value ? std::string_view(a_value) : "(null)"sv);
+			}
+			else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+				encode(a_record, std::string_view(a_value));
+			}
+			else if constexpr (std::is_pointer_v<T>) {
+				put_arg(a_record, ArgType::kUnsigned, reinterpret_cast<std::uintptr_t>(a_value));
+			}
+			else {
+				static_assert(false && sizeof(T), "binary log arguments must be arithmetic, enums, pointers or strings");
+			}
+		}
+
+		void commit(const site_t& a_site, record_t& a_record);
+		[[nodiscard]] std::uint32_t site_id(const site_t& a_site);
+		[[nodiscard]] ring_t& ring();
+		void prune(const std::vector<std::shared_ptr<ring_t>>& a_retired);
+		void drain();
+		void thread_main(std::stop_token a_token);
+
+		std::atomic_bool _open{ false };
+		std::mutex _lock;
+		std::vector<std::shared_ptr<ring_t>> _rings;
+		std::vector<std::byte> _siteRecords;
+		std::size_t _siteRecordsWritten{ 0 };
+		std::unordered_map<site_key_t, std::uint32_t, site_key_hash> _sites;
+		std::ofstream _file;
+		std::jthread _thread;
+	};
+
+	/**
+	 * Converts a binary log to text, ordering records from all threads by their timestamps.
+	 */
+	bool DecodeBinaryLog(std::istream& a_in, std::ostream& a_out);
+
+	namespace binary
+	{
+		namespace detail
+		{
+			template <BinaryLog::Level L>
+			struct format_t
+			{
+				template <class T>
+				consteval format_t(const T& a_fmt, std::source_location a_loc = std::source_location::current()) noexcept
+					requires std::is_convertible_v<const T&, std::string_view>
+					:
+					site{ a_fmt, a_loc, L }
+				{
+				}
+
+				BinaryLog::site_t site;
+			};
+		}
+
+#define F4SE_MAKE_BINARY_LOGGER(a_func, a_level)                                                         \
+	template <class... Args>                                                                             \
+	void a_func(std::type_identity_t<detail::format_t<BinaryLog::Level::a_level>> a_fmt, const Args&... a_args) \
+	{                                                                                                    \
+		BinaryLog::get().write(a_fmt.site, a_args...);                                                   \
+	}
+
+		F4SE_MAKE_BINARY_LOGGER(trace, kTrace)
+		F4SE_MAKE_BINARY_LOGGER(debug, kDebug)
+		F4SE_MAKE_BINARY_LOGGER(info, kInfo)
+		F4SE_MAKE_BINARY_LOGGER(warn, kWarn)
+		F4SE_MAKE_BINARY_LOGGER(error, kError)
+		F4SE_MAKE_BINARY_LOGGER(critical, kCritical)
+
+#undef F4SE_MAKE_BINARY_LOGGER
+	}
+}
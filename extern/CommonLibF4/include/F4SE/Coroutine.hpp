@@ -0,0 +1,160 @@
+#pragma once
+
+namespace F4SE
+{
+	/**
+	 * Runs batches of coroutine continuations on the game's threads.
+	 */
+	class CoroutineExecutor
+	{
+	public:
+		virtual ~CoroutineExecutor() = default;
+
+		virtual void post(std::function<void()> a_task) = 0;
+		virtual void post_ui(std::function<void()> a_task) = 0;
+
+		/**
+		 * Returns the default implementation, backed by <code>TaskInterface</code>. The host tests have
+		 * no default, and hand their frame loop to <code>set_executor</code> instead.
+		 */
+		[[nodiscard]] static CoroutineExecutor& get() noexcept;
+	};
+
+	namespace detail
+	{
+		/**
+		 * Recycles coroutine frames through per-size-class free lists, since most plugins
+		 * only ever spawn a handful of distinct coroutine shapes.
+		 */
+		class CoroutineFramePool
+		{
+		public:
+			[[nodiscard]] static void* allocate(std::size_t a_size);
+			static void deallocate(void* a_mem, std::size_t a_size) noexcept;
+		};
+	}
+
+	/**
+	 * A fire-and-forget coroutine. It runs eagerly until its first suspension, and its frame
+	 * is released when it finishes.
+	 */
+	class Coroutine
+	{
+	public:
+		struct promise_type
+		{
+			[[nodiscard]] static void* operator new(std::size_t a_size) { return detail::CoroutineFramePool::allocate(a_size); }
+			static void operator delete(void* a_mem, std::size_t a_size) noexcept { detail::CoroutineFramePool::deallocate(a_mem, a_size); }
+
+			[[nodiscard]] Coroutine get_return_object() const noexcept { return {}; }
+			[[nodiscard]] std::suspend_never initial_suspend() const noexcept { return {}; }
+			[[nodiscard]] std::suspend_never final_suspend() const noexcept { return {}; }
+			void return_void() const noexcept {}
+			void unhandled_exception() const noexcept;
+		};
+	};
+
+	/**
+	 * Collects suspended coroutines and resumes them in one batched task per frame.
+	 */
+	class CoroutineScheduler
+	{
+	public:
+		using clock_type = std::chrono::steady_clock;
+
+		[[nodiscard]] static CoroutineScheduler& get() noexcept;
+
+		/**
+		 * Replaces the executor that frames are posted to, e.g. with a simulated frame loop.
+		 */
+		void set_executor(CoroutineExecutor& a_executor) noexcept;
+
+		/**
+		 * Replaces the clock delays are measured with, e.g. with a simulated one.
+		 */
+		void set_clock(clock_type::time_point (*a_now)()) noexcept { _now.store(a_now, std::memory_order_relaxed); }
+
+		[[nodiscard]] clock_type::time_point now() const { return _now.load(std::memory_order_relaxed)(); }
+
+		void resume_next_frame(std::coroutine_handle<> a_handle);
+		void resume_on_ui(std::coroutine_handle<> a_handle);
+		void resume_after(std::coroutine_handle<> a_handle, clock_type::time_point a_time);
+
+		[[nodiscard]] std::size_t pending() const;
+
+	private:
+		struct timer_t
+		{
+			clock_type::time_point time;
+			std::coroutine_handle<> handle;
+
+			[[nodiscard]] bool operator>(const timer_t& a_rhs) const noexcept { return time > a_rhs.time; }
+		};
+
+		CoroutineScheduler() = default;
+
+		[[nodiscard]] CoroutineExecutor& executor() const noexcept { return _executor ? *_executor : CoroutineExecutor::get(); }
+
+		void request_frame();
+		void request_ui();
+		void run_frame();
+		void run_ui();
+
+		mutable std::mutex _lock;
+		CoroutineExecutor* _executor{ nullptr };
+		std::atomic<clock_type::time_point (*)()> _now{ &clock_type::now };
+		std::vector<std::coroutine_handle<>> _frame;
+		std::vector<std::coroutine_handle<>> _ui;
+		std::vector<timer_t> _timers;
+		bool _framePosted{ false };
+		bool _uiPosted{ false };
+	};
+
+	/**
+	 * Suspends until the next frame's task batch on the main thread.
+	 */
+	struct NextFrame
+	{
+		[[nodiscard]] bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> a_handle) const { CoroutineScheduler::get().resume_next_frame(a_handle); }
+		void await_resume() const noexcept {}
+	};
+
+	/**
+	 * Suspends until the next UI task batch.
+	 */
+	struct UIThread
+	{
+		[[nodiscard]] bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> a_handle) const { CoroutineScheduler::get().resume_on_ui(a_handle); }
+		void await_resume() const noexcept {}
+	};
+
+	/**
+	 * Suspends until the first main thread frame after the delay has elapsed.
+	 */
+	struct Delay
+	{
+		explicit Delay(std::chrono::milliseconds a_delay) noexcept :
+			delay(a_delay)
+		{
+		}
+
+		explicit Delay(std::uint32_t a_milliseconds) noexcept :
+			Delay(std::chrono::milliseconds(a_milliseconds))
+		{
+		}
+
+		[[nodiscard]] bool await_ready() const noexcept { return false; }
+
+		void await_suspend(std::coroutine_handle<> a_handle) const
+		{
+			auto& scheduler = CoroutineScheduler::get();
+			scheduler.resume_after(a_handle, scheduler.now() + delay);
+		}
+
+		void await_resume() const noexcept {}
+
+		std::chrono::milliseconds delay;
+	};
+}
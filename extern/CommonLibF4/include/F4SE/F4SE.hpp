@@ -3,8 +3,13 @@
 #include "F4SE/Impl/PCH.hpp"
 
 #include "F4SE/API.hpp"
+#include "F4SE/BinaryLog.hpp"
+#include "F4SE/Coroutine.hpp"
 #include "F4SE/InputMap.hpp"
 #include "F4SE/Interfaces.hpp"
+#include "F4SE/JobSystem.hpp"
 #include "F4SE/Logger.hpp"
+#include "F4SE/MessageChannel.hpp"
+#include "F4SE/Serialization.hpp"
 #include "F4SE/Trampoline.hpp"
 #include "F4SE/Version.hpp"
@@ -2,11 +2,16 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <bitset>
 #include <cassert>
+#include <charconv>
+#include <chrono>
 #include <cmath>
 #include <concepts>
+#include <condition_variable>
+#include <coroutine>
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
@@ -16,6 +21,7 @@
 #include <ctime>
 #include <cwchar>
 #include <cwctype>
+#include <deque>
 #include <exception>
 #include <execution>
 #include <filesystem>
@@ -39,6 +45,7 @@
 #include <ranges>
 #include <regex>
 #include <set>
+#include <shared_mutex>
 #include <source_location>
 #include <span>
 #include <sstream>
@@ -51,6 +58,7 @@
 #include <tuple>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -47,5 +47,16 @@ namespace F4SE
 
 		std::uint32_t GamepadMaskToKeycode(std::uint32_t keyMask);
 		std::uint32_t GamepadKeycodeToMask(std::uint32_t keyCode);
+
+		/**
+		 * Returns the name a key code is written to configs as, e.g. <code>LSHIFT</code>,
+		 * <code>MOUSE1</code> or <code>GAMEPAD_A</code>, or an empty string if it has none.
+		 */
+		std::string_view GetKeyName(std::uint32_t keyCode);
+
+		/**
+		 * Parses a key name case insensitively, returning <code>kMaxMacros</code> if it is unknown.
+		 */
+		std::uint32_t GetKeyCode(std::string_view keyName);
 	}
 }
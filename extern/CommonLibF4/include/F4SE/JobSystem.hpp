@@ -0,0 +1,201 @@
+#pragma once
+
+#include "F4SE/Coroutine.hpp"
+
+namespace F4SE
+{
+	enum class JobPriority : std::uint8_t
+	{
+		kHigh,
+		kNormal,
+		kLow,
+
+		kTotal
+	};
+
+	namespace detail
+	{
+		/**
+		 * A fixed capacity Chase-Lev deque. The owning thread pushes and pops at the bottom,
+		 * while any other thread may steal from the top with atomics alone.
+		 */
+		template <class T, std::size_t N>
+		class WorkStealingDeque
+		{
+		public:
+			static_assert(std::has_single_bit(N), "capacity must be a power of two");
+
+			[[nodiscard]] bool push(T* a_item) noexcept
+			{
+				const auto bottom = _bottom.load(std::memory_order_relaxed);
+				const auto top = _top.load(std::memory_order_acquire);
+				if (bottom - top >= static_cast<std::int64_t>(N)) {
+					return false;
+				}
+
+				_items[bottom & MASK].store(a_item, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return true;
+			}
+
+			[[nodiscard]] T* pop() noexcept
+			{
+				const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+				_bottom.store(bottom, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				auto top = _top.load(std::memory_order_relaxed);
+
+				if (top > bottom) {
+					_bottom.store(bottom + 1, std::memory_order_relaxed);
+					return nullptr;
+				}
+
+				auto item = _items[bottom & MASK].load(std::memory_order_relaxed);
+				if (top == bottom) {
+					// racing thieves for the last item
+					if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+						item = nullptr;
+					}
+					_bottom.store(bottom + 1, std::memory_order_relaxed);
+				}
+
+				return item;
+			}
+
+			[[nodiscard]] T* steal() noexcept
+			{
+				auto top = _top.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				const auto bottom = _bottom.load(std::memory_order_acquire);
+				if (top >= bottom) {
+					return nullptr;
+				}
+
+				const auto item = _items[top & MASK].load(std::memory_order_relaxed);
+				if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+					return nullptr;
+				}
+
+				return item;
+			}
+
+		private:
+			static constexpr std::int64_t MASK = static_cast<std::int64_t>(N) - 1;
+
+			alignas(64) std::atomic<std::int64_t> _top{ 0 };
+			alignas(64) std::atomic<std::int64_t> _bottom{ 0 };
+			std::array<std::atomic<T*>, N> _items{};
+		};
+	}
+
+	/**
+	 * Runs plugin work either on a pool of worker threads, or on the main thread within a fixed
+	 * time budget per frame.
+	 *
+	 * <p>
+	 * Worker jobs must not touch game state. Main thread jobs are drained highest priority first,
+	 * and whatever does not fit into the budget carries over to the next frame.
+	 * </p>
+	 *
+	 * <p>
+	 * The system is never destroyed, so its workers run until <code>stop</code> is called.
+	 * </p>
+	 */
+	class JobSystem
+	{
+	public:
+		using clock_type = std::chrono::steady_clock;
+		using job_type = std::function<void()>;
+
+		struct Stats
+		{
+			std::uint64_t frames{ 0 };
+			std::uint64_t overruns{ 0 };
+			std::uint64_t mainJobs{ 0 };
+			std::uint64_t workerJobs{ 0 };
+			std::uint64_t steals{ 0 };
+			std::chrono::microseconds worstFrame{ 0 };
+		};
+
+		[[nodiscard]] static JobSystem& get() noexcept;
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem(JobSystem&&) = delete;
+
+		JobSystem& operator=(const JobSystem&) = delete;
+		JobSystem& operator=(JobSystem&&) = delete;
+
+		/**
+		 * Starts the worker pool, defaulting to one worker per spare hardware thread.
+		 */
+		void start(std::size_t a_workers = 0);
+
+		/**
+		 * Runs the queued worker jobs and joins the workers. F4SE sends no exit message, so a
+		 * plugin must call this from its own shutdown path. It must not be called from a static
+		 * destructor or DllMain, where joining under the loader lock can deadlock.
+		 */
+		void stop();
+
+		void submit(job_type a_job, JobPriority a_priority = JobPriority::kNormal);
+		void submit_main(job_type a_job, JobPriority a_priority = JobPriority::kNormal);
+
+		void set_frame_budget(std::chrono::microseconds a_budget) noexcept { _budget.store(a_budget.count(), std::memory_order_relaxed); }
+
+		/**
+		 * Replaces the executor used to post main thread drains, e.g. with a simulated frame loop.
+		 */
+		void set_executor(CoroutineExecutor& a_executor) noexcept;
+
+		/**
+		 * Replaces the clock the frame budget is measured with, e.g. with a simulated one.
+		 */
+		void set_clock(clock_type::time_point (*a_now)()) noexcept { _now.store(a_now, std::memory_order_relaxed); }
+
+		/**
+		 * Drains the main thread queue until it is empty or the frame budget is spent.
+		 */
+		void run_frame();
+
+		[[nodiscard]] Stats stats() const;
+
+	private:
+		using job_t = job_type;
+		using deque_t = detail::WorkStealingDeque<job_t, 1024>;
+
+		static constexpr auto LANES = static_cast<std::size_t>(JobPriority::kTotal);
+
+		struct worker_t
+		{
+			std::array<deque_t, LANES> lanes;
+			std::thread thread;
+		};
+
+		JobSystem() = default;
+
+		[[nodiscard]] job_t* find_work(std::size_t a_worker);
+		void worker_main(std::size_t a_worker);
+		void execute(job_t* a_job);
+		void request_frame();
+
+		std::mutex _lifecycleLock;
+		std::vector<std::unique_ptr<worker_t>> _workers;
+		std::array<std::deque<job_t*>, LANES> _injected;
+		std::mutex _injectedLock;
+		std::condition_variable _wake;
+		std::atomic<std::size_t> _queued{ 0 };
+		std::atomic_bool _running{ false };
+
+		std::array<std::deque<job_type>, LANES> _main;
+		mutable std::mutex _mainLock;
+		CoroutineExecutor* _executor{ nullptr };
+		bool _framePosted{ false };
+		Stats _stats;
+
+		std::atomic<std::int64_t> _budget{ 2000 };
+		std::atomic<clock_type::time_point (*)()> _now{ &clock_type::now };
+		std::atomic<std::uint64_t> _workerJobs{ 0 };
+		std::atomic<std::uint64_t> _steals{ 0 };
+	};
+}
@@ -12,6 +12,10 @@
 			Args&&... a_args,                                             \
 			std::source_location a_loc = std::source_location::current()) \
 		{                                                                 \
+			if (!spdlog::should_log(spdlog::level::a_type) ||             \
+				!detail::rate_limit(a_loc, spdlog::level::a_type)) {      \
+				return;                                                   \
+			}                                                             \
 			spdlog::log(                                                  \
 				spdlog::source_loc{                                       \
 					a_loc.file_name(),                                    \
@@ -28,6 +32,61 @@
 
 namespace F4SE::log
 {
+	namespace detail
+	{
+		struct rate_limit_t
+		{
+			std::atomic<std::uint64_t> key{ 0 };
+			std::atomic<std::uint32_t> count{ 0 };
+			std::atomic<std::int64_t> window{ 0 };
+			std::atomic<const char*> file{ nullptr };
+			std::atomic<const char*> function{ nullptr };
+			std::atomic<std::uint32_t> line{ 0 };
+			std::atomic<spdlog::level::level_enum> level{ spdlog::level::off };
+		};
+
+		inline std::atomic<std::uint32_t> rate_limit_budget{ 20 };
+
+		[[nodiscard]] rate_limit_t* rate_limit_slot(const std::source_location& a_loc) noexcept;
+		[[nodiscard]] bool rate_limit_slow(rate_limit_t& a_slot, const std::source_location& a_loc, spdlog::level::level_enum a_level);
+
+		/**
+		 * Returns whether a call site is still within its budget for the current period.
+		 *
+		 * <p>
+		 * Calls within the budget cost a single relaxed increment. Once the budget is spent, further
+		 * calls are dropped until the period rolls over, at which point a summary of how many were
+		 * dropped is logged ahead of the next message. Sites which went quiet are summarized by the
+		 * next site to go over budget, or by <code>flush_rate_limits</code>.
+		 * </p>
+		 */
+		[[nodiscard]] inline bool rate_limit(const std::source_location& a_loc, spdlog::level::level_enum a_level)
+		{
+			const auto budget = rate_limit_budget.load(std::memory_order_relaxed);
+			if (budget == 0) {
+				return true;
+			}
+
+			const auto slot = rate_limit_slot(a_loc);
+			if (!slot || slot->count.fetch_add(1, std::memory_order_relaxed) < budget) {
+				return true;
+			}
+
+			return rate_limit_slow(*slot, a_loc, a_level);
+		}
+	}
+
+	/**
+	 * Limits every call site to <code>a_count</code> messages per <code>a_period</code>. A count of 0 disables limiting.
+	 */
+	void set_rate_limit(std::uint32_t a_count, std::chrono::milliseconds a_period = std::chrono::seconds(1)) noexcept;
+
+	/**
+	 * Logs a summary for every call site with suppressed messages, and starts a new period for it.
+	 * Runs automatically at exit once <code>init</code> has set up the logger.
+	 */
+	void flush_rate_limits();
+
 	F4SE_MAKE_SOURCE_LOGGER(trace, trace);
 	F4SE_MAKE_SOURCE_LOGGER(debug, debug);
 	F4SE_MAKE_SOURCE_LOGGER(info, info);
@@ -0,0 +1,141 @@
+#pragma once
+
+#ifndef F4SE_TEST_SUITE
+#include "F4SE/Interfaces.hpp"
+#endif
+
+namespace F4SE
+{
+	/**
+	 * A message which can be sent over a <code>MessageChannel</code>.
+	 *
+	 * <p>
+	 * Message types declare their id and layout version as static members:
+	 * <code>static constexpr std::uint32_t MESSAGE_ID</code> and
+	 * <code>static constexpr std::uint16_t MESSAGE_VERSION</code>.
+	 * </p>
+	 */
+	template <class T>
+	concept channel_message =
+		std::is_trivially_copyable_v<T> &&
+		sizeof(T) <= 0xFFFF &&
+		requires {
+			{ T::MESSAGE_ID } -> std::convertible_to<std::uint32_t>;
+			{ T::MESSAGE_VERSION } -> std::convertible_to<std::uint16_t>;
+		};
+
+	namespace detail
+	{
+		struct channel_header_t
+		{
+			std::uint32_t id;
+			std::uint16_t version;
+			std::uint16_t size;
+		};
+		static_assert(sizeof(channel_header_t) == 0x8);
+
+		template <channel_message T>
+		struct channel_packet_t
+		{
+			channel_header_t header;
+			T payload;
+		};
+	}
+
+	/**
+	 * Sends <code>a_message</code> through <code>a_intfc</code>, framed so a <code>MessageChannel</code> can validate it.
+	 *
+	 * <p>
+	 * The packet lives on the stack. <code>Intfc</code> only needs a <code>MessagingInterface</code>
+	 * compatible <code>Dispatch</code>, so a host-side mock can stand in for F4SE.
+	 * </p>
+	 */
+	template <channel_message T, class Intfc = MessagingInterface>
+	bool SendChannelMessage(const Intfc& a_intfc, const T& a_message, const char* a_receiver = nullptr)
+	{
+		detail::channel_packet_t<T> packet{
+			{ static_cast<std::uint32_t>(T::MESSAGE_ID), static_cast<std::uint16_t>(T::MESSAGE_VERSION), static_cast<std::uint16_t>(sizeof(T)) },
+			a_message
+		};
+
+		return a_intfc.Dispatch(
+			static_cast<std::uint32_t>(T::MESSAGE_ID),
+			std::addressof(packet),
+			static_cast<std::uint32_t>(sizeof(packet)),
+			a_receiver);
+	}
+
+	/**
+	 * Routes raw F4SE messages to typed handlers.
+	 *
+	 * <p>
+	 * Dispatch compares the id against each declared one as constants, which the compiler lowers to
+	 * a switch, with its jump table or compare tree, over inlined validating handlers. A message
+	 * reaches <code>a_handler</code> as a <code>const T&</code> only if its id, version and size all
+	 * match the declaration of <code>T</code>.
+	 * </p>
+	 */
+	template <channel_message... Ts>
+	class MessageChannel
+	{
+	public:
+		static_assert(sizeof...(Ts) > 0, "a channel needs at least one message type");
+
+		enum class Result
+		{
+			kHandled,
+			kUnknownID,
+			kBadVersion,
+			kBadSize
+		};
+
+		template <class Handler>
+		static Result dispatch(const MessagingInterface::Message& a_msg, Handler&& a_handler)
+		{
+			static_assert(unique_ids(), "duplicate message id in channel");
+
+			auto result = Result::kUnknownID;
+			std::ignore = ((a_msg.type == Ts::MESSAGE_ID && (result = invoke<Ts>(a_msg, a_handler), true)) || ...);
+			return result;
+		}
+
+	private:
+		[[nodiscard]] static consteval bool unique_ids()
+		{
+			std::array<std::uint32_t, sizeof...(Ts)> ids{ static_cast<std::uint32_t>(Ts::MESSAGE_ID)... };
+			std::ranges::sort(ids);
+			return std::ranges::adjacent_find(ids) == ids.end();
+		}
+
+		template <channel_message T, class Handler>
+		static Result invoke(const MessagingInterface::Message& a_msg, Handler& a_handler)
+		{
+			if (!a_msg.data || a_msg.dataLen != sizeof(detail::channel_packet_t<T>)) {
+				return Result::kBadSize;
+			}
+
+			detail::channel_header_t header{};
+			std::memcpy(std::addressof(header), a_msg.data, sizeof(header));
+			if (header.id != T::MESSAGE_ID) {
+				return Result::kUnknownID;
+			}
+			if (header.version != T::MESSAGE_VERSION) {
+				return Result::kBadVersion;
+			}
+			if (header.size != sizeof(T)) {
+				return Result::kBadSize;
+			}
+
+			// the sender's buffer carries no alignment guarantee
+			std::array<std::byte, sizeof(T)> raw;
+			std::memcpy(
+				raw.data(),
+				static_cast<const std::byte*>(a_msg.data) + offsetof(detail::channel_packet_t<T>, payload),
+				sizeof(T));
+			const auto message = std::bit_cast<T>(raw);
+
+			std::invoke(a_handler, message);
+			return Result::kHandled;
+		}
+	};
+}
@@ -0,0 +1,277 @@
+#pragma once
+
+#ifndef F4SE_TEST_SUITE
+#include "F4SE/Interfaces.hpp"
+#endif
+
+namespace F4SE
+{
+	namespace detail
+	{
+		template <class T>
+		concept record_integral = std::integral<T> && !std::same_as<T, bool>;
+
+		// views such as span and string_view are trivially copyable too, but copying them would save the pointer
+		template <class T>
+		concept record_view = std::ranges::borrowed_range<T>;
+
+		template <class T>
+		concept record_trivial = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !record_view<T>;
+
+		template <record_integral T>
+		[[nodiscard]] constexpr std::uint64_t zigzag_encode(T a_value) noexcept
+		{
+			if constexpr (std::is_signed_v<T>) {
+				const auto value = static_cast<std::int64_t>(a_value);
+				return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+			}
+			else {
+				return static_cast<std::uint64_t>(a_value);
+			}
+		}
+
+		template <record_integral T>
+		[[nodiscard]] constexpr T zigzag_decode(std::uint64_t a_value) noexcept
+		{
+			if constexpr (std::is_signed_v<T>) {
+				return static_cast<T>(static_cast<std::int64_t>(a_value >> 1) ^ -static_cast<std::int64_t>(a_value & 1));
+			}
+			else {
+				return static_cast<T>(a_value);
+			}
+		}
+
+		/**
+		 * A byte-oriented LZ77 block codec in the spirit of LZ4: 4-bit literal/match length tokens,
+		 * 16-bit back references and a single-probe hash table.
+		 */
+		void lz_compress(std::span<const std::byte> a_src, std::vector<std::byte>& a_dst);
+		[[nodiscard]] bool lz_decompress(std::span<const std::byte> a_src, std::span<std::byte> a_dst) noexcept;
+	}
+
+	enum class RecordCodec : std::uint8_t
+	{
+		kNone,
+		kLZ
+	};
+
+	/**
+	 * Writes a record whose body is compressed with <code>a_codec</code>.
+	 *
+	 * <p>
+	 * The body is prefixed with a header holding the codec id and the raw length. Bodies smaller than
+	 * <code>a_threshold</code>, or which do not shrink, are stored uncompressed under the same header.
+	 * </p>
+	 */
+	bool WriteCompressedRecord(
+		const SerializationInterface& a_intfc,
+		std::uint32_t a_type,
+		std::uint32_t a_version,
+		std::span<const std::byte> a_data,
+		RecordCodec a_codec = RecordCodec::kLZ,
+		std::size_t a_threshold = 256);
+
+	/**
+	 * Reads the body of the current record, as written by <code>WriteCompressedRecord</code>.
+	 */
+	[[nodiscard]] std::optional<std::vector<std::byte>> ReadCompressedRecord(const SerializationInterface& a_intfc, std::uint32_t a_length);
+
+	/**
+	 * Buffers the body of a co-save record and hands it to F4SE in large chunks.
+	 *
+	 * <p>
+	 * The record is opened on construction and flushed on destruction. Once a write fails, every
+	 * later write is dropped and <code>good</code> returns false.
+	 * </p>
+	 */
+	class RecordWriter
+	{
+	public:
+		static constexpr std::size_t CHUNK_SIZE = 1u << 16;
+
+		RecordWriter(const SerializationInterface& a_intfc, std::uint32_t a_type, std::uint32_t a_version);
+		RecordWriter(const RecordWriter&) = delete;
+		RecordWriter(RecordWriter&&) = delete;
+
+		~RecordWriter() { flush(); }
+
+		RecordWriter& operator=(const RecordWriter&) = delete;
+		RecordWriter& operator=(RecordWriter&&) = delete;
+
+		[[nodiscard]] bool good() const noexcept { return _good; }
+		[[nodiscard]] explicit operator bool() const noexcept { return good(); }
+
+		bool flush();
+
+		bool write(const void* a_buf, std::size_t a_length);
+
+		template <detail::record_trivial T>
+		bool write(const T& a_value)
+		{
+			return write(std::addressof(a_value), sizeof(T));
+		}
+
+		/**
+		 * Writes an element count followed by the elements themselves.
+		 */
+		template <detail::record_trivial T, std::size_t N>
+		bool write(std::span<T, N> a_values)
+		{
+			return write_varint(a_values.size()) && write(a_values.data(), a_values.size_bytes());
+		}
+
+		template <detail::record_trivial T>
+		bool write(const std::vector<T>& a_values)
+		{
+			return write(std::span<const T>{ a_values });
+		}
+
+		/**
+		 * Writes an integer in LEB128 form, zigzag encoding signed values first.
+		 */
+		template <detail::record_integral T>
+		bool write_varint(T a_value)
+		{
+			std::array<std::byte, 10> buf{};
+			std::size_t len = 0;
+			for (auto value = detail::zigzag_encode(a_value);; value >>= 7) {
+				if (value < 0x80) {
+					buf[len++] = static_cast<std::byte>(value);
+					break;
+				}
+				buf[len++] = static_cast<std::byte>((value & 0x7F) | 0x80);
+			}
+
+			return write(buf.data(), len);
+		}
+
+		bool write_string(std::string_view a_string)
+		{
+			return write_varint(a_string.size()) && write(a_string.data(), a_string.size());
+		}
+
+		bool write(std::string_view a_string) { return write_string(a_string); }
+
+	private:
+		const SerializationInterface& _intfc;
+		std::vector<std::byte> _buffer;
+		bool _good{ false };
+	};
+
+	/**
+	 * Reads the body of the current co-save record through a local buffer.
+	 *
+	 * <p>
+	 * Construct one after <code>GetNextRecordInfo</code> with the length it reported. Reads past the
+	 * end of the record fail without calling into F4SE, and the reader stays failed afterwards.
+	 * </p>
+	 */
+	class RecordReader
+	{
+	public:
+		static constexpr std::size_t CHUNK_SIZE = 1u << 16;
+
+		RecordReader(const SerializationInterface& a_intfc, std::uint32_t a_length);
+		RecordReader(const RecordReader&) = delete;
+		RecordReader(RecordReader&&) = delete;
+
+		~RecordReader() = default;
+
+		RecordReader& operator=(const RecordReader&) = delete;
+		RecordReader& operator=(RecordReader&&) = delete;
+
+		[[nodiscard]] bool good() const noexcept { return _good; }
+		[[nodiscard]] explicit operator bool() const noexcept { return good(); }
+
+		[[nodiscard]] std::size_t remaining() const noexcept { return _unread + (_buffer.size() - _pos); }
+
+		bool read(void* a_buf, std::size_t a_length);
+
+		template <detail::record_trivial T>
+		bool read(T& a_value)
+		{
+			return read(std::addressof(a_value), sizeof(T));
+		}
+
+		/**
+		 * Reads an element count followed by the elements, as written by <code>RecordWriter</code>.
+		 */
+		template <detail::record_trivial T>
+		bool read(std::vector<T>& a_values)
+		{
+			std::size_t count = 0;
+			if (!read_varint(count)) {
+				return false;
+			}
+
+			if (count > remaining() / std::max<std::size_t>(sizeof(T), 1)) {
+				_good = false;
+				return false;
+			}
+
+			a_values.resize(count);
+			return read(a_values.data(), count * sizeof(T));
+		}
+
+		template <detail::record_integral T>
+		bool read_varint(T& a_value)
+		{
+			// decode straight from the buffer while the longest varint still fits in what is left of it
+			if (_good && _buffer.size() - _pos >= MAX_VARINT) {
+				const auto bytes = _buffer.data() + _pos;
+				std::uint64_t value = 0;
+				for (std::size_t i = 0; i < MAX_VARINT; ++i) {
+					const auto byte = std::to_integer<std::uint64_t>(bytes[i]);
+					value |= (byte & 0x7F) << (7 * i);
+					if (byte < 0x80) {
+						_pos += i + 1;
+						a_value = detail::zigzag_decode<T>(value);
+						return true;
+					}
+				}
+
+				_good = false;
+				return false;
+			}
+
+			std::uint64_t value = 0;
+			for (std::uint32_t shift = 0; shift < 64; shift += 7) {
+				std::byte byte{};
+				if (!read(byte)) {
+					return false;
+				}
+
+				value |= static_cast<std::uint64_t>(byte & std::byte{ 0x7F }) << shift;
+				if ((byte & std::byte{ 0x80 }) == std::byte{ 0 }) {
+					a_value = detail::zigzag_decode<T>(value);
+					return true;
+				}
+			}
+
+			_good = false;
+			return false;
+		}
+
+		bool read_string(std::string& a_string);
+
+		bool read(std::string& a_string) { return read_string(a_string); }
+
+		/**
+		 * Resolves every form id in place, memoizing repeated ids. Unresolved ids are set to 0.
+		 *
+		 * @return The number of ids which resolved.
+		 */
+		std::size_t resolve_form_ids(std::span<RE::TESFormID> a_formIDs) const;
+
+	private:
+		static constexpr std::size_t MAX_VARINT = 10;
+
+		bool refill(std::size_t a_length);
+
+		const SerializationInterface& _intfc;
+		std::vector<std::byte> _buffer;
+		std::size_t _pos{ 0 };
+		std::size_t _unread{ 0 };
+		bool _good{ true };
+	};
+}
@@ -9,6 +9,71 @@ namespace Xbyak
 
 namespace F4SE
 {
+	/**
+	 * The operating system's view of the process address space, as needed to place a trampoline.
+	 */
+	class AddressSpace
+	{
+	public:
+		struct region_t
+		{
+			std::uintptr_t base;
+			std::size_t size;
+			bool free;
+		};
+
+		virtual ~AddressSpace() = default;
+
+		[[nodiscard]] virtual std::size_t granularity() const noexcept = 0;
+
+		/**
+		 * Returns the region containing <code>a_address</code>, or nothing if the query failed.
+		 */
+		[[nodiscard]] virtual std::optional<region_t> query(std::uintptr_t a_address) const noexcept = 0;
+
+		/**
+		 * Commits executable memory at exactly <code>a_address</code>, returning null on failure.
+		 */
+		[[nodiscard]] virtual void* allocate(std::uintptr_t a_address, std::size_t a_size) noexcept = 0;
+
+		/**
+		 * Returns the default implementation, backed by <code>VirtualQuery</code> and <code>VirtualAlloc</code>,
+		 * or by <code>/proc/self/maps</code> and <code>mmap</code> in the host tests.
+		 */
+		[[nodiscard]] static AddressSpace& get() noexcept;
+	};
+
+	/**
+	 * Finds free memory near an address by walking regions outward in both directions, closest first.
+	 *
+	 * <p>
+	 * Examined regions are cached between searches. A free region which turns out to be stale is dropped
+	 * from the cache once allocating from it fails.
+	 * </p>
+	 */
+	class NearRegionFinder
+	{
+	public:
+		explicit NearRegionFinder(AddressSpace& a_space) noexcept :
+			_space(a_space)
+		{
+		}
+
+		/**
+		 * Allocates <code>a_size</code> bytes starting within <code>a_range</code> bytes of <code>a_address</code>.
+		 */
+		[[nodiscard]] void* allocate(std::uintptr_t a_address, std::size_t a_size, std::size_t a_range);
+
+		void clear() noexcept { _regions.clear(); }
+
+	private:
+		[[nodiscard]] std::optional<AddressSpace::region_t> region(std::uintptr_t a_address);
+		[[nodiscard]] void* place(const AddressSpace::region_t& a_region, std::uintptr_t a_min, std::uintptr_t a_max, std::size_t a_size, bool a_high);
+
+		AddressSpace& _space;
+		std::map<std::uintptr_t, AddressSpace::region_t> _regions;
+	};
+
 	class Trampoline
 	{
 	public:
@@ -56,30 +121,61 @@ namespace F4SE
 			log_stats();
 		}
 
-		[[nodiscard]] void* allocate(std::size_t a_size)
+		[[nodiscard]] void* allocate(std::size_t a_size, std::source_location a_loc = std::source_location::current())
 		{
-			auto result = do_allocate(a_size);
+			auto result = do_allocate(a_size, a_loc);
 			log_stats();
 			return result;
 		}
 
 #ifdef F4SE_SUPPORT_XBYAK
-		[[nodiscard]] void* allocate(const Xbyak::CodeGenerator& a_code);
+		[[nodiscard]] void* allocate(const Xbyak::CodeGenerator& a_code, std::source_location a_loc = std::source_location::current());
 #endif
 
 		template <class T>
-		[[nodiscard]] T* allocate()
+		[[nodiscard]] T* allocate(std::source_location a_loc = std::source_location::current())
 		{
-			return static_cast<T*>(allocate(sizeof(T)));
+			return static_cast<T*>(allocate(sizeof(T), a_loc));
 		}
 
+		/**
+		 * Copies a stub into the trampoline, sharing the earlier copy if identical bytes were already allocated
+		 * through this function.
+		 *
+		 * <p>
+		 * Shared stubs must be treated as read-only, and must not be handed to <code>deallocate</code>.
+		 * </p>
+		 */
+		[[nodiscard]] void* allocate_stub(std::span<const std::byte> a_code, std::source_location a_loc = std::source_location::current());
+
+		/**
+		 * Returns a block to the trampoline so later allocations of a similar size can reuse it.
+		 *
+		 * <p>
+		 * Blocks handed out by <code>write_branch</code>, <code>write_call</code> and <code>allocate_stub</code>
+		 * are shared between callers and must never be deallocated.
+		 * </p>
+		 */
+		void deallocate(void* a_mem, std::size_t a_size);
+
 		[[nodiscard]] constexpr std::size_t empty() const noexcept { return _capacity == 0; }
 		[[nodiscard]] constexpr std::size_t capacity() const noexcept { return _capacity; }
-		[[nodiscard]] constexpr std::size_t allocated_size() const noexcept { return _size; }
+		[[nodiscard]] constexpr std::size_t allocated_size() const noexcept { return _size - _reusableSize; }
 		[[nodiscard]] constexpr std::size_t free_size() const noexcept { return _capacity - _size; }
+		[[nodiscard]] constexpr std::size_t reusable_size() const noexcept { return _reusableSize; }
+
+		/**
+		 * Returns the bytes lost to block tails which were too small to hand back for reuse.
+		 */
+		[[nodiscard]] constexpr std::size_t wasted_size() const noexcept { return _wastedSize; }
+
+		/**
+		 * Logs the trampoline's usage, optionally broken down by the call site of each allocation.
+		 */
+		void log_stats(bool a_perCaller = false) const;
 
 		template <std::size_t N>
-		std::uintptr_t write_branch(std::uintptr_t a_src, std::uintptr_t a_dst)
+		std::uintptr_t write_branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::source_location a_loc = std::source_location::current())
 		{
 			std::uint8_t data = 0;
 			if constexpr (N == 5) {
@@ -96,17 +192,17 @@ namespace F4SE
 				static_assert(false && N, "invalid branch size");
 			}
 
-			return write_branch<N>(a_src, a_dst, data);
+			return write_branch<N>(a_src, a_dst, data, a_loc);
 		}
 
 		template <std::size_t N, class F>
-		std::uintptr_t write_branch(std::uintptr_t a_src, F a_dst)
+		std::uintptr_t write_branch(std::uintptr_t a_src, F a_dst, std::source_location a_loc = std::source_location::current())
 		{
-			return write_branch<N>(a_src, stl::unrestricted_cast<std::uintptr_t>(a_dst));
+			return write_branch<N>(a_src, stl::unrestricted_cast<std::uintptr_t>(a_dst), a_loc);
 		}
 
 		template <std::size_t N>
-		std::uintptr_t write_call(std::uintptr_t a_src, std::uintptr_t a_dst)
+		std::uintptr_t write_call(std::uintptr_t a_src, std::uintptr_t a_dst, std::source_location a_loc = std::source_location::current())
 		{
 			std::uint8_t data = 0;
 			if constexpr (N == 5) {
@@ -123,34 +219,37 @@ namespace F4SE
 				static_assert(false && N, "invalid call size");
 			}
 
-			return write_branch<N>(a_src, a_dst, data);
+			return write_branch<N>(a_src, a_dst, data, a_loc);
 		}
 
 		template <std::size_t N, class F>
-		std::uintptr_t write_call(std::uintptr_t a_src, F a_dst)
+		std::uintptr_t write_call(std::uintptr_t a_src, F a_dst, std::source_location a_loc = std::source_location::current())
 		{
-			return write_call<N>(a_src, stl::unrestricted_cast<std::uintptr_t>(a_dst));
+			return write_call<N>(a_src, stl::unrestricted_cast<std::uintptr_t>(a_dst), a_loc);
 		}
 
 	private:
 		[[nodiscard]] static void* do_create(std::size_t a_size, std::uintptr_t a_address);
-		[[nodiscard]] void* do_allocate(std::size_t a_size);
+		[[nodiscard]] void* do_allocate(std::size_t a_size, const std::source_location& a_loc);
+		[[nodiscard]] std::byte* reuse(std::size_t a_size);
+		void recycle(std::byte* a_mem, std::size_t a_size);
+		void log_callers(bool a_failed) const;
 
-		void write_5branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_opcode);
-		void write_6branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_modrm);
+		void write_5branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_opcode, const std::source_location& a_loc);
+		void write_6branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_modrm, const std::source_location& a_loc);
 
 		template <std::size_t N>
-		[[nodiscard]] std::uintptr_t write_branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_data)
+		[[nodiscard]] std::uintptr_t write_branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_data, const std::source_location& a_loc)
 		{
 			const auto disp = reinterpret_cast<std::int32_t*>(a_src + N - 4);
 			const auto nextOp = a_src + N;
 			const auto func = nextOp + *disp;
 
 			if constexpr (N == 5) {
-				write_5branch(a_src, a_dst, a_data);
+				write_5branch(a_src, a_dst, a_data, a_loc);
 			}
 			else if constexpr (N == 6) {
-				write_6branch(a_src, a_dst, a_data);
+				write_6branch(a_src, a_dst, a_data, a_loc);
 			}
 			else {
 				static_assert(false && N, "invalid branch size");
@@ -163,6 +262,9 @@ namespace F4SE
 		{
 			_5branches = std::move(a_rhs._5branches);
 			_6branches = std::move(a_rhs._6branches);
+			_stubs = std::move(a_rhs._stubs);
+			_freeBlocks = std::move(a_rhs._freeBlocks);
+			_callers = std::move(a_rhs._callers);
 			_name = std::move(a_rhs._name);
 
 			_deleter = std::move(a_rhs._deleter);
@@ -175,9 +277,13 @@ namespace F4SE
 
 			_size = a_rhs._size;
 			a_rhs._size = 0;
-		}
 
-		void log_stats() const;
+			_reusableSize = a_rhs._reusableSize;
+			a_rhs._reusableSize = 0;
+
+			_wastedSize = a_rhs._wastedSize;
+			a_rhs._wastedSize = 0;
+		}
 
 		void release()
 		{
@@ -187,9 +293,16 @@ namespace F4SE
 
 			_5branches.clear();
 			_6branches.clear();
+			_stubs.clear();
+			for (auto& blocks : _freeBlocks) {
+				blocks.clear();
+			}
+			_callers.clear();
 			_data = nullptr;
 			_capacity = 0;
 			_size = 0;
+			_reusableSize = 0;
+			_wastedSize = 0;
 		}
 
 		[[nodiscard]] static bool in_range(std::ptrdiff_t a_disp)
@@ -200,13 +313,59 @@ namespace F4SE
 			return min <= a_disp && a_disp <= max;
 		}
 
+		struct block_t
+		{
+			std::byte* mem;
+			std::size_t size;
+		};
+
+		struct usage_t
+		{
+			std::size_t bytes{ 0 };
+			std::size_t allocations{ 0 };
+			std::size_t reused{ 0 };
+			std::size_t shared{ 0 };
+		};
+
+		using caller_t = std::pair<std::string_view, std::uint_least32_t>;
+
+		// stubs are ordered by length first, so most lookups never compare bytes
+		struct stub_less
+		{
+			[[nodiscard]] bool operator()(const std::vector<std::byte>& a_lhs, const std::vector<std::byte>& a_rhs) const noexcept
+			{
+				if (a_lhs.size() != a_rhs.size()) {
+					return a_lhs.size() < a_rhs.size();
+				}
+				return !a_lhs.empty() && std::memcmp(a_lhs.data(), a_rhs.data(), a_lhs.size()) < 0;
+			}
+		};
+
+		// free blocks are binned by size class, where class i holds blocks in [2^i, 2^(i+1))
+		static constexpr std::size_t SIZE_CLASSES = 12;
+
+		[[nodiscard]] static constexpr std::size_t size_class(std::size_t a_size) noexcept
+		{
+			return std::min<std::size_t>(std::bit_width(a_size) - 1, SIZE_CLASSES - 1);
+		}
+
+		[[nodiscard]] usage_t& usage(const std::source_location& a_loc)
+		{
+			return _callers[{ a_loc.file_name(), a_loc.line() }];
+		}
+
 		std::map<std::uintptr_t, std::byte*> _5branches;
 		std::map<std::uintptr_t, std::byte*> _6branches;
+		std::map<std::vector<std::byte>, std::byte*, stub_less> _stubs;
+		std::array<std::vector<block_t>, SIZE_CLASSES> _freeBlocks;
+		std::map<caller_t, usage_t> _callers;
 		std::string _name{ "Default Trampoline"sv };
 		deleter_type _deleter;
 		std::byte* _data{ nullptr };
 		std::size_t _capacity{ 0 };
 		std::size_t _size{ 0 };
+		std::size_t _reusableSize{ 0 };
+		std::size_t _wastedSize{ 0 };
 	};
 
 	[[nodiscard]] Trampoline& GetTrampoline() noexcept;
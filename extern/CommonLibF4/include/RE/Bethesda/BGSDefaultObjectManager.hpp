@@ -512,3 +512,13 @@ namespace RE
 	};
 	static_assert(sizeof(BGSDefaultObject) == 0x38);
 }
+
+namespace REX
+{
+	template <>
+	struct EnumRange<RE::DEFAULT_OBJECT>
+	{
+		static constexpr std::int64_t min = 0;
+		static constexpr std::int64_t max = static_cast<std::int64_t>(RE::DEFAULT_OBJECT::kTotal);
+	};
+}
@@ -106,12 +106,11 @@ namespace RE
 				return val;
 			}
 
+			// the value lives only while the entry has one, construct_at and destroy_at manage it
 			union value_union
 			{
-				value_union() :
-					value() {}
-
-				~value_union() { value.~value_type(); }
+				value_union() noexcept {}
+				~value_union() noexcept {}
 
 				value_type value;
 				std::byte buffer[sizeof(value_type)]{ static_cast<std::byte>(0) };
@@ -178,7 +177,7 @@ namespace RE
 			iterator_base operator++(int) noexcept
 			{
 				iterator_base result = *this;
-				++result;
+				++*this;
 				return result;
 			}
 
@@ -226,6 +225,13 @@ namespace RE
 		using iterator = iterator_base<value_type>;
 		using const_iterator = iterator_base<const value_type>;
 
+	private:
+		// allocators that remember erased slots let inserts reuse them instead of sweeping the table
+		static constexpr bool TRACKS_FREE_SLOTS = requires(allocator_type& a_allocator) {
+			{ a_allocator.free_slots() } -> std::same_as<std::vector<size_type>&>;
+		};
+
+	public:
 		BSTScatterTable() = default;
 
 		BSTScatterTable(const BSTScatterTable& a_rhs) { insert(a_rhs.begin(), a_rhs.end()); }
@@ -291,6 +297,7 @@ namespace RE
 				}
 				_free = _capacity;
 				_good = 0;
+				reset_free_slots();
 			}
 
 			assert(empty());
@@ -322,8 +329,12 @@ namespace RE
 		size_type erase(const key_type& a_key)
 		{
 			const auto pos = find(a_key);
-			const auto result = pos != end() ? erase(pos) : pos;
-			return result != end() ? 1 : 0;
+			if (pos == end()) {
+				return 0;
+			}
+
+			erase(pos);
+			return 1;
 		}
 
 		[[nodiscard]] iterator find(const key_type& a_key) { return do_find<iterator>(a_key); }
@@ -361,6 +372,7 @@ namespace RE
 				_capacity = a_newCap;
 				_free = _capacity;
 				_good = 0;
+				reset_free_slots();
 			};
 
 			if (newEntries == oldEntries) {
@@ -426,9 +438,12 @@ namespace RE
 				}
 
 				entry->destroy();
+				mark_free(entry);
 			}
 			else { // move next into current
-				*entry = std::move(*entry->next);
+				const auto next = entry->next;
+				*entry = std::move(*next);
+				mark_free(next);
 			}
 
 			++_free;
@@ -510,6 +525,7 @@ namespace RE
 				_capacity = 0;
 				_free = 0;
 				_good = 0;
+				reset_free_slots();
 			}
 
 			assert(get_entries() == nullptr);
@@ -547,12 +563,46 @@ namespace RE
 			}());
 
 			const auto entries = get_entries();
+			if constexpr (TRACKS_FREE_SLOTS) {
+				// erased slots first, skipping any that an insert has since claimed as its home slot
+				auto& slots = _allocator.free_slots();
+				while (!slots.empty()) {
+					const auto index = slots.back();
+					slots.pop_back();
+					if (!entries[index].has_value()) {
+						return entries[index];
+					}
+				}
+			}
+
+			// the sweep never passes a free slot, so with tracking it only wraps after a reset
 			while (entries[_good].has_value()) {
 				_good = (_good + 1) & (_capacity - 1); // wrap around w/ quick modulo
 			}
 			return entries[_good];
 		}
 
+		void reset_free_slots() noexcept
+		{
+			if constexpr (TRACKS_FREE_SLOTS) {
+				_allocator.free_slots().clear();
+			}
+		}
+
+		void mark_free([[maybe_unused]] const entry_type* a_entry)
+		{
+			if constexpr (TRACKS_FREE_SLOTS) {
+				auto& slots = _allocator.free_slots();
+				if (slots.size() < _capacity) {
+					slots.push_back(static_cast<size_type>(a_entry - get_entries()));
+				}
+				else { // too many stale slots, sweep the whole table again instead
+					slots.clear();
+					_good = 0;
+				}
+			}
+		}
+
 		[[nodiscard]] size_type hash_function(const key_type& a_key) const //
 			noexcept(std::is_nothrow_constructible_v<hasher> &&
 					 std::is_nothrow_invocable_v<const hasher&, const key_type&>)
@@ -659,6 +709,58 @@ namespace RE
 		std::byte* _entries{ nullptr }; // 08 (28)
 	};
 
+	// remembers erased slots next to the entries, only for tables the plugin owns
+	template <std::size_t S, std::size_t A>
+	struct BSTScatterTableTrackedHeapAllocator
+	{
+	public:
+		using size_type = std::uint32_t;
+		using propagate_on_container_move_assignment = std::true_type;
+
+		BSTScatterTableTrackedHeapAllocator() = default;
+		BSTScatterTableTrackedHeapAllocator(const BSTScatterTableTrackedHeapAllocator&) = delete;
+
+		BSTScatterTableTrackedHeapAllocator(BSTScatterTableTrackedHeapAllocator&& a_rhs) noexcept :
+			_entries(std::exchange(a_rhs._entries, nullptr)),
+			_freeSlots(std::move(a_rhs._freeSlots))
+		{
+		}
+
+		~BSTScatterTableTrackedHeapAllocator() = default;
+		BSTScatterTableTrackedHeapAllocator& operator=(const BSTScatterTableTrackedHeapAllocator&) = delete;
+
+		BSTScatterTableTrackedHeapAllocator& operator=(BSTScatterTableTrackedHeapAllocator&& a_rhs) noexcept
+		{
+			if (this != std::addressof(a_rhs)) {
+				assert(_entries == nullptr);
+				_entries = std::exchange(a_rhs._entries, nullptr);
+				_freeSlots = std::move(a_rhs._freeSlots);
+			}
+			return *this;
+		}
+
+		[[nodiscard]] static constexpr size_type min_size() noexcept { return 1u << 3; }
+
+		[[nodiscard]] void* allocate_bytes(std::size_t a_bytes)
+		{
+			assert(a_bytes % S == 0);
+			return malloc(a_bytes);
+		}
+
+		void deallocate_bytes(void* a_ptr) { free(a_ptr); }
+
+		[[nodiscard]] void* get_entries() const noexcept { return _entries; }
+		void set_entries(void* a_entries) noexcept { _entries = static_cast<std::byte*>(a_entries); }
+
+		[[nodiscard]] std::vector<size_type>& free_slots() noexcept { return _freeSlots; }
+
+	private:
+		// members
+		std::uint64_t _pad00{ 0 };		   // 00 (20)
+		std::byte* _entries{ nullptr };	   // 08 (28)
+		std::vector<size_type> _freeSlots; // 10 (30) - erased slots, most recent last
+	};
+
 	template <std::uint32_t N>
 	struct BSTStaticHashMapBase
 	{
@@ -770,6 +872,30 @@ namespace RE
 			BSTSetTraits<Key>,
 			BSTScatterTableHeapAllocator>;
 
+	// for maps the plugin constructs itself, never for maps owned by the game
+	template <
+		class Key,
+		class T,
+		class Hash = BSCRC32<Key>,
+		class KeyEq = std::equal_to<Key>>
+	using BSTPluginHashMap =
+		BSTScatterTable<
+			Hash,
+			KeyEq,
+			BSTScatterTableTraits<Key, T>,
+			BSTScatterTableTrackedHeapAllocator>;
+
+	template <
+		class Key,
+		class Hash = BSCRC32<Key>,
+		class KeyEq = std::equal_to<Key>>
+	using BSTPluginSet =
+		BSTScatterTable<
+			Hash,
+			KeyEq,
+			BSTSetTraits<Key>,
+			BSTScatterTableTrackedHeapAllocator>;
+
 	template <
 		class Key,
 		class T,
@@ -434,3 +434,18 @@ namespace RE
 	extern template ThumbstickEvent* InputEvent::As() noexcept;
 	extern template const ThumbstickEvent* InputEvent::As() const noexcept;
 }
+
+namespace REX
+{
+	// gamepad codes sit above 0x10000, either low in that block or as multiples of 0x100
+	template <>
+	struct EnumRange<RE::BS_BUTTON_CODE>
+	{
+		static constexpr std::int64_t min = 0;
+		static constexpr std::int64_t max = 0xFF;
+		static constexpr std::array strides{
+			EnumStride{ 0x10000, 0x100FF },
+			EnumStride{ 0x10100, 0x1FF00, 0x100 }
+		};
+	};
+}
@@ -1372,4 +1372,18 @@ namespace RE
 		FUNCTION_COUNT = 0x332,
 		SCRIPT_DONE = 0xFFFF,
 	};
-}
\ No newline at end of file
+}
+
+namespace REX
+{
+	// the opcodes run from the flow section to the end of the function section, plus the terminator
+	template <>
+	struct EnumRange<RE::SCRIPT_OUTPUT>
+	{
+		static constexpr std::int64_t min = static_cast<std::int64_t>(RE::SCRIPT_OUTPUT::START_OF_FLOW_SECTION);
+		static constexpr std::int64_t max = static_cast<std::int64_t>(RE::SCRIPT_OUTPUT::END_OF_FUNCTION_SECTION);
+		static constexpr std::array strides{
+			EnumStride{ static_cast<std::int64_t>(RE::SCRIPT_OUTPUT::SCRIPT_DONE), static_cast<std::int64_t>(RE::SCRIPT_OUTPUT::SCRIPT_DONE) }
+		};
+	};
+}
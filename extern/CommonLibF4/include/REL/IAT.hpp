@@ -1,7 +1,47 @@
 #pragma once
 
+#include "REL/PE.hpp"
+
 namespace REL
 {
+	/**
+	 * Maps (dll, function) pairs to the RVA of their import address table slot.
+	 *
+	 * <p>
+	 * Names are compared case-insensitively. The index is read-only once built, so it may be
+	 * queried from any thread.
+	 * </p>
+	 */
+	class ImportIndex
+	{
+	public:
+		explicit ImportIndex(const PEImage& a_image);
+
+		[[nodiscard]] std::optional<std::uint32_t> find(std::string_view a_dll, std::string_view a_function) const noexcept;
+
+		[[nodiscard]] std::size_t size() const noexcept { return _thunks.size(); }
+
+		/**
+		 * Returns the index for a loaded module, building it on first use.
+		 */
+		[[nodiscard]] static const ImportIndex& get(REX::W32::HMODULE a_module);
+
+	private:
+		using key_type = std::pair<std::string_view, std::string_view>;
+
+		struct key_hash
+		{
+			[[nodiscard]] std::size_t operator()(const key_type& a_key) const noexcept;
+		};
+
+		struct key_equal
+		{
+			[[nodiscard]] bool operator()(const key_type& a_lhs, const key_type& a_rhs) const noexcept;
+		};
+
+		std::unordered_map<key_type, std::uint32_t, key_hash, key_equal> _thunks;
+	};
+
 	[[nodiscard]] std::uintptr_t GetIATAddr(std::string_view a_dll, std::string_view a_function);
 	[[nodiscard]] std::uintptr_t GetIATAddr(REX::W32::HMODULE a_module, std::string_view a_dll, std::string_view a_function);
 
@@ -31,40 +31,48 @@ namespace REL
 		std::uint64_t _id{ static_cast<std::uint64_t>(-1) };
 	};
 
-	class RelocationID
+	namespace detail
 	{
-	public:
-		constexpr RelocationID() noexcept = default;
+		// ids indexed by Module::GetRuntimeIndex(), with a trailing 0 for an unknown runtime
+		using runtime_table_t = std::array<std::uint64_t, Module::RUNTIME_COUNT + 1>;
 
-		explicit constexpr RelocationID(
-			[[maybe_unused]] std::uint64_t a_f4ID,
-			[[maybe_unused]] std::uint64_t a_ngID) noexcept
+		[[nodiscard]] constexpr runtime_table_t make_runtime_table(
+			[[maybe_unused]] std::uint64_t a_f4,
+			[[maybe_unused]] std::uint64_t a_ng,
+			[[maybe_unused]] std::uint64_t a_vr) noexcept
 		{
+			runtime_table_t result{};
 #ifdef ENABLE_FALLOUT_F4
-			_f4ID = a_f4ID;
+			result[Module::GetRuntimeIndex(Module::Runtime::F4)] = a_f4;
 #endif
 #ifdef ENABLE_FALLOUT_NG
-			_ngID = a_ngID;
+			result[Module::GetRuntimeIndex(Module::Runtime::NG)] = a_ng;
 #endif
 #ifdef ENABLE_FALLOUT_VR
-			_vrID = a_f4ID;
+			result[Module::GetRuntimeIndex(Module::Runtime::VR)] = a_vr;
 #endif
+			return result;
 		}
+	}
+
+	class RelocationID
+	{
+	public:
+		constexpr RelocationID() noexcept = default;
 
 		explicit constexpr RelocationID(
-			[[maybe_unused]] std::uint64_t a_f4ID,
-			[[maybe_unused]] std::uint64_t a_ngID,
-			[[maybe_unused]] std::uint64_t a_vrID) noexcept
+			std::uint64_t a_f4ID,
+			std::uint64_t a_ngID) noexcept :
+			_ids(detail::make_runtime_table(a_f4ID, a_ngID, a_f4ID))
+		{
+		}
+
+		explicit constexpr RelocationID(
+			std::uint64_t a_f4ID,
+			std::uint64_t a_ngID,
+			std::uint64_t a_vrID) noexcept :
+			_ids(detail::make_runtime_table(a_f4ID, a_ngID, a_vrID))
 		{
-#ifdef ENABLE_FALLOUT_F4
-			_f4ID = a_f4ID;
-#endif
-#ifdef ENABLE_FALLOUT_NG
-			_ngID = a_ngID;
-#endif
-#ifdef ENABLE_FALLOUT_VR
-			_vrID = a_vrID;
-#endif
 		}
 
 		[[nodiscard]] std::uintptr_t address() const
@@ -81,22 +89,12 @@ namespace REL
 
 		[[nodiscard]] FALLOUT_REL std::uint64_t id() const noexcept
 		{
-			switch (Module::GetRuntime()) {
-#ifdef ENABLE_FALLOUT_NG
-				case Module::Runtime::NG:
-					return _ngID;
-#endif
-#ifdef ENABLE_FALLOUT_F4
-				case Module::Runtime::F4:
-					return _f4ID;
-#endif
-#ifdef ENABLE_FALLOUT_VR
-				case Module::Runtime::VR:
-					return _vrID;
-#endif
-				default:
-					return 0;
-			}
+			return _ids[Module::GetRuntimeIndex()];
+		}
+
+		[[nodiscard]] constexpr std::uint64_t id(Module::Runtime a_runtime) const noexcept
+		{
+			return _ids[Module::GetRuntimeIndex(a_runtime)];
 		}
 
 		[[nodiscard]] FALLOUT_REL explicit operator ID() const noexcept
@@ -107,15 +105,7 @@ namespace REL
 	private:
 		[[nodiscard]] static std::uintptr_t base() { return Module::get().base(); }
 
-#ifdef ENABLE_FALLOUT_F4
-		std::uint64_t _f4ID{ 0 };
-#endif
-#ifdef ENABLE_FALLOUT_NG
-		std::uint64_t _ngID{ 0 };
-#endif
-#ifdef ENABLE_FALLOUT_VR
-		std::uint64_t _vrID{ 0 };
-#endif
+		detail::runtime_table_t _ids{};
 	};
 
 	class VariantID
@@ -124,19 +114,11 @@ namespace REL
 		constexpr VariantID() noexcept = default;
 
 		explicit constexpr VariantID(
-			[[maybe_unused]] std::uint64_t a_f4ID,
-			[[maybe_unused]] std::uint64_t a_ngID,
-			[[maybe_unused]] std::uint64_t a_vrOffset) noexcept
+			std::uint64_t a_f4ID,
+			std::uint64_t a_ngID,
+			std::uint64_t a_vrOffset) noexcept :
+			_values(detail::make_runtime_table(a_f4ID, a_ngID, a_vrOffset))
 		{
-#ifdef ENABLE_FALLOUT_F4
-			_f4ID = a_f4ID;
-#endif
-#ifdef ENABLE_FALLOUT_NG
-			_ngID = a_ngID;
-#endif
-#ifdef ENABLE_FALLOUT_VR
-			_vrOffset = a_vrOffset;
-#endif
 		}
 
 		[[nodiscard]] std::uintptr_t address() const
@@ -147,35 +129,104 @@ namespace REL
 
 		[[nodiscard]] std::size_t offset() const
 		{
-			switch (Module::GetRuntime()) {
-#ifdef ENABLE_FALLOUT_NG
-				case Module::Runtime::NG:
-					return _ngID ? IDDB::get().id2offset(_ngID) : 0;
-#endif
-#ifdef ENABLE_FALLOUT_F4
-				case Module::Runtime::F4:
-					return _f4ID ? IDDB::get().id2offset(_f4ID) : 0;
-#endif
-#ifdef ENABLE_FALLOUT_VR
-				case Module::Runtime::VR:
-					return _vrOffset;
-#endif
-				default:
-					return 0;
+			const auto value = _values[Module::GetRuntimeIndex()];
+			if FALLOUT_REL_VR_CONSTEXPR (Module::IsVR()) {
+				return static_cast<std::size_t>(value);
 			}
+
+			return value ? IDDB::get().id2offset(value) : 0;
+		}
+
+		/**
+		 * Returns the address library id for the current runtime, or 0 when it is addressed by offset instead.
+		 */
+		[[nodiscard]] FALLOUT_REL std::uint64_t id() const noexcept
+		{
+			return Module::IsVR() ? 0 : _values[Module::GetRuntimeIndex()];
 		}
 
 	private:
 		[[nodiscard]] static std::uintptr_t base() { return Module::get().base(); }
 
-#ifdef ENABLE_FALLOUT_F4
-		std::uint64_t _f4ID{ 0 };
-#endif
-#ifdef ENABLE_FALLOUT_NG
-		std::uint64_t _ngID{ 0 };
-#endif
-#ifdef ENABLE_FALLOUT_VR
-		std::uint64_t _vrOffset{ 0 };
-#endif
+		detail::runtime_table_t _values{};
+	};
+
+	/**
+	 * A named address library id, so it can be reported when it is missing from the running game.
+	 *
+	 * <p>
+	 * A <code>VariantID</code> addresses VR by offset, which has no address library entry to check,
+	 * so on VR it only counts as missing when its offset is 0.
+	 * </p>
+	 */
+	struct IDEntry
+	{
+		std::string_view name;
+		std::variant<RelocationID, VariantID> id;
+	};
+
+	/**
+	 * Builds a constexpr id table, rejecting unnamed or duplicate entries at compile time.
+	 */
+	template <std::size_t N>
+	[[nodiscard]] consteval std::array<IDEntry, N> make_id_table(const IDEntry (&a_entries)[N])
+	{
+		std::array<IDEntry, N> result{};
+		for (std::size_t i = 0; i < N; ++i) {
+			if (a_entries[i].name.empty()) {
+				throw std::invalid_argument("id table entries must be named");
+			}
+			for (std::size_t j = 0; j < i; ++j) {
+				if (a_entries[j].name == a_entries[i].name) {
+					throw std::invalid_argument("id table entries must have unique names");
+				}
+			}
+			result[i] = a_entries[i];
+		}
+		return result;
+	}
+
+	/**
+	 * Validates constexpr tables of ids against the address library in a single pass at startup.
+	 */
+	class IDRegistry
+	{
+	public:
+		struct Report
+		{
+			[[nodiscard]] bool ok() const noexcept { return missing.empty(); }
+
+			std::size_t checked{ 0 };
+			std::vector<const IDEntry*> missing;
+		};
+
+		IDRegistry(const IDRegistry&) = delete;
+		IDRegistry(IDRegistry&&) = delete;
+
+		IDRegistry& operator=(const IDRegistry&) = delete;
+		IDRegistry& operator=(IDRegistry&&) = delete;
+
+		[[nodiscard]] static IDRegistry& get() noexcept
+		{
+			static IDRegistry singleton;
+			return singleton;
+		}
+
+		/**
+		 * Registers a table of ids. The table must outlive the registry, which a constexpr table does.
+		 */
+		void add(std::span<const IDEntry> a_entries);
+
+		/**
+		 * Checks every registered id for the current runtime, logging each one which is missing.
+		 */
+		[[nodiscard]] Report validate() const;
+
+	private:
+		IDRegistry() = default;
+		~IDRegistry() = default;
+
+		mutable std::mutex _lock;
+		std::vector<std::span<const IDEntry>> _tables;
 	};
 }
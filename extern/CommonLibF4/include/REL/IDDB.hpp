@@ -31,6 +31,11 @@ namespace REL
 
 		[[nodiscard]] std::size_t id2offset(std::uint64_t a_id) const;
 
+		/**
+		 * Checks a sorted list of ids in one pass, setting <code>a_found[i]</code> when <code>a_sortedIDs[i]</code> exists.
+		 */
+		void find_ids(std::span<const std::uint64_t> a_sortedIDs, std::span<bool> a_found) const noexcept;
+
 #ifdef ENABLE_FALLOUT_VR
 		bool IsVRAddressLibraryAtLeastVersion(const char* a_minimalVRAddressLibVersion, bool a_reportAndFail = false) const;
 #endif
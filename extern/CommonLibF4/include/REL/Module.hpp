@@ -36,6 +36,21 @@ namespace REL
 			 */
 			VR = 1 << 2
 		};
+
+		/**
+		 * The number of distinct FALLOUT runtimes, for tables with one entry per runtime.
+		 */
+		static constexpr std::size_t RUNTIME_COUNT = 3;
+
+		/**
+		 * Get the table index of a runtime, or <code>RUNTIME_COUNT</code> if it is unknown.
+		 */
+		[[nodiscard]] static constexpr std::size_t GetRuntimeIndex(Runtime a_runtime) noexcept
+		{
+			const auto value = std::to_underlying(a_runtime);
+			return value != 0 ? static_cast<std::size_t>(std::countr_zero(value)) : RUNTIME_COUNT;
+		}
+
 		[[nodiscard]] static Module& get()
 		{
 			static Module singleton;
@@ -72,6 +87,14 @@ namespace REL
 #endif
 		}
 
+		/**
+		 * Get the table index of the currently-loaded FALLOUT runtime.
+		 */
+		[[nodiscard]] static FALLOUT_REL std::size_t GetRuntimeIndex() noexcept
+		{
+			return GetRuntimeIndex(GetRuntime());
+		}
+
 		/**
 		 * Returns whether the current FALLOUT runtime is a post-Nextgen Update Fallout release.
 		 */
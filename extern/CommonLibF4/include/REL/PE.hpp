@@ -0,0 +1,58 @@
+#pragma once
+
+#include "REX/W32/KERNEL32.hpp"
+
+namespace REL
+{
+	/**
+	 * A bounds-checked view over a 64-bit PE image.
+	 *
+	 * <p>
+	 * The image may either be mapped by the loader, where RVAs are plain offsets, or be the raw
+	 * contents of a file on disk, where RVAs are translated through the section table.
+	 * </p>
+	 */
+	class PEImage
+	{
+	public:
+		enum class Layout
+		{
+			kMapped,
+			kFile
+		};
+
+		constexpr PEImage() noexcept = default;
+
+		PEImage(std::span<const std::byte> a_data, Layout a_layout) noexcept;
+		explicit PEImage(REX::W32::HMODULE a_module) noexcept;
+
+		[[nodiscard]] bool valid() const noexcept { return _ntHeader != nullptr; }
+		[[nodiscard]] std::span<const std::byte> data() const noexcept { return _data; }
+		[[nodiscard]] Layout layout() const noexcept { return _layout; }
+
+		[[nodiscard]] const REX::W32::IMAGE_NT_HEADERS64* nt_header() const noexcept { return _ntHeader; }
+		[[nodiscard]] std::span<const REX::W32::IMAGE_SECTION_HEADER> sections() const noexcept { return _sections; }
+
+		[[nodiscard]] const REX::W32::IMAGE_DATA_DIRECTORY* data_directory(std::uint32_t a_index) const noexcept;
+
+		[[nodiscard]] std::optional<std::size_t> rva_to_offset(std::uint32_t a_rva, std::size_t a_size = 1) const noexcept;
+
+		template <class T>
+		[[nodiscard]] const T* rva_to(std::uint32_t a_rva, std::size_t a_count = 1) const noexcept
+		{
+			const auto offset = rva_to_offset(a_rva, sizeof(T) * a_count);
+			return offset ? reinterpret_cast<const T*>(_data.data() + *offset) : nullptr;
+		}
+
+		/**
+		 * Returns the null-terminated string at <code>a_rva</code>, or an empty view if it is out of bounds.
+		 */
+		[[nodiscard]] std::string_view rva_to_string(std::uint32_t a_rva) const noexcept;
+
+	private:
+		std::span<const std::byte> _data;
+		const REX::W32::IMAGE_NT_HEADERS64* _ntHeader{ nullptr };
+		std::span<const REX::W32::IMAGE_SECTION_HEADER> _sections;
+		Layout _layout{ Layout::kMapped };
+	};
+}
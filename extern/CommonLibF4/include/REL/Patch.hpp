@@ -0,0 +1,112 @@
+#pragma once
+
+namespace REL
+{
+	/**
+	 * Changes page protection on behalf of a <code>PatchTransaction</code>.
+	 */
+	class MemoryProtection
+	{
+	public:
+		virtual ~MemoryProtection() = default;
+
+		[[nodiscard]] virtual std::size_t page_size() const noexcept = 0;
+
+		/**
+		 * Returns the number of bytes from <code>a_address</code> which share its current protection.
+		 */
+		[[nodiscard]] virtual std::size_t extent(std::uintptr_t a_address) const noexcept = 0;
+
+		/**
+		 * Makes the range writable, storing the protection of the range in <code>a_old</code>.
+		 */
+		virtual bool unprotect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t& a_old) noexcept = 0;
+		virtual bool protect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection) noexcept = 0;
+
+		/**
+		 * Returns the default implementation, backed by <code>VirtualProtect</code>, or by
+		 * <code>mprotect</code> in the host tests.
+		 */
+		[[nodiscard]] static MemoryProtection& get() noexcept;
+	};
+
+	/**
+	 * Collects code patches and applies them together.
+	 *
+	 * <p>
+	 * Patches are merged by page, and each merged range has its protection changed only once.
+	 * If any range can not be made writable, nothing is written.
+	 * </p>
+	 */
+	class PatchTransaction
+	{
+	public:
+		explicit PatchTransaction(MemoryProtection& a_protection = MemoryProtection::get()) noexcept :
+			_protection(std::addressof(a_protection))
+		{
+		}
+
+		PatchTransaction(const PatchTransaction&) = delete;
+		PatchTransaction(PatchTransaction&&) noexcept = default;
+
+		PatchTransaction& operator=(const PatchTransaction&) = delete;
+		PatchTransaction& operator=(PatchTransaction&&) noexcept = default;
+
+		void write(std::uintptr_t a_dst, const void* a_src, std::size_t a_count);
+
+		template <std::integral T>
+		void write(std::uintptr_t a_dst, const T& a_data)
+		{
+			write(a_dst, std::addressof(a_data), sizeof(T));
+		}
+
+		template <class T>
+		void write(std::uintptr_t a_dst, std::span<T> a_data)
+		{
+			write(a_dst, a_data.data(), a_data.size_bytes());
+		}
+
+		void fill(std::uintptr_t a_dst, std::uint8_t a_value, std::size_t a_count);
+
+		/**
+		 * Applies the patches queued since the last <code>commit</code>. Patches already applied are
+		 * left alone, so their saved original bytes stay those of the unpatched code.
+		 */
+		bool commit();
+
+		/**
+		 * Restores the bytes overwritten by every applied patch.
+		 */
+		bool rollback();
+
+		[[nodiscard]] bool committed() const noexcept { return _committed; }
+		[[nodiscard]] bool empty() const noexcept { return _patches.empty(); }
+		[[nodiscard]] std::size_t size() const noexcept { return _patches.size(); }
+
+	private:
+		struct patch_t
+		{
+			std::uintptr_t address;
+			std::vector<std::uint8_t> bytes;
+			std::vector<std::uint8_t> original;
+			bool applied{ false };
+		};
+
+		struct range_t
+		{
+			std::uintptr_t address;
+			std::size_t size;
+			std::uint32_t protection;
+		};
+
+		// the pages of the patches whose applied state is a_applied, which are all apply touches
+		[[nodiscard]] std::vector<range_t> merge(bool a_applied) const;
+
+		template <class F>
+		bool apply(bool a_applied, F&& a_func);
+
+		MemoryProtection* _protection;
+		std::vector<patch_t> _patches;
+		bool _committed{ false };
+	};
+}
@@ -1,6 +1,10 @@
 #pragma once
 
+#include "REL/Segment.hpp"
+
+#ifndef F4SE_TEST_SUITE
 #include "REL/Module.hpp"
+#endif
 
 namespace REL
 {
@@ -58,10 +62,12 @@ namespace REL
 			class Hexadecimal
 			{
 			public:
+				static constexpr std::byte value = detail::hexacharacters_to_hexadecimal(HI, LO);
+				static constexpr std::byte mask{ 0xFF };
+
 				[[nodiscard]] static constexpr bool match(std::byte a_byte) noexcept
 				{
-					constexpr auto expected = detail::hexacharacters_to_hexadecimal(HI, LO);
-					return a_byte == expected;
+					return a_byte == value;
 				}
 			};
 
@@ -80,6 +86,9 @@ namespace REL
 			class Wildcard
 			{
 			public:
+				static constexpr std::byte value{ 0x00 };
+				static constexpr std::byte mask{ 0x00 };
+
 				[[nodiscard]] static constexpr bool match(std::byte) noexcept
 				{
 					return true;
@@ -103,12 +112,70 @@ namespace REL
 				requires(characters::wildcard(C1) && characters::wildcard(C2));
 		}
 
+		// bytes which are too common in x64 code to make a good scan anchor
+		[[nodiscard]] constexpr bool common_byte(std::byte a_byte) noexcept
+		{
+			switch (std::to_integer<std::uint8_t>(a_byte)) {
+				case 0x00:
+				case 0x0F:
+				case 0x24:
+				case 0x44:
+				case 0x48:
+				case 0x49:
+				case 0x4C:
+				case 0x89:
+				case 0x8B:
+				case 0x8D:
+				case 0xCC:
+				case 0xE8:
+				case 0xFF:
+					return true;
+				default:
+					return false;
+			}
+		}
+
 		template <class... Rules>
 		class PatternMatcher
 		{
 		public:
 			static_assert(sizeof...(Rules) >= 1, "must provide at least 1 rule for the pattern matcher");
 
+			static constexpr std::array<std::byte, sizeof...(Rules)> bytes{ Rules::value... };
+			static constexpr std::array<std::byte, sizeof...(Rules)> masks{ Rules::mask... };
+
+			/**
+			 * Index of the byte used to pre-filter candidates when scanning, or npos if the pattern is all wildcards.
+			 */
+			static constexpr std::size_t anchor = []() noexcept {
+				auto result = static_cast<std::size_t>(-1);
+				for (std::size_t i = 0; i < masks.size(); ++i) {
+					if (masks[i] != std::byte{ 0x00 }) {
+						if (!common_byte(bytes[i])) {
+							return i;
+						}
+						if (result == static_cast<std::size_t>(-1)) {
+							result = i;
+						}
+					}
+				}
+				return result;
+			}();
+
+			/**
+			 * FNV-1a hash of the pattern, used as its key in a PatternCache.
+			 */
+			static constexpr std::uint64_t hash = []() noexcept {
+				std::uint64_t result = 0xCBF29CE484222325ull;
+				for (std::size_t i = 0; i < bytes.size(); ++i) {
+					result = (result ^ std::to_integer<std::uint64_t>(bytes[i])) * 0x100000001B3ull;
+					result = (result ^ std::to_integer<std::uint64_t>(masks[i])) * 0x100000001B3ull;
+				}
+				return result;
+			}();
+
+			[[nodiscard]] static constexpr std::size_t size() noexcept { return sizeof...(Rules); }
+
 			[[nodiscard]] constexpr bool match(std::span<const std::byte, sizeof...(Rules)> a_bytes) const noexcept
 			{
 				std::size_t i = 0;
@@ -120,6 +187,7 @@ namespace REL
 				return this->match(*reinterpret_cast<const std::byte(*)[sizeof...(Rules)]>(a_address));
 			}
 
+#ifndef F4SE_TEST_SUITE
 			void match_or_fail(std::uintptr_t a_address, std::source_location a_loc = std::source_location::current()) const noexcept
 			{
 				if (!this->match(a_address)) {
@@ -135,6 +203,7 @@ namespace REL
 						a_loc);
 				}
 			}
+#endif
 		};
 
 		void consteval_error(const char* a_error);
@@ -173,6 +242,70 @@ namespace REL
 			}
 		}
 
+		template <class... Matchers>
+		void scan_patterns(
+			std::uintptr_t a_begin,
+			std::size_t a_size,
+			std::array<std::uintptr_t, sizeof...(Matchers)>& a_results,
+			std::array<bool, sizeof...(Matchers)> a_pending) noexcept
+		{
+			constexpr auto N = sizeof...(Matchers);
+			constexpr std::array<std::size_t, N> sizes{ Matchers::size()... };
+			constexpr std::array<std::size_t, N> anchors{ Matchers::anchor... };
+			constexpr std::array<std::uint8_t, N> values{ std::to_integer<std::uint8_t>(Matchers::bytes[Matchers::anchor])... };
+			constexpr std::array<bool (*)(std::uintptr_t) noexcept, N> verify{
+				[](std::uintptr_t a_address) noexcept { return Matchers{}.match(a_address); }...
+			};
+
+			std::size_t remaining = 0;
+			__m128i needles[N];
+			for (std::size_t i = 0; i < N; ++i) {
+				needles[i] = _mm_set1_epi8(static_cast<char>(values[i]));
+				remaining += a_pending[i] ? 1 : 0;
+			}
+
+			const auto test = [&](std::size_t a_index, std::size_t a_pos) noexcept {
+				if (a_pos < anchors[a_index]) {
+					return false;
+				}
+				const auto start = a_pos - anchors[a_index];
+				if (start + sizes[a_index] > a_size || !verify[a_index](a_begin + start)) {
+					return false;
+				}
+				a_results[a_index] = a_begin + start;
+				a_pending[a_index] = false;
+				--remaining;
+				return true;
+			};
+
+			constexpr std::size_t BLOCK = sizeof(__m128i);
+			std::size_t pos = 0;
+			for (; remaining > 0 && pos + BLOCK <= a_size; pos += BLOCK) {
+				const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_begin + pos));
+				for (std::size_t i = 0; i < N; ++i) {
+					if (!a_pending[i]) {
+						continue;
+					}
+					auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needles[i])));
+					while (mask != 0) {
+						if (test(i, pos + std::countr_zero(mask))) {
+							break;
+						}
+						mask &= mask - 1;
+					}
+				}
+			}
+
+			const auto bytes = reinterpret_cast<const std::uint8_t*>(a_begin);
+			for (; remaining > 0 && pos < a_size; ++pos) {
+				for (std::size_t i = 0; i < N; ++i) {
+					if (a_pending[i] && bytes[pos] == values[i]) {
+						test(i, pos);
+					}
+				}
+			}
+		}
+
 		template <class... Bytes>
 		[[nodiscard]] consteval auto make_byte_array(Bytes... a_bytes) noexcept
 			-> std::array<std::byte, sizeof...(Bytes)>
@@ -188,6 +321,117 @@ namespace REL
 		return detail::do_make_pattern<S>();
 	}
 
+	/**
+	 * Caches the offsets found by <code>scan_patterns</code> for a specific version of the game.
+	 *
+	 * <p>
+	 * The cache file is discarded when it was written for a different game version, or when it is
+	 * truncated. Cached offsets are always re-verified against their pattern before they are used.
+	 * </p>
+	 */
+	class PatternCache
+	{
+	public:
+#ifndef F4SE_TEST_SUITE
+		explicit PatternCache(std::filesystem::path a_path);
+#endif
+
+		/**
+		 * Opens a cache keyed by <code>a_version</code> instead of the game version, e.g. for another module.
+		 */
+		PatternCache(std::filesystem::path a_path, std::uint32_t a_version);
+
+		[[nodiscard]] std::size_t size() const noexcept { return _entries.size(); }
+
+		[[nodiscard]] std::optional<std::size_t> find(std::uint64_t a_hash) const noexcept;
+		void insert(std::uint64_t a_hash, std::size_t a_offset);
+
+		bool save();
+
+	private:
+		struct entry_t
+		{
+			std::uint64_t hash;
+			std::uint64_t offset;
+		};
+
+		std::filesystem::path _path;
+		std::uint32_t _version;
+		std::vector<entry_t> _entries;
+		bool _dirty{ false };
+	};
+
+	/**
+	 * Searches a range of memory for several patterns in a single pass.
+	 *
+	 * @return The address of the first match of each pattern, or 0 if the pattern was not found.
+	 */
+	template <class... Matchers>
+	[[nodiscard]] std::array<std::uintptr_t, sizeof...(Matchers)> scan_patterns(std::span<const std::byte> a_bytes, const Matchers&...) noexcept
+	{
+		static_assert(sizeof...(Matchers) >= 1, "must provide at least 1 pattern to scan for");
+		static_assert(((Matchers::anchor != static_cast<std::size_t>(-1)) && ...), "patterns must contain at least 1 non-wildcard byte");
+
+		std::array<std::uintptr_t, sizeof...(Matchers)> result{};
+		std::array<bool, sizeof...(Matchers)> pending;
+		pending.fill(true);
+		detail::scan_patterns<Matchers...>(reinterpret_cast<std::uintptr_t>(a_bytes.data()), a_bytes.size(), result, pending);
+		return result;
+	}
+
+	/**
+	 * Searches a segment, e.g. <code>Segment::text</code>, for several patterns in a single pass.
+	 */
+	template <class... Matchers>
+	[[nodiscard]] std::array<std::uintptr_t, sizeof...(Matchers)> scan_patterns(Segment a_segment, const Matchers&... a_matchers) noexcept
+	{
+		return scan_patterns(std::span{ a_segment.pointer<const std::byte>(), a_segment.size() }, a_matchers...);
+	}
+
+#ifndef F4SE_TEST_SUITE
+	template <class... Matchers>
+	[[nodiscard]] std::array<std::uintptr_t, sizeof...(Matchers)> scan_patterns(Segment a_segment, PatternCache& a_cache, const Matchers&...)
+	{
+		static_assert(sizeof...(Matchers) >= 1, "must provide at least 1 pattern to scan for");
+		static_assert(((Matchers::anchor != static_cast<std::size_t>(-1)) && ...), "patterns must contain at least 1 non-wildcard byte");
+
+		constexpr std::array<std::uint64_t, sizeof...(Matchers)> hashes{ Matchers::hash... };
+		constexpr std::array<std::size_t, sizeof...(Matchers)> sizes{ Matchers::size()... };
+		constexpr std::array<bool (*)(std::uintptr_t) noexcept, sizeof...(Matchers)> verify{
+			[](std::uintptr_t a_address) noexcept { return Matchers{}.match(a_address); }...
+		};
+
+		const auto base = Module::get().base();
+		std::array<std::uintptr_t, sizeof...(Matchers)> result{};
+		std::array<bool, sizeof...(Matchers)> pending;
+		bool scan = false;
+		for (std::size_t i = 0; i < sizeof...(Matchers); ++i) {
+			const auto offset = a_cache.find(hashes[i]);
+			const auto address = offset ? base + *offset : 0;
+			pending[i] = !(address >= a_segment.address() &&
+						   address + sizes[i] <= a_segment.address() + a_segment.size() &&
+						   verify[i](address));
+			if (pending[i]) {
+				scan = true;
+			}
+			else {
+				result[i] = address;
+			}
+		}
+
+		if (scan) {
+			detail::scan_patterns<Matchers...>(a_segment.address(), a_segment.size(), result, pending);
+			for (std::size_t i = 0; i < sizeof...(Matchers); ++i) {
+				if (pending[i] && result[i] != 0) {
+					a_cache.insert(hashes[i], result[i] - base);
+				}
+			}
+		}
+
+		return result;
+	}
+#endif
+
 	static_assert(make_pattern<"40 10 F2 ??">().match(
 		detail::make_byte_array(0x40, 0x10, 0xF2, 0x41)));
 	static_assert(make_pattern<"B8 D0 ?? ?? D4 6E">().match(
@@ -7,6 +7,8 @@
 #include "REL/Module.hpp"
 #include "REL/Offset.hpp"
 #include "REL/Offset2ID.hpp"
+#include "REL/PE.hpp"
+#include "REL/Patch.hpp"
 #include "REL/Pattern.hpp"
 #include "REL/Relocation.hpp"
 #include "REL/Segment.hpp"
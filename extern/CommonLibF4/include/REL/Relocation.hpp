@@ -5,6 +5,7 @@
 #include "REL/ID.hpp"
 #include "REL/Module.hpp"
 #include "REL/Offset.hpp"
+#include "REL/Patch.hpp"
 
 #define REL_MAKE_MEMBER_FUNCTION_POD_TYPE_HELPER_IMPL(a_nopropQual, a_propQual, ...)              \
 	template <                                                                                    \
@@ -375,8 +376,12 @@ namespace REL
 				.addr = static_cast<std::uint64_t>(a_dst),
 			};
 
-			safe_fill(address() + O, INT3, a_count);
-			safe_write(address() + O, &assembly, sizeof(assembly));
+			PatchTransaction patch;
+			patch.fill(address() + O, INT3, a_count);
+			patch.write(address() + O, &assembly, sizeof(assembly));
+			if (!patch.commit()) {
+				stl::report_and_fail(std::format("failed to unprotect {:X} for replace_func", address() + O));
+			}
 		}
 
 		template <std::ptrdiff_t O = 0, class F>
@@ -463,6 +468,26 @@ namespace REL
 			return write_vfunc(a_index, stl::unrestricted_cast<std::uintptr_t>(a_newFunc));
 		}
 
+		/**
+		 * Queues a vfunc write into a transaction, so several vtable hooks share one protection change.
+		 */
+		template <class U = value_type>
+		std::uintptr_t write_vfunc(PatchTransaction& a_patch, std::size_t a_index, std::uintptr_t a_newFunc)
+			requires(std::same_as<U, std::uintptr_t>)
+		{
+			const auto addr = address() + (sizeof(void*) * a_index);
+			const auto result = *reinterpret_cast<std::uintptr_t*>(addr);
+			a_patch.write(addr, a_newFunc);
+			return result;
+		}
+
+		template <class F>
+		std::uintptr_t write_vfunc(PatchTransaction& a_patch, std::size_t a_index, F a_newFunc)
+			requires(std::same_as<value_type, std::uintptr_t>)
+		{
+			return write_vfunc(a_patch, a_index, stl::unrestricted_cast<std::uintptr_t>(a_newFunc));
+		}
+
 	private:
 		// clang-format off
         [[nodiscard]] static std::uintptr_t base() { return Module::get().base(); }
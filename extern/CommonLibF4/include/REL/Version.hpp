@@ -1,5 +1,7 @@
 #pragma once
 
+#include "REX/W32/BASE.hpp"
+
 namespace REL
 {
 	class Version
@@ -128,8 +130,16 @@ namespace REL
 		std::array<value_type, 4> _impl{ 0, 0, 0, 0 };
 	};
 
+	class PEImage;
+
 	[[nodiscard]] std::optional<Version> GetFileVersion(std::string_view a_filename);
 	[[nodiscard]] std::optional<Version> GetFileVersion(std::wstring_view a_filename);
+
+	/**
+	 * Reads the product version from the <code>VS_VERSIONINFO</code> resource of an image, without allocating.
+	 */
+	[[nodiscard]] std::optional<Version> GetFileVersion(const PEImage& a_image) noexcept;
+	[[nodiscard]] std::optional<Version> GetFileVersion(REX::W32::HMODULE a_module) noexcept;
 }
 
 namespace std
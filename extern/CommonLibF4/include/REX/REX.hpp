@@ -1,7 +1,9 @@
 #pragma once
 
 #include "REX/REX/Enum.hpp"
+#include "REX/REX/EnumName.hpp"
 #include "REX/REX/EnumSet.hpp"
+#include "REX/REX/EnumSetScan.hpp"
 #include "REX/REX/INI.hpp"
 #include "REX/REX/JSON.hpp"
 #include "REX/REX/Setting.hpp"
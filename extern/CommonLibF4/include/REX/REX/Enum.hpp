@@ -1,5 +1,7 @@
 #pragma once
 
+#include "REX/REX/EnumName.hpp"
+
 namespace REX
 {
 	template <
@@ -67,6 +69,16 @@ namespace REX
 		[[nodiscard]] constexpr E get() const noexcept { return static_cast<E>(_impl); }
 		[[nodiscard]] constexpr U underlying() const noexcept { return _impl; }
 
+		[[nodiscard]] constexpr std::string_view name() const noexcept { return EnumName(get()); }
+
+		[[nodiscard]] static constexpr std::optional<Enum> parse(std::string_view a_name) noexcept
+		{
+			if (const auto value = EnumCast<E>(a_name)) {
+				return Enum(*value);
+			}
+			return std::nullopt;
+		}
+
 	public:
 		[[nodiscard]] friend constexpr bool operator==(Enum a_lhs, Enum a_rhs) noexcept { return a_lhs.underlying() == a_rhs.underlying(); }
 		[[nodiscard]] friend constexpr bool operator==(Enum a_lhs, E a_rhs) noexcept { return a_lhs.underlying() == static_cast<U>(a_rhs); }
@@ -82,3 +94,43 @@ namespace REX
 		std::underlying_type_t<
 			std::common_type_t<Args...>>>;
 }
+
+namespace std
+{
+	template <class E, class U>
+	struct formatter<REX::Enum<E, U>>
+		: public formatter<string>
+	{
+		constexpr auto parse(format_parse_context& a_ctx) const
+		{
+			return a_ctx.begin();
+		}
+
+		template <class FormatContext>
+		auto format(const REX::Enum<E, U>& a_value, FormatContext& a_ctx) const
+		{
+			return formatter<string>::format(a_value.name().empty() ? std::to_string(a_value.underlying()) : std::string(a_value.name()), a_ctx);
+		}
+	};
+}
+
+#ifdef FMT_VERSION
+namespace fmt
+{
+	template <class E, class U>
+	struct formatter<REX::Enum<E, U>>
+		: public formatter<std::string>
+	{
+		constexpr auto parse(format_parse_context& a_ctx) const
+		{
+			return a_ctx.begin();
+		}
+
+		template <typename FormatContext>
+		auto format(const REX::Enum<E, U>& a_value, FormatContext& a_ctx) const
+		{
+			return formatter<std::string>::format(a_value.name().empty() ? std::to_string(a_value.underlying()) : std::string(a_value.name()), a_ctx);
+		}
+	};
+}
+#endif
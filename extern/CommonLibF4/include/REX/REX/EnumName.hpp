@@ -0,0 +1,487 @@
+#pragma once
+
+namespace REX
+{
+	/**
+	 * The range of values searched for enumerators when reflecting <code>E</code>.
+	 *
+	 * <p>
+	 * Every value in <code>[min, max]</code> is probed, as is every single bit value, so flag enums
+	 * are covered regardless of the range. For unsigned enums, a negative <code>min</code> wraps
+	 * around to the top of the type. Specialize this for enums with larger dense values.
+	 * </p>
+	 *
+	 * <p>
+	 * Enums with a few values far outside their range can also declare <code>strides</code>, an
+	 * array of <code>EnumStride</code> that are probed as well. Strides must not overlap each other.
+	 * Naming a value that is only found in a stride is a binary search instead of an index.
+	 * </p>
+	 *
+	 * <p>
+	 * Only one name is reflected per value, so aliases such as <code>kTotal = kLast</code> are
+	 * printed and parsed by the name the compiler reports for that value.
+	 * </p>
+	 */
+	template <class E>
+	struct EnumRange
+	{
+		static constexpr std::int64_t min = -128;
+		static constexpr std::int64_t max = 255;
+	};
+
+	/**
+	 * The values <code>first</code>, <code>first + step</code>, ... up to <code>last</code>.
+	 */
+	struct EnumStride
+	{
+		std::int64_t first;
+		std::int64_t last;
+		std::int64_t step{ 1 };
+	};
+
+	template <class E>
+	struct EnumEntry
+	{
+		E value;
+		std::string_view name;
+	};
+
+	namespace Impl
+	{
+		[[nodiscard]] constexpr bool IsIdentifierChar(char a_ch) noexcept
+		{
+			return (a_ch >= 'a' && a_ch <= 'z') || (a_ch >= 'A' && a_ch <= 'Z') || (a_ch >= '0' && a_ch <= '9') || a_ch == '_';
+		}
+
+		// the name of V as spelled in the signature of this function, or nothing if V has no enumerator
+		template <auto V>
+		[[nodiscard]] consteval std::string_view EnumValueName() noexcept
+		{
+#ifdef _MSC_VER
+			std::string_view name{ __FUNCSIG__ };
+			name = name.substr(0, name.rfind(">("));
+#else
+			std::string_view name{ __PRETTY_FUNCTION__ };
+			name = name.substr(0, name.find_first_of(";]", name.find("V = ")));
+#endif
+			auto start = name.size();
+			while (start > 0 && IsIdentifierChar(name[start - 1])) {
+				--start;
+			}
+
+			name = name.substr(start);
+			return name.empty() || (name[0] >= '0' && name[0] <= '9') ? std::string_view{} : name;
+		}
+
+		// a variable per value, so each name is its own constant evaluation and large ranges stay within the step limits
+		template <auto V>
+		inline constexpr std::string_view ENUM_VALUE_NAME = EnumValueName<V>();
+
+		// hashes eight characters at a time, so a name is only read once per lookup
+		[[nodiscard]] constexpr std::uint64_t EnumNameHash(std::string_view a_name) noexcept
+		{
+			const auto mix = [](std::uint64_t a_hash) noexcept {
+				a_hash ^= a_hash >> 33;
+				a_hash *= 0xFF51AFD7ED558CCD;
+				a_hash ^= a_hash >> 29;
+				return a_hash;
+			};
+
+			std::uint64_t hash = 0x9E3779B97F4A7C15 ^ a_name.size();
+			std::size_t i = 0;
+			for (; i + 8 <= a_name.size(); i += 8) {
+				std::uint64_t word = 0;
+				if !consteval {
+					std::memcpy(std::addressof(word), a_name.data() + i, 8);  // little endian, like the loop below
+				}
+				else {
+					for (std::size_t j = 0; j < 8; ++j) {
+						word |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(a_name[i + j])) << (j * 8);
+					}
+				}
+				hash = mix(hash ^ word);
+			}
+
+			if (i < a_name.size()) {
+				std::uint64_t word = 0;
+				for (std::size_t j = 0; i + j < a_name.size(); ++j) {
+					word |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(a_name[i + j])) << (j * 8);
+				}
+				hash = mix(hash ^ word);
+			}
+			return hash;
+		}
+
+		[[nodiscard]] constexpr std::uint32_t EnumNameSlot(std::uint64_t a_hash, std::uint32_t a_seed) noexcept
+		{
+			auto hash = a_hash ^ (a_seed * 0x9E3779B97F4A7C15);
+			hash ^= hash >> 32;
+			hash *= 0xC4CEB9FE1A85EC53;
+			return static_cast<std::uint32_t>(hash >> 32);
+		}
+
+		template <class E>
+		struct EnumInfo
+		{
+			using underlying_type = std::underlying_type_t<E>;
+			using unsigned_type = std::make_unsigned_t<underlying_type>;
+
+			static constexpr std::size_t BITS = sizeof(underlying_type) * 8;
+
+			static_assert(EnumRange<E>::min <= EnumRange<E>::max, "EnumRange<E> must not be empty");
+
+			// unsigned enums wrap negative bounds around to their top values, where kNone = -1 ends up
+			static constexpr std::int64_t HI =
+				std::cmp_greater(std::numeric_limits<underlying_type>::max(), EnumRange<E>::max) ?
+					EnumRange<E>::max :
+					static_cast<std::int64_t>(std::numeric_limits<underlying_type>::max());
+			static constexpr std::int64_t LO =
+				std::is_signed_v<underlying_type> ?
+					std::max<std::int64_t>(EnumRange<E>::min, std::numeric_limits<underlying_type>::min()) :
+				BITS < 64 ?
+					std::max<std::int64_t>(EnumRange<E>::min, HI - static_cast<std::int64_t>(std::numeric_limits<unsigned_type>::max())) :
+					EnumRange<E>::min;
+
+			static constexpr std::size_t DENSE = static_cast<std::size_t>(HI - LO + 1);
+
+			[[nodiscard]] static constexpr underlying_type dense_value(std::size_t a_index) noexcept
+			{
+				return static_cast<underlying_type>(LO + static_cast<std::int64_t>(a_index));
+			}
+
+			[[nodiscard]] static constexpr std::size_t dense_index(underlying_type a_value) noexcept
+			{
+				return static_cast<std::size_t>(static_cast<unsigned_type>(static_cast<unsigned_type>(a_value) - static_cast<unsigned_type>(LO)));
+			}
+
+			[[nodiscard]] static constexpr bool is_dense(underlying_type a_value) noexcept
+			{
+				return dense_index(a_value) < DENSE;
+			}
+
+			[[nodiscard]] static constexpr underlying_type bit(std::size_t a_index) noexcept
+			{
+				return static_cast<underlying_type>(static_cast<unsigned_type>(1) << a_index);
+			}
+
+			static constexpr auto STRIDES = [] {
+				if constexpr (requires { EnumRange<E>::strides; }) {
+					return EnumRange<E>::strides;
+				}
+				else {
+					return std::array<EnumStride, 0>{};
+				}
+			}();
+
+			static_assert(std::ranges::all_of(STRIDES, [](const EnumStride& a_stride) { return a_stride.step > 0 && a_stride.first <= a_stride.last; }), "EnumRange<E>::strides must step forwards");
+
+			static constexpr std::size_t SPARSE = [] {
+				std::size_t count = 0;
+				for (const auto& stride : STRIDES) {
+					count += static_cast<std::size_t>((stride.last - stride.first) / stride.step + 1);
+				}
+				return count;
+			}();
+
+			[[nodiscard]] static constexpr underlying_type sparse_value(std::size_t a_index) noexcept
+			{
+				for (const auto& stride : STRIDES) {
+					const auto count = static_cast<std::size_t>((stride.last - stride.first) / stride.step + 1);
+					if (a_index < count) {
+						return static_cast<underlying_type>(stride.first + static_cast<std::int64_t>(a_index) * stride.step);
+					}
+					a_index -= count;
+				}
+				return 0;
+			}
+
+			template <std::size_t... I>
+			[[nodiscard]] static consteval auto dense_names(std::index_sequence<I...>) noexcept
+			{
+				return std::array<std::string_view, sizeof...(I)>{ ENUM_VALUE_NAME<static_cast<E>(dense_value(I))>... };
+			}
+
+			template <std::size_t... I>
+			[[nodiscard]] static consteval auto bit_names(std::index_sequence<I...>) noexcept
+			{
+				// bits inside the dense range are already named there
+				return std::array<std::string_view, sizeof...(I)>{ (is_dense(bit(I)) ? std::string_view{} : ENUM_VALUE_NAME<static_cast<E>(bit(I))>)... };
+			}
+
+			template <std::size_t... I>
+			[[nodiscard]] static consteval auto sparse_names(std::index_sequence<I...>) noexcept
+			{
+				// values inside the dense range or with a single bit are already named there
+				return std::array<std::string_view, sizeof...(I)>{ (is_dense(sparse_value(I)) || std::has_single_bit(static_cast<unsigned_type>(sparse_value(I))) ? std::string_view{} : ENUM_VALUE_NAME<static_cast<E>(sparse_value(I))>)... };
+			}
+
+			static constexpr auto DENSE_NAMES = dense_names(std::make_index_sequence<DENSE>{});
+			static constexpr auto BIT_NAMES = bit_names(std::make_index_sequence<BITS>{});
+			static constexpr auto SPARSE_NAMES = sparse_names(std::make_index_sequence<SPARSE>{});
+
+			static constexpr std::size_t COUNT =
+				static_cast<std::size_t>(std::ranges::count_if(DENSE_NAMES, [](std::string_view a_name) { return !a_name.empty(); })) +
+				static_cast<std::size_t>(std::ranges::count_if(BIT_NAMES, [](std::string_view a_name) { return !a_name.empty(); })) +
+				static_cast<std::size_t>(std::ranges::count_if(SPARSE_NAMES, [](std::string_view a_name) { return !a_name.empty(); }));
+
+			[[nodiscard]] static constexpr underlying_type entry_value(const EnumEntry<E>& a_entry) noexcept
+			{
+				return static_cast<underlying_type>(a_entry.value);
+			}
+
+			[[nodiscard]] static consteval auto make_entries() noexcept
+			{
+				std::array<EnumEntry<E>, COUNT> result{};
+				std::size_t count = 0;
+				for (std::size_t i = 0; i < DENSE; ++i) {
+					if (!DENSE_NAMES[i].empty()) {
+						result[count++] = { static_cast<E>(dense_value(i)), DENSE_NAMES[i] };
+					}
+				}
+				for (std::size_t i = 0; i < BITS; ++i) {
+					if (!BIT_NAMES[i].empty()) {
+						result[count++] = { static_cast<E>(bit(i)), BIT_NAMES[i] };
+					}
+				}
+				for (std::size_t i = 0; i < SPARSE; ++i) {
+					if (!SPARSE_NAMES[i].empty()) {
+						result[count++] = { static_cast<E>(sparse_value(i)), SPARSE_NAMES[i] };
+					}
+				}
+
+				std::ranges::sort(result, {}, entry_value);
+				return result;
+			}
+
+			static constexpr auto ENTRIES = make_entries();
+
+			static_assert(std::ranges::adjacent_find(ENTRIES, {}, entry_value) == ENTRIES.end(), "EnumRange<E>::strides must not overlap");
+		};
+
+		/**
+		 * A minimal perfect hash over the enumerator names of <code>E</code>, built with hash and
+		 * displace like the key name hash of <code>InputMap</code>.
+		 */
+		template <class E>
+		struct EnumNameTable
+		{
+			using info_t = EnumInfo<E>;
+
+			static constexpr std::size_t SLOTS = std::bit_ceil(std::max<std::size_t>(info_t::COUNT * 2, 2));
+			static constexpr std::size_t BUCKETS = std::max<std::size_t>(SLOTS / 4, 1);
+			static constexpr std::uint16_t EMPTY = 0xFFFF;
+
+			static_assert(info_t::COUNT < EMPTY);
+
+			[[nodiscard]] constexpr const EnumEntry<E>* find(std::string_view a_name) const noexcept
+			{
+				const auto hash = EnumNameHash(a_name);
+				const auto index = slots[EnumNameSlot(hash, seeds[hash % BUCKETS]) % SLOTS];
+				return index != EMPTY && info_t::ENTRIES[index].name == a_name ? std::addressof(info_t::ENTRIES[index]) : nullptr;
+			}
+
+			std::array<std::uint32_t, BUCKETS> seeds{};
+			std::array<std::uint16_t, SLOTS> slots{};
+		};
+
+		template <class E>
+		[[nodiscard]] consteval EnumNameTable<E> MakeEnumNameTable()
+		{
+			using table_t = EnumNameTable<E>;
+			constexpr auto& entries = EnumInfo<E>::ENTRIES;
+
+			std::array<std::uint64_t, entries.size()> hashes{};
+			std::array<std::vector<std::uint16_t>, table_t::BUCKETS> buckets;
+			for (std::size_t i = 0; i < entries.size(); ++i) {
+				hashes[i] = EnumNameHash(entries[i].name);
+				buckets[hashes[i] % table_t::BUCKETS].push_back(static_cast<std::uint16_t>(i));
+			}
+
+			std::array<std::size_t, table_t::BUCKETS> order{};
+			for (std::size_t i = 0; i < order.size(); ++i) {
+				order[i] = i;
+			}
+			// the largest buckets are the hardest to place, so they go first
+			std::ranges::sort(order, std::ranges::greater{}, [&](std::size_t a_bucket) { return buckets[a_bucket].size(); });
+
+			table_t result;
+			result.slots.fill(table_t::EMPTY);
+			for (const auto bucket : order) {
+				if (buckets[bucket].empty()) {
+					break;
+				}
+
+				for (std::uint32_t seed = 1;; ++seed) {
+					if (seed == 0x10000) {
+						throw "failed to build enum name hash";
+					}
+
+					std::vector<std::size_t> taken;
+					for (const auto index : buckets[bucket]) {
+						const auto slot = EnumNameSlot(hashes[index], seed) % table_t::SLOTS;
+						if (result.slots[slot] != table_t::EMPTY || std::ranges::find(taken, slot) != taken.end()) {
+							break;
+						}
+						taken.push_back(slot);
+					}
+
+					if (taken.size() == buckets[bucket].size()) {
+						for (std::size_t i = 0; i < taken.size(); ++i) {
+							result.slots[taken[i]] = buckets[bucket][i];
+						}
+						result.seeds[bucket] = seed;
+						break;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		template <class E>
+		inline constexpr auto ENUM_NAME_TABLE = MakeEnumNameTable<E>();
+
+		[[nodiscard]] constexpr std::string_view TrimEnumName(std::string_view a_name) noexcept
+		{
+			while (!a_name.empty() && (a_name.front() == ' ' || a_name.front() == '\t')) {
+				a_name.remove_prefix(1);
+			}
+			while (!a_name.empty() && (a_name.back() == ' ' || a_name.back() == '\t')) {
+				a_name.remove_suffix(1);
+			}
+			return a_name;
+		}
+	}
+
+	/**
+	 * Every named value of <code>E</code>, ordered by value.
+	 */
+	template <class E>
+		requires(std::is_enum_v<E>)
+	[[nodiscard]] constexpr std::span<const EnumEntry<E>> EnumEntries() noexcept
+	{
+		return Impl::EnumInfo<E>::ENTRIES;
+	}
+
+	/**
+	 * The name of the enumerator with the value <code>a_value</code>, or an empty string if there is none.
+	 */
+	template <class E>
+		requires(std::is_enum_v<E>)
+	[[nodiscard]] constexpr std::string_view EnumName(E a_value) noexcept
+	{
+		using info_t = Impl::EnumInfo<E>;
+
+		const auto value = static_cast<typename info_t::underlying_type>(a_value);
+		if (info_t::is_dense(value)) {
+			return info_t::DENSE_NAMES[info_t::dense_index(value)];
+		}
+
+		const auto bits = static_cast<typename info_t::unsigned_type>(value);
+		if (std::has_single_bit(bits)) {
+			return info_t::BIT_NAMES[std::countr_zero(bits)];
+		}
+
+		if constexpr (info_t::SPARSE > 0) {
+			const auto it = std::ranges::lower_bound(info_t::ENTRIES, value, {}, info_t::entry_value);
+			if (it != info_t::ENTRIES.end() && info_t::entry_value(*it) == value) {
+				return it->name;
+			}
+		}
+
+		return std::string_view{};
+	}
+
+	/**
+	 * The enumerator of <code>E</code> named exactly <code>a_name</code>.
+	 */
+	template <class E>
+		requires(std::is_enum_v<E>)
+	[[nodiscard]] constexpr std::optional<E> EnumCast(std::string_view a_name) noexcept
+	{
+		if (const auto entry = Impl::ENUM_NAME_TABLE<E>.find(a_name)) {
+			return entry->value;
+		}
+		return std::nullopt;
+	}
+
+	/**
+	 * Spells out the flags of <code>a_value</code> like <code>kA|kB</code>.
+	 *
+	 * <p>
+	 * Bits without a name are appended as a single hex number, and a value of 0 is spelled by its
+	 * enumerator if it has one.
+	 * </p>
+	 */
+	template <class E>
+		requires(std::is_enum_v<E>)
+	[[nodiscard]] std::string EnumFlagsName(E a_value)
+	{
+		using info_t = Impl::EnumInfo<E>;
+		using unsigned_t = typename info_t::unsigned_type;
+
+		auto bits = static_cast<unsigned_t>(a_value);
+		if (bits == 0) {
+			const auto name = EnumName(a_value);
+			return name.empty() ? std::string("0") : std::string(name);
+		}
+
+		std::string result;
+		for (auto rest = bits; rest != 0; rest &= rest - 1) {
+			const auto bit = static_cast<unsigned_t>(rest & (~rest + 1));
+			const auto name = EnumName(static_cast<E>(bit));
+			if (!name.empty()) {
+				if (!result.empty()) {
+					result += '|';
+				}
+				result += name;
+				bits &= static_cast<unsigned_t>(~bit);
+			}
+		}
+
+		if (bits != 0) {
+			std::array<char, 2 + sizeof(unsigned_t) * 2> buf{ '0', 'x' };
+			const auto end = std::to_chars(buf.data() + 2, buf.data() + buf.size(), static_cast<std::uint64_t>(bits), 16).ptr;
+			if (!result.empty()) {
+				result += '|';
+			}
+			result.append(buf.data(), end);
+		}
+
+		return result;
+	}
+
+	/**
+	 * Parses flags spelled like <code>kA|kB</code>, where each part is an enumerator of
+	 * <code>E</code> or a number, optionally in hex.
+	 */
+	template <class E>
+		requires(std::is_enum_v<E>)
+	[[nodiscard]] std::optional<E> EnumFlagsCast(std::string_view a_name) noexcept
+	{
+		using unsigned_t = typename Impl::EnumInfo<E>::unsigned_type;
+
+		unsigned_t bits = 0;
+		for (std::size_t pos = 0; pos <= a_name.size();) {
+			const auto end = std::min(a_name.find('|', pos), a_name.size());
+			const auto part = Impl::TrimEnumName(a_name.substr(pos, end - pos));
+			pos = end + 1;
+
+			if (const auto value = EnumCast<E>(part)) {
+				bits |= static_cast<unsigned_t>(*value);
+				continue;
+			}
+
+			const auto hex = part.starts_with("0x") || part.starts_with("0X");
+			const auto digits = hex ? part.substr(2) : part;
+			std::uint64_t number = 0;
+			const auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), number, hex ? 16 : 10);
+			if (digits.empty() || ec != std::errc{} || ptr != digits.data() + digits.size() || number > std::numeric_limits<unsigned_t>::max()) {
+				return std::nullopt;
+			}
+			bits |= static_cast<unsigned_t>(number);
+		}
+
+		return static_cast<E>(bits);
+	}
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "REX/REX/EnumName.hpp"
+
 namespace REX
 {
 	template <
@@ -55,6 +57,17 @@ namespace REX
 		[[nodiscard]] constexpr E get() const noexcept { return static_cast<E>(_impl); }
 		[[nodiscard]] constexpr U underlying() const noexcept { return _impl; }
 
+		// the flags in this set, like kA|kB
+		[[nodiscard]] std::string name() const { return EnumFlagsName(get()); }
+
+		[[nodiscard]] static std::optional<EnumSet> parse(std::string_view a_name) noexcept
+		{
+			if (const auto value = EnumFlagsCast<E>(a_name)) {
+				return EnumSet(*value);
+			}
+			return std::nullopt;
+		}
+
 	public:
 		template <class... Args>
 			requires(std::same_as<Args, E> && ...)
@@ -181,3 +194,43 @@ namespace REX
 		std::underlying_type_t<
 			std::common_type_t<Args...>>>;
 }
+
+namespace std
+{
+	template <class E, class U>
+	struct formatter<REX::EnumSet<E, U>>
+		: public formatter<string>
+	{
+		constexpr auto parse(format_parse_context& a_ctx) const
+		{
+			return a_ctx.begin();
+		}
+
+		template <class FormatContext>
+		auto format(const REX::EnumSet<E, U>& a_value, FormatContext& a_ctx) const
+		{
+			return formatter<string>::format(a_value.name(), a_ctx);
+		}
+	};
+}
+
+#ifdef FMT_VERSION
+namespace fmt
+{
+	template <class E, class U>
+	struct formatter<REX::EnumSet<E, U>>
+		: public formatter<std::string>
+	{
+		constexpr auto parse(format_parse_context& a_ctx) const
+		{
+			return a_ctx.begin();
+		}
+
+		template <typename FormatContext>
+		auto format(const REX::EnumSet<E, U>& a_value, FormatContext& a_ctx) const
+		{
+			return formatter<std::string>::format(a_value.name(), a_ctx);
+		}
+	};
+}
+#endif
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "REX/REX/EnumSet.hpp"
+
+namespace REX
+{
+	enum class EnumSetTest
+	{
+		kAny,
+		kAll,
+		kNone
+	};
+
+	namespace Impl
+	{
+		template <class U>
+		[[nodiscard]] constexpr bool EnumSetTestOne(U a_value, EnumSetTest a_test, U a_mask) noexcept
+		{
+			const auto masked = static_cast<U>(a_value & a_mask);
+			switch (a_test) {
+				case EnumSetTest::kAny:
+					return masked != static_cast<U>(0);
+				case EnumSetTest::kAll:
+					return masked == a_mask;
+				default:
+					return masked == static_cast<U>(0);
+			}
+		}
+
+		template <class U>
+		[[nodiscard]] __m128i EnumSetSplat(U a_value) noexcept
+		{
+			if constexpr (sizeof(U) == 1) {
+				return _mm_set1_epi8(static_cast<char>(a_value));
+			}
+			else if constexpr (sizeof(U) == 2) {
+				return _mm_set1_epi16(static_cast<short>(a_value));
+			}
+			else {
+				return _mm_set1_epi32(static_cast<int>(a_value));
+			}
+		}
+
+		template <class U>
+		[[nodiscard]] __m128i EnumSetCompare(const U* a_data, __m128i a_mask, __m128i a_expected) noexcept
+		{
+			const auto block = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a_data)), a_mask);
+			if constexpr (sizeof(U) == 1) {
+				return _mm_cmpeq_epi8(block, a_expected);
+			}
+			else if constexpr (sizeof(U) == 2) {
+				return _mm_cmpeq_epi16(block, a_expected);
+			}
+			else {
+				return _mm_cmpeq_epi32(block, a_expected);
+			}
+		}
+
+		// one bit per set for the next 16 sets, where each bit is whether (set & mask) == expected
+		template <class U>
+		[[nodiscard]] std::uint32_t EnumSetCompare16(const U* a_data, __m128i a_mask, __m128i a_expected) noexcept
+		{
+			// the comparisons yield all ones or all zeroes per lane, which survive saturating packs
+			if constexpr (sizeof(U) == 1) {
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(EnumSetCompare(a_data, a_mask, a_expected)));
+			}
+			else if constexpr (sizeof(U) == 2) {
+				const auto lo = EnumSetCompare(a_data, a_mask, a_expected);
+				const auto hi = EnumSetCompare(a_data + 8, a_mask, a_expected);
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(lo, hi)));
+			}
+			else {
+				const auto lo = _mm_packs_epi32(EnumSetCompare(a_data, a_mask, a_expected), EnumSetCompare(a_data + 4, a_mask, a_expected));
+				const auto hi = _mm_packs_epi32(EnumSetCompare(a_data + 8, a_mask, a_expected), EnumSetCompare(a_data + 12, a_mask, a_expected));
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(lo, hi)));
+			}
+		}
+
+		/**
+		 * Tests up to 64 consecutive sets, returning the results as a bitmap.
+		 */
+		template <class U>
+		[[nodiscard]] std::uint64_t EnumSetTestWord(const U* a_data, std::size_t a_count, EnumSetTest a_test, U a_mask) noexcept
+		{
+			std::uint64_t result = 0;
+			std::size_t i = 0;
+
+			if constexpr (sizeof(U) <= 4) {
+				// any is the inverse of none, so only equality against 0 or the mask is needed
+				const auto mask = EnumSetSplat(a_mask);
+				const auto expected = a_test == EnumSetTest::kAll ? mask : _mm_setzero_si128();
+				const std::uint32_t invert = a_test == EnumSetTest::kAny ? 0xFFFF : 0;
+				for (; i + 16 <= a_count; i += 16) {
+					result |= static_cast<std::uint64_t>(EnumSetCompare16(a_data + i, mask, expected) ^ invert) << i;
+				}
+			}
+
+			for (; i < a_count; ++i) {
+				result |= static_cast<std::uint64_t>(EnumSetTestOne(a_data[i], a_test, a_mask)) << i;
+			}
+
+			return result;
+		}
+
+		template <class T>
+		struct is_enum_set :
+			std::false_type
+		{};
+
+		template <class E, class U>
+		struct is_enum_set<EnumSet<E, U>> :
+			std::true_type
+		{};
+
+		template <class R>
+		[[nodiscard]] auto EnumSetData(const R& a_sets) noexcept
+		{
+			using set_t = std::ranges::range_value_t<R>;
+			using underlying_t = typename set_t::underlying_type;
+			static_assert(sizeof(set_t) == sizeof(underlying_t) && std::is_standard_layout_v<set_t>);
+			return reinterpret_cast<const underlying_t*>(std::ranges::data(a_sets));
+		}
+
+		// gathers the sets of up to 64 objects before testing them, null objects never match
+		template <class It, class C, class E, class U>
+		[[nodiscard]] std::uint64_t EnumSetGatherWord(It a_first, std::size_t a_count, EnumSet<E, U> C::*a_member, EnumSetTest a_test, U a_mask) noexcept
+		{
+			std::array<U, 64> block;
+			std::uint64_t present = 0;
+			for (std::size_t i = 0; i < a_count; ++i, ++a_first) {
+				const auto& object = *a_first;
+				if constexpr (std::is_pointer_v<std::remove_cvref_t<decltype(object)>>) {
+					block[i] = object ? (object->*a_member).underlying() : static_cast<U>(0);
+					present |= static_cast<std::uint64_t>(object != nullptr) << i;
+				}
+				else {
+					block[i] = (object.*a_member).underlying();
+					present |= std::uint64_t{ 1 } << i;
+				}
+			}
+
+			return EnumSetTestWord(block.data(), a_count, a_test, a_mask) & present;
+		}
+	}
+
+	template <class R>
+	concept enum_set_range =
+		std::ranges::contiguous_range<R> &&
+		std::ranges::sized_range<R> &&
+		Impl::is_enum_set<std::ranges::range_value_t<R>>::value;
+
+	/**
+	 * Runs <code>a_test</code> against <code>a_mask</code> for every set in <code>a_sets</code>.
+	 *
+	 * <p>
+	 * Bit <code>i % 64</code> of <code>a_bitmap[i / 64]</code> receives the result for set
+	 * <code>i</code>, so <code>a_bitmap</code> must hold at least <code>(size + 63) / 64</code>
+	 * words. Unused bits of the last word are cleared. 8, 16 and 32 bit sets are tested 16 at a time.
+	 * </p>
+	 *
+	 * @return The number of matching sets.
+	 */
+	template <enum_set_range R>
+	std::size_t ScanEnumSets(const R& a_sets, EnumSetTest a_test, std::ranges::range_value_t<R> a_mask, std::span<std::uint64_t> a_bitmap) noexcept
+	{
+		const auto data = Impl::EnumSetData(a_sets);
+		const auto size = static_cast<std::size_t>(std::ranges::size(a_sets));
+		assert(a_bitmap.size() >= (size + 63) / 64);
+
+		std::size_t matches = 0;
+		for (std::size_t i = 0; i < size; i += 64) {
+			const auto word = Impl::EnumSetTestWord(data + i, std::min<std::size_t>(size - i, 64), a_test, a_mask.underlying());
+			a_bitmap[i / 64] = word;
+			matches += static_cast<std::size_t>(std::popcount(word));
+		}
+
+		return matches;
+	}
+
+	/**
+	 * Runs <code>a_test</code> against <code>a_mask</code> for every set in <code>a_sets</code>, and
+	 * appends the indices of the matching sets to <code>a_indices</code> in ascending order.
+	 *
+	 * @return The number of matching sets.
+	 */
+	template <enum_set_range R>
+	std::size_t FindEnumSets(const R& a_sets, EnumSetTest a_test, std::ranges::range_value_t<R> a_mask, std::vector<std::uint32_t>& a_indices)
+	{
+		const auto data = Impl::EnumSetData(a_sets);
+		const auto size = static_cast<std::size_t>(std::ranges::size(a_sets));
+		const auto first = a_indices.size();
+
+		for (std::size_t i = 0; i < size; i += 64) {
+			auto word = Impl::EnumSetTestWord(data + i, std::min<std::size_t>(size - i, 64), a_test, a_mask.underlying());
+			for (; word != 0; word &= word - 1) {
+				a_indices.push_back(static_cast<std::uint32_t>(i + std::countr_zero(word)));
+			}
+		}
+
+		return a_indices.size() - first;
+	}
+
+	/**
+	 * Like <code>ScanEnumSets</code>, but tests the set found through <code>a_member</code> of each
+	 * object, or of each object pointed to, in <code>a_objects</code>.
+	 *
+	 * <p>
+	 * Members are gathered 64 at a time into a contiguous block, which is then tested like a span
+	 * of sets. Null pointers never match.
+	 * </p>
+	 */
+	template <std::ranges::random_access_range R, class C, class E, class U>
+	std::size_t ScanEnumSets(const R& a_objects, EnumSet<E, U> C::*a_member, EnumSetTest a_test, std::type_identity_t<EnumSet<E, U>> a_mask, std::span<std::uint64_t> a_bitmap) noexcept
+	{
+		const auto size = static_cast<std::size_t>(std::ranges::size(a_objects));
+		assert(a_bitmap.size() >= (size + 63) / 64);
+
+		std::size_t matches = 0;
+		auto it = std::ranges::begin(a_objects);
+		for (std::size_t i = 0; i < size; i += 64, it += 64) {
+			const auto word = Impl::EnumSetGatherWord(it, std::min<std::size_t>(size - i, 64), a_member, a_test, a_mask.underlying());
+			a_bitmap[i / 64] = word;
+			matches += static_cast<std::size_t>(std::popcount(word));
+			if (size - i <= 64) {
+				break;
+			}
+		}
+
+		return matches;
+	}
+
+	/**
+	 * Like <code>FindEnumSets</code>, but tests the set found through <code>a_member</code> of each
+	 * object, or of each object pointed to, in <code>a_objects</code>. Null pointers never match.
+	 */
+	template <std::ranges::random_access_range R, class C, class E, class U>
+	std::size_t FindEnumSets(const R& a_objects, EnumSet<E, U> C::*a_member, EnumSetTest a_test, std::type_identity_t<EnumSet<E, U>> a_mask, std::vector<std::uint32_t>& a_indices)
+	{
+		const auto size = static_cast<std::size_t>(std::ranges::size(a_objects));
+		const auto first = a_indices.size();
+
+		auto it = std::ranges::begin(a_objects);
+		for (std::size_t i = 0; i < size; i += 64, it += 64) {
+			auto word = Impl::EnumSetGatherWord(it, std::min<std::size_t>(size - i, 64), a_member, a_test, a_mask.underlying());
+			for (; word != 0; word &= word - 1) {
+				a_indices.push_back(static_cast<std::uint32_t>(i + std::countr_zero(word)));
+			}
+			if (size - i <= 64) {
+				break;
+			}
+		}
+
+		return a_indices.size() - first;
+	}
+}
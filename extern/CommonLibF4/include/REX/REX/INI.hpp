@@ -18,6 +18,15 @@ namespace REX::INI
 		void SettingSave(void* a_file, sec_t a_section, key_t a_key, T&& a_value);
 	}
 
+	/**
+	 * Loads settings from a base and a user ini file.
+	 *
+	 * <p>
+	 * Both files are memory mapped and tokenized once into a shared index, which every setting is
+	 * then resolved against. Saving patches values into the base file in place, keeping its
+	 * comments and layout.
+	 * </p>
+	 */
 	class SettingStore
 		: public TSettingStore<SettingStore>
 	{
@@ -26,13 +35,13 @@ namespace REX::INI
 		virtual void Save() override;
 	};
 
-	template <class T, class Store = SettingStore>
+	template <class T, class Store = SettingStore, bool Concurrent = false>
 	class Setting
-		: public TSetting<T, Store>
+		: public TSetting<T, Store, Concurrent>
 	{
 	public:
 		Setting(sec_t a_section, key_t a_key, T a_default) noexcept :
-			TSetting<T, Store>(a_default),
+			TSetting<T, Store, Concurrent>(a_default),
 			m_section(a_section),
 			m_key(a_key)
 		{
@@ -45,18 +54,21 @@ namespace REX::INI
 	public:
 		virtual void Load(void* a_data, bool a_isBase) override
 		{
-			if (a_isBase) {
-				Impl::SettingLoad(a_data, m_section, m_key, this->m_valueDefault, this->m_valueDefault);
-				this->SetValue(this->m_valueDefault);
-			}
-			else {
-				Impl::SettingLoad(a_data, m_section, m_key, this->m_value, this->m_valueDefault);
-			}
+			this->LoadValue(a_isBase, [&](T& a_value, T& a_valueDefault) {
+				Impl::SettingLoad(a_data, m_section, m_key, a_value, a_valueDefault);
+			});
 		}
 
 		virtual void Save(void* a_data) override
 		{
-			Impl::SettingSave(a_data, m_section, m_key, this->m_value);
+			auto value = this->template GetValue<T>();
+			Impl::SettingSave(a_data, m_section, m_key, value);
+		}
+
+		[[nodiscard]] virtual std::uint64_t GetSchema() const noexcept override
+		{
+			const auto schema = this->GetValueSchema();
+			return schema ? REX::Impl::SchemaHash(m_key, REX::Impl::SchemaHash(m_section, schema)) : 0;
 		}
 
 	private:
@@ -93,12 +105,15 @@ namespace REX::INI
 
 	template <class Store = SettingStore>
 	using Str = Setting<std::string, Store>;
+
+	template <class T, class Store = SettingStore>
+	using Concurrent = Setting<T, Store, true>;
 }
 
 namespace std
 {
-	template <class T, class S>
-	struct formatter<REX::INI::Setting<T, S>>
+	template <class T, class S, bool C>
+	struct formatter<REX::INI::Setting<T, S, C>>
 		: public formatter<T>
 	{
 		constexpr auto parse(format_parse_context& a_ctx) const
@@ -107,7 +122,7 @@ namespace std
 		}
 
 		template <class FormatContext>
-		constexpr auto format(const REX::INI::Setting<T, S>& a_setting, FormatContext& a_ctx) const
+		constexpr auto format(const REX::INI::Setting<T, S, C>& a_setting, FormatContext& a_ctx) const
 		{
 			return formatter<T>::format(a_setting.GetValue(), a_ctx);
 		}
@@ -117,8 +132,8 @@ namespace std
 #ifdef FMT_VERSION
 namespace fmt
 {
-	template <class T, class S>
-	struct formatter<REX::INI::Setting<T, S>>
+	template <class T, class S, bool C>
+	struct formatter<REX::INI::Setting<T, S, C>>
 		: public formatter<T>
 	{
 		constexpr auto parse(format_parse_context& a_ctx) const
@@ -127,7 +142,7 @@ namespace fmt
 		}
 
 		template <class FormatContext>
-		constexpr auto format(const REX::INI::Setting<T, S>& a_setting, FormatContext& a_ctx) const
+		constexpr auto format(const REX::INI::Setting<T, S, C>& a_setting, FormatContext& a_ctx) const
 		{
 			return formatter<T>::format(a_setting.GetValue(), a_ctx);
 		}
@@ -10,29 +10,88 @@ namespace REX::JSON
 
 	namespace Impl
 	{
+		/**
+		 * A setting path, split into its segments once when the setting is registered.
+		 *
+		 * <p>
+		 * Paths starting with <code>/</code> are JSON pointers, anything else names a top level key.
+		 * </p>
+		 */
+		class Path
+		{
+		public:
+			explicit Path(path_t a_path);
+
+			[[nodiscard]] std::size_t size() const noexcept { return _segments.size(); }
+
+			/**
+			 * Returns segment <code>a_index</code> with its escapes resolved.
+			 */
+			[[nodiscard]] std::string_view segment(std::size_t a_index) const noexcept
+			{
+				const auto begin = a_index > 0 ? _segments[a_index - 1].end : 0;
+				return std::string_view{ _buffer }.substr(begin, _segments[a_index].end - begin);
+			}
+
+			/**
+			 * Returns the raw path up to and including segment <code>a_index</code>, which identifies
+			 * that node across every setting.
+			 */
+			[[nodiscard]] path_t prefix(std::size_t a_index) const noexcept
+			{
+				return _path.substr(0, _segments[a_index].rawEnd);
+			}
+
+		private:
+			struct segment_t
+			{
+				std::uint32_t end;
+				std::uint32_t rawEnd;
+			};
+
+			path_t _path;
+			std::string _buffer;
+			std::vector<segment_t> _segments;
+		};
+
+		struct Document;
+
 		template <class T>
-		void SettingLoad(void* a_file, path_t a_path, T& a_value, T& a_valueDefault);
+		void SettingLoad(void* a_file, const Path& a_path, T& a_value, T& a_valueDefault);
 
 		template <class T>
-		void SettingSave(void* a_file, path_t a_path, T&& a_value);
+		void SettingSave(void* a_file, const Path& a_path, T&& a_value);
 	}
 
+	/**
+	 * Loads settings from a base and a user json file.
+	 *
+	 * <p>
+	 * Every interior node of a document is resolved at most once per load, however many settings
+	 * share it. The parsed base file is kept, so saving only patches the values that changed, and
+	 * skips writing entirely when nothing did.
+	 * </p>
+	 */
 	class SettingStore
 		: public TSettingStore<SettingStore>
 	{
 	public:
 		virtual void Load() override;
 		virtual void Save() override;
+
+	private:
+		std::shared_ptr<Impl::Document> m_document;
 	};
 
-	template <class T, class Store = SettingStore>
+	template <class T, class Store = SettingStore, bool Concurrent = false>
 	class Setting
-		: public TSetting<T, Store>
+		: public TSetting<T, Store, Concurrent>
 	{
 	public:
 		Setting(path_t a_path, T a_default) noexcept :
-			TSetting<T, Store>(a_default),
-			m_path(a_path)
+			TSetting<T, Store, Concurrent>(a_default),
+			m_path(a_path),
+			m_resolved(a_path)
 		{
 		}
 
@@ -42,22 +101,26 @@ namespace REX::JSON
 	public:
 		virtual void Load(void* a_data, bool a_isBase) override
 		{
-			if (a_isBase) {
-				Impl::SettingLoad(a_data, m_path, this->m_valueDefault, this->m_valueDefault);
-				this->SetValue(this->m_valueDefault);
-			}
-			else {
-				Impl::SettingLoad(a_data, m_path, this->m_value, this->m_valueDefault);
-			}
+			this->LoadValue(a_isBase, [&](T& a_value, T& a_valueDefault) {
+				Impl::SettingLoad(a_data, m_resolved, a_value, a_valueDefault);
+			});
 		}
 
 		virtual void Save(void* a_data) override
 		{
-			Impl::SettingSave(a_data, m_path, this->m_value);
+			auto value = this->template GetValue<T>();
+			Impl::SettingSave(a_data, m_resolved, value);
+		}
+
+		[[nodiscard]] virtual std::uint64_t GetSchema() const noexcept override
+		{
+			const auto schema = this->GetValueSchema();
+			return schema ? REX::Impl::SchemaHash(m_path, schema) : 0;
 		}
 
 	private:
 		path_t m_path;
+		Impl::Path m_resolved;
 	};
 
 	template <class Store = SettingStore>
@@ -89,12 +152,15 @@ namespace REX::JSON
 
 	template <class Store = SettingStore>
 	using Str = Setting<std::string, Store>;
+
+	template <class T, class Store = SettingStore>
+	using Concurrent = Setting<T, Store, true>;
 }
 
 namespace std
 {
-	template <class T, class S>
-	struct formatter<REX::JSON::Setting<T, S>>
+	template <class T, class S, bool C>
+	struct formatter<REX::JSON::Setting<T, S, C>>
 		: public formatter<T>
 	{
 		constexpr auto parse(format_parse_context& a_ctx) const
@@ -103,7 +169,7 @@ namespace std
 		}
 
 		template <class FormatContext>
-		constexpr auto format(const REX::JSON::Setting<T, S>& a_setting, FormatContext& a_ctx) const
+		constexpr auto format(const REX::JSON::Setting<T, S, C>& a_setting, FormatContext& a_ctx) const
 		{
 			return formatter<T>::format(a_setting.GetValue(), a_ctx);
 		}
@@ -113,8 +179,8 @@ namespace std
 #ifdef FMT_VERSION
 namespace fmt
 {
-	template <class T, class S>
-	struct formatter<REX::JSON::Setting<T, S>>
+	template <class T, class S, bool C>
+	struct formatter<REX::JSON::Setting<T, S, C>>
 		: public formatter<T>
 	{
 		constexpr auto parse(format_parse_context& a_ctx) const
@@ -123,7 +189,7 @@ namespace fmt
 		}
 
 		template <class FormatContext>
-		constexpr auto format(const REX::JSON::Setting<T, S>& a_setting, FormatContext& a_ctx) const
+		constexpr auto format(const REX::JSON::Setting<T, S, C>& a_setting, FormatContext& a_ctx) const
 		{
 			return formatter<T>::format(a_setting.GetValue(), a_ctx);
 		}
@@ -7,11 +7,157 @@ namespace REX
 	template <typename T>
 	concept copyable = std::is_trivially_copyable_v<T> && std::is_trivially_copy_constructible_v<T>;
 
+	class ISetting;
+
+	namespace Impl
+	{
+		// FNV-1a, used to fingerprint the layout of a snapshot
+		[[nodiscard]] constexpr std::uint64_t SchemaHash(std::string_view a_str, std::uint64_t a_hash = 0xCBF29CE484222325) noexcept
+		{
+			for (const auto ch : a_str) {
+				a_hash = (a_hash ^ static_cast<std::uint8_t>(ch)) * 0x100000001B3;
+			}
+			return (a_hash ^ 0xFF) * 0x100000001B3;
+		}
+
+		template <class T>
+		concept snapshottable = copyable<T> || std::is_same_v<T, std::string>;
+
+		template <class T>
+		concept lock_free_value = copyable<T> && std::atomic<T>::is_always_lock_free;
+
+		template <snapshottable T>
+		void SnapshotWrite(std::vector<std::byte>& a_out, const T& a_value)
+		{
+			if constexpr (std::is_same_v<T, std::string>) {
+				SnapshotWrite(a_out, static_cast<std::uint32_t>(a_value.size()));
+				const auto bytes = std::as_bytes(std::span{ a_value });
+				a_out.insert(a_out.end(), bytes.begin(), bytes.end());
+			}
+			else {
+				const auto bytes = std::as_bytes(std::span{ std::addressof(a_value), 1 });
+				a_out.insert(a_out.end(), bytes.begin(), bytes.end());
+			}
+		}
+
+		template <snapshottable T>
+		[[nodiscard]] bool SnapshotRead(std::span<const std::byte>& a_in, T& a_value)
+		{
+			if constexpr (std::is_same_v<T, std::string>) {
+				std::uint32_t size{};
+				if (!SnapshotRead(a_in, size) || a_in.size() < size) {
+					return false;
+				}
+				a_value.assign(reinterpret_cast<const char*>(a_in.data()), size);
+				a_in = a_in.subspan(size);
+			}
+			else {
+				if (a_in.size() < sizeof(T)) {
+					return false;
+				}
+				std::memcpy(std::addressof(a_value), a_in.data(), sizeof(T));
+				a_in = a_in.subspan(sizeof(T));
+			}
+			return true;
+		}
+
+		// the type and default of a setting, which a snapshot is only valid for while they are unchanged
+		template <class T>
+		[[nodiscard]] std::uint64_t ValueSchema(const T& a_default)
+		{
+			if constexpr (snapshottable<T>) {
+				std::vector<std::byte> bytes;
+				SnapshotWrite(bytes, a_default);
+				return SchemaHash({ reinterpret_cast<const char*>(bytes.data()), bytes.size() }, SchemaHash(typeid(T).name()));
+			}
+			else {
+				return 0;
+			}
+		}
+
+		/**
+		 * Holds the value of a setting which is only ever accessed from one thread at a time.
+		 */
+		template <class T, bool Concurrent>
+		class SettingValue
+		{
+		public:
+			explicit SettingValue(const T& a_value) :
+				_value(a_value)
+			{
+			}
+
+			[[nodiscard]] const T& get() const noexcept { return _value; }
+			[[nodiscard]] T& ref() noexcept { return _value; }
+			void set(T a_value) { _value = std::move(a_value); }
+
+		private:
+			T _value;
+		};
+
+		/**
+		 * Holds the value of a concurrent setting small enough to live in a lock free atomic.
+		 */
+		template <lock_free_value T>
+		class SettingValue<T, true>
+		{
+		public:
+			explicit SettingValue(const T& a_value) noexcept :
+				_value(a_value)
+			{
+			}
+
+			[[nodiscard]] T get() const noexcept { return _value.load(std::memory_order_acquire); }
+			void set(T a_value) noexcept { _value.store(a_value, std::memory_order_release); }
+
+		private:
+			std::atomic<T> _value;
+		};
+
+		/**
+		 * Holds the value of any other concurrent setting behind an immutable copy, which writers
+		 * replace with a pointer swap. Readers keep whichever copy they loaded alive until they are done.
+		 */
+		template <class T>
+		class SettingValue<T, true>
+		{
+		public:
+			explicit SettingValue(const T& a_value) :
+				_value(std::make_shared<const T>(a_value))
+			{
+			}
+
+			[[nodiscard]] T get() const { return *acquire(); }
+			[[nodiscard]] std::shared_ptr<const T> acquire() const noexcept { return _value.load(std::memory_order_acquire); }
+			void set(T a_value) { _value.store(std::make_shared<const T>(std::move(a_value)), std::memory_order_release); }
+
+		private:
+			std::atomic<std::shared_ptr<const T>> _value;
+		};
+
+		bool LoadSnapshot(std::string_view a_path, std::span<const std::string_view> a_sources, std::span<ISetting* const> a_settings);
+		void SaveSnapshot(std::string_view a_path, std::span<const std::string_view> a_sources, std::span<ISetting* const> a_settings);
+	}
+
 	class ISetting
 	{
 	public:
 		virtual void Load(void* a_data, bool a_isBase) = 0;
 		virtual void Save(void* a_data) = 0;
+
+		/**
+		 * Publishes whatever the <code>Load</code> calls of one store load resolved, all at once.
+		 */
+		virtual void Commit() {}
+
+		/**
+		 * Fingerprints the type, default and location of this setting, or returns 0 if it cannot be
+		 * stored in a snapshot.
+		 */
+		[[nodiscard]] virtual std::uint64_t GetSchema() const noexcept { return 0; }
+
+		virtual void Snapshot([[maybe_unused]] std::vector<std::byte>& a_out) const {}
+		[[nodiscard]] virtual bool Restore([[maybe_unused]] std::span<const std::byte>& a_in) { return false; }
 	};
 
 	class ISettingStore
@@ -23,7 +169,22 @@ namespace REX
 		virtual void Register(ISetting* a_setting) = 0;
 	};
 
-	template <class Value, class Store>
+	/**
+	 * A setting of type <code>Value</code>, registered with <code>Store</code>.
+	 *
+	 * <p>
+	 * By default a setting must not be written while it is read on another thread. Concurrent
+	 * settings lift that restriction: small values are kept in atomics, anything larger is
+	 * republished as a fresh copy on every write, and <code>GetValue</code> returns by value.
+	 * Writes from several threads must still be serialized.
+	 * </p>
+	 *
+	 * <p>
+	 * Every write bumps the generation, so hot code can cache data derived from a setting and
+	 * revalidate it with a single load of <code>GetGeneration</code>.
+	 * </p>
+	 */
+	template <class Value, class Store, bool Concurrent = false>
 	class TSetting
 		: public ISetting
 	{
@@ -33,34 +194,128 @@ namespace REX
 		using const_reference = const Value&;
 
 		using store_type = Store;
-		using setting_type = TSetting<Value, Store>;
+		using setting_type = TSetting<Value, Store, Concurrent>;
+
+		static constexpr bool concurrent = Concurrent;
+
+		// concurrent values which do not fit an atomic are republished as a fresh allocation
+		static constexpr bool nothrow_access = !Concurrent || Impl::lock_free_value<Value>;
 
 	public:
 		TSetting() noexcept = delete;
 
 		TSetting(Value a_default) noexcept :
 			m_value(a_default),
-			m_valueDefault(a_default)
+			m_valueDefault(a_default),
+			m_valueSchema(Impl::ValueSchema(a_default))
 		{
 			Store::GetSingleton()->Register(this);
 		}
 
 	public:
-		template <typename T = std::conditional_t<copyable<Value>, value_type, const_reference>>
-		[[nodiscard]] T GetValue() const noexcept { return m_value; }
+		template <typename T = std::conditional_t<Concurrent || copyable<Value>, value_type, const_reference>>
+		[[nodiscard]] T GetValue() const noexcept(nothrow_access) { return m_value.get(); }
 
-		template <typename T = std::conditional_t<copyable<Value>, value_type, const_reference>>
-		[[nodiscard]] T GetValueDefault() const noexcept { return m_valueDefault; }
+		template <typename T = std::conditional_t<Concurrent || copyable<Value>, value_type, const_reference>>
+		[[nodiscard]] T GetValueDefault() const noexcept(nothrow_access) { return m_valueDefault.get(); }
 
-		void SetValue(Value a_value) noexcept { m_value = a_value; }
+		void SetValue(Value a_value) noexcept(nothrow_access)
+		{
+			m_value.set(std::move(a_value));
+			m_generation.fetch_add(1, std::memory_order_release);
+		}
+
+		[[nodiscard]] std::uint32_t GetGeneration() const noexcept { return m_generation.load(std::memory_order_acquire); }
 
 	public:
-		operator Value&() noexcept { return m_value; }
-		operator const Value&() const noexcept { return m_value; }
+		operator Value&() noexcept
+			requires(!Concurrent)
+		{
+			return m_value.ref();
+		}
+
+		operator const Value&() const noexcept
+			requires(!Concurrent)
+		{
+			return m_value.get();
+		}
+
+		operator Value() const noexcept(nothrow_access)
+			requires(Concurrent)
+		{
+			return m_value.get();
+		}
+
+	public:
+		virtual void Snapshot([[maybe_unused]] std::vector<std::byte>& a_out) const override
+		{
+			if constexpr (Impl::snapshottable<Value>) {
+				Impl::SnapshotWrite(a_out, static_cast<const Value&>(GetValue<Value>()));
+				Impl::SnapshotWrite(a_out, static_cast<const Value&>(GetValueDefault<Value>()));
+			}
+		}
+
+		[[nodiscard]] virtual bool Restore([[maybe_unused]] std::span<const std::byte>& a_in) override
+		{
+			if constexpr (Impl::snapshottable<Value>) {
+				auto value = GetValue<Value>();
+				auto valueDefault = GetValueDefault<Value>();
+				if (!Impl::SnapshotRead(a_in, value) || !Impl::SnapshotRead(a_in, valueDefault)) {
+					return false;
+				}
+
+				m_valueDefault.set(std::move(valueDefault));
+				SetValue(std::move(value));
+				return true;
+			}
+			else {
+				return false;
+			}
+		}
 
 	protected:
-		Value m_value;
-		Value m_valueDefault;
+		[[nodiscard]] std::uint64_t GetValueSchema() const noexcept { return m_valueSchema; }
+
+		/**
+		 * Runs <code>a_load(value, valueDefault)</code> against staged copies of this setting, which
+		 * <code>Commit</code> publishes once every layer is loaded.
+		 *
+		 * <p>
+		 * Loading the base layer reads into the default, which the value is then reset to.
+		 * </p>
+		 */
+		template <class F>
+		void LoadValue(bool a_isBase, F&& a_load)
+		{
+			if (!m_staged) {
+				m_staged.emplace(GetValue<Value>(), GetValueDefault<Value>());
+			}
+
+			auto& [value, valueDefault] = *m_staged;
+			if (a_isBase) {
+				a_load(valueDefault, valueDefault);
+				value = valueDefault;
+			}
+			else {
+				a_load(value, valueDefault);
+			}
+		}
+
+		virtual void Commit() override
+		{
+			if (m_staged) {
+				auto [value, valueDefault] = std::move(*m_staged);
+				m_staged.reset();
+				m_valueDefault.set(std::move(valueDefault));
+				SetValue(std::move(value));
+			}
+		}
+
+		Impl::SettingValue<Value, Concurrent> m_value;
+		Impl::SettingValue<Value, Concurrent> m_valueDefault;
+		std::uint64_t m_valueSchema;
+		std::atomic<std::uint32_t> m_generation{ 0 };
+		std::optional<std::pair<Value, Value>> m_staged; // value, default
 	};
 
 	template <class T>
@@ -88,9 +343,35 @@ namespace REX
 			m_settings.emplace_back(a_setting);
 		}
 
+		/**
+		 * Opts into caching loaded values in a binary snapshot at <code>a_path</code>.
+		 *
+		 * <p>
+		 * Later loads restore every setting straight from the snapshot, for as long as the config
+		 * files, the registered settings and their defaults are all unchanged. Otherwise the files
+		 * are parsed as usual, and the snapshot is rewritten.
+		 * </p>
+		 */
+		void SetSnapshot(std::string_view a_path) noexcept { m_fileSnapshot = a_path; }
+
 	protected:
+		[[nodiscard]] bool LoadSnapshot()
+		{
+			const std::array sources{ m_fileBase, m_fileUser };
+			return !m_fileSnapshot.empty() && Impl::LoadSnapshot(m_fileSnapshot, sources, m_settings);
+		}
+
+		void SaveSnapshot()
+		{
+			const std::array sources{ m_fileBase, m_fileUser };
+			if (!m_fileSnapshot.empty()) {
+				Impl::SaveSnapshot(m_fileSnapshot, sources, m_settings);
+			}
+		}
+
 		std::string_view m_fileBase;
 		std::string_view m_fileUser;
+		std::string_view m_fileSnapshot;
 		std::vector<ISetting*> m_settings;
 	};
 }
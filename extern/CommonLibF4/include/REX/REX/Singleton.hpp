@@ -22,4 +22,101 @@ namespace REX
 		Singleton& operator=(const Singleton&) = delete;
 		Singleton& operator=(Singleton&&) = delete;
 	};
+
+	namespace Impl
+	{
+		struct EagerSingletonNode
+		{
+			void (*destroy)() noexcept;
+			EagerSingletonNode* next;
+		};
+
+		// the eager singletons which are alive, most recently created first
+		inline constinit EagerSingletonNode* eagerSingletons{ nullptr };
+
+		// instantiated on first use, once T is complete
+		template <class T>
+		struct alignas(T) EagerSingletonStorage
+		{
+			std::byte data[sizeof(T)];
+		};
+
+		template <class T>
+		inline constinit EagerSingletonStorage<T> eagerSingletonStorage{};
+	}
+
+	/**
+	 * A singleton with an explicit lifetime, for instances which are read on hot paths.
+	 *
+	 * <p>
+	 * The instance lives in <code>constinit</code> storage and is only constructed by
+	 * <code>Create</code>, typically from an F4SE load message, so <code>GetSingleton</code> is a
+	 * plain load without a thread-safe static guard. It returns <code>nullptr</code> until then, and
+	 * after <code>Destroy</code>.
+	 * </p>
+	 *
+	 * <p>
+	 * <code>Create</code> and <code>Destroy</code> must not race with each other or with readers.
+	 * <code>DestroySingletons</code> tears down every live instance in reverse order of creation;
+	 * instances which are never destroyed are left to the process, and are not touched by static
+	 * destruction.
+	 * </p>
+	 */
+	template <class T>
+	class EagerSingleton
+	{
+	public:
+		[[nodiscard]] static T* GetSingleton() noexcept { return _singleton; }
+
+		template <class... Args>
+		static T* Create(Args&&... a_args)
+		{
+			if (!_singleton) {
+				_singleton = ::new (static_cast<void*>(Impl::eagerSingletonStorage<T>.data)) T(std::forward<Args>(a_args)...);
+				_node.next = std::exchange(Impl::eagerSingletons, std::addressof(_node));
+			}
+
+			return _singleton;
+		}
+
+		static void Destroy() noexcept
+		{
+			if (!_singleton) {
+				return;
+			}
+
+			for (auto it = std::addressof(Impl::eagerSingletons); *it; it = std::addressof((*it)->next)) {
+				if (*it == std::addressof(_node)) {
+					*it = _node.next;
+					break;
+				}
+			}
+
+			std::destroy_at(std::exchange(_singleton, nullptr));
+		}
+
+	protected:
+		EagerSingleton() noexcept = default;
+		virtual ~EagerSingleton() noexcept = default;
+
+		EagerSingleton(const EagerSingleton&) = delete;
+		EagerSingleton(EagerSingleton&&) = delete;
+
+		EagerSingleton& operator=(const EagerSingleton&) = delete;
+		EagerSingleton& operator=(EagerSingleton&&) = delete;
+
+	private:
+		static inline constinit T* _singleton{ nullptr };
+		static inline constinit Impl::EagerSingletonNode _node{ &EagerSingleton::Destroy, nullptr };
+	};
+
+	/**
+	 * Destroys every live <code>EagerSingleton</code>, most recently created first.
+	 */
+	inline void DestroySingletons() noexcept
+	{
+		while (Impl::eagerSingletons) {
+			Impl::eagerSingletons->destroy();
+		}
+	}
 }
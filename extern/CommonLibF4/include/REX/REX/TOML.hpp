@@ -12,12 +12,20 @@ namespace REX::TOML
 	namespace Impl
 	{
 		template <class T>
-		void SettingLoad(void* a_file, sec_t a_section, key_t a_key, T& a_value, T& a_valueDefault);
+		void SettingLoad(void* a_file, const sec_t& a_section, key_t a_key, T& a_value, T& a_valueDefault);
 
 		template <class T>
-		void SettingSave(void* a_file, sec_t a_section, key_t a_key, T&& a_value);
+		void SettingSave(void* a_file, const sec_t& a_section, key_t a_key, T&& a_value);
 	}
 
+	/**
+	 * Loads settings from a base and a user toml file.
+	 *
+	 * <p>
+	 * Each table is resolved once per load or save and cached by its section path, so settings
+	 * sharing a section cost a single hashed key lookup each.
+	 * </p>
+	 */
 	class SettingStore
 		: public TSettingStore<SettingStore>
 	{
@@ -26,20 +34,20 @@ namespace REX::TOML
 		virtual void Save() override;
 	};
 
-	template <class T, class Store = SettingStore>
+	template <class T, class Store = SettingStore, bool Concurrent = false>
 	class Setting
-		: public TSetting<T, Store>
+		: public TSetting<T, Store, Concurrent>
 	{
 	public:
 		Setting(key_t a_key, T a_default) :
-			TSetting<T, Store>(a_default),
+			TSetting<T, Store, Concurrent>(a_default),
 			m_section(),
 			m_key(a_key)
 		{
 		}
 
 		Setting(std::string_view a_section, key_t a_key, T a_default) noexcept :
-			TSetting<T, Store>(a_default),
+			TSetting<T, Store, Concurrent>(a_default),
 			m_section(),
 			m_key(a_key)
 		{
@@ -49,7 +57,7 @@ namespace REX::TOML
 		}
 
 		Setting(std::initializer_list<std::string> a_section, key_t a_key, T a_default) noexcept :
-			TSetting<T, Store>(a_default),
+			TSetting<T, Store, Concurrent>(a_default),
 			m_section(a_section),
 			m_key(a_key)
 		{
@@ -62,18 +70,28 @@ namespace REX::TOML
 	public:
 		virtual void Load(void* a_data, bool a_isBase) override
 		{
-			if (a_isBase) {
-				Impl::SettingLoad(a_data, m_section, m_key, this->m_valueDefault, this->m_valueDefault);
-				this->SetValue(this->m_valueDefault);
-			}
-			else {
-				Impl::SettingLoad(a_data, m_section, m_key, this->m_value, this->m_valueDefault);
-			}
+			this->LoadValue(a_isBase, [&](T& a_value, T& a_valueDefault) {
+				Impl::SettingLoad(a_data, m_section, m_key, a_value, a_valueDefault);
+			});
 		}
 
 		virtual void Save(void* a_data) override
 		{
-			Impl::SettingSave(a_data, m_section, m_key, this->m_value);
+			auto value = this->template GetValue<T>();
+			Impl::SettingSave(a_data, m_section, m_key, value);
+		}
+
+		[[nodiscard]] virtual std::uint64_t GetSchema() const noexcept override
+		{
+			auto schema = this->GetValueSchema();
+			if (!schema) {
+				return 0;
+			}
+
+			for (const auto& section : m_section) {
+				schema = REX::Impl::SchemaHash(section, schema);
+			}
+			return REX::Impl::SchemaHash(m_key, REX::Impl::SchemaHash({}, schema));
 		}
 
 	private:
@@ -110,12 +128,15 @@ namespace REX::TOML
 
 	template <class Store = SettingStore>
 	using Str = Setting<std::string, Store>;
+
+	template <class T, class Store = SettingStore>
+	using Concurrent = Setting<T, Store, true>;
 }
 
 namespace std
 {
-	template <class T, class S>
-	struct formatter<REX::TOML::Setting<T, S>>
+	template <class T, class S, bool C>
+	struct formatter<REX::TOML::Setting<T, S, C>>
 		: public formatter<T>
 	{
 		constexpr auto parse(format_parse_context& a_ctx) const
@@ -124,7 +145,7 @@ namespace std
 		}
 
 		template <class FormatContext>
-		constexpr auto format(const REX::TOML::Setting<T, S>& a_setting, FormatContext& a_ctx) const
+		constexpr auto format(const REX::TOML::Setting<T, S, C>& a_setting, FormatContext& a_ctx) const
 		{
 			return formatter<T>::format(a_setting.GetValue(), a_ctx);
 		}
@@ -134,8 +155,8 @@ namespace std
 #ifdef FMT_VERSION
 namespace fmt
 {
-	template <class T, class S>
-	struct formatter<REX::TOML::Setting<T, S>>
+	template <class T, class S, bool C>
+	struct formatter<REX::TOML::Setting<T, S, C>>
 		: public formatter<T>
 	{
 		constexpr auto parse(format_parse_context& a_ctx) const
@@ -144,7 +165,7 @@ namespace fmt
 		}
 
 		template <class FormatContext>
-		constexpr auto format(const REX::TOML::Setting<T, S>& a_setting, FormatContext& a_ctx) const
+		constexpr auto format(const REX::TOML::Setting<T, S, C>& a_setting, FormatContext& a_ctx) const
 		{
 			return formatter<T>::format(a_setting.GetValue(), a_ctx);
 		}
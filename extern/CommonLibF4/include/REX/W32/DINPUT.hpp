@@ -1,7 +1,9 @@
 #pragma once
 
+#ifndef F4SE_TEST_SUITE
 #include "REX/W32/COM.hpp"
 #include "REX/W32/D3D.hpp"
+#endif
 
 namespace REX::W32
 {
@@ -176,6 +178,9 @@ namespace REX::W32
 	};
 }
 
+// the key codes above are all the host tests need
+#ifndef F4SE_TEST_SUITE
+
 namespace REX::W32
 {
 	struct DIENVELOPE;
@@ -500,3 +505,4 @@ namespace REX::W32
 	inline constexpr IID IID_IDirectInputDevice8A{ 0x54D41080, 0xDC15, 0x4833, { 0xA4, 0x1B, 0x74, 0x8F, 0x73, 0xA3, 0x81, 0x79 } };
 	inline constexpr IID IID_IDirectInputEffect{ 0xE7E1F7C0, 0x88D2, 0x11D0, { 0x9A, 0xD0, 0x00, 0xA0, 0xC9, 0xA0, 0x6E, 0x35 } };
 }
+#endif
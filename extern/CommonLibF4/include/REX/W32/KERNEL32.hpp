@@ -120,6 +120,10 @@ namespace REX::W32
 	inline constexpr auto IMAGE_ORDINAL_FLAG32{ 0x80000000u };
 	inline constexpr auto IMAGE_ORDINAL_FLAG64{ 0x8000000000000000ull };
 
+	// pe image resource directory
+	inline constexpr auto IMAGE_RESOURCE_NAME_IS_STRING{ 0x80000000u };
+	inline constexpr auto IMAGE_RESOURCE_DATA_IS_DIRECTORY{ 0x80000000u };
+
 	// pe image section header characteristics
 	inline constexpr auto IMAGE_SCN_MEM_SHARED{ 0x10000000u };
 	inline constexpr auto IMAGE_SCN_MEM_EXECUTE{ 0x20000000u };
@@ -284,6 +288,33 @@ namespace REX::W32
 	};
 	static_assert(sizeof(IMAGE_NT_HEADERS64) == 0x108);
 
+	struct IMAGE_RESOURCE_DATA_ENTRY
+	{
+		std::uint32_t offsetToData;
+		std::uint32_t size;
+		std::uint32_t codePage;
+		std::uint32_t reserved;
+	};
+	static_assert(sizeof(IMAGE_RESOURCE_DATA_ENTRY) == 0x10);
+
+	struct IMAGE_RESOURCE_DIRECTORY
+	{
+		std::uint32_t characteristics;
+		std::uint32_t timeDateStamp;
+		std::uint16_t versionMajor;
+		std::uint16_t versionMinor;
+		std::uint16_t namedEntryCount;
+		std::uint16_t idEntryCount;
+	};
+	static_assert(sizeof(IMAGE_RESOURCE_DIRECTORY) == 0x10);
+
+	struct IMAGE_RESOURCE_DIRECTORY_ENTRY
+	{
+		std::uint32_t name;
+		std::uint32_t offsetToData;
+	};
+	static_assert(sizeof(IMAGE_RESOURCE_DIRECTORY_ENTRY) == 0x8);
+
 	struct IMAGE_SECTION_HEADER
 	{
 		std::uint8_t name[IMAGE_SIZEOF_SHORT_NAME];
@@ -444,7 +475,10 @@ namespace REX::W32
 		wchar_t fileName[MAX_PATH];
 		wchar_t fileNameAlt[14];
 	};
+#ifndef F4SE_TEST_SUITE
+	// wchar_t is 4 bytes on the hosts the tests run on
 	static_assert(sizeof(WIN32_FIND_DATAW) == 0x250);
+#endif
 }
 
 namespace REX::W32
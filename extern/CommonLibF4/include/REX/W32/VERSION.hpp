@@ -1,5 +1,35 @@
 #pragma once
 
+namespace REX::W32
+{
+	// resource types
+	inline constexpr auto RT_VERSION{ 16u };
+
+	// version info
+	inline constexpr auto VS_FFI_SIGNATURE{ 0xFEEF04BDu };
+}
+
+namespace REX::W32
+{
+	struct VS_FIXEDFILEINFO
+	{
+		std::uint32_t signature;
+		std::uint32_t strucVersion;
+		std::uint32_t fileVersionMS;
+		std::uint32_t fileVersionLS;
+		std::uint32_t productVersionMS;
+		std::uint32_t productVersionLS;
+		std::uint32_t fileFlagsMask;
+		std::uint32_t fileFlags;
+		std::uint32_t fileOS;
+		std::uint32_t fileType;
+		std::uint32_t fileSubtype;
+		std::uint32_t fileDateMS;
+		std::uint32_t fileDateLS;
+	};
+	static_assert(sizeof(VS_FIXEDFILEINFO) == 0x34);
+}
+
 namespace REX::W32
 {
 	bool GetFileVersionInfoA(const char* a_name, std::uint32_t a_handle, std::uint32_t a_dataLen, void* a_data) noexcept;
@@ -0,0 +1,108 @@
+import os
+import re
+
+# enums in RE/Bethesda, with their enumerators, at namespace scope or public in a class
+ENUM = re.compile(r"^(\t*)enum\s+(?:class\s+|struct\s+)?(\w+)\s*(?::\s*[\w:]+\s*)?\{([^{}]*)\};", re.M)
+SCOPE = re.compile(r"^(\t*)(namespace|class|struct|union)\s+(?:(?:alignas|__declspec)\(\w+\)\s+)*(\w+)[^;\n]*$", re.M)
+ACCESS = re.compile(r"^(\t*)(public|protected|private):", re.M)
+TEMPLATE = re.compile(r"^\t*template\s*<[^\n]*\n$")
+
+def find_enums(a_path):
+	with open(a_path, encoding="utf-8") as file:
+		text = file.read()
+
+	enums = []
+	skipped = []
+	for match in ENUM.finditer(text):
+		depth = len(match.group(1))
+		body = re.sub(r"//[^\n]*", "", match.group(3))
+		if "#" in body:
+			skipped.append((match.group(2), "enumerators under the preprocessor"))
+			continue
+
+		# the innermost scope at each depth above the enum
+		scopes = {}
+		for scope in SCOPE.finditer(text, 0, match.start()):
+			scope_depth = len(scope.group(1))
+			scopes = { d: s for d, s in scopes.items() if d < scope_depth }
+			scopes[scope_depth] = scope
+
+		path = [scopes.get(d) for d in range(depth)]
+		if None in path:
+			skipped.append((match.group(2), "in an unnamed scope"))
+			continue
+
+		qualified = "::".join([scope.group(3) for scope in path] + [match.group(2)])
+		reason = None
+		for scope in path:
+			kind = scope.group(2)
+			if kind == "namespace":
+				continue
+
+			# a class template's enums can't be named without its arguments
+			line_start = text.rfind("\n", 0, scope.start() - 1) + 1
+			if TEMPLATE.match(text, line_start, scope.start()):
+				reason = "in a class template"
+				break
+
+			# the last access label of this class before the enum, or the class's default
+			access = "private" if kind == "class" else "public"
+			for label in ACCESS.finditer(text, scope.end(), match.start()):
+				if len(label.group(1)) == len(scope.group(1)):
+					access = label.group(2)
+			if access != "public":
+				reason = "{} in {}".format(access, scope.group(3))
+				break
+
+		if reason:
+			skipped.append((qualified, reason))
+			continue
+
+		names = [part.split("=")[0].strip() for part in body.split(",")]
+		names = [name for name in names if name]
+		if names:
+			enums.append((qualified, names))
+		else:
+			skipped.append((qualified, "no enumerators"))
+
+	return enums, skipped
+
+def main():
+	root = os.path.split(os.path.dirname(os.path.realpath(__file__)))[0]
+	os.chdir(os.path.join(root, "include"))
+
+	enums = []
+	skipped = []
+	for dirpath, dirnames, filenames in os.walk("RE/Bethesda"):
+		for filename in sorted(filenames):
+			if filename.endswith(".hpp"):
+				found, passed_over = find_enums(os.path.join(dirpath, filename))
+				enums += found
+				skipped += passed_over
+	enums.sort()
+	skipped.sort()
+
+	with open(os.path.join(root, "tests", "REEnumTest.cpp"), "w", encoding="utf-8") as out:
+		out.write("// generated by scripts/make_enum_tests.py, do not edit\n")
+		out.write("\n")
+		out.write('#include "RE/Fallout.hpp"\n')
+		out.write("\n")
+		out.write('#include "EnumNameCommon.hpp"\n')
+		if skipped:
+			out.write("\n")
+			out.write("// not checked:\n")
+			for name, reason in skipped:
+				out.write("// - {}: {}\n".format(name, reason))
+		for name, enumerators in enums:
+			out.write("\n")
+			out.write("static_assert(test::RoundTrips<{}>(\n".format(name))
+			out.write("\t{{ {} }},\n".format(", ".join("{}::{}".format(name, e) for e in enumerators)))
+			out.write("\t{{ {} }}));\n".format(", ".join('"{}"'.format(e) for e in enumerators)))
+		out.write("\n")
+		out.write("int main()\n")
+		out.write("{\n")
+		out.write("\treturn EXIT_SUCCESS;\n")
+		out.write("}\n")
+
+if __name__ == "__main__":
+	main()
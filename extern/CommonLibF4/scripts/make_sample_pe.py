@@ -0,0 +1,160 @@
+import os
+import struct
+
+# a minimal PE32+ image with imports and a version resource, which the PE tests parse on any host
+
+FILE_ALIGNMENT = 0x200
+SECTION_ALIGNMENT = 0x1000
+IDATA_RVA = 0x1000
+RSRC_RVA = 0x2000
+
+IMPORTS = [
+	("KERNEL32.dll", True, ["GetModuleHandleW", "GetProcAddress", "LoadLibraryA", "VirtualProtect"]),
+	("USER32.dll", True, ["MessageBoxW", 100, "GetWindowLongPtrW"]),
+	# no lookup table, so the names are only in the address table, as some older linkers emit
+	("VERSION.dll", False, ["GetFileVersionInfoW", "VerQueryValueW"]),
+]
+
+FIXED_PRODUCT_VERSION = (1, 10, 162, 0)
+STRING_TABLES = [
+	("040704B0", [("ProductVersion", "9.9.9.9")]),
+	("040904B0", [("CompanyName", "Bethesda Softworks"), ("FileVersion", "1.10.162.0"), ("ProductVersion", "1.10.984.0")]),
+]
+
+def align(a_value, a_alignment):
+	return (a_value + a_alignment - 1) // a_alignment * a_alignment
+
+def pad(a_data, a_alignment):
+	return a_data + b"\0" * (align(len(a_data), a_alignment) - len(a_data))
+
+def make_imports():
+	descriptors_size = (len(IMPORTS) + 1) * 20
+	body = bytearray()
+
+	def place(a_data, a_alignment=2):
+		body.extend(b"\0" * (align(descriptors_size + len(body), a_alignment) - descriptors_size - len(body)))
+		rva = IDATA_RVA + descriptors_size + len(body)
+		body.extend(a_data)
+		return rva
+
+	descriptors = bytearray()
+	for dll, has_lookup, functions in IMPORTS:
+		thunks = []
+		for function in functions:
+			if isinstance(function, int):
+				thunks.append(0x8000000000000000 | function)
+			else:
+				thunks.append(place(struct.pack("<H", 0) + function.encode() + b"\0"))
+		table = b"".join(struct.pack("<Q", thunk) for thunk in thunks + [0])
+
+		lookup = place(table, 8) if has_lookup else 0
+		address = place(table, 8)
+		name = place(dll.encode() + b"\0")
+		descriptors += struct.pack("<IIIII", lookup, 0, 0, name, address)
+
+	descriptors += b"\0" * 20
+	return bytes(descriptors + body), len(descriptors)
+
+def version_node(a_key, a_value=b"", a_text=False, a_children=()):
+	key = (a_key + "\0").encode("utf-16-le")
+	node = pad(struct.pack("<HHH", 0, 0, 0) + key, 4) + a_value
+	for child in a_children:
+		node = pad(node, 4) + child
+
+	value_length = len(a_value) // 2 if a_text else len(a_value)
+	return struct.pack("<HHH", len(node), value_length, 1 if a_text else 0) + node[6:]
+
+def make_version_info():
+	ms = FIXED_PRODUCT_VERSION[0] << 16 | FIXED_PRODUCT_VERSION[1]
+	ls = FIXED_PRODUCT_VERSION[2] << 16 | FIXED_PRODUCT_VERSION[3]
+	fixed = struct.pack("<13I", 0xFEEF04BD, 0x10000, ms, ls, ms, ls, 0x3F, 0, 0x40004, 1, 0, 0, 0)
+
+	tables = []
+	for name, strings in STRING_TABLES:
+		children = [version_node(key, (value + "\0").encode("utf-16-le"), True) for key, value in strings]
+		tables.append(version_node(name, a_text=True, a_children=children))
+
+	translation = version_node("Translation", struct.pack("<HH", 0x0409, 0x04B0))
+	return version_node("VS_VERSION_INFO", fixed, a_children=[
+		version_node("StringFileInfo", a_text=True, a_children=tables),
+		version_node("VarFileInfo", a_text=True, a_children=[translation]),
+	])
+
+def make_resources():
+	# type -> name -> language, with a manifest alongside the version so the walk has to pick RT_VERSION
+	resources = [
+		(16, 1, 0x409, make_version_info()),
+		(24, 1, 0x409, b"<assembly xmlns=\"urn:schemas-microsoft-com:asm.v1\" manifestVersion=\"1.0\"/>"),
+	]
+
+	def directory(a_entries):
+		return struct.pack("<IIHHHH", 0, 0, 0, 0, 0, len(a_entries)) + b"".join(struct.pack("<II", *entry) for entry in a_entries)
+
+	# directories first, then the data entries, then the data
+	root_size = 16 + 8 * len(resources)
+	level_size = 16 + 8
+	types_offset = root_size
+	names_offset = types_offset + level_size * len(resources)
+	entries_offset = names_offset + level_size * len(resources)
+	data_offset = entries_offset + 16 * len(resources)
+
+	root = []
+	types = b""
+	names = b""
+	entries = b""
+	data = b""
+	for i, (type_id, name_id, language, payload) in enumerate(resources):
+		root.append((type_id, 0x80000000 | (types_offset + i * level_size)))
+		types += directory([(name_id, 0x80000000 | (names_offset + i * level_size))])
+		names += directory([(language, entries_offset + i * 16)])
+		data = pad(data, 8)
+		entries += struct.pack("<IIII", RSRC_RVA + data_offset + len(data), len(payload), 0, 0)
+		data += payload
+
+	return directory(root) + types + names + entries + data
+
+def make_image():
+	idata, descriptors_size = make_imports()
+	rsrc = make_resources()
+
+	headers_size = FILE_ALIGNMENT
+	sections = [
+		(b".idata", IDATA_RVA, idata, 0xC0000040),
+		(b".rsrc", RSRC_RVA, rsrc, 0x40000040),
+	]
+	image_size = align(sections[-1][1] + len(sections[-1][2]), SECTION_ALIGNMENT)
+
+	directories = [(0, 0)] * 16
+	directories[1] = (IDATA_RVA, descriptors_size)
+	directories[2] = (RSRC_RVA, len(rsrc))
+
+	optional = struct.pack(
+		"<HBBIIIIIQIIHHHHHHIIIIHHQQQQII",
+		0x20B, 14, 0, 0, len(idata) + len(rsrc), 0, 0, 0,
+		0x140000000, SECTION_ALIGNMENT, FILE_ALIGNMENT,
+		6, 0, 0, 0, 6, 0, 0,
+		image_size, headers_size, 0, 3, 0x8160,
+		0x100000, 0x1000, 0x100000, 0x1000, 0, len(directories))
+	optional += b"".join(struct.pack("<II", *directory) for directory in directories)
+
+	file_header = struct.pack("<HHIIIHH", 0x8664, len(sections), 0, 0, 0, len(optional), 0x22)
+	dos_header = b"MZ" + b"\0" * 58 + struct.pack("<I", 0x40)
+
+	section_headers = b""
+	raw = b""
+	for name, rva, data, characteristics in sections:
+		raw_size = align(len(data), FILE_ALIGNMENT)
+		section_headers += struct.pack("<8sIIIIIIHHI", name, len(data), rva, raw_size, headers_size + len(raw), 0, 0, 0, 0, characteristics)
+		raw += pad(data, FILE_ALIGNMENT)
+
+	headers = dos_header + b"PE\0\0" + file_header + optional + section_headers
+	assert len(headers) <= headers_size
+	return pad(headers, FILE_ALIGNMENT) + raw
+
+def main():
+	root = os.path.split(os.path.dirname(os.path.realpath(__file__)))[0]
+	with open(os.path.join(root, "tests", "data", "sample.exe"), "wb") as file:
+		file.write(make_image())
+
+if __name__ == "__main__":
+	main()
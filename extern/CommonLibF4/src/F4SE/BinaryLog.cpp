@@ -0,0 +1,582 @@
+#include "F4SE/BinaryLog.hpp"
+
+namespace F4SE::log
+{
+	namespace detail
+	{
+		enum class chunk_t : std::uint8_t
+		{
+			kSite,
+			kEvents,
+			kDropped,
+			kClock
+		};
+
+		// the time stamp counter is a fraction of the cost of the system clock, and is synchronized between cores
+		[[nodiscard]] std::int64_t ticks() noexcept
+		{
+			return static_cast<std::int64_t>(__rdtsc());
+		}
+
+		struct clock_sample_t
+		{
+			std::int64_t ticks;
+			std::int64_t time;
+		};
+
+		// a pairing of ticks with the system clock, which the decoder converts the ticks of records with
+		[[nodiscard]] clock_sample_t sample_clock() noexcept
+		{
+			const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			return { ticks(), time };
+		}
+
+		template <class T>
+		void append(std::vector<std::byte>& a_dst, const T& a_value)
+		{
+			const auto bytes = reinterpret_cast<const std::byte*>(std::addressof(a_value));
+			a_dst.insert(a_dst.end(), bytes, bytes + sizeof(T));
+		}
+
+		void append(std::vector<std::byte>& a_dst, clock_sample_t a_sample)
+		{
+			append(a_dst, chunk_t::kClock);
+			append(a_dst, std::uint32_t{ 0 });
+			append(a_dst, a_sample.ticks);
+			append(a_dst, a_sample.time);
+		}
+
+		void append(std::vector<std::byte>& a_dst, std::string_view a_value)
+		{
+			const auto size = static_cast<std::uint16_t>(std::min<std::size_t>(a_value.size(), 0xFFFF));
+			append(a_dst, size);
+			const auto bytes = reinterpret_cast<const std::byte*>(a_value.data());
+			a_dst.insert(a_dst.end(), bytes, bytes + size);
+		}
+
+		inline constexpr std::size_t SITE_CACHE_SIZE = 1u << 6;
+	}
+
+	struct BinaryLog::ring_t
+	{
+		std::array<std::byte, RING_SIZE> data;
+		alignas(64) std::atomic<std::size_t> head{ 0 };
+		alignas(64) std::atomic<std::size_t> tail{ 0 };
+		std::atomic<std::uint64_t> dropped{ 0 };
+		std::atomic_bool retired{ false };
+		std::uint32_t thread{ 0 };
+	};
+
+	// marks the ring once its thread exits, so the ring is released after its last drain
+	struct BinaryLog::ring_owner_t
+	{
+		~ring_owner_t()
+		{
+			if (ring) {
+				ring->retired.store(true, std::memory_order_release);
+			}
+		}
+
+		std::shared_ptr<ring_t> ring;
+	};
+
+	BinaryLog& BinaryLog::get() noexcept
+	{
+		// intentionally leaked, so no static destructor joins the thread under the loader lock
+		static const auto singleton = new BinaryLog();
+		return *singleton;
+	}
+
+	bool BinaryLog::open(const std::filesystem::path& a_path)
+	{
+		close();
+
+		const std::scoped_lock guard{ _lock };
+		_file.open(a_path, std::ios::binary | std::ios::trunc);
+		if (!_file) {
+			return false;
+		}
+
+		// every call site seen so far is described again, since the file is new
+		_file.write(reinterpret_cast<const char*>(std::addressof(MAGIC)), sizeof(MAGIC));
+		_file.write(reinterpret_cast<const char*>(std::addressof(VERSION)), sizeof(VERSION));
+		_siteRecordsWritten = 0;
+
+		std::vector<std::byte> clock;
+		detail::append(clock, detail::sample_clock());
+		_file.write(reinterpret_cast<const char*>(clock.data()), static_cast<std::streamsize>(clock.size()));
+
+		std::erase_if(_rings, [](const auto& a_ring) { return a_ring->retired.load(std::memory_order_acquire); });
+		for (const auto& ring : _rings) {
+			ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+			ring->dropped.store(0, std::memory_order_relaxed);
+		}
+
+		_open.store(true, std::memory_order_release);
+		_thread = std::jthread([this](std::stop_token a_token) { thread_main(a_token); });
+		return true;
+	}
+
+	void BinaryLog::close()
+	{
+		if (!_open.exchange(false)) {
+			return;
+		}
+
+		if (_thread.joinable()) {
+			_thread.request_stop();
+			_thread.join();
+		}
+
+		drain();
+
+		const std::scoped_lock guard{ _lock };
+		_file.close();
+	}
+
+	void BinaryLog::commit(const site_t& a_site, record_t& a_record)
+	{
+		const auto size = static_cast<std::uint32_t>(a_record.len - sizeof(std::uint32_t));
+		const auto id = site_id(a_site);
+		const auto time = detail::ticks();
+		std::memcpy(a_record.buf.data(), std::addressof(size), sizeof(size));
+		std::memcpy(a_record.buf.data() + sizeof(size), std::addressof(id), sizeof(id));
+		std::memcpy(a_record.buf.data() + sizeof(size) + sizeof(id), std::addressof(time), sizeof(time));
+
+		auto& ring = this->ring();
+		const auto head = ring.head.load(std::memory_order_relaxed);
+		const auto tail = ring.tail.load(std::memory_order_acquire);
+		if (RING_SIZE - (head - tail) < a_record.len) {
+			ring.dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		const auto offset = head & (RING_SIZE - 1);
+		const auto first = std::min(a_record.len, RING_SIZE - offset);
+		std::memcpy(ring.data.data() + offset, a_record.buf.data(), first);
+		std::memcpy(ring.data.data(), a_record.buf.data() + first, a_record.len - first);
+		ring.head.store(head + a_record.len, std::memory_order_release);
+	}
+
+	std::uint32_t BinaryLog::site_id(const site_t& a_site)
+	{
+		struct cache_entry_t
+		{
+			site_key_t key{};
+			std::uint32_t id{ 0 };
+		};
+
+		// the format and file literals identify the call site, so a hit is a few compares with no allocation
+		thread_local std::array<cache_entry_t, detail::SITE_CACHE_SIZE> cache{};
+
+		const site_key_t key{ a_site.fmt.data(), a_site.loc.file_name(), a_site.loc.line(), a_site.level };
+		auto& entry = cache[site_key_hash{}(key) & (detail::SITE_CACHE_SIZE - 1)];
+		if (entry.key == key) {
+			return entry.id;
+		}
+
+		// identical sites from different threads share an id
+		const std::scoped_lock guard{ _lock };
+		const auto [it, inserted] = _sites.try_emplace(key, static_cast<std::uint32_t>(_sites.size()));
+		if (inserted) {
+			detail::append(_siteRecords, detail::chunk_t::kSite);
+			detail::append(_siteRecords, it->second);
+			detail::append(_siteRecords, a_site.level);
+			detail::append(_siteRecords, static_cast<std::uint32_t>(a_site.loc.line()));
+			detail::append(_siteRecords, std::string_view(a_site.loc.file_name()));
+			detail::append(_siteRecords, a_site.fmt);
+		}
+
+		entry = { key, it->second };
+		return it->second;
+	}
+
+	auto BinaryLog::ring()
+		-> ring_t&
+	{
+		thread_local ring_owner_t local;
+		if (!local.ring) {
+			static std::atomic<std::uint32_t> threads{ 0 };
+			local.ring = std::make_shared<ring_t>();
+			local.ring->thread = threads.fetch_add(1, std::memory_order_relaxed);
+
+			const std::scoped_lock guard{ _lock };
+			_rings.push_back(local.ring);
+		}
+
+		return *local.ring;
+	}
+
+	void BinaryLog::prune(const std::vector<std::shared_ptr<ring_t>>& a_retired)
+	{
+		if (a_retired.empty()) {
+			return;
+		}
+
+		const std::scoped_lock guard{ _lock };
+		std::erase_if(_rings, [&](const auto& a_ring) { return std::ranges::find(a_retired, a_ring) != a_retired.end(); });
+	}
+
+	void BinaryLog::drain()
+	{
+		// taken before the rings are read, so every record drained here is older than it
+		const auto clock = detail::sample_clock();
+
+		std::vector<std::byte> out;
+		std::vector<std::byte> events;
+		std::vector<std::shared_ptr<ring_t>> rings;
+		{
+			const std::scoped_lock guard{ _lock };
+			out.assign(_siteRecords.begin() + _siteRecordsWritten, _siteRecords.end());
+			_siteRecordsWritten = _siteRecords.size();
+			rings = _rings;
+		}
+
+		// the decoder reads the whole file before rendering, so sites may trail the events using them
+		std::vector<std::shared_ptr<ring_t>> retired;
+		for (const auto& ring : rings) {
+			// read before the head, so a retired ring has no writes left past what is drained here
+			if (ring->retired.load(std::memory_order_acquire)) {
+				retired.push_back(ring);
+			}
+
+			const auto tail = ring->tail.load(std::memory_order_relaxed);
+			const auto head = ring->head.load(std::memory_order_acquire);
+			if (head != tail) {
+				const auto size = head - tail;
+				const auto offset = tail & (RING_SIZE - 1);
+				const auto first = std::min(size, RING_SIZE - offset);
+
+				detail::append(events, detail::chunk_t::kEvents);
+				detail::append(events, ring->thread);
+				detail::append(events, static_cast<std::uint32_t>(size));
+				events.insert(events.end(), ring->data.begin() + offset, ring->data.begin() + offset + first);
+				events.insert(events.end(), ring->data.begin(), ring->data.begin() + (size - first));
+				ring->tail.store(head, std::memory_order_release);
+			}
+
+			if (const auto dropped = ring->dropped.exchange(0, std::memory_order_relaxed); dropped != 0) {
+				detail::append(events, detail::chunk_t::kDropped);
+				detail::append(events, ring->thread);
+				detail::append(events, dropped);
+			}
+		}
+
+		// idle drains write nothing, not even a clock sample
+		if (!events.empty()) {
+			detail::append(out, clock);
+			out.insert(out.end(), events.begin(), events.end());
+		}
+
+		if (!out.empty()) {
+			const std::scoped_lock guard{ _lock };
+			_file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+			_file.flush();
+		}
+
+		prune(retired);
+	}
+
+	void BinaryLog::thread_main(std::stop_token a_token)
+	{
+		while (!a_token.stop_requested()) {
+			drain();
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+	}
+
+	namespace detail
+	{
+		using binary_arg_t = std::variant<std::int64_t, std::uint64_t, double, bool, char, std::string>;
+
+		struct binary_site_t
+		{
+			BinaryLog::Level level;
+			std::uint32_t line;
+			std::string file;
+			std::string fmt;
+		};
+
+		struct binary_event_t
+		{
+			std::int64_t ticks;
+			std::uint32_t thread;
+			std::uint32_t site;
+			std::vector<binary_arg_t> args;
+		};
+
+		class binary_reader_t
+		{
+		public:
+			explicit binary_reader_t(std::span<const std::byte> a_data) noexcept :
+				_data(a_data)
+			{
+			}
+
+			[[nodiscard]] bool empty() const noexcept { return _pos == _data.size(); }
+
+			template <class T>
+			bool read(T& a_value) noexcept
+			{
+				if (_data.size() - _pos < sizeof(T)) {
+					return false;
+				}
+				std::memcpy(std::addressof(a_value), _data.data() + _pos, sizeof(T));
+				_pos += sizeof(T);
+				return true;
+			}
+
+			bool read(std::string& a_value)
+			{
+				std::uint16_t size = 0;
+				if (!read(size) || _data.size() - _pos < size) {
+					return false;
+				}
+				a_value.assign(reinterpret_cast<const char*>(_data.data() + _pos), size);
+				_pos += size;
+				return true;
+			}
+
+			bool read(std::span<const std::byte>& a_value, std::size_t a_size) noexcept
+			{
+				if (_data.size() - _pos < a_size) {
+					return false;
+				}
+				a_value = _data.subspan(_pos, a_size);
+				_pos += a_size;
+				return true;
+			}
+
+		private:
+			std::span<const std::byte> _data;
+			std::size_t _pos{ 0 };
+		};
+
+		template <class T>
+		bool read_arg(binary_reader_t& a_reader, std::vector<binary_arg_t>& a_args)
+		{
+			T value{};
+			if (!a_reader.read(value)) {
+				return false;
+			}
+			a_args.emplace_back(std::move(value));
+			return true;
+		}
+
+		bool read_args(binary_reader_t& a_reader, std::vector<binary_arg_t>& a_args)
+		{
+			while (!a_reader.empty()) {
+				BinaryLog::ArgType type{};
+				if (!a_reader.read(type)) {
+					return false;
+				}
+
+				bool success = false;
+				switch (type) {
+					case BinaryLog::ArgType::kSigned:
+						success = read_arg<std::int64_t>(a_reader, a_args);
+						break;
+					case BinaryLog::ArgType::kUnsigned:
+						success = read_arg<std::uint64_t>(a_reader, a_args);
+						break;
+					case BinaryLog::ArgType::kFloat:
+						success = read_arg<double>(a_reader, a_args);
+						break;
+					case BinaryLog::ArgType::kBool: {
+						std::uint8_t value = 0;
+						success = a_reader.read(value);
+						a_args.emplace_back(value != 0);
+						break;
+					}
+					case BinaryLog::ArgType::kChar:
+						success = read_arg<char>(a_reader, a_args);
+						break;
+					case BinaryLog::ArgType::kString:
+						success = read_arg<std::string>(a_reader, a_args);
+						break;
+					default:
+						break;
+				}
+
+				if (!success) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// ticks are interpolated between the samples around them, which are in order since they are taken by one thread
+		[[nodiscard]] std::int64_t to_time(std::span<const clock_sample_t> a_clocks, std::int64_t a_ticks) noexcept
+		{
+			if (a_clocks.size() < 2) {
+				return a_clocks.empty() ? 0 : a_clocks.front().time;
+			}
+
+			const auto upper = std::ranges::upper_bound(a_clocks, a_ticks, {}, &clock_sample_t::ticks);
+			const auto hi = std::clamp(upper, a_clocks.begin() + 1, a_clocks.end() - 1);
+			const auto lo = hi - 1;
+			const auto span = hi->ticks - lo->ticks;
+			if (span <= 0) {
+				return lo->time;
+			}
+
+			const auto rate = static_cast<double>(hi->time - lo->time) / static_cast<double>(span);
+			return lo->time + static_cast<std::int64_t>(static_cast<double>(a_ticks - lo->ticks) * rate);
+		}
+
+		// positional indices are ignored, arguments are consumed in order
+		[[nodiscard]] std::string render(std::string_view a_fmt, const std::vector<binary_arg_t>& a_args)
+		{
+			std::string result;
+			std::size_t next = 0;
+			for (std::size_t i = 0; i < a_fmt.size();) {
+				const auto ch = a_fmt[i];
+				if ((ch == '{' || ch == '}') && i + 1 < a_fmt.size() && a_fmt[i + 1] == ch) {
+					result += ch;
+					i += 2;
+					continue;
+				}
+
+				if (ch != '{') {
+					result += ch;
+					++i;
+					continue;
+				}
+
+				const auto end = a_fmt.find('}', i);
+				if (end == std::string_view::npos) {
+					result += a_fmt.substr(i);
+					break;
+				}
+
+				const auto field = a_fmt.substr(i + 1, end - i - 1);
+				const auto colon = field.find(':');
+				const auto spec = std::format("{{{}}}", colon == std::string_view::npos ? ""sv : field.substr(colon));
+				if (next < a_args.size()) {
+					std::visit(
+						[&](const auto& a_arg) {
+							try {
+								result += std::vformat(spec, std::make_format_args(a_arg));
+							} catch (const std::format_error&) {
+								result += "{?}"sv;
+							}
+						},
+						a_args[next++]);
+				}
+				else {
+					result += "{}"sv;
+				}
+
+				i = end + 1;
+			}
+
+			return result;
+		}
+	}
+
+	bool DecodeBinaryLog(std::istream& a_in, std::ostream& a_out)
+	{
+		constexpr std::array LEVELS{ "trace"sv, "debug"sv, "info"sv, "warning"sv, "error"sv, "critical"sv };
+
+		std::vector<char> raw{ std::istreambuf_iterator<char>(a_in), std::istreambuf_iterator<char>() };
+		detail::binary_reader_t reader{ std::as_bytes(std::span{ raw }) };
+
+		std::uint32_t magic = 0;
+		std::uint32_t version = 0;
+		if (!reader.read(magic) || !reader.read(version) || magic != BinaryLog::MAGIC || version != BinaryLog::VERSION) {
+			return false;
+		}
+
+		std::unordered_map<std::uint32_t, detail::binary_site_t> sites;
+		std::vector<detail::clock_sample_t> clocks;
+		std::vector<detail::binary_event_t> events;
+		std::uint64_t dropped = 0;
+		while (!reader.empty()) {
+			detail::chunk_t chunk{};
+			std::uint32_t id = 0;
+			if (!reader.read(chunk) || !reader.read(id)) {
+				return false;
+			}
+
+			switch (chunk) {
+				case detail::chunk_t::kSite: {
+					detail::binary_site_t site{};
+					if (!reader.read(site.level) || !reader.read(site.line) || !reader.read(site.file) || !reader.read(site.fmt)) {
+						return false;
+					}
+					sites.insert_or_assign(id, std::move(site));
+					break;
+				}
+				case detail::chunk_t::kEvents: {
+					std::uint32_t size = 0;
+					std::span<const std::byte> bytes;
+					if (!reader.read(size) || !reader.read(bytes, size)) {
+						return false;
+					}
+
+					detail::binary_reader_t records{ bytes };
+					while (!records.empty()) {
+						std::uint32_t length = 0;
+						std::span<const std::byte> record;
+						if (!records.read(length) || !records.read(record, length)) {
+							return false;
+						}
+
+						detail::binary_reader_t fields{ record };
+						detail::binary_event_t event{};
+						event.thread = id;
+						if (!fields.read(event.site) || !fields.read(event.ticks) || !detail::read_args(fields, event.args)) {
+							return false;
+						}
+						events.push_back(std::move(event));
+					}
+					break;
+				}
+				case detail::chunk_t::kClock: {
+					detail::clock_sample_t sample{};
+					if (!reader.read(sample.ticks) || !reader.read(sample.time)) {
+						return false;
+					}
+					clocks.push_back(sample);
+					break;
+				}
+				case detail::chunk_t::kDropped: {
+					std::uint64_t count = 0;
+					if (!reader.read(count)) {
+						return false;
+					}
+					dropped += count;
+					break;
+				}
+				default:
+					return false;
+			}
+		}
+
+		std::ranges::stable_sort(events, {}, &detail::binary_event_t::ticks);
+		for (const auto& event : events) {
+			const auto time = std::chrono::floor<std::chrono::milliseconds>(
+				std::chrono::sys_time<std::chrono::nanoseconds>(std::chrono::nanoseconds(detail::to_time(clocks, event.ticks))));
+			const auto site = sites.find(event.site);
+			if (site == sites.end()) {
+				a_out << std::format("[{:%T}] [unknown] [{}] <unknown site {}>\n", time, event.thread, event.site);
+				continue;
+			}
+
+			const auto level = static_cast<std::size_t>(site->second.level);
+			a_out << std::format(
+				"[{:%T}] [{}] [{}] {}\n",
+				time,
+				level < LEVELS.size() ? LEVELS[level] : "unknown"sv,
+				event.thread,
+				detail::render(site->second.fmt, event.args));
+		}
+
+		if (dropped != 0) {
+			a_out << std::format("{} record(s) were dropped because a ring buffer was full\n", dropped);
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,209 @@
+#include "F4SE/Coroutine.hpp"
+
+#ifndef F4SE_TEST_SUITE
+#include "F4SE/API.hpp"
+#include "F4SE/Interfaces.hpp"
+#endif
+#include "F4SE/Logger.hpp"
+
+namespace F4SE
+{
+	namespace detail
+	{
+#ifndef F4SE_TEST_SUITE
+		class TaskExecutor :
+			public CoroutineExecutor
+		{
+		public:
+			void post(std::function<void()> a_task) override { task().AddTask(std::move(a_task)); }
+			void post_ui(std::function<void()> a_task) override { task().AddUITask(std::move(a_task)); }
+
+		private:
+			[[nodiscard]] static const TaskInterface& task()
+			{
+				const auto intfc = GetTaskInterface();
+				if (!intfc) {
+					stl::report_and_fail("coroutines require the task interface"sv);
+				}
+				return *intfc;
+			}
+		};
+#endif
+
+		struct frame_pool_t
+		{
+			static constexpr std::size_t GRANULARITY = 64;
+			static constexpr std::size_t CLASSES = 32;
+
+			[[nodiscard]] static constexpr std::size_t size_class(std::size_t a_size) noexcept
+			{
+				return (a_size + GRANULARITY - 1) / GRANULARITY - 1;
+			}
+
+			std::mutex lock;
+			std::array<std::vector<void*>, CLASSES> frames;
+		};
+
+		[[nodiscard]] frame_pool_t& frame_pool() noexcept
+		{
+			static frame_pool_t singleton;
+			return singleton;
+		}
+
+		void* CoroutineFramePool::allocate(std::size_t a_size)
+		{
+			const auto index = frame_pool_t::size_class(a_size);
+			if (index >= frame_pool_t::CLASSES) {
+				return ::operator new(a_size);
+			}
+
+			auto& pool = frame_pool();
+			{
+				const std::scoped_lock guard{ pool.lock };
+				if (auto& frames = pool.frames[index]; !frames.empty()) {
+					const auto mem = frames.back();
+					frames.pop_back();
+					return mem;
+				}
+			}
+
+			return ::operator new((index + 1) * frame_pool_t::GRANULARITY);
+		}
+
+		void CoroutineFramePool::deallocate(void* a_mem, std::size_t a_size) noexcept
+		{
+			const auto index = frame_pool_t::size_class(a_size);
+			if (index >= frame_pool_t::CLASSES) {
+				::operator delete(a_mem);
+				return;
+			}
+
+			auto& pool = frame_pool();
+			const std::scoped_lock guard{ pool.lock };
+			try {
+				pool.frames[index].push_back(a_mem);
+			} catch (...) {
+				::operator delete(a_mem);
+			}
+		}
+	}
+
+	CoroutineExecutor& CoroutineExecutor::get() noexcept
+	{
+#ifndef F4SE_TEST_SUITE
+		static detail::TaskExecutor singleton;
+		return singleton;
+#else
+		stl::report_and_fail("the host has no task interface, so set_executor must be called first"sv);
+#endif
+	}
+
+	void Coroutine::promise_type::unhandled_exception() const noexcept
+	{
+		try {
+			throw;
+		} catch (const std::exception& e) {
+			log::error("unhandled exception in coroutine: {}"sv, e.what());
+		} catch (...) {
+			log::error("unhandled exception in coroutine"sv);
+		}
+	}
+
+	CoroutineScheduler& CoroutineScheduler::get() noexcept
+	{
+		static CoroutineScheduler singleton;
+		return singleton;
+	}
+
+	void CoroutineScheduler::set_executor(CoroutineExecutor& a_executor) noexcept
+	{
+		const std::scoped_lock guard{ _lock };
+		_executor = std::addressof(a_executor);
+	}
+
+	void CoroutineScheduler::resume_next_frame(std::coroutine_handle<> a_handle)
+	{
+		const std::scoped_lock guard{ _lock };
+		_frame.push_back(a_handle);
+		request_frame();
+	}
+
+	void CoroutineScheduler::resume_on_ui(std::coroutine_handle<> a_handle)
+	{
+		const std::scoped_lock guard{ _lock };
+		_ui.push_back(a_handle);
+		request_ui();
+	}
+
+	void CoroutineScheduler::resume_after(std::coroutine_handle<> a_handle, clock_type::time_point a_time)
+	{
+		const std::scoped_lock guard{ _lock };
+		_timers.push_back({ a_time, a_handle });
+		std::ranges::push_heap(_timers, std::greater{});
+		request_frame();
+	}
+
+	std::size_t CoroutineScheduler::pending() const
+	{
+		const std::scoped_lock guard{ _lock };
+		return _frame.size() + _ui.size() + _timers.size();
+	}
+
+	// expects _lock to be held
+	void CoroutineScheduler::request_frame()
+	{
+		if (!_framePosted) {
+			_framePosted = true;
+			executor().post([this]() { run_frame(); });
+		}
+	}
+
+	// expects _lock to be held
+	void CoroutineScheduler::request_ui()
+	{
+		if (!_uiPosted) {
+			_uiPosted = true;
+			executor().post_ui([this]() { run_ui(); });
+		}
+	}
+
+	void CoroutineScheduler::run_frame()
+	{
+		std::vector<std::coroutine_handle<>> ready;
+		{
+			const std::scoped_lock guard{ _lock };
+			_framePosted = false;
+			ready.swap(_frame);
+
+			const auto now = this->now();
+			while (!_timers.empty() && _timers.front().time <= now) {
+				std::ranges::pop_heap(_timers, std::greater{});
+				ready.push_back(_timers.back().handle);
+				_timers.pop_back();
+			}
+
+			// outstanding timers are polled once per frame
+			if (!_timers.empty()) {
+				request_frame();
+			}
+		}
+
+		for (const auto handle : ready) {
+			handle.resume();
+		}
+	}
+
+	void CoroutineScheduler::run_ui()
+	{
+		std::vector<std::coroutine_handle<>> ready;
+		{
+			const std::scoped_lock guard{ _lock };
+			_uiPosted = false;
+			ready.swap(_ui);
+		}
+
+		for (const auto handle : ready) {
+			handle.resume();
+		}
+	}
+}
@@ -1,6 +1,8 @@
 #include "F4SE/InputMap.hpp"
 
+#ifndef F4SE_TEST_SUITE
 #include "RE/Bethesda/ControlMap.hpp"
+#endif
 
 #include "REX/PS4/SCEPAD.hpp"
 #include "REX/W32/DINPUT.hpp"
@@ -9,184 +11,562 @@
 
 namespace F4SE
 {
-	std::uint32_t InputMap::XInputToScePadOffset(std::uint32_t keyMask)
+	namespace detail
 	{
-		switch (keyMask) {
-			case REX::W32::XINPUT_GAMEPAD_DPAD_UP:
-				return REX::PS4::SCE_PAD_BUTTON_UP;
-			case REX::W32::XINPUT_GAMEPAD_DPAD_DOWN:
-				return REX::PS4::SCE_PAD_BUTTON_DOWN;
-			case REX::W32::XINPUT_GAMEPAD_DPAD_LEFT:
-				return REX::PS4::SCE_PAD_BUTTON_LEFT;
-			case REX::W32::XINPUT_GAMEPAD_DPAD_RIGHT:
-				return REX::PS4::SCE_PAD_BUTTON_RIGHT;
-			case REX::W32::XINPUT_GAMEPAD_START:
-				return REX::PS4::SCE_PAD_BUTTON_OPTIONS;
-			case REX::W32::XINPUT_GAMEPAD_BACK:
-				return REX::PS4::SCE_PAD_BUTTON_TOUCH_PAD;
-			case REX::W32::XINPUT_GAMEPAD_LEFT_THUMB:
-				return REX::PS4::SCE_PAD_BUTTON_L3;
-			case REX::W32::XINPUT_GAMEPAD_RIGHT_THUMB:
-				return REX::PS4::SCE_PAD_BUTTON_R3;
-			case REX::W32::XINPUT_GAMEPAD_LEFT_SHOULDER:
-				return REX::PS4::SCE_PAD_BUTTON_L1;
-			case REX::W32::XINPUT_GAMEPAD_RIGHT_SHOULDER:
-				return REX::PS4::SCE_PAD_BUTTON_R1;
-			case REX::W32::XINPUT_GAMEPAD_A:
-				return REX::PS4::SCE_PAD_BUTTON_CROSS;
-			case REX::W32::XINPUT_GAMEPAD_B:
-				return REX::PS4::SCE_PAD_BUTTON_CIRCLE;
-			case REX::W32::XINPUT_GAMEPAD_X:
-				return REX::PS4::SCE_PAD_BUTTON_SQUARE;
-			case REX::W32::XINPUT_GAMEPAD_Y:
-				return REX::PS4::SCE_PAD_BUTTON_TRIANGLE;
-			default:
-				return keyMask;
+		struct gamepad_button_t
+		{
+			std::uint32_t keyCode;
+			std::uint32_t xinput;
+			std::uint32_t scePad;
+		};
+
+		// every gamepad mapping below is generated from this table
+		inline constexpr std::array GAMEPAD_BUTTONS{
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_DPAD_UP, REX::W32::XINPUT_GAMEPAD_DPAD_UP, REX::PS4::SCE_PAD_BUTTON_UP },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_DPAD_DOWN, REX::W32::XINPUT_GAMEPAD_DPAD_DOWN, REX::PS4::SCE_PAD_BUTTON_DOWN },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_DPAD_LEFT, REX::W32::XINPUT_GAMEPAD_DPAD_LEFT, REX::PS4::SCE_PAD_BUTTON_LEFT },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_DPAD_RIGHT, REX::W32::XINPUT_GAMEPAD_DPAD_RIGHT, REX::PS4::SCE_PAD_BUTTON_RIGHT },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_START, REX::W32::XINPUT_GAMEPAD_START, REX::PS4::SCE_PAD_BUTTON_OPTIONS },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_BACK, REX::W32::XINPUT_GAMEPAD_BACK, REX::PS4::SCE_PAD_BUTTON_TOUCH_PAD },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_LEFT_THUMB, REX::W32::XINPUT_GAMEPAD_LEFT_THUMB, REX::PS4::SCE_PAD_BUTTON_L3 },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_RIGHT_THUMB, REX::W32::XINPUT_GAMEPAD_RIGHT_THUMB, REX::PS4::SCE_PAD_BUTTON_R3 },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_LEFT_SHOULDER, REX::W32::XINPUT_GAMEPAD_LEFT_SHOULDER, REX::PS4::SCE_PAD_BUTTON_L1 },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_RIGHT_SHOULDER, REX::W32::XINPUT_GAMEPAD_RIGHT_SHOULDER, REX::PS4::SCE_PAD_BUTTON_R1 },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_A, REX::W32::XINPUT_GAMEPAD_A, REX::PS4::SCE_PAD_BUTTON_CROSS },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_B, REX::W32::XINPUT_GAMEPAD_B, REX::PS4::SCE_PAD_BUTTON_CIRCLE },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_X, REX::W32::XINPUT_GAMEPAD_X, REX::PS4::SCE_PAD_BUTTON_SQUARE },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_Y, REX::W32::XINPUT_GAMEPAD_Y, REX::PS4::SCE_PAD_BUTTON_TRIANGLE },
+			// the triggers use game-defined ids, and have no pad button to translate to
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_LT, 0x9, 0 },
+			gamepad_button_t{ InputMap::kGamepadButtonOffset_RT, 0xA, 0 },
+		};
+
+		inline constexpr std::size_t MASK_SLOTS = 48;
+
+		// button masks index by their bit, followed by the game-defined ids below 0x10
+		[[nodiscard]] constexpr std::size_t mask_slot(std::uint32_t a_mask) noexcept
+		{
+			if (std::has_single_bit(a_mask)) {
+				return static_cast<std::size_t>(std::countr_zero(a_mask));
+			}
+			return a_mask < 0x10 ? 32 + a_mask : MASK_SLOTS;
+		}
+
+		struct gamepad_tables_t
+		{
+			std::array<std::uint32_t, MASK_SLOTS> xinputToScePad{};
+			std::array<std::uint32_t, MASK_SLOTS> scePadToXInput{};
+			std::array<std::uint32_t, MASK_SLOTS> xinputToKeyCode{};
+			std::array<std::uint32_t, InputMap::kMacro_NumGamepadButtons> keyCodeToXInput{};
+		};
+
+		consteval gamepad_tables_t make_gamepad_tables()
+		{
+			gamepad_tables_t tables;
+			for (const auto& button : GAMEPAD_BUTTONS) {
+				const auto xinput = mask_slot(button.xinput);
+				const auto keyCode = button.keyCode - InputMap::kMacro_GamepadOffset;
+				if (xinput >= MASK_SLOTS || tables.xinputToKeyCode[xinput] != 0 || tables.keyCodeToXInput[keyCode] != 0) {
+					throw "gamepad buttons must be unique";
+				}
+
+				tables.xinputToKeyCode[xinput] = button.keyCode;
+				tables.keyCodeToXInput[keyCode] = button.xinput;
+
+				if (button.scePad != 0) {
+					const auto scePad = mask_slot(button.scePad);
+					if (scePad >= MASK_SLOTS || tables.scePadToXInput[scePad] != 0) {
+						throw "pad buttons must be unique";
+					}
+
+					tables.xinputToScePad[xinput] = button.scePad;
+					tables.scePadToXInput[scePad] = button.xinput;
+				}
+			}
+
+			return tables;
+		}
+
+		inline constexpr auto GAMEPAD_TABLES = make_gamepad_tables();
+
+		// unmapped masks pass through unchanged
+		[[nodiscard]] constexpr std::uint32_t translate_mask(const std::array<std::uint32_t, MASK_SLOTS>& a_table, std::uint32_t a_mask) noexcept
+		{
+			const auto slot = mask_slot(a_mask);
+			return slot < MASK_SLOTS && a_table[slot] != 0 ? a_table[slot] : a_mask;
+		}
+
+		[[nodiscard]] constexpr std::uint32_t xinput_to_keycode(std::uint32_t a_mask) noexcept
+		{
+			const auto slot = mask_slot(a_mask);
+			if (slot >= MASK_SLOTS || GAMEPAD_TABLES.xinputToKeyCode[slot] == 0) {
+				return InputMap::kMaxMacros;
+			}
+			return GAMEPAD_TABLES.xinputToKeyCode[slot];
+		}
+
+		[[nodiscard]] constexpr std::uint32_t keycode_to_xinput(std::uint32_t a_keyCode) noexcept
+		{
+			const auto index = a_keyCode - InputMap::kMacro_GamepadOffset;
+			return index < GAMEPAD_TABLES.keyCodeToXInput.size() ? GAMEPAD_TABLES.keyCodeToXInput[index] : 0xFF;
+		}
+
+		struct key_name_t
+		{
+			std::uint32_t keyCode;
+			std::string_view name;
+		};
+
+#define F4SE_KEYBOARD_KEY(a_name) key_name_t{ REX::W32::DIK_##a_name, #a_name }
+#define F4SE_GAMEPAD_KEY(a_name) key_name_t{ InputMap::kGamepadButtonOffset_##a_name, "GAMEPAD_" #a_name }
+
+		// the first name of a key code is the one it is written out as, any later ones are aliases
+		inline constexpr std::array KEY_NAMES{
+			F4SE_KEYBOARD_KEY(ESCAPE),
+			F4SE_KEYBOARD_KEY(1),
+			F4SE_KEYBOARD_KEY(2),
+			F4SE_KEYBOARD_KEY(3),
+			F4SE_KEYBOARD_KEY(4),
+			F4SE_KEYBOARD_KEY(5),
+			F4SE_KEYBOARD_KEY(6),
+			F4SE_KEYBOARD_KEY(7),
+			F4SE_KEYBOARD_KEY(8),
+			F4SE_KEYBOARD_KEY(9),
+			F4SE_KEYBOARD_KEY(0),
+			F4SE_KEYBOARD_KEY(MINUS),
+			F4SE_KEYBOARD_KEY(EQUALS),
+			F4SE_KEYBOARD_KEY(BACK),
+			F4SE_KEYBOARD_KEY(TAB),
+			F4SE_KEYBOARD_KEY(Q),
+			F4SE_KEYBOARD_KEY(W),
+			F4SE_KEYBOARD_KEY(E),
+			F4SE_KEYBOARD_KEY(R),
+			F4SE_KEYBOARD_KEY(T),
+			F4SE_KEYBOARD_KEY(Y),
+			F4SE_KEYBOARD_KEY(U),
+			F4SE_KEYBOARD_KEY(I),
+			F4SE_KEYBOARD_KEY(O),
+			F4SE_KEYBOARD_KEY(P),
+			F4SE_KEYBOARD_KEY(LBRACKET),
+			F4SE_KEYBOARD_KEY(RBRACKET),
+			F4SE_KEYBOARD_KEY(RETURN),
+			F4SE_KEYBOARD_KEY(LCONTROL),
+			F4SE_KEYBOARD_KEY(A),
+			F4SE_KEYBOARD_KEY(S),
+			F4SE_KEYBOARD_KEY(D),
+			F4SE_KEYBOARD_KEY(F),
+			F4SE_KEYBOARD_KEY(G),
+			F4SE_KEYBOARD_KEY(H),
+			F4SE_KEYBOARD_KEY(J),
+			F4SE_KEYBOARD_KEY(K),
+			F4SE_KEYBOARD_KEY(L),
+			F4SE_KEYBOARD_KEY(SEMICOLON),
+			F4SE_KEYBOARD_KEY(APOSTROPHE),
+			F4SE_KEYBOARD_KEY(GRAVE),
+			F4SE_KEYBOARD_KEY(LSHIFT),
+			F4SE_KEYBOARD_KEY(BACKSLASH),
+			F4SE_KEYBOARD_KEY(Z),
+			F4SE_KEYBOARD_KEY(X),
+			F4SE_KEYBOARD_KEY(C),
+			F4SE_KEYBOARD_KEY(V),
+			F4SE_KEYBOARD_KEY(B),
+			F4SE_KEYBOARD_KEY(N),
+			F4SE_KEYBOARD_KEY(M),
+			F4SE_KEYBOARD_KEY(COMMA),
+			F4SE_KEYBOARD_KEY(PERIOD),
+			F4SE_KEYBOARD_KEY(SLASH),
+			F4SE_KEYBOARD_KEY(RSHIFT),
+			F4SE_KEYBOARD_KEY(MULTIPLY),
+			F4SE_KEYBOARD_KEY(LMENU),
+			F4SE_KEYBOARD_KEY(SPACE),
+			F4SE_KEYBOARD_KEY(CAPITAL),
+			F4SE_KEYBOARD_KEY(F1),
+			F4SE_KEYBOARD_KEY(F2),
+			F4SE_KEYBOARD_KEY(F3),
+			F4SE_KEYBOARD_KEY(F4),
+			F4SE_KEYBOARD_KEY(F5),
+			F4SE_KEYBOARD_KEY(F6),
+			F4SE_KEYBOARD_KEY(F7),
+			F4SE_KEYBOARD_KEY(F8),
+			F4SE_KEYBOARD_KEY(F9),
+			F4SE_KEYBOARD_KEY(F10),
+			F4SE_KEYBOARD_KEY(NUMLOCK),
+			F4SE_KEYBOARD_KEY(SCROLL),
+			F4SE_KEYBOARD_KEY(NUMPAD7),
+			F4SE_KEYBOARD_KEY(NUMPAD8),
+			F4SE_KEYBOARD_KEY(NUMPAD9),
+			F4SE_KEYBOARD_KEY(SUBTRACT),
+			F4SE_KEYBOARD_KEY(NUMPAD4),
+			F4SE_KEYBOARD_KEY(NUMPAD5),
+			F4SE_KEYBOARD_KEY(NUMPAD6),
+			F4SE_KEYBOARD_KEY(ADD),
+			F4SE_KEYBOARD_KEY(NUMPAD1),
+			F4SE_KEYBOARD_KEY(NUMPAD2),
+			F4SE_KEYBOARD_KEY(NUMPAD3),
+			F4SE_KEYBOARD_KEY(NUMPAD0),
+			F4SE_KEYBOARD_KEY(DECIMAL),
+			F4SE_KEYBOARD_KEY(OEM_102),
+			F4SE_KEYBOARD_KEY(F11),
+			F4SE_KEYBOARD_KEY(F12),
+			F4SE_KEYBOARD_KEY(F13),
+			F4SE_KEYBOARD_KEY(F14),
+			F4SE_KEYBOARD_KEY(F15),
+			F4SE_KEYBOARD_KEY(KANA),
+			F4SE_KEYBOARD_KEY(ABNT_C1),
+			F4SE_KEYBOARD_KEY(CONVERT),
+			F4SE_KEYBOARD_KEY(NOCONVERT),
+			F4SE_KEYBOARD_KEY(YEN),
+			F4SE_KEYBOARD_KEY(ABNT_C2),
+			F4SE_KEYBOARD_KEY(NUMPADEQUALS),
+			F4SE_KEYBOARD_KEY(PREVTRACK),
+			F4SE_KEYBOARD_KEY(AT),
+			F4SE_KEYBOARD_KEY(COLON),
+			F4SE_KEYBOARD_KEY(UNDERLINE),
+			F4SE_KEYBOARD_KEY(KANJI),
+			F4SE_KEYBOARD_KEY(STOP),
+			F4SE_KEYBOARD_KEY(AX),
+			F4SE_KEYBOARD_KEY(UNLABELED),
+			F4SE_KEYBOARD_KEY(NEXTTRACK),
+			F4SE_KEYBOARD_KEY(NUMPADENTER),
+			F4SE_KEYBOARD_KEY(RCONTROL),
+			F4SE_KEYBOARD_KEY(MUTE),
+			F4SE_KEYBOARD_KEY(CALCULATOR),
+			F4SE_KEYBOARD_KEY(PLAYPAUSE),
+			F4SE_KEYBOARD_KEY(MEDIASTOP),
+			F4SE_KEYBOARD_KEY(VOLUMEDOWN),
+			F4SE_KEYBOARD_KEY(VOLUMEUP),
+			F4SE_KEYBOARD_KEY(WEBHOME),
+			F4SE_KEYBOARD_KEY(NUMPADCOMMA),
+			F4SE_KEYBOARD_KEY(DIVIDE),
+			F4SE_KEYBOARD_KEY(SYSRQ),
+			F4SE_KEYBOARD_KEY(RMENU),
+			F4SE_KEYBOARD_KEY(PAUSE),
+			F4SE_KEYBOARD_KEY(HOME),
+			F4SE_KEYBOARD_KEY(UP),
+			F4SE_KEYBOARD_KEY(PRIOR),
+			F4SE_KEYBOARD_KEY(LEFT),
+			F4SE_KEYBOARD_KEY(RIGHT),
+			F4SE_KEYBOARD_KEY(END),
+			F4SE_KEYBOARD_KEY(DOWN),
+			F4SE_KEYBOARD_KEY(NEXT),
+			F4SE_KEYBOARD_KEY(INSERT),
+			F4SE_KEYBOARD_KEY(DELETE),
+			F4SE_KEYBOARD_KEY(LWIN),
+			F4SE_KEYBOARD_KEY(RWIN),
+			F4SE_KEYBOARD_KEY(APPS),
+			F4SE_KEYBOARD_KEY(POWER),
+			F4SE_KEYBOARD_KEY(SLEEP),
+			F4SE_KEYBOARD_KEY(WAKE),
+			F4SE_KEYBOARD_KEY(WEBSEARCH),
+			F4SE_KEYBOARD_KEY(WEBFAVORITES),
+			F4SE_KEYBOARD_KEY(WEBREFRESH),
+			F4SE_KEYBOARD_KEY(WEBSTOP),
+			F4SE_KEYBOARD_KEY(WEBFORWARD),
+			F4SE_KEYBOARD_KEY(WEBBACK),
+			F4SE_KEYBOARD_KEY(MYCOMPUTER),
+			F4SE_KEYBOARD_KEY(MAIL),
+			F4SE_KEYBOARD_KEY(MEDIASELECT),
+			F4SE_KEYBOARD_KEY(BACKSPACE),
+			F4SE_KEYBOARD_KEY(NUMPADSTAR),
+			F4SE_KEYBOARD_KEY(LALT),
+			F4SE_KEYBOARD_KEY(CAPSLOCK),
+			F4SE_KEYBOARD_KEY(NUMPADMINUS),
+			F4SE_KEYBOARD_KEY(NUMPADPLUS),
+			F4SE_KEYBOARD_KEY(NUMPADPERIOD),
+			F4SE_KEYBOARD_KEY(NUMPADSLASH),
+			F4SE_KEYBOARD_KEY(RALT),
+			F4SE_KEYBOARD_KEY(UPARROW),
+			F4SE_KEYBOARD_KEY(PGUP),
+			F4SE_KEYBOARD_KEY(LEFTARROW),
+			F4SE_KEYBOARD_KEY(RIGHTARROW),
+			F4SE_KEYBOARD_KEY(DOWNARROW),
+			F4SE_KEYBOARD_KEY(PGDN),
+			key_name_t{ InputMap::kMacro_MouseButtonOffset + 0, "MOUSE1" },
+			key_name_t{ InputMap::kMacro_MouseButtonOffset + 1, "MOUSE2" },
+			key_name_t{ InputMap::kMacro_MouseButtonOffset + 2, "MOUSE3" },
+			key_name_t{ InputMap::kMacro_MouseButtonOffset + 3, "MOUSE4" },
+			key_name_t{ InputMap::kMacro_MouseButtonOffset + 4, "MOUSE5" },
+			key_name_t{ InputMap::kMacro_MouseButtonOffset + 5, "MOUSE6" },
+			key_name_t{ InputMap::kMacro_MouseButtonOffset + 6, "MOUSE7" },
+			key_name_t{ InputMap::kMacro_MouseButtonOffset + 7, "MOUSE8" },
+			key_name_t{ InputMap::kMacro_MouseWheelOffset + 0, "WHEEL_UP" },
+			key_name_t{ InputMap::kMacro_MouseWheelOffset + 1, "WHEEL_DOWN" },
+			F4SE_GAMEPAD_KEY(DPAD_UP),
+			F4SE_GAMEPAD_KEY(DPAD_DOWN),
+			F4SE_GAMEPAD_KEY(DPAD_LEFT),
+			F4SE_GAMEPAD_KEY(DPAD_RIGHT),
+			F4SE_GAMEPAD_KEY(START),
+			F4SE_GAMEPAD_KEY(BACK),
+			F4SE_GAMEPAD_KEY(LEFT_THUMB),
+			F4SE_GAMEPAD_KEY(RIGHT_THUMB),
+			F4SE_GAMEPAD_KEY(LEFT_SHOULDER),
+			F4SE_GAMEPAD_KEY(RIGHT_SHOULDER),
+			F4SE_GAMEPAD_KEY(A),
+			F4SE_GAMEPAD_KEY(B),
+			F4SE_GAMEPAD_KEY(X),
+			F4SE_GAMEPAD_KEY(Y),
+			F4SE_GAMEPAD_KEY(LT),
+			F4SE_GAMEPAD_KEY(RT),
+		};
+
+#undef F4SE_GAMEPAD_KEY
+#undef F4SE_KEYBOARD_KEY
+
+		inline constexpr std::uint16_t NO_KEY_NAME = 0xFFFF;
+
+		consteval auto make_key_code_names()
+		{
+			std::array<std::uint16_t, InputMap::kMaxMacros> names{};
+			names.fill(NO_KEY_NAME);
+			for (std::size_t i = 0; i < KEY_NAMES.size(); ++i) {
+				const auto keyCode = KEY_NAMES[i].keyCode;
+				if (keyCode >= names.size()) {
+					throw "key code out of range";
+				}
+				if (names[keyCode] == NO_KEY_NAME) {
+					names[keyCode] = static_cast<std::uint16_t>(i);
+				}
+			}
+			return names;
+		}
+
+		// indices into KEY_NAMES
+		inline constexpr auto KEY_CODE_NAMES = make_key_code_names();
+
+		[[nodiscard]] constexpr char ascii_upper(char a_ch) noexcept
+		{
+			return a_ch >= 'a' && a_ch <= 'z' ? static_cast<char>(a_ch - 'a' + 'A') : a_ch;
+		}
+
+		[[nodiscard]] constexpr bool iequals(std::string_view a_lhs, std::string_view a_rhs) noexcept
+		{
+			return std::ranges::equal(a_lhs, a_rhs, [](char a_l, char a_r) { return ascii_upper(a_l) == ascii_upper(a_r); });
+		}
+
+		// key names are only letters, digits and underscores, so clearing bit 5 of every byte folds case
+		// a word at a time; digits fold onto control codes, which is fine as long as equal names hash equal
+		inline constexpr std::uint64_t CASE_FOLD = 0xDFDFDFDFDFDFDFDF;
+
+		[[nodiscard]] constexpr std::uint64_t name_hash(std::string_view a_name) noexcept
+		{
+			const auto mix = [](std::uint64_t a_hash) noexcept {
+				a_hash ^= a_hash >> 33;
+				a_hash *= 0xFF51AFD7ED558CCD;
+				a_hash ^= a_hash >> 29;
+				return a_hash;
+			};
+
+			std::uint64_t hash = 0x9E3779B97F4A7C15 ^ a_name.size();
+			std::size_t i = 0;
+			for (; i + 8 <= a_name.size(); i += 8) {
+				std::uint64_t word = 0;
+				if !consteval {
+					std::memcpy(std::addressof(word), a_name.data() + i, 8);  // little endian, like the loop below
+				}
+				else {
+					for (std::size_t j = 0; j < 8; ++j) {
+						word |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(a_name[i + j])) << (j * 8);
+					}
+				}
+				hash = mix(hash ^ (word & CASE_FOLD));
+			}
+
+			std::uint64_t tail = 0;
+			for (std::size_t j = 0; i + j < a_name.size(); ++j) {
+				tail |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(a_name[i + j])) << (j * 8);
+			}
+			return mix(hash ^ (tail & CASE_FOLD));
+		}
+
+		[[nodiscard]] constexpr std::uint32_t name_slot(std::uint64_t a_hash, std::uint32_t a_seed) noexcept
+		{
+			auto hash = a_hash ^ (a_seed * 0x9E3779B97F4A7C15);
+			hash ^= hash >> 32;
+			hash *= 0xC4CEB9FE1A85EC53;
+			return static_cast<std::uint32_t>(hash >> 32);
+		}
+
+		/**
+		 * A minimal perfect hash over <code>KEY_NAMES</code>, built with hash and displace.
+		 *
+		 * <p>
+		 * Names are first hashed into buckets. Each bucket then gets its own seed, chosen so that
+		 * its names rehash into slots no other name occupies, so a lookup costs one pass over the
+		 * name, a remix and a single comparison.
+		 * </p>
+		 */
+		struct key_name_hash_t
+		{
+			static constexpr std::size_t BUCKETS = 128;
+			static constexpr std::size_t SLOTS = 512;
+			static constexpr std::uint16_t EMPTY = 0xFFFF;
+
+			static_assert(KEY_NAMES.size() < SLOTS);
+
+			[[nodiscard]] constexpr const key_name_t* find(std::string_view a_name) const noexcept
+			{
+				const auto hash = name_hash(a_name);
+				const auto index = slots[name_slot(hash, seeds[hash % BUCKETS]) % SLOTS];
+				return index != EMPTY && iequals(KEY_NAMES[index].name, a_name) ? std::addressof(KEY_NAMES[index]) : nullptr;
+			}
+
+			std::array<std::uint32_t, BUCKETS> seeds{};
+			std::array<std::uint16_t, SLOTS> slots{};
+		};
+
+		consteval key_name_hash_t make_key_name_hash()
+		{
+			using hash_t = key_name_hash_t;
+
+			std::array<std::uint64_t, KEY_NAMES.size()> hashes{};
+			std::array<std::vector<std::uint16_t>, hash_t::BUCKETS> buckets;
+			for (std::size_t i = 0; i < KEY_NAMES.size(); ++i) {
+				hashes[i] = name_hash(KEY_NAMES[i].name);
+				buckets[hashes[i] % hash_t::BUCKETS].push_back(static_cast<std::uint16_t>(i));
+			}
+
+			std::array<std::size_t, hash_t::BUCKETS> order{};
+			for (std::size_t i = 0; i < order.size(); ++i) {
+				order[i] = i;
+			}
+			// the largest buckets are the hardest to place, so they go first
+			std::ranges::sort(order, std::ranges::greater{}, [&](std::size_t a_bucket) { return buckets[a_bucket].size(); });
+
+			hash_t result;
+			result.slots.fill(hash_t::EMPTY);
+			for (const auto bucket : order) {
+				if (buckets[bucket].empty()) {
+					break;
+				}
+
+				for (std::uint32_t seed = 1;; ++seed) {
+					if (seed == 0x10000) {
+						throw "failed to build key name hash";
+					}
+
+					std::vector<std::size_t> taken;
+					for (const auto index : buckets[bucket]) {
+						const auto slot = name_slot(hashes[index], seed) % hash_t::SLOTS;
+						if (result.slots[slot] != hash_t::EMPTY || std::ranges::find(taken, slot) != taken.end()) {
+							break;
+						}
+						taken.push_back(slot);
+					}
+
+					if (taken.size() == buckets[bucket].size()) {
+						for (std::size_t i = 0; i < taken.size(); ++i) {
+							result.slots[taken[i]] = buckets[bucket][i];
+						}
+						result.seeds[bucket] = seed;
+						break;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		inline constexpr auto KEY_NAME_HASH = make_key_name_hash();
+
+		[[nodiscard]] constexpr std::string_view key_name(std::uint32_t a_keyCode) noexcept
+		{
+			if (a_keyCode >= KEY_CODE_NAMES.size() || KEY_CODE_NAMES[a_keyCode] == NO_KEY_NAME) {
+				return {};
+			}
+			return KEY_NAMES[KEY_CODE_NAMES[a_keyCode]].name;
+		}
+
+		[[nodiscard]] constexpr std::uint32_t key_code(std::string_view a_name) noexcept
+		{
+			const auto key = KEY_NAME_HASH.find(a_name);
+			if (!key) {
+				return InputMap::kMaxMacros;
+			}
+			return key->keyCode;
+		}
+
+		// exhaustively checks every mapping against its inverse
+		consteval bool verify_input_map()
+		{
+			for (const auto& button : GAMEPAD_BUTTONS) {
+				if (xinput_to_keycode(button.xinput) != button.keyCode || keycode_to_xinput(button.keyCode) != button.xinput) {
+					return false;
+				}
+				if (button.scePad != 0 &&
+					(translate_mask(GAMEPAD_TABLES.xinputToScePad, button.xinput) != button.scePad ||
+						translate_mask(GAMEPAD_TABLES.scePadToXInput, button.scePad) != button.xinput)) {
+					return false;
+				}
+			}
+
+			for (std::uint32_t bit = 0; bit < 32; ++bit) {
+				const auto mask = 1u << bit;
+				const auto scePad = translate_mask(GAMEPAD_TABLES.xinputToScePad, mask);
+				if (scePad != mask && translate_mask(GAMEPAD_TABLES.scePadToXInput, scePad) != mask) {
+					return false;
+				}
+				const auto keyCode = xinput_to_keycode(mask);
+				if (keyCode != InputMap::kMaxMacros && keycode_to_xinput(keyCode) != mask) {
+					return false;
+				}
+			}
+
+			for (const auto& key : KEY_NAMES) {
+				if (key_code(key.name) != key.keyCode) {
+					return false;
+				}
+			}
+
+			for (std::uint32_t keyCode = 0; keyCode < InputMap::kMaxMacros; ++keyCode) {
+				if (const auto name = key_name(keyCode); !name.empty() && key_code(name) != keyCode) {
+					return false;
+				}
+			}
+
+			return key_code("escape") == REX::W32::DIK_ESCAPE && key_code("ESCAPEE") == InputMap::kMaxMacros && key_code("") == InputMap::kMaxMacros;
 		}
+
+		static_assert(verify_input_map());
+	}
+
+	std::uint32_t InputMap::XInputToScePadOffset(std::uint32_t keyMask)
+	{
+		return detail::translate_mask(detail::GAMEPAD_TABLES.xinputToScePad, keyMask);
 	}
 
 	std::uint32_t InputMap::ScePadOffsetToXInput(std::uint32_t keyMask)
 	{
-		switch (keyMask) {
-			case REX::PS4::SCE_PAD_BUTTON_UP:
-				return REX::W32::XINPUT_GAMEPAD_DPAD_UP;
-			case REX::PS4::SCE_PAD_BUTTON_DOWN:
-				return REX::W32::XINPUT_GAMEPAD_DPAD_DOWN;
-			case REX::PS4::SCE_PAD_BUTTON_LEFT:
-				return REX::W32::XINPUT_GAMEPAD_DPAD_LEFT;
-			case REX::PS4::SCE_PAD_BUTTON_RIGHT:
-				return REX::W32::XINPUT_GAMEPAD_DPAD_RIGHT;
-			case REX::PS4::SCE_PAD_BUTTON_OPTIONS:
-				return REX::W32::XINPUT_GAMEPAD_START;
-			case REX::PS4::SCE_PAD_BUTTON_TOUCH_PAD:
-				return REX::W32::XINPUT_GAMEPAD_BACK;
-			case REX::PS4::SCE_PAD_BUTTON_L3:
-				return REX::W32::XINPUT_GAMEPAD_LEFT_THUMB;
-			case REX::PS4::SCE_PAD_BUTTON_R3:
-				return REX::W32::XINPUT_GAMEPAD_RIGHT_THUMB;
-			case REX::PS4::SCE_PAD_BUTTON_L1:
-				return REX::W32::XINPUT_GAMEPAD_LEFT_SHOULDER;
-			case REX::PS4::SCE_PAD_BUTTON_R1:
-				return REX::W32::XINPUT_GAMEPAD_RIGHT_SHOULDER;
-			case REX::PS4::SCE_PAD_BUTTON_CROSS:
-				return REX::W32::XINPUT_GAMEPAD_A;
-			case REX::PS4::SCE_PAD_BUTTON_CIRCLE:
-				return REX::W32::XINPUT_GAMEPAD_B;
-			case REX::PS4::SCE_PAD_BUTTON_SQUARE:
-				return REX::W32::XINPUT_GAMEPAD_X;
-			case REX::PS4::SCE_PAD_BUTTON_TRIANGLE:
-				return REX::W32::XINPUT_GAMEPAD_Y;
-			default:
-				return keyMask;
-		}
+		return detail::translate_mask(detail::GAMEPAD_TABLES.scePadToXInput, keyMask);
 	}
 
+#ifndef F4SE_TEST_SUITE
 	std::uint32_t InputMap::GamepadMaskToKeycode(std::uint32_t keyMask)
 	{
 		if (RE::ControlMap::GetSingleton()->pcGamePadMapType == RE::PC_GAMEPAD_TYPE::kOrbis) {
 			keyMask = ScePadOffsetToXInput(keyMask);
 		}
 
-		switch (keyMask) {
-			case REX::W32::XINPUT_GAMEPAD_DPAD_UP:
-				return kGamepadButtonOffset_DPAD_UP;
-			case REX::W32::XINPUT_GAMEPAD_DPAD_DOWN:
-				return kGamepadButtonOffset_DPAD_DOWN;
-			case REX::W32::XINPUT_GAMEPAD_DPAD_LEFT:
-				return kGamepadButtonOffset_DPAD_LEFT;
-			case REX::W32::XINPUT_GAMEPAD_DPAD_RIGHT:
-				return kGamepadButtonOffset_DPAD_RIGHT;
-			case REX::W32::XINPUT_GAMEPAD_START:
-				return kGamepadButtonOffset_START;
-			case REX::W32::XINPUT_GAMEPAD_BACK:
-				return kGamepadButtonOffset_BACK;
-			case REX::W32::XINPUT_GAMEPAD_LEFT_THUMB:
-				return kGamepadButtonOffset_LEFT_THUMB;
-			case REX::W32::XINPUT_GAMEPAD_RIGHT_THUMB:
-				return kGamepadButtonOffset_RIGHT_THUMB;
-			case REX::W32::XINPUT_GAMEPAD_LEFT_SHOULDER:
-				return kGamepadButtonOffset_LEFT_SHOULDER;
-			case REX::W32::XINPUT_GAMEPAD_RIGHT_SHOULDER:
-				return kGamepadButtonOffset_RIGHT_SHOULDER;
-			case REX::W32::XINPUT_GAMEPAD_A:
-				return kGamepadButtonOffset_A;
-			case REX::W32::XINPUT_GAMEPAD_B:
-				return kGamepadButtonOffset_B;
-			case REX::W32::XINPUT_GAMEPAD_X:
-				return kGamepadButtonOffset_X;
-			case REX::W32::XINPUT_GAMEPAD_Y:
-				return kGamepadButtonOffset_Y;
-			case 0x9: // Left Trigger game-defined ID
-				return kGamepadButtonOffset_LT;
-			case 0xA: // Right Trigger game-defined ID
-				return kGamepadButtonOffset_RT;
-			default:
-				return kMaxMacros; // Invalid
-		}
+		return detail::xinput_to_keycode(keyMask);
 	}
 
 	std::uint32_t InputMap::GamepadKeycodeToMask(std::uint32_t keyCode)
 	{
-		std::uint32_t keyMask;
-
-		switch (keyCode) {
-			case kGamepadButtonOffset_DPAD_UP:
-				keyMask = REX::W32::XINPUT_GAMEPAD_DPAD_UP;
-				break;
-			case kGamepadButtonOffset_DPAD_DOWN:
-				keyMask = REX::W32::XINPUT_GAMEPAD_DPAD_DOWN;
-				break;
-			case kGamepadButtonOffset_DPAD_LEFT:
-				keyMask = REX::W32::XINPUT_GAMEPAD_DPAD_LEFT;
-				break;
-			case kGamepadButtonOffset_DPAD_RIGHT:
-				keyMask = REX::W32::XINPUT_GAMEPAD_DPAD_RIGHT;
-				break;
-			case kGamepadButtonOffset_START:
-				keyMask = REX::W32::XINPUT_GAMEPAD_START;
-				break;
-			case kGamepadButtonOffset_BACK:
-				keyMask = REX::W32::XINPUT_GAMEPAD_BACK;
-				break;
-			case kGamepadButtonOffset_LEFT_THUMB:
-				keyMask = REX::W32::XINPUT_GAMEPAD_LEFT_THUMB;
-				break;
-			case kGamepadButtonOffset_RIGHT_THUMB:
-				keyMask = REX::W32::XINPUT_GAMEPAD_RIGHT_THUMB;
-				break;
-			case kGamepadButtonOffset_LEFT_SHOULDER:
-				keyMask = REX::W32::XINPUT_GAMEPAD_LEFT_SHOULDER;
-				break;
-			case kGamepadButtonOffset_RIGHT_SHOULDER:
-				keyMask = REX::W32::XINPUT_GAMEPAD_RIGHT_SHOULDER;
-				break;
-			case kGamepadButtonOffset_A:
-				keyMask = REX::W32::XINPUT_GAMEPAD_A;
-				break;
-			case kGamepadButtonOffset_B:
-				keyMask = REX::W32::XINPUT_GAMEPAD_B;
-				break;
-			case kGamepadButtonOffset_X:
-				keyMask = REX::W32::XINPUT_GAMEPAD_X;
-				break;
-			case kGamepadButtonOffset_Y:
-				keyMask = REX::W32::XINPUT_GAMEPAD_Y;
-				break;
-			case kGamepadButtonOffset_LT:
-				keyMask = 0x9; // Left Trigger game-defined ID
-				break;
-			case kGamepadButtonOffset_RT:
-				keyMask = 0xA; // Right Trigger game-defined ID
-				break;
-			default:
-				keyMask = 0xFF; // Invalid
-				break;
-		}
-
+		auto keyMask = detail::keycode_to_xinput(keyCode);
 		if (RE::ControlMap::GetSingleton()->pcGamePadMapType == RE::PC_GAMEPAD_TYPE::kOrbis) {
 			keyMask = XInputToScePadOffset(keyMask);
 		}
 
 		return keyMask;
 	}
+#endif
+
+	std::string_view InputMap::GetKeyName(std::uint32_t keyCode)
+	{
+		return detail::key_name(keyCode);
+	}
+
+	std::uint32_t InputMap::GetKeyCode(std::string_view keyName)
+	{
+		return detail::key_code(keyName);
+	}
 }
@@ -0,0 +1,247 @@
+#include "F4SE/JobSystem.hpp"
+
+#include "F4SE/Logger.hpp"
+
+namespace F4SE
+{
+	namespace detail
+	{
+		inline constexpr auto NOT_A_WORKER = std::numeric_limits<std::size_t>::max();
+
+		thread_local std::size_t worker_index{ NOT_A_WORKER };
+	}
+
+	JobSystem& JobSystem::get() noexcept
+	{
+		// intentionally leaked, so no static destructor joins the workers under the loader lock
+		static const auto singleton = new JobSystem();
+		return *singleton;
+	}
+
+	void JobSystem::start(std::size_t a_workers)
+	{
+		const std::scoped_lock lifecycle{ _lifecycleLock };
+		const std::scoped_lock guard{ _injectedLock };
+		if (_running.load(std::memory_order_relaxed)) {
+			return;
+		}
+
+		if (a_workers == 0) {
+			a_workers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+		}
+
+		_running.store(true, std::memory_order_relaxed);
+		_workers.clear();
+		for (std::size_t i = 0; i < a_workers; ++i) {
+			_workers.push_back(std::make_unique<worker_t>());
+		}
+		for (std::size_t i = 0; i < a_workers; ++i) {
+			_workers[i]->thread = std::thread([this, i]() { worker_main(i); });
+		}
+	}
+
+	void JobSystem::stop()
+	{
+		// a start racing this waits until the old workers are joined
+		const std::scoped_lock lifecycle{ _lifecycleLock };
+		{
+			const std::scoped_lock guard{ _injectedLock };
+			if (!_running.exchange(false)) {
+				return;
+			}
+		}
+
+		_wake.notify_all();
+		for (auto& worker : _workers) {
+			if (worker->thread.joinable()) {
+				worker->thread.join();
+			}
+		}
+		_workers.clear();
+	}
+
+	void JobSystem::submit(job_type a_job, JobPriority a_priority)
+	{
+		// a worker submitting while the pool stops queues its job for itself, which it runs before exiting
+		if (detail::worker_index == detail::NOT_A_WORKER && !_running.load(std::memory_order_acquire)) {
+			start();
+		}
+
+		const auto lane = static_cast<std::size_t>(a_priority);
+		const auto job = new job_t(std::move(a_job));
+		_queued.fetch_add(1);
+
+		// jobs spawned by a worker stay on its own deque, where idle workers can steal them
+		const auto worker = detail::worker_index;
+		if (worker == detail::NOT_A_WORKER || !_workers[worker]->lanes[lane].push(job)) {
+			const std::scoped_lock guard{ _injectedLock };
+			_injected[lane].push_back(job);
+		}
+		else {
+			// pairs with the predicate check in worker_main, so the wake up cannot be lost
+			const std::scoped_lock guard{ _injectedLock };
+		}
+
+		_wake.notify_one();
+	}
+
+	void JobSystem::submit_main(job_type a_job, JobPriority a_priority)
+	{
+		const std::scoped_lock guard{ _mainLock };
+		_main[static_cast<std::size_t>(a_priority)].push_back(std::move(a_job));
+		request_frame();
+	}
+
+	void JobSystem::set_executor(CoroutineExecutor& a_executor) noexcept
+	{
+		const std::scoped_lock guard{ _mainLock };
+		_executor = std::addressof(a_executor);
+	}
+
+	void JobSystem::run_frame()
+	{
+		const auto now = _now.load(std::memory_order_relaxed);
+		const auto start = now();
+		const auto budget = std::chrono::microseconds(_budget.load(std::memory_order_relaxed));
+		{
+			const std::scoped_lock guard{ _mainLock };
+			_framePosted = false;
+		}
+
+		std::uint64_t ran = 0;
+		for (;;) {
+			job_type job;
+			{
+				const std::scoped_lock guard{ _mainLock };
+				const auto lane = std::ranges::find_if(_main, [](const auto& a_lane) { return !a_lane.empty(); });
+				if (lane == _main.end()) {
+					break;
+				}
+
+				job = std::move(lane->front());
+				lane->pop_front();
+			}
+
+			try {
+				job();
+			} catch (const std::exception& e) {
+				log::error("unhandled exception in main thread job: {}"sv, e.what());
+			} catch (...) {
+				log::error("unhandled exception in main thread job"sv);
+			}
+			++ran;
+
+			if (now() - start >= budget) {
+				break;
+			}
+		}
+
+		const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now() - start);
+
+		const std::scoped_lock guard{ _mainLock };
+		++_stats.frames;
+		_stats.mainJobs += ran;
+		if (elapsed > budget) {
+			++_stats.overruns;
+			// only new worst cases are logged, so a sustained overload does not flood the log
+			if (elapsed > _stats.worstFrame) {
+				log::warn("main thread jobs overran their {}us budget: {}us"sv, budget.count(), elapsed.count());
+			}
+		}
+		_stats.worstFrame = std::max(_stats.worstFrame, elapsed);
+
+		if (std::ranges::any_of(_main, [](const auto& a_lane) { return !a_lane.empty(); })) {
+			request_frame();
+		}
+	}
+
+	auto JobSystem::stats() const
+		-> Stats
+	{
+		const std::scoped_lock guard{ _mainLock };
+		auto result = _stats;
+		result.workerJobs = _workerJobs.load(std::memory_order_relaxed);
+		result.steals = _steals.load(std::memory_order_relaxed);
+		return result;
+	}
+
+	auto JobSystem::find_work(std::size_t a_worker)
+		-> job_t*
+	{
+		// only the deques are lock free, the shared injection queue is checked under its mutex per lane
+		auto& self = *_workers[a_worker];
+		for (std::size_t lane = 0; lane < LANES; ++lane) {
+			if (const auto job = self.lanes[lane].pop()) {
+				return job;
+			}
+
+			{
+				const std::scoped_lock guard{ _injectedLock };
+				if (auto& injected = _injected[lane]; !injected.empty()) {
+					const auto job = injected.front();
+					injected.pop_front();
+					return job;
+				}
+			}
+
+			for (std::size_t i = 1; i < _workers.size(); ++i) {
+				auto& victim = *_workers[(a_worker + i) % _workers.size()];
+				if (const auto job = victim.lanes[lane].steal()) {
+					_steals.fetch_add(1, std::memory_order_relaxed);
+					return job;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	void JobSystem::worker_main(std::size_t a_worker)
+	{
+		detail::worker_index = a_worker;
+
+		for (;;) {
+			if (const auto job = find_work(a_worker)) {
+				_queued.fetch_sub(1);
+				execute(job);
+				continue;
+			}
+
+			std::unique_lock lock{ _injectedLock };
+			if (!_running.load(std::memory_order_relaxed) && _queued.load() == 0) {
+				break;
+			}
+
+			// submit notifies under _injectedLock, so the predicate cannot miss a job
+			_wake.wait(lock, [&]() {
+				return _queued.load() > 0 || !_running.load(std::memory_order_relaxed);
+			});
+		}
+
+		detail::worker_index = detail::NOT_A_WORKER;
+	}
+
+	void JobSystem::execute(job_t* a_job)
+	{
+		try {
+			(*a_job)();
+		} catch (const std::exception& e) {
+			log::error("unhandled exception in job: {}"sv, e.what());
+		} catch (...) {
+			log::error("unhandled exception in job"sv);
+		}
+
+		delete a_job;
+		_workerJobs.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// expects _mainLock to be held
+	void JobSystem::request_frame()
+	{
+		if (!_framePosted) {
+			_framePosted = true;
+			auto& executor = _executor ? *_executor : CoroutineExecutor::get();
+			executor.post([this]() { run_frame(); });
+		}
+	}
+}
@@ -1,4 +1,6 @@
 #include "F4SE/Logger.hpp"
+
+#ifndef F4SE_TEST_SUITE
 #include "F4SE/API.hpp"
 #include "F4SE/Interfaces.hpp"
 
@@ -7,9 +9,141 @@
 
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/msvc_sink.h>
+#endif
 
 namespace F4SE::log
 {
+	namespace detail
+	{
+		inline constexpr std::size_t RATE_LIMIT_SLOTS = 1u << 12;
+
+		std::array<rate_limit_t, RATE_LIMIT_SLOTS> rate_limits;
+		std::atomic<std::int64_t> rate_limit_period{ 1000 };
+		std::atomic<std::int64_t> rate_limit_sweep{ 0 };
+
+		[[nodiscard]] std::int64_t rate_limit_now() noexcept
+		{
+			return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		rate_limit_t* rate_limit_slot(const std::source_location& a_loc) noexcept
+		{
+			// file names are pooled literals, so their addresses identify the file
+			auto key = reinterpret_cast<std::uint64_t>(a_loc.file_name()) * 0x9E3779B97F4A7C15;
+			key ^= (static_cast<std::uint64_t>(a_loc.line()) << 20 | a_loc.column()) * 0xC2B2AE3D27D4EB4F;
+			key |= 1;
+
+			for (std::size_t i = 0; i < RATE_LIMIT_SLOTS; ++i) {
+				auto& slot = rate_limits[(key + i) & (RATE_LIMIT_SLOTS - 1)];
+				auto current = slot.key.load(std::memory_order_acquire);
+				if (current == 0 && slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+					slot.file.store(a_loc.file_name(), std::memory_order_relaxed);
+					slot.function.store(a_loc.function_name(), std::memory_order_relaxed);
+					slot.line.store(a_loc.line(), std::memory_order_relaxed);
+					slot.window.store(rate_limit_now(), std::memory_order_relaxed);
+					return std::addressof(slot);
+				}
+				if (current == key) {
+					return std::addressof(slot);
+				}
+			}
+
+			// the table is full, so this call site goes unlimited
+			return nullptr;
+		}
+
+		void rate_limit_summary(const rate_limit_t& a_slot, spdlog::level::level_enum a_level, std::uint32_t a_suppressed)
+		{
+			spdlog::log(
+				spdlog::source_loc{
+					a_slot.file.load(std::memory_order_relaxed),
+					static_cast<int>(a_slot.line.load(std::memory_order_relaxed)),
+					a_slot.function.load(std::memory_order_relaxed) },
+				a_level,
+				"previous message suppressed {} times",
+				a_suppressed);
+		}
+
+		// rolls over a site which went quiet after exceeding its budget, the count is zeroed since no call is being logged
+		void rate_limit_drain(rate_limit_t& a_slot, std::int64_t a_now, bool a_force)
+		{
+			if (a_slot.key.load(std::memory_order_acquire) == 0) {
+				return;
+			}
+
+			const auto logged = rate_limit_budget.load(std::memory_order_relaxed);
+			if (a_slot.count.load(std::memory_order_relaxed) <= logged) {
+				return;
+			}
+
+			auto window = a_slot.window.load(std::memory_order_relaxed);
+			if ((!a_force && a_now - window < rate_limit_period.load(std::memory_order_relaxed)) ||
+				!a_slot.window.compare_exchange_strong(window, a_now, std::memory_order_relaxed)) {
+				return;
+			}
+
+			const auto count = a_slot.count.exchange(0, std::memory_order_relaxed);
+			if (count > logged) {
+				rate_limit_summary(a_slot, a_slot.level.load(std::memory_order_relaxed), count - logged);
+			}
+		}
+
+		// sweeps at most once per period, so a burst which stops is still reported by the next site over budget
+		void rate_limit_sweep_quiet(std::int64_t a_now, const rate_limit_t& a_caller)
+		{
+			auto last = rate_limit_sweep.load(std::memory_order_relaxed);
+			if (a_now - last < rate_limit_period.load(std::memory_order_relaxed) ||
+				!rate_limit_sweep.compare_exchange_strong(last, a_now, std::memory_order_relaxed)) {
+				return;
+			}
+
+			// the caller rolls itself over, and counts the call being made as logged rather than suppressed
+			for (auto& slot : rate_limits) {
+				if (std::addressof(slot) != std::addressof(a_caller)) {
+					rate_limit_drain(slot, a_now, false);
+				}
+			}
+		}
+
+		bool rate_limit_slow(rate_limit_t& a_slot, const std::source_location&, spdlog::level::level_enum a_level)
+		{
+			a_slot.level.store(a_level, std::memory_order_relaxed);
+
+			const auto now = rate_limit_now();
+			rate_limit_sweep_quiet(now, a_slot);
+
+			auto window = a_slot.window.load(std::memory_order_relaxed);
+			if (now - window < rate_limit_period.load(std::memory_order_relaxed) ||
+				!a_slot.window.compare_exchange_strong(window, now, std::memory_order_relaxed)) {
+				return false;
+			}
+
+			// the count spans every call since the last roll over, of which the first budget were logged
+			const auto count = a_slot.count.exchange(1, std::memory_order_relaxed);
+			const auto logged = rate_limit_budget.load(std::memory_order_relaxed) + 1;
+			if (count > logged) {
+				rate_limit_summary(a_slot, a_level, count - logged);
+			}
+
+			return true;
+		}
+	}
+
+	void set_rate_limit(std::uint32_t a_count, std::chrono::milliseconds a_period) noexcept
+	{
+		detail::rate_limit_budget.store(a_count, std::memory_order_relaxed);
+		detail::rate_limit_period.store(a_period.count(), std::memory_order_relaxed);
+	}
+
+	void flush_rate_limits()
+	{
+		const auto now = detail::rate_limit_now();
+		for (auto& slot : detail::rate_limits) {
+			detail::rate_limit_drain(slot, now, true);
+		}
+	}
+
+#ifndef F4SE_TEST_SUITE
 	std::optional<std::filesystem::path> log_directory()
 	{
 		wchar_t* buffer{ nullptr };
@@ -48,5 +182,12 @@ namespace F4SE::log
 #endif
 		spdlog::set_default_logger(std::move(logger));
 		spdlog::set_pattern("[%T.%e] [%l] %v");
+
+		// registered after the registry exists, so it runs before the registry is torn down
+		static std::once_flag flushAtExit;
+		std::call_once(flushAtExit, [] {
+			std::atexit([] { flush_rate_limits(); });
+		});
 	}
+#endif
 }
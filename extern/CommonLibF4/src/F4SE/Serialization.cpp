@@ -0,0 +1,379 @@
+#include "F4SE/Serialization.hpp"
+
+#include "F4SE/Logger.hpp"
+
+namespace F4SE
+{
+	namespace detail
+	{
+		struct compressed_record_header_t
+		{
+			std::uint8_t codec;
+			std::uint8_t pad01;
+			std::uint16_t pad02;
+			std::uint32_t rawLength;
+		};
+		static_assert(sizeof(compressed_record_header_t) == 0x8);
+
+		namespace lz
+		{
+			inline constexpr std::size_t MIN_MATCH = 4;
+			inline constexpr std::size_t MAX_OFFSET = 0xFFFF;
+			inline constexpr std::size_t HASH_BITS = 12;
+
+			[[nodiscard]] inline std::uint32_t load32(const std::byte* a_src) noexcept
+			{
+				std::uint32_t result;
+				std::memcpy(std::addressof(result), a_src, sizeof(result));
+				return result;
+			}
+
+			[[nodiscard]] inline std::uint32_t hash(std::uint32_t a_sequence) noexcept
+			{
+				return (a_sequence * 2654435761u) >> (32 - HASH_BITS);
+			}
+
+			inline void write_length(std::vector<std::byte>& a_dst, std::size_t a_length)
+			{
+				for (; a_length >= 0xFF; a_length -= 0xFF) {
+					a_dst.push_back(std::byte{ 0xFF });
+				}
+				a_dst.push_back(static_cast<std::byte>(a_length));
+			}
+
+			[[nodiscard]] inline bool read_length(const std::byte*& a_src, const std::byte* a_end, std::size_t& a_length) noexcept
+			{
+				for (std::byte next{ 0xFF }; next == std::byte{ 0xFF };) {
+					if (a_src == a_end) {
+						return false;
+					}
+					next = *a_src++;
+					a_length += std::to_integer<std::size_t>(next);
+				}
+				return true;
+			}
+
+			void write_sequence(std::vector<std::byte>& a_dst, std::span<const std::byte> a_literals, std::size_t a_offset, std::size_t a_match)
+			{
+				const auto literals = a_literals.size();
+				const auto match = a_match == 0 ? 0 : a_match - MIN_MATCH;
+				a_dst.push_back(static_cast<std::byte>((std::min<std::size_t>(literals, 15) << 4) | std::min<std::size_t>(match, 15)));
+				if (literals >= 15) {
+					write_length(a_dst, literals - 15);
+				}
+
+				a_dst.insert(a_dst.end(), a_literals.begin(), a_literals.end());
+
+				// the final sequence carries literals only
+				if (a_match != 0) {
+					a_dst.push_back(static_cast<std::byte>(a_offset & 0xFF));
+					a_dst.push_back(static_cast<std::byte>(a_offset >> 8));
+					if (match >= 15) {
+						write_length(a_dst, match - 15);
+					}
+				}
+			}
+		}
+
+		void lz_compress(std::span<const std::byte> a_src, std::vector<std::byte>& a_dst)
+		{
+			constexpr auto NONE = std::numeric_limits<std::uint32_t>::max();
+
+			a_dst.clear();
+			a_dst.reserve(a_src.size() + a_src.size() / 255 + 16);
+
+			std::array<std::uint32_t, 1u << lz::HASH_BITS> table;
+			table.fill(NONE);
+
+			const auto src = a_src.data();
+			const auto size = a_src.size();
+			std::size_t anchor = 0;
+			std::size_t pos = 0;
+			while (pos + lz::MIN_MATCH <= size) {
+				const auto sequence = lz::load32(src + pos);
+				auto& slot = table[lz::hash(sequence)];
+				const auto candidate = slot;
+				slot = static_cast<std::uint32_t>(pos);
+
+				if (candidate == NONE || pos - candidate > lz::MAX_OFFSET || lz::load32(src + candidate) != sequence) {
+					++pos;
+					continue;
+				}
+
+				auto length = lz::MIN_MATCH;
+				while (pos + length < size && src[candidate + length] == src[pos + length]) {
+					++length;
+				}
+
+				lz::write_sequence(a_dst, a_src.subspan(anchor, pos - anchor), pos - candidate, length);
+				pos += length;
+				anchor = pos;
+			}
+
+			lz::write_sequence(a_dst, a_src.subspan(anchor), 0, 0);
+		}
+
+		bool lz_decompress(std::span<const std::byte> a_src, std::span<std::byte> a_dst) noexcept
+		{
+			auto ip = a_src.data();
+			const auto iend = ip + a_src.size();
+			auto op = a_dst.data();
+			const auto oend = op + a_dst.size();
+
+			while (ip != iend) {
+				const auto token = std::to_integer<std::size_t>(*ip++);
+
+				std::size_t literals = token >> 4;
+				if (literals == 15 && !lz::read_length(ip, iend, literals)) {
+					return false;
+				}
+				if (literals > static_cast<std::size_t>(iend - ip) || literals > static_cast<std::size_t>(oend - op)) {
+					return false;
+				}
+
+				if (literals != 0) {
+					std::memcpy(op, ip, literals);
+				}
+				ip += literals;
+				op += literals;
+
+				if (ip == iend) {
+					break;
+				}
+
+				if (iend - ip < 2) {
+					return false;
+				}
+				const auto offset = std::to_integer<std::size_t>(ip[0]) | (std::to_integer<std::size_t>(ip[1]) << 8);
+				ip += 2;
+
+				std::size_t match = token & 0xF;
+				if (match == 15 && !lz::read_length(ip, iend, match)) {
+					return false;
+				}
+				match += lz::MIN_MATCH;
+
+				if (offset == 0 || offset > static_cast<std::size_t>(op - a_dst.data()) || match > static_cast<std::size_t>(oend - op)) {
+					return false;
+				}
+
+				// matches may overlap their own output, so copy forwards one byte at a time
+				for (auto from = op - offset; match > 0; --match) {
+					*op++ = *from++;
+				}
+			}
+
+			return op == oend;
+		}
+	}
+
+	bool WriteCompressedRecord(
+		const SerializationInterface& a_intfc,
+		std::uint32_t a_type,
+		std::uint32_t a_version,
+		std::span<const std::byte> a_data,
+		RecordCodec a_codec,
+		std::size_t a_threshold)
+	{
+		if (a_data.size() > std::numeric_limits<std::uint32_t>::max() - sizeof(detail::compressed_record_header_t)) {
+			log::warn("record is too large to write ({}B)"sv, a_data.size());
+			return false;
+		}
+
+		detail::compressed_record_header_t header{};
+		header.codec = static_cast<std::uint8_t>(RecordCodec::kNone);
+		header.rawLength = static_cast<std::uint32_t>(a_data.size());
+
+		std::vector<std::byte> compressed;
+		if (a_codec == RecordCodec::kLZ && a_data.size() >= a_threshold) {
+			detail::lz_compress(a_data, compressed);
+			if (compressed.size() < a_data.size()) {
+				header.codec = static_cast<std::uint8_t>(RecordCodec::kLZ);
+				a_data = compressed;
+			}
+		}
+
+		return a_intfc.OpenRecord(a_type, a_version) &&
+		       a_intfc.WriteRecordData(header) &&
+		       a_intfc.WriteRecordData(a_data.data(), static_cast<std::uint32_t>(a_data.size()));
+	}
+
+	std::optional<std::vector<std::byte>> ReadCompressedRecord(const SerializationInterface& a_intfc, std::uint32_t a_length)
+	{
+		detail::compressed_record_header_t header{};
+		if (a_length < sizeof(header) || a_intfc.ReadRecordData(header) != sizeof(header)) {
+			return std::nullopt;
+		}
+
+		std::vector<std::byte> body(a_length - sizeof(header));
+		if (a_intfc.ReadRecordData(body.data(), static_cast<std::uint32_t>(body.size())) != body.size()) {
+			return std::nullopt;
+		}
+
+		switch (static_cast<RecordCodec>(header.codec)) {
+			case RecordCodec::kNone:
+				if (body.size() != header.rawLength) {
+					log::warn("uncompressed record is {}B, expected {}B"sv, body.size(), header.rawLength);
+					return std::nullopt;
+				}
+				return body;
+			case RecordCodec::kLZ: {
+				// a body byte decodes to at most 255 bytes, so a corrupt length is caught before it is allocated
+				if (header.rawLength > body.size() * 255 + 16) {
+					log::warn("compressed record of {}B claims {}B"sv, body.size(), header.rawLength);
+					return std::nullopt;
+				}
+
+				std::vector<std::byte> result(header.rawLength);
+				if (!detail::lz_decompress(body, result)) {
+					log::warn("failed to decompress record"sv);
+					return std::nullopt;
+				}
+				return result;
+			}
+			default:
+				log::warn("unknown record codec {}"sv, header.codec);
+				return std::nullopt;
+		}
+	}
+
+	RecordWriter::RecordWriter(const SerializationInterface& a_intfc, std::uint32_t a_type, std::uint32_t a_version) :
+		_intfc(a_intfc),
+		_good(a_intfc.OpenRecord(a_type, a_version))
+	{
+		_buffer.reserve(CHUNK_SIZE);
+	}
+
+	bool RecordWriter::flush()
+	{
+		if (_good && !_buffer.empty()) {
+			_good = _intfc.WriteRecordData(_buffer.data(), static_cast<std::uint32_t>(_buffer.size()));
+		}
+
+		_buffer.clear();
+		return _good;
+	}
+
+	bool RecordWriter::write(const void* a_buf, std::size_t a_length)
+	{
+		if (!_good) {
+			return false;
+		}
+
+		if (_buffer.size() + a_length > CHUNK_SIZE && !flush()) {
+			return false;
+		}
+
+		const auto bytes = static_cast<const std::byte*>(a_buf);
+		if (a_length >= CHUNK_SIZE) {
+			// large writes skip the buffer entirely
+			for (std::size_t offset = 0; _good && offset < a_length; offset += std::numeric_limits<std::uint32_t>::max()) {
+				const auto length = std::min<std::size_t>(a_length - offset, std::numeric_limits<std::uint32_t>::max());
+				_good = _intfc.WriteRecordData(bytes + offset, static_cast<std::uint32_t>(length));
+			}
+			return _good;
+		}
+
+		_buffer.insert(_buffer.end(), bytes, bytes + a_length);
+		return true;
+	}
+
+	RecordReader::RecordReader(const SerializationInterface& a_intfc, std::uint32_t a_length) :
+		_intfc(a_intfc),
+		_unread(a_length)
+	{
+		_buffer.reserve(std::min<std::size_t>(a_length, CHUNK_SIZE));
+	}
+
+	bool RecordReader::read(void* a_buf, std::size_t a_length)
+	{
+		if (!_good) {
+			return false;
+		}
+
+		if (a_length > remaining()) {
+			log::warn("record read of {}B overruns the {}B left in the record"sv, a_length, remaining());
+			_good = false;
+			return false;
+		}
+
+		auto out = static_cast<std::byte*>(a_buf);
+		const auto buffered = std::min(a_length, _buffer.size() - _pos);
+		std::memcpy(out, _buffer.data() + _pos, buffered);
+		_pos += buffered;
+		out += buffered;
+		a_length -= buffered;
+
+		if (a_length == 0) {
+			return true;
+		}
+
+		// large reads go straight into the destination
+		if (a_length >= CHUNK_SIZE) {
+			const auto read = _intfc.ReadRecordData(out, static_cast<std::uint32_t>(a_length));
+			_unread -= read;
+			_good = read == a_length;
+			return _good;
+		}
+
+		if (!refill(a_length)) {
+			return false;
+		}
+
+		std::memcpy(out, _buffer.data(), a_length);
+		_pos = a_length;
+		return true;
+	}
+
+	bool RecordReader::read_string(std::string& a_string)
+	{
+		std::size_t length = 0;
+		if (!read_varint(length)) {
+			return false;
+		}
+
+		if (length > remaining()) {
+			_good = false;
+			return false;
+		}
+
+		a_string.resize(length);
+		return read(a_string.data(), length);
+	}
+
+	std::size_t RecordReader::resolve_form_ids(std::span<RE::TESFormID> a_formIDs) const
+	{
+		std::unordered_map<RE::TESFormID, RE::TESFormID> resolved;
+		std::size_t count = 0;
+		for (auto& formID : a_formIDs) {
+			if (formID == 0) {
+				continue;
+			}
+
+			auto [it, inserted] = resolved.try_emplace(formID, 0);
+			if (inserted) {
+				it->second = _intfc.ResolveFormID(formID).value_or(0);
+			}
+
+			formID = it->second;
+			if (formID != 0) {
+				++count;
+			}
+		}
+
+		return count;
+	}
+
+	bool RecordReader::refill(std::size_t a_length)
+	{
+		const auto length = std::min(std::max(a_length, CHUNK_SIZE), _unread);
+		_buffer.resize(length);
+		_pos = 0;
+
+		const auto read = _intfc.ReadRecordData(_buffer.data(), static_cast<std::uint32_t>(length));
+		_unread -= read;
+		_buffer.resize(read);
+		_good = read == length;
+		return _good;
+	}
+}
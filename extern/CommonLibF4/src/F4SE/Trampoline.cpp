@@ -2,7 +2,12 @@
 
 #include "F4SE/Logger.hpp"
 
+#ifndef F4SE_TEST_SUITE
 #include "REX/W32/KERNEL32.hpp"
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 // xbyak brings in <Windows.h>
 #ifdef F4SE_SUPPORT_XBYAK
@@ -38,8 +43,223 @@ namespace F4SE
 			const auto remainder = a_number % a_multiple;
 			return remainder == 0 ? a_number : a_number - remainder;
 		}
+
+#ifndef F4SE_TEST_SUITE
+		class VirtualAddressSpace :
+			public AddressSpace
+		{
+		public:
+			VirtualAddressSpace() noexcept
+			{
+				REX::W32::SYSTEM_INFO si{};
+				REX::W32::GetSystemInfo(std::addressof(si));
+				_granularity = si.allocationGranularity;
+			}
+
+			[[nodiscard]] std::size_t granularity() const noexcept override { return _granularity; }
+
+			[[nodiscard]] std::optional<region_t> query(std::uintptr_t a_address) const noexcept override
+			{
+				REX::W32::MEMORY_BASIC_INFORMATION mbi{};
+				if (!REX::W32::VirtualQuery(reinterpret_cast<void*>(a_address), std::addressof(mbi), sizeof(mbi))) {
+					log::error("VirtualQuery failed with code: 0x{:08X}"sv, REX::W32::GetLastError());
+					return std::nullopt;
+				}
+
+				return region_t{
+					reinterpret_cast<std::uintptr_t>(mbi.baseAddress),
+					mbi.regionSize,
+					mbi.state == REX::W32::MEM_FREE
+				};
+			}
+
+			[[nodiscard]] void* allocate(std::uintptr_t a_address, std::size_t a_size) noexcept override
+			{
+				const auto mem = REX::W32::VirtualAlloc(
+					reinterpret_cast<void*>(a_address), a_size, REX::W32::MEM_COMMIT | REX::W32::MEM_RESERVE, REX::W32::PAGE_EXECUTE_READWRITE);
+				if (!mem) {
+					log::warn("VirtualAlloc failed with code: 0x{:08X}"sv, REX::W32::GetLastError());
+				}
+				return mem;
+			}
+
+		private:
+			std::size_t _granularity{ 0x10000 };
+		};
+#else
+		// the host tests search the real address space through /proc/self/maps, and allocate with mmap hints
+		class MappedAddressSpace :
+			public AddressSpace
+		{
+		public:
+			MappedAddressSpace() noexcept :
+				_granularity(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)))
+			{
+			}
+
+			[[nodiscard]] std::size_t granularity() const noexcept override { return _granularity; }
+
+			[[nodiscard]] std::optional<region_t> query(std::uintptr_t a_address) const noexcept override
+			{
+				// nothing above the user half can be mapped, which also keeps out [vsyscall]
+				constexpr std::uintptr_t userEnd = std::uintptr_t{ 1 } << 47;
+				if (a_address >= userEnd) {
+					return region_t{ userEnd, 0 - userEnd, false };
+				}
+
+				std::ifstream maps{ "/proc/self/maps" };
+				if (!maps) {
+					log::error("failed to open /proc/self/maps"sv);
+					return std::nullopt;
+				}
+
+				// the lines are sorted by address, and the gaps between them are free
+				std::uintptr_t gap = 0;
+				for (std::string line; std::getline(maps, line);) {
+					std::uintptr_t begin{ 0 };
+					std::uintptr_t end{ 0 };
+					const auto last = line.data() + line.size();
+					const auto [dash, ec1] = std::from_chars(line.data(), last, begin, 16);
+					if (ec1 != std::errc{} || dash == last || *dash != '-') {
+						continue;
+					}
+					const auto [space, ec2] = std::from_chars(dash + 1, last, end, 16);
+					if (ec2 != std::errc{} || begin >= userEnd) {
+						break;
+					}
+
+					if (a_address < begin) {
+						return region_t{ gap, begin - gap, true };
+					}
+					if (a_address < end) {
+						return region_t{ begin, end - begin, false };
+					}
+					gap = end;
+				}
+
+				return region_t{ gap, userEnd - gap, true };
+			}
+
+			[[nodiscard]] void* allocate(std::uintptr_t a_address, std::size_t a_size) noexcept override
+			{
+				const auto mem = ::mmap(reinterpret_cast<void*>(a_address), a_size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (mem == MAP_FAILED) {
+					log::warn("mmap failed with errno: {}"sv, errno);
+					return nullptr;
+				}
+
+				// the address is only a hint, which the kernel moves away from anything already mapped there
+				if (reinterpret_cast<std::uintptr_t>(mem) != a_address) {
+					::munmap(mem, a_size);
+					return nullptr;
+				}
+
+				return mem;
+			}
+
+		private:
+			std::size_t _granularity{ 0x1000 };
+		};
+#endif
+	}
+
+	AddressSpace& AddressSpace::get() noexcept
+	{
+#ifndef F4SE_TEST_SUITE
+		static detail::VirtualAddressSpace singleton;
+#else
+		static detail::MappedAddressSpace singleton;
+#endif
+		return singleton;
+	}
+
+	// based on https://stackoverflow.com/a/54732489
+	void* NearRegionFinder::allocate(std::uintptr_t a_address, std::size_t a_size, std::size_t a_range)
+	{
+		constexpr std::uintptr_t maxAddr = std::numeric_limits<std::uintptr_t>::max();
+
+		const auto granularity = _space.granularity();
+		const std::uintptr_t min = a_address >= a_range ? detail::roundup(a_address - a_range, granularity) : 0;
+		const std::uintptr_t max = a_address < (maxAddr - a_range) ? detail::rounddown(a_address + a_range, granularity) : maxAddr;
+
+		const auto start = region(a_address);
+		if (!start) {
+			return nullptr;
+		}
+
+		if (const auto mem = place(*start, min, max, a_size, false)) {
+			return mem;
+		}
+
+		// the cursors sit on the outer edges of everything examined so far, and are cleared once a direction is exhausted
+		std::optional<std::uintptr_t> down = start->base > min ? std::make_optional(start->base) : std::nullopt;
+		std::optional<std::uintptr_t> up = start->base + start->size < max ? std::make_optional(start->base + start->size) : std::nullopt;
+		while (down || up) {
+			const auto goUp = !down || (up && *up - a_address <= a_address - *down);
+			auto& cursor = goUp ? up : down;
+
+			const auto next = region(goUp ? *up : *down - 1);
+			if (!next) {
+				cursor.reset();
+				continue;
+			}
+
+			if (goUp) {
+				const auto end = next->base + next->size;
+				up = end < max && end != 0 ? std::make_optional(end) : std::nullopt;
+			}
+			else {
+				down = next->base > min ? std::make_optional(next->base) : std::nullopt;
+			}
+
+			if (const auto mem = place(*next, min, max, a_size, !goUp)) {
+				return mem;
+			}
+		}
+
+		return nullptr;
+	}
+
+	auto NearRegionFinder::region(std::uintptr_t a_address)
+		-> std::optional<AddressSpace::region_t>
+	{
+		if (auto it = _regions.upper_bound(a_address); it != _regions.begin()) {
+			--it;
+			if (a_address - it->second.base < it->second.size) {
+				return it->second;
+			}
+		}
+
+		const auto result = _space.query(a_address);
+		if (result && result->size != 0) {
+			_regions.insert_or_assign(result->base, *result);
+		}
+
+		return result;
 	}
 
+	void* NearRegionFinder::place(const AddressSpace::region_t& a_region, std::uintptr_t a_min, std::uintptr_t a_max, std::size_t a_size, bool a_high)
+	{
+		if (!a_region.free || a_region.size < a_size) {
+			return nullptr;
+		}
+
+		// below the target the highest fitting address is the closest, above it the lowest
+		const auto granularity = _space.granularity();
+		const auto end = a_region.base + a_region.size;
+		const auto low = detail::roundup(std::max(a_region.base, a_min), granularity);
+		const auto addr = a_high ? detail::rounddown(end - a_size, granularity) : low;
+		if (addr < low || addr >= a_max || end - addr < a_size) {
+			return nullptr;
+		}
+
+		const auto mem = _space.allocate(addr, a_size);
+		// either the region is now split by our allocation, or it was stale to begin with
+		_regions.erase(a_region.base);
+		return mem;
+	}
+
+#ifndef F4SE_TEST_SUITE
 	void Trampoline::create(std::size_t a_size, void* a_module)
 	{
 		if (a_size == 0) {
@@ -60,63 +280,90 @@ namespace F4SE
 			REX::W32::VirtualFree(a_mem, 0, REX::W32::MEM_RELEASE);
 		});
 	}
+#endif
 
 #ifdef F4SE_SUPPORT_XBYAK
-	void* Trampoline::allocate(const Xbyak::CodeGenerator& a_code)
+	void* Trampoline::allocate(const Xbyak::CodeGenerator& a_code, std::source_location a_loc)
 	{
-		auto result = do_allocate(a_code.getSize());
+		auto result = do_allocate(a_code.getSize(), a_loc);
 		log_stats();
 		std::memcpy(result, a_code.getCode(), a_code.getSize());
 		return result;
 	}
 #endif
 
-	// https://stackoverflow.com/a/54732489
+#ifndef F4SE_TEST_SUITE
 	void* Trampoline::do_create(std::size_t a_size, std::uintptr_t a_address)
 	{
 		constexpr std::size_t gigabyte = static_cast<std::size_t>(1) << 30;
 		constexpr std::size_t minRange = gigabyte * 2;
-		constexpr std::uintptr_t maxAddr = std::numeric_limits<std::uintptr_t>::max();
 
-		REX::W32::SYSTEM_INFO si;
-		REX::W32::GetSystemInfo(&si);
-		const std::uint32_t granularity = si.allocationGranularity;
+		static std::mutex lock;
+		static NearRegionFinder finder{ AddressSpace::get() };
 
-		std::uintptr_t min = a_address >= minRange ? detail::roundup(a_address - minRange, granularity) : 0;
-		const std::uintptr_t max = a_address < (maxAddr - minRange) ? detail::rounddown(a_address + minRange, granularity) : maxAddr;
+		const std::scoped_lock guard{ lock };
+		return finder.allocate(a_address, a_size, minRange);
+	}
+#endif
 
-		REX::W32::MEMORY_BASIC_INFORMATION mbi;
-		do {
-			if (!REX::W32::VirtualQuery(reinterpret_cast<void*>(min), std::addressof(mbi), sizeof(mbi))) {
-				log::error("VirtualQuery failed with code: 0x{:08X}"sv, REX::W32::GetLastError());
-				return nullptr;
-			}
+	void* Trampoline::allocate_stub(std::span<const std::byte> a_code, std::source_location a_loc)
+	{
+		std::vector<std::byte> key(a_code.begin(), a_code.end());
+		if (const auto it = _stubs.find(key); it != _stubs.end()) {
+			++usage(a_loc).shared;
+			return it->second;
+		}
 
-			const auto baseAddr = reinterpret_cast<std::uintptr_t>(mbi.baseAddress);
-			min = baseAddr + mbi.regionSize;
+		const auto mem = static_cast<std::byte*>(do_allocate(a_code.size(), a_loc));
+		std::memcpy(mem, a_code.data(), a_code.size());
+		_stubs.emplace(std::move(key), mem);
+		log_stats();
 
-			if (mbi.state == REX::W32::MEM_FREE) {
-				const std::uintptr_t addr = detail::roundup(baseAddr, granularity);
+		return mem;
+	}
 
-				// if rounding didn't advance us into the next region and the region is the required size
-				if (addr < min && (min - addr) >= a_size) {
-					const auto mem = REX::W32::VirtualAlloc(
-						reinterpret_cast<void*>(addr), a_size, REX::W32::MEM_COMMIT | REX::W32::MEM_RESERVE, REX::W32::PAGE_EXECUTE_READWRITE);
-					if (mem) {
-						return mem;
-					}
-					log::warn("VirtualAlloc failed with code: 0x{:08X}"sv, REX::W32::GetLastError());
-				}
-			}
-		} while (min < max);
+	void Trampoline::deallocate(void* a_mem, std::size_t a_size)
+	{
+		const auto mem = static_cast<std::byte*>(a_mem);
+		if (!mem || a_size == 0) {
+			return;
+		}
 
-		return nullptr;
+		if (mem < _data || mem + a_size > _data + _size) {
+			stl::report_and_fail("deallocated memory does not belong to the trampoline"sv);
+		}
+
+		constexpr auto INT3 = static_cast<int>(0xCC);
+		std::memset(mem, INT3, a_size);
+		recycle(mem, a_size);
 	}
 
-	void* Trampoline::do_allocate(std::size_t a_size)
+	void* Trampoline::do_allocate(std::size_t a_size, const std::source_location& a_loc)
 	{
+		auto& caller = usage(a_loc);
+		++caller.allocations;
+		caller.bytes += a_size;
+
+		if (a_size == 0) {
+			return _data + _size;
+		}
+
+		if (const auto mem = reuse(a_size)) {
+			++caller.reused;
+			return mem;
+		}
+
 		if (a_size > free_size()) {
-			stl::report_and_fail("Failed to handle allocation request"sv);
+			log_callers(true);
+			stl::report_and_fail(
+				std::format(
+					"{}: failed to allocate {}B ({}B free, {}B reusable, {}B wasted)"sv,
+					_name,
+					a_size,
+					free_size(),
+					reusable_size(),
+					wasted_size()),
+				a_loc);
 		}
 
 		auto mem = _data + _size;
@@ -125,7 +372,51 @@ namespace F4SE
 		return mem;
 	}
 
-	void Trampoline::write_5branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_opcode)
+	std::byte* Trampoline::reuse(std::size_t a_size)
+	{
+		// first fit within the request's own class, then any block from a larger class is big enough
+		const auto first = size_class(a_size);
+		for (auto i = first; i < _freeBlocks.size(); ++i) {
+			auto& blocks = _freeBlocks[i];
+			const auto it = i == first ?
+			                    std::ranges::find_if(blocks, [&](const block_t& a_block) { return a_block.size >= a_size; }) :
+			                    blocks.empty() ? blocks.end() :
+			                                     std::prev(blocks.end());
+			if (it == blocks.end()) {
+				continue;
+			}
+
+			const auto block = *it;
+			blocks.erase(it);
+			_reusableSize -= block.size;
+
+			// hand back the tail if it can still hold an absolute branch target
+			if (const auto remainder = block.size - a_size; remainder >= sizeof(std::uintptr_t)) {
+				recycle(block.mem + a_size, remainder);
+			}
+			else {
+				_wastedSize += remainder;
+			}
+
+			return block.mem;
+		}
+
+		return nullptr;
+	}
+
+	void Trampoline::recycle(std::byte* a_mem, std::size_t a_size)
+	{
+		// blocks at the end of the bump region are simply given back to it
+		if (a_mem + a_size == _data + _size) {
+			_size -= a_size;
+			return;
+		}
+
+		_freeBlocks[size_class(a_size)].push_back(block_t{ a_mem, a_size });
+		_reusableSize += a_size;
+	}
+
+	void Trampoline::write_5branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_opcode, const std::source_location& a_loc)
 	{
 #pragma pack(push, 1)
 		struct SrcAssembly
@@ -158,9 +449,10 @@ namespace F4SE
 		TrampolineAssembly* mem = nullptr;
 		if (const auto it = _5branches.find(a_dst); it != _5branches.end()) {
 			mem = reinterpret_cast<TrampolineAssembly*>(it->second);
+			++usage(a_loc).shared;
 		}
 		else {
-			mem = allocate<TrampolineAssembly>();
+			mem = allocate<TrampolineAssembly>(a_loc);
 			_5branches.emplace(a_dst, reinterpret_cast<std::byte*>(mem));
 		}
 
@@ -182,7 +474,7 @@ namespace F4SE
 		mem->addr = static_cast<std::uint64_t>(a_dst);
 	}
 
-	void Trampoline::write_6branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_modrm)
+	void Trampoline::write_6branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_modrm, const std::source_location& a_loc)
 	{
 #pragma pack(push, 1)
 		struct Assembly
@@ -201,9 +493,10 @@ namespace F4SE
 		std::uintptr_t* mem = nullptr;
 		if (const auto it = _6branches.find(a_dst); it != _6branches.end()) {
 			mem = reinterpret_cast<std::uintptr_t*>(it->second);
+			++usage(a_loc).shared;
 		}
 		else {
-			mem = allocate<std::uintptr_t>();
+			mem = allocate<std::uintptr_t>(a_loc);
 			_6branches.emplace(a_dst, reinterpret_cast<std::byte*>(mem));
 		}
 
@@ -223,10 +516,38 @@ namespace F4SE
 		*mem = a_dst;
 	}
 
-	void Trampoline::log_stats() const
+	void Trampoline::log_stats(bool a_perCaller) const
+	{
+		auto pct = (static_cast<double>(allocated_size()) / static_cast<double>(_capacity)) * 100.0;
+		log::debug("{} => {}B / {}B ({:05.2f}%), {}B reusable, {}B wasted"sv, _name, allocated_size(), _capacity, pct, _reusableSize, _wastedSize);
+
+		if (a_perCaller) {
+			log_callers(false);
+		}
+	}
+
+	void Trampoline::log_callers(bool a_failed) const
 	{
-		auto pct = (static_cast<double>(_size) / static_cast<double>(_capacity)) * 100.0;
-		log::debug("{} => {}B / {}B ({:05.2f}%)"sv, _name, _size, _capacity, pct);
+		// one message for every caller, so the rate limit of a single call site never cuts the list short
+		std::string callers;
+		for (const auto& [caller, usage] : _callers) {
+			std::format_to(
+				std::back_inserter(callers),
+				"\n\t{}:{} => {}B in {} allocation(s), {} reused, {} shared"sv,
+				caller.first,
+				caller.second,
+				usage.bytes,
+				usage.allocations,
+				usage.reused,
+				usage.shared);
+		}
+
+		if (a_failed) {
+			log::error("{} callers:{}"sv, _name, callers);
+		}
+		else {
+			log::debug("{} callers:{}"sv, _name, callers);
+		}
 	}
 
 	Trampoline& GetTrampoline() noexcept
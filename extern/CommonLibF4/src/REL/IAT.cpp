@@ -1,6 +1,8 @@
 #include "REL/IAT.hpp"
+#ifndef F4SE_TEST_SUITE
 #include "REL/Module.hpp"
 #include "REL/Relocation.hpp"
+#endif
 
 #include "F4SE/Logger.hpp"
 
@@ -8,6 +10,7 @@
 
 namespace REL
 {
+#ifndef F4SE_TEST_SUITE
 	std::uintptr_t GetIATAddr(std::string_view a_dll, std::string_view a_function)
 	{
 		return reinterpret_cast<std::uintptr_t>(GetIATPtr(std::move(a_dll), std::move(a_function)));
@@ -23,45 +26,124 @@ namespace REL
 		const auto mod = static_cast<REX::W32::HMODULE>(REL::Module::get().pointer());
 		return GetIATPtr(mod, std::move(a_dll), std::move(a_function));
 	}
+#endif
 
-	// https://guidedhacking.com/attachments/pe_imptbl_headers-jpg.2241/
-	void* GetIATPtr(REX::W32::HMODULE a_module, std::string_view a_dll, std::string_view a_function)
+	namespace detail
 	{
-		assert(a_module);
-		const auto dosHeader = reinterpret_cast<REX::W32::IMAGE_DOS_HEADER*>(a_module);
-		if (dosHeader->magic != REX::W32::IMAGE_DOS_SIGNATURE) {
-			F4SE::log::error("Invalid DOS header"sv);
-			return nullptr;
+		[[nodiscard]] constexpr char ascii_tolower(char a_ch) noexcept
+		{
+			return ('A' <= a_ch && a_ch <= 'Z') ? static_cast<char>(a_ch - 'A' + 'a') : a_ch;
+		}
+
+		[[nodiscard]] constexpr bool iequals(std::string_view a_lhs, std::string_view a_rhs) noexcept
+		{
+			return std::ranges::equal(a_lhs, a_rhs, {}, ascii_tolower, ascii_tolower);
 		}
+	}
+
+	std::size_t ImportIndex::key_hash::operator()(const key_type& a_key) const noexcept
+	{
+		std::uint64_t result = 0xCBF29CE484222325ull;
+		const auto hash = [&](std::string_view a_str) noexcept {
+			for (const auto ch : a_str) {
+				result = (result ^ static_cast<std::uint8_t>(detail::ascii_tolower(ch))) * 0x100000001B3ull;
+			}
+		};
 
-		const auto ntHeader = stl::adjust_pointer<REX::W32::IMAGE_NT_HEADERS64>(dosHeader, dosHeader->lfanew);
-		const auto& dataDir = ntHeader->optionalHeader.dataDirectory[REX::W32::IMAGE_DIRECTORY_ENTRY_IMPORT];
-		const auto importDesc = stl::adjust_pointer<REX::W32::IMAGE_IMPORT_DESCRIPTOR>(dosHeader, dataDir.virtualAddress);
+		hash(a_key.first);
+		result = (result ^ 0xFF) * 0x100000001B3ull;
+		hash(a_key.second);
+		return static_cast<std::size_t>(result);
+	}
+
+	bool ImportIndex::key_equal::operator()(const key_type& a_lhs, const key_type& a_rhs) const noexcept
+	{
+		return detail::iequals(a_lhs.first, a_rhs.first) && detail::iequals(a_lhs.second, a_rhs.second);
+	}
+
+	// https://guidedhacking.com/attachments/pe_imptbl_headers-jpg.2241/
+	ImportIndex::ImportIndex(const PEImage& a_image)
+	{
+		const auto dataDir = a_image.data_directory(REX::W32::IMAGE_DIRECTORY_ENTRY_IMPORT);
+		if (!dataDir) {
+			return;
+		}
 
-		for (auto import = importDesc; import->characteristics != 0; ++import) {
-			auto name = stl::adjust_pointer<const char>(dosHeader, import->name);
-			if (a_dll.size() == strlen(name) && _strnicmp(a_dll.data(), name, a_dll.size()) != 0) {
-				continue;
+		constexpr auto DESC_SIZE = static_cast<std::uint32_t>(sizeof(REX::W32::IMAGE_IMPORT_DESCRIPTOR));
+		constexpr auto THUNK_SIZE = static_cast<std::uint32_t>(sizeof(REX::W32::IMAGE_THUNK_DATA64));
+		for (auto rva = dataDir->virtualAddress;; rva += DESC_SIZE) {
+			const auto import = a_image.rva_to<REX::W32::IMAGE_IMPORT_DESCRIPTOR>(rva);
+			// the lookup table may be missing, so the null descriptor is told by its name and address table
+			if (!import || import->name == 0 || import->firstThunk == 0) {
+				break;
 			}
 
-			const auto thunk = stl::adjust_pointer<REX::W32::IMAGE_THUNK_DATA64>(dosHeader, import->firstThunkOriginal);
-			for (std::size_t i = 0; thunk[i].ordinal; ++i) {
-				if (REX::W32::IMAGE_SNAP_BY_ORDINAL64(thunk[i].ordinal)) {
+			const auto dll = a_image.rva_to_string(import->name);
+			// the lookup table is optional, in which case names are read from the unbound address table
+			const auto lookup = import->firstThunkOriginal ? import->firstThunkOriginal : import->firstThunk;
+			for (std::uint32_t i = 0;; ++i) {
+				const auto thunk = a_image.rva_to<REX::W32::IMAGE_THUNK_DATA64>(lookup + i * THUNK_SIZE);
+				if (!thunk || thunk->ordinal == 0) {
+					break;
+				}
+
+				if ((thunk->ordinal & REX::W32::IMAGE_ORDINAL_FLAG64) != 0) {
 					continue;
 				}
 
-				const auto importByName = stl::adjust_pointer<REX::W32::IMAGE_IMPORT_BY_NAME>(dosHeader, thunk[i].address);
-				if (a_function.size() == strlen(importByName->name) &&
-					_strnicmp(a_function.data(), importByName->name, a_function.size()) == 0) {
-					return stl::adjust_pointer<REX::W32::IMAGE_THUNK_DATA64>(dosHeader, import->firstThunk) + i;
+				const auto name = a_image.rva_to_string(
+					static_cast<std::uint32_t>(thunk->address + offsetof(REX::W32::IMAGE_IMPORT_BY_NAME, name)));
+				if (!name.empty()) {
+					_thunks.try_emplace(key_type{ dll, name }, import->firstThunk + i * THUNK_SIZE);
 				}
 			}
 		}
+	}
+
+	std::optional<std::uint32_t> ImportIndex::find(std::string_view a_dll, std::string_view a_function) const noexcept
+	{
+		const auto it = _thunks.find(key_type{ a_dll, a_function });
+		return it != _thunks.end() ? std::make_optional(it->second) : std::nullopt;
+	}
+
+	const ImportIndex& ImportIndex::get(REX::W32::HMODULE a_module)
+	{
+		static std::shared_mutex lock;
+		static std::unordered_map<REX::W32::HMODULE, std::unique_ptr<ImportIndex>> indices;
+
+		{
+			const std::shared_lock guard{ lock };
+			if (const auto it = indices.find(a_module); it != indices.end()) {
+				return *it->second;
+			}
+		}
+
+		const std::unique_lock guard{ lock };
+		auto& index = indices[a_module];
+		if (!index) {
+			const PEImage image{ a_module };
+			if (!image.valid()) {
+				F4SE::log::error("Invalid PE image"sv);
+			}
+			index = std::make_unique<ImportIndex>(image);
+		}
+
+		return *index;
+	}
+
+	void* GetIATPtr(REX::W32::HMODULE a_module, std::string_view a_dll, std::string_view a_function)
+	{
+		assert(a_module);
+		const auto thunk = ImportIndex::get(a_module).find(a_dll, a_function);
+		if (!thunk) {
+			F4SE::log::warn("Failed to find {} ({})"sv, a_dll, a_function);
+			return nullptr;
+		}
 
-		F4SE::log::warn("Failed to find {} ({})"sv, a_dll, a_function);
-		return nullptr;
+		return reinterpret_cast<std::byte*>(a_module) + *thunk;
 	}
 
+#ifndef F4SE_TEST_SUITE
 	std::uintptr_t PatchIAT(std::uintptr_t a_newFunc, std::string_view a_dll, std::string_view a_function)
 	{
 		std::uintptr_t origAddr = 0;
@@ -77,4 +159,5 @@ namespace REL
 
 		return origAddr;
 	}
+#endif
 }
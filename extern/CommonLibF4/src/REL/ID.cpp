@@ -0,0 +1,66 @@
+#include "REL/ID.hpp"
+
+#include "F4SE/Logger.hpp"
+
+namespace REL
+{
+	void IDRegistry::add(std::span<const IDEntry> a_entries)
+	{
+		const std::scoped_lock guard{ _lock };
+		_tables.push_back(a_entries);
+	}
+
+	auto IDRegistry::validate() const
+		-> Report
+	{
+		const std::scoped_lock guard{ _lock };
+
+		struct lookup_t
+		{
+			std::uint64_t id;
+			const IDEntry* entry;
+		};
+
+		Report report;
+		std::vector<lookup_t> lookups;
+		for (const auto& table : _tables) {
+			report.checked += table.size();
+			for (const auto& entry : table) {
+				if (const auto variant = std::get_if<VariantID>(std::addressof(entry.id)); variant && Module::IsVR()) {
+					if (variant->offset() == 0) {
+						report.missing.push_back(std::addressof(entry));
+					}
+					continue;
+				}
+
+				const auto id = std::visit([](const auto& a_id) { return a_id.id(); }, entry.id);
+				if (id == 0) {
+					report.missing.push_back(std::addressof(entry));
+				}
+				else {
+					lookups.push_back({ id, std::addressof(entry) });
+				}
+			}
+		}
+
+		std::ranges::sort(lookups, {}, &lookup_t::id);
+
+		std::vector<std::uint64_t> ids(lookups.size());
+		std::ranges::transform(lookups, ids.begin(), &lookup_t::id);
+
+		const auto found = std::make_unique<bool[]>(ids.size());
+		IDDB::get().find_ids(ids, { found.get(), ids.size() });
+		for (std::size_t i = 0; i < lookups.size(); ++i) {
+			if (!found[i]) {
+				report.missing.push_back(lookups[i].entry);
+			}
+		}
+
+		const auto version = Module::get().version();
+		for (const auto entry : report.missing) {
+			F4SE::log::error("{} has no address library id for game version {}"sv, entry->name, version);
+		}
+
+		return report;
+	}
+}
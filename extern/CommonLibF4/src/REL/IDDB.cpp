@@ -152,6 +152,21 @@ namespace REL
 		return static_cast<std::size_t>(it->offset);
 	}
 
+	void IDDB::find_ids(std::span<const std::uint64_t> a_sortedIDs, std::span<bool> a_found) const noexcept
+	{
+		assert(a_sortedIDs.size() == a_found.size());
+		assert(std::ranges::is_sorted(a_sortedIDs));
+
+		// each search resumes where the last one ended, so the database is only walked forward once
+		auto it = _id2offset.begin();
+		for (std::size_t i = 0; i < a_sortedIDs.size(); ++i) {
+			it = std::lower_bound(it, _id2offset.end(), a_sortedIDs[i], [](auto&& a_lhs, auto&& a_rhs) {
+				return a_lhs.id < a_rhs;
+			});
+			a_found[i] = it != _id2offset.end() && it->id == a_sortedIDs[i];
+		}
+	}
+
 #ifdef ENABLE_FALLOUT_VR
 	bool IDDB::load_csv(std::string a_filename, Version, bool a_failOnError)
 	{
@@ -44,7 +44,11 @@ namespace REL
 
 	void Module::load_version()
 	{
-		const auto version = GetFileVersion(_filename);
+		auto version = GetFileVersion(pointer());
+		if (!version) {
+			version = GetFileVersion(_filename);
+		}
+
 		if (version) {
 			_version = *version;
 			switch (_version[1]) {
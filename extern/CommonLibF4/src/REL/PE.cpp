@@ -0,0 +1,110 @@
+#include "REL/PE.hpp"
+
+namespace REL
+{
+	PEImage::PEImage(std::span<const std::byte> a_data, Layout a_layout) noexcept :
+		_data(a_data),
+		_layout(a_layout)
+	{
+		if (_data.size() < sizeof(REX::W32::IMAGE_DOS_HEADER)) {
+			return;
+		}
+
+		const auto dosHeader = reinterpret_cast<const REX::W32::IMAGE_DOS_HEADER*>(_data.data());
+		if (dosHeader->magic != REX::W32::IMAGE_DOS_SIGNATURE || dosHeader->lfanew < 0 ||
+			static_cast<std::size_t>(dosHeader->lfanew) + sizeof(REX::W32::IMAGE_NT_HEADERS64) > _data.size()) {
+			return;
+		}
+
+		const auto ntHeader = reinterpret_cast<const REX::W32::IMAGE_NT_HEADERS64*>(_data.data() + dosHeader->lfanew);
+		if (ntHeader->signature != REX::W32::IMAGE_NT_SIGNATURE ||
+			ntHeader->optionalHeader.magic != REX::W32::IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+			return;
+		}
+
+		const auto sectionOffset =
+			static_cast<std::size_t>(dosHeader->lfanew) +
+			offsetof(REX::W32::IMAGE_NT_HEADERS64, optionalHeader) +
+			ntHeader->fileHeader.optionalHeaderSize;
+		const auto sectionCount = static_cast<std::size_t>(ntHeader->fileHeader.sectionCount);
+		if (sectionOffset + sectionCount * sizeof(REX::W32::IMAGE_SECTION_HEADER) > _data.size()) {
+			return;
+		}
+
+		_ntHeader = ntHeader;
+		_sections = {
+			reinterpret_cast<const REX::W32::IMAGE_SECTION_HEADER*>(_data.data() + sectionOffset),
+			sectionCount
+		};
+	}
+
+	PEImage::PEImage(REX::W32::HMODULE a_module) noexcept
+	{
+		assert(a_module);
+		const auto dosHeader = reinterpret_cast<const REX::W32::IMAGE_DOS_HEADER*>(a_module);
+		if (dosHeader->magic != REX::W32::IMAGE_DOS_SIGNATURE) {
+			return;
+		}
+
+		const auto ntHeader = stl::adjust_pointer<REX::W32::IMAGE_NT_HEADERS64>(dosHeader, dosHeader->lfanew);
+		*this = PEImage(
+			{ reinterpret_cast<const std::byte*>(a_module), ntHeader->optionalHeader.imageSize },
+			Layout::kMapped);
+	}
+
+	const REX::W32::IMAGE_DATA_DIRECTORY* PEImage::data_directory(std::uint32_t a_index) const noexcept
+	{
+		if (!valid() || a_index >= _ntHeader->optionalHeader.rvaAndSizesCount ||
+			a_index >= REX::W32::IMAGE_NUMBEROF_DIRECTORY_ENTRIES) {
+			return nullptr;
+		}
+
+		const auto& dataDir = _ntHeader->optionalHeader.dataDirectory[a_index];
+		return dataDir.virtualAddress != 0 && dataDir.size != 0 ? std::addressof(dataDir) : nullptr;
+	}
+
+	std::optional<std::size_t> PEImage::rva_to_offset(std::uint32_t a_rva, std::size_t a_size) const noexcept
+	{
+		if (!valid()) {
+			return std::nullopt;
+		}
+
+		const auto inBounds = [&](std::size_t a_offset, std::size_t a_limit) noexcept {
+			return a_offset <= a_limit && a_size <= a_limit - a_offset;
+		};
+
+		if (_layout == Layout::kMapped || a_rva < _ntHeader->optionalHeader.headersSize) {
+			return inBounds(a_rva, _data.size()) ? std::make_optional<std::size_t>(a_rva) : std::nullopt;
+		}
+
+		for (const auto& section : _sections) {
+			const auto size = std::max(section.virtualSize, section.rawDataSize);
+			if (a_rva < section.virtualAddress || a_rva - section.virtualAddress >= size) {
+				continue;
+			}
+
+			const auto delta = static_cast<std::size_t>(a_rva - section.virtualAddress);
+			if (!inBounds(delta, section.rawDataSize)) {
+				return std::nullopt;
+			}
+
+			const auto offset = static_cast<std::size_t>(section.rawDataPtr) + delta;
+			return inBounds(offset, _data.size()) ? std::make_optional(offset) : std::nullopt;
+		}
+
+		return std::nullopt;
+	}
+
+	std::string_view PEImage::rva_to_string(std::uint32_t a_rva) const noexcept
+	{
+		const auto offset = rva_to_offset(a_rva);
+		if (!offset) {
+			return {};
+		}
+
+		const auto first = reinterpret_cast<const char*>(_data.data() + *offset);
+		const auto last = reinterpret_cast<const char*>(_data.data() + _data.size());
+		const auto end = std::find(first, last, '\0');
+		return end != last ? std::string_view(first, end) : std::string_view{};
+	}
+}
@@ -0,0 +1,288 @@
+#include "REL/Patch.hpp"
+
+#ifndef F4SE_TEST_SUITE
+#include "REX/W32/KERNEL32.hpp"
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace REL
+{
+	namespace detail
+	{
+#ifndef F4SE_TEST_SUITE
+		class VirtualMemoryProtection :
+			public MemoryProtection
+		{
+		public:
+			VirtualMemoryProtection() noexcept
+			{
+				REX::W32::SYSTEM_INFO info{};
+				REX::W32::GetSystemInfo(std::addressof(info));
+				_pageSize = info.pageSize;
+			}
+
+			[[nodiscard]] std::size_t page_size() const noexcept override { return _pageSize; }
+
+			[[nodiscard]] std::size_t extent(std::uintptr_t a_address) const noexcept override
+			{
+				REX::W32::MEMORY_BASIC_INFORMATION mbi{};
+				if (REX::W32::VirtualQuery(reinterpret_cast<const void*>(a_address), std::addressof(mbi), sizeof(mbi)) == 0) {
+					return 0;
+				}
+
+				return reinterpret_cast<std::uintptr_t>(mbi.baseAddress) + mbi.regionSize - a_address;
+			}
+
+			bool unprotect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t& a_old) noexcept override
+			{
+				return REX::W32::VirtualProtect(
+					reinterpret_cast<void*>(a_address), a_size, REX::W32::PAGE_EXECUTE_READWRITE, std::addressof(a_old));
+			}
+
+			bool protect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection) noexcept override
+			{
+				std::uint32_t old{ 0 };
+				return REX::W32::VirtualProtect(
+					reinterpret_cast<void*>(a_address), a_size, a_protection, std::addressof(old));
+			}
+
+		private:
+			std::size_t _pageSize{ 0x1000 };
+		};
+
+		using DefaultMemoryProtection = VirtualMemoryProtection;
+#else
+		// the host tests patch real pages through mprotect, reading protections back from /proc/self/maps
+		class PageMemoryProtection :
+			public MemoryProtection
+		{
+		public:
+			PageMemoryProtection() noexcept :
+				_pageSize(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)))
+			{
+			}
+
+			[[nodiscard]] std::size_t page_size() const noexcept override { return _pageSize; }
+
+			[[nodiscard]] std::size_t extent(std::uintptr_t a_address) const noexcept override
+			{
+				const auto region = query(a_address);
+				return region ? region->end - a_address : 0;
+			}
+
+			bool unprotect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t& a_old) noexcept override
+			{
+				const auto region = query(a_address);
+				if (!region) {
+					return false;
+				}
+
+				a_old = region->protection;
+				return ::mprotect(reinterpret_cast<void*>(a_address), a_size, static_cast<int>(a_old) | PROT_READ | PROT_WRITE) == 0;
+			}
+
+			bool protect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection) noexcept override
+			{
+				return ::mprotect(reinterpret_cast<void*>(a_address), a_size, static_cast<int>(a_protection)) == 0;
+			}
+
+		private:
+			struct region_t
+			{
+				std::uintptr_t end;
+				std::uint32_t protection;
+			};
+
+			// each line starts "begin-end rwxp", in hex
+			[[nodiscard]] static std::optional<region_t> query(std::uintptr_t a_address) noexcept
+			{
+				const auto file = std::fopen("/proc/self/maps", "r");
+				if (!file) {
+					return std::nullopt;
+				}
+
+				std::optional<region_t> result;
+				std::array<char, 512> line{};
+				while (!result && std::fgets(line.data(), static_cast<int>(line.size()), file)) {
+					std::uintptr_t begin{ 0 };
+					std::uintptr_t end{ 0 };
+					const auto last = line.data() + std::strlen(line.data());
+					const auto [dash, ec1] = std::from_chars(line.data(), last, begin, 16);
+					if (ec1 != std::errc{} || *dash != '-') {
+						continue;
+					}
+					const auto [space, ec2] = std::from_chars(dash + 1, last, end, 16);
+					if (ec2 != std::errc{} || last - space < 4 || a_address < begin || a_address >= end) {
+						continue;
+					}
+
+					std::uint32_t protection = PROT_NONE;
+					protection |= space[1] == 'r' ? PROT_READ : 0;
+					protection |= space[2] == 'w' ? PROT_WRITE : 0;
+					protection |= space[3] == 'x' ? PROT_EXEC : 0;
+					result = region_t{ end, protection };
+				}
+
+				std::fclose(file);
+				return result;
+			}
+
+			std::size_t _pageSize;
+		};
+
+		using DefaultMemoryProtection = PageMemoryProtection;
+#endif
+	}
+
+	MemoryProtection& MemoryProtection::get() noexcept
+	{
+		static detail::DefaultMemoryProtection singleton;
+		return singleton;
+	}
+
+	void PatchTransaction::write(std::uintptr_t a_dst, const void* a_src, std::size_t a_count)
+	{
+		if (a_count == 0) {
+			return;
+		}
+
+		const auto src = static_cast<const std::uint8_t*>(a_src);
+		_patches.push_back(patch_t{ a_dst, { src, src + a_count }, {} });
+		_committed = false;
+	}
+
+	void PatchTransaction::fill(std::uintptr_t a_dst, std::uint8_t a_value, std::size_t a_count)
+	{
+		if (a_count == 0) {
+			return;
+		}
+
+		_patches.push_back(patch_t{ a_dst, std::vector<std::uint8_t>(a_count, a_value), {} });
+		_committed = false;
+	}
+
+	template <class F>
+	bool PatchTransaction::apply(bool a_applied, F&& a_func)
+	{
+		auto ranges = merge(a_applied);
+		if (ranges.empty()) {
+			return true;
+		}
+
+		std::size_t unprotected = 0;
+		for (; unprotected < ranges.size(); ++unprotected) {
+			auto& range = ranges[unprotected];
+			if (!_protection->unprotect(range.address, range.size, range.protection)) {
+				break;
+			}
+		}
+
+		const auto success = unprotected == ranges.size();
+		if (success) {
+			for (auto& patch : _patches) {
+				if (patch.applied == a_applied) {
+					a_func(patch);
+				}
+			}
+		}
+
+		for (std::size_t i = 0; i < unprotected; ++i) {
+			const auto& range = ranges[i];
+			[[maybe_unused]] const auto restored = _protection->protect(range.address, range.size, range.protection);
+			assert(restored);
+		}
+
+		return success;
+	}
+
+	bool PatchTransaction::commit()
+	{
+		if (_committed) {
+			return true;
+		}
+
+		const auto success = apply(false, [](patch_t& a_patch) {
+			const auto dst = reinterpret_cast<std::uint8_t*>(a_patch.address);
+			a_patch.original.assign(dst, dst + a_patch.bytes.size());
+			std::memcpy(dst, a_patch.bytes.data(), a_patch.bytes.size());
+			a_patch.applied = true;
+		});
+
+		if (success) {
+			_committed = true;
+		}
+
+		return success;
+	}
+
+	bool PatchTransaction::rollback()
+	{
+		if (std::ranges::none_of(_patches, &patch_t::applied)) {
+			return false;
+		}
+
+		// restore in reverse so overlapping patches unwind correctly
+		std::ranges::reverse(_patches);
+		const auto success = apply(true, [](patch_t& a_patch) {
+			std::memcpy(reinterpret_cast<void*>(a_patch.address), a_patch.original.data(), a_patch.original.size());
+			a_patch.applied = false;
+		});
+		std::ranges::reverse(_patches);
+
+		if (success) {
+			_committed = false;
+		}
+
+		return success;
+	}
+
+	auto PatchTransaction::merge(bool a_applied) const
+		-> std::vector<range_t>
+	{
+		const auto pageSize = _protection->page_size();
+		const auto pageMask = ~(static_cast<std::uintptr_t>(pageSize) - 1);
+
+		std::vector<range_t> pages;
+		pages.reserve(_patches.size());
+		for (const auto& patch : _patches) {
+			if (patch.applied != a_applied) {
+				continue;
+			}
+
+			const auto begin = patch.address & pageMask;
+			const auto end = (patch.address + patch.bytes.size() + pageSize - 1) & pageMask;
+			pages.push_back(range_t{ begin, end - begin, 0 });
+		}
+
+		std::ranges::sort(pages, {}, &range_t::address);
+
+		std::vector<range_t> merged;
+		for (const auto& page : pages) {
+			if (!merged.empty() && page.address <= merged.back().address + merged.back().size) {
+				auto& back = merged.back();
+				back.size = std::max(back.address + back.size, page.address + page.size) - back.address;
+			}
+			else {
+				merged.push_back(page);
+			}
+		}
+
+		// a single protection change may only cover pages which currently share the same protection
+		std::vector<range_t> result;
+		result.reserve(merged.size());
+		for (const auto& range : merged) {
+			auto address = range.address;
+			const auto end = range.address + range.size;
+			while (address < end) {
+				const auto extent = _protection->extent(address);
+				const auto size = extent == 0 ? end - address : std::min(extent, end - address);
+				result.push_back(range_t{ address, size, 0 });
+				address += size;
+			}
+		}
+
+		return result;
+	}
+}
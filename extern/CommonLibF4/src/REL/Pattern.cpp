@@ -0,0 +1,110 @@
+#include "REL/Pattern.hpp"
+
+namespace REL
+{
+	namespace detail
+	{
+		struct pattern_cache_header_t
+		{
+			std::uint32_t magic;
+			std::uint32_t version;
+			std::uint64_t count;
+		};
+
+		inline constexpr std::uint32_t PATTERN_CACHE_MAGIC = 0x504C4552; // 'RELP'
+	}
+
+#ifndef F4SE_TEST_SUITE
+	PatternCache::PatternCache(std::filesystem::path a_path) :
+		PatternCache(std::move(a_path), Module::get().version().pack())
+	{
+	}
+#endif
+
+	PatternCache::PatternCache(std::filesystem::path a_path, std::uint32_t a_version) :
+		_path(std::move(a_path)),
+		_version(a_version)
+	{
+		std::error_code ec;
+		const auto fileSize = std::filesystem::file_size(_path, ec);
+		if (ec || fileSize < sizeof(detail::pattern_cache_header_t)) {
+			return;
+		}
+
+		std::ifstream file(_path, std::ios::in | std::ios::binary);
+		if (!file) {
+			return;
+		}
+
+		detail::pattern_cache_header_t header{};
+		if (!file.read(reinterpret_cast<char*>(std::addressof(header)), sizeof(header)) ||
+			header.magic != detail::PATTERN_CACHE_MAGIC ||
+			header.version != _version) {
+			return;
+		}
+
+		// the count is only trusted once the file is known to hold exactly that many entries
+		const auto payload = fileSize - sizeof(header);
+		if (payload % sizeof(entry_t) != 0 || header.count != payload / sizeof(entry_t)) {
+			return;
+		}
+
+		_entries.resize(static_cast<std::size_t>(header.count));
+		if (!file.read(reinterpret_cast<char*>(_entries.data()), static_cast<std::streamsize>(_entries.size() * sizeof(entry_t)))) {
+			_entries.clear();
+			return;
+		}
+
+		std::ranges::sort(_entries, {}, &entry_t::hash);
+	}
+
+	std::optional<std::size_t> PatternCache::find(std::uint64_t a_hash) const noexcept
+	{
+		const auto it = std::ranges::lower_bound(_entries, a_hash, {}, &entry_t::hash);
+		if (it == _entries.end() || it->hash != a_hash) {
+			return std::nullopt;
+		}
+
+		return static_cast<std::size_t>(it->offset);
+	}
+
+	void PatternCache::insert(std::uint64_t a_hash, std::size_t a_offset)
+	{
+		const auto it = std::ranges::lower_bound(_entries, a_hash, {}, &entry_t::hash);
+		if (it != _entries.end() && it->hash == a_hash) {
+			it->offset = a_offset;
+		}
+		else {
+			_entries.insert(it, entry_t{ a_hash, a_offset });
+		}
+
+		_dirty = true;
+	}
+
+	bool PatternCache::save()
+	{
+		if (!_dirty) {
+			return true;
+		}
+
+		std::ofstream file(_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file) {
+			return false;
+		}
+
+		const detail::pattern_cache_header_t header{
+			.magic = detail::PATTERN_CACHE_MAGIC,
+			.version = _version,
+			.count = _entries.size()
+		};
+
+		file.write(reinterpret_cast<const char*>(std::addressof(header)), sizeof(header));
+		file.write(reinterpret_cast<const char*>(_entries.data()), static_cast<std::streamsize>(_entries.size() * sizeof(entry_t)));
+		if (!file) {
+			return false;
+		}
+
+		_dirty = false;
+		return true;
+	}
+}
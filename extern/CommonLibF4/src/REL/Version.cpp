@@ -1,9 +1,185 @@
 #include "REL/Version.hpp"
+#include "REL/PE.hpp"
 
 #include "REX/W32/VERSION.hpp"
 
 namespace REL
 {
+	namespace detail
+	{
+		template <class CharT>
+		[[nodiscard]] std::optional<Version> parse_version(std::basic_string_view<CharT> a_version) noexcept
+		{
+			std::array<char, 64> buf{};
+			std::size_t len = 0;
+			for (const auto ch : a_version) {
+				if (ch == CharT{ 0 }) {
+					break;
+				}
+				if (len == buf.size() || static_cast<std::make_unsigned_t<CharT>>(ch) > 0x7F) {
+					return std::nullopt;
+				}
+				buf[len++] = static_cast<char>(ch);
+			}
+
+			Version version;
+			const char* first = buf.data();
+			const auto last = buf.data() + len;
+			for (std::size_t i = 0; i < 4 && first != last; ++i) {
+				while (first != last && *first == ' ') {
+					++first;
+				}
+
+				const auto [ptr, ec] = std::from_chars(first, last, version[i]);
+				if (ec != std::errc{}) {
+					return i == 0 ? std::nullopt : std::make_optional(version);
+				}
+
+				first = ptr;
+				while (first != last && *first == ' ') {
+					++first;
+				}
+				if (first != last && *first != '.' && *first != ',') {
+					break;
+				}
+				if (first != last) {
+					++first;
+				}
+			}
+
+			return version;
+		}
+
+		struct version_node_t
+		{
+			std::u16string_view key;
+			std::span<const std::byte> value;
+			std::size_t children;
+			std::size_t end;
+		};
+
+		[[nodiscard]] constexpr std::size_t align_dword(std::size_t a_offset) noexcept
+		{
+			return (a_offset + 3) & ~static_cast<std::size_t>(3);
+		}
+
+		// offsets are relative to the start of the resource, which is what padding is aligned against
+		[[nodiscard]] std::optional<version_node_t> read_version_node(std::span<const std::byte> a_block, std::size_t a_offset) noexcept
+		{
+			struct header_t
+			{
+				std::uint16_t length;
+				std::uint16_t valueLength;
+				std::uint16_t type;
+			};
+
+			if (a_offset + sizeof(header_t) > a_block.size()) {
+				return std::nullopt;
+			}
+
+			header_t header{};
+			std::memcpy(std::addressof(header), a_block.data() + a_offset, sizeof(header));
+			if (header.length < sizeof(header_t) || a_offset + header.length > a_block.size()) {
+				return std::nullopt;
+			}
+
+			const auto end = a_offset + header.length;
+			const auto key = a_offset + sizeof(header_t);
+			auto pos = key;
+			for (char16_t ch = 1; ch != u'\0'; pos += sizeof(char16_t)) {
+				if (pos + sizeof(char16_t) > end) {
+					return std::nullopt;
+				}
+				std::memcpy(std::addressof(ch), a_block.data() + pos, sizeof(char16_t));
+			}
+
+			version_node_t node{};
+			node.key = { reinterpret_cast<const char16_t*>(a_block.data() + key), (pos - key) / sizeof(char16_t) - 1 };
+			node.end = end;
+
+			pos = std::min(align_dword(pos), end);
+			const std::size_t valueSize = header.type == 1 ? header.valueLength * sizeof(char16_t) : header.valueLength;
+			node.value = a_block.subspan(pos, std::min(valueSize, end - pos));
+			node.children = std::min(align_dword(pos + node.value.size()), end);
+
+			return node;
+		}
+
+		template <class F>
+		void for_each_version_child(std::span<const std::byte> a_block, const version_node_t& a_parent, F&& a_func) noexcept
+		{
+			auto pos = a_parent.children;
+			while (pos < a_parent.end) {
+				const auto child = read_version_node(a_block.first(a_parent.end), pos);
+				if (!child || !a_func(*child)) {
+					break;
+				}
+				pos = align_dword(child->end);
+			}
+		}
+
+		[[nodiscard]] std::span<const std::byte> find_version_resource(const PEImage& a_image) noexcept
+		{
+			const auto dataDir = a_image.data_directory(REX::W32::IMAGE_DIRECTORY_ENTRY_RESOURCE);
+			if (!dataDir) {
+				return {};
+			}
+
+			const auto root = dataDir->virtualAddress;
+			// walks one level of the type -> name -> language tree, taking the first entry when no id is given
+			const auto findEntry = [&](std::uint32_t a_offset, std::optional<std::uint32_t> a_id) -> std::optional<std::uint32_t> {
+				const auto directory = a_image.rva_to<REX::W32::IMAGE_RESOURCE_DIRECTORY>(root + a_offset);
+				if (!directory) {
+					return std::nullopt;
+				}
+
+				const auto count = static_cast<std::size_t>(directory->namedEntryCount) + directory->idEntryCount;
+				const auto entries = a_image.rva_to<REX::W32::IMAGE_RESOURCE_DIRECTORY_ENTRY>(
+					root + a_offset + static_cast<std::uint32_t>(sizeof(REX::W32::IMAGE_RESOURCE_DIRECTORY)),
+					count);
+				if (!entries) {
+					return std::nullopt;
+				}
+
+				for (const auto& entry : std::span{ entries, count }) {
+					if (!a_id || ((entry.name & REX::W32::IMAGE_RESOURCE_NAME_IS_STRING) == 0 && entry.name == *a_id)) {
+						return entry.offsetToData;
+					}
+				}
+
+				return std::nullopt;
+			};
+
+			const auto isDirectory = [](std::uint32_t a_offset) noexcept {
+				return (a_offset & REX::W32::IMAGE_RESOURCE_DATA_IS_DIRECTORY) != 0;
+			};
+
+			const auto type = findEntry(0, REX::W32::RT_VERSION);
+			if (!type || !isDirectory(*type)) {
+				return {};
+			}
+
+			const auto name = findEntry(*type & ~REX::W32::IMAGE_RESOURCE_DATA_IS_DIRECTORY, std::nullopt);
+			if (!name || !isDirectory(*name)) {
+				return {};
+			}
+
+			const auto language = findEntry(*name & ~REX::W32::IMAGE_RESOURCE_DATA_IS_DIRECTORY, std::nullopt);
+			if (!language || isDirectory(*language)) {
+				return {};
+			}
+
+			const auto dataEntry = a_image.rva_to<REX::W32::IMAGE_RESOURCE_DATA_ENTRY>(root + *language);
+			if (!dataEntry) {
+				return {};
+			}
+
+			const auto data = a_image.rva_to<std::byte>(dataEntry->offsetToData, dataEntry->size);
+			return data ? std::span{ data, dataEntry->size } : std::span<const std::byte>{};
+		}
+	}
+
+#ifndef F4SE_TEST_SUITE
 	std::optional<Version> GetFileVersion(std::string_view a_filename)
 	{
 		std::uint32_t dummy;
@@ -22,14 +198,7 @@ namespace REL
 			return std::nullopt;
 		}
 
-		Version version;
-		std::wistringstream ss(std::wstring(static_cast<const wchar_t*>(verBuf), verLen));
-		std::wstring token;
-		for (std::size_t i = 0; i < 4 && std::getline(ss, token, L'.'); ++i) {
-			version[i] = static_cast<std::uint16_t>(std::stoi(token));
-		}
-
-		return version;
+		return detail::parse_version(std::string_view(static_cast<const char*>(verBuf), verLen));
 	}
 
 	std::optional<Version> GetFileVersion(std::wstring_view a_filename)
@@ -50,13 +219,65 @@ namespace REL
 			return std::nullopt;
 		}
 
-		Version version;
-		std::wistringstream ss(std::wstring(static_cast<const wchar_t*>(verBuf), verLen));
-		std::wstring token;
-		for (std::size_t i = 0; i < 4 && std::getline(ss, token, L'.'); ++i) {
-			version[i] = static_cast<std::uint16_t>(std::stoi(token));
+		return detail::parse_version(std::wstring_view(static_cast<const wchar_t*>(verBuf), verLen));
+	}
+#endif
+
+	std::optional<Version> GetFileVersion(const PEImage& a_image) noexcept
+	{
+		const auto block = detail::find_version_resource(a_image);
+		const auto root = detail::read_version_node(block, 0);
+		if (!root || root->key != u"VS_VERSION_INFO"sv) {
+			return std::nullopt;
+		}
+
+		std::optional<Version> result;
+		detail::for_each_version_child(block, *root, [&](const detail::version_node_t& a_fileInfo) {
+			if (a_fileInfo.key != u"StringFileInfo"sv) {
+				return true;
+			}
+
+			// prefer the U.S. English/Unicode table, which is what the file-based lookup queries
+			std::optional<detail::version_node_t> table;
+			detail::for_each_version_child(block, a_fileInfo, [&](const detail::version_node_t& a_table) {
+				if (!table || a_table.key == u"040904B0"sv || a_table.key == u"040904b0"sv) {
+					table = a_table;
+				}
+				return a_table.key != u"040904B0"sv && a_table.key != u"040904b0"sv;
+			});
+
+			if (table) {
+				detail::for_each_version_child(block, *table, [&](const detail::version_node_t& a_string) {
+					if (a_string.key != u"ProductVersion"sv) {
+						return true;
+					}
+					result = detail::parse_version(std::u16string_view(
+						reinterpret_cast<const char16_t*>(a_string.value.data()),
+						a_string.value.size() / sizeof(char16_t)));
+					return false;
+				});
+			}
+
+			return false;
+		});
+
+		if (!result && root->value.size() >= sizeof(REX::W32::VS_FIXEDFILEINFO)) {
+			REX::W32::VS_FIXEDFILEINFO info{};
+			std::memcpy(std::addressof(info), root->value.data(), sizeof(info));
+			if (info.signature == REX::W32::VS_FFI_SIGNATURE) {
+				result = Version(
+					static_cast<Version::value_type>(info.productVersionMS >> 16),
+					static_cast<Version::value_type>(info.productVersionMS & 0xFFFF),
+					static_cast<Version::value_type>(info.productVersionLS >> 16),
+					static_cast<Version::value_type>(info.productVersionLS & 0xFFFF));
+			}
 		}
 
-		return version;
+		return result;
+	}
+
+	std::optional<Version> GetFileVersion(REX::W32::HMODULE a_module) noexcept
+	{
+		return GetFileVersion(PEImage(a_module));
 	}
 }
@@ -1,40 +1,429 @@
+#include "REX/REX/Setting.hpp"
+
+namespace REX::Impl
+{
+	static constexpr std::uint32_t SNAPSHOT_MAGIC = 0x53535852;  // RXSS
+	static constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+	struct snapshot_source_t
+	{
+		std::uint64_t size;
+		std::int64_t time;
+		std::uint8_t exists;
+		std::uint8_t pad[7];
+	};
+
+	struct snapshot_header_t
+	{
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint64_t schema;
+		std::array<snapshot_source_t, 2> sources;
+		std::uint64_t payloadSize;
+		std::uint64_t payloadHash;
+	};
+
+	[[nodiscard]] static std::optional<std::uint64_t> SnapshotSchema(std::span<ISetting* const> a_settings)
+	{
+		auto schema = SchemaHash({}, a_settings.size());
+		for (const auto setting : a_settings) {
+			const auto hash = setting->GetSchema();
+			if (hash == 0) {
+				return std::nullopt;
+			}
+			schema = (schema ^ hash) * 0x100000001B3;
+		}
+		return schema;
+	}
+
+	[[nodiscard]] static std::optional<std::array<snapshot_source_t, 2>> SnapshotSources(std::span<const std::string_view> a_sources)
+	{
+		std::array<snapshot_source_t, 2> result{};
+		if (a_sources.size() != result.size()) {
+			return std::nullopt;
+		}
+
+		for (std::size_t i = 0; i < result.size(); ++i) {
+			const std::filesystem::path path{ a_sources[i] };
+			std::error_code ec;
+			if (!std::filesystem::exists(path, ec)) {
+				continue;
+			}
+
+			const auto size = std::filesystem::file_size(path, ec);
+			if (ec) {
+				return std::nullopt;
+			}
+			const auto time = std::filesystem::last_write_time(path, ec);
+			if (ec) {
+				return std::nullopt;
+			}
+
+			result[i].size = size;
+			result[i].time = time.time_since_epoch().count();
+			result[i].exists = 1;
+		}
+
+		return result;
+	}
+
+	[[nodiscard]] static std::uint64_t SnapshotHash(std::span<const std::byte> a_payload) noexcept
+	{
+		return SchemaHash({ reinterpret_cast<const char*>(a_payload.data()), a_payload.size() });
+	}
+
+	bool LoadSnapshot(std::string_view a_path, std::span<const std::string_view> a_sources, std::span<ISetting* const> a_settings)
+	{
+		const auto schema = SnapshotSchema(a_settings);
+		const auto sources = SnapshotSources(a_sources);
+		if (!schema || !sources) {
+			return false;
+		}
+
+		std::error_code ec;
+		const auto fileSize = std::filesystem::file_size(std::filesystem::path(a_path), ec);
+		if (ec || fileSize < sizeof(snapshot_header_t)) {
+			return false;
+		}
+
+		std::ifstream file{ std::filesystem::path(a_path), std::ios::binary };
+		snapshot_header_t header{};
+		if (!file.read(reinterpret_cast<char*>(std::addressof(header)), sizeof(header)) ||
+			header.magic != SNAPSHOT_MAGIC ||
+			header.version != SNAPSHOT_VERSION ||
+			header.schema != *schema ||
+			std::memcmp(header.sources.data(), sources->data(), sizeof(header.sources)) != 0) {
+			return false;
+		}
+
+		// the payload is the rest of the file, so a corrupt size is caught before it is allocated
+		if (header.payloadSize != fileSize - sizeof(header)) {
+			return false;
+		}
+
+		std::vector<std::byte> payload(header.payloadSize);
+		if (!file.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size())) ||
+			SnapshotHash(payload) != header.payloadHash) {
+			return false;
+		}
+
+		// the schema and hash both matched, so every setting finds its bytes where it left them
+		std::span<const std::byte> in{ payload };
+		for (const auto setting : a_settings) {
+			if (!setting->Restore(in)) {
+				return false;
+			}
+		}
+
+		return in.empty();
+	}
+
+	void SaveSnapshot(std::string_view a_path, std::span<const std::string_view> a_sources, std::span<ISetting* const> a_settings)
+	{
+		const auto schema = SnapshotSchema(a_settings);
+		const auto sources = SnapshotSources(a_sources);
+		if (!schema || !sources) {
+			return;
+		}
+
+		std::vector<std::byte> payload;
+		for (const auto setting : a_settings) {
+			setting->Snapshot(payload);
+		}
+
+		const snapshot_header_t header{
+			.magic = SNAPSHOT_MAGIC,
+			.version = SNAPSHOT_VERSION,
+			.schema = *schema,
+			.sources = *sources,
+			.payloadSize = payload.size(),
+			.payloadHash = SnapshotHash(payload),
+		};
+
+		std::ofstream file{ std::filesystem::path(a_path), std::ios::binary | std::ios::trunc };
+		file.write(reinterpret_cast<const char*>(std::addressof(header)), sizeof(header));
+		file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+	}
+}
+
 #ifdef REX_OPTION_INI
 
+#include "F4SE/Logger.hpp"
 #include "REX/REX/INI.hpp"
 
-#define SI_NO_CONVERSION
-#include <SimpleIni.h>
-
 namespace REX::INI
 {
 	namespace Impl
 	{
+		template <class T, class... Types>
+		concept is_any_of_v = (std::is_same_v<T, Types> || ...);
+
 		template <class T>
-		concept is_long_integral_v = std::_Is_any_of_v<std::remove_cv_t<T>, std::uint8_t, std::uint16_t, std::uint32_t, std::int8_t, std::int16_t, std::int32_t>;
+		concept is_long_integral_v = is_any_of_v<std::remove_cv_t<T>, std::uint8_t, std::uint16_t, std::uint32_t, std::int8_t, std::int16_t, std::int32_t>;
+
+		// sections and keys compare case insensitively, as they always have
+		[[nodiscard]] static char fold(char a_ch) noexcept
+		{
+			return a_ch >= 'A' && a_ch <= 'Z' ? static_cast<char>(a_ch - 'A' + 'a') : a_ch;
+		}
+
+		[[nodiscard]] static bool iequals(std::string_view a_lhs, std::string_view a_rhs) noexcept
+		{
+			return std::ranges::equal(a_lhs, a_rhs, [](char a_l, char a_r) { return fold(a_l) == fold(a_r); });
+		}
+
+		[[nodiscard]] static bool is_space(char a_ch) noexcept
+		{
+			return a_ch == ' ' || a_ch == '\t' || a_ch == '\v' || a_ch == '\f';
+		}
+
+		// plain loops, since find_first_not_of searches the whole set for every character
+		[[nodiscard]] static std::string_view trim(std::string_view a_str) noexcept
+		{
+			std::size_t first = 0;
+			while (first < a_str.size() && is_space(a_str[first])) {
+				++first;
+			}
+
+			auto last = a_str.size();
+			while (last > first && is_space(a_str[last - 1])) {
+				--last;
+			}
+
+			return a_str.substr(first, last - first);
+		}
+
+		struct entry_key_t
+		{
+			std::string_view section;
+			std::string_view key;
+		};
+
+		struct entry_hash_t
+		{
+			[[nodiscard]] std::size_t operator()(const entry_key_t& a_key) const noexcept
+			{
+				std::uint64_t hash = 0xCBF29CE484222325;
+				const auto feed = [&](std::string_view a_str) {
+					for (const auto ch : a_str) {
+						hash = (hash ^ static_cast<std::uint8_t>(fold(ch))) * 0x100000001B3;
+					}
+					hash = (hash ^ 0xFF) * 0x100000001B3;
+				};
+				feed(a_key.section);
+				feed(a_key.key);
+				return static_cast<std::size_t>(hash);
+			}
+		};
+
+		struct entry_equal_t
+		{
+			[[nodiscard]] bool operator()(const entry_key_t& a_lhs, const entry_key_t& a_rhs) const noexcept
+			{
+				return iequals(a_lhs.section, a_rhs.section) && iequals(a_lhs.key, a_rhs.key);
+			}
+		};
 
 		template <class T>
-		void SettingLoad<T>(
-			void* a_data,
-			sec_t a_section,
-			key_t a_key,
-			T& a_value,
-			T& a_valueDefault)
+		using entry_map = std::unordered_map<entry_key_t, T, entry_hash_t, entry_equal_t>;
+
+		/**
+		 * Tokenizes an ini file in a single pass, without copying it.
+		 *
+		 * <p>
+		 * Calls <code>a_onSection</code> with each section header, and <code>a_onEntry</code> with each
+		 * key along with the span of its value. Both also receive the offset just past their line.
+		 * </p>
+		 */
+		template <class SectionFunc, class EntryFunc>
+		static void Tokenize(std::string_view a_text, SectionFunc&& a_onSection, EntryFunc&& a_onEntry)
+		{
+			std::size_t pos = a_text.starts_with("\xEF\xBB\xBF") ? 3 : 0;
+			std::string_view section;
+			while (pos < a_text.size()) {
+				auto eol = pos;
+				while (eol < a_text.size() && a_text[eol] != '\n' && a_text[eol] != '\r') {
+					++eol;
+				}
+
+				const auto line = trim(a_text.substr(pos, eol - pos));
+
+				pos = eol;
+				if (pos < a_text.size() && a_text[pos] == '\r') {
+					++pos;
+				}
+				if (pos < a_text.size() && a_text[pos] == '\n') {
+					++pos;
+				}
+
+				if (line.empty() || line.front() == ';' || line.front() == '#') {
+					continue;
+				}
+
+				if (line.front() == '[') {
+					const auto close = line.find(']');
+					section = trim(line.substr(1, close == std::string_view::npos ? std::string_view::npos : close - 1));
+					a_onSection(section, pos);
+					continue;
+				}
+
+				const auto equals = line.find('=');
+				if (equals == std::string_view::npos) {
+					continue;
+				}
+
+				const auto key = trim(line.substr(0, equals));
+				auto value = trim(line.substr(equals + 1));
+				if (value.empty()) {
+					// anchor empty values just past the '=', so they can still be patched in place
+					value = line.substr(equals + 1, 0);
+				}
+
+				a_onEntry(section, key, static_cast<std::size_t>(value.data() - a_text.data()), value.size(), pos);
+			}
+		}
+
+		class MappedFile
+		{
+		public:
+			explicit MappedFile(std::string_view a_path)
+			{
+				const std::filesystem::path path{ a_path };
+				if (_map.open(path) && _map.size() > 0) {
+					_text = { reinterpret_cast<const char*>(_map.data()), _map.size() };
+					return;
+				}
+
+				// empty and missing files cannot be mapped, but are still valid
+				std::error_code ec;
+				const auto size = std::filesystem::file_size(path, ec);
+				_good = ec ? ec == std::errc::no_such_file_or_directory : size == 0;
+				if (!_good) {
+					F4SE::log::error("failed to map {}", a_path);
+				}
+			}
+
+			[[nodiscard]] bool good() const noexcept { return _good; }
+			[[nodiscard]] std::string_view text() const noexcept { return _text; }
+
+			void close()
+			{
+				_text = {};
+				_map.close();
+			}
+
+		private:
+			mmio::mapped_file_source _map;
+			std::string_view _text;
+			bool _good{ true };
+		};
+
+		// the base and user layers, merged into one index
+		struct layers_t
+		{
+			entry_map<std::array<std::optional<std::string_view>, 2>> values;
+		};
+
+		struct load_t
+		{
+			const layers_t* layers;
+			std::size_t layer;
+		};
+
+		[[nodiscard]] static std::string_view unquote(std::string_view a_value) noexcept
 		{
-			const auto file = static_cast<CSimpleIniA*>(a_data);
+			if (a_value.size() >= 2 && a_value.front() == '"' && a_value.back() == '"') {
+				return a_value.substr(1, a_value.size() - 2);
+			}
+			return a_value;
+		}
+
+		template <class T>
+		[[nodiscard]] static std::optional<T> ParseValue(std::string_view a_value)
+		{
+			a_value = unquote(a_value);
 			if constexpr (std::is_same_v<T, bool>) {
-				a_value = file->GetBoolValue(a_section.data(), a_key.data(), a_valueDefault);
+				if (a_value.empty()) {
+					return std::nullopt;
+				}
+
+				switch (fold(a_value.front())) {
+					case 't':
+					case 'y':
+					case '1':
+						return true;
+					case 'f':
+					case 'n':
+					case '0':
+						return false;
+					case 'o':
+						if (a_value.size() > 1) {
+							if (fold(a_value[1]) == 'n') {
+								return true;
+							}
+							if (fold(a_value[1]) == 'f') {
+								return false;
+							}
+						}
+						[[fallthrough]];
+					default:
+						return std::nullopt;
+				}
 			}
 			else if constexpr (std::is_floating_point_v<T>) {
-				a_value = static_cast<T>(file->GetDoubleValue(a_section.data(), a_key.data(), a_valueDefault));
+				double value{};
+				const auto end = a_value.data() + a_value.size();
+				const auto first = a_value.starts_with('+') ? a_value.data() + 1 : a_value.data();
+				if (const auto [ptr, ec] = std::from_chars(first, end, value); ec != std::errc{} || ptr != end) {
+					return std::nullopt;
+				}
+				return static_cast<T>(value);
 			}
 			else if constexpr (is_long_integral_v<T>) {
-				a_value = static_cast<T>(file->GetLongValue(a_section.data(), a_key.data(), a_valueDefault));
+				// accepts hex with a 0x prefix, and truncates like a cast
+				std::int64_t value{};
+				const auto end = a_value.data() + a_value.size();
+				auto first = a_value.data();
+				auto base = 10;
+				if (a_value.size() > 2 && a_value[0] == '0' && fold(a_value[1]) == 'x') {
+					first += 2;
+					base = 16;
+				}
+				else if (a_value.starts_with('+')) {
+					++first;
+				}
+
+				if (const auto [ptr, ec] = std::from_chars(first, end, value, base); ec != std::errc{} || ptr != end) {
+					return std::nullopt;
+				}
+				return static_cast<T>(value);
 			}
 			else if constexpr (std::is_same_v<T, std::string>) {
-				a_value = file->GetValue(a_section.data(), a_key.data(), a_valueDefault.c_str());
+				return std::string(a_value);
 			}
 		}
 
+		template <class T>
+		void SettingLoad(
+			void* a_data,
+			sec_t a_section,
+			key_t a_key,
+			T& a_value,
+			T& a_valueDefault)
+		{
+			const auto& load = *static_cast<const load_t*>(a_data);
+			if (const auto it = load.layers->values.find({ a_section, a_key }); it != load.layers->values.end()) {
+				if (const auto& value = it->second[load.layer]) {
+					if (auto result = ParseValue<T>(*value)) {
+						a_value = std::move(*result);
+						return;
+					}
+				}
+			}
+
+			a_value = a_valueDefault;
+		}
+
 		template void SettingLoad<bool>(void*, sec_t, key_t, bool&, bool&);
 		template void SettingLoad<float>(void*, sec_t, key_t, float&, float&);
 		template void SettingLoad<double>(void*, sec_t, key_t, double&, double&);
@@ -46,26 +435,140 @@ namespace REX::INI
 		template void SettingLoad<std::int32_t>(void*, sec_t, key_t, std::int32_t&, std::int32_t&);
 		template void SettingLoad<std::string>(void*, sec_t, key_t, std::string&, std::string&);
 
+		/**
+		 * Rewrites an ini file by patching values in place, so comments and layout survive a save.
+		 *
+		 * <p>
+		 * Keys missing from their section are added after its last entry, and missing sections are
+		 * appended to the end of the file. New lines end the way the first line of the file does.
+		 * </p>
+		 */
+		class Writer
+		{
+		public:
+			explicit Writer(std::string_view a_text) :
+				_text(a_text),
+				_eol(line_ending(a_text))
+			{
+				Tokenize(
+					_text,
+					[&](std::string_view a_section, std::size_t a_end) {
+						_sections.try_emplace({ a_section, {} }, a_end);
+					},
+					[&](std::string_view a_section, std::string_view a_key, std::size_t a_offset, std::size_t a_length, std::size_t a_end) {
+						_values.insert_or_assign({ a_section, a_key }, std::pair{ a_offset, a_length });
+						_sections.insert_or_assign({ a_section, {} }, a_end);
+					});
+			}
+
+			void set(sec_t a_section, key_t a_key, std::string a_value)
+			{
+				if (const auto it = _values.find({ a_section, a_key }); it != _values.end()) {
+					const auto [offset, length] = it->second;
+					if (length == 0 && !a_value.empty() && offset > 0 && _text[offset - 1] == '=') {
+						a_value.insert(0, 1, ' ');
+					}
+					_patches.push_back({ offset, length, std::move(a_value), false });
+				}
+				else if (const auto section = _sections.find({ a_section, {} }); section != _sections.end()) {
+					_patches.push_back({ section->second, 0, line(a_key, a_value), true });
+				}
+				else {
+					const auto [appended, inserted] = _appendedSections.try_emplace({ a_section, {} }, _appended.size());
+					if (inserted) {
+						_appended.push_back(std::format("[{}]{}", a_section, _eol));
+					}
+					_appended[appended->second] += line(a_key, a_value);
+				}
+			}
+
+			[[nodiscard]] std::string str()
+			{
+				std::ranges::stable_sort(_patches, {}, &patch_t::offset);
+
+				std::string result;
+				result.reserve(_text.size() + _patches.size() * 32);
+
+				std::size_t pos = 0;
+				for (const auto& patch : _patches) {
+					result.append(_text.substr(pos, patch.offset - pos));
+					// the file may end without a line break
+					if (patch.line && !result.empty() && result.back() != '\n' && result.back() != '\r') {
+						result.append(_eol);
+					}
+					result.append(patch.text);
+					pos = patch.offset + patch.length;
+				}
+				result.append(_text.substr(pos));
+
+				for (const auto& section : _appended) {
+					if (!result.empty()) {
+						if (!result.ends_with('\n')) {
+							result.append(_eol);
+						}
+						result.append(_eol);
+					}
+					result.append(section);
+				}
+
+				return result;
+			}
+
+		private:
+			struct patch_t
+			{
+				std::size_t offset;
+				std::size_t length;
+				std::string text;
+				bool line;
+			};
+
+			[[nodiscard]] static std::string_view line_ending(std::string_view a_text) noexcept
+			{
+				const auto eol = a_text.find('\n');
+				return eol != std::string_view::npos && eol > 0 && a_text[eol - 1] == '\r' ? "\r\n" : "\n";
+			}
+
+			[[nodiscard]] std::string line(key_t a_key, std::string_view a_value) const
+			{
+				return std::format("{} = {}{}", a_key, a_value, _eol);
+			}
+
+			std::string_view _text;
+			std::string_view _eol;
+			entry_map<std::pair<std::size_t, std::size_t>> _values;
+			entry_map<std::size_t> _sections;
+			std::vector<patch_t> _patches;
+			std::vector<std::string> _appended;
+			entry_map<std::size_t> _appendedSections;
+		};
+
 		template <class T>
-		void SettingSave<T>(
+		[[nodiscard]] static std::string FormatValue(const T& a_value)
+		{
+			if constexpr (std::is_same_v<T, bool>) {
+				return a_value ? "true" : "false";
+			}
+			else if constexpr (std::is_same_v<T, std::string>) {
+				const auto padded = !a_value.empty() && (trim(a_value).size() != a_value.size());
+				return padded ? std::format("\"{}\"", a_value) : a_value;
+			}
+			else {
+				std::array<char, 64> buf;
+				const auto [ptr, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), a_value);
+				return { buf.data(), ptr };
+			}
+		}
+
+		template <class T>
+		void SettingSave(
 			void* a_data,
 			sec_t a_section,
 			key_t a_key,
 			T&& a_value)
 		{
-			auto& file = *static_cast<CSimpleIniA*>(a_data);
-			if constexpr (std::is_same_v<std::remove_reference_t<T>, bool>) {
-				file.SetBoolValue(a_section.data(), a_key.data(), std::forward<T>(a_value));
-			}
-			else if constexpr (std::is_floating_point_v<std::remove_reference_t<T>>) {
-				file.SetDoubleValue(a_section.data(), a_key.data(), std::forward<T>(a_value));
-			}
-			else if constexpr (is_long_integral_v<std::remove_reference_t<T>>) {
-				file.SetLongValue(a_section.data(), a_key.data(), std::forward<T>(a_value));
-			}
-			else if constexpr (std::is_same_v<std::remove_reference_t<T>, std::string>) {
-				file.SetValue(a_section.data(), a_key.data(), std::forward<T>(a_value).c_str());
-			}
+			auto& writer = *static_cast<Writer*>(a_data);
+			writer.set(a_section, a_key, FormatValue(a_value));
 		}
 
 		template void SettingSave<bool&>(void*, sec_t, key_t, bool&);
@@ -82,37 +585,75 @@ namespace REX::INI
 
 	void SettingStore::Load()
 	{
-		CSimpleIniA file;
-		file.SetUnicode(true);
-		file.SetQuotes(true);
+		if (LoadSnapshot()) {
+			return;
+		}
 
-		if (std::filesystem::exists(m_fileBase)) {
-			file.LoadFile(m_fileBase.data());
-			for (auto& setting : m_settings) {
-				setting->Load(&file, true);
+		const std::array paths{ m_fileBase, m_fileUser };
+		std::array<std::optional<Impl::MappedFile>, 2> files;
+
+		// both layers are tokenized into one index, then every setting is resolved against it
+		Impl::layers_t layers;
+		bool parsed = true;
+		for (std::size_t i = 0; i < paths.size(); ++i) {
+			if (!std::filesystem::exists(paths[i])) {
+				continue;
 			}
+
+			// a file which exists but cannot be read, e.g. held by another process, is not worth a snapshot
+			if (!files[i].emplace(paths[i]).good()) {
+				files[i].reset();
+				parsed = false;
+				continue;
+			}
+
+			const auto text = files[i]->text();
+			layers.values.reserve(layers.values.size() + text.size() / 32);
+			Impl::Tokenize(
+				text,
+				[](std::string_view, std::size_t) {},
+				[&](std::string_view a_section, std::string_view a_key, std::size_t a_offset, std::size_t a_length, std::size_t) {
+					layers.values[{ a_section, a_key }][i] = text.substr(a_offset, a_length);
+				});
 		}
 
-		if (std::filesystem::exists(m_fileUser)) {
-			file.LoadFile(m_fileUser.data());
-			for (auto& setting : m_settings) {
-				setting->Load(&file, false);
+		for (std::size_t i = 0; i < files.size(); ++i) {
+			if (files[i]) {
+				Impl::load_t load{ std::addressof(layers), i };
+				for (auto& setting : m_settings) {
+					setting->Load(&load, i == 0);
+				}
 			}
 		}
+
+		for (auto& setting : m_settings) {
+			setting->Commit();
+		}
+
+		if (parsed) {
+			SaveSnapshot();
+		}
 	}
 
 	void SettingStore::Save()
 	{
-		CSimpleIniA file;
-		file.SetUnicode(true);
-		file.SetQuotes(true);
+		std::string output;
+		{
+			Impl::MappedFile file{ m_fileBase };
+			if (!file.good()) { // writing now would drop everything the base file holds
+				return;
+			}
 
-		file.LoadFile(m_fileBase.data());
-		for (auto& setting : m_settings) {
-			setting->Save(&file);
+			Impl::Writer writer{ file.text() };
+			for (auto& setting : m_settings) {
+				setting->Save(&writer);
+			}
+
+			output = writer.str();
 		}
 
-		file.SaveFile(m_fileBase.data());
+		std::ofstream file{ std::filesystem::path(m_fileBase), std::ios::binary | std::ios::trunc };
+		file.write(output.data(), static_cast<std::streamsize>(output.size()));
 	}
 }
 #endif
@@ -128,103 +669,287 @@ namespace REX::JSON
 {
 	namespace Impl
 	{
+		Path::Path(path_t a_path) :
+			_path(a_path)
+		{
+			if (!_path.starts_with('/')) {
+				_buffer = _path;
+				_segments.push_back({ static_cast<std::uint32_t>(_buffer.size()), static_cast<std::uint32_t>(_path.size()) });
+				return;
+			}
+
+			for (std::size_t pos = 1; pos <= _path.size();) {
+				auto end = _path.find('/', pos);
+				if (end == path_t::npos) {
+					end = _path.size();
+				}
+
+				for (auto i = pos; i < end; ++i) {
+					if (_path[i] == '~' && i + 1 < end && (_path[i + 1] == '0' || _path[i + 1] == '1')) {
+						_buffer.push_back(_path[++i] == '0' ? '~' : '/');
+					}
+					else {
+						_buffer.push_back(_path[i]);
+					}
+				}
+
+				_segments.push_back({ static_cast<std::uint32_t>(_buffer.size()), static_cast<std::uint32_t>(end) });
+				pos = end + 1;
+			}
+		}
+
+		struct Document
+		{
+			nlohmann::json json;
+			std::filesystem::file_time_type time;
+		};
+
+		[[nodiscard]] static std::optional<std::size_t> ArrayIndex(std::string_view a_segment) noexcept
+		{
+			std::size_t index{};
+			const auto end = a_segment.data() + a_segment.size();
+			if (const auto [ptr, ec] = std::from_chars(a_segment.data(), end, index); a_segment.empty() || ec != std::errc{} || ptr != end) {
+				return std::nullopt;
+			}
+			return index;
+		}
+
+		// resolves settings against one document, walking to each interior node only once
+		class Reader
+		{
+		public:
+			explicit Reader(const nlohmann::json& a_root) noexcept :
+				_root(a_root)
+			{
+			}
+
+			[[nodiscard]] const nlohmann::json* find(const Path& a_path)
+			{
+				const auto parent = resolve(a_path, a_path.size() - 1);
+				return parent ? child(*parent, a_path.segment(a_path.size() - 1)) : nullptr;
+			}
+
+		private:
+			[[nodiscard]] static const nlohmann::json* child(const nlohmann::json& a_node, std::string_view a_segment)
+			{
+				if (a_node.is_object()) {
+					const auto it = a_node.find(a_segment);
+					return it != a_node.end() ? std::addressof(*it) : nullptr;
+				}
+
+				if (a_node.is_array()) {
+					const auto index = ArrayIndex(a_segment);
+					return index && *index < a_node.size() ? std::addressof(a_node[*index]) : nullptr;
+				}
+
+				return nullptr;
+			}
+
+			[[nodiscard]] const nlohmann::json* resolve(const Path& a_path, std::size_t a_count)
+			{
+				if (a_count == 0) {
+					return std::addressof(_root);
+				}
+
+				const auto key = a_path.prefix(a_count - 1);
+				if (const auto it = _nodes.find(key); it != _nodes.end()) {
+					return it->second;
+				}
+
+				const auto parent = resolve(a_path, a_count - 1);
+				const auto node = parent ? child(*parent, a_path.segment(a_count - 1)) : nullptr;
+				_nodes.emplace(key, node);
+				return node;
+			}
+
+			const nlohmann::json& _root;
+			std::unordered_map<path_t, const nlohmann::json*> _nodes;
+		};
+
+		struct Writer
+		{
+			nlohmann::json& root;
+			bool dirty{ false };
+		};
+
 		template <class T>
-		void SettingLoad<T>(
+		void SettingLoad(
 			void* a_data,
-			path_t a_path,
+			const Path& a_path,
 			T& a_value,
 			T& a_valueDefault)
 		{
-			const auto& json = *static_cast<nlohmann::json*>(a_data);
-			if (a_path[0] == '/') {
-				a_value = json.value<T>(nlohmann::json::json_pointer(a_path.data()), a_valueDefault);
-			}
-			else {
-				a_value = json.value<T>(a_path, a_valueDefault);
+			auto& reader = *static_cast<Reader*>(a_data);
+			if (const auto node = reader.find(a_path); node && !node->is_null()) {
+				try {
+					a_value = node->get<T>();
+					return;
+				}
+				catch (const nlohmann::json::exception& e) {
+					F4SE::log::warn("{}: {}", a_path.prefix(a_path.size() - 1), e.what());
+				}
 			}
+
+			a_value = a_valueDefault;
 		}
 
-		template void SettingLoad<bool>(void*, path_t, bool&, bool&);
-		template void SettingLoad<float>(void*, path_t, float&, float&);
-		template void SettingLoad<double>(void*, path_t, double&, double&);
-		template void SettingLoad<std::uint8_t>(void*, path_t, std::uint8_t&, std::uint8_t&);
-		template void SettingLoad<std::uint16_t>(void*, path_t, std::uint16_t&, std::uint16_t&);
-		template void SettingLoad<std::uint32_t>(void*, path_t, std::uint32_t&, std::uint32_t&);
-		template void SettingLoad<std::int8_t>(void*, path_t, std::int8_t&, std::int8_t&);
-		template void SettingLoad<std::int16_t>(void*, path_t, std::int16_t&, std::int16_t&);
-		template void SettingLoad<std::int32_t>(void*, path_t, std::int32_t&, std::int32_t&);
-		template void SettingLoad<std::string>(void*, path_t, std::string&, std::string&);
+		template void SettingLoad<bool>(void*, const Path&, bool&, bool&);
+		template void SettingLoad<float>(void*, const Path&, float&, float&);
+		template void SettingLoad<double>(void*, const Path&, double&, double&);
+		template void SettingLoad<std::uint8_t>(void*, const Path&, std::uint8_t&, std::uint8_t&);
+		template void SettingLoad<std::uint16_t>(void*, const Path&, std::uint16_t&, std::uint16_t&);
+		template void SettingLoad<std::uint32_t>(void*, const Path&, std::uint32_t&, std::uint32_t&);
+		template void SettingLoad<std::int8_t>(void*, const Path&, std::int8_t&, std::int8_t&);
+		template void SettingLoad<std::int16_t>(void*, const Path&, std::int16_t&, std::int16_t&);
+		template void SettingLoad<std::int32_t>(void*, const Path&, std::int32_t&, std::int32_t&);
+		template void SettingLoad<std::string>(void*, const Path&, std::string&, std::string&);
 
 		template <class T>
-		void SettingSave<T>(
+		void SettingSave(
 			void* a_data,
-			path_t a_path,
+			const Path& a_path,
 			T&& a_value)
 		{
-			auto& json = *static_cast<nlohmann::json*>(a_data);
-			if (a_path[0] == '/') {
-				json[nlohmann::json::json_pointer(a_path.data())] = std::forward<T>(a_value);
+			auto& writer = *static_cast<Writer*>(a_data);
+			auto node = std::addressof(writer.root);
+			for (std::size_t i = 0; i < a_path.size(); ++i) {
+				const auto segment = a_path.segment(i);
+
+				// like a json pointer, a missing node indexed by a number is created as an array
+				if (node->is_null() && a_path.prefix(i).starts_with('/') && ArrayIndex(segment)) {
+					*node = nlohmann::json::array();
+				}
+
+				if (node->is_array()) {
+					if (const auto index = ArrayIndex(segment)) {
+						node = std::addressof((*node)[*index]);
+						continue;
+					}
+				}
+
+				if (node->is_null()) {
+					*node = nlohmann::json::object();
+				}
+				else if (!node->is_object()) {
+					F4SE::log::warn("{}: cannot save into a {}", a_path.prefix(i), node->type_name());
+					return;
+				}
+
+				node = std::addressof((*node)[segment]);
 			}
-			else {
-				json[a_path] = std::forward<T>(a_value);
+
+			// unchanged values leave the document untouched
+			try {
+				if (!node->is_null() && node->get<std::remove_cvref_t<T>>() == a_value) {
+					return;
+				}
+			}
+			catch (const nlohmann::json::exception&) {
 			}
+
+			*node = std::forward<T>(a_value);
+			writer.dirty = true;
 		}
 
-		template void SettingSave<bool&&>(void*, path_t, bool&&);
-		template void SettingSave<float&>(void*, path_t, float&);
-		template void SettingSave<double&>(void*, path_t, double&);
-		template void SettingSave<std::uint8_t&>(void*, path_t, std::uint8_t&);
-		template void SettingSave<std::uint16_t&>(void*, path_t, std::uint16_t&);
-		template void SettingSave<std::uint32_t&>(void*, path_t, std::uint32_t&);
-		template void SettingSave<std::int8_t&>(void*, path_t, std::int8_t&);
-		template void SettingSave<std::int16_t&>(void*, path_t, std::int16_t&);
-		template void SettingSave<std::int32_t&>(void*, path_t, std::int32_t&);
-		template void SettingSave<std::string&>(void*, path_t, std::string&);
-	}
+		template void SettingSave<bool&>(void*, const Path&, bool&);
+		template void SettingSave<float&>(void*, const Path&, float&);
+		template void SettingSave<double&>(void*, const Path&, double&);
+		template void SettingSave<std::uint8_t&>(void*, const Path&, std::uint8_t&);
+		template void SettingSave<std::uint16_t&>(void*, const Path&, std::uint16_t&);
+		template void SettingSave<std::uint32_t&>(void*, const Path&, std::uint32_t&);
+		template void SettingSave<std::int8_t&>(void*, const Path&, std::int8_t&);
+		template void SettingSave<std::int16_t&>(void*, const Path&, std::int16_t&);
+		template void SettingSave<std::int32_t&>(void*, const Path&, std::int32_t&);
+		template void SettingSave<std::string&>(void*, const Path&, std::string&);
 
-	void SettingStore::Load()
-	{
-		if (std::filesystem::exists(m_fileBase)) {
-			std::ifstream file{ m_fileBase.data() };
+		[[nodiscard]] static std::shared_ptr<Document> Parse(const std::filesystem::path& a_path)
+		{
 			try {
-				auto result = nlohmann::json::parse(file);
-				for (auto setting : m_settings) {
-					setting->Load(&result, true);
-				}
+				auto document = std::make_shared<Document>();
+				document->time = std::filesystem::last_write_time(a_path);
+				std::ifstream file{ a_path };
+				document->json = nlohmann::json::parse(file);
+				return document;
 			}
 			catch (const std::exception& e) {
-				F4SE::log::error("{}"sv, e.what());
+				F4SE::log::error("{}", e.what());
+				return nullptr;
 			}
 		}
+	}
 
-		if (std::filesystem::exists(m_fileUser)) {
-			std::ifstream file{ m_fileUser.data() };
-			try {
-				auto result = nlohmann::json::parse(file);
-				for (auto setting : m_settings) {
-					setting->Load(&result, false);
-				}
+	void SettingStore::Load()
+	{
+		m_document.reset();
+		if (LoadSnapshot()) {
+			return;
+		}
+
+		const std::array paths{ m_fileBase, m_fileUser };
+		bool parsed = true;
+		for (std::size_t i = 0; i < paths.size(); ++i) {
+			if (!std::filesystem::exists(paths[i])) {
+				continue;
 			}
-			catch (const std::exception& e) {
-				F4SE::log::error("{}"sv, e.what());
+
+			auto document = Impl::Parse(paths[i]);
+			if (!document) {
+				parsed = false;
+				continue;
 			}
+
+			Impl::Reader reader{ document->json };
+			for (auto setting : m_settings) {
+				setting->Load(&reader, i == 0);
+			}
+
+			// the base document is kept for saving
+			if (i == 0) {
+				m_document = std::move(document);
+			}
+		}
+
+		for (auto setting : m_settings) {
+			setting->Commit();
+		}
+
+		if (parsed) {
+			SaveSnapshot();
 		}
 	}
 
 	void SettingStore::Save()
 	{
-		nlohmann::json output{};
-		if (std::filesystem::exists(m_fileBase)) {
-			std::ifstream file{ m_fileBase.data() };
-			output = nlohmann::json::parse(file);
+		const std::filesystem::path path{ m_fileBase };
+
+		// the kept document is only reused while the file is unchanged since it was read
+		std::error_code ec;
+		const auto time = std::filesystem::last_write_time(path, ec);
+		if (ec) {
+			m_document = std::make_shared<Impl::Document>();
+		}
+		else if (!m_document || m_document->time != time) {
+			m_document = Impl::Parse(path);
+			if (!m_document) {
+				return;
+			}
 		}
 
+		Impl::Writer writer{ m_document->json };
 		for (auto& setting : m_settings) {
-			setting->Save(&output);
+			setting->Save(&writer);
 		}
 
-		std::ofstream file{ m_fileBase.data(), std::ios::trunc };
-		file << std::setw(4) << output;
+		if (!writer.dirty && !ec) {
+			return;
+		}
+
+		{
+			std::ofstream file{ path, std::ios::trunc };
+			file << std::setw(4) << m_document->json;
+		}
+
+		m_document->time = std::filesystem::last_write_time(path, ec);
 	}
 }
 #endif
@@ -238,142 +963,206 @@ namespace REX::TOML
 {
 	namespace Impl
 	{
-		static toml::value* recurse_table(toml::value* a_result, toml::value& a_value, const std::string& a_section, bool a_create)
+		// section paths are cached under their segments joined by a separator toml keys will not contain
+		static void AppendSection(std::string& a_path, const std::string& a_section)
+		{
+			a_path.append(a_section);
+			a_path.push_back('\0');
+		}
+
+		// resolves settings against one document, walking to each table only once
+		class Reader
 		{
-			if (a_result && a_result->is_table()) {
-				for (auto& value : a_result->as_table()) {
-					if (value.first == a_section) {
-						return std::addressof(value.second);
+		public:
+			explicit Reader(const toml::value& a_root) noexcept :
+				_root(a_root)
+			{
+			}
+
+			[[nodiscard]] const toml::value* find(const sec_t& a_section)
+			{
+				const auto* node = std::addressof(_root);
+				std::string path;
+				for (const auto& section : a_section) {
+					AppendSection(path, section);
+					if (const auto it = _tables.find(path); it != _tables.end()) {
+						node = it->second;
+					}
+					else {
+						node = child(node, section);
+						_tables.emplace(path, node);
+					}
+
+					if (!node) {
+						break;
 					}
 				}
-				if (a_create) {
-					(*a_result)[a_section] = toml::table{};
-					return std::addressof((*a_result)[a_section]);
+
+				return node;
+			}
+
+		private:
+			[[nodiscard]] static const toml::value* child(const toml::value* a_node, const std::string& a_section)
+			{
+				if (!a_node || !a_node->is_table()) {
+					return nullptr;
 				}
+
+				const auto& table = a_node->as_table();
+				const auto it = table.find(a_section);
+				return it != table.end() && it->second.is_table() ? std::addressof(it->second) : nullptr;
 			}
-			else if (a_value.is_table()) {
-				for (auto& value : a_value.as_table()) {
-					if (value.first == a_section) {
-						return std::addressof(value.second);
-					}
+
+			const toml::value& _root;
+			std::unordered_map<std::string, const toml::value*> _tables;
+		};
+
+		// creates missing tables as settings are saved into them, remembering which it made
+		class Writer
+		{
+		public:
+			explicit Writer(toml::value& a_root) :
+				_root(a_root)
+			{
+				if (!_root.is_table()) {
+					_root = toml::table{};
 				}
-				if (a_create) {
-					a_value[a_section] = toml::table{};
-					return std::addressof(a_value[a_section]);
+			}
+
+			[[nodiscard]] toml::value* find(const sec_t& a_section)
+			{
+				auto* node = std::addressof(_root);
+				std::string path;
+				for (const auto& section : a_section) {
+					AppendSection(path, section);
+					if (const auto it = _tables.find(path); it != _tables.end()) {
+						node = it->second;
+					}
+					else {
+						node = child(*node, section);
+						_tables.emplace(path, node);
+					}
+
+					if (!node) {
+						break;
+					}
 				}
+
+				return node;
 			}
-			return a_result;
-		}
 
-		static bool recurse_mark_implicit(toml::value& a_value)
-		{
-			for (auto& kv : a_value.as_table()) {
-				if (kv.second.is_table()) {
-					if (!recurse_mark_implicit(kv.second)) {
-						continue;
+			/**
+			 * Tables which hold nothing but other tables are only written through their children's headers.
+			 */
+			void mark_implicit()
+			{
+				// children were created after their parents, so they are settled first
+				for (const auto table : _created | std::views::reverse) {
+					if (std::ranges::all_of(table->as_table(), [](const auto& a_kv) { return a_kv.second.is_table(); })) {
+						table->as_table_fmt().fmt = toml::table_format::implicit;
 					}
-					kv.second.as_table_fmt().fmt = toml::table_format::implicit;
 				}
-				else {
-					return false;
+			}
+
+		private:
+			[[nodiscard]] toml::value* child(toml::value& a_node, const std::string& a_section)
+			{
+				auto& table = a_node.as_table();
+				if (const auto it = table.find(a_section); it != table.end()) {
+					return it->second.is_table() ? std::addressof(it->second) : nullptr;
 				}
+
+				const auto result = std::addressof(table.emplace(a_section, toml::table{}).first->second);
+				_created.push_back(result);
+				return result;
 			}
-			return true;
-		}
+
+			toml::value& _root;
+			std::unordered_map<std::string, toml::value*> _tables;
+			std::vector<toml::value*> _created;
+		};
 
 		template <class T>
-		void SettingLoad<T>(
+		void SettingLoad(
 			void* a_data,
-			sec_t a_section,
+			const sec_t& a_section,
 			key_t a_key,
 			T& a_value,
 			T& a_valueDefault)
 		{
-			const auto& data = static_cast<toml::value*>(a_data);
-			if (a_section.empty()) {
-				auto& path = (*data);
-				a_value = toml::find_or<T>(path, a_key.data(), a_valueDefault);
-				return;
-			}
-			else if (a_section.size() == 1) {
-				auto& path = (*data)[a_section.front()];
-				a_value = toml::find_or<T>(path, a_key.data(), a_valueDefault);
+			auto& reader = *static_cast<Reader*>(a_data);
+			if (const auto table = reader.find(a_section)) {
+				a_value = toml::find_or<T>(*table, std::string(a_key), a_valueDefault);
 				return;
 			}
-			else {
-				toml::value* path{ nullptr };
-				for (auto& section : a_section) {
-					path = recurse_table(path, *data, section, false);
-				}
-				if (path) {
-					a_value = toml::find_or<T>(*path, a_key.data(), a_valueDefault);
-					return;
-				}
-			}
 			a_value = a_valueDefault;
 		}
 
-		template void SettingLoad<bool>(void*, sec_t, key_t, bool&, bool&);
-		template void SettingLoad<float>(void*, sec_t, key_t, float&, float&);
-		template void SettingLoad<double>(void*, sec_t, key_t, double&, double&);
-		template void SettingLoad<std::uint8_t>(void*, sec_t, key_t, std::uint8_t&, std::uint8_t&);
-		template void SettingLoad<std::uint16_t>(void*, sec_t, key_t, std::uint16_t&, std::uint16_t&);
-		template void SettingLoad<std::uint32_t>(void*, sec_t, key_t, std::uint32_t&, std::uint32_t&);
-		template void SettingLoad<std::int8_t>(void*, sec_t, key_t, std::int8_t&, std::int8_t&);
-		template void SettingLoad<std::int16_t>(void*, sec_t, key_t, std::int16_t&, std::int16_t&);
-		template void SettingLoad<std::int32_t>(void*, sec_t, key_t, std::int32_t&, std::int32_t&);
-		template void SettingLoad<std::string>(void*, sec_t, key_t, std::string&, std::string&);
+		template void SettingLoad<bool>(void*, const sec_t&, key_t, bool&, bool&);
+		template void SettingLoad<float>(void*, const sec_t&, key_t, float&, float&);
+		template void SettingLoad<double>(void*, const sec_t&, key_t, double&, double&);
+		template void SettingLoad<std::uint8_t>(void*, const sec_t&, key_t, std::uint8_t&, std::uint8_t&);
+		template void SettingLoad<std::uint16_t>(void*, const sec_t&, key_t, std::uint16_t&, std::uint16_t&);
+		template void SettingLoad<std::uint32_t>(void*, const sec_t&, key_t, std::uint32_t&, std::uint32_t&);
+		template void SettingLoad<std::int8_t>(void*, const sec_t&, key_t, std::int8_t&, std::int8_t&);
+		template void SettingLoad<std::int16_t>(void*, const sec_t&, key_t, std::int16_t&, std::int16_t&);
+		template void SettingLoad<std::int32_t>(void*, const sec_t&, key_t, std::int32_t&, std::int32_t&);
+		template void SettingLoad<std::string>(void*, const sec_t&, key_t, std::string&, std::string&);
 
 		template <class T>
-		void SettingSave<T>(
+		void SettingSave(
 			void* a_data,
-			sec_t a_section,
+			const sec_t& a_section,
 			key_t a_key,
 			T&& a_value)
 		{
-			auto& data = *static_cast<toml::value*>(a_data);
-			if (a_section.empty()) {
-				data[a_key.data()] = std::forward<T>(a_value);
-			}
-			else if (a_section.size() == 1) {
-				data[a_section.front()][a_key.data()] = std::forward<T>(a_value);
-			}
-			else {
-				toml::value* path{ nullptr };
-				for (auto& section : a_section) {
-					path = recurse_table(path, data, section, true);
-				}
-				if (path) {
-					(*path)[a_key.data()] = std::forward<T>(a_value);
-				}
+			auto& writer = *static_cast<Writer*>(a_data);
+			if (const auto table = writer.find(a_section)) {
+				(*table)[std::string(a_key)] = std::forward<T>(a_value);
 			}
 		}
 
-		template void SettingSave<bool&>(void*, sec_t, key_t, bool&);
-		template void SettingSave<float&>(void*, sec_t, key_t, float&);
-		template void SettingSave<double&>(void*, sec_t, key_t, double&);
-		template void SettingSave<std::uint8_t&>(void*, sec_t, key_t, std::uint8_t&);
-		template void SettingSave<std::uint16_t&>(void*, sec_t, key_t, std::uint16_t&);
-		template void SettingSave<std::uint32_t&>(void*, sec_t, key_t, std::uint32_t&);
-		template void SettingSave<std::int8_t&>(void*, sec_t, key_t, std::int8_t&);
-		template void SettingSave<std::int16_t&>(void*, sec_t, key_t, std::int16_t&);
-		template void SettingSave<std::int32_t&>(void*, sec_t, key_t, std::int32_t&);
-		template void SettingSave<std::string&>(void*, sec_t, key_t, std::string&);
+		template void SettingSave<bool&>(void*, const sec_t&, key_t, bool&);
+		template void SettingSave<float&>(void*, const sec_t&, key_t, float&);
+		template void SettingSave<double&>(void*, const sec_t&, key_t, double&);
+		template void SettingSave<std::uint8_t&>(void*, const sec_t&, key_t, std::uint8_t&);
+		template void SettingSave<std::uint16_t&>(void*, const sec_t&, key_t, std::uint16_t&);
+		template void SettingSave<std::uint32_t&>(void*, const sec_t&, key_t, std::uint32_t&);
+		template void SettingSave<std::int8_t&>(void*, const sec_t&, key_t, std::int8_t&);
+		template void SettingSave<std::int16_t&>(void*, const sec_t&, key_t, std::int16_t&);
+		template void SettingSave<std::int32_t&>(void*, const sec_t&, key_t, std::int32_t&);
+		template void SettingSave<std::string&>(void*, const sec_t&, key_t, std::string&);
 	}
 
 	void SettingStore::Load()
 	{
-		if (auto result = toml::try_parse(m_fileBase.data()); result.is_ok()) {
-			for (auto& setting : m_settings) {
-				setting->Load(&result.unwrap(), true);
-			}
+		if (LoadSnapshot()) {
+			return;
 		}
 
-		if (auto result = toml::try_parse(m_fileUser.data()); result.is_ok()) {
+		const std::array paths{ m_fileBase, m_fileUser };
+		bool parsed = true;
+		for (std::size_t i = 0; i < paths.size(); ++i) {
+			auto result = toml::try_parse(paths[i].data());
+			if (!result.is_ok()) {
+				// a missing file is fine, one which fails to parse is not worth a snapshot
+				parsed = parsed && !std::filesystem::exists(paths[i]);
+				continue;
+			}
+
+			Impl::Reader reader{ result.unwrap() };
 			for (auto& setting : m_settings) {
-				setting->Load(&result.unwrap(), false);
+				setting->Load(&reader, i == 0);
 			}
 		}
+
+		for (auto& setting : m_settings) {
+			setting->Commit();
+		}
+
+		if (parsed) {
+			SaveSnapshot();
+		}
 	}
 
 	void SettingStore::Save()
@@ -383,11 +1172,12 @@ namespace REX::TOML
 			output = result.unwrap();
 		}
 
+		Impl::Writer writer{ output };
 		for (auto setting : m_settings) {
-			setting->Save(&output);
+			setting->Save(&writer);
 		}
 
-		Impl::recurse_mark_implicit(output);
+		writer.mark_implicit();
 		std::ofstream file{ m_fileBase.data(), std::ios::trunc };
 		file << toml::format(output);
 	}
@@ -0,0 +1,134 @@
+#include "BSTHashMapCommon.hpp"
+
+namespace
+{
+	struct result_t
+	{
+		std::string_view table;
+		std::string_view key;
+		std::size_t size;
+		std::string_view op;
+		double nsPerOp;
+	};
+
+	template <class Key>
+	[[nodiscard]] std::vector<Key> make_keys(std::size_t a_first, std::size_t a_count)
+	{
+		std::vector<Key> keys;
+		keys.reserve(a_count);
+		for (auto i = a_first; i < a_first + a_count; ++i) {
+			if constexpr (std::is_same_v<Key, std::uint32_t>) {
+				keys.push_back(static_cast<std::uint32_t>(i) * 0x9E3779B9u);
+			}
+			else {
+				keys.emplace_back(std::format("key_{}", i));
+			}
+		}
+		return keys;
+	}
+
+	template <class Table>
+	void bench(std::vector<result_t>& a_results, std::string_view a_table, std::string_view a_key, const std::vector<typename Table::key_type>& a_hits, const std::vector<typename Table::key_type>& a_misses)
+	{
+		const auto size = a_hits.size();
+		const auto record = [&](std::string_view a_op, double a_ns) {
+			a_results.push_back({ a_table, a_key, size, a_op, a_ns / static_cast<double>(size) });
+		};
+
+		Table table;
+		record("insert", test::time_ns([&] {
+			for (const auto& key : a_hits) {
+				table.emplace(key, 0);
+			}
+		}));
+		TEST_CHECK(table.size() == size);
+
+		record("find_hit", test::time_ns([&] {
+			std::size_t found = 0;
+			for (const auto& key : a_hits) {
+				found += table.find(key) != table.end();
+			}
+			test::do_not_optimize(found);
+		}));
+
+		record("find_miss", test::time_ns([&] {
+			std::size_t found = 0;
+			for (const auto& key : a_misses) {
+				found += table.find(key) != table.end();
+			}
+			test::do_not_optimize(found);
+		}));
+
+		record("iterate", test::time_ns([&] {
+			std::size_t sum = 0;
+			for (const auto& [key, value] : table) {
+				sum += static_cast<std::size_t>(value) + 1;
+			}
+			test::do_not_optimize(sum);
+		}));
+
+		record("rehash", test::time_ns([&] {
+			table.reserve(static_cast<std::uint32_t>(size * 2));
+		}));
+
+		record("erase", test::time_ns([&] {
+			for (const auto& key : a_hits) {
+				table.erase(key);
+			}
+		}));
+		TEST_CHECK(table.empty());
+
+		Table reserved;
+		record("insert_reserved", test::time_ns([&] {
+			reserved.reserve(static_cast<std::uint32_t>(size));
+			for (const auto& key : a_hits) {
+				reserved.emplace(key, 0);
+			}
+		}));
+	}
+
+	template <class Key>
+	void bench_key(std::vector<result_t>& a_results, std::string_view a_key, std::size_t a_size)
+	{
+		const auto hits = make_keys<Key>(0, a_size);
+		const auto misses = make_keys<Key>(a_size, a_size);
+		bench<RE::BSTHashMap<Key, int>>(a_results, "BSTHashMap", a_key, hits, misses);
+		bench<RE::BSTPluginHashMap<Key, int>>(a_results, "BSTPluginHashMap", a_key, hits, misses);
+	}
+}
+
+/**
+ * Times the common table operations from 1k to 10M elements, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto quick = test::quick(a_argc, a_argv);
+	const std::vector<std::size_t> sizes = quick ?
+	                                           std::vector<std::size_t>{ 1'000, 10'000 } :
+	                                           std::vector<std::size_t>{ 1'000, 10'000, 100'000, 1'000'000, 10'000'000 };
+
+	std::vector<result_t> results;
+	for (const auto size : sizes) {
+		bench_key<std::uint32_t>(results, "uint32_t", size);
+		// past 1M the interned string pool dwarfs the tables being measured
+		if (size <= 1'000'000) {
+			bench_key<RE::FixedString>(results, "FixedString", size);
+		}
+	}
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"table\": \"%.*s\", \"key\": \"%.*s\", \"size\": %zu, \"op\": \"%.*s\", \"ns_per_op\": %.2f }%s\n",
+			static_cast<int>(result.table.size()), result.table.data(),
+			static_cast<int>(result.key.size()), result.key.data(),
+			result.size,
+			static_cast<int>(result.op.size()), result.op.data(),
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
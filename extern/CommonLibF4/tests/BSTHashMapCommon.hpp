@@ -0,0 +1,124 @@
+#pragma once
+
+// stand-ins for the game types BSTHashMap.hpp needs, which it leaves out under F4SE_TEST_SUITE
+
+namespace RE
+{
+	namespace test
+	{
+		inline std::size_t allocations{ 0 };
+		inline std::size_t allocatedBytes{ 0 };
+	}
+
+	// the heap allocators call these unqualified, so they replace the game heap
+	[[nodiscard]] inline void* malloc(std::size_t a_size)
+	{
+		++test::allocations;
+		test::allocatedBytes += a_size;
+		return std::malloc(a_size);
+	}
+
+	inline void free(void* a_ptr)
+	{
+		std::free(a_ptr);
+	}
+
+	template <class T1, class T2>
+	struct BSTTuple
+	{
+		using first_type = T1;
+		using second_type = T2;
+
+		BSTTuple() = default;
+
+		template <class U1, class U2>
+		BSTTuple(U1&& a_first, U2&& a_second) :
+			first(std::forward<U1>(a_first)),
+			second(std::forward<U2>(a_second))
+		{
+		}
+
+		T1 first{};
+		T2 second{};
+	};
+
+	class ScrapHeap
+	{
+	public:
+		[[nodiscard]] void* Allocate(std::size_t a_size, std::size_t) { return RE::malloc(a_size); }
+		void Deallocate(void* a_mem) { RE::free(a_mem); }
+	};
+
+	class MemoryManager
+	{
+	public:
+		[[nodiscard]] static MemoryManager& GetSingleton()
+		{
+			static MemoryManager singleton;
+			return singleton;
+		}
+
+		[[nodiscard]] ScrapHeap* GetThreadScrapHeap()
+		{
+			thread_local ScrapHeap heap;
+			return std::addressof(heap);
+		}
+	};
+
+	/**
+	 * Stands in for <code>BSFixedString</code>: strings are interned in a pool, then hashed and
+	 * compared by the address of their pooled data, as the game's string cache does.
+	 */
+	class FixedString
+	{
+	public:
+		FixedString() = default;
+
+		explicit FixedString(std::string_view a_string) :
+			_data(intern(a_string))
+		{
+		}
+
+		[[nodiscard]] const void* hash_accessor() const noexcept { return _data; }
+		[[nodiscard]] std::string_view view() const noexcept { return _data ? std::string_view(_data) : std::string_view(); }
+
+		[[nodiscard]] bool operator==(const FixedString&) const noexcept = default;
+
+	private:
+		[[nodiscard]] static const char* intern(std::string_view a_string)
+		{
+			static std::unordered_set<std::string> pool;
+			return pool.emplace(a_string).first->c_str();
+		}
+
+		const char* _data{ nullptr };
+	};
+}
+
+#include "RE/Bethesda/CRC.hpp"
+
+namespace RE
+{
+	template <>
+	struct BSCRC32<FixedString>
+	{
+		[[nodiscard]] std::uint32_t operator()(const FixedString& a_key) const noexcept
+		{
+			return BSCRC32<const void*>()(a_key.hash_accessor());
+		}
+	};
+
+	// each test is a single translation unit, so these stand in for the ones in Fallout.cpp
+	template struct BSCRC32<std::uint32_t>;
+}
+
+template <>
+struct std::hash<RE::FixedString>
+{
+	[[nodiscard]] std::size_t operator()(const RE::FixedString& a_key) const noexcept
+	{
+		return std::hash<const void*>()(a_key.hash_accessor());
+	}
+};
+
+#include "RE/Bethesda/BSTHashMap.hpp"
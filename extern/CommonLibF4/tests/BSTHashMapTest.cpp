@@ -0,0 +1,195 @@
+#include "BSTHashMapCommon.hpp"
+
+namespace
+{
+	template <class Table>
+	inline constexpr bool IS_SET = std::is_void_v<typename Table::mapped_type>;
+
+	template <class Table>
+	using model_t = std::conditional_t<
+		IS_SET<Table>,
+		std::unordered_set<typename Table::key_type>,
+		std::unordered_map<typename Table::key_type, int>>;
+
+	template <class Table>
+	[[nodiscard]] typename Table::value_type make_value(const typename Table::key_type& a_key, int a_value)
+	{
+		if constexpr (IS_SET<Table>) {
+			return a_key;
+		}
+		else {
+			return { a_key, a_value };
+		}
+	}
+
+	template <class Table>
+	[[nodiscard]] const typename Table::key_type& key_of(const typename Table::value_type& a_value)
+	{
+		if constexpr (IS_SET<Table>) {
+			return a_value;
+		}
+		else {
+			return a_value.first;
+		}
+	}
+
+	template <class Table>
+	[[nodiscard]] bool model_insert(model_t<Table>& a_model, const typename Table::key_type& a_key, int a_value)
+	{
+		if constexpr (IS_SET<Table>) {
+			return a_model.insert(a_key).second;
+		}
+		else {
+			return a_model.emplace(a_key, a_value).second;
+		}
+	}
+
+	// every element of the table is in the model with the same value, and nothing is missing
+	template <class Table>
+	void check_contents(const Table& a_table, const model_t<Table>& a_model)
+	{
+		TEST_CHECK(a_table.size() == a_model.size());
+
+		std::size_t count = 0;
+		for (auto it = a_table.begin(); it != a_table.end(); it++) {
+			const auto found = a_model.find(key_of<Table>(*it));
+			TEST_CHECK(found != a_model.end());
+			if constexpr (!IS_SET<Table>) {
+				TEST_CHECK(found->second == it->second);
+			}
+			++count;
+		}
+		TEST_CHECK(count == a_model.size());
+	}
+
+	/**
+	 * Runs random operations against the table and a standard container, comparing every result.
+	 */
+	template <class Table, class KeyGen>
+	void fuzz(const char* a_name, std::uint32_t a_keyRange, KeyGen a_keyGen)
+	{
+		std::mt19937 rng{ a_keyRange };
+		Table table;
+		model_t<Table> model;
+
+		for (int i = 0; i < 200000; ++i) {
+			const auto key = a_keyGen(rng() % a_keyRange);
+			switch (rng() % 8) {
+				case 0:
+				case 1: {
+					const auto [it, inserted] = table.insert(make_value<Table>(key, i));
+					TEST_CHECK(inserted == model_insert<Table>(model, key, i));
+					TEST_CHECK(key_of<Table>(*it) == key);
+					break;
+				}
+				case 2: {
+					const auto [it, inserted] = table.emplace(make_value<Table>(key, i));
+					TEST_CHECK(inserted == model_insert<Table>(model, key, i));
+					TEST_CHECK(key_of<Table>(*it) == key);
+					break;
+				}
+				case 3:
+					TEST_CHECK(table.erase(key) == model.erase(key));
+					break;
+				case 4:
+					if (const auto it = table.find(key); it != table.end()) {
+						table.erase(it);
+						TEST_CHECK(model.erase(key) == 1);
+					}
+					else {
+						TEST_CHECK(!model.contains(key));
+					}
+					break;
+				case 5: {
+					const auto it = table.find(key);
+					const auto found = model.find(key);
+					TEST_CHECK((it == table.end()) == (found == model.end()));
+					if constexpr (!IS_SET<Table>) {
+						TEST_CHECK(it == table.end() || it->second == found->second);
+					}
+					break;
+				}
+				case 6:
+					if (rng() % 512 == 0) {
+						table.reserve(static_cast<std::uint32_t>(table.size() * 2 + rng() % 64));
+					}
+					break;
+				default:
+					if (rng() % 4096 == 0) {
+						table.clear();
+						model.clear();
+					}
+					else if (rng() % 4096 == 0) {
+						Table copy;
+						copy = table;
+						check_contents(copy, model);
+					}
+					break;
+			}
+
+			TEST_CHECK(table.size() == model.size());
+			if (i % 8192 == 0) {
+				check_contents(table, model);
+			}
+		}
+
+		check_contents(table, model);
+
+		Table copy(table);
+		check_contents(copy, model);
+
+		// tables whose allocator can not be moved fall back to copying
+		if constexpr (std::same_as<typename Table::allocator_type::propagate_on_container_move_assignment, std::true_type>) {
+			Table moved(std::move(copy));
+			TEST_CHECK(copy.empty());
+			check_contents(moved, model);
+
+			Table assigned;
+			assigned = std::move(moved);
+			TEST_CHECK(moved.empty());
+			check_contents(assigned, model);
+		}
+
+		std::printf("%-40s range %5u ok\n", a_name, a_keyRange);
+	}
+
+	[[nodiscard]] std::uint32_t uint_key(std::uint32_t a_index) { return a_index * 0x9E3779B9u; }
+
+	[[nodiscard]] RE::FixedString string_key(std::uint32_t a_index)
+	{
+		static std::vector<RE::FixedString> keys;
+		while (keys.size() <= a_index) {
+			keys.emplace_back(std::format("key_{}", keys.size()));
+		}
+		return keys[a_index];
+	}
+
+	template <class Table>
+	void fuzz_all(const char* a_name)
+	{
+		using key_type = typename Table::key_type;
+		// a small range keeps the table nearly full and its chains long, a large one keeps it growing
+		for (const auto range : { 48u, 5000u }) {
+			if constexpr (std::is_same_v<key_type, std::uint32_t>) {
+				fuzz<Table>(a_name, range, uint_key);
+			}
+			else {
+				fuzz<Table>(a_name, range, string_key);
+			}
+		}
+	}
+}
+
+int main()
+{
+	fuzz_all<RE::BSTHashMap<std::uint32_t, int>>("BSTHashMap<uint32_t>");
+	fuzz_all<RE::BSTHashMap<RE::FixedString, int>>("BSTHashMap<FixedString>");
+	fuzz_all<RE::BSTSet<std::uint32_t>>("BSTSet<uint32_t>");
+	fuzz_all<RE::BSTSet<RE::FixedString>>("BSTSet<FixedString>");
+	fuzz_all<RE::BSTScrapHashMap<std::uint32_t, int>>("BSTScrapHashMap<uint32_t>");
+	fuzz_all<RE::BSTPluginHashMap<std::uint32_t, int>>("BSTPluginHashMap<uint32_t>");
+	fuzz_all<RE::BSTPluginHashMap<RE::FixedString, int>>("BSTPluginHashMap<FixedString>");
+	fuzz_all<RE::BSTPluginSet<RE::FixedString>>("BSTPluginSet<FixedString>");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+#include "BSTHashMapCommon.hpp"
+
+namespace
+{
+	struct result_t
+	{
+		std::string_view table;
+		std::string_view op;
+		std::size_t size;
+		double nsPerOp;
+	};
+
+	[[nodiscard]] std::uint32_t make_key(std::uint32_t a_index) { return a_index * 0x9E3779B9u; }
+
+	/**
+	 * Inserts and erases a whole table, then erases and inserts one key at a time in a table that is
+	 * <code>a_gap</code> slots short of full, which is where the sweep for a free slot is longest.
+	 */
+	template <class Table>
+	void bench(std::vector<result_t>& a_results, std::string_view a_table, std::uint32_t a_size, std::uint32_t a_churnOps)
+	{
+		{
+			Table table;
+			a_results.push_back({ a_table, "insert", a_size, test::time_ns([&] {
+				for (std::uint32_t i = 0; i < a_size; ++i) {
+					table.emplace(make_key(i), 0);
+				}
+			}) / a_size });
+
+			a_results.push_back({ a_table, "erase", a_size, test::time_ns([&] {
+				for (std::uint32_t i = 0; i < a_size; ++i) {
+					table.erase(make_key(i));
+				}
+			}) / a_size });
+			TEST_CHECK(table.empty());
+		}
+
+		for (const auto gap : { 16u, 1024u }) {
+			Table table;
+			table.reserve(a_size);
+
+			std::vector<std::uint32_t> live;
+			for (std::uint32_t i = 0; i < a_size - gap; ++i) {
+				table.emplace(make_key(i), 0);
+				live.push_back(make_key(i));
+			}
+
+			std::mt19937 rng{ gap };
+			auto next = a_size;
+			const auto ns = test::time_ns([&] {
+				for (std::uint32_t i = 0; i < a_churnOps; ++i) {
+					auto& key = live[rng() % live.size()];
+					table.erase(key);
+					key = make_key(next++);
+					table.emplace(key, 0);
+				}
+			});
+			TEST_CHECK(table.size() == a_size - gap);
+
+			a_results.push_back({ a_table, gap == 16 ? "churn_gap_16" : "churn_gap_1024", a_size, ns / a_churnOps });
+		}
+	}
+}
+
+/**
+ * Compares the heap allocator with the one that tracks erased slots, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto quick = test::quick(a_argc, a_argv);
+	const std::uint32_t size = quick ? 1u << 14 : 1u << 20;
+	const std::uint32_t churnOps = quick ? 1'000 : 10'000;
+
+	std::vector<result_t> results;
+	bench<RE::BSTHashMap<std::uint32_t, int>>(results, "BSTHashMap", size, churnOps);
+	bench<RE::BSTPluginHashMap<std::uint32_t, int>>(results, "BSTPluginHashMap", size, churnOps);
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"table\": \"%.*s\", \"op\": \"%.*s\", \"size\": %zu, \"ns_per_op\": %.2f }%s\n",
+			static_cast<int>(result.table.size()), result.table.data(),
+			static_cast<int>(result.op.size()), result.op.data(),
+			result.size,
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+#include "BSTHashMapCommon.hpp"
+
+namespace
+{
+	// puts every key in the slot it names, so tests can tell which free slot an insert took
+	struct identity_hash
+	{
+		[[nodiscard]] std::uint32_t operator()(std::uint32_t a_key) const noexcept { return a_key; }
+	};
+
+	using slot_map_t = RE::BSTPluginHashMap<std::uint32_t, int, identity_hash>;
+
+	// iteration walks the slots in order, so this is the key in each taken slot
+	template <class Table>
+	[[nodiscard]] std::vector<std::uint32_t> keys_by_slot(const Table& a_table)
+	{
+		std::vector<std::uint32_t> keys;
+		for (const auto& [key, value] : a_table) {
+			keys.push_back(key);
+		}
+		return keys;
+	}
+
+	[[nodiscard]] slot_map_t make_full_map()
+	{
+		slot_map_t map;
+		for (std::uint32_t i = 0; i < slot_map_t::allocator_type::min_size(); ++i) {
+			map.emplace(i, 0);
+		}
+		return map;
+	}
+
+	void test_reuses_most_recent_slot()
+	{
+		auto map = make_full_map();
+		map.erase(3);
+		map.erase(5);
+
+		// the sweep would take slot 3 first, the free list hands back slot 5
+		map.emplace(8, 0);
+		TEST_CHECK(keys_by_slot(map) == std::vector<std::uint32_t>({ 0, 1, 2, 4, 8, 6, 7 }));
+	}
+
+	void test_skips_reclaimed_slots()
+	{
+		auto map = make_full_map();
+		map.erase(3);
+		map.erase(5);
+		map.emplace(5, 0);  // takes its home slot back, leaving a stale entry in the free list
+
+		map.emplace(8, 0);
+		TEST_CHECK(keys_by_slot(map) == std::vector<std::uint32_t>({ 0, 1, 2, 8, 4, 5, 6, 7 }));
+	}
+
+	void test_stale_overflow()
+	{
+		auto map = make_full_map();
+		const auto capacity = slot_map_t::allocator_type::min_size();
+
+		// every round leaves one more stale slot, and the last one finds the free list full and drops it
+		for (std::uint32_t i = 0; i <= capacity; ++i) {
+			TEST_CHECK(map.erase(1) == 1);
+			TEST_CHECK(map.emplace(1, static_cast<int>(i)).second);
+		}
+		TEST_CHECK(map.find(1)->second == static_cast<int>(capacity));
+
+		// slots erased after the reset are tracked again
+		map.erase(3);
+		map.erase(6);
+		map.emplace(9, 0);
+		TEST_CHECK(keys_by_slot(map) == std::vector<std::uint32_t>({ 0, 1, 2, 4, 5, 9, 7 }));
+	}
+
+	// erasing and inserting in a full table only ever reuses slots, so it never grows or allocates
+	template <class Table>
+	void test_full_churn()
+	{
+		constexpr std::uint32_t capacity = 1u << 10;
+
+		Table table;
+		table.reserve(capacity);
+		std::vector<std::uint32_t> live;
+		for (std::uint32_t i = 0; i < capacity; ++i) {
+			TEST_CHECK(table.emplace(i, static_cast<int>(i)).second);
+			live.push_back(i);
+		}
+
+		const auto allocations = RE::test::allocations;
+		std::mt19937 rng{ capacity };
+		auto next = capacity;
+		for (int i = 0; i < 100000; ++i) {
+			const auto index = rng() % live.size();
+			TEST_CHECK(table.erase(live[index]) == 1);
+			TEST_CHECK(table.emplace(next, static_cast<int>(next)).second);
+			live[index] = next++;
+		}
+		TEST_CHECK(RE::test::allocations == allocations);
+
+		TEST_CHECK(table.size() == capacity);
+		for (const auto key : live) {
+			const auto it = table.find(key);
+			TEST_CHECK(it != table.end() && it->second == static_cast<int>(key));
+		}
+	}
+}
+
+int main()
+{
+	test_reuses_most_recent_slot();
+	test_skips_reclaimed_slots();
+	test_stale_overflow();
+	test_full_churn<RE::BSTHashMap<std::uint32_t, int>>();
+	test_full_churn<RE::BSTPluginHashMap<std::uint32_t, int>>();
+
+	return EXIT_SUCCESS;
+}
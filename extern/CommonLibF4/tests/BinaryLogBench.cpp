@@ -0,0 +1,94 @@
+#include "F4SE/BinaryLog.hpp"
+#include "F4SE/Logger.hpp"
+
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include <sstream>
+
+namespace
+{
+	struct result_t
+	{
+		std::string_view method;
+		std::string_view args;
+		double nsPerOp;
+	};
+
+	// bursts stay within one ring, so the binary log is timed writing rather than dropping
+	inline constexpr int BURST = 1000;
+
+	void binary_ints(int a_index) { F4SE::log::binary::info("frame {} took {}us", a_index, a_index * 2); }
+	void binary_mixed(int a_index) { F4SE::log::binary::info("{} moved {:.2f} units to cell {}", "actor", a_index * 0.5, a_index); }
+	void spdlog_ints(int a_index) { F4SE::log::info("frame {} took {}us", a_index, a_index * 2); }
+	void spdlog_mixed(int a_index) { F4SE::log::info("{} moved {:.2f} units to cell {}", "actor", a_index * 0.5, a_index); }
+}
+
+/**
+ * Times a log call into the binary log against the same call through F4SE::log into the file sink
+ * log::init sets up, both on one thread in bursts of 1000, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto bursts = test::quick(a_argc, a_argv) ? 2 : 200;
+
+	const auto root = std::filesystem::temp_directory_path() / "f4se_binary_log_bench";
+	std::filesystem::create_directories(root);
+	const F4SE::stl::scope_exit cleanup([&] {
+		std::error_code ec;
+		std::filesystem::remove_all(root, ec);
+	});
+
+	auto logger = std::make_shared<spdlog::logger>("bench", std::make_shared<spdlog::sinks::basic_file_sink_mt>((root / "text.log").string(), true));
+	logger->set_level(spdlog::level::info);
+	logger->flush_on(spdlog::level::info);
+	spdlog::set_default_logger(std::move(logger));
+	spdlog::set_pattern("[%T.%e] [%l] %v");
+	F4SE::log::set_rate_limit(0);
+
+	auto& binary = F4SE::log::BinaryLog::get();
+	TEST_CHECK(binary.open(root / "binary.log"));
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_method, std::string_view a_args, auto a_site) {
+		double total = 0.0;
+		for (int burst = 0; burst < bursts; ++burst) {
+			total += test::time_ns([&] {
+				for (int i = 0; i < BURST; ++i) {
+					a_site(i);
+				}
+			});
+
+			// let the background thread empty the ring before the next burst
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		results.push_back({ a_method, a_args, total / (bursts * BURST) });
+	};
+
+	run("BinaryLog", "ints", binary_ints);
+	run("spdlog", "ints", spdlog_ints);
+	run("BinaryLog", "mixed", binary_mixed);
+	run("spdlog", "mixed", spdlog_mixed);
+
+	binary.close();
+	spdlog::default_logger()->flush();
+
+	// no record was dropped, and both logs hold every line
+	std::ifstream in{ root / "binary.log", std::ios::binary };
+	std::ostringstream text;
+	TEST_CHECK(F4SE::log::DecodeBinaryLog(in, text));
+	TEST_CHECK(static_cast<std::size_t>(std::ranges::count(text.str(), '\n')) == static_cast<std::size_t>(2 * bursts * BURST));
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"args\": \"%.*s\", \"ns_per_op\": %.2f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			static_cast<int>(result.args.size()), result.args.data(),
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,191 @@
+#include "F4SE/BinaryLog.hpp"
+
+#include <sstream>
+
+namespace
+{
+	enum class Color : std::uint8_t
+	{
+		kRed = 3
+	};
+
+	struct files_t
+	{
+		files_t()
+		{
+			std::filesystem::create_directories(root);
+		}
+
+		~files_t()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(root, ec);
+		}
+
+		std::filesystem::path root{ std::filesystem::temp_directory_path() / "f4se_binary_log_test" };
+		std::filesystem::path log{ root / "binary.log" };
+	};
+
+	[[nodiscard]] std::string read(const std::filesystem::path& a_path)
+	{
+		std::ifstream file{ a_path, std::ios::binary };
+		return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	}
+
+	[[nodiscard]] std::optional<std::vector<std::string>> decode(std::string_view a_bytes)
+	{
+		std::istringstream in{ std::string(a_bytes) };
+		std::ostringstream out;
+		if (!F4SE::log::DecodeBinaryLog(in, out)) {
+			return std::nullopt;
+		}
+
+		std::vector<std::string> lines;
+		std::istringstream text{ out.str() };
+		for (std::string line; std::getline(text, line);) {
+			lines.push_back(line);
+		}
+		return lines;
+	}
+
+	// the text after the timestamp and thread, e.g. "[12:00:00.000] [info] [0] text" is "[info] text"
+	[[nodiscard]] std::string strip(std::string_view a_line)
+	{
+		const auto level = a_line.find("] [") + 2;
+		const auto thread = a_line.find("] [", level) + 2;
+		const auto text = a_line.find("] ", thread) + 2;
+		return std::string(a_line.substr(level, thread - level)) + std::string(a_line.substr(text));
+	}
+
+	void test_round_trip(const files_t& a_files)
+	{
+		auto& log = F4SE::log::BinaryLog::get();
+
+		// nothing is kept from before the log is opened
+		F4SE::log::binary::info("before open");
+		TEST_CHECK(!log.is_open());
+
+		TEST_CHECK(log.open(a_files.log));
+		TEST_CHECK(log.is_open());
+
+		const char* null = nullptr;
+		F4SE::log::binary::trace("ints {} {} {}", -1, 42u, std::int64_t{ -1 } << 40);
+		F4SE::log::binary::debug("float {:.3f} bool {} char {}", 0.5f, true, 'x');
+		F4SE::log::binary::info("strings {} {} {}", "literal", std::string("owned"), null);
+		F4SE::log::binary::warn("enum {} hex {:#x} escaped {{}}", Color::kRed, 255);
+		F4SE::log::binary::error("too few {} {}", 1);
+		F4SE::log::binary::critical("padded [{:>5}]", 7);
+		log.close();
+		TEST_CHECK(!log.is_open());
+
+		// written after closing, so dropped
+		F4SE::log::binary::info("after close");
+
+		const auto lines = decode(read(a_files.log));
+		TEST_CHECK(lines && lines->size() == 6);
+		TEST_CHECK(strip((*lines)[0]) == "[trace] ints -1 42 -1099511627776");
+		TEST_CHECK(strip((*lines)[1]) == "[debug] float 0.500 bool true char x");
+		TEST_CHECK(strip((*lines)[2]) == "[info] strings literal owned (null)");
+		TEST_CHECK(strip((*lines)[3]) == "[warning] enum 3 hex 0xff escaped {}");
+		TEST_CHECK(strip((*lines)[4]) == "[error] too few 1 {}");
+		TEST_CHECK(strip((*lines)[5]) == "[critical] padded [    7]");
+	}
+
+	void test_threads(const files_t& a_files)
+	{
+		auto& log = F4SE::log::BinaryLog::get();
+		TEST_CHECK(log.open(a_files.log));
+
+		// a long string is cut to what fits into one record
+		F4SE::log::binary::info("long {}", std::string(2 * F4SE::log::BinaryLog::MAX_RECORD, 'a'));
+
+		// threads share call site ids, and whatever does not fit into a ring is counted, not lost silently
+		constexpr int THREADS = 4;
+		constexpr int CALLS = 20000;
+		std::vector<std::jthread> threads;
+		for (int i = 0; i < THREADS; ++i) {
+			threads.emplace_back([i] {
+				for (int call = 0; call < CALLS; ++call) {
+					F4SE::log::binary::info("thread {} call {}", i, call);
+				}
+			});
+		}
+		threads.clear();
+		log.close();
+
+		const auto lines = decode(read(a_files.log));
+		TEST_CHECK(lines.has_value());
+
+		std::size_t logged = 0;
+		std::size_t dropped = 0;
+		auto previous = std::string();
+		for (const auto& line : *lines) {
+			if (line.ends_with("record(s) were dropped because a ring buffer was full")) {
+				dropped += std::stoull(line);
+				continue;
+			}
+
+			// records from every thread come out in timestamp order
+			const auto time = line.substr(0, line.find(']'));
+			TEST_CHECK(time >= previous);
+			previous = time;
+
+			if (line.find("] long ") != std::string::npos) {
+				TEST_CHECK(line.size() < F4SE::log::BinaryLog::MAX_RECORD + 32);
+				TEST_CHECK(line.ends_with("aaaa"));
+				continue;
+			}
+
+			TEST_CHECK(line.find("] thread ") != std::string::npos);
+			++logged;
+		}
+		TEST_CHECK(logged + dropped == THREADS * CALLS);
+	}
+
+	void test_reopen(const files_t& a_files)
+	{
+		auto& log = F4SE::log::BinaryLog::get();
+
+		// a second file describes its call sites again, even those already seen
+		for (int i = 0; i < 2; ++i) {
+			TEST_CHECK(log.open(a_files.log));
+			F4SE::log::binary::info("reopened {}", i);
+			log.close();
+
+			const auto lines = decode(read(a_files.log));
+			TEST_CHECK(lines && lines->size() == 1);
+			TEST_CHECK(strip(lines->front()) == std::format("[info] reopened {}", i));
+		}
+
+		// closing twice is harmless
+		log.close();
+	}
+
+	void test_corrupt(const files_t& a_files)
+	{
+		const auto bytes = read(a_files.log);
+		TEST_CHECK(decode(bytes).has_value());
+
+		// a wrong magic, or a file cut anywhere short of a whole chunk, fails to decode
+		auto wrong = bytes;
+		wrong[0] = 'X';
+		TEST_CHECK(!decode(wrong));
+		TEST_CHECK(!decode(""));
+		for (std::size_t size = 1; size < bytes.size(); ++size) {
+			const auto lines = decode(std::string_view(bytes).substr(0, size));
+			TEST_CHECK(!lines || lines->empty());
+		}
+	}
+}
+
+int main()
+{
+	const files_t files;
+
+	test_round_trip(files);
+	test_threads(files);
+	test_reopen(files);
+	test_corrupt(files);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+#include "F4SE/Serialization.hpp"
+
+namespace
+{
+	using bytes_t = std::vector<std::byte>;
+
+	struct result_t
+	{
+		std::string_view data;
+		std::size_t size;
+		std::size_t compressedSize;
+		double compressNs;
+		double decompressNs;
+	};
+
+	// the kinds of body a plugin saves: form id tables, packed state, and noise such as hashes
+	struct ref_state_t
+	{
+		std::uint32_t formID;
+		std::uint32_t baseID;
+		float position[3];
+		std::uint16_t flags;
+		std::uint16_t count;
+	};
+
+	[[nodiscard]] bytes_t make_refs(std::mt19937& a_rng, std::size_t a_size)
+	{
+		std::vector<ref_state_t> refs(a_size / sizeof(ref_state_t));
+		for (std::size_t i = 0; i < refs.size(); ++i) {
+			const auto cell = static_cast<float>(a_rng() % 8) * 4096.0f;
+			refs[i] = {
+				static_cast<std::uint32_t>(0x01000800 + i),
+				static_cast<std::uint32_t>(0x0001F000 + a_rng() % 64),
+				{ cell + static_cast<float>(a_rng() % 4096), cell, 0.0f },
+				static_cast<std::uint16_t>(a_rng() % 2 ? 0x0400 : 0),
+				1
+			};
+		}
+
+		bytes_t result(a_size);
+		std::memcpy(result.data(), refs.data(), refs.size() * sizeof(ref_state_t));
+		return result;
+	}
+
+	[[nodiscard]] bytes_t make_text(std::mt19937& a_rng, std::size_t a_size)
+	{
+		constexpr std::array<std::string_view, 8> WORDS{ "Settlement", "Workshop", "Power", "Water", "Food", "Defense", "Happiness", "Beds" };
+
+		bytes_t result;
+		result.reserve(a_size);
+		while (result.size() < a_size) {
+			const auto word = WORDS[a_rng() % WORDS.size()];
+			for (const auto c : word) {
+				result.push_back(static_cast<std::byte>(c));
+			}
+			result.push_back(std::byte{ ' ' });
+		}
+		result.resize(a_size);
+		return result;
+	}
+
+	[[nodiscard]] bytes_t make_noise(std::mt19937& a_rng, std::size_t a_size)
+	{
+		bytes_t result(a_size);
+		for (auto& byte : result) {
+			byte = static_cast<std::byte>(a_rng());
+		}
+		return result;
+	}
+}
+
+/**
+ * Times compressing and decompressing 64KiB and 4MiB record bodies of reference state, text and
+ * noise, and prints the ratio and throughput of each as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto quick = test::quick(a_argc, a_argv);
+	const std::array sizes{ std::size_t{ 1u << 16 }, quick ? std::size_t{ 1u << 18 } : std::size_t{ 1u << 22 } };
+	const auto rounds = quick ? 2 : 20;
+
+	std::mt19937 rng{ 0xC0DE };
+
+	std::vector<result_t> results;
+	for (const auto size : sizes) {
+		const std::array<std::pair<std::string_view, bytes_t>, 3> inputs{ {
+			{ "refs", make_refs(rng, size) },
+			{ "text", make_text(rng, size) },
+			{ "noise", make_noise(rng, size) },
+		} };
+
+		for (const auto& [name, src] : inputs) {
+			bytes_t compressed;
+			const auto compressNs = test::time_ns([&] {
+				for (int i = 0; i < rounds; ++i) {
+					F4SE::detail::lz_compress(src, compressed);
+				}
+			}) / rounds;
+
+			bytes_t result(src.size());
+			const auto decompressNs = test::time_ns([&] {
+				for (int i = 0; i < rounds; ++i) {
+					TEST_CHECK(F4SE::detail::lz_decompress(compressed, result));
+				}
+			}) / rounds;
+			TEST_CHECK(result == src);
+
+			results.push_back({ name, size, compressed.size(), compressNs, decompressNs });
+		}
+	}
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"data\": \"%.*s\", \"bytes\": %zu, \"ratio\": %.3f, \"compress_mb_per_s\": %.1f, \"decompress_mb_per_s\": %.1f }%s\n",
+			static_cast<int>(result.data.size()), result.data.data(),
+			result.size,
+			static_cast<double>(result.compressedSize) / static_cast<double>(result.size),
+			static_cast<double>(result.size) / result.compressNs * 1e3,
+			static_cast<double>(result.size) / result.decompressNs * 1e3,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,222 @@
+#include "F4SE/Serialization.hpp"
+
+namespace
+{
+	using bytes_t = std::vector<std::byte>;
+
+	[[nodiscard]] bytes_t random_bytes(std::mt19937_64& a_rng, std::size_t a_size)
+	{
+		bytes_t result(a_size);
+		for (auto& byte : result) {
+			byte = static_cast<std::byte>(a_rng());
+		}
+		return result;
+	}
+
+	[[nodiscard]] bytes_t repeat(std::string_view a_pattern, std::size_t a_size)
+	{
+		bytes_t result(a_size);
+		for (std::size_t i = 0; i < a_size; ++i) {
+			result[i] = static_cast<std::byte>(a_pattern[i % a_pattern.size()]);
+		}
+		return result;
+	}
+
+	// short runs of a few symbols, so matches of every length and offset turn up
+	[[nodiscard]] bytes_t mixed_bytes(std::mt19937_64& a_rng, std::size_t a_size)
+	{
+		bytes_t result;
+		result.reserve(a_size);
+		while (result.size() < a_size) {
+			const auto byte = static_cast<std::byte>(a_rng() % 4);
+			result.insert(result.end(), std::min<std::size_t>(1 + a_rng() % 40, a_size - result.size()), byte);
+		}
+		return result;
+	}
+
+	[[nodiscard]] bytes_t compress(const bytes_t& a_src)
+	{
+		bytes_t result;
+		F4SE::detail::lz_compress(a_src, result);
+		return result;
+	}
+
+	void check_round_trip(const bytes_t& a_src)
+	{
+		const auto compressed = compress(a_src);
+		TEST_CHECK(compressed.size() <= a_src.size() + a_src.size() / 255 + 16);
+
+		bytes_t result(a_src.size());
+		TEST_CHECK(F4SE::detail::lz_decompress(compressed, result));
+		TEST_CHECK(result == a_src);
+
+		// the raw length is part of the format, so any other one fails
+		bytes_t shorter(a_src.size() + 1);
+		TEST_CHECK(!F4SE::detail::lz_decompress(compressed, shorter));
+		if (!a_src.empty()) {
+			bytes_t longer(a_src.size() - 1);
+			TEST_CHECK(!F4SE::detail::lz_decompress(compressed, longer));
+		}
+	}
+
+	void test_round_trips(std::mt19937_64& a_rng)
+	{
+		// empty, and shorter than a match
+		for (std::size_t size = 0; size <= 8; ++size) {
+			check_round_trip(random_bytes(a_rng, size));
+		}
+
+		// incompressible input only grows by the literal length bytes
+		const auto noise = random_bytes(a_rng, 100'000);
+		check_round_trip(noise);
+		TEST_CHECK(compress(noise).size() <= noise.size() + noise.size() / 255 + 16);
+
+		// long runs need many length bytes
+		const auto zeros = bytes_t(1u << 20);
+		check_round_trip(zeros);
+		TEST_CHECK(compress(zeros).size() < 5'000);
+
+		// a match overlapping its own output, at offsets 1 to 3
+		check_round_trip(repeat("a", 1000));
+		check_round_trip(repeat("ab", 1000));
+		check_round_trip(repeat("abc", 1000));
+		TEST_CHECK(compress(repeat("ab", 1000)).size() < 16);
+
+		// matches further back than the window reach are written as literals
+		auto far = random_bytes(a_rng, 0x20000);
+		std::copy_n(far.begin(), 64, far.begin() + 0x10000 + 64);
+		check_round_trip(far);
+
+		for (std::size_t size = 0; size < 600; ++size) {
+			check_round_trip(mixed_bytes(a_rng, size));
+		}
+	}
+
+	void test_corrupt_streams(std::mt19937_64& a_rng)
+	{
+		const auto src = mixed_bytes(a_rng, 4'000);
+		const auto compressed = compress(src);
+		bytes_t result(src.size());
+
+		// every truncation comes up short of the raw length
+		for (std::size_t size = 0; size < compressed.size(); ++size) {
+			TEST_CHECK(!F4SE::detail::lz_decompress(std::span{ compressed }.first(size), result));
+		}
+
+		// flipped bytes may still decode, but never past either buffer
+		for (std::size_t i = 0; i < 2'000; ++i) {
+			auto corrupt = compressed;
+			corrupt[a_rng() % corrupt.size()] ^= static_cast<std::byte>(1 + a_rng() % 255);
+			test::do_not_optimize(F4SE::detail::lz_decompress(corrupt, result));
+		}
+
+		// a back reference of 0, and one before the start of the output
+		const bytes_t zeroOffset{ std::byte{ 0x10 }, std::byte{ 'a' }, std::byte{ 0 }, std::byte{ 0 }, std::byte{ 0 } };
+		const bytes_t farOffset{ std::byte{ 0x10 }, std::byte{ 'a' }, std::byte{ 2 }, std::byte{ 0 }, std::byte{ 0 } };
+		bytes_t five(5);
+		TEST_CHECK(!F4SE::detail::lz_decompress(zeroOffset, five));
+		TEST_CHECK(!F4SE::detail::lz_decompress(farOffset, five));
+
+		// literal lengths which run off the end of the input
+		const bytes_t unterminated{ std::byte{ 0xF0 }, std::byte{ 0xFF }, std::byte{ 0xFF } };
+		const bytes_t overlong{ std::byte{ 0xF0 }, std::byte{ 0x10 }, std::byte{ 'a' } };
+		TEST_CHECK(!F4SE::detail::lz_decompress(unterminated, result));
+		TEST_CHECK(!F4SE::detail::lz_decompress(overlong, result));
+	}
+
+	void test_records(std::mt19937_64& a_rng)
+	{
+		F4SE::SerializationInterface intfc;
+
+		const auto compressible = mixed_bytes(a_rng, 10'000);
+		const auto noise = random_bytes(a_rng, 1'000);
+		const auto small = mixed_bytes(a_rng, 100);
+
+		TEST_CHECK(F4SE::WriteCompressedRecord(intfc, 1, 1, compressible));
+		TEST_CHECK(F4SE::WriteCompressedRecord(intfc, 2, 1, noise));
+		TEST_CHECK(F4SE::WriteCompressedRecord(intfc, 3, 1, small));
+		TEST_CHECK(F4SE::WriteCompressedRecord(intfc, 4, 1, compressible, F4SE::RecordCodec::kNone));
+		TEST_CHECK(F4SE::WriteCompressedRecord(intfc, 5, 1, {}));
+
+		// only the record which shrinks is stored compressed
+		TEST_CHECK(intfc.records[0].data.size() < compressible.size() / 2);
+		TEST_CHECK(intfc.records[1].data.size() == noise.size() + 8);
+		TEST_CHECK(intfc.records[2].data.size() == small.size() + 8);
+		TEST_CHECK(intfc.records[3].data.size() == compressible.size() + 8);
+
+		for (const auto& expected : { compressible, noise, small, compressible, bytes_t{} }) {
+			std::uint32_t type = 0;
+			std::uint32_t version = 0;
+			std::uint32_t length = 0;
+			TEST_CHECK(intfc.GetNextRecordInfo(type, version, length));
+
+			const auto body = F4SE::ReadCompressedRecord(intfc, length);
+			TEST_CHECK(body && *body == expected);
+		}
+	}
+
+	// F4SE reports the length of the current record, so these feed a corrupt record to the reader
+	[[nodiscard]] std::optional<bytes_t> read_record(const bytes_t& a_data)
+	{
+		F4SE::SerializationInterface intfc;
+		intfc.OpenRecord(1, 1);
+		intfc.WriteRecordData(a_data.data(), static_cast<std::uint32_t>(a_data.size()));
+
+		std::uint32_t type = 0;
+		std::uint32_t version = 0;
+		std::uint32_t length = 0;
+		intfc.GetNextRecordInfo(type, version, length);
+		return F4SE::ReadCompressedRecord(intfc, length);
+	}
+
+	void test_corrupt_records()
+	{
+		F4SE::SerializationInterface intfc;
+		TEST_CHECK(F4SE::WriteCompressedRecord(intfc, 1, 1, repeat("abcd", 1000)));
+		const auto good = intfc.records[0].data;
+		TEST_CHECK(read_record(good));
+
+		// shorter than the header
+		TEST_CHECK(!read_record(bytes_t(good.begin(), good.begin() + 7)));
+
+		// a raw length no body this size could decode to is refused before it is allocated
+		auto huge = good;
+		const std::uint32_t rawLength = 0xFFFFFFFF;
+		std::memcpy(huge.data() + 4, std::addressof(rawLength), sizeof(rawLength));
+		TEST_CHECK(!read_record(huge));
+
+		// a raw length within the bound, but not the one the body decodes to
+		auto wrong = good;
+		const std::uint32_t wrongLength = 1001;
+		std::memcpy(wrong.data() + 4, std::addressof(wrongLength), sizeof(wrongLength));
+		TEST_CHECK(!read_record(wrong));
+
+		// the trailing literal token may go, but not the match length before it
+		auto truncated = good;
+		truncated.resize(truncated.size() - 2);
+		TEST_CHECK(!read_record(truncated));
+
+		auto unknown = good;
+		unknown[0] = std::byte{ 0x7F };
+		TEST_CHECK(!read_record(unknown));
+
+		// an uncompressed body whose length disagrees with the header
+		intfc.Reset();
+		TEST_CHECK(F4SE::WriteCompressedRecord(intfc, 4, 1, repeat("abcd", 100), F4SE::RecordCodec::kNone));
+		auto stored = intfc.records[0].data;
+		stored.pop_back();
+		TEST_CHECK(!read_record(stored));
+	}
+}
+
+int main()
+{
+	std::mt19937_64 rng{ 0x12AB };
+
+	test_round_trips(rng);
+	test_corrupt_streams(rng);
+	test_records(rng);
+	test_corrupt_records();
+
+	return EXIT_SUCCESS;
+}
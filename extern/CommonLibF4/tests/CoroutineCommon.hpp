@@ -0,0 +1,61 @@
+#pragma once
+
+#include "F4SE/Coroutine.hpp"
+
+namespace test
+{
+	/**
+	 * Stands in for TaskInterface. Each frame runs the game's own work, then the tasks posted before
+	 * the frame began, then the UI tasks.
+	 *
+	 * <p>
+	 * The time it keeps is simulated, and only moves when a frame or the work it runs advances it,
+	 * so frame budgets and delays play out the same on every run.
+	 * </p>
+	 */
+	class FrameLoop :
+		public F4SE::CoroutineExecutor
+	{
+	public:
+		using clock_type = std::chrono::steady_clock;
+
+		void post(std::function<void()> a_task) override
+		{
+			tasks.push_back(std::move(a_task));
+			++posted;
+		}
+
+		void post_ui(std::function<void()> a_task) override
+		{
+			uiTasks.push_back(std::move(a_task));
+			++postedUI;
+		}
+
+		/**
+		 * Runs one frame, returning how much simulated time it took. Frames are counted from 1.
+		 */
+		std::chrono::microseconds frame(std::chrono::microseconds a_gameWork)
+		{
+			++frames;
+			const auto start = simulated;
+			simulated += a_gameWork;
+			for (auto& task : std::exchange(tasks, {})) {
+				task();
+			}
+			for (auto& task : std::exchange(uiTasks, {})) {
+				task();
+			}
+			return std::chrono::duration_cast<std::chrono::microseconds>(simulated - start);
+		}
+
+		[[nodiscard]] static clock_type::time_point now() { return simulated; }
+
+		inline static clock_type::time_point simulated{};
+
+		std::vector<std::function<void()>> tasks;
+		std::vector<std::function<void()>> uiTasks;
+		std::size_t posted{ 0 };
+		std::size_t postedUI{ 0 };
+		std::size_t frames{ 0 };
+	};
+}
@@ -0,0 +1,213 @@
+#include "F4SE/Coroutine.hpp"
+#include "F4SE/Logger.hpp"
+
+#include "CoroutineCommon.hpp"
+
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <sstream>
+
+namespace
+{
+	using milliseconds = std::chrono::milliseconds;
+
+	inline constexpr milliseconds FRAME{ 16 };
+
+	test::FrameLoop loop;
+	std::ostringstream output;
+
+	// the frame each step of the coroutine ran in, where 0 is before the first frame
+	F4SE::Coroutine count_frames(std::vector<std::size_t>& a_seen, int a_frames)
+	{
+		for (int i = 0; i < a_frames; ++i) {
+			a_seen.push_back(loop.frames);
+			co_await F4SE::NextFrame{};
+		}
+		a_seen.push_back(loop.frames);
+	}
+
+	F4SE::Coroutine wait_twice(std::size_t& a_resumed)
+	{
+		co_await F4SE::NextFrame{};
+		++a_resumed;
+		co_await F4SE::NextFrame{};
+		++a_resumed;
+	}
+
+	F4SE::Coroutine delayed(milliseconds a_delay, std::vector<std::pair<std::size_t, test::FrameLoop::clock_type::time_point>>& a_resumed)
+	{
+		co_await F4SE::Delay{ a_delay };
+		a_resumed.emplace_back(loop.frames, test::FrameLoop::now());
+	}
+
+	F4SE::Coroutine next_frame_then(std::vector<std::string>& a_order, std::string a_name)
+	{
+		co_await F4SE::NextFrame{};
+		a_order.push_back(std::move(a_name));
+	}
+
+	F4SE::Coroutine ui_then(std::vector<std::string>& a_order, std::string a_name)
+	{
+		co_await F4SE::UIThread{};
+		a_order.push_back(std::move(a_name));
+	}
+
+	F4SE::Coroutine throw_next_frame()
+	{
+		co_await F4SE::NextFrame{};
+		throw std::runtime_error("boom");
+	}
+
+	void test_next_frame()
+	{
+		const auto posted = loop.posted;
+		const auto start = loop.frames;
+
+		// the coroutine runs eagerly up to its first suspension, then one step per frame
+		std::vector<std::size_t> seen;
+		count_frames(seen, 3);
+		TEST_CHECK(seen == std::vector<std::size_t>({ start }));
+		TEST_CHECK(F4SE::CoroutineScheduler::get().pending() == 1);
+
+		for (int i = 0; i < 3; ++i) {
+			std::ignore = loop.frame(FRAME);
+		}
+		TEST_CHECK(seen == std::vector<std::size_t>({ start, start + 1, start + 2, start + 3 }));
+
+		// one task per frame it waited on, and nothing once it is done
+		TEST_CHECK(loop.posted - posted == 3);
+		TEST_CHECK(loop.tasks.empty());
+		TEST_CHECK(F4SE::CoroutineScheduler::get().pending() == 0);
+	}
+
+	void test_batched()
+	{
+		constexpr std::size_t COROUTINES = 1000;
+		const auto posted = loop.posted;
+
+		// every continuation due in a frame is resumed from the one task posted for it
+		std::size_t resumed = 0;
+		for (std::size_t i = 0; i < COROUTINES; ++i) {
+			wait_twice(resumed);
+		}
+		TEST_CHECK(loop.posted - posted == 1);
+		TEST_CHECK(F4SE::CoroutineScheduler::get().pending() == COROUTINES);
+
+		std::ignore = loop.frame(FRAME);
+		TEST_CHECK(resumed == COROUTINES);
+		TEST_CHECK(loop.posted - posted == 2);
+
+		std::ignore = loop.frame(FRAME);
+		TEST_CHECK(resumed == 2 * COROUTINES);
+		TEST_CHECK(loop.posted - posted == 2);
+		TEST_CHECK(F4SE::CoroutineScheduler::get().pending() == 0);
+	}
+
+	void test_delay()
+	{
+		const auto posted = loop.posted;
+		const auto start = loop.frames;
+		const auto now = test::FrameLoop::now();
+
+		// each delay resumes on the first frame it has elapsed by, shortest first
+		std::vector<std::pair<std::size_t, test::FrameLoop::clock_type::time_point>> resumed;
+		delayed(milliseconds{ 100 }, resumed);
+		delayed(milliseconds{ 20 }, resumed);
+		delayed(milliseconds{ 0 }, resumed);
+		TEST_CHECK(resumed.empty());
+
+		// a coroutine waiting on the next frame shares the frame task the timers poll from
+		std::size_t waited = 0;
+		wait_twice(waited);
+		TEST_CHECK(loop.posted - posted == 1);
+
+		for (int i = 0; i < 8; ++i) {
+			std::ignore = loop.frame(FRAME);
+		}
+
+		TEST_CHECK(resumed.size() == 3);
+		TEST_CHECK(resumed[0].first == start + 1);
+		TEST_CHECK(resumed[1].first == start + 2 && resumed[1].second - now >= milliseconds{ 20 });
+		TEST_CHECK(resumed[2].first == start + 7 && resumed[2].second - now >= milliseconds{ 100 });
+		TEST_CHECK(waited == 2);
+
+		// the timers were polled once per frame until the last one fired, and then not at all
+		TEST_CHECK(loop.posted - posted == 7);
+		TEST_CHECK(loop.tasks.empty());
+	}
+
+	void test_ui()
+	{
+		const auto posted = loop.posted;
+		const auto postedUI = loop.postedUI;
+
+		// the UI batch is posted on its own, and runs after the main thread's in the simulated frame
+		std::vector<std::string> order;
+		ui_then(order, "ui 1");
+		next_frame_then(order, "main");
+		ui_then(order, "ui 2");
+		TEST_CHECK(loop.postedUI - postedUI == 1);
+		TEST_CHECK(loop.posted - posted == 1);
+
+		std::ignore = loop.frame(FRAME);
+		TEST_CHECK(order == std::vector<std::string>({ "main", "ui 1", "ui 2" }));
+		TEST_CHECK(F4SE::CoroutineScheduler::get().pending() == 0);
+	}
+
+	void test_frame_pool()
+	{
+		using pool = F4SE::detail::CoroutineFramePool;
+
+		// frames of the same 64 byte class share memory once released
+		const auto first = pool::allocate(100);
+		pool::deallocate(first, 100);
+		const auto second = pool::allocate(120);
+		TEST_CHECK(second == first);
+
+		const auto other = pool::allocate(200);
+		TEST_CHECK(other != second);
+		pool::deallocate(second, 120);
+		pool::deallocate(other, 200);
+
+		// frames too large to pool come from the global allocator
+		const auto large = pool::allocate(1u << 16);
+		TEST_CHECK(large != nullptr);
+		pool::deallocate(large, 1u << 16);
+	}
+
+	void test_exception()
+	{
+		// an exception is logged, and the rest of the batch still runs
+		std::size_t resumed = 0;
+		throw_next_frame();
+		wait_twice(resumed);
+
+		std::ignore = loop.frame(FRAME);
+		TEST_CHECK(resumed == 1);
+		TEST_CHECK(output.str().find("unhandled exception in coroutine: boom") != std::string::npos);
+
+		std::ignore = loop.frame(FRAME);
+		TEST_CHECK(resumed == 2);
+		TEST_CHECK(F4SE::CoroutineScheduler::get().pending() == 0);
+	}
+}
+
+int main()
+{
+	auto logger = std::make_shared<spdlog::logger>("test", std::make_shared<spdlog::sinks::ostream_sink_st>(output));
+	logger->set_pattern("%v");
+	spdlog::set_default_logger(std::move(logger));
+
+	auto& scheduler = F4SE::CoroutineScheduler::get();
+	scheduler.set_executor(loop);
+	scheduler.set_clock(&test::FrameLoop::now);
+
+	test_next_frame();
+	test_batched();
+	test_delay();
+	test_ui();
+	test_frame_pool();
+	test_exception();
+
+	return EXIT_SUCCESS;
+}
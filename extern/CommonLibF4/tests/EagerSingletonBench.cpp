@@ -0,0 +1,94 @@
+#include "REX/REX/Singleton.hpp"
+
+namespace
+{
+	struct result_t
+	{
+		std::string_view method;
+		std::string_view op;
+		double nsPerOp;
+	};
+
+	class Guarded
+		: public REX::Singleton<Guarded>
+	{
+	public:
+		std::uint64_t value{ 0 };
+	};
+
+	class Eager
+		: public REX::EagerSingleton<Eager>
+	{
+	public:
+		std::uint64_t value{ 0 };
+	};
+
+	// an opaque call, as from a hook or event sink in another translation unit
+	template <class T>
+	T* (*volatile getSingleton)() = &T::GetSingleton;
+
+	// each read also writes, so the loop does the work of every access rather than folding it away
+	template <class T>
+	[[nodiscard]] std::uint64_t read_inline(std::size_t a_count)
+	{
+		std::uint64_t sum = 0;
+		for (std::size_t i = 0; i < a_count; ++i) {
+			sum += T::GetSingleton()->value++;
+		}
+		return sum;
+	}
+
+	template <class T>
+	[[nodiscard]] std::uint64_t read_call(std::size_t a_count)
+	{
+		std::uint64_t sum = 0;
+		for (std::size_t i = 0; i < a_count; ++i) {
+			sum += getSingleton<T>()->value++;
+		}
+		return sum;
+	}
+}
+
+/**
+ * Times reading a member through GetSingleton of a function-local static against an eager
+ * singleton, both inlined into a loop and through an opaque call, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto count = test::quick(a_argc, a_argv) ? std::size_t{ 100'000 } : std::size_t{ 100'000'000 };
+
+	Eager::Create();
+	Guarded::GetSingleton();
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_method, std::string_view a_op, auto a_func) {
+		Guarded::GetSingleton()->value = 0;
+		Eager::GetSingleton()->value = 0;
+
+		std::uint64_t sum = 0;
+		results.push_back({ a_method, a_op, test::time_ns([&] { sum = a_func(); }) / static_cast<double>(count) });
+		TEST_CHECK(sum == count * (count - 1) / 2);
+		test::do_not_optimize(sum);
+	};
+
+	run("Singleton", "inline", [&] { return read_inline<Guarded>(count); });
+	run("EagerSingleton", "inline", [&] { return read_inline<Eager>(count); });
+	run("Singleton", "call", [&] { return read_call<Guarded>(count); });
+	run("EagerSingleton", "call", [&] { return read_call<Eager>(count); });
+
+	REX::DestroySingletons();
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"op\": \"%.*s\", \"ns_per_op\": %.3f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			static_cast<int>(result.op.size()), result.op.data(),
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+#include "REX/REX/Singleton.hpp"
+
+namespace
+{
+	// the order instances were torn down in
+	std::vector<int> destroyed;
+
+	template <int ID>
+	class Tracked
+		: public REX::EagerSingleton<Tracked<ID>>
+	{
+	public:
+		explicit Tracked(int a_value = 0) :
+			value(a_value)
+		{
+			++constructed;
+		}
+
+		~Tracked() override { destroyed.push_back(ID); }
+
+		int value;
+
+		static inline int constructed{ 0 };
+	};
+
+	using A = Tracked<1>;
+	using B = Tracked<2>;
+	using C = Tracked<3>;
+
+	void test_null_before_create()
+	{
+		TEST_CHECK(A::GetSingleton() == nullptr);
+		TEST_CHECK(B::GetSingleton() == nullptr);
+		TEST_CHECK(C::GetSingleton() == nullptr);
+
+		// nothing is alive, so this is a no-op
+		REX::DestroySingletons();
+		A::Destroy();
+		TEST_CHECK(destroyed.empty());
+	}
+
+	void test_create()
+	{
+		const auto a = A::Create(5);
+		TEST_CHECK(a != nullptr);
+		TEST_CHECK(A::GetSingleton() == a);
+		TEST_CHECK(a->value == 5);
+
+		// a second create returns the live instance without constructing another
+		TEST_CHECK(A::Create(6) == a);
+		TEST_CHECK(a->value == 5);
+		TEST_CHECK(A::constructed == 1);
+
+		// the instance lives in storage of its own
+		TEST_CHECK(reinterpret_cast<std::uintptr_t>(a) % alignof(A) == 0);
+	}
+
+	void test_reverse_order_teardown()
+	{
+		B::Create();
+		C::Create();
+
+		REX::DestroySingletons();
+		TEST_CHECK((destroyed == std::vector{ 3, 2, 1 }));
+		TEST_CHECK(A::GetSingleton() == nullptr);
+		TEST_CHECK(B::GetSingleton() == nullptr);
+		TEST_CHECK(C::GetSingleton() == nullptr);
+		TEST_CHECK(REX::Impl::eagerSingletons == nullptr);
+	}
+
+	void test_recreate_after_destroy()
+	{
+		destroyed.clear();
+
+		A::Create(1);
+		B::Create();
+		C::Create();
+
+		// destroying one from the middle unlinks it, and nothing else
+		B::Destroy();
+		TEST_CHECK((destroyed == std::vector{ 2 }));
+		TEST_CHECK(B::GetSingleton() == nullptr);
+		TEST_CHECK(A::GetSingleton()->value == 1);
+
+		// a re-created instance is constructed afresh, and is now the newest
+		const auto b = B::Create();
+		TEST_CHECK(b != nullptr);
+		TEST_CHECK(B::constructed == 3);
+
+		A::Destroy();
+		A::Create(7);
+		TEST_CHECK(A::GetSingleton()->value == 7);
+
+		destroyed.clear();
+		REX::DestroySingletons();
+		TEST_CHECK((destroyed == std::vector{ 1, 2, 3 }));
+		TEST_CHECK(REX::Impl::eagerSingletons == nullptr);
+	}
+}
+
+int main()
+{
+	test_null_before_create();
+	test_create();
+	test_reverse_order_teardown();
+	test_recreate_after_destroy();
+
+	return EXIT_SUCCESS;
+}
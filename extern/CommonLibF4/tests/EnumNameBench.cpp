@@ -0,0 +1,84 @@
+#include "EnumNameCommon.hpp"
+
+#include "RE/Bethesda/SCRIPT_OUTPUT.hpp"
+
+namespace
+{
+	using E = RE::SCRIPT_OUTPUT;
+
+	struct result_t
+	{
+		std::string_view method;
+		std::string_view op;
+		double nsPerOp;
+	};
+
+	[[nodiscard]] std::string_view linear_name(E a_value)
+	{
+		for (const auto& entry : REX::EnumEntries<E>()) {
+			if (entry.value == a_value) {
+				return entry.name;
+			}
+		}
+		return {};
+	}
+
+	[[nodiscard]] std::optional<E> linear_cast(std::string_view a_name)
+	{
+		for (const auto& entry : REX::EnumEntries<E>()) {
+			if (entry.name == a_name) {
+				return entry.value;
+			}
+		}
+		return std::nullopt;
+	}
+}
+
+/**
+ * Times naming and parsing every <code>SCRIPT_OUTPUT</code> opcode, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto rounds = test::quick(a_argc, a_argv) ? 10 : 1000;
+	const auto entries = REX::EnumEntries<E>();
+	const auto ops = static_cast<double>(rounds) * static_cast<double>(entries.size());
+
+	std::unordered_map<std::string_view, E> map;
+	for (const auto& entry : entries) {
+		map.emplace(entry.name, entry.value);
+	}
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_method, std::string_view a_op, auto a_func) {
+		results.push_back({ a_method, a_op, test::time_ns([&] {
+			std::size_t sum = 0;
+			for (int i = 0; i < rounds; ++i) {
+				for (const auto& entry : entries) {
+					sum += a_func(entry);
+				}
+			}
+			test::do_not_optimize(sum);
+		}) / ops });
+	};
+
+	run("EnumName", "name", [](const REX::EnumEntry<E>& a_entry) { return REX::EnumName(a_entry.value).size(); });
+	run("linear", "name", [](const REX::EnumEntry<E>& a_entry) { return linear_name(a_entry.value).size(); });
+	run("EnumCast", "parse", [](const REX::EnumEntry<E>& a_entry) { return static_cast<std::size_t>(*REX::EnumCast<E>(a_entry.name)); });
+	run("unordered_map", "parse", [&](const REX::EnumEntry<E>& a_entry) { return static_cast<std::size_t>(map.find(a_entry.name)->second); });
+	run("linear", "parse", [](const REX::EnumEntry<E>& a_entry) { return static_cast<std::size_t>(*linear_cast(a_entry.name)); });
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"op\": \"%.*s\", \"names\": %zu, \"ns_per_op\": %.2f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			static_cast<int>(result.op.size()), result.op.data(),
+			entries.size(),
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
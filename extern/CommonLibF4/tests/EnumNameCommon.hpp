@@ -0,0 +1,40 @@
+#pragma once
+
+#include "REX/REX/EnumName.hpp"
+
+namespace test
+{
+	/**
+	 * Whether every enumerator of <code>E</code> is named and parsed back to its value.
+	 *
+	 * <p>
+	 * Aliases only parse by the name reflected for their value, and masks of several bits outside the
+	 * probed range have no name at all, as documented on <code>REX::EnumRange</code>.
+	 * </p>
+	 */
+	template <class E, std::size_t N>
+	[[nodiscard]] consteval bool RoundTrips(const E (&a_values)[N], const std::string_view (&a_names)[N])
+	{
+		using unsigned_t = std::make_unsigned_t<std::underlying_type_t<E>>;
+
+		for (std::size_t i = 0; i < N; ++i) {
+			const auto name = REX::EnumName(a_values[i]);
+			if (name.empty()) {
+				if (std::popcount(static_cast<unsigned_t>(a_values[i])) < 2) {
+					return false;
+				}
+			}
+			else if (REX::EnumCast<E>(name) != a_values[i] || (name != a_names[i] && REX::EnumCast<E>(a_names[i]))) {
+				return false;
+			}
+		}
+
+		for (const auto& entry : REX::EnumEntries<E>()) {
+			if (REX::EnumName(entry.value) != entry.name || REX::EnumCast<E>(entry.name) != entry.value) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,133 @@
+#include "EnumNameCommon.hpp"
+
+#include "RE/Bethesda/SCRIPT_OUTPUT.hpp"
+
+namespace
+{
+	enum class Color
+	{
+		kRed,
+		kGreen,
+		kBlue,
+
+		kTotal = kBlue
+	};
+
+	enum class Signed : std::int8_t
+	{
+		kMin = -128,
+		kNegative = -5,
+		kZero = 0,
+		kMax = 127
+	};
+
+	enum class Handle : std::uint32_t
+	{
+		kFirst = 0,
+		kSecond = 1,
+
+		kNone = static_cast<std::uint32_t>(-1)
+	};
+
+	enum class Flags : std::uint32_t
+	{
+		kNone = 0,
+		kA = 1u << 0,
+		kB = 1u << 4,
+		kHigh = 1u << 31,
+
+		kMask = kA | kB
+	};
+
+	enum class Far
+	{
+		kLow = 1000,
+		kHigh = 1010
+	};
+
+	// laid out like RE::BS_BUTTON_CODE
+	enum class Button : std::int32_t
+	{
+		kTab = 0x09,
+		kGamepad = 0x10000,
+		kLTrigger = 0x10009,
+		kLShoulder = 0x10100,
+		kWheelDown = 0x10900,
+		kYButton = 0x18000
+	};
+}
+
+template <>
+struct REX::EnumRange<Far>
+{
+	static constexpr std::int64_t min = 990;
+	static constexpr std::int64_t max = 1010;
+};
+
+template <>
+struct REX::EnumRange<Button>
+{
+	static constexpr std::int64_t min = 0;
+	static constexpr std::int64_t max = 0xFF;
+	static constexpr std::array strides{
+		EnumStride{ 0x10000, 0x100FF },
+		EnumStride{ 0x10100, 0x1FF00, 0x100 }
+	};
+};
+
+static_assert(REX::EnumName(Color::kGreen) == "kGreen");
+static_assert(REX::EnumName(static_cast<Color>(7)).empty());
+static_assert(REX::EnumCast<Color>("kBlue") == Color::kBlue);
+static_assert(!REX::EnumCast<Color>("kPurple"));
+static_assert(!REX::EnumCast<Color>(""));
+static_assert(REX::EnumEntries<Color>().size() == 3);
+static_assert(test::RoundTrips<Color>({ Color::kRed, Color::kGreen, Color::kBlue, Color::kTotal }, { "kRed", "kGreen", "kBlue", "kTotal" }));
+
+static_assert(REX::EnumName(Signed::kMin) == "kMin");
+static_assert(REX::EnumCast<Signed>("kNegative") == Signed::kNegative);
+static_assert(test::RoundTrips<Signed>({ Signed::kMin, Signed::kNegative, Signed::kZero, Signed::kMax }, { "kMin", "kNegative", "kZero", "kMax" }));
+
+// the negative end of the default range wraps around to kNone
+static_assert(REX::EnumName(Handle::kNone) == "kNone");
+static_assert(REX::EnumCast<Handle>("kNone") == Handle::kNone);
+static_assert(test::RoundTrips<Handle>({ Handle::kFirst, Handle::kSecond, Handle::kNone }, { "kFirst", "kSecond", "kNone" }));
+
+static_assert(REX::EnumName(Flags::kHigh) == "kHigh");
+static_assert(REX::EnumName(Flags::kMask) == "kMask");
+static_assert(test::RoundTrips<Flags>({ Flags::kNone, Flags::kA, Flags::kB, Flags::kHigh, Flags::kMask }, { "kNone", "kA", "kB", "kHigh", "kMask" }));
+
+static_assert(REX::EnumName(Far::kLow) == "kLow");
+static_assert(REX::EnumCast<Far>("kHigh") == Far::kHigh);
+
+static_assert(REX::EnumName(Button::kLTrigger) == "kLTrigger");
+static_assert(REX::EnumName(Button::kWheelDown) == "kWheelDown");
+static_assert(REX::EnumName(static_cast<Button>(0x10901)).empty());
+static_assert(test::RoundTrips<Button>(
+	{ Button::kTab, Button::kGamepad, Button::kLTrigger, Button::kLShoulder, Button::kWheelDown, Button::kYButton },
+	{ "kTab", "kGamepad", "kLTrigger", "kLShoulder", "kWheelDown", "kYButton" }));
+
+// the real table, with its terminator found through a stride
+static_assert(REX::EnumName(RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_ROBOT_WORKBENCH) == "FUNCTION_IS_IN_ROBOT_WORKBENCH");
+static_assert(REX::EnumName(RE::SCRIPT_OUTPUT::SCRIPT_DONE) == "SCRIPT_DONE");
+static_assert(REX::EnumCast<RE::SCRIPT_OUTPUT>("FLOW_END") == RE::SCRIPT_OUTPUT::FLOW_END);
+
+int main()
+{
+	TEST_CHECK(REX::EnumFlagsName(Flags::kNone) == "kNone");
+	TEST_CHECK(REX::EnumFlagsName(static_cast<Flags>(0x11)) == "kA|kB");
+	TEST_CHECK(REX::EnumFlagsName(static_cast<Flags>(0x80000001)) == "kA|kHigh");
+	TEST_CHECK(REX::EnumFlagsName(static_cast<Flags>(0x101)) == "kA|0x100");
+
+	TEST_CHECK(REX::EnumFlagsCast<Flags>("kA|kHigh") == static_cast<Flags>(0x80000001));
+	TEST_CHECK(REX::EnumFlagsCast<Flags>(" kB | 0x100 ") == static_cast<Flags>(0x110));
+	TEST_CHECK(REX::EnumFlagsCast<Flags>("3") == static_cast<Flags>(3));
+	TEST_CHECK(!REX::EnumFlagsCast<Flags>("kA|kC"));
+	TEST_CHECK(!REX::EnumFlagsCast<Flags>("kA|"));
+	TEST_CHECK(!REX::EnumFlagsCast<Flags>("0x100000000"));
+
+	for (const auto& entry : REX::EnumEntries<RE::SCRIPT_OUTPUT>()) {
+		TEST_CHECK(REX::EnumCast<RE::SCRIPT_OUTPUT>(entry.name) == entry.value);
+	}
+
+	return EXIT_SUCCESS;
+}
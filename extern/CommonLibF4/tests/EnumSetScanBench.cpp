@@ -0,0 +1,167 @@
+#include "REX/REX/EnumSetScan.hpp"
+
+namespace
+{
+	using REX::EnumSetTest;
+
+	enum class CellFlag : std::uint16_t
+	{
+		kInterior = 1 << 0,
+		kHasWater = 1 << 1,
+		kCantWait = 1 << 2,
+		kNoLODWater = 1 << 3,
+		kPublicArea = 1 << 5,
+		kHandChanged = 1 << 6,
+		kShowSky = 1 << 7,
+		kUseSkyLighting = 1 << 8
+	};
+
+	using Flags = REX::EnumSet<CellFlag>;
+
+	struct cell_t
+	{
+		std::uint32_t formID;
+		Flags flags;
+		std::uint16_t pad;
+		float waterHeight;
+	};
+
+	struct result_t
+	{
+		std::string_view method;
+		std::string_view op;
+		std::string_view test;
+		double nsPerOp;
+	};
+
+	[[nodiscard]] std::string_view test_name(EnumSetTest a_test) noexcept
+	{
+		switch (a_test) {
+			case EnumSetTest::kAny:
+				return "any";
+			case EnumSetTest::kAll:
+				return "all";
+			default:
+				return "none";
+		}
+	}
+
+	[[nodiscard]] bool scalar_test(Flags a_flags, EnumSetTest a_test, Flags a_mask) noexcept
+	{
+		switch (a_test) {
+			case EnumSetTest::kAny:
+				return a_flags.any(a_mask.get());
+			case EnumSetTest::kAll:
+				return a_flags.all(a_mask.get());
+			default:
+				return a_flags.none(a_mask.get());
+		}
+	}
+
+	// how callers tested flags before the scans, one set at a time
+	std::size_t scalar_scan(std::span<const Flags> a_sets, EnumSetTest a_test, Flags a_mask, std::span<std::uint64_t> a_bitmap)
+	{
+		std::ranges::fill(a_bitmap, 0);
+		std::size_t matches = 0;
+		for (std::size_t i = 0; i < a_sets.size(); ++i) {
+			const auto match = scalar_test(a_sets[i], a_test, a_mask);
+			a_bitmap[i / 64] |= static_cast<std::uint64_t>(match) << (i % 64);
+			matches += match;
+		}
+		return matches;
+	}
+
+	std::size_t scalar_find(std::span<const Flags> a_sets, EnumSetTest a_test, Flags a_mask, std::vector<std::uint32_t>& a_indices)
+	{
+		for (std::size_t i = 0; i < a_sets.size(); ++i) {
+			if (scalar_test(a_sets[i], a_test, a_mask)) {
+				a_indices.push_back(static_cast<std::uint32_t>(i));
+			}
+		}
+		return a_indices.size();
+	}
+
+	std::size_t scalar_scan_cells(std::span<const cell_t> a_cells, EnumSetTest a_test, Flags a_mask, std::span<std::uint64_t> a_bitmap)
+	{
+		std::ranges::fill(a_bitmap, 0);
+		std::size_t matches = 0;
+		for (std::size_t i = 0; i < a_cells.size(); ++i) {
+			const auto match = scalar_test(a_cells[i].flags, a_test, a_mask);
+			a_bitmap[i / 64] |= static_cast<std::uint64_t>(match) << (i % 64);
+			matches += match;
+		}
+		return matches;
+	}
+}
+
+/**
+ * Times testing 1M synthetic cell flag words against a mask, as a bitmap, as an index list and
+ * through a member of each cell, against the scalar loops, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto size = test::quick(a_argc, a_argv) ? std::size_t{ 10'000 } : std::size_t{ 1'000'000 };
+	const auto rounds = test::quick(a_argc, a_argv) ? 2 : 50;
+
+	// most cells are exteriors with a few flags, a quarter are interiors
+	std::mt19937 rng{ 0xCE11 };
+	std::vector<Flags> sets(size);
+	std::vector<cell_t> cells(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		auto value = static_cast<std::uint16_t>(rng() & rng() & 0x1EF);
+		if (rng() % 4 == 0) {
+			value |= static_cast<std::uint16_t>(CellFlag::kInterior);
+		}
+		sets[i] = static_cast<CellFlag>(value);
+		cells[i] = { static_cast<std::uint32_t>(i), sets[i], 0, 0.0f };
+	}
+
+	const Flags mask{ CellFlag::kInterior, CellFlag::kHasWater };
+	std::vector<std::uint64_t> bitmap((size + 63) / 64);
+	std::vector<std::uint64_t> expected((size + 63) / 64);
+	std::vector<std::uint32_t> indices;
+	indices.reserve(size);
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_method, std::string_view a_op, EnumSetTest a_test, auto a_func) {
+		results.push_back({ a_method, a_op, test_name(a_test), test::time_ns([&] {
+			std::size_t sum = 0;
+			for (int i = 0; i < rounds; ++i) {
+				indices.clear();
+				sum += a_func();
+			}
+			test::do_not_optimize(sum);
+		}) / rounds });
+	};
+
+	for (const auto test : { EnumSetTest::kAny, EnumSetTest::kAll, EnumSetTest::kNone }) {
+		run("scalar", "bitmap", test, [&] { return scalar_scan(sets, test, mask, expected); });
+		run("ScanEnumSets", "bitmap", test, [&] { return REX::ScanEnumSets(sets, test, mask, bitmap); });
+		TEST_CHECK(bitmap == expected);
+
+		run("scalar", "indices", test, [&] { return scalar_find(sets, test, mask, indices); });
+		const auto want = indices;
+		run("FindEnumSets", "indices", test, [&] { return REX::FindEnumSets(sets, test, mask, indices); });
+		TEST_CHECK(indices == want);
+
+		run("scalar", "member_bitmap", test, [&] { return scalar_scan_cells(cells, test, mask, expected); });
+		run("ScanEnumSets", "member_bitmap", test, [&] { return REX::ScanEnumSets(cells, &cell_t::flags, test, mask, bitmap); });
+		TEST_CHECK(bitmap == expected);
+	}
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"op\": \"%.*s\", \"test\": \"%.*s\", \"sets\": %zu, \"us_per_op\": %.1f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			static_cast<int>(result.op.size()), result.op.data(),
+			static_cast<int>(result.test.size()), result.test.data(),
+			size,
+			result.nsPerOp / 1e3,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,171 @@
+#include "REX/REX/EnumSetScan.hpp"
+
+namespace
+{
+	using REX::EnumSetTest;
+
+	enum class Flags8 : std::uint8_t {};
+	enum class Flags16 : std::uint16_t {};
+	enum class Flags32 : std::uint32_t {};
+	enum class Flags64 : std::uint64_t {};
+
+	inline constexpr std::array TESTS{ EnumSetTest::kAny, EnumSetTest::kAll, EnumSetTest::kNone };
+
+	template <class S>
+	struct cell_t
+	{
+		std::uint32_t formID;
+		S flags;
+	};
+
+	// the scalar answer, through the EnumSet member the scans replace
+	template <class S>
+	[[nodiscard]] bool expected(S a_set, EnumSetTest a_test, S a_mask) noexcept
+	{
+		switch (a_test) {
+			case EnumSetTest::kAny:
+				return a_set.any(a_mask.get());
+			case EnumSetTest::kAll:
+				return a_set.all(a_mask.get());
+			default:
+				return a_set.none(a_mask.get());
+		}
+	}
+
+	template <class S>
+	[[nodiscard]] S random_set(std::mt19937_64& a_rng)
+	{
+		using U = typename S::underlying_type;
+		// sparse, dense and random words, so every test both matches and fails
+		auto value = static_cast<U>(a_rng());
+		switch (a_rng() % 4) {
+			case 0:
+				value &= static_cast<U>(a_rng());
+				break;
+			case 1:
+				value |= static_cast<U>(a_rng());
+				break;
+			default:
+				break;
+		}
+		return static_cast<typename S::enum_type>(value);
+	}
+
+	template <class S>
+	void check_sets(const std::vector<S>& a_sets, EnumSetTest a_test, S a_mask)
+	{
+		const auto size = a_sets.size();
+
+		// poisoned, so unused bits must be cleared rather than left alone
+		std::vector<std::uint64_t> bitmap((size + 63) / 64, ~std::uint64_t{ 0 });
+		const auto matches = REX::ScanEnumSets(a_sets, a_test, a_mask, bitmap);
+
+		std::vector<std::uint32_t> indices{ 0xDEAD };
+		const auto found = REX::FindEnumSets(a_sets, a_test, a_mask, indices);
+
+		std::vector<std::uint32_t> want;
+		for (std::size_t i = 0; i < size; ++i) {
+			const auto match = expected(a_sets[i], a_test, a_mask);
+			TEST_CHECK(((bitmap[i / 64] >> (i % 64)) & 1) == static_cast<std::uint64_t>(match));
+			if (match) {
+				want.push_back(static_cast<std::uint32_t>(i));
+			}
+		}
+
+		if (size % 64 != 0) {
+			TEST_CHECK((bitmap.back() >> (size % 64)) == 0);
+		}
+
+		TEST_CHECK(matches == want.size());
+		TEST_CHECK(found == want.size());
+		TEST_CHECK(indices.front() == 0xDEAD);
+		TEST_CHECK(std::ranges::equal(std::span{ indices }.subspan(1), want));
+	}
+
+	template <class S>
+	void check_members(const std::vector<S>& a_sets, EnumSetTest a_test, S a_mask)
+	{
+		const auto size = a_sets.size();
+
+		std::vector<cell_t<S>> cells;
+		for (std::size_t i = 0; i < size; ++i) {
+			cells.push_back({ static_cast<std::uint32_t>(i), a_sets[i] });
+		}
+
+		// every third pointer is null, which never matches
+		std::vector<const cell_t<S>*> pointers;
+		for (std::size_t i = 0; i < size; ++i) {
+			pointers.push_back(i % 3 == 2 ? nullptr : std::addressof(cells[i]));
+		}
+
+		std::vector<std::uint64_t> cellBitmap((size + 63) / 64);
+		std::vector<std::uint64_t> pointerBitmap((size + 63) / 64);
+		const auto cellMatches = REX::ScanEnumSets(cells, &cell_t<S>::flags, a_test, a_mask, cellBitmap);
+		const auto pointerMatches = REX::ScanEnumSets(pointers, &cell_t<S>::flags, a_test, a_mask, pointerBitmap);
+
+		std::vector<std::uint32_t> cellIndices;
+		std::vector<std::uint32_t> pointerIndices;
+		TEST_CHECK(REX::FindEnumSets(cells, &cell_t<S>::flags, a_test, a_mask, cellIndices) == cellMatches);
+		TEST_CHECK(REX::FindEnumSets(pointers, &cell_t<S>::flags, a_test, a_mask, pointerIndices) == pointerMatches);
+
+		std::vector<std::uint32_t> wantCells;
+		std::vector<std::uint32_t> wantPointers;
+		for (std::size_t i = 0; i < size; ++i) {
+			const auto match = expected(a_sets[i], a_test, a_mask);
+			TEST_CHECK(((cellBitmap[i / 64] >> (i % 64)) & 1) == static_cast<std::uint64_t>(match));
+			if (match) {
+				wantCells.push_back(static_cast<std::uint32_t>(i));
+				if (pointers[i]) {
+					wantPointers.push_back(static_cast<std::uint32_t>(i));
+				}
+			}
+		}
+
+		TEST_CHECK(cellIndices == wantCells);
+		TEST_CHECK(pointerIndices == wantPointers);
+		TEST_CHECK(pointerMatches == wantPointers.size());
+	}
+
+	template <class E>
+	void test_scans(std::mt19937_64& a_rng)
+	{
+		using S = REX::EnumSet<E>;
+		using U = typename S::underlying_type;
+
+		// every tail length around the 16 wide blocks and 64 bit words
+		for (std::size_t size = 0; size <= 200; ++size) {
+			std::vector<S> sets;
+			for (std::size_t i = 0; i < size; ++i) {
+				sets.push_back(random_set<S>(a_rng));
+			}
+
+			const std::array masks{
+				S{},
+				S{ static_cast<E>(std::numeric_limits<U>::max()) },
+				S{ static_cast<E>(U{ 1 } << (a_rng() % (sizeof(U) * 8))) },
+				random_set<S>(a_rng),
+			};
+
+			for (const auto test : TESTS) {
+				for (const auto mask : masks) {
+					check_sets(sets, test, mask);
+					if (size % 16 == 0 || size % 64 == 63) {
+						check_members(sets, test, mask);
+					}
+				}
+			}
+		}
+	}
+}
+
+int main()
+{
+	std::mt19937_64 rng{ 0x5EED };
+
+	test_scans<Flags8>(rng);
+	test_scans<Flags16>(rng);
+	test_scans<Flags32>(rng);
+	test_scans<Flags64>(rng);
+
+	return EXIT_SUCCESS;
+}
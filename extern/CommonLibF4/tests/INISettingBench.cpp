@@ -0,0 +1,145 @@
+#include "REX/REX/INI.hpp"
+
+namespace
+{
+	using Store = REX::INI::SettingStore;
+
+	struct result_t
+	{
+		std::string_view method;
+		std::string_view op;
+		double nsPerOp;
+	};
+
+	inline constexpr std::size_t SECTIONS = 50;
+
+	struct key_entry_t
+	{
+		std::string section;
+		std::string key;
+	};
+
+	[[nodiscard]] std::string lower(std::string_view a_str)
+	{
+		std::string result(a_str);
+		for (auto& ch : result) {
+			ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+		}
+		return result;
+	}
+
+	// a line by line parse into nested maps of copied strings, as most ini readers do
+	[[nodiscard]] std::int64_t map_load(const std::string& a_file, std::span<const key_entry_t> a_keys)
+	{
+		std::map<std::string, std::map<std::string, std::string>> sections;
+		std::ifstream file{ a_file };
+		std::string line;
+		std::map<std::string, std::string>* section = nullptr;
+		while (std::getline(file, line)) {
+			if (line.empty() || line.front() == ';') {
+				continue;
+			}
+
+			if (line.front() == '[') {
+				section = std::addressof(sections[lower(line.substr(1, line.find(']') - 1))]);
+				continue;
+			}
+
+			const auto equals = line.find('=');
+			if (section && equals != std::string::npos) {
+				auto key = line.substr(0, equals);
+				key.erase(key.find_last_not_of(' ') + 1);
+				(*section)[lower(key)] = line.substr(line.find_first_not_of(' ', equals + 1));
+			}
+		}
+
+		std::int64_t sum = 0;
+		for (const auto& [sectionName, key] : a_keys) {
+			if (const auto it = sections.find(lower(sectionName)); it != sections.end()) {
+				if (const auto value = it->second.find(lower(key)); value != it->second.end()) {
+					sum += std::stoi(value->second);
+				}
+			}
+		}
+		return sum;
+	}
+}
+
+/**
+ * Times loading and saving a store of 10k integer settings spread over 50 sections, against a
+ * line by line parse into nested maps, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto count = test::quick(a_argc, a_argv) ? std::size_t{ 500 } : std::size_t{ 10000 };
+	const auto rounds = test::quick(a_argc, a_argv) ? 2 : 20;
+
+	const auto root = std::filesystem::temp_directory_path() / "f4se_ini_setting_bench";
+	std::filesystem::create_directories(root);
+	const F4SE::stl::scope_exit cleanup([&] {
+		std::error_code ec;
+		std::filesystem::remove_all(root, ec);
+	});
+
+	const auto base = (root / "base.ini").string();
+	const auto user = (root / "user.ini").string();
+
+	// settings keep a view of their section and key, so the keys must never reallocate
+	std::vector<key_entry_t> keys;
+	keys.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		keys.push_back({ std::format("Section{}", i % SECTIONS), std::format("iKey{}", i) });
+	}
+
+	{
+		std::ofstream file{ base, std::ios::trunc };
+		for (std::size_t section = 0; section < SECTIONS; ++section) {
+			file << "; settings of section " << section << "\n[Section" << section << "]\n";
+			for (auto i = section; i < count; i += SECTIONS) {
+				file << "iKey" << i << " = " << i << '\n';
+			}
+			file << '\n';
+		}
+	}
+
+	std::vector<std::unique_ptr<REX::INI::I32<>>> settings;
+	for (const auto& [section, key] : keys) {
+		settings.push_back(std::make_unique<REX::INI::I32<>>(section, key, -1));
+	}
+
+	const auto store = Store::GetSingleton();
+	store->Init(base, user);
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_method, std::string_view a_op, auto a_func) {
+		a_func();
+		results.push_back({ a_method, a_op, test::time_ns([&] {
+			for (int i = 0; i < rounds; ++i) {
+				a_func();
+			}
+		}) / rounds });
+	};
+
+	run("SettingStore", "load", [&] { store->Load(); });
+	run("map", "load", [&] { test::do_not_optimize(map_load(base, keys)); });
+	run("SettingStore", "save", [&] { store->Save(); });
+
+	TEST_CHECK(settings.front()->GetValue() == 0);
+	TEST_CHECK(settings.back()->GetValue() == static_cast<std::int32_t>(count - 1));
+	TEST_CHECK(map_load(base, keys) == static_cast<std::int64_t>(count * (count - 1) / 2));
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"op\": \"%.*s\", \"settings\": %zu, \"ms_per_op\": %.3f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			static_cast<int>(result.op.size()), result.op.data(),
+			count,
+			result.nsPerOp / 1e6,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,177 @@
+#include "REX/REX/INI.hpp"
+
+namespace
+{
+	using Store = REX::INI::SettingStore;
+
+	// registered with the store before main, like a plugin's settings
+	REX::INI::I32<> layered{ "General", "iValue", 1 };
+	REX::INI::I32<> userOnly{ "General", "iUserOnly", 2 };
+	REX::INI::Str<> empty{ "General", "sEmpty", std::string("default") };
+	REX::INI::Str<> quoted{ "General", "sQuoted", std::string() };
+	REX::INI::U32<> hex{ "General", "uHex", 0 };
+	REX::INI::I32<> negativeHex{ "General", "iHex", 0 };
+	REX::INI::I32<> invalid{ "General", "iInvalid", 7 };
+	REX::INI::I32<> emptyInt{ "General", "iEmpty", 8 };
+	REX::INI::Bool<> on{ "Display", "bOn", false };
+	REX::INI::Bool<> no{ "Display", "bNo", true };
+	REX::INI::F32<> scale{ "Display", "fScale", 2.0f };
+	REX::INI::F64<> plus{ "Display", "fPlus", 0.0 };
+	REX::INI::I32<> missingKey{ "Display", "iMissing", 3 };
+	REX::INI::I32<> missingSection{ "Extra", "iNew", 4 };
+
+	struct files_t
+	{
+		files_t()
+		{
+			std::filesystem::create_directories(root);
+		}
+
+		~files_t()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(root, ec);
+		}
+
+		std::filesystem::path root{ std::filesystem::temp_directory_path() / "f4se_ini_setting_test" };
+		std::string base{ (root / "base.ini").string() };
+		std::string user{ (root / "user.ini").string() };
+	};
+
+	void write(const std::string& a_path, std::string_view a_text)
+	{
+		std::ofstream file{ a_path, std::ios::binary | std::ios::trunc };
+		file << a_text;
+	}
+
+	[[nodiscard]] std::string read(const std::string& a_path)
+	{
+		std::ifstream file{ a_path, std::ios::binary };
+		return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	}
+
+	// a BOM, CRLF line breaks and no line break at the end
+	inline constexpr std::string_view BASE{
+		"\xEF\xBB\xBF; a comment\r\n"
+		"[General]\r\n"
+		"iValue = 10\r\n"
+		"sEmpty =\r\n"
+		"sQuoted = \"  padded  \"\r\n"
+		"uHex = 0xFF\r\n"
+		"iHex = 0x10\r\n"
+		"iInvalid = abc\r\n"
+		"iEmpty =\r\n"
+		"\r\n"
+		"# another comment\r\n"
+		"[Display]\r\n"
+		"bOn = on\r\n"
+		"bNo = No\r\n"
+		"fScale = 1.5x\r\n"
+		"fPlus = +0.25"
+	};
+
+	// sections and keys fold case, and the layers need not share line breaks
+	inline constexpr std::string_view USER{
+		"[GENERAL]\n"
+		"IVALUE=20\n"
+		"iuseronly = 5\n"
+	};
+
+	void test_load(const files_t& a_files)
+	{
+		write(a_files.base, BASE);
+		write(a_files.user, USER);
+
+		Store::GetSingleton()->Load();
+
+		// the user layer overrides the base, which becomes the default
+		TEST_CHECK(layered.GetValue() == 20);
+		TEST_CHECK(layered.GetValueDefault() == 10);
+		TEST_CHECK(userOnly.GetValue() == 5);
+		TEST_CHECK(userOnly.GetValueDefault() == 2);
+
+		TEST_CHECK(empty.GetValue().empty());
+		TEST_CHECK(quoted.GetValue() == "  padded  ");
+		TEST_CHECK(hex.GetValue() == 0xFF);
+		TEST_CHECK(negativeHex.GetValue() == 0x10);
+		TEST_CHECK(on.GetValue() == true);
+		TEST_CHECK(no.GetValue() == false);
+		TEST_CHECK(plus.GetValue() == 0.25);
+
+		// values which do not parse fall back to the default, without stopping the rest of the load
+		TEST_CHECK(invalid.GetValue() == 7);
+		TEST_CHECK(emptyInt.GetValue() == 8);
+		TEST_CHECK(scale.GetValue() == 2.0f);
+
+		TEST_CHECK(missingKey.GetValue() == 3);
+		TEST_CHECK(missingSection.GetValue() == 4);
+	}
+
+	void test_save(const files_t& a_files)
+	{
+		Store::GetSingleton()->Save();
+
+		// comments and layout survive, values are patched in place and new lines match the file
+		TEST_CHECK(read(a_files.base) ==
+				   "\xEF\xBB\xBF; a comment\r\n"
+				   "[General]\r\n"
+				   "iValue = 20\r\n"
+				   "sEmpty =\r\n"
+				   "sQuoted = \"  padded  \"\r\n"
+				   "uHex = 255\r\n"
+				   "iHex = 16\r\n"
+				   "iInvalid = 7\r\n"
+				   "iEmpty = 8\r\n"
+				   "iUserOnly = 5\r\n"
+				   "\r\n"
+				   "# another comment\r\n"
+				   "[Display]\r\n"
+				   "bOn = true\r\n"
+				   "bNo = false\r\n"
+				   "fScale = 2\r\n"
+				   "fPlus = 0.25\r\n"
+				   "iMissing = 3\r\n"
+				   "\r\n"
+				   "[Extra]\r\n"
+				   "iNew = 4\r\n");
+
+		// a second save finds every key in place
+		const auto before = read(a_files.base);
+		Store::GetSingleton()->Save();
+		TEST_CHECK(read(a_files.base) == before);
+
+		// and the saved file loads back to the same values
+		layered.SetValue(30);
+		Store::GetSingleton()->Save();
+		std::filesystem::remove(a_files.user);
+		Store::GetSingleton()->Load();
+		TEST_CHECK(layered.GetValue() == 30);
+		TEST_CHECK(invalid.GetValue() == 7);
+		TEST_CHECK(missingSection.GetValue() == 4);
+	}
+
+	void test_save_without_base(const files_t& a_files)
+	{
+		std::filesystem::remove(a_files.base);
+		Store::GetSingleton()->Save();
+
+		// a new file has nothing to match, so it gets plain line breaks
+		const auto text = read(a_files.base);
+		TEST_CHECK(text.starts_with("[General]\niValue = 30\n"));
+		TEST_CHECK(text.find('\r') == std::string::npos);
+		TEST_CHECK(text.find("\n\n[Display]\n") != std::string::npos);
+		TEST_CHECK(text.ends_with("[Extra]\niNew = 4\n"));
+	}
+}
+
+int main()
+{
+	const files_t files;
+	Store::GetSingleton()->Init(files.base, files.user);
+
+	test_load(files);
+	test_save(files);
+	test_save_without_base(files);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,176 @@
+#include "REL/IAT.hpp"
+
+#include "PEImageCommon.hpp"
+
+namespace
+{
+	struct result_t
+	{
+		std::string file;
+		std::size_t imports;
+		std::string_view workload;
+		std::string_view method;
+		double nsPerOp;
+	};
+
+	struct import_t
+	{
+		std::string_view dll;
+		std::string_view function;
+	};
+
+	[[nodiscard]] bool iequals(std::string_view a_lhs, std::string_view a_rhs) noexcept
+	{
+		const auto lower = [](char a_ch) { return ('A' <= a_ch && a_ch <= 'Z') ? static_cast<char>(a_ch - 'A' + 'a') : a_ch; };
+		return std::ranges::equal(a_lhs, a_rhs, {}, lower, lower);
+	}
+
+	// the walk GetIATPtr used to make on every call, calling a_func with each import until it returns true
+	template <class F>
+	std::optional<std::uint32_t> walk_imports(const REL::PEImage& a_image, F a_func)
+	{
+		const auto dataDir = a_image.data_directory(REX::W32::IMAGE_DIRECTORY_ENTRY_IMPORT);
+		if (!dataDir) {
+			return std::nullopt;
+		}
+
+		constexpr auto DESC_SIZE = static_cast<std::uint32_t>(sizeof(REX::W32::IMAGE_IMPORT_DESCRIPTOR));
+		constexpr auto THUNK_SIZE = static_cast<std::uint32_t>(sizeof(REX::W32::IMAGE_THUNK_DATA64));
+		for (auto rva = dataDir->virtualAddress;; rva += DESC_SIZE) {
+			const auto import = a_image.rva_to<REX::W32::IMAGE_IMPORT_DESCRIPTOR>(rva);
+			if (!import || import->name == 0 || import->firstThunk == 0) {
+				return std::nullopt;
+			}
+
+			const auto dll = a_image.rva_to_string(import->name);
+			const auto lookup = import->firstThunkOriginal ? import->firstThunkOriginal : import->firstThunk;
+			for (std::uint32_t i = 0;; ++i) {
+				const auto thunk = a_image.rva_to<REX::W32::IMAGE_THUNK_DATA64>(lookup + i * THUNK_SIZE);
+				if (!thunk || thunk->ordinal == 0) {
+					break;
+				}
+				if ((thunk->ordinal & REX::W32::IMAGE_ORDINAL_FLAG64) != 0) {
+					continue;
+				}
+
+				const auto name = a_image.rva_to_string(
+					static_cast<std::uint32_t>(thunk->address + offsetof(REX::W32::IMAGE_IMPORT_BY_NAME, name)));
+				if (a_func(dll, name)) {
+					return import->firstThunk + i * THUNK_SIZE;
+				}
+			}
+		}
+	}
+
+	[[nodiscard]] std::optional<std::uint32_t> scan(const REL::PEImage& a_image, std::string_view a_dll, std::string_view a_function)
+	{
+		return walk_imports(a_image, [&](std::string_view a_importDll, std::string_view a_name) {
+			return iequals(a_importDll, a_dll) && iequals(a_name, a_function);
+		});
+	}
+
+	[[nodiscard]] std::vector<std::byte> read_file(const std::filesystem::path& a_path)
+	{
+		std::ifstream file(a_path, std::ios::binary);
+		std::vector<char> data{ std::istreambuf_iterator<char>(file), {} };
+		const auto bytes = std::as_bytes(std::span{ data });
+		return { bytes.begin(), bytes.end() };
+	}
+
+	void bench_file(std::vector<result_t>& a_results, const std::string& a_name, std::span<const std::byte> a_file, bool a_quick)
+	{
+		const REL::PEImage image{ a_file, REL::PEImage::Layout::kFile };
+		TEST_CHECK(image.valid());
+
+		std::vector<import_t> imports;
+		std::ignore = walk_imports(image, [&](std::string_view a_dll, std::string_view a_function) {
+			imports.push_back({ a_dll, a_function });
+			return false;
+		});
+		if (imports.empty()) {
+			return;
+		}
+
+		// a hook installer's lookups: every import in random order, with a tenth asking for functions the image does not import
+		std::mt19937_64 rng{ 29 };
+		std::vector<import_t> lookups;
+		const auto count = a_quick ? std::size_t{ 1'000 } : std::size_t{ 100'000 };
+		for (std::size_t i = 0; i < count; ++i) {
+			const auto& import = imports[rng() % imports.size()];
+			lookups.push_back(i % 10 == 9 ? import_t{ import.dll, "NotImported" } : import);
+		}
+
+		const auto rounds = a_quick ? 1 : 10;
+		auto buildNs = std::numeric_limits<double>::infinity();
+		std::optional<REL::ImportIndex> index;
+		for (int round = 0; round < rounds; ++round) {
+			index.reset();
+			buildNs = std::min(buildNs, test::time_ns([&] { index.emplace(image); }));
+		}
+		TEST_CHECK(index->size() <= imports.size());
+
+		std::size_t found = 0;
+		const auto indexNs = test::time_ns([&] {
+			for (const auto& [dll, function] : lookups) {
+				found += index->find(dll, function).has_value();
+			}
+		});
+
+		std::size_t scanned = 0;
+		const auto scanNs = test::time_ns([&] {
+			for (const auto& [dll, function] : lookups) {
+				scanned += scan(image, dll, function).has_value();
+			}
+		});
+		TEST_CHECK(found == scanned);
+
+		a_results.push_back({ a_name, imports.size(), "build", "ImportIndex", buildNs });
+		a_results.push_back({ a_name, imports.size(), "find", "ImportIndex", indexNs / lookups.size() });
+		a_results.push_back({ a_name, imports.size(), "find", "scan", scanNs / lookups.size() });
+	}
+}
+
+/**
+ * Times building an ImportIndex and looking functions up in it, against walking the import
+ * directory on every lookup as GetIATPtr used to, and prints the results as JSON.
+ *
+ * <p>
+ * PE32+ files given on the command line are read as they are on disk, e.g. Fallout4.exe or a
+ * system dll; without any, the sample image of the tests is used.
+ * </p>
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto quick = test::quick(a_argc, a_argv);
+
+	std::vector<std::filesystem::path> paths;
+	for (const auto arg : std::span{ a_argv, static_cast<std::size_t>(a_argc) }.subspan(1)) {
+		if (std::string_view{ arg } != "--quick") {
+			paths.emplace_back(arg);
+		}
+	}
+
+	std::vector<result_t> results;
+	if (paths.empty()) {
+		bench_file(results, "sample.exe", test::read_sample_pe(), quick);
+	}
+	for (const auto& path : paths) {
+		bench_file(results, path.filename().string(), read_file(path), quick);
+	}
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"file\": \"%s\", \"imports\": %zu, \"workload\": \"%.*s\", \"method\": \"%.*s\", \"ns_per_op\": %.2f }%s\n",
+			result.file.c_str(),
+			result.imports,
+			static_cast<int>(result.workload.size()), result.workload.data(),
+			static_cast<int>(result.method.size()), result.method.data(),
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
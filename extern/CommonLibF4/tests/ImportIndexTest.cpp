@@ -0,0 +1,75 @@
+#include "F4SE/Logger.hpp"
+#include "REL/IAT.hpp"
+
+#include "PEImageCommon.hpp"
+
+namespace
+{
+	void test_index()
+	{
+		const auto file = test::read_sample_pe();
+		const REL::ImportIndex index{ REL::PEImage{ file, REL::PEImage::Layout::kFile } };
+
+		// every import by name, including those of a descriptor without a lookup table
+		TEST_CHECK(index.size() == 8);
+		const auto getProcAddress = index.find("KERNEL32.dll", "GetProcAddress");
+		TEST_CHECK(getProcAddress.has_value());
+		TEST_CHECK(index.find("VERSION.dll", "VerQueryValueW").has_value());
+
+		// slots are laid out in import order
+		const auto getModuleHandle = index.find("KERNEL32.dll", "GetModuleHandleW");
+		TEST_CHECK(getModuleHandle && *getProcAddress == *getModuleHandle + sizeof(std::uint64_t));
+
+		// names are compared without case, the function's too
+		TEST_CHECK(index.find("kernel32.DLL", "getprocaddress") == getProcAddress);
+
+		// an import by ordinal has no name to find it by, but keeps its slot
+		const auto messageBox = index.find("USER32.dll", "MessageBoxW");
+		TEST_CHECK(index.find("USER32.dll", "GetWindowLongPtrW") == *messageBox + 2 * sizeof(std::uint64_t));
+
+		// and a function is only found under the dll it is imported from
+		TEST_CHECK(!index.find("USER32.dll", "GetProcAddress"));
+		TEST_CHECK(!index.find("KERNEL32", "GetProcAddress"));
+		TEST_CHECK(!index.find("KERNEL32.dll", "GetProcAddres"));
+
+		// an image without imports has an empty index
+		const REL::ImportIndex empty{ REL::PEImage{} };
+		TEST_CHECK(empty.size() == 0);
+	}
+
+	void test_module()
+	{
+		auto image = test::map_pe(test::read_sample_pe());
+		const auto module = reinterpret_cast<REX::W32::HMODULE>(image.data());
+
+		// a loaded module's index is built once and shared
+		const auto& index = REL::ImportIndex::get(module);
+		TEST_CHECK(std::addressof(REL::ImportIndex::get(module)) == std::addressof(index));
+		TEST_CHECK(index.size() == 8);
+
+		// and GetIATPtr hands out the slot in the module
+		const auto slot = REL::GetIATPtr(module, "kernel32.dll", "LoadLibraryA");
+		TEST_CHECK(slot == image.data() + *index.find("KERNEL32.dll", "LoadLibraryA"));
+		TEST_CHECK(REL::GetIATPtr(module, "kernel32.dll", "Missing") == nullptr);
+
+		// readers racing for a new module all get the one index built for it
+		auto other = image;
+		const auto otherModule = reinterpret_cast<REX::W32::HMODULE>(other.data());
+		std::vector<const REL::ImportIndex*> seen(8);
+		std::vector<std::jthread> threads;
+		for (auto& result : seen) {
+			threads.emplace_back([&] { result = std::addressof(REL::ImportIndex::get(otherModule)); });
+		}
+		threads.clear();
+		TEST_CHECK(std::ranges::all_of(seen, [&](const REL::ImportIndex* a_index) { return a_index == seen.front(); }));
+		TEST_CHECK(seen.front() != std::addressof(index));
+	}
+}
+
+int main()
+{
+	test_index();
+	test_module();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+#include "F4SE/InputMap.hpp"
+
+namespace
+{
+	using namespace F4SE;
+
+	struct result_t
+	{
+		std::string_view method;
+		std::string_view op;
+		double nsPerOp;
+	};
+
+	struct key_entry_t
+	{
+		std::uint32_t keyCode;
+		std::string name;
+	};
+
+	[[nodiscard]] bool iequals(std::string_view a_lhs, std::string_view a_rhs)
+	{
+		const auto upper = [](char a_ch) { return a_ch >= 'a' && a_ch <= 'z' ? static_cast<char>(a_ch - 'a' + 'A') : a_ch; };
+		return std::ranges::equal(a_lhs, a_rhs, [&](char a_l, char a_r) { return upper(a_l) == upper(a_r); });
+	}
+
+	// how key names were parsed before the perfect hash
+	[[nodiscard]] std::uint32_t linear_key_code(std::span<const key_entry_t> a_keys, std::string_view a_name)
+	{
+		for (const auto& key : a_keys) {
+			if (iequals(key.name, a_name)) {
+				return key.keyCode;
+			}
+		}
+		return InputMap::kMaxMacros;
+	}
+}
+
+/**
+ * Times naming and parsing every named key code, with names in mixed case, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto rounds = test::quick(a_argc, a_argv) ? 10 : 10'000;
+
+	std::vector<key_entry_t> keys;
+	for (std::uint32_t keyCode = 0; keyCode < InputMap::kMaxMacros; ++keyCode) {
+		const auto name = InputMap::GetKeyName(keyCode);
+		if (!name.empty()) {
+			keys.push_back({ keyCode, std::string(name) });
+		}
+	}
+
+	// what configs actually contain, rather than the canonical spelling
+	std::vector<std::string> mixed;
+	for (const auto& key : keys) {
+		auto name = key.name;
+		for (std::size_t i = 0; i < name.size(); i += 2) {
+			if (name[i] >= 'A' && name[i] <= 'Z') {
+				name[i] = static_cast<char>(name[i] - 'A' + 'a');
+			}
+		}
+		mixed.push_back(std::move(name));
+	}
+
+	const auto ops = static_cast<double>(rounds) * static_cast<double>(keys.size());
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_method, std::string_view a_op, auto a_func) {
+		results.push_back({ a_method, a_op, test::time_ns([&] {
+			std::size_t sum = 0;
+			for (int i = 0; i < rounds; ++i) {
+				for (std::size_t j = 0; j < keys.size(); ++j) {
+					sum += a_func(j);
+				}
+			}
+			test::do_not_optimize(sum);
+		}) / ops });
+	};
+
+	run("GetKeyName", "name", [&](std::size_t a_index) { return InputMap::GetKeyName(keys[a_index].keyCode).size(); });
+	run("GetKeyCode", "parse", [&](std::size_t a_index) { return static_cast<std::size_t>(InputMap::GetKeyCode(mixed[a_index])); });
+	run("linear", "parse", [&](std::size_t a_index) { return static_cast<std::size_t>(linear_key_code(keys, mixed[a_index])); });
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"op\": \"%.*s\", \"names\": %zu, \"ns_per_op\": %.2f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			static_cast<int>(result.op.size()), result.op.data(),
+			keys.size(),
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+#include "F4SE/InputMap.hpp"
+
+#include "REX/PS4/SCEPAD.hpp"
+#include "REX/W32/DINPUT.hpp"
+#include "REX/W32/XINPUT.hpp"
+
+namespace
+{
+	using namespace F4SE;
+
+	[[nodiscard]] std::string to_lower(std::string_view a_name)
+	{
+		std::string result(a_name);
+		for (auto& ch : result) {
+			if (ch >= 'A' && ch <= 'Z') {
+				ch = static_cast<char>(ch - 'A' + 'a');
+			}
+		}
+		return result;
+	}
+
+	void test_key_names()
+	{
+		TEST_CHECK(InputMap::GetKeyName(REX::W32::DIK_ESCAPE) == "ESCAPE");
+		TEST_CHECK(InputMap::GetKeyName(REX::W32::DIK_LSHIFT) == "LSHIFT");
+		TEST_CHECK(InputMap::GetKeyName(InputMap::kMacro_MouseButtonOffset) == "MOUSE1");
+		TEST_CHECK(InputMap::GetKeyName(InputMap::kMacro_MouseWheelOffset + 1) == "WHEEL_DOWN");
+		TEST_CHECK(InputMap::GetKeyName(InputMap::kGamepadButtonOffset_A) == "GAMEPAD_A");
+		TEST_CHECK(InputMap::GetKeyName(InputMap::kMaxMacros).empty());
+		TEST_CHECK(InputMap::GetKeyName(0xFFFFFFFF).empty());
+
+		TEST_CHECK(InputMap::GetKeyCode("lshift") == REX::W32::DIK_LSHIFT);
+		TEST_CHECK(InputMap::GetKeyCode("Gamepad_Rt") == InputMap::kGamepadButtonOffset_RT);
+
+		// aliases parse, but a key is always written out under its first name
+		TEST_CHECK(InputMap::GetKeyCode("BACKSPACE") == REX::W32::DIK_BACK);
+		TEST_CHECK(InputMap::GetKeyName(REX::W32::DIK_BACKSPACE) == "BACK");
+
+		TEST_CHECK(InputMap::GetKeyCode("") == InputMap::kMaxMacros);
+		TEST_CHECK(InputMap::GetKeyCode("LSHIFTT") == InputMap::kMaxMacros);
+		TEST_CHECK(InputMap::GetKeyCode("MOUSE9") == InputMap::kMaxMacros);
+
+		// every named key code parses back from its name, in either case
+		std::size_t named = 0;
+		for (std::uint32_t keyCode = 0; keyCode < InputMap::kMaxMacros; ++keyCode) {
+			const auto name = InputMap::GetKeyName(keyCode);
+			if (!name.empty()) {
+				TEST_CHECK(InputMap::GetKeyCode(name) == keyCode);
+				TEST_CHECK(InputMap::GetKeyCode(to_lower(name)) == keyCode);
+				++named;
+			}
+		}
+		TEST_CHECK(named > InputMap::kMaxMacros - InputMap::kMacro_NumKeyboardKeys);
+	}
+
+	void test_pad_masks()
+	{
+		TEST_CHECK(InputMap::XInputToScePadOffset(REX::W32::XINPUT_GAMEPAD_A) == REX::PS4::SCE_PAD_BUTTON_CROSS);
+		TEST_CHECK(InputMap::ScePadOffsetToXInput(REX::PS4::SCE_PAD_BUTTON_TRIANGLE) == REX::W32::XINPUT_GAMEPAD_Y);
+
+		// the triggers have no pad button and pass through, as does anything unmapped
+		TEST_CHECK(InputMap::XInputToScePadOffset(0x9) == 0x9);
+		TEST_CHECK(InputMap::XInputToScePadOffset(0) == 0);
+		TEST_CHECK(InputMap::XInputToScePadOffset(0x3) == 0x3);
+
+		for (std::uint32_t bit = 0; bit < 32; ++bit) {
+			const auto mask = 1u << bit;
+			const auto scePad = InputMap::XInputToScePadOffset(mask);
+			if (scePad != mask) {
+				TEST_CHECK(InputMap::ScePadOffsetToXInput(scePad) == mask);
+			}
+		}
+	}
+}
+
+int main()
+{
+	test_key_names();
+	test_pad_masks();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+#include "REX/REX/JSON.hpp"
+
+#include <nlohmann/json.hpp>
+
+namespace
+{
+	using Store = REX::JSON::SettingStore;
+
+	struct result_t
+	{
+		std::string_view method;
+		std::string_view op;
+		double nsPerOp;
+	};
+
+	inline constexpr std::size_t SECTIONS = 50;
+	inline constexpr std::size_t GROUPS = 10;
+
+	// how settings were loaded before paths were resolved up front, a json_pointer per setting
+	[[nodiscard]] std::int64_t pointer_load(const std::string& a_file, std::span<const std::string> a_paths)
+	{
+		std::ifstream file{ a_file };
+		const auto json = nlohmann::json::parse(file);
+
+		std::int64_t sum = 0;
+		for (const auto& path : a_paths) {
+			const nlohmann::json::json_pointer pointer{ path };
+			if (json.contains(pointer)) {
+				sum += json.at(pointer).get<std::int32_t>();
+			}
+		}
+		return sum;
+	}
+}
+
+/**
+ * Times loading and saving a store of integer settings nested two tables deep, against looking
+ * each one up through its own json pointer, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto count = test::quick(a_argc, a_argv) ? std::size_t{ 500 } : std::size_t{ 5000 };
+	const auto rounds = test::quick(a_argc, a_argv) ? 2 : 20;
+
+	const auto root = std::filesystem::temp_directory_path() / "f4se_json_setting_bench";
+	std::filesystem::create_directories(root);
+	const F4SE::stl::scope_exit cleanup([&] {
+		std::error_code ec;
+		std::filesystem::remove_all(root, ec);
+	});
+
+	const auto base = (root / "base.json").string();
+	const auto user = (root / "user.json").string();
+
+	// settings keep a view of their path, so every path is in place before the first is registered
+	std::vector<std::string> paths;
+	paths.reserve(count);
+	nlohmann::json json;
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto section = std::format("Section{}", i % SECTIONS);
+		const auto group = std::format("Group{}", (i / SECTIONS) % GROUPS);
+		const auto key = std::format("iKey{}", i);
+		paths.push_back(std::format("/{}/{}/{}", section, group, key));
+		json[section][group][key] = static_cast<std::int32_t>(i);
+	}
+
+	{
+		std::ofstream file{ base, std::ios::trunc };
+		file << std::setw(4) << json;
+	}
+
+	std::vector<std::unique_ptr<REX::JSON::I32<>>> settings;
+	for (const auto& path : paths) {
+		settings.push_back(std::make_unique<REX::JSON::I32<>>(path, -1));
+	}
+
+	const auto store = Store::GetSingleton();
+	store->Init(base, user);
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_method, std::string_view a_op, auto a_func) {
+		a_func();
+		results.push_back({ a_method, a_op, test::time_ns([&] {
+			for (int i = 0; i < rounds; ++i) {
+				a_func();
+			}
+		}) / rounds });
+	};
+
+	run("SettingStore", "load", [&] { store->Load(); });
+	run("json_pointer", "load", [&] { test::do_not_optimize(pointer_load(base, paths)); });
+
+	// nothing changed, so this only compares values against the kept document
+	run("SettingStore", "save_unchanged", [&] { store->Save(); });
+
+	std::int32_t value = 0;
+	run("SettingStore", "save_one_changed", [&] {
+		settings[settings.size() / 2]->SetValue(++value);
+		store->Save();
+	});
+
+	TEST_CHECK(settings.front()->GetValue() == 0);
+	TEST_CHECK(settings.back()->GetValue() == static_cast<std::int32_t>(count - 1));
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"op\": \"%.*s\", \"settings\": %zu, \"ms_per_op\": %.3f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			static_cast<int>(result.op.size()), result.op.data(),
+			count,
+			result.nsPerOp / 1e6,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+#include "REX/REX/JSON.hpp"
+
+#include <nlohmann/json.hpp>
+
+namespace
+{
+	using Store = REX::JSON::SettingStore;
+
+	// registered with the store before main, like a plugin's settings
+	REX::JSON::I32<> nested{ "/General/Nested/iValue", 1 };
+	REX::JSON::Bool<> shared{ "/General/Nested/bShared", false };
+	REX::JSON::F32<> topLevel{ "fTopLevel", 1.5f };
+	REX::JSON::Str<> escaped{ "/a~1b/c~0d", std::string("default") };
+	REX::JSON::U8<> element{ "/list/1", 7 };
+	REX::JSON::I16<> mistyped{ "/General/iMistyped", 3 };
+	REX::JSON::U32<> missing{ "/Missing/uValue", 9 };
+
+	struct files_t
+	{
+		files_t()
+		{
+			std::filesystem::create_directories(root);
+		}
+
+		~files_t()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(root, ec);
+		}
+
+		std::filesystem::path root{ std::filesystem::temp_directory_path() / "f4se_json_setting_test" };
+		std::string base{ (root / "base.json").string() };
+		std::string user{ (root / "user.json").string() };
+	};
+
+	void write(const std::string& a_path, std::string_view a_text)
+	{
+		std::ofstream file{ a_path, std::ios::trunc };
+		file << a_text;
+	}
+
+	[[nodiscard]] std::string read(const std::string& a_path)
+	{
+		std::ifstream file{ a_path };
+		return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	}
+
+	void test_load(const files_t& a_files)
+	{
+		write(a_files.base, R"({"General":{"Nested":{"iValue":10,"bShared":true},"iMistyped":"text"},"fTopLevel":2.5,"a/b":{"c~d":"base"},"list":[1,2,3],"extra":{"kept":1}})");
+		write(a_files.user, R"({"General":{"Nested":{"iValue":20}},"list":[4]})");
+
+		Store::GetSingleton()->Load();
+
+		// the user file overrides the base, which becomes the default
+		TEST_CHECK(nested.GetValue() == 20);
+		TEST_CHECK(nested.GetValueDefault() == 10);
+		TEST_CHECK(shared.GetValue() == true);
+		TEST_CHECK(topLevel.GetValue() == 2.5f);
+		TEST_CHECK(escaped.GetValue() == "base");
+
+		// an index past the end of the user array falls back to the base value
+		TEST_CHECK(element.GetValue() == 2);
+
+		// a value of the wrong type keeps its default, without stopping the rest of the load
+		TEST_CHECK(mistyped.GetValue() == 3);
+		TEST_CHECK(missing.GetValue() == 9);
+	}
+
+	void test_save(const files_t& a_files)
+	{
+		// the first save writes the user overrides, the missing key and the repaired one into the base
+		Store::GetSingleton()->Save();
+
+		auto json = nlohmann::json::parse(read(a_files.base));
+		TEST_CHECK(json["General"]["Nested"]["iValue"] == 20);
+		TEST_CHECK(json["General"]["iMistyped"] == 3);
+		TEST_CHECK(json["Missing"]["uValue"] == 9);
+		TEST_CHECK(json["list"] == nlohmann::json::array({ 1, 2, 3 }));
+		TEST_CHECK(json["extra"]["kept"] == 1);
+
+		// nothing changed since, so the file is left exactly as it was
+		const auto before = read(a_files.base);
+		Store::GetSingleton()->Save();
+		TEST_CHECK(read(a_files.base) == before);
+
+		nested.SetValue(30);
+		escaped.SetValue("saved");
+		Store::GetSingleton()->Save();
+
+		json = nlohmann::json::parse(read(a_files.base));
+		TEST_CHECK(json["General"]["Nested"]["iValue"] == 30);
+		TEST_CHECK(json["a/b"]["c~d"] == "saved");
+		TEST_CHECK(json["extra"]["kept"] == 1);
+	}
+
+	void test_save_without_base(const files_t& a_files)
+	{
+		std::filesystem::remove(a_files.base);
+		Store::GetSingleton()->Save();
+
+		const auto json = nlohmann::json::parse(read(a_files.base));
+		TEST_CHECK(json["General"]["Nested"]["iValue"] == 30);
+		TEST_CHECK(json["fTopLevel"] == 2.5f);
+		TEST_CHECK(json["list"] == nlohmann::json::array({ nullptr, 2 }));
+	}
+}
+
+int main()
+{
+	const files_t files;
+	Store::GetSingleton()->Init(files.base, files.user);
+
+	test_load(files);
+	test_save(files);
+	test_save_without_base(files);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+#include "F4SE/JobSystem.hpp"
+
+#include "CoroutineCommon.hpp"
+
+namespace
+{
+	using microseconds = std::chrono::microseconds;
+
+	// the simulated time, advanced only by the frame loop and the jobs it runs
+	auto& simulated = test::FrameLoop::simulated;
+
+	test::FrameLoop loop;
+
+	inline constexpr microseconds GAME_WORK{ 10000 };
+	inline constexpr microseconds MAX_JOB{ 250 };
+	inline constexpr std::size_t FRAMES = 600;
+	inline constexpr std::size_t SPIKE = 300;
+
+	struct scenario_t
+	{
+		[[nodiscard]] microseconds worst() const { return std::ranges::max(frames); }
+
+		[[nodiscard]] double stddev() const
+		{
+			double mean = 0.0;
+			for (const auto frame : frames) {
+				mean += static_cast<double>(frame.count()) / static_cast<double>(frames.size());
+			}
+
+			double variance = 0.0;
+			for (const auto frame : frames) {
+				const auto delta = static_cast<double>(frame.count()) - mean;
+				variance += delta * delta / static_cast<double>(frames.size());
+			}
+			return std::sqrt(variance);
+		}
+
+		std::vector<microseconds> frames;
+		std::size_t submitted{ 0 };
+		std::size_t ran{ 0 };
+		std::size_t lateHigh{ 0 };
+		F4SE::JobSystem::Stats stats;
+	};
+
+	/**
+	 * Two jobs a frame, with spikes of 300 at frames 100 and 400, every job costing 50-250us drawn
+	 * from a fixed seed. Every tenth frame also queues a high priority job, which is late unless it
+	 * runs in the frame it was queued before. Frames go on until the backlog is drained.
+	 */
+	[[nodiscard]] scenario_t simulate(microseconds a_budget)
+	{
+		auto& jobs = F4SE::JobSystem::get();
+		jobs.set_frame_budget(a_budget);
+		const auto before = jobs.stats();
+
+		scenario_t result;
+		std::mt19937 rng{ 36 };
+		std::size_t current = 0;
+		for (; current < FRAMES || result.ran < result.submitted; ++current) {
+			TEST_CHECK(current < 2 * FRAMES);
+
+			if (current < FRAMES) {
+				const auto count = 2 + (current == 100 || current == 400 ? SPIKE : 0);
+				for (std::size_t i = 0; i < count; ++i) {
+					const auto cost = microseconds(50 + static_cast<std::int64_t>(rng() % 201));
+					const auto priority = i % 2 == 0 ? F4SE::JobPriority::kNormal : F4SE::JobPriority::kLow;
+					jobs.submit_main([&, cost]() { simulated += cost; ++result.ran; }, priority);
+					++result.submitted;
+				}
+
+				if (current % 10 == 0) {
+					jobs.submit_main([&, due = current]() {
+						simulated += microseconds{ 100 };
+						++result.ran;
+						result.lateHigh += current != due ? 1 : 0;
+					},
+						F4SE::JobPriority::kHigh);
+					++result.submitted;
+				}
+			}
+
+			result.frames.push_back(loop.frame(GAME_WORK));
+		}
+
+		const auto after = jobs.stats();
+		result.stats.frames = after.frames - before.frames;
+		result.stats.overruns = after.overruns - before.overruns;
+		result.stats.mainJobs = after.mainJobs - before.mainJobs;
+		result.stats.worstFrame = after.worstFrame;
+		return result;
+	}
+
+	void test_frame_budget_under_spikes()
+	{
+		// the worst frame in the stats is the worst so far, so the bounded run goes first
+		const auto budget = microseconds{ 2000 };
+		const auto bounded = simulate(budget);
+		const auto unbounded = simulate(microseconds{ 1'000'000'000 });
+
+		// without a budget, each spike lands in a single frame
+		TEST_CHECK(unbounded.frames.size() == FRAMES);
+		TEST_CHECK(unbounded.worst() >= GAME_WORK + SPIKE * microseconds{ 50 });
+		TEST_CHECK(unbounded.stats.overruns == 0);
+		TEST_CHECK(unbounded.stats.worstFrame == unbounded.worst() - GAME_WORK);
+
+		// with one, no frame runs past the budget by more than a single job
+		TEST_CHECK(bounded.worst() <= GAME_WORK + budget + MAX_JOB);
+		TEST_CHECK(bounded.stats.worstFrame <= budget + MAX_JOB);
+		TEST_CHECK(bounded.stddev() * 4 < unbounded.stddev());
+
+		// the carried over work still finishes, and before the steady load ends
+		TEST_CHECK(bounded.ran == bounded.submitted);
+		TEST_CHECK(bounded.stats.mainJobs == bounded.submitted);
+		TEST_CHECK(bounded.frames.size() == FRAMES);
+		TEST_CHECK(bounded.stats.overruns > 0);
+		TEST_CHECK(bounded.stats.overruns < bounded.stats.frames);
+
+		// and high priority jobs jump the backlog
+		TEST_CHECK(bounded.lateHigh == 0);
+
+		// the same seed gives the same frames
+		const auto again = simulate(budget);
+		TEST_CHECK(again.frames == bounded.frames);
+	}
+
+	void test_workers()
+	{
+		auto& jobs = F4SE::JobSystem::get();
+		const auto before = jobs.stats();
+
+		// half the jobs are spawned by workers, onto their own deques
+		constexpr std::size_t COUNT = 20000;
+		std::atomic<std::size_t> done{ 0 };
+		jobs.start(4);
+		for (std::size_t i = 0; i < COUNT / 2; ++i) {
+			jobs.submit([&]() {
+				jobs.submit([&]() { done.fetch_add(1); }, F4SE::JobPriority::kLow);
+				done.fetch_add(1);
+			});
+		}
+
+		// stopping runs everything queued, including what is spawned while it stops
+		jobs.stop();
+		TEST_CHECK(done.load() == COUNT);
+		TEST_CHECK(jobs.stats().workerJobs - before.workerJobs == COUNT);
+
+		// a submit after stopping starts the pool again, and a throwing job does not end its worker
+		jobs.submit([]() { throw std::runtime_error("job failed"); });
+		jobs.submit([&]() { done.fetch_add(1); });
+		jobs.stop();
+		TEST_CHECK(done.load() == COUNT + 1);
+
+		jobs.stop();
+	}
+}
+
+int main()
+{
+	spdlog::set_level(spdlog::level::off);
+
+	auto& jobs = F4SE::JobSystem::get();
+	jobs.set_executor(loop);
+	jobs.set_clock(&test::FrameLoop::now);
+
+	test_frame_budget_under_spikes();
+	test_workers();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,58 @@
+#include "F4SE/Logger.hpp"
+
+#include <spdlog/sinks/null_sink.h>
+
+namespace
+{
+	struct result_t
+	{
+		std::string_view path;
+		double nsPerOp;
+	};
+
+	void debug_site(int a_index) { F4SE::log::debug("debug {}", a_index); }
+	void info_site(int a_index) { F4SE::log::info("info {}", a_index); }
+	void spam_site(int a_index) { F4SE::log::info("spam {}", a_index); }
+}
+
+/**
+ * Times a log call on each path through the rate limit, into a null sink, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto calls = test::quick(a_argc, a_argv) ? 10'000 : 10'000'000;
+
+	auto logger = std::make_shared<spdlog::logger>("bench", std::make_shared<spdlog::sinks::null_sink_st>());
+	logger->set_level(spdlog::level::info);
+	spdlog::set_default_logger(std::move(logger));
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_path, auto a_site) {
+		results.push_back({ a_path, test::time_ns([&] {
+			for (int i = 0; i < calls; ++i) {
+				a_site(i);
+			}
+		}) / calls });
+	};
+
+	F4SE::log::set_rate_limit(0);
+	run("unlimited", info_site);
+
+	F4SE::log::set_rate_limit(20, std::chrono::hours(1));
+	run("filtered_by_level", debug_site);
+	run("suppressed", spam_site);
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"path\": \"%.*s\", \"calls\": %d, \"ns_per_op\": %.2f }%s\n",
+			static_cast<int>(result.path.size()), result.path.data(),
+			calls,
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+#include "F4SE/Logger.hpp"
+
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <sstream>
+
+namespace
+{
+	std::ostringstream output;
+
+	void use_logger(spdlog::level::level_enum a_level)
+	{
+		auto logger = std::make_shared<spdlog::logger>("test", std::make_shared<spdlog::sinks::ostream_sink_st>(output));
+		logger->set_level(a_level);
+		logger->set_pattern("%l %v");
+		spdlog::set_default_logger(std::move(logger));
+	}
+
+	// the lines logged since the last call
+	[[nodiscard]] std::vector<std::string> take_lines()
+	{
+		std::vector<std::string> lines;
+		std::istringstream in(output.str());
+		for (std::string line; std::getline(in, line);) {
+			lines.push_back(line);
+		}
+		output.str({});
+		return lines;
+	}
+
+	// each of these is one call site, which is what the budget is counted against
+	void info_site(int a_index) { F4SE::log::info("info {}", a_index); }
+	void debug_site(int a_index) { F4SE::log::debug("debug {}", a_index); }
+	void warn_site(int a_index) { F4SE::log::warn("warn {}", a_index); }
+	void quiet_site(int a_index) { F4SE::log::error("quiet {}", a_index); }
+	void loud_site(int a_index) { F4SE::log::info("loud {}", a_index); }
+
+	void test_budget()
+	{
+		F4SE::log::set_rate_limit(3, std::chrono::hours(1));
+		for (int i = 0; i < 10; ++i) {
+			info_site(i);
+		}
+		TEST_CHECK(take_lines() == std::vector<std::string>({ "info info 0", "info info 1", "info info 2" }));
+
+		F4SE::log::flush_rate_limits();
+		TEST_CHECK(take_lines() == std::vector<std::string>({ "info previous message suppressed 7 times" }));
+
+		// flushing starts a new period
+		info_site(10);
+		TEST_CHECK(take_lines() == std::vector<std::string>({ "info info 10" }));
+	}
+
+	void test_filtered_calls_spend_nothing()
+	{
+		F4SE::log::set_rate_limit(2, std::chrono::hours(1));
+		use_logger(spdlog::level::info);
+		for (int i = 0; i < 100; ++i) {
+			debug_site(i);
+		}
+		TEST_CHECK(take_lines().empty());
+
+		use_logger(spdlog::level::debug);
+		debug_site(100);
+		debug_site(101);
+		TEST_CHECK(take_lines() == std::vector<std::string>({ "debug debug 100", "debug debug 101" }));
+	}
+
+	void test_rollover()
+	{
+		F4SE::log::set_rate_limit(2, std::chrono::milliseconds(20));
+		for (int i = 0; i < 5; ++i) {
+			warn_site(i);
+		}
+		TEST_CHECK(take_lines().size() == 2);
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(40));
+		warn_site(5);
+		TEST_CHECK(take_lines() == std::vector<std::string>({ "warning previous message suppressed 3 times", "warning warn 5" }));
+	}
+
+	void test_quiet_sites_are_swept()
+	{
+		F4SE::log::set_rate_limit(1, std::chrono::milliseconds(20));
+		quiet_site(0);
+		quiet_site(1);
+		quiet_site(2);
+		TEST_CHECK(take_lines().size() == 1);
+
+		// the quiet site never logs again, so the next site over budget reports it
+		std::this_thread::sleep_for(std::chrono::milliseconds(40));
+		loud_site(0);
+		loud_site(1);
+		const auto lines = take_lines();
+		TEST_CHECK(std::ranges::count(lines, std::string("error previous message suppressed 2 times")) == 1);
+	}
+
+	void test_disabled()
+	{
+		F4SE::log::set_rate_limit(0);
+		for (int i = 0; i < 50; ++i) {
+			info_site(i);
+		}
+		TEST_CHECK(take_lines().size() == 50);
+	}
+}
+
+int main()
+{
+	use_logger(spdlog::level::trace);
+
+	test_budget();
+	test_filtered_calls_spend_nothing();
+	use_logger(spdlog::level::trace);
+	test_rollover();
+	test_quiet_sites_are_swept();
+	test_disabled();
+
+	return EXIT_SUCCESS;
+}
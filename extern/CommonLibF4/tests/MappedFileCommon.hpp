@@ -0,0 +1,70 @@
+#pragma once
+
+// a stand-in for the mmio mapping F4SE/Impl/PCH.hpp pulls in, over POSIX mmap
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mmio
+{
+	class mapped_file_source
+	{
+	public:
+		mapped_file_source() noexcept = default;
+		mapped_file_source(const mapped_file_source&) = delete;
+
+		~mapped_file_source() { close(); }
+
+		mapped_file_source& operator=(const mapped_file_source&) = delete;
+
+		// like mmio, an empty file opens but maps nothing
+		bool open(const std::filesystem::path& a_path)
+		{
+			close();
+
+			const auto fd = ::open(a_path.c_str(), O_RDONLY);
+			if (fd == -1) {
+				return false;
+			}
+
+			struct stat info{};
+			if (::fstat(fd, std::addressof(info)) == -1) {
+				::close(fd);
+				return false;
+			}
+
+			_size = static_cast<std::size_t>(info.st_size);
+			if (_size > 0) {
+				const auto data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (data == MAP_FAILED) {
+					_size = 0;
+					::close(fd);
+					return false;
+				}
+				_data = static_cast<const std::byte*>(data);
+			}
+
+			::close(fd);
+			return true;
+		}
+
+		void close() noexcept
+		{
+			if (_data) {
+				::munmap(const_cast<std::byte*>(_data), _size);
+			}
+			_data = nullptr;
+			_size = 0;
+		}
+
+		[[nodiscard]] bool is_open() const noexcept { return _data != nullptr; }
+		[[nodiscard]] const std::byte* data() const noexcept { return _data; }
+		[[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+	private:
+		const std::byte* _data{ nullptr };
+		std::size_t _size{ 0 };
+	};
+}
@@ -0,0 +1,188 @@
+#include "F4SE/MessageChannel.hpp"
+
+namespace
+{
+	struct result_t
+	{
+		std::string_view workload;
+		std::string_view method;
+		double nsPerOp;
+	};
+
+	template <std::uint32_t N>
+	struct numbered_t
+	{
+		static constexpr std::uint32_t MESSAGE_ID = 0x1000 + N * 37;
+		static constexpr std::uint16_t MESSAGE_VERSION = 1;
+
+		std::uint32_t value;
+	};
+
+	struct Sum
+	{
+		template <class T>
+		void operator()(const T& a_message)
+		{
+			total += a_message.value;
+		}
+
+		std::uint64_t total{ 0 };
+	};
+
+	template <class... Ts>
+	struct types_t
+	{
+		using channel = F4SE::MessageChannel<Ts...>;
+
+		// the unframed switch a plugin would otherwise write, which checks only the id and length
+		template <class Handler>
+		static bool dispatch_raw(const F4SE::MessagingInterface::Message& a_msg, Handler& a_handler)
+		{
+			const auto handle = [&]<class T>(std::type_identity<T>) {
+				T message;
+				std::memcpy(std::addressof(message), a_msg.data, sizeof(T));
+				a_handler(message);
+				return true;
+			};
+			return ((a_msg.type == Ts::MESSAGE_ID && a_msg.dataLen == sizeof(Ts) && handle(std::type_identity<Ts>{})) || ...);
+		}
+	};
+
+	template <std::size_t... I>
+	[[nodiscard]] auto make_types(std::index_sequence<I...>) -> types_t<numbered_t<I>...>;
+
+	template <std::size_t N>
+	using types = decltype(make_types(std::make_index_sequence<N>{}));
+
+	struct captured_t
+	{
+		std::uint32_t type;
+		std::vector<std::byte> data;
+	};
+
+	std::vector<captured_t> captured;
+	Sum listened;
+	bool listenFramed{ true };
+
+	void on_capture(F4SE::MessagingInterface::Message* a_msg)
+	{
+		const auto bytes = static_cast<const std::byte*>(a_msg->data);
+		captured.push_back({ a_msg->type, { bytes, bytes + a_msg->dataLen } });
+	}
+
+	template <std::size_t N>
+	void on_listen(F4SE::MessagingInterface::Message* a_msg)
+	{
+		if (listenFramed) {
+			std::ignore = types<N>::channel::dispatch(*a_msg, listened);
+		}
+		else {
+			std::ignore = types<N>::dispatch_raw(*a_msg, listened);
+		}
+	}
+
+	// sends the numbered message picked by a_index, either framed for a channel or as the bare struct
+	template <std::size_t... I>
+	bool send(const F4SE::MessagingInterface& a_intfc, std::size_t a_index, std::uint32_t a_value, bool a_framed, std::index_sequence<I...>)
+	{
+		const auto one = [&]<std::uint32_t J>(numbered_t<J> a_message) {
+			if (a_framed) {
+				return F4SE::SendChannelMessage(a_intfc, a_message);
+			}
+			return a_intfc.Dispatch(a_message.MESSAGE_ID, std::addressof(a_message), sizeof(a_message), nullptr);
+		};
+		return ((a_index == I && one(numbered_t<I>{ a_value })) || ...);
+	}
+
+	// the messages as a listener would receive them, with their types in random order
+	template <std::size_t N>
+	[[nodiscard]] std::vector<F4SE::MessagingInterface::Message> capture(std::span<const std::size_t> a_order, bool a_framed)
+	{
+		F4SE::MessagingInterface intfc;
+		intfc.RegisterListener(on_capture, intfc.name);
+
+		captured.clear();
+		for (std::size_t i = 0; i < a_order.size(); ++i) {
+			std::ignore = send(intfc, a_order[i] % N, static_cast<std::uint32_t>(i), a_framed, std::make_index_sequence<N>{});
+		}
+
+		std::vector<F4SE::MessagingInterface::Message> result;
+		result.reserve(captured.size());
+		for (auto& [type, data] : captured) {
+			result.push_back({ "TestPlugin", type, static_cast<std::uint32_t>(data.size()), data.data() });
+		}
+		return result;
+	}
+
+	template <std::size_t N>
+	void run_receive(std::vector<result_t>& a_results, std::string_view a_workload, std::span<const std::size_t> a_order)
+	{
+		const auto framed = capture<N>(a_order, true);
+		Sum channelSum;
+		const auto channelNs = test::time_ns([&] {
+			for (const auto& msg : framed) {
+				TEST_CHECK(types<N>::channel::dispatch(msg, channelSum) == types<N>::channel::Result::kHandled);
+			}
+		});
+
+		const auto raw = capture<N>(a_order, false);
+		Sum rawSum;
+		const auto rawNs = test::time_ns([&] {
+			for (const auto& msg : raw) {
+				TEST_CHECK(types<N>::dispatch_raw(msg, rawSum));
+			}
+		});
+
+		TEST_CHECK(channelSum.total == rawSum.total);
+		a_results.push_back({ a_workload, "MessageChannel", channelNs / a_order.size() });
+		a_results.push_back({ a_workload, "switch", rawNs / a_order.size() });
+	}
+}
+
+/**
+ * Times routing received messages through a MessageChannel, which checks the framed header, against
+ * the switch on the raw type id it replaces, for channels of 4 and 32 message types. Also times
+ * sending through the host mock end to end, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const std::size_t count = test::quick(a_argc, a_argv) ? 10'000 : 1'000'000;
+
+	std::mt19937_64 rng{ 37 };
+	std::vector<std::size_t> order(count);
+	for (auto& index : order) {
+		index = static_cast<std::size_t>(rng());
+	}
+
+	std::vector<result_t> results;
+	run_receive<4>(results, "receive_4", order);
+	run_receive<32>(results, "receive_32", order);
+
+	// from the sender's stack through the mock to the listener's handler
+	F4SE::MessagingInterface intfc;
+	intfc.RegisterListener(on_listen<4>, intfc.name);
+	for (const auto framed : { true, false }) {
+		listenFramed = framed;
+		const auto ns = test::time_ns([&] {
+			for (std::size_t i = 0; i < count; ++i) {
+				std::ignore = send(intfc, order[i] % 4, static_cast<std::uint32_t>(i), framed, std::make_index_sequence<4>{});
+			}
+		});
+		results.push_back({ "send_4", framed ? "MessageChannel" : "switch", ns / count });
+	}
+	test::do_not_optimize(listened.total);
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"workload\": \"%.*s\", \"method\": \"%.*s\", \"ns_per_op\": %.2f }%s\n",
+			static_cast<int>(result.workload.size()), result.workload.data(),
+			static_cast<int>(result.method.size()), result.method.data(),
+			result.nsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
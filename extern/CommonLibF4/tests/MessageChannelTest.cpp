@@ -0,0 +1,163 @@
+#include "F4SE/MessageChannel.hpp"
+
+namespace
+{
+	std::size_t allocations = 0;
+}
+
+// counts every allocation, so the test can check a message goes through without one
+void* operator new(std::size_t a_size)
+{
+	++allocations;
+	if (const auto mem = std::malloc(a_size != 0 ? a_size : 1)) {
+		return mem;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* a_ptr) noexcept { std::free(a_ptr); }
+void operator delete(void* a_ptr, std::size_t) noexcept { std::free(a_ptr); }
+
+namespace
+{
+	struct Ping
+	{
+		static constexpr std::uint32_t MESSAGE_ID = 0x50494E47;
+		static constexpr std::uint16_t MESSAGE_VERSION = 1;
+
+		std::uint32_t sequence;
+	};
+
+	struct Moved
+	{
+		static constexpr std::uint32_t MESSAGE_ID = 0x100;
+		static constexpr std::uint16_t MESSAGE_VERSION = 2;
+
+		std::uint32_t formID;
+		float x;
+		float y;
+		float z;
+	};
+
+	struct Blob
+	{
+		static constexpr std::uint32_t MESSAGE_ID = 7;
+		static constexpr std::uint16_t MESSAGE_VERSION = 1;
+
+		std::array<std::uint64_t, 64> data;
+	};
+
+	// declared out of id order, which the table sorts
+	using Channel = F4SE::MessageChannel<Ping, Moved, Blob>;
+
+	struct Handler
+	{
+		void operator()(const Ping& a_ping) { pings.push_back(a_ping.sequence); }
+		void operator()(const Moved& a_moved) { moved.push_back(a_moved); }
+		void operator()(const Blob& a_blob) { blobSum += std::accumulate(a_blob.data.begin(), a_blob.data.end(), std::uint64_t{ 0 }); }
+
+		std::vector<std::uint32_t> pings;
+		std::vector<Moved> moved;
+		std::uint64_t blobSum{ 0 };
+	};
+
+	Handler handler;
+	std::vector<Channel::Result> results;
+
+	void on_message(F4SE::MessagingInterface::Message* a_msg)
+	{
+		results.push_back(Channel::dispatch(*a_msg, handler));
+	}
+
+	// the packet SendChannelMessage would build, with its header fields overridable
+	template <class T>
+	[[nodiscard]] std::vector<std::byte> make_packet(const T& a_message, std::uint32_t a_id = T::MESSAGE_ID, std::uint16_t a_version = T::MESSAGE_VERSION, std::uint16_t a_size = sizeof(T))
+	{
+		const F4SE::detail::channel_header_t header{ a_id, a_version, a_size };
+		std::vector<std::byte> packet(sizeof(F4SE::detail::channel_packet_t<T>));
+		std::memcpy(packet.data(), std::addressof(header), sizeof(header));
+		std::memcpy(packet.data() + offsetof(F4SE::detail::channel_packet_t<T>, payload), std::addressof(a_message), sizeof(T));
+		return packet;
+	}
+
+	[[nodiscard]] Channel::Result dispatch_raw(std::uint32_t a_type, void* a_data, std::size_t a_length)
+	{
+		F4SE::MessagingInterface::Message msg{ "TestPlugin", a_type, static_cast<std::uint32_t>(a_length), a_data };
+		return Channel::dispatch(msg, handler);
+	}
+
+	void test_round_trip()
+	{
+		F4SE::MessagingInterface intfc;
+		intfc.RegisterListener(on_message, intfc.name);
+
+		// each message reaches the handler for its type through the mock, as it would through F4SE
+		Blob blob{};
+		std::iota(blob.data.begin(), blob.data.end(), std::uint64_t{ 1 });
+		TEST_CHECK(F4SE::SendChannelMessage(intfc, Ping{ 1 }));
+		TEST_CHECK(F4SE::SendChannelMessage(intfc, Moved{ 0x14, 1.0f, -2.0f, 3.5f }));
+		TEST_CHECK(F4SE::SendChannelMessage(intfc, blob));
+		TEST_CHECK(F4SE::SendChannelMessage(intfc, Ping{ 2 }, "TestPlugin"));
+
+		TEST_CHECK(results == std::vector<Channel::Result>(4, Channel::Result::kHandled));
+		TEST_CHECK(handler.pings == std::vector<std::uint32_t>({ 1, 2 }));
+		TEST_CHECK(handler.moved.size() == 1 && handler.moved[0].formID == 0x14 && handler.moved[0].z == 3.5f);
+		TEST_CHECK(handler.blobSum == 64 * 65 / 2);
+		TEST_CHECK(intfc.dispatchCalls == 4);
+
+		// a message for another plugin never arrives
+		TEST_CHECK(!F4SE::SendChannelMessage(intfc, Ping{ 3 }, "OtherPlugin"));
+		TEST_CHECK(results.size() == 4);
+
+		// sending and receiving allocate nothing, once the handler has room for what it keeps
+		handler.pings.reserve(100);
+		results.reserve(100);
+		const auto before = allocations;
+		for (std::uint32_t i = 0; i < 10; ++i) {
+			std::ignore = F4SE::SendChannelMessage(intfc, Ping{ i });
+		}
+		TEST_CHECK(allocations == before);
+	}
+
+	void test_rejected()
+	{
+		handler = {};
+
+		// a header which disagrees with the declaration never reaches the handler
+		auto ping = make_packet(Ping{ 9 }, Ping::MESSAGE_ID, 2);
+		TEST_CHECK(dispatch_raw(Ping::MESSAGE_ID, ping.data(), ping.size()) == Channel::Result::kBadVersion);
+
+		ping = make_packet(Ping{ 9 }, Ping::MESSAGE_ID, Ping::MESSAGE_VERSION, sizeof(Ping) + 1);
+		TEST_CHECK(dispatch_raw(Ping::MESSAGE_ID, ping.data(), ping.size()) == Channel::Result::kBadSize);
+
+		ping = make_packet(Ping{ 9 }, Moved::MESSAGE_ID);
+		TEST_CHECK(dispatch_raw(Ping::MESSAGE_ID, ping.data(), ping.size()) == Channel::Result::kUnknownID);
+
+		// as does a buffer of the wrong length, or none at all
+		ping = make_packet(Ping{ 9 });
+		TEST_CHECK(dispatch_raw(Ping::MESSAGE_ID, ping.data(), ping.size() - 1) == Channel::Result::kBadSize);
+		TEST_CHECK(dispatch_raw(Ping::MESSAGE_ID, ping.data(), ping.size() + 1) == Channel::Result::kBadSize);
+		TEST_CHECK(dispatch_raw(Ping::MESSAGE_ID, nullptr, ping.size()) == Channel::Result::kBadSize);
+
+		// or an id outside the channel, such as F4SE's own messages
+		TEST_CHECK(dispatch_raw(F4SE::MessagingInterface::kPostLoad, ping.data(), ping.size()) == Channel::Result::kUnknownID);
+		TEST_CHECK(dispatch_raw(0xFFFFFFFF, ping.data(), ping.size()) == Channel::Result::kUnknownID);
+
+		TEST_CHECK(handler.pings.empty());
+
+		// the payload may sit anywhere in the sender's buffer
+		const auto moved = make_packet(Moved{ 0x0100F00D, 4.0f, 5.0f, 6.0f });
+		std::vector<std::byte> unaligned(moved.size() + 1);
+		std::memcpy(unaligned.data() + 1, moved.data(), moved.size());
+		TEST_CHECK(dispatch_raw(Moved::MESSAGE_ID, unaligned.data() + 1, moved.size()) == Channel::Result::kHandled);
+		TEST_CHECK(handler.moved.size() == 1 && handler.moved[0].formID == 0x0100F00D && handler.moved[0].y == 5.0f);
+	}
+}
+
+int main()
+{
+	test_round_trip();
+	test_rejected();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+// stand-ins for the F4SE interface MessageChannel.hpp needs, which it leaves out under F4SE_TEST_SUITE
+
+namespace F4SE
+{
+	/**
+	 * Delivers dispatched messages straight to the listeners registered for this plugin, as F4SE
+	 * would within one process, and counts the dispatches.
+	 */
+	class MessagingInterface
+	{
+	public:
+		enum : std::uint32_t
+		{
+			kPostLoad,
+			kPostPostLoad,
+			kPreLoadGame,
+			kPostLoadGame,
+			kPreSaveGame,
+			kPostSaveGame,
+			kDeleteGame,
+			kInputLoaded,
+			kNewGame,
+			kGameLoaded,
+			kGameDataReady
+		};
+
+		struct Message
+		{
+			const char* sender;
+			std::uint32_t type;
+			std::uint32_t dataLen;
+			void* data;
+		};
+
+		using EventCallback = void(Message* a_msg);
+
+		bool RegisterListener(EventCallback* a_handler) const { return RegisterListener(a_handler, "F4SE"); }
+
+		bool RegisterListener(EventCallback* a_handler, std::string_view a_sender) const
+		{
+			listeners.push_back({ std::string{ a_sender }, a_handler });
+			return true;
+		}
+
+		// a null receiver reaches every listener of this plugin, as a broadcast would
+		bool Dispatch(std::uint32_t a_messageType, void* a_data, std::uint32_t a_dataLen, const char* a_receiver) const
+		{
+			++dispatchCalls;
+			if (a_receiver && name != a_receiver) {
+				return false;
+			}
+
+			Message msg{ name.c_str(), a_messageType, a_dataLen, a_data };
+			for (const auto& [sender, handler] : listeners) {
+				if (sender == name) {
+					handler(std::addressof(msg));
+				}
+			}
+			return true;
+		}
+
+		std::string name{ "TestPlugin" };
+		mutable std::vector<std::pair<std::string, EventCallback*>> listeners;
+		mutable std::size_t dispatchCalls{ 0 };
+	};
+}
@@ -0,0 +1,187 @@
+#include "F4SE/Trampoline.hpp"
+
+#include <sys/mman.h>
+
+namespace
+{
+	inline constexpr std::uintptr_t G = 0x10000;
+	inline constexpr std::uintptr_t T = std::uintptr_t{ 1 } << 32;
+	inline constexpr std::size_t RANGE = 16 * G;
+
+	// regions tiling [0, 2T), which allocations split, and a log of every query and allocation made
+	class FakeAddressSpace :
+		public F4SE::AddressSpace
+	{
+	public:
+		void map(std::uintptr_t a_base, std::size_t a_size, bool a_free) { regions.insert_or_assign(a_base, region_t{ a_base, a_size, a_free }); }
+
+		[[nodiscard]] std::size_t granularity() const noexcept override { return G; }
+
+		[[nodiscard]] std::optional<region_t> query(std::uintptr_t a_address) const noexcept override
+		{
+			const auto region = find(a_address);
+			if (region) {
+				queries.push_back(region->base);
+			}
+			return region;
+		}
+
+		[[nodiscard]] void* allocate(std::uintptr_t a_address, std::size_t a_size) noexcept override
+		{
+			allocations.push_back(a_address);
+
+			const auto region = find(a_address);
+			if (!region || !region->free || region->base + region->size - a_address < a_size) {
+				return nullptr;
+			}
+
+			if (region->base < a_address) {
+				map(region->base, a_address - region->base, true);
+			}
+			map(a_address, a_size, false);
+			if (const auto end = a_address + a_size; end < region->base + region->size) {
+				map(end, region->base + region->size - end, true);
+			}
+			return reinterpret_cast<void*>(a_address);
+		}
+
+		std::map<std::uintptr_t, region_t> regions;
+		mutable std::vector<std::uintptr_t> queries;
+		std::vector<std::uintptr_t> allocations;
+
+	private:
+		[[nodiscard]] std::optional<region_t> find(std::uintptr_t a_address) const
+		{
+			auto it = regions.upper_bound(a_address);
+			if (it == regions.begin()) {
+				return std::nullopt;
+			}
+			--it;
+			return a_address - it->second.base < it->second.size ? std::make_optional(it->second) : std::nullopt;
+		}
+	};
+
+	[[nodiscard]] std::uintptr_t address(void* a_mem)
+	{
+		return reinterpret_cast<std::uintptr_t>(a_mem);
+	}
+
+	void test_outward()
+	{
+		FakeAddressSpace space;
+		space.map(0, T - 8 * G, false);
+		space.map(T - 8 * G, 2 * G, true);
+		space.map(T - 6 * G, 3 * G, false);
+		space.map(T - 3 * G, G, true);
+		space.map(T - 2 * G, 4 * G, false);
+		space.map(T + 2 * G, G, false);
+		space.map(T + 3 * G, G, true);
+		space.map(T + 4 * G, T - 4 * G, false);
+
+		F4SE::NearRegionFinder finder{ space };
+
+		// the regions are walked closest first in both directions, so the far end of the space is never queried
+		TEST_CHECK(address(finder.allocate(T, G, RANGE)) == T - 3 * G);
+		TEST_CHECK(space.queries == std::vector<std::uintptr_t>({ T - 2 * G, T + 2 * G, T - 3 * G }));
+
+		// the next search only queries what the last allocation split, then the free region above
+		space.queries.clear();
+		TEST_CHECK(address(finder.allocate(T, G, RANGE)) == T + 3 * G);
+		TEST_CHECK(space.queries == std::vector<std::uintptr_t>({ T - 3 * G, T + 3 * G }));
+
+		// a region below the target is taken from its top, the end closest to the target
+		space.queries.clear();
+		TEST_CHECK(address(finder.allocate(T, G, RANGE)) == T - 7 * G);
+		TEST_CHECK(space.allocations == std::vector<std::uintptr_t>({ T - 3 * G, T + 3 * G, T - 7 * G }));
+
+		// and nothing outside the range is considered, even though the space has room
+		space.map(T + 4 * G, 16 * G, true);
+		finder.clear();
+		space.queries.clear();
+		TEST_CHECK(!finder.allocate(T, G, 2 * G));
+		TEST_CHECK(space.allocations.size() == 3);
+		TEST_CHECK(space.queries.size() <= 3);
+	}
+
+	void test_stale()
+	{
+		FakeAddressSpace space;
+		space.map(0, T - 5 * G, false);
+		space.map(T - 5 * G, G, true);
+		space.map(T - 4 * G, G, false);
+		space.map(T - 3 * G, G, true);
+		space.map(T - 2 * G, 4 * G, false);
+		space.map(T + 2 * G, G, false);
+		space.map(T + 3 * G, 2 * G, true);
+		space.map(T + 5 * G, T - 5 * G, false);
+
+		F4SE::NearRegionFinder finder{ space };
+
+		// the small free region below is too small, so it stays cached while the one above is taken
+		TEST_CHECK(address(finder.allocate(T, 2 * G, RANGE)) == T + 3 * G);
+		TEST_CHECK(space.allocations == std::vector<std::uintptr_t>({ T + 3 * G }));
+
+		// someone else maps the cached region, so allocating from it fails and the search carries on
+		space.map(T - 3 * G, G, false);
+		TEST_CHECK(address(finder.allocate(T, G, RANGE)) == T - 5 * G);
+		TEST_CHECK(space.allocations == std::vector<std::uintptr_t>({ T + 3 * G, T - 3 * G, T - 5 * G }));
+
+		// the stale region was dropped, so it is queried again rather than tried again
+		space.queries.clear();
+		TEST_CHECK(!finder.allocate(T, G, RANGE));
+		TEST_CHECK(std::ranges::find(space.queries, T - 3 * G) != space.queries.end());
+		TEST_CHECK(space.allocations.size() == 3);
+	}
+
+	void test_mapped()
+	{
+		auto& space = F4SE::AddressSpace::get();
+		TEST_CHECK(space.granularity() == static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)));
+
+		// the stack is mapped, and the region around it is reported in one piece
+		int local = 0;
+		const auto stack = space.query(reinterpret_cast<std::uintptr_t>(std::addressof(local)));
+		TEST_CHECK(stack && !stack->free);
+		TEST_CHECK(reinterpret_cast<std::uintptr_t>(std::addressof(local)) - stack->base < stack->size);
+
+		// memory within 2 GB of the test's own code, as the trampoline asks for next to the game
+		static int global = 0;
+		const auto target = reinterpret_cast<std::uintptr_t>(std::addressof(global));
+		constexpr std::size_t range = std::size_t{ 1 } << 31;
+		constexpr std::size_t size = 0x10000;
+
+		F4SE::NearRegionFinder finder{ space };
+		std::array<void*, 2> mems{};
+		for (auto& mem : mems) {
+			mem = finder.allocate(target, size, range);
+			TEST_CHECK(mem != nullptr);
+
+			const auto addr = address(mem);
+			TEST_CHECK((addr < target ? target - addr : addr - target) <= range);
+			TEST_CHECK(addr % space.granularity() == 0);
+
+			const auto region = space.query(addr);
+			TEST_CHECK(region && !region->free);
+
+			std::memset(mem, 0xCC, size);
+		}
+		TEST_CHECK(mems[0] != mems[1]);
+
+		for (const auto mem : mems) {
+			::munmap(mem, size);
+		}
+
+		// the user half ends where the kernel's begins
+		const auto top = space.query(std::uintptr_t{ 1 } << 47);
+		TEST_CHECK(top && !top->free);
+	}
+}
+
+int main()
+{
+	test_outward();
+	test_stale();
+	test_mapped();
+
+	return EXIT_SUCCESS;
+}
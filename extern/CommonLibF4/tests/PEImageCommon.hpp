@@ -0,0 +1,33 @@
+#pragma once
+
+#include "REL/PE.hpp"
+
+namespace test
+{
+	// generated by scripts/make_sample_pe.py
+	[[nodiscard]] inline std::vector<std::byte> read_sample_pe()
+	{
+		std::ifstream file(std::filesystem::path{ F4SE_TEST_DATA_DIR } / "sample.exe", std::ios::binary);
+		std::vector<std::byte> result;
+		for (char ch; file.get(ch);) {
+			result.push_back(static_cast<std::byte>(ch));
+		}
+		TEST_CHECK(!result.empty());
+		return result;
+	}
+
+	// lays a PE file out the way the loader would, with every section at its RVA
+	[[nodiscard]] inline std::vector<std::byte> map_pe(std::span<const std::byte> a_file)
+	{
+		const REL::PEImage file{ a_file, REL::PEImage::Layout::kFile };
+		TEST_CHECK(file.valid());
+
+		const auto& optionalHeader = file.nt_header()->optionalHeader;
+		std::vector<std::byte> result(optionalHeader.imageSize);
+		std::memcpy(result.data(), a_file.data(), optionalHeader.headersSize);
+		for (const auto& section : file.sections()) {
+			std::memcpy(result.data() + section.virtualAddress, a_file.data() + section.rawDataPtr, std::min(section.virtualSize, section.rawDataSize));
+		}
+		return result;
+	}
+}
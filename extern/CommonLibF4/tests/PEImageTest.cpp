@@ -0,0 +1,130 @@
+#include "REL/PE.hpp"
+#include "REL/Version.hpp"
+
+#include "PEImageCommon.hpp"
+
+namespace
+{
+	// the offset of the version node with key a_key, counting from 0 among nodes with that key
+	[[nodiscard]] std::size_t find_node(const std::vector<std::byte>& a_data, std::u16string_view a_key, std::size_t a_nth = 0)
+	{
+		const auto key = std::as_bytes(std::span{ a_key });
+		auto it = a_data.begin();
+		for (std::size_t i = 0;; ++i) {
+			it = std::search(it, a_data.end(), key.begin(), key.end());
+			TEST_CHECK(it != a_data.end());
+			if (i == a_nth) {
+				return static_cast<std::size_t>(it - a_data.begin()) - 3 * sizeof(std::uint16_t);
+			}
+			++it;
+		}
+	}
+
+	[[nodiscard]] std::uint16_t read_u16(const std::vector<std::byte>& a_data, std::size_t a_offset)
+	{
+		std::uint16_t result = 0;
+		std::memcpy(std::addressof(result), a_data.data() + a_offset, sizeof(result));
+		return result;
+	}
+
+	void write_u16(std::vector<std::byte>& a_data, std::size_t a_offset, std::uint16_t a_value)
+	{
+		std::memcpy(a_data.data() + a_offset, std::addressof(a_value), sizeof(a_value));
+	}
+
+	[[nodiscard]] std::optional<REL::Version> version_of(std::span<const std::byte> a_file)
+	{
+		return REL::GetFileVersion(REL::PEImage{ a_file, REL::PEImage::Layout::kFile });
+	}
+
+	inline constexpr REL::Version PRODUCT_VERSION{ 1, 10, 984, 0 };
+	inline constexpr REL::Version FIXED_VERSION{ 1, 10, 162, 0 };
+
+	void test_sample()
+	{
+		const auto file = test::read_sample_pe();
+
+		const REL::PEImage image{ file, REL::PEImage::Layout::kFile };
+		TEST_CHECK(image.valid());
+		TEST_CHECK(image.sections().size() == 2);
+		TEST_CHECK(image.data_directory(REX::W32::IMAGE_DIRECTORY_ENTRY_RESOURCE) != nullptr);
+		TEST_CHECK(image.data_directory(REX::W32::IMAGE_DIRECTORY_ENTRY_EXCEPTION) == nullptr);
+
+		// the string table's ProductVersion wins over the fixed info, and the German table is passed over
+		TEST_CHECK(version_of(file) == PRODUCT_VERSION);
+
+		// and the loader's layout reads the same, through the module handle
+		auto mapped = test::map_pe(file);
+		TEST_CHECK(REL::GetFileVersion(reinterpret_cast<REX::W32::HMODULE>(mapped.data())) == PRODUCT_VERSION);
+
+		// anything but a PE image has no version
+		TEST_CHECK(!REL::PEImage({}, REL::PEImage::Layout::kFile).valid());
+		std::vector<std::byte> notPE(file.begin(), file.end());
+		notPE[0x40] = std::byte{ 'N' };
+		TEST_CHECK(!REL::PEImage(notPE, REL::PEImage::Layout::kFile).valid());
+		TEST_CHECK(!version_of(notPE));
+	}
+
+	void test_truncated_file()
+	{
+		const auto file = test::read_sample_pe();
+		const auto block = find_node(file, u"VS_VERSION_INFO");
+		const auto blockEnd = block + read_u16(file, block);
+
+		// every prefix cut before the end of the resource has no version, and nothing reads past the cut
+		for (std::size_t length = 0; length <= file.size(); ++length) {
+			std::vector<std::byte> prefix(file.begin(), file.begin() + static_cast<std::ptrdiff_t>(length));
+			const auto version = version_of(prefix);
+			TEST_CHECK(length >= blockEnd ? version == PRODUCT_VERSION : !version);
+		}
+	}
+
+	void test_truncated_resource()
+	{
+		const auto file = test::read_sample_pe();
+		const auto root = find_node(file, u"VS_VERSION_INFO");
+		const auto english = find_node(file, u"040904B0");
+		const auto productVersion = find_node(file, u"ProductVersion", 1);
+
+		// a root cut right after the fixed info falls back to its product version
+		auto data = file;
+		write_u16(data, root, 0x5C);
+		TEST_CHECK(version_of(data) == FIXED_VERSION);
+
+		// and one too short to hold its own key has none
+		write_u16(data, root, 6 + 10);
+		TEST_CHECK(!version_of(data));
+
+		// as does a root claiming more than the resource holds
+		write_u16(data, root, 0xFFFF);
+		TEST_CHECK(!version_of(data));
+
+		// a string which overruns its table is skipped, leaving the fixed info
+		data = file;
+		write_u16(data, productVersion, read_u16(data, english) + 4);
+		TEST_CHECK(version_of(data) == FIXED_VERSION);
+
+		// unless that is unsigned too
+		std::memset(data.data() + root + 0x28, 0, sizeof(std::uint32_t));
+		TEST_CHECK(!version_of(data));
+
+		// a value longer than its node is cut at the node's end
+		data = file;
+		write_u16(data, productVersion + 2, 0x7FFF);
+		TEST_CHECK(version_of(data) == PRODUCT_VERSION);
+
+		// without the U.S. English table, the first one is used
+		data = file;
+		write_u16(data, english + 6 + 2 * 3, u'7');
+		TEST_CHECK(version_of(data) == REL::Version(9, 9, 9, 9));
+	}
+}
+
+int main()
+{
+	test_sample();
+	test_truncated_file();
+	test_truncated_resource();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,307 @@
+#include "REL/Patch.hpp"
+
+#include <sys/mman.h>
+
+namespace
+{
+	inline constexpr std::size_t PAGE = 0x1000;
+	inline constexpr std::size_t PAGES = 4;
+
+	inline constexpr std::uint32_t READ = 1 << 0;
+	inline constexpr std::uint32_t WRITE = 1 << 1;
+	inline constexpr std::uint32_t EXECUTE = 1 << 2;
+
+	struct call_t
+	{
+		[[nodiscard]] bool operator==(const call_t&) const = default;
+
+		bool unprotect;
+		std::uintptr_t address;
+		std::size_t size;
+		std::uint32_t protection;
+	};
+
+	// tracks the protection of each page of a plain buffer, and every change made to it
+	class FakeProtection :
+		public REL::MemoryProtection
+	{
+	public:
+		FakeProtection(std::uintptr_t a_base, std::uint32_t a_protection) :
+			base(a_base),
+			protections(PAGES, a_protection)
+		{
+		}
+
+		[[nodiscard]] std::size_t page_size() const noexcept override { return PAGE; }
+
+		[[nodiscard]] std::size_t extent(std::uintptr_t a_address) const noexcept override
+		{
+			const auto first = (a_address - base) / PAGE;
+			auto last = first + 1;
+			while (last < PAGES && protections[last] == protections[first]) {
+				++last;
+			}
+			return base + last * PAGE - a_address;
+		}
+
+		bool unprotect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t& a_old) noexcept override
+		{
+			calls.push_back({ true, a_address, a_size, 0 });
+			if (failAt && *failAt == unprotects++) {
+				return false;
+			}
+
+			a_old = protections[(a_address - base) / PAGE];
+			set(a_address, a_size, a_old | WRITE);
+			return true;
+		}
+
+		bool protect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection) noexcept override
+		{
+			calls.push_back({ false, a_address, a_size, a_protection });
+			set(a_address, a_size, a_protection);
+			return true;
+		}
+
+		std::uintptr_t base;
+		std::vector<std::uint32_t> protections;
+		std::vector<call_t> calls;
+		std::optional<std::size_t> failAt;
+		std::size_t unprotects{ 0 };
+
+	private:
+		void set(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection)
+		{
+			for (auto page = (a_address - base) / PAGE; page < (a_address - base + a_size) / PAGE; ++page) {
+				protections[page] = a_protection;
+			}
+		}
+	};
+
+	struct buffer_t
+	{
+		buffer_t()
+		{
+			for (std::size_t i = 0; i < bytes.size(); ++i) {
+				bytes[i] = static_cast<std::uint8_t>(i);
+			}
+		}
+
+		[[nodiscard]] std::uintptr_t address(std::size_t a_offset = 0) const noexcept
+		{
+			return reinterpret_cast<std::uintptr_t>(bytes.data()) + a_offset;
+		}
+
+		[[nodiscard]] bool pristine(std::size_t a_offset, std::size_t a_count) const noexcept
+		{
+			for (auto i = a_offset; i < a_offset + a_count; ++i) {
+				if (bytes[i] != static_cast<std::uint8_t>(i)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		alignas(PAGE) std::array<std::uint8_t, PAGES * PAGE> bytes;
+	};
+
+	void test_adjacent_pages()
+	{
+		const auto buffer = std::make_unique<buffer_t>();
+		FakeProtection protection{ buffer->address(), READ | EXECUTE };
+
+		// the end of page 0, a straddle of pages 1 and 2 and the start of page 3 form one range
+		REL::PatchTransaction transaction{ protection };
+		transaction.fill(buffer->address(PAGE - 2), 0x90, 2);
+		transaction.write(buffer->address(2 * PAGE - 1), std::uint16_t{ 0xCCCC });
+		transaction.fill(buffer->address(3 * PAGE), 0xC3, 1);
+		TEST_CHECK(transaction.commit());
+
+		TEST_CHECK((protection.calls == std::vector<call_t>{
+										   { true, buffer->address(), PAGES * PAGE, 0 },
+										   { false, buffer->address(), PAGES * PAGE, READ | EXECUTE } }));
+		TEST_CHECK(buffer->bytes[PAGE - 1] == 0x90);
+		TEST_CHECK(buffer->bytes[2 * PAGE] == 0xCC);
+		TEST_CHECK(buffer->bytes[3 * PAGE] == 0xC3);
+		TEST_CHECK(buffer->pristine(0, PAGE - 2));
+
+		// a gap splits the ranges
+		protection.calls.clear();
+		REL::PatchTransaction gapped{ protection };
+		gapped.fill(buffer->address(10), 0x90, 1);
+		gapped.fill(buffer->address(2 * PAGE + 10), 0x90, 1);
+		TEST_CHECK(gapped.commit());
+		TEST_CHECK(protection.calls.size() == 4);
+		TEST_CHECK(protection.calls[0] == (call_t{ true, buffer->address(), PAGE, 0 }));
+		TEST_CHECK(protection.calls[1] == (call_t{ true, buffer->address(2 * PAGE), PAGE, 0 }));
+	}
+
+	void test_mixed_protection()
+	{
+		const auto buffer = std::make_unique<buffer_t>();
+		FakeProtection protection{ buffer->address(), READ | EXECUTE };
+		protection.protections[2] = READ;
+
+		// one patch over pages which differ in protection changes each part apart, and restores each
+		REL::PatchTransaction transaction{ protection };
+		transaction.fill(buffer->address(2 * PAGE - 4), 0x90, 8);
+		TEST_CHECK(transaction.commit());
+
+		TEST_CHECK((protection.calls == std::vector<call_t>{
+										   { true, buffer->address(PAGE), PAGE, 0 },
+										   { true, buffer->address(2 * PAGE), PAGE, 0 },
+										   { false, buffer->address(PAGE), PAGE, READ | EXECUTE },
+										   { false, buffer->address(2 * PAGE), PAGE, READ } }));
+		TEST_CHECK((protection.protections == std::vector{ READ | EXECUTE, READ | EXECUTE, READ, READ | EXECUTE }));
+	}
+
+	void test_overlapping()
+	{
+		const auto buffer = std::make_unique<buffer_t>();
+		FakeProtection protection{ buffer->address(), READ | EXECUTE };
+
+		REL::PatchTransaction transaction{ protection };
+		transaction.fill(buffer->address(10), 0xAA, 4);
+		transaction.fill(buffer->address(12), 0xBB, 4);
+		TEST_CHECK(transaction.commit());
+
+		// the later patch wins where they overlap, and their page changes protection once
+		TEST_CHECK(protection.calls.size() == 2);
+		TEST_CHECK(buffer->bytes[11] == 0xAA);
+		TEST_CHECK(buffer->bytes[12] == 0xBB);
+		TEST_CHECK(buffer->bytes[15] == 0xBB);
+
+		// unwinding the later patch first leaves the bytes from before either
+		TEST_CHECK(transaction.rollback());
+		TEST_CHECK(buffer->pristine(0, PAGES * PAGE));
+		TEST_CHECK(!transaction.committed());
+		TEST_CHECK(protection.calls.size() == 4);
+
+		// and nothing is left to roll back
+		TEST_CHECK(!transaction.rollback());
+		TEST_CHECK(protection.calls.size() == 4);
+	}
+
+	void test_failed_unprotect()
+	{
+		const auto buffer = std::make_unique<buffer_t>();
+		FakeProtection protection{ buffer->address(), READ | EXECUTE };
+		protection.failAt = 1;
+
+		REL::PatchTransaction transaction{ protection };
+		transaction.fill(buffer->address(10), 0x90, 4);
+		transaction.fill(buffer->address(2 * PAGE + 10), 0x90, 4);
+
+		// the second range fails, so nothing is written and the first range is restored
+		TEST_CHECK(!transaction.commit());
+		TEST_CHECK(!transaction.committed());
+		TEST_CHECK(buffer->pristine(0, PAGES * PAGE));
+		TEST_CHECK((protection.calls == std::vector<call_t>{
+										   { true, buffer->address(), PAGE, 0 },
+										   { true, buffer->address(2 * PAGE), PAGE, 0 },
+										   { false, buffer->address(), PAGE, READ | EXECUTE } }));
+		TEST_CHECK(std::ranges::all_of(protection.protections, [](auto a_protection) { return a_protection == (READ | EXECUTE); }));
+		TEST_CHECK(!transaction.rollback());
+
+		// once the pages can be changed, the same transaction commits
+		protection.failAt.reset();
+		TEST_CHECK(transaction.commit());
+		TEST_CHECK(buffer->bytes[10] == 0x90);
+		TEST_CHECK(buffer->bytes[2 * PAGE + 13] == 0x90);
+	}
+
+	void test_incremental_commit()
+	{
+		const auto buffer = std::make_unique<buffer_t>();
+		FakeProtection protection{ buffer->address(), READ | EXECUTE };
+
+		REL::PatchTransaction transaction{ protection };
+		transaction.fill(buffer->address(10), 0xAA, 4);
+		TEST_CHECK(transaction.commit());
+
+		// a later commit changes only the pages of the patches it applies
+		protection.calls.clear();
+		transaction.fill(buffer->address(2 * PAGE + 10), 0xBB, 4);
+		TEST_CHECK(!transaction.committed());
+		TEST_CHECK(transaction.commit());
+		TEST_CHECK((protection.calls == std::vector<call_t>{
+										   { true, buffer->address(2 * PAGE), PAGE, 0 },
+										   { false, buffer->address(2 * PAGE), PAGE, READ | EXECUTE } }));
+
+		// a patch which fails to apply is not rolled back, so its page is left alone
+		protection.calls.clear();
+		protection.failAt = protection.unprotects;
+		transaction.fill(buffer->address(3 * PAGE + 10), 0xCC, 4);
+		TEST_CHECK(!transaction.commit());
+		protection.failAt.reset();
+
+		protection.calls.clear();
+		TEST_CHECK(transaction.rollback());
+		TEST_CHECK((protection.calls == std::vector<call_t>{
+										   { true, buffer->address(), PAGE, 0 },
+										   { true, buffer->address(2 * PAGE), PAGE, 0 },
+										   { false, buffer->address(), PAGE, READ | EXECUTE },
+										   { false, buffer->address(2 * PAGE), PAGE, READ | EXECUTE } }));
+		TEST_CHECK(buffer->pristine(0, PAGES * PAGE));
+	}
+
+	void test_mprotect()
+	{
+		auto& protection = REL::MemoryProtection::get();
+		const auto pageSize = protection.page_size();
+		TEST_CHECK(pageSize >= PAGE && std::has_single_bit(pageSize));
+
+		const auto map = ::mmap(nullptr, PAGES * pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		TEST_CHECK(map != MAP_FAILED);
+		const F4SE::stl::scope_exit unmap([&] { ::munmap(map, PAGES * pageSize); });
+
+		const auto bytes = static_cast<std::uint8_t*>(map);
+		const auto base = reinterpret_cast<std::uintptr_t>(map);
+		std::memset(bytes, 0xEE, PAGES * pageSize);
+
+		// pages 0 and 1 are read only, page 2 is writable and page 3 read only again
+		TEST_CHECK(::mprotect(bytes, 2 * pageSize, PROT_READ) == 0);
+		TEST_CHECK(::mprotect(bytes + 3 * pageSize, pageSize, PROT_READ) == 0);
+
+		const auto check_protections = [&] {
+			TEST_CHECK(protection.extent(base) == 2 * pageSize);
+			TEST_CHECK(protection.extent(base + pageSize + 16) == pageSize - 16);
+			TEST_CHECK(protection.extent(base + 2 * pageSize) == pageSize);
+
+			std::uint32_t old{ 0 };
+			TEST_CHECK(protection.unprotect(base, pageSize, old));
+			TEST_CHECK(old == PROT_READ);
+			TEST_CHECK(protection.protect(base, pageSize, old));
+		};
+		check_protections();
+
+		REL::PatchTransaction transaction;
+		transaction.fill(base + 2 * pageSize - 2, 0x90, 4);
+		transaction.fill(base + 3 * pageSize, 0xC3, 1);
+		TEST_CHECK(transaction.commit());
+
+		TEST_CHECK(bytes[2 * pageSize - 2] == 0x90);
+		TEST_CHECK(bytes[2 * pageSize + 1] == 0x90);
+		TEST_CHECK(bytes[2 * pageSize + 2] == 0xEE);
+		TEST_CHECK(bytes[3 * pageSize] == 0xC3);
+		check_protections();
+
+		TEST_CHECK(transaction.rollback());
+		TEST_CHECK(bytes[2 * pageSize - 2] == 0xEE);
+		TEST_CHECK(bytes[2 * pageSize + 1] == 0xEE);
+		TEST_CHECK(bytes[3 * pageSize] == 0xEE);
+		check_protections();
+	}
+}
+
+int main()
+{
+	test_adjacent_pages();
+	test_mixed_protection();
+	test_overlapping();
+	test_failed_unprotect();
+	test_incremental_commit();
+	test_mprotect();
+
+	return EXIT_SUCCESS;
+}
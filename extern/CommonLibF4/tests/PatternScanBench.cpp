@@ -0,0 +1,123 @@
+#include "REL/Pattern.hpp"
+
+namespace
+{
+	struct result_t
+	{
+		std::string_view method;
+		double msPerScan;
+	};
+
+	inline constexpr std::size_t PATTERNS = 100;
+
+	[[nodiscard]] consteval char hex_digit(std::uint8_t a_value) noexcept
+	{
+		return static_cast<char>(a_value < 10 ? '0' + a_value : 'A' + (a_value - 10));
+	}
+
+	template <std::uint8_t B>
+	using byte_rule = REL::detail::rules::Hexadecimal<hex_digit(B >> 4), hex_digit(B & 0xF)>;
+
+	using wildcard = REL::detail::rules::Wildcard;
+
+	// a 12 byte pattern per index, shaped like a call through a register with a displacement
+	template <std::size_t I>
+	using matcher_t = REL::detail::PatternMatcher<
+		byte_rule<0x48>,
+		byte_rule<0x8B>,
+		byte_rule<static_cast<std::uint8_t>(0x80 + I % 64)>,
+		wildcard,
+		wildcard,
+		byte_rule<static_cast<std::uint8_t>(I * 37 + 11)>,
+		byte_rule<static_cast<std::uint8_t>(I * 91 + 7)>,
+		wildcard,
+		byte_rule<0xFF>,
+		byte_rule<static_cast<std::uint8_t>(0x50 + I / 64)>,
+		byte_rule<static_cast<std::uint8_t>(I * 13 + 5)>,
+		byte_rule<0xC3>>;
+
+	template <std::size_t... I>
+	[[nodiscard]] auto scan_all(std::span<const std::byte> a_bytes, std::index_sequence<I...>)
+	{
+		return REL::scan_patterns(a_bytes, matcher_t<I>{}...);
+	}
+
+	// what a plugin does without a multi-pattern scanner: one pass per pattern, each looking for its anchor
+	template <std::size_t... I>
+	[[nodiscard]] auto scan_each(std::span<const std::byte> a_bytes, std::index_sequence<I...>)
+	{
+		return std::array<std::uintptr_t, sizeof...(I)>{ REL::scan_patterns(a_bytes, matcher_t<I>{})[0]... };
+	}
+
+	template <std::size_t... I>
+	[[nodiscard]] auto pattern_bytes(std::index_sequence<I...>)
+	{
+		return std::array<std::pair<std::span<const std::byte>, std::span<const std::byte>>, sizeof...(I)>{
+			std::pair{ std::span<const std::byte>{ matcher_t<I>::bytes }, std::span<const std::byte>{ matcher_t<I>::masks } }...
+		};
+	}
+}
+
+/**
+ * Times finding 100 patterns in a 60 MB buffer of x64-like bytes in one pass, against one pass per
+ * pattern, and prints the results as JSON. The patterns are planted in the last tenth of the buffer,
+ * so every scan covers most of it.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto size = test::quick(a_argc, a_argv) ? std::size_t{ 1 } << 20 : std::size_t{ 60 } << 20;
+	const auto rounds = test::quick(a_argc, a_argv) ? 1 : 5;
+	constexpr auto indices = std::make_index_sequence<PATTERNS>{};
+
+	// half the bytes are drawn from those most common in x64 code, which anchors avoid
+	constexpr std::array<std::uint8_t, 8> COMMON{ 0x00, 0x48, 0x89, 0x8B, 0x24, 0x0F, 0xE8, 0xFF };
+	std::vector<std::byte> buffer(size);
+	std::mt19937_64 rng{ 26 };
+	for (auto& byte : buffer) {
+		const auto value = rng();
+		byte = static_cast<std::byte>(value & 1 ? COMMON[(value >> 1) % COMMON.size()] : (value >> 8) & 0xFF);
+	}
+
+	std::vector<std::uintptr_t> planted;
+	const auto patterns = pattern_bytes(indices);
+	const auto region = size / 10;
+	for (std::size_t i = 0; i < PATTERNS; ++i) {
+		const auto offset = size - region + i * (region / PATTERNS);
+		const auto& [bytes, masks] = patterns[i];
+		for (std::size_t j = 0; j < bytes.size(); ++j) {
+			if (masks[j] != std::byte{ 0 }) {
+				buffer[offset + j] = bytes[j];
+			}
+		}
+		planted.push_back(reinterpret_cast<std::uintptr_t>(buffer.data()) + offset);
+	}
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_method, auto a_scan) {
+		double total = 0.0;
+		for (int round = 0; round < rounds; ++round) {
+			std::array<std::uintptr_t, PATTERNS> found{};
+			total += test::time_ns([&] { found = a_scan(); });
+			TEST_CHECK(std::ranges::equal(found, planted));
+		}
+		results.push_back({ a_method, total / rounds / 1e6 });
+	};
+
+	run("scan_patterns", [&] { return scan_all(buffer, indices); });
+	run("per_pattern", [&] { return scan_each(buffer, indices); });
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"patterns\": %zu, \"mb\": %zu, \"ms_per_scan\": %.2f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			PATTERNS,
+			size >> 20,
+			result.msPerScan,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
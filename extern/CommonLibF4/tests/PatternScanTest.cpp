@@ -0,0 +1,133 @@
+#include "REL/Pattern.hpp"
+
+namespace
+{
+	// the anchor of each pattern is its first fixed byte which is not common in x64 code
+	constexpr auto load = REL::make_pattern<"48 8B 05 ?? ?? ?? ?? C3">();
+	constexpr auto call = REL::make_pattern<"E8 ?? ?? ?? ?? 90 90">();
+	constexpr auto missing = REL::make_pattern<"DE AD BE EF">();
+	constexpr auto common = REL::make_pattern<"48 89 ?? 24">();
+	constexpr auto cut = REL::make_pattern<"12 34 56 78 9A">();
+
+	static_assert(decltype(load)::anchor == 2);
+	static_assert(decltype(call)::anchor == 5);
+	static_assert(decltype(common)::anchor == 0);
+
+	struct files_t
+	{
+		files_t()
+		{
+			std::filesystem::create_directories(root);
+		}
+
+		~files_t()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(root, ec);
+		}
+
+		std::filesystem::path root{ std::filesystem::temp_directory_path() / "f4se_pattern_scan_test" };
+		std::filesystem::path cache{ root / "patterns.bin" };
+	};
+
+	void put(std::vector<std::byte>& a_buffer, std::size_t a_offset, std::initializer_list<std::uint8_t> a_bytes)
+	{
+		for (const auto byte : a_bytes) {
+			a_buffer[a_offset++] = static_cast<std::byte>(byte);
+		}
+	}
+
+	void test_scan()
+	{
+		// an odd size, so the end of the buffer is left to the scalar tail
+		std::vector<std::byte> buffer(4096 + 7, std::byte{ 0xCC });
+		const auto base = reinterpret_cast<std::uintptr_t>(buffer.data());
+
+		// an anchor byte too close to the start for its pattern to fit before it
+		put(buffer, 1, { 0x05 });
+		put(buffer, 100, { 0x48, 0x89, 0x5C, 0x24 });
+
+		// straddling the first block boundary, then again later, where the first match wins
+		put(buffer, 14, { 0x48, 0x8B, 0x05, 0x01, 0x02, 0x03, 0x04, 0xC3 });
+		put(buffer, 300, { 0x48, 0x8B, 0x05, 0xAA, 0xBB, 0xCC, 0xDD, 0xC3 });
+
+		// anchored in the tail, and one cut short by the end of the buffer
+		put(buffer, buffer.size() - 11, { 0xE8, 0x11, 0x22, 0x33, 0x44, 0x90, 0x90 });
+		put(buffer, buffer.size() - 4, { 0x12, 0x34, 0x56, 0x78 });
+
+		const auto found = REL::scan_patterns(std::span<const std::byte>{ buffer }, load, call, missing, common, cut);
+		TEST_CHECK(found[0] == base + 14);
+		TEST_CHECK(found[1] == base + buffer.size() - 11);
+		TEST_CHECK(found[2] == 0);
+		TEST_CHECK(found[3] == base + 100);
+		TEST_CHECK(found[4] == 0);
+
+		// a segment over the same bytes finds the same
+		const REL::Segment segment{ base, base, buffer.size() };
+		TEST_CHECK(REL::scan_patterns(segment, load, call, missing, common, cut) == found);
+
+		// and a scan which starts past the first match finds the second
+		TEST_CHECK(REL::scan_patterns(std::span<const std::byte>{ buffer }.subspan(20), load)[0] == base + 300);
+	}
+
+	void test_cache(const files_t& a_files)
+	{
+		constexpr std::uint32_t VERSION = 0x01020304;
+
+		{
+			REL::PatternCache cache{ a_files.cache, VERSION };
+			TEST_CHECK(cache.size() == 0);
+			TEST_CHECK(!cache.find(decltype(load)::hash));
+
+			cache.insert(decltype(load)::hash, 0x1000);
+			cache.insert(decltype(call)::hash, 0x2000);
+			cache.insert(decltype(load)::hash, 0x1010);
+			TEST_CHECK(cache.size() == 2);
+			TEST_CHECK(cache.save());
+		}
+
+		{
+			REL::PatternCache cache{ a_files.cache, VERSION };
+			TEST_CHECK(cache.find(decltype(load)::hash) == 0x1010u);
+			TEST_CHECK(cache.find(decltype(call)::hash) == 0x2000u);
+			TEST_CHECK(!cache.find(decltype(missing)::hash));
+		}
+
+		// another version starts empty
+		TEST_CHECK(REL::PatternCache(a_files.cache, VERSION + 1).size() == 0);
+
+		const auto bytes = [&]() {
+			std::ifstream file{ a_files.cache, std::ios::binary };
+			return std::string{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+		}();
+		TEST_CHECK(bytes.size() == 16 + 2 * 16);
+
+		const auto reopen = [&](std::string_view a_bytes) {
+			std::ofstream{ a_files.cache, std::ios::binary | std::ios::trunc } << a_bytes;
+			return REL::PatternCache(a_files.cache, VERSION).size();
+		};
+
+		// a count the file does not hold is rejected before anything is allocated for it
+		auto huge = bytes;
+		const std::uint64_t count = std::uint64_t{ 1 } << 40;
+		std::memcpy(huge.data() + 8, std::addressof(count), sizeof(count));
+		TEST_CHECK(reopen(huge) == 0);
+
+		// as is a file cut short, one with bytes to spare, or one missing its header
+		TEST_CHECK(reopen(std::string_view(bytes).substr(0, bytes.size() - 16)) == 0);
+		TEST_CHECK(reopen(std::string_view(bytes).substr(0, bytes.size() - 1)) == 0);
+		TEST_CHECK(reopen(bytes + std::string(16, '\0')) == 0);
+		TEST_CHECK(reopen(std::string_view(bytes).substr(0, 8)) == 0);
+		TEST_CHECK(reopen(bytes) == 2);
+	}
+}
+
+int main()
+{
+	const files_t files;
+
+	test_scan();
+	test_cache(files);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+// the parts of F4SE/Impl/PCH.hpp the tests rely on, without any game or Windows headers
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <source_location>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <emmintrin.h>
+#include <x86intrin.h>
+
+#ifdef F4SE_TEST_SPDLOG
+#include <spdlog/spdlog.h>
+#endif
+
+#ifdef F4SE_TEST_SERIALIZATION
+#include "SerializationCommon.hpp"
+#endif
+
+#ifdef F4SE_TEST_MMIO
+#include "MappedFileCommon.hpp"
+#endif
+
+#ifdef F4SE_TEST_MESSAGING
+#include "MessagingCommon.hpp"
+#endif
+
+namespace F4SE
+{
+	using namespace std::literals;
+
+	namespace stl
+	{
+		[[noreturn]] inline void report_and_fail(std::string_view a_msg, std::source_location a_loc = std::source_location::current())
+		{
+			std::fprintf(stderr, "%s(%u): %.*s\n", a_loc.file_name(), a_loc.line(), static_cast<int>(a_msg.size()), a_msg.data());
+			std::abort();
+		}
+
+		template <class EF>
+		class scope_exit
+		{
+		public:
+			explicit scope_exit(EF a_fn) noexcept(std::is_nothrow_move_constructible_v<EF>) :
+				_fn(std::move(a_fn))
+			{
+			}
+
+			scope_exit(const scope_exit&) = delete;
+
+			~scope_exit() noexcept
+			{
+				if (_fn.has_value()) {
+					(*_fn)();
+				}
+			}
+
+			void release() noexcept { _fn.reset(); }
+
+		private:
+			std::optional<EF> _fn;
+		};
+
+		template <class EF>
+		scope_exit(EF) -> scope_exit<EF>;
+
+		template <class T, class U>
+		[[nodiscard]] auto adjust_pointer(U* a_ptr, std::ptrdiff_t a_adjust) noexcept
+		{
+			auto addr = a_ptr ? reinterpret_cast<std::uintptr_t>(a_ptr) + a_adjust : 0;
+			if constexpr (std::is_const_v<U> && std::is_volatile_v<U>) {
+				return reinterpret_cast<std::add_cv_t<T>*>(addr);
+			}
+			else if constexpr (std::is_const_v<U>) {
+				return reinterpret_cast<std::add_const_t<T>*>(addr);
+			}
+			else if constexpr (std::is_volatile_v<U>) {
+				return reinterpret_cast<std::add_volatile_t<T>*>(addr);
+			}
+			else {
+				return reinterpret_cast<T*>(addr);
+			}
+		}
+
+		// the pointer and integer conversions of the full cast, which is all the trampoline needs
+		template <class To, class From>
+		[[nodiscard]] To unrestricted_cast(From a_from) noexcept
+		{
+			if constexpr (std::is_same_v<std::remove_cv_t<From>, std::remove_cv_t<To>>) {
+				return To{ a_from };
+			}
+			else if constexpr (std::is_pointer_v<From> && std::is_pointer_v<To>) {
+				return static_cast<To>(const_cast<void*>(static_cast<const volatile void*>(a_from)));
+			}
+			else {
+				return reinterpret_cast<To>(a_from);
+			}
+		}
+
+		namespace nttp
+		{
+			// the subset REL::make_pattern parses its pattern with
+			template <class CharT, std::size_t N>
+			struct string
+			{
+				using char_type = CharT;
+				using size_type = std::size_t;
+				using const_pointer = const char_type*;
+
+				inline static constexpr auto npos = static_cast<std::size_t>(-1);
+
+				consteval string(const_pointer a_string) noexcept
+				{
+					for (size_type i = 0; i < chars.size() && a_string[i]; i++) {
+						chars[i] = a_string[i];
+					}
+				}
+
+				[[nodiscard]] consteval const char_type& operator[](size_type a_pos) const noexcept { return chars.at(a_pos); }
+
+				[[nodiscard]] consteval const_pointer data() const noexcept { return chars.data(); }
+				[[nodiscard]] consteval size_type size() const noexcept { return chars.size(); }
+				[[nodiscard]] consteval size_type length() const noexcept { return chars.size(); }
+
+				template <std::size_t POS = 0, std::size_t COUNT = npos>
+				[[nodiscard]] consteval auto substr() const noexcept
+				{
+					constexpr auto LENGTH = COUNT != npos ? COUNT : N - POS;
+					return string<char_type, LENGTH>{ data() + POS };
+				}
+
+				std::array<char_type, N> chars = {};
+			};
+
+			template <class CharT, std::size_t N>
+			string(const CharT (&)[N]) -> string<CharT, N - 1>;
+		}
+	}
+}
+
+namespace RE
+{
+	using namespace std::literals;
+	namespace stl = F4SE::stl;
+}
+
+namespace REL
+{
+	using namespace std::literals;
+	namespace stl = F4SE::stl;
+
+	// the tests only ever patch memory they allocated themselves, which is already writable
+	inline void safe_write(std::uintptr_t a_dst, const void* a_src, std::size_t a_count)
+	{
+		std::memcpy(reinterpret_cast<void*>(a_dst), a_src, a_count);
+	}
+}
+
+namespace REX
+{
+	using namespace std::literals;
+}
+
+#define TEST_CHECK(a_expr) test::check(static_cast<bool>(a_expr), #a_expr)
+
+namespace test
+{
+	using namespace std::literals;
+
+	/**
+	 * Fails the test with the location of the check, and stays active in release builds.
+	 */
+	inline void check(bool a_condition, std::string_view a_what, std::source_location a_loc = std::source_location::current())
+	{
+		if (!a_condition) {
+			std::fprintf(stderr, "%s(%u): check failed: %.*s\n", a_loc.file_name(), a_loc.line(), static_cast<int>(a_what.size()), a_what.data());
+			std::exit(EXIT_FAILURE);
+		}
+	}
+
+	template <class F>
+	[[nodiscard]] double time_ns(F&& a_func)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		a_func();
+		return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// keeps a result alive so the optimizer can not drop the work producing it
+	template <class T>
+	void do_not_optimize(const T& a_value)
+	{
+		static volatile std::uintptr_t sink;
+		sink = sink + static_cast<std::uintptr_t>(std::hash<T>{}(a_value));
+	}
+
+	/**
+	 * Benchmarks take <code>--quick</code> when run by ctest, which caps their sizes so they only smoke test.
+	 */
+	[[nodiscard]] inline bool quick(int a_argc, char* a_argv[])
+	{
+		return std::ranges::any_of(std::span{ a_argv, static_cast<std::size_t>(a_argc) }, [](const char* a_arg) { return a_arg == "--quick"sv; });
+	}
+}
@@ -0,0 +1,1489 @@
+// generated by scripts/make_enum_tests.py, do not edit
+
+#include "RE/Fallout.hpp"
+
+#include "EnumNameCommon.hpp"
+
+// not checked:
+// - RE::Explosion::RecordFlags::RecordFlag: no enumerators
+// - RE::Hazard::Flags: no enumerators
+// - RE::Hazard::RecordFlags::RecordFlag: no enumerators
+// - RE::MagicItem::Flags: no enumerators
+// - RE::PropertyTypeInfo::Permissions: no enumerators
+
+static_assert(test::RoundTrips<RE::ACTOR_BASE_DATA::Flags>(
+	{ RE::ACTOR_BASE_DATA::Flags::kNone, RE::ACTOR_BASE_DATA::Flags::kFemale, RE::ACTOR_BASE_DATA::Flags::kEssential, RE::ACTOR_BASE_DATA::Flags::kIsChargenFacePreset, RE::ACTOR_BASE_DATA::Flags::kRespawn, RE::ACTOR_BASE_DATA::Flags::kAutoCalcStats, RE::ACTOR_BASE_DATA::Flags::kUnique, RE::ACTOR_BASE_DATA::Flags::kDoesntAffectStealthMeter, RE::ACTOR_BASE_DATA::Flags::kPCLevelMult, RE::ACTOR_BASE_DATA::Flags::kUsesTemplate, RE::ACTOR_BASE_DATA::Flags::kProtected, RE::ACTOR_BASE_DATA::Flags::kSummonable, RE::ACTOR_BASE_DATA::Flags::kDoesntBleed, RE::ACTOR_BASE_DATA::Flags::kBleedoutOverride, RE::ACTOR_BASE_DATA::Flags::kOppositeGenderanims, RE::ACTOR_BASE_DATA::Flags::kSimpleActor, RE::ACTOR_BASE_DATA::Flags::kLoopedScript, RE::ACTOR_BASE_DATA::Flags::kLoopedAudio, RE::ACTOR_BASE_DATA::Flags::kIsGhost, RE::ACTOR_BASE_DATA::Flags::kInvulnerable },
+	{ "kNone", "kFemale", "kEssential", "kIsChargenFacePreset", "kRespawn", "kAutoCalcStats", "kUnique", "kDoesntAffectStealthMeter", "kPCLevelMult", "kUsesTemplate", "kProtected", "kSummonable", "kDoesntBleed", "kBleedoutOverride", "kOppositeGenderanims", "kSimpleActor", "kLoopedScript", "kLoopedAudio", "kIsGhost", "kInvulnerable" }));
+
+static_assert(test::RoundTrips<RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS>(
+	{ RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kNone, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kTraits, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kStats, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kFactions, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kSpells, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kAIData, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kAIPackages, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kUnused, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kBaseData, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kInventory, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kScript, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kAIDefPackList, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kAttackData, RE::ACTOR_BASE_DATA::TEMPLATE_USE_FLAGS::kKeywords },
+	{ "kNone", "kTraits", "kStats", "kFactions", "kSpells", "kAIData", "kAIPackages", "kUnused", "kBaseData", "kInventory", "kScript", "kAIDefPackList", "kAttackData", "kKeywords" }));
+
+static_assert(test::RoundTrips<RE::ACTOR_COMBAT_STATE>(
+	{ RE::ACTOR_COMBAT_STATE::kNone, RE::ACTOR_COMBAT_STATE::kCombat, RE::ACTOR_COMBAT_STATE::kSearching },
+	{ "kNone", "kCombat", "kSearching" }));
+
+static_assert(test::RoundTrips<RE::ACTOR_CRITICAL_STAGE>(
+	{ RE::ACTOR_CRITICAL_STAGE::kNone, RE::ACTOR_CRITICAL_STAGE::kGooStart, RE::ACTOR_CRITICAL_STAGE::kGooEnd, RE::ACTOR_CRITICAL_STAGE::kDisintegrateStart, RE::ACTOR_CRITICAL_STAGE::kDisintegrateEnd, RE::ACTOR_CRITICAL_STAGE::kFreezeStart, RE::ACTOR_CRITICAL_STAGE::kFreezeEnd, RE::ACTOR_CRITICAL_STAGE::kCount },
+	{ "kNone", "kGooStart", "kGooEnd", "kDisintegrateStart", "kDisintegrateEnd", "kFreezeStart", "kFreezeEnd", "kCount" }));
+
+static_assert(test::RoundTrips<RE::ACTOR_LIFE_STATE>(
+	{ RE::ACTOR_LIFE_STATE::kAlive, RE::ACTOR_LIFE_STATE::kDying, RE::ACTOR_LIFE_STATE::kDead, RE::ACTOR_LIFE_STATE::kUnconscious, RE::ACTOR_LIFE_STATE::kReanimate, RE::ACTOR_LIFE_STATE::kRecycle, RE::ACTOR_LIFE_STATE::kRestrained, RE::ACTOR_LIFE_STATE::kEssentialDown, RE::ACTOR_LIFE_STATE::kBleedout },
+	{ "kAlive", "kDying", "kDead", "kUnconscious", "kReanimate", "kRecycle", "kRestrained", "kEssentialDown", "kBleedout" }));
+
+static_assert(test::RoundTrips<RE::ACTOR_LOS_LOCATION>(
+	{ RE::ACTOR_LOS_LOCATION::kNone, RE::ACTOR_LOS_LOCATION::kEye, RE::ACTOR_LOS_LOCATION::kHead, RE::ACTOR_LOS_LOCATION::kTorse, RE::ACTOR_LOS_LOCATION::kFeet, RE::ACTOR_LOS_LOCATION::kCount },
+	{ "kNone", "kEye", "kHead", "kTorse", "kFeet", "kCount" }));
+
+static_assert(test::RoundTrips<RE::ACTOR_VALUE_MODIFIER>(
+	{ RE::ACTOR_VALUE_MODIFIER::kPermanent, RE::ACTOR_VALUE_MODIFIER::kTemporary, RE::ACTOR_VALUE_MODIFIER::kDamage },
+	{ "kPermanent", "kTemporary", "kDamage" }));
+
+static_assert(test::RoundTrips<RE::ACTOR_VISIBILITY_MASK>(
+	{ RE::ACTOR_VISIBILITY_MASK::kFrustrum, RE::ACTOR_VISIBILITY_MASK::kOcclusion, RE::ACTOR_VISIBILITY_MASK::kFaded, RE::ACTOR_VISIBILITY_MASK::kAll },
+	{ "kFrustrum", "kOcclusion", "kFaded", "kAll" }));
+
+static_assert(test::RoundTrips<RE::AMMO_DATA::Flags>(
+	{ RE::AMMO_DATA::Flags::kNone, RE::AMMO_DATA::Flags::kIgnoresNormalWeaponResist, RE::AMMO_DATA::Flags::kNonPlayable, RE::AMMO_DATA::Flags::kHasCountBased3D },
+	{ "kNone", "kIgnoresNormalWeaponResist", "kNonPlayable", "kHasCountBased3D" }));
+
+static_assert(test::RoundTrips<RE::ActionInput::ACTIONPRIORITY>(
+	{ RE::ActionInput::ACTIONPRIORITY::kImperative, RE::ActionInput::ACTIONPRIORITY::kQueue, RE::ActionInput::ACTIONPRIORITY::kTry },
+	{ "kImperative", "kQueue", "kTry" }));
+
+static_assert(test::RoundTrips<RE::ActiveEffect::ConditionStatus>(
+	{ RE::ActiveEffect::ConditionStatus::kNotAvailable, RE::ActiveEffect::ConditionStatus::kFalse, RE::ActiveEffect::ConditionStatus::kTrue },
+	{ "kNotAvailable", "kFalse", "kTrue" }));
+
+static_assert(test::RoundTrips<RE::ActiveEffect::Flags>(
+	{ RE::ActiveEffect::Flags::kNone, RE::ActiveEffect::Flags::kNoHitShader, RE::ActiveEffect::Flags::kNoHitEffectArt, RE::ActiveEffect::Flags::kNoInitialFlare, RE::ActiveEffect::Flags::kApplyingHitEffects, RE::ActiveEffect::Flags::kApplyingSounds, RE::ActiveEffect::Flags::kHasConditions, RE::ActiveEffect::Flags::kRecover, RE::ActiveEffect::Flags::kDualCasted, RE::ActiveEffect::Flags::kInactive, RE::ActiveEffect::Flags::kAppliedEffects, RE::ActiveEffect::Flags::kRemovedEffects, RE::ActiveEffect::Flags::kDispelled, RE::ActiveEffect::Flags::kWornOff },
+	{ "kNone", "kNoHitShader", "kNoHitEffectArt", "kNoInitialFlare", "kApplyingHitEffects", "kApplyingSounds", "kHasConditions", "kRecover", "kDualCasted", "kInactive", "kAppliedEffects", "kRemovedEffects", "kDispelled", "kWornOff" }));
+
+static_assert(test::RoundTrips<RE::Actor::BOOL_FLAGS>(
+	{ RE::Actor::BOOL_FLAGS::kNone, RE::Actor::BOOL_FLAGS::kScenePackage, RE::Actor::BOOL_FLAGS::kIsAMount, RE::Actor::BOOL_FLAGS::kIsMountPointClear, RE::Actor::BOOL_FLAGS::kIsGettingOnOffMount, RE::Actor::BOOL_FLAGS::kInRandomScene, RE::Actor::BOOL_FLAGS::kNoBleedoutRecovery, RE::Actor::BOOL_FLAGS::kInBleedoutAnimation, RE::Actor::BOOL_FLAGS::kCanDoFavor, RE::Actor::BOOL_FLAGS::kShouldAnimGraphUpdate, RE::Actor::BOOL_FLAGS::kCanSpeakToEssentialDown, RE::Actor::BOOL_FLAGS::kBribedByPlayer, RE::Actor::BOOL_FLAGS::kAngryWithPlayer, RE::Actor::BOOL_FLAGS::kIsTresspassing, RE::Actor::BOOL_FLAGS::kCanSpeak, RE::Actor::BOOL_FLAGS::kIsInKillMove, RE::Actor::BOOL_FLAGS::kAttackOnSight, RE::Actor::BOOL_FLAGS::kIsCommandedActor, RE::Actor::BOOL_FLAGS::kForceOneAnimGraphUpdate, RE::Actor::BOOL_FLAGS::kEssential, RE::Actor::BOOL_FLAGS::kProtected, RE::Actor::BOOL_FLAGS::kAttackingDisabled, RE::Actor::BOOL_FLAGS::kCastingDisabled, RE::Actor::BOOL_FLAGS::kSceneHeadtrackRotation, RE::Actor::BOOL_FLAGS::kForceIncMinBoneUpdate, RE::Actor::BOOL_FLAGS::kCrimeSearch, RE::Actor::BOOL_FLAGS::kMovingIntoLoadedArea, RE::Actor::BOOL_FLAGS::kDoNotShowOnStealthMeter, RE::Actor::BOOL_FLAGS::kMovementBlocked, RE::Actor::BOOL_FLAGS::kAllowInstantFurniturePopInPlayerCell, RE::Actor::BOOL_FLAGS::kForceAnimGraphUpdate, RE::Actor::BOOL_FLAGS::kCheckAddEffectDualCast, RE::Actor::BOOL_FLAGS::kUnderwater },
+	{ "kNone", "kScenePackage", "kIsAMount", "kIsMountPointClear", "kIsGettingOnOffMount", "kInRandomScene", "kNoBleedoutRecovery", "kInBleedoutAnimation", "kCanDoFavor", "kShouldAnimGraphUpdate", "kCanSpeakToEssentialDown", "kBribedByPlayer", "kAngryWithPlayer", "kIsTresspassing", "kCanSpeak", "kIsInKillMove", "kAttackOnSight", "kIsCommandedActor", "kForceOneAnimGraphUpdate", "kEssential", "kProtected", "kAttackingDisabled", "kCastingDisabled", "kSceneHeadtrackRotation", "kForceIncMinBoneUpdate", "kCrimeSearch", "kMovingIntoLoadedArea", "kDoNotShowOnStealthMeter", "kMovementBlocked", "kAllowInstantFurniturePopInPlayerCell", "kForceAnimGraphUpdate", "kCheckAddEffectDualCast", "kUnderwater" }));
+
+static_assert(test::RoundTrips<RE::Actor::DETECTION_PRIORITY>(
+	{ RE::Actor::DETECTION_PRIORITY::kNone, RE::Actor::DETECTION_PRIORITY::kVeryLow, RE::Actor::DETECTION_PRIORITY::kLow, RE::Actor::DETECTION_PRIORITY::kNormal, RE::Actor::DETECTION_PRIORITY::kHigh, RE::Actor::DETECTION_PRIORITY::kCritical },
+	{ "kNone", "kVeryLow", "kLow", "kNormal", "kHigh", "kCritical" }));
+
+static_assert(test::RoundTrips<RE::Actor::NiFlags>(
+	{ RE::Actor::NiFlags::kNone, RE::Actor::NiFlags::kDelayUpdateScenegraph, RE::Actor::NiFlags::kProcessMe, RE::Actor::NiFlags::kMurderAlarm, RE::Actor::NiFlags::kHasSceneExtra, RE::Actor::NiFlags::kHeadingFixed, RE::Actor::NiFlags::kSpeakingDone, RE::Actor::NiFlags::kIgnoreChangeAnimationCall, RE::Actor::NiFlags::kSoundFileDone, RE::Actor::NiFlags::kVoiceFileDone, RE::Actor::NiFlags::kInTempChangeList, RE::Actor::NiFlags::kDoNotRunSayToCallback, RE::Actor::NiFlags::kDead, RE::Actor::NiFlags::kForceGreetingPlayer, RE::Actor::NiFlags::kForceUpdateQuestTarget, RE::Actor::NiFlags::kSearchingInCombat, RE::Actor::NiFlags::kAttackOnNextTheft, RE::Actor::NiFlags::kEvpBuffered, RE::Actor::NiFlags::kResetAI, RE::Actor::NiFlags::kInWater, RE::Actor::NiFlags::kSwimming, RE::Actor::NiFlags::kVoicePausedByScript, RE::Actor::NiFlags::kWasInFrustrum, RE::Actor::NiFlags::kShouldRotateToTrack, RE::Actor::NiFlags::kSetOnDeath, RE::Actor::NiFlags::kDoNotPadVoice, RE::Actor::NiFlags::kFootIKInRange, RE::Actor::NiFlags::kPlayerTeammate, RE::Actor::NiFlags::kGivePlayerXP, RE::Actor::NiFlags::kSoundCallbackSuccess, RE::Actor::NiFlags::kUseEmotion, RE::Actor::NiFlags::kGuard, RE::Actor::NiFlags::kParalyzed },
+	{ "kNone", "kDelayUpdateScenegraph", "kProcessMe", "kMurderAlarm", "kHasSceneExtra", "kHeadingFixed", "kSpeakingDone", "kIgnoreChangeAnimationCall", "kSoundFileDone", "kVoiceFileDone", "kInTempChangeList", "kDoNotRunSayToCallback", "kDead", "kForceGreetingPlayer", "kForceUpdateQuestTarget", "kSearchingInCombat", "kAttackOnNextTheft", "kEvpBuffered", "kResetAI", "kInWater", "kSwimming", "kVoicePausedByScript", "kWasInFrustrum", "kShouldRotateToTrack", "kSetOnDeath", "kDoNotPadVoice", "kFootIKInRange", "kPlayerTeammate", "kGivePlayerXP", "kSoundCallbackSuccess", "kUseEmotion", "kGuard", "kParalyzed" }));
+
+static_assert(test::RoundTrips<RE::ActorEquipManagerEvent::Type>(
+	{ RE::ActorEquipManagerEvent::Type::Equip, RE::ActorEquipManagerEvent::Type::Unequip },
+	{ "Equip", "Unequip" }));
+
+static_assert(test::RoundTrips<RE::ActorValue::AVType>(
+	{ RE::ActorValue::AVType::kDerivedAttribute, RE::ActorValue::AVType::kAttribute, RE::ActorValue::AVType::kSkill, RE::ActorValue::AVType::kAIAttribute, RE::ActorValue::AVType::kResistance, RE::ActorValue::AVType::kCondition, RE::ActorValue::AVType::kCharge, RE::ActorValue::AVType::kIntValue, RE::ActorValue::AVType::kVariable, RE::ActorValue::AVType::kResource },
+	{ "kDerivedAttribute", "kAttribute", "kSkill", "kAIAttribute", "kResistance", "kCondition", "kCharge", "kIntValue", "kVariable", "kResource" }));
+
+static_assert(test::RoundTrips<RE::ActorValue::Flags>(
+	{ RE::ActorValue::Flags::kNone, RE::ActorValue::Flags::kDepreciated, RE::ActorValue::Flags::kEnumeration, RE::ActorValue::Flags::kNoScriptModAV, RE::ActorValue::Flags::kCache, RE::ActorValue::Flags::kCachePermenant, RE::ActorValue::Flags::kAlwaysClamp, RE::ActorValue::Flags::kImplicitBase0, RE::ActorValue::Flags::kImplicitBase1, RE::ActorValue::Flags::kImplicitBase100, RE::ActorValue::Flags::kUserDefined, RE::ActorValue::Flags::kDerived, RE::ActorValue::Flags::kBaseUseAutoCalc, RE::ActorValue::Flags::kMin1, RE::ActorValue::Flags::kMax10, RE::ActorValue::Flags::kMax100, RE::ActorValue::Flags::kScaleBy100, RE::ActorValue::Flags::kPercentage, RE::ActorValue::Flags::kDamageMinZero, RE::ActorValue::Flags::kDamageIsPositive, RE::ActorValue::Flags::kGodModeNoDamage, RE::ActorValue::Flags::kDoesNotRecover, RE::ActorValue::Flags::kHardcoded },
+	{ "kNone", "kDepreciated", "kEnumeration", "kNoScriptModAV", "kCache", "kCachePermenant", "kAlwaysClamp", "kImplicitBase0", "kImplicitBase1", "kImplicitBase100", "kUserDefined", "kDerived", "kBaseUseAutoCalc", "kMin1", "kMax10", "kMax100", "kScaleBy100", "kPercentage", "kDamageMinZero", "kDamageIsPositive", "kGodModeNoDamage", "kDoesNotRecover", "kHardcoded" }));
+
+static_assert(test::RoundTrips<RE::AlchemyItem::Flags>(
+	{ RE::AlchemyItem::Flags::kNone, RE::AlchemyItem::Flags::kCostOverride, RE::AlchemyItem::Flags::kFood, RE::AlchemyItem::Flags::kMedicine, RE::AlchemyItem::Flags::kPoison },
+	{ "kNone", "kCostOverride", "kFood", "kMedicine", "kPoison" }));
+
+static_assert(test::RoundTrips<RE::AlchemyItem::RecordFlags::RecordFlag>(
+	{ RE::AlchemyItem::RecordFlags::RecordFlag::kDeleted, RE::AlchemyItem::RecordFlags::RecordFlag::kIgnored, RE::AlchemyItem::RecordFlags::RecordFlag::kMedicine },
+	{ "kDeleted", "kIgnored", "kMedicine" }));
+
+static_assert(test::RoundTrips<RE::AttackBlockHandler::POWER_ATTACK_STATE>(
+	{ RE::AttackBlockHandler::POWER_ATTACK_STATE::kNone, RE::AttackBlockHandler::POWER_ATTACK_STATE::kLeft, RE::AttackBlockHandler::POWER_ATTACK_STATE::kRight, RE::AttackBlockHandler::POWER_ATTACK_STATE::kDual },
+	{ "kNone", "kLeft", "kRight", "kDual" }));
+
+static_assert(test::RoundTrips<RE::BGSAcousticSpace::RecordFlags::RecordFlag>(
+	{ RE::BGSAcousticSpace::RecordFlags::RecordFlag::kDeleted, RE::BGSAcousticSpace::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSAction::RecordFlags::RecordFlag>(
+	{ RE::BGSAction::RecordFlags::RecordFlag::kDeleted, RE::BGSAction::RecordFlags::RecordFlag::kIgnored, RE::BGSAction::RecordFlags::RecordFlag::kRestricted },
+	{ "kDeleted", "kIgnored", "kRestricted" }));
+
+static_assert(test::RoundTrips<RE::BGSActorCellEvent::CellFlags>(
+	{ RE::BGSActorCellEvent::CellFlags::kEnter, RE::BGSActorCellEvent::CellFlags::kLeave },
+	{ "kEnter", "kLeave" }));
+
+static_assert(test::RoundTrips<RE::BGSAddonNode::RecordFlags::RecordFlag>(
+	{ RE::BGSAddonNode::RecordFlags::RecordFlag::kDeleted, RE::BGSAddonNode::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSAimModel::RecordFlags::RecordFlag>(
+	{ RE::BGSAimModel::RecordFlags::RecordFlag::kDeleted, RE::BGSAimModel::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSArtObject::ArtType>(
+	{ RE::BGSArtObject::ArtType::kMagicCastingArt, RE::BGSArtObject::ArtType::kMagicHitEffect, RE::BGSArtObject::ArtType::kMagicEnchantEffect },
+	{ "kMagicCastingArt", "kMagicHitEffect", "kMagicEnchantEffect" }));
+
+static_assert(test::RoundTrips<RE::BGSArtObject::RecordFlags::RecordFlag>(
+	{ RE::BGSArtObject::RecordFlags::RecordFlag::kDeleted, RE::BGSArtObject::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSAssociationType::Flags>(
+	{ RE::BGSAssociationType::Flags::kNone, RE::BGSAssociationType::Flags::kFamily },
+	{ "kNone", "kFamily" }));
+
+static_assert(test::RoundTrips<RE::BGSAssociationType::RecordFlags::RecordFlag>(
+	{ RE::BGSAssociationType::RecordFlags::RecordFlag::kDeleted, RE::BGSAssociationType::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSAttractionRule::RecordFlags::RecordFlag>(
+	{ RE::BGSAttractionRule::RecordFlags::RecordFlag::kDeleted, RE::BGSAttractionRule::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSAudioEffectChain::RecordFlags::RecordFlag>(
+	{ RE::BGSAudioEffectChain::RecordFlags::RecordFlag::kDeleted, RE::BGSAudioEffectChain::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSBaseAlias::Flags>(
+	{ RE::BGSBaseAlias::Flags::kReserves, RE::BGSBaseAlias::Flags::kOptional, RE::BGSBaseAlias::Flags::kQuestObject, RE::BGSBaseAlias::Flags::kAllowReuse, RE::BGSBaseAlias::Flags::kAllowDead, RE::BGSBaseAlias::Flags::kLoadedOnly, RE::BGSBaseAlias::Flags::kEssential, RE::BGSBaseAlias::Flags::kAllowDisabled, RE::BGSBaseAlias::Flags::kStoreName, RE::BGSBaseAlias::Flags::kAllowReserved, RE::BGSBaseAlias::Flags::kProtected, RE::BGSBaseAlias::Flags::kForcedFromAlias, RE::BGSBaseAlias::Flags::kAllowDestroyed, RE::BGSBaseAlias::Flags::kFindPlayerClosest, RE::BGSBaseAlias::Flags::kUsesNames, RE::BGSBaseAlias::Flags::kInitiallyDisabled, RE::BGSBaseAlias::Flags::kAllowCleared, RE::BGSBaseAlias::Flags::kClearNameOnRemove, RE::BGSBaseAlias::Flags::kActorsOnly, RE::BGSBaseAlias::Flags::kTransient, RE::BGSBaseAlias::Flags::kExternalLink, RE::BGSBaseAlias::Flags::kNoPickPocket, RE::BGSBaseAlias::Flags::kDataAlias, RE::BGSBaseAlias::Flags::kSceneOptional },
+	{ "kReserves", "kOptional", "kQuestObject", "kAllowReuse", "kAllowDead", "kLoadedOnly", "kEssential", "kAllowDisabled", "kStoreName", "kAllowReserved", "kProtected", "kForcedFromAlias", "kAllowDestroyed", "kFindPlayerClosest", "kUsesNames", "kInitiallyDisabled", "kAllowCleared", "kClearNameOnRemove", "kActorsOnly", "kTransient", "kExternalLink", "kNoPickPocket", "kDataAlias", "kSceneOptional" }));
+
+static_assert(test::RoundTrips<RE::BGSBendableSpline::RecordFlags::RecordFlag>(
+	{ RE::BGSBendableSpline::RecordFlags::RecordFlag::kDeleted, RE::BGSBendableSpline::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSBodyPartData::PartType>(
+	{ RE::BGSBodyPartData::PartType::Torso, RE::BGSBodyPartData::PartType::Head1, RE::BGSBodyPartData::PartType::Eye, RE::BGSBodyPartData::PartType::LookAt, RE::BGSBodyPartData::PartType::FlyGrab, RE::BGSBodyPartData::PartType::Head2, RE::BGSBodyPartData::PartType::LeftArm1, RE::BGSBodyPartData::PartType::LeftArm2, RE::BGSBodyPartData::PartType::RightArm1, RE::BGSBodyPartData::PartType::RightArm2, RE::BGSBodyPartData::PartType::LeftLeg1, RE::BGSBodyPartData::PartType::LeftLeg2, RE::BGSBodyPartData::PartType::LeftLeg3, RE::BGSBodyPartData::PartType::RightLeg1, RE::BGSBodyPartData::PartType::RightLeg2, RE::BGSBodyPartData::PartType::RightLeg3, RE::BGSBodyPartData::PartType::Brain, RE::BGSBodyPartData::PartType::Weapon, RE::BGSBodyPartData::PartType::Root, RE::BGSBodyPartData::PartType::COM, RE::BGSBodyPartData::PartType::Pelvis, RE::BGSBodyPartData::PartType::Camera, RE::BGSBodyPartData::PartType::OffsetRoot, RE::BGSBodyPartData::PartType::LeftFoot, RE::BGSBodyPartData::PartType::RightFoot, RE::BGSBodyPartData::PartType::FaceTargetSource },
+	{ "Torso", "Head1", "Eye", "LookAt", "FlyGrab", "Head2", "LeftArm1", "LeftArm2", "RightArm1", "RightArm2", "LeftLeg1", "LeftLeg2", "LeftLeg3", "RightLeg1", "RightLeg2", "RightLeg3", "Brain", "Weapon", "Root", "COM", "Pelvis", "Camera", "OffsetRoot", "LeftFoot", "RightFoot", "FaceTargetSource" }));
+
+static_assert(test::RoundTrips<RE::BGSBodyPartData::RecordFlags::RecordFlag>(
+	{ RE::BGSBodyPartData::RecordFlags::RecordFlag::kDeleted, RE::BGSBodyPartData::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSCameraPath::RecordFlags::RecordFlag>(
+	{ RE::BGSCameraPath::RecordFlags::RecordFlag::kDeleted, RE::BGSCameraPath::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSCameraShot::CAM_ACTION>(
+	{ RE::BGSCameraShot::CAM_ACTION::kShoot, RE::BGSCameraShot::CAM_ACTION::kFly, RE::BGSCameraShot::CAM_ACTION::kHit, RE::BGSCameraShot::CAM_ACTION::kZoom },
+	{ "kShoot", "kFly", "kHit", "kZoom" }));
+
+static_assert(test::RoundTrips<RE::BGSCameraShot::CAM_OBJECT>(
+	{ RE::BGSCameraShot::CAM_OBJECT::kAttacker, RE::BGSCameraShot::CAM_OBJECT::kProjectile, RE::BGSCameraShot::CAM_OBJECT::kTarget, RE::BGSCameraShot::CAM_OBJECT::kLeadActor },
+	{ "kAttacker", "kProjectile", "kTarget", "kLeadActor" }));
+
+static_assert(test::RoundTrips<RE::BGSCameraShot::RecordFlags::RecordFlag>(
+	{ RE::BGSCameraShot::RecordFlags::RecordFlag::kDeleted, RE::BGSCameraShot::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSCharacterTint::BlendOp>(
+	{ RE::BGSCharacterTint::BlendOp::kDefault, RE::BGSCharacterTint::BlendOp::kMultiply, RE::BGSCharacterTint::BlendOp::kOverlay, RE::BGSCharacterTint::BlendOp::kSoftLight, RE::BGSCharacterTint::BlendOp::kHardLight, RE::BGSCharacterTint::BlendOp::kTotal },
+	{ "kDefault", "kMultiply", "kOverlay", "kSoftLight", "kHardLight", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::BGSCharacterTint::EntrySlot>(
+	{ RE::BGSCharacterTint::EntrySlot::kForeheadMask, RE::BGSCharacterTint::EntrySlot::kEyesMask, RE::BGSCharacterTint::EntrySlot::kNoseMask, RE::BGSCharacterTint::EntrySlot::kEarsMask, RE::BGSCharacterTint::EntrySlot::kCheeksMask, RE::BGSCharacterTint::EntrySlot::kMouthMask, RE::BGSCharacterTint::EntrySlot::kNeckMask, RE::BGSCharacterTint::EntrySlot::kLipColor, RE::BGSCharacterTint::EntrySlot::kCheekColor, RE::BGSCharacterTint::EntrySlot::kEyeliner, RE::BGSCharacterTint::EntrySlot::kEyeSocketUpper, RE::BGSCharacterTint::EntrySlot::kEyeSocketLower, RE::BGSCharacterTint::EntrySlot::kSkinTone, RE::BGSCharacterTint::EntrySlot::kPaint, RE::BGSCharacterTint::EntrySlot::kLaughLines, RE::BGSCharacterTint::EntrySlot::kCheekColorLower, RE::BGSCharacterTint::EntrySlot::kNose, RE::BGSCharacterTint::EntrySlot::kChin, RE::BGSCharacterTint::EntrySlot::kNeck, RE::BGSCharacterTint::EntrySlot::kForehead, RE::BGSCharacterTint::EntrySlot::kDirt, RE::BGSCharacterTint::EntrySlot::kScars, RE::BGSCharacterTint::EntrySlot::kFaceDetail, RE::BGSCharacterTint::EntrySlot::kBrow, RE::BGSCharacterTint::EntrySlot::kWrinkles, RE::BGSCharacterTint::EntrySlot::kBeard },
+	{ "kForeheadMask", "kEyesMask", "kNoseMask", "kEarsMask", "kCheeksMask", "kMouthMask", "kNeckMask", "kLipColor", "kCheekColor", "kEyeliner", "kEyeSocketUpper", "kEyeSocketLower", "kSkinTone", "kPaint", "kLaughLines", "kCheekColorLower", "kNose", "kChin", "kNeck", "kForehead", "kDirt", "kScars", "kFaceDetail", "kBrow", "kWrinkles", "kBeard" }));
+
+static_assert(test::RoundTrips<RE::BGSCharacterTint::EntryType>(
+	{ RE::BGSCharacterTint::EntryType::kMask, RE::BGSCharacterTint::EntryType::kPalette, RE::BGSCharacterTint::EntryType::kTexture, RE::BGSCharacterTint::EntryType::kUnknown },
+	{ "kMask", "kPalette", "kTexture", "kUnknown" }));
+
+static_assert(test::RoundTrips<RE::BGSCharacterTint::Template::Entry::Flags>(
+	{ RE::BGSCharacterTint::Template::Entry::Flags::kNone, RE::BGSCharacterTint::Template::Entry::Flags::kOnOffOnly, RE::BGSCharacterTint::Template::Entry::Flags::kIsChargenDetaul, RE::BGSCharacterTint::Template::Entry::Flags::kTakesSkinTone },
+	{ "kNone", "kOnOffOnly", "kIsChargenDetaul", "kTakesSkinTone" }));
+
+static_assert(test::RoundTrips<RE::BGSCollisionLayer::Flags>(
+	{ RE::BGSCollisionLayer::Flags::kNone, RE::BGSCollisionLayer::Flags::kTriggerVolume, RE::BGSCollisionLayer::Flags::kSensor, RE::BGSCollisionLayer::Flags::kNavMeshObstacle },
+	{ "kNone", "kTriggerVolume", "kSensor", "kNavMeshObstacle" }));
+
+static_assert(test::RoundTrips<RE::BGSCollisionLayer::RecordFlags::RecordFlag>(
+	{ RE::BGSCollisionLayer::RecordFlags::RecordFlag::kDeleted, RE::BGSCollisionLayer::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSColorForm::Flags>(
+	{ RE::BGSColorForm::Flags::kNone, RE::BGSColorForm::Flags::kPlayable, RE::BGSColorForm::Flags::kRemappingIndex, RE::BGSColorForm::Flags::kExtendedLUT },
+	{ "kNone", "kPlayable", "kRemappingIndex", "kExtendedLUT" }));
+
+static_assert(test::RoundTrips<RE::BGSColorForm::RecordFlags::RecordFlag>(
+	{ RE::BGSColorForm::RecordFlags::RecordFlag::kNonPlayable, RE::BGSColorForm::RecordFlags::RecordFlag::kDeleted, RE::BGSColorForm::RecordFlags::RecordFlag::kIgnored },
+	{ "kNonPlayable", "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSComponent::RecordFlags::RecordFlag>(
+	{ RE::BGSComponent::RecordFlags::RecordFlag::kDeleted, RE::BGSComponent::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSConstructibleObject::RecordFlags::RecordFlag>(
+	{ RE::BGSConstructibleObject::RecordFlags::RecordFlag::kDeleted, RE::BGSConstructibleObject::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSDamageType::RecordFlags::RecordFlag>(
+	{ RE::BGSDamageType::RecordFlags::RecordFlag::kDeleted, RE::BGSDamageType::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSDebris::RecordFlags::RecordFlag>(
+	{ RE::BGSDebris::RecordFlags::RecordFlag::kDeleted, RE::BGSDebris::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSDialogueBranch::Flags>(
+	{ RE::BGSDialogueBranch::Flags::kNone, RE::BGSDialogueBranch::Flags::kTopLevel, RE::BGSDialogueBranch::Flags::kBlocking, RE::BGSDialogueBranch::Flags::kExclusive },
+	{ "kNone", "kTopLevel", "kBlocking", "kExclusive" }));
+
+static_assert(test::RoundTrips<RE::BGSDialogueBranch::RecordFlags::RecordFlag>(
+	{ RE::BGSDialogueBranch::RecordFlags::RecordFlag::kDeleted, RE::BGSDialogueBranch::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSDualCastData::RecordFlags::RecordFlag>(
+	{ RE::BGSDualCastData::RecordFlags::RecordFlag::kDeleted, RE::BGSDualCastData::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSDualCastDataDEF::Flags>(
+	{ RE::BGSDualCastDataDEF::Flags::kNone, RE::BGSDualCastDataDEF::Flags::kHitEffectInheritScale, RE::BGSDualCastDataDEF::Flags::kProjectileInheritScale, RE::BGSDualCastDataDEF::Flags::kExplosionInheritScale },
+	{ "kNone", "kHitEffectInheritScale", "kProjectileInheritScale", "kExplosionInheritScale" }));
+
+static_assert(test::RoundTrips<RE::BGSEncounterZone::RecordFlags::RecordFlag>(
+	{ RE::BGSEncounterZone::RecordFlags::RecordFlag::kDeleted, RE::BGSEncounterZone::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSEntryPoint::ENTRY_POINT>(
+	{ RE::BGSEntryPoint::ENTRY_POINT::kModBreathTimer, RE::BGSEntryPoint::ENTRY_POINT::kCalculateCriticalHitChance, RE::BGSEntryPoint::ENTRY_POINT::kCalculateCriticalHitDamageMult, RE::BGSEntryPoint::ENTRY_POINT::kCalculateMineExplodeChance, RE::BGSEntryPoint::ENTRY_POINT::kModIncomingLimbDamage, RE::BGSEntryPoint::ENTRY_POINT::kAdjustBookActorValueBonus, RE::BGSEntryPoint::ENTRY_POINT::kModifyRecoveredHealth, RE::BGSEntryPoint::ENTRY_POINT::kGetShouldAttack, RE::BGSEntryPoint::ENTRY_POINT::kModBuyPrices, RE::BGSEntryPoint::ENTRY_POINT::kAddLeveledListOnDeath, RE::BGSEntryPoint::ENTRY_POINT::kGetMaxCarryWeight, RE::BGSEntryPoint::ENTRY_POINT::kModifyAddictionChance, RE::BGSEntryPoint::ENTRY_POINT::kModifyAddictionDuration, RE::BGSEntryPoint::ENTRY_POINT::kModifyPositiveChemDuration, RE::BGSEntryPoint::ENTRY_POINT::kActivate, RE::BGSEntryPoint::ENTRY_POINT::kIgnoreRunningDuringDetection, RE::BGSEntryPoint::ENTRY_POINT::kIgnoreBrokenLock, RE::BGSEntryPoint::ENTRY_POINT::kModifyEnemyCriticalHitChance, RE::BGSEntryPoint::ENTRY_POINT::kModifySneakAttackMult, RE::BGSEntryPoint::ENTRY_POINT::kModifyMaxPlaceableMines, RE::BGSEntryPoint::ENTRY_POINT::kModifyBowZoom, RE::BGSEntryPoint::ENTRY_POINT::kModifyRecoverArrowChance, RE::BGSEntryPoint::ENTRY_POINT::kModExperience, RE::BGSEntryPoint::ENTRY_POINT::kModTelekinesisDistance, RE::BGSEntryPoint::ENTRY_POINT::kModTelekinesisDamageMult, RE::BGSEntryPoint::ENTRY_POINT::kModTelekinesisDamage, RE::BGSEntryPoint::ENTRY_POINT::kModBashingDamage, RE::BGSEntryPoint::ENTRY_POINT::kModPowerAttackActionPoints, RE::BGSEntryPoint::ENTRY_POINT::kModPowerAttackDamage, RE::BGSEntryPoint::ENTRY_POINT::kModSpellMagnitude, RE::BGSEntryPoint::ENTRY_POINT::kModSpellDuration, RE::BGSEntryPoint::ENTRY_POINT::kModSecondaryValueWeight, RE::BGSEntryPoint::ENTRY_POINT::kModArmorWeight, RE::BGSEntryPoint::ENTRY_POINT::kModIncomingStagger, RE::BGSEntryPoint::ENTRY_POINT::kModTargetStagger, RE::BGSEntryPoint::ENTRY_POINT::kModAttackDamage, RE::BGSEntryPoint::ENTRY_POINT::kModIncomingDamage, RE::BGSEntryPoint::ENTRY_POINT::kModTargetDamageResistance, RE::BGSEntryPoint::ENTRY_POINT::kModSpellCost, RE::BGSEntryPoint::ENTRY_POINT::kModPercentageBlocked, RE::BGSEntryPoint::ENTRY_POINT::kModShieldDeflectArrowChance, RE::BGSEntryPoint::ENTRY_POINT::kModIncomingSpellMagnitude, RE::BGSEntryPoint::ENTRY_POINT::kModIncomingSpellDuration, RE::BGSEntryPoint::ENTRY_POINT::kModPlayerIntimidation, RE::BGSEntryPoint::ENTRY_POINT::kModRicochetChance, RE::BGSEntryPoint::ENTRY_POINT::kModRicochetDamage, RE::BGSEntryPoint::ENTRY_POINT::kModBribeAmount, RE::BGSEntryPoint::ENTRY_POINT::kModDetectionLight, RE::BGSEntryPoint::ENTRY_POINT::kModDetectionMovement, RE::BGSEntryPoint::ENTRY_POINT::kModScrapRewardMult, RE::BGSEntryPoint::ENTRY_POINT::kSetSweepAttack, RE::BGSEntryPoint::ENTRY_POINT::kApplyCombatHitSpell, RE::BGSEntryPoint::ENTRY_POINT::kApplyBashSpell, RE::BGSEntryPoint::ENTRY_POINT::kApplyReanimateSpell, RE::BGSEntryPoint::ENTRY_POINT::kSetBooleanGraphVariable, RE::BGSEntryPoint::ENTRY_POINT::kModSpellCastingSoundEvent, RE::BGSEntryPoint::ENTRY_POINT::kModPickpocketChance, RE::BGSEntryPoint::ENTRY_POINT::kModDetectionSneakSkill, RE::BGSEntryPoint::ENTRY_POINT::kModFallingDamage, RE::BGSEntryPoint::ENTRY_POINT::kModLockpickSweetSpot, RE::BGSEntryPoint::ENTRY_POINT::kModSellPrices, RE::BGSEntryPoint::ENTRY_POINT::kCanPickpocketEquippedItem, RE::BGSEntryPoint::ENTRY_POINT::kGetPlayerGateLockpick, RE::BGSEntryPoint::ENTRY_POINT::kSetLockpickStartingArc, RE::BGSEntryPoint::ENTRY_POINT::kSetLockpickProgressionPicking, RE::BGSEntryPoint::ENTRY_POINT::kSetLockpickUnbreakable, RE::BGSEntryPoint::ENTRY_POINT::kModAlchemyEffectiveness, RE::BGSEntryPoint::ENTRY_POINT::kApplyWeaponSwingSpell, RE::BGSEntryPoint::ENTRY_POINT::kModCommandedActorLimit, RE::BGSEntryPoint::ENTRY_POINT::kApplySneakingSpell, RE::BGSEntryPoint::ENTRY_POINT::kModPlayerMagicSlowdown, RE::BGSEntryPoint::ENTRY_POINT::kModWardMagickaAbsorptionPercent, RE::BGSEntryPoint::ENTRY_POINT::kModInitialIngredientEffectsLearned, RE::BGSEntryPoint::ENTRY_POINT::kPurifyAlchemyIngredients, RE::BGSEntryPoint::ENTRY_POINT::kFilterActivation, RE::BGSEntryPoint::ENTRY_POINT::kCanDualCastSpell, RE::BGSEntryPoint::ENTRY_POINT::kModOutgoingExplosionLimbDamage, RE::BGSEntryPoint::ENTRY_POINT::kModEnchantmentPower, RE::BGSEntryPoint::ENTRY_POINT::kModSoulPercentCapturedToWeapon, RE::BGSEntryPoint::ENTRY_POINT::kModVATSAttackAP, RE::BGSEntryPoint::ENTRY_POINT::kModReflectDamageChance, RE::BGSEntryPoint::ENTRY_POINT::kSetActivateLabel, RE::BGSEntryPoint::ENTRY_POINT::kModKillExperience, RE::BGSEntryPoint::ENTRY_POINT::kModPoisonDoseCount, RE::BGSEntryPoint::ENTRY_POINT::kShouldApplyItem, RE::BGSEntryPoint::ENTRY_POINT::kModArmorRating, RE::BGSEntryPoint::ENTRY_POINT::kModLockpickingCrimeChance, RE::BGSEntryPoint::ENTRY_POINT::kModIngredientsHarvested, RE::BGSEntryPoint::ENTRY_POINT::kModSpellRange, RE::BGSEntryPoint::ENTRY_POINT::kModRicochetCriticalChargeMult, RE::BGSEntryPoint::ENTRY_POINT::kModLockpickRewardKeyChance, RE::BGSEntryPoint::ENTRY_POINT::kModAutoLockpickChance, RE::BGSEntryPoint::ENTRY_POINT::kModAutoHackingChance, RE::BGSEntryPoint::ENTRY_POINT::kModTypedAttackDamage, RE::BGSEntryPoint::ENTRY_POINT::kModTypedIncomingDamage, RE::BGSEntryPoint::ENTRY_POINT::kModCharismaChallengeChance, RE::BGSEntryPoint::ENTRY_POINT::kModSprintAPDrainRate, RE::BGSEntryPoint::ENTRY_POINT::kModDrawnWeaponWeightSpeedEffect, RE::BGSEntryPoint::ENTRY_POINT::kGetPlayerGateHacking, RE::BGSEntryPoint::ENTRY_POINT::kModPlayerExplosionDamage, RE::BGSEntryPoint::ENTRY_POINT::kModPlayerExplosionScale, RE::BGSEntryPoint::ENTRY_POINT::kSetRadsToHealthMult, RE::BGSEntryPoint::ENTRY_POINT::kModActorScopeStability, RE::BGSEntryPoint::ENTRY_POINT::kModActorGrenadeSpeedMult, RE::BGSEntryPoint::ENTRY_POINT::kModExplosionForce, RE::BGSEntryPoint::ENTRY_POINT::kModVATSPenetrationMinVisibility, RE::BGSEntryPoint::ENTRY_POINT::kModRadsForRadHealthMax, RE::BGSEntryPoint::ENTRY_POINT::kModVATSPlayerAPKillAwardChance, RE::BGSEntryPoint::ENTRY_POINT::kSetVATSFillCritOnHit, RE::BGSEntryPoint::ENTRY_POINT::kModVATSConcentratedFireBonus, RE::BGSEntryPoint::ENTRY_POINT::kModVATSCriticalCount, RE::BGSEntryPoint::ENTRY_POINT::kModVATSHoldSteadyBonus, RE::BGSEntryPoint::ENTRY_POINT::kModTypedSpellMagnitude, RE::BGSEntryPoint::ENTRY_POINT::kModTypedIncomingSpellMagnitude, RE::BGSEntryPoint::ENTRY_POINT::kSetVATSGunFuNumTargetsForCrits, RE::BGSEntryPoint::ENTRY_POINT::kModOutgoingLimbDamage, RE::BGSEntryPoint::ENTRY_POINT::kModRestoreActionCostValue, RE::BGSEntryPoint::ENTRY_POINT::kModVATSReloadAP, RE::BGSEntryPoint::ENTRY_POINT::kModIncomingBatteryDamage, RE::BGSEntryPoint::ENTRY_POINT::kModVATSCriticalCharge, RE::BGSEntryPoint::ENTRY_POINT::kModExperienceLocation, RE::BGSEntryPoint::ENTRY_POINT::kModExperienceSpeech, RE::BGSEntryPoint::ENTRY_POINT::kModVATSHeadShotChance, RE::BGSEntryPoint::ENTRY_POINT::kModVATSHitChance, RE::BGSEntryPoint::ENTRY_POINT::kModIncomingExplosionDamage, RE::BGSEntryPoint::ENTRY_POINT::kModAmmoHealthMult, RE::BGSEntryPoint::ENTRY_POINT::kModHackingGuesses, RE::BGSEntryPoint::ENTRY_POINT::kModTerminalLockoutTime, RE::BGSEntryPoint::ENTRY_POINT::kSetUndetectable, RE::BGSEntryPoint::ENTRY_POINT::kInvestInVendor, RE::BGSEntryPoint::ENTRY_POINT::kModOutgoingLimbBashDamage, RE::BGSEntryPoint::ENTRY_POINT::kSetRunWhileOverEncumbered, RE::BGSEntryPoint::ENTRY_POINT::kGetComponentRadarDistance, RE::BGSEntryPoint::ENTRY_POINT::kShowGrenadeTrajectory, RE::BGSEntryPoint::ENTRY_POINT::kModConeOfFireMult, RE::BGSEntryPoint::ENTRY_POINT::kModVATSConcentratedFireDamageMult, RE::BGSEntryPoint::ENTRY_POINT::kApplyBloodyMessSpell, RE::BGSEntryPoint::ENTRY_POINT::kModVATSCritFillChanceOnBank, RE::BGSEntryPoint::ENTRY_POINT::kModVATSCritFillChanceOnUse, RE::BGSEntryPoint::ENTRY_POINT::kSetVATSCritFillOnAPReward, RE::BGSEntryPoint::ENTRY_POINT::kSetVATSCritFillOnStranger, RE::BGSEntryPoint::ENTRY_POINT::kModGunRangeMult, RE::BGSEntryPoint::ENTRY_POINT::kModScopeHoldBreathAPDrainMult, RE::BGSEntryPoint::ENTRY_POINT::kSetForceDecapitate, RE::BGSEntryPoint::ENTRY_POINT::kModVATSShootExplosiveDamageMult, RE::BGSEntryPoint::ENTRY_POINT::kModScroungerFillAmmoChance, RE::BGSEntryPoint::ENTRY_POINT::kSetCanExplodePants, RE::BGSEntryPoint::ENTRY_POINT::kSetVATSPenetrationFullDamage, RE::BGSEntryPoint::ENTRY_POINT::kModVATSGunFu2ndTargetDmgMult, RE::BGSEntryPoint::ENTRY_POINT::kModVATSGunFu3rdTargetDmgMult, RE::BGSEntryPoint::ENTRY_POINT::kModVATSGunFu4thPlusDmgMult, RE::BGSEntryPoint::ENTRY_POINT::kModVATSBlitzMaxDist, RE::BGSEntryPoint::ENTRY_POINT::kSetVATSBlitzDmgMultAtMaxDist, RE::BGSEntryPoint::ENTRY_POINT::kModVATSBlitzDmgBonusDist, RE::BGSEntryPoint::ENTRY_POINT::kModBashCriticalChance, RE::BGSEntryPoint::ENTRY_POINT::kVATSApplyParalyzingPalmSpell, RE::BGSEntryPoint::ENTRY_POINT::kModFatigueForFatigueAPMax, RE::BGSEntryPoint::ENTRY_POINT::kSetFatigueToAPMult },
+	{ "kModBreathTimer", "kCalculateCriticalHitChance", "kCalculateCriticalHitDamageMult", "kCalculateMineExplodeChance", "kModIncomingLimbDamage", "kAdjustBookActorValueBonus", "kModifyRecoveredHealth", "kGetShouldAttack", "kModBuyPrices", "kAddLeveledListOnDeath", "kGetMaxCarryWeight", "kModifyAddictionChance", "kModifyAddictionDuration", "kModifyPositiveChemDuration", "kActivate", "kIgnoreRunningDuringDetection", "kIgnoreBrokenLock", "kModifyEnemyCriticalHitChance", "kModifySneakAttackMult", "kModifyMaxPlaceableMines", "kModifyBowZoom", "kModifyRecoverArrowChance", "kModExperience", "kModTelekinesisDistance", "kModTelekinesisDamageMult", "kModTelekinesisDamage", "kModBashingDamage", "kModPowerAttackActionPoints", "kModPowerAttackDamage", "kModSpellMagnitude", "kModSpellDuration", "kModSecondaryValueWeight", "kModArmorWeight", "kModIncomingStagger", "kModTargetStagger", "kModAttackDamage", "kModIncomingDamage", "kModTargetDamageResistance", "kModSpellCost", "kModPercentageBlocked", "kModShieldDeflectArrowChance", "kModIncomingSpellMagnitude", "kModIncomingSpellDuration", "kModPlayerIntimidation", "kModRicochetChance", "kModRicochetDamage", "kModBribeAmount", "kModDetectionLight", "kModDetectionMovement", "kModScrapRewardMult", "kSetSweepAttack", "kApplyCombatHitSpell", "kApplyBashSpell", "kApplyReanimateSpell", "kSetBooleanGraphVariable", "kModSpellCastingSoundEvent", "kModPickpocketChance", "kModDetectionSneakSkill", "kModFallingDamage", "kModLockpickSweetSpot", "kModSellPrices", "kCanPickpocketEquippedItem", "kGetPlayerGateLockpick", "kSetLockpickStartingArc", "kSetLockpickProgressionPicking", "kSetLockpickUnbreakable", "kModAlchemyEffectiveness", "kApplyWeaponSwingSpell", "kModCommandedActorLimit", "kApplySneakingSpell", "kModPlayerMagicSlowdown", "kModWardMagickaAbsorptionPercent", "kModInitialIngredientEffectsLearned", "kPurifyAlchemyIngredients", "kFilterActivation", "kCanDualCastSpell", "kModOutgoingExplosionLimbDamage", "kModEnchantmentPower", "kModSoulPercentCapturedToWeapon", "kModVATSAttackAP", "kModReflectDamageChance", "kSetActivateLabel", "kModKillExperience", "kModPoisonDoseCount", "kShouldApplyItem", "kModArmorRating", "kModLockpickingCrimeChance", "kModIngredientsHarvested", "kModSpellRange", "kModRicochetCriticalChargeMult", "kModLockpickRewardKeyChance", "kModAutoLockpickChance", "kModAutoHackingChance", "kModTypedAttackDamage", "kModTypedIncomingDamage", "kModCharismaChallengeChance", "kModSprintAPDrainRate", "kModDrawnWeaponWeightSpeedEffect", "kGetPlayerGateHacking", "kModPlayerExplosionDamage", "kModPlayerExplosionScale", "kSetRadsToHealthMult", "kModActorScopeStability", "kModActorGrenadeSpeedMult", "kModExplosionForce", "kModVATSPenetrationMinVisibility", "kModRadsForRadHealthMax", "kModVATSPlayerAPKillAwardChance", "kSetVATSFillCritOnHit", "kModVATSConcentratedFireBonus", "kModVATSCriticalCount", "kModVATSHoldSteadyBonus", "kModTypedSpellMagnitude", "kModTypedIncomingSpellMagnitude", "kSetVATSGunFuNumTargetsForCrits", "kModOutgoingLimbDamage", "kModRestoreActionCostValue", "kModVATSReloadAP", "kModIncomingBatteryDamage", "kModVATSCriticalCharge", "kModExperienceLocation", "kModExperienceSpeech", "kModVATSHeadShotChance", "kModVATSHitChance", "kModIncomingExplosionDamage", "kModAmmoHealthMult", "kModHackingGuesses", "kModTerminalLockoutTime", "kSetUndetectable", "kInvestInVendor", "kModOutgoingLimbBashDamage", "kSetRunWhileOverEncumbered", "kGetComponentRadarDistance", "kShowGrenadeTrajectory", "kModConeOfFireMult", "kModVATSConcentratedFireDamageMult", "kApplyBloodyMessSpell", "kModVATSCritFillChanceOnBank", "kModVATSCritFillChanceOnUse", "kSetVATSCritFillOnAPReward", "kSetVATSCritFillOnStranger", "kModGunRangeMult", "kModScopeHoldBreathAPDrainMult", "kSetForceDecapitate", "kModVATSShootExplosiveDamageMult", "kModScroungerFillAmmoChance", "kSetCanExplodePants", "kSetVATSPenetrationFullDamage", "kModVATSGunFu2ndTargetDmgMult", "kModVATSGunFu3rdTargetDmgMult", "kModVATSGunFu4thPlusDmgMult", "kModVATSBlitzMaxDist", "kSetVATSBlitzDmgMultAtMaxDist", "kModVATSBlitzDmgBonusDist", "kModBashCriticalChance", "kVATSApplyParalyzingPalmSpell", "kModFatigueForFatigueAPMax", "kSetFatigueToAPMult" }));
+
+static_assert(test::RoundTrips<RE::BGSEntryPointFunctionData::FunctionType>(
+	{ RE::BGSEntryPointFunctionData::FunctionType::kInvalid, RE::BGSEntryPointFunctionData::FunctionType::kOneValue, RE::BGSEntryPointFunctionData::FunctionType::kTwoValue, RE::BGSEntryPointFunctionData::FunctionType::kLeveledList, RE::BGSEntryPointFunctionData::FunctionType::kActivateChoice, RE::BGSEntryPointFunctionData::FunctionType::kSpellItem, RE::BGSEntryPointFunctionData::FunctionType::kBooleanGraphVariable, RE::BGSEntryPointFunctionData::FunctionType::kText, RE::BGSEntryPointFunctionData::FunctionType::kActorValue },
+	{ "kInvalid", "kOneValue", "kTwoValue", "kLeveledList", "kActivateChoice", "kSpellItem", "kBooleanGraphVariable", "kText", "kActorValue" }));
+
+static_assert(test::RoundTrips<RE::BGSEntryPointFunctionDataActivateChoice::Flags01>(
+	{ RE::BGSEntryPointFunctionDataActivateChoice::Flags01::kNone, RE::BGSEntryPointFunctionDataActivateChoice::Flags01::kRunImmediately, RE::BGSEntryPointFunctionDataActivateChoice::Flags01::kReplaceDefault },
+	{ "kNone", "kRunImmediately", "kReplaceDefault" }));
+
+static_assert(test::RoundTrips<RE::BGSEntryPointPerkEntry::EntryData::Function>(
+	{ RE::BGSEntryPointPerkEntry::EntryData::Function::kSetValue, RE::BGSEntryPointPerkEntry::EntryData::Function::kAddValue, RE::BGSEntryPointPerkEntry::EntryData::Function::kMultiplyValue, RE::BGSEntryPointPerkEntry::EntryData::Function::kAddRangeToValue, RE::BGSEntryPointPerkEntry::EntryData::Function::kAddActorValueMult, RE::BGSEntryPointPerkEntry::EntryData::Function::kAbsoluteValue, RE::BGSEntryPointPerkEntry::EntryData::Function::kNegativeAbsoluteValue, RE::BGSEntryPointPerkEntry::EntryData::Function::kAddLeveledList, RE::BGSEntryPointPerkEntry::EntryData::Function::kAddActivateChoice, RE::BGSEntryPointPerkEntry::EntryData::Function::kSelectSpell, RE::BGSEntryPointPerkEntry::EntryData::Function::kSelectText, RE::BGSEntryPointPerkEntry::EntryData::Function::kSetToActorValueMult, RE::BGSEntryPointPerkEntry::EntryData::Function::kMultiplyActorValueMult, RE::BGSEntryPointPerkEntry::EntryData::Function::kMultiply1PlusActorValueMult, RE::BGSEntryPointPerkEntry::EntryData::Function::kSetText },
+	{ "kSetValue", "kAddValue", "kMultiplyValue", "kAddRangeToValue", "kAddActorValueMult", "kAbsoluteValue", "kNegativeAbsoluteValue", "kAddLeveledList", "kAddActivateChoice", "kSelectSpell", "kSelectText", "kSetToActorValueMult", "kMultiplyActorValueMult", "kMultiply1PlusActorValueMult", "kSetText" }));
+
+static_assert(test::RoundTrips<RE::BGSEquipSlot::Flags>(
+	{ RE::BGSEquipSlot::Flags::kNone, RE::BGSEquipSlot::Flags::kUseAllParents, RE::BGSEquipSlot::Flags::kParentsOptional, RE::BGSEquipSlot::Flags::kItemSlot },
+	{ "kNone", "kUseAllParents", "kParentsOptional", "kItemSlot" }));
+
+static_assert(test::RoundTrips<RE::BGSEquipSlot::RecordFlags::RecordFlag>(
+	{ RE::BGSEquipSlot::RecordFlags::RecordFlag::kDeleted, RE::BGSEquipSlot::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSExplosion::RecordFlags::RecordFlag>(
+	{ RE::BGSExplosion::RecordFlags::RecordFlag::kExplosionFormFlag_Deleted, RE::BGSExplosion::RecordFlags::RecordFlag::kExplosionFormFlag_Ignored },
+	{ "kExplosionFormFlag_Deleted", "kExplosionFormFlag_Ignored" }));
+
+static_assert(test::RoundTrips<RE::BGSExplosionData::Flags>(
+	{ RE::BGSExplosionData::Flags::kNone, RE::BGSExplosionData::Flags::kAlwaysUsesWorldOrientation, RE::BGSExplosionData::Flags::kKnockDown_Always, RE::BGSExplosionData::Flags::kKnockDown_ByFormula, RE::BGSExplosionData::Flags::kIgnoreLOSCheck, RE::BGSExplosionData::Flags::kPushExplosionSourceRefOnly, RE::BGSExplosionData::Flags::kIgnoreImageSpaceSwap, RE::BGSExplosionData::Flags::kChain, RE::BGSExplosionData::Flags::kNoControllerVibration, RE::BGSExplosionData::Flags::kPlacedObjectPersists, RE::BGSExplosionData::Flags::kSkipUnderwaterTest },
+	{ "kNone", "kAlwaysUsesWorldOrientation", "kKnockDown_Always", "kKnockDown_ByFormula", "kIgnoreLOSCheck", "kPushExplosionSourceRefOnly", "kIgnoreImageSpaceSwap", "kChain", "kNoControllerVibration", "kPlacedObjectPersists", "kSkipUnderwaterTest" }));
+
+static_assert(test::RoundTrips<RE::BGSFootstep::RecordFlags::RecordFlag>(
+	{ RE::BGSFootstep::RecordFlags::RecordFlag::kDeleted, RE::BGSFootstep::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSFootstepSet::RecordFlags::RecordFlag>(
+	{ RE::BGSFootstepSet::RecordFlags::RecordFlag::kDeleted, RE::BGSFootstepSet::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSGodRays::RecordFlags::RecordFlag>(
+	{ RE::BGSGodRays::RecordFlags::RecordFlag::kDeleted, RE::BGSGodRays::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSHazard::RecordFlags::RecordFlag>(
+	{ RE::BGSHazard::RecordFlags::RecordFlag::kDeleted, RE::BGSHazard::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSHazardData::BGSHazardFlags>(
+	{ RE::BGSHazardData::BGSHazardFlags::kNone, RE::BGSHazardData::BGSHazardFlags::kPlayerOnly, RE::BGSHazardData::BGSHazardFlags::kInheritDuration, RE::BGSHazardData::BGSHazardFlags::kAlignToNormal, RE::BGSHazardData::BGSHazardFlags::kInheritRadius, RE::BGSHazardData::BGSHazardFlags::kDropToGround, RE::BGSHazardData::BGSHazardFlags::kTaperEffectiveness },
+	{ "kNone", "kPlayerOnly", "kInheritDuration", "kAlignToNormal", "kInheritRadius", "kDropToGround", "kTaperEffectiveness" }));
+
+static_assert(test::RoundTrips<RE::BGSHeadPart::Flags>(
+	{ RE::BGSHeadPart::Flags::kNone, RE::BGSHeadPart::Flags::kPlayable, RE::BGSHeadPart::Flags::kCantBeFemale, RE::BGSHeadPart::Flags::kCantBeMale, RE::BGSHeadPart::Flags::kExtraPart, RE::BGSHeadPart::Flags::kUseSolidTint, RE::BGSHeadPart::Flags::kUseBodyTexture },
+	{ "kNone", "kPlayable", "kCantBeFemale", "kCantBeMale", "kExtraPart", "kUseSolidTint", "kUseBodyTexture" }));
+
+static_assert(test::RoundTrips<RE::BGSHeadPart::HeadPartType>(
+	{ RE::BGSHeadPart::HeadPartType::kMisc, RE::BGSHeadPart::HeadPartType::kFace, RE::BGSHeadPart::HeadPartType::kEyes, RE::BGSHeadPart::HeadPartType::kHair, RE::BGSHeadPart::HeadPartType::kFacialHair, RE::BGSHeadPart::HeadPartType::kScar, RE::BGSHeadPart::HeadPartType::kEyebrows, RE::BGSHeadPart::HeadPartType::kMeatcaps, RE::BGSHeadPart::HeadPartType::kTeeth, RE::BGSHeadPart::HeadPartType::kHeadRear },
+	{ "kMisc", "kFace", "kEyes", "kHair", "kFacialHair", "kScar", "kEyebrows", "kMeatcaps", "kTeeth", "kHeadRear" }));
+
+static_assert(test::RoundTrips<RE::BGSIdleMarker::RecordFlags::RecordFlag>(
+	{ RE::BGSIdleMarker::RecordFlags::RecordFlag::kDeleted, RE::BGSIdleMarker::RecordFlags::RecordFlag::kIgnored, RE::BGSIdleMarker::RecordFlags::RecordFlag::kChildCanUse },
+	{ "kDeleted", "kIgnored", "kChildCanUse" }));
+
+static_assert(test::RoundTrips<RE::BGSImpactData::ORIENTATION>(
+	{ RE::BGSImpactData::ORIENTATION::kSurfaceNormal, RE::BGSImpactData::ORIENTATION::kProjVector, RE::BGSImpactData::ORIENTATION::kProjReflect },
+	{ "kSurfaceNormal", "kProjVector", "kProjReflect" }));
+
+static_assert(test::RoundTrips<RE::BGSImpactData::RecordFlags::RecordFlag>(
+	{ RE::BGSImpactData::RecordFlags::RecordFlag::kDeleted, RE::BGSImpactData::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSImpactDataSet::RecordFlags::RecordFlag>(
+	{ RE::BGSImpactDataSet::RecordFlags::RecordFlag::kDeleted, RE::BGSImpactDataSet::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSInstanceNamingRules::RecordFlags::RecordFlag>(
+	{ RE::BGSInstanceNamingRules::RecordFlags::RecordFlag::kDeleted, RE::BGSInstanceNamingRules::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSInstanceNamingRules::RuleData::OperatorType>(
+	{ RE::BGSInstanceNamingRules::RuleData::OperatorType::kGreaterThanEqual, RE::BGSInstanceNamingRules::RuleData::OperatorType::kGreaterThan, RE::BGSInstanceNamingRules::RuleData::OperatorType::kLessThanEqual, RE::BGSInstanceNamingRules::RuleData::OperatorType::kLessThan, RE::BGSInstanceNamingRules::RuleData::OperatorType::kEqual },
+	{ "kGreaterThanEqual", "kGreaterThan", "kLessThanEqual", "kLessThan", "kEqual" }));
+
+static_assert(test::RoundTrips<RE::BGSInventoryItem::Stack::Flags>(
+	{ RE::BGSInventoryItem::Stack::Flags::kNone, RE::BGSInventoryItem::Stack::Flags::kSlotIndex1, RE::BGSInventoryItem::Stack::Flags::kSlotIndex2, RE::BGSInventoryItem::Stack::Flags::kSlotIndex3, RE::BGSInventoryItem::Stack::Flags::kEquipStateLocked, RE::BGSInventoryItem::Stack::Flags::kInvShouldEquip, RE::BGSInventoryItem::Stack::Flags::kTemporary, RE::BGSInventoryItem::Stack::Flags::kSlotMask },
+	{ "kNone", "kSlotIndex1", "kSlotIndex2", "kSlotIndex3", "kEquipStateLocked", "kInvShouldEquip", "kTemporary", "kSlotMask" }));
+
+static_assert(test::RoundTrips<RE::BGSInventoryListEvent::Type>(
+	{ RE::BGSInventoryListEvent::Type::kAddStack, RE::BGSInventoryListEvent::Type::kChangedStack, RE::BGSInventoryListEvent::Type::kAddNewItem, RE::BGSInventoryListEvent::Type::kRemoveItem, RE::BGSInventoryListEvent::Type::kClear, RE::BGSInventoryListEvent::Type::UpdateWeight },
+	{ "kAddStack", "kChangedStack", "kAddNewItem", "kRemoveItem", "kClear", "UpdateWeight" }));
+
+static_assert(test::RoundTrips<RE::BGSKeyword::RecordFlags::RecordFlag>(
+	{ RE::BGSKeyword::RecordFlags::RecordFlag::kDeleted, RE::BGSKeyword::RecordFlags::RecordFlag::kIgnored, RE::BGSKeyword::RecordFlags::RecordFlag::kRestricted },
+	{ "kDeleted", "kIgnored", "kRestricted" }));
+
+static_assert(test::RoundTrips<RE::BGSLensFlare::RecordFlags::RecordFlag>(
+	{ RE::BGSLensFlare::RecordFlags::RecordFlag::kDeleted, RE::BGSLensFlare::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSLightingTemplate::RecordFlags::RecordFlag>(
+	{ RE::BGSLightingTemplate::RecordFlags::RecordFlag::kDeleted, RE::BGSLightingTemplate::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSListForm::RecordFlags::RecordFlag>(
+	{ RE::BGSListForm::RecordFlags::RecordFlag::kDeleted, RE::BGSListForm::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSLocation::RecordFlags::RecordFlag>(
+	{ RE::BGSLocation::RecordFlags::RecordFlag::kDeleted, RE::BGSLocation::RecordFlags::RecordFlag::kInteriorCellsUseRefLocationForWorldMapPlayerMarker, RE::BGSLocation::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kInteriorCellsUseRefLocationForWorldMapPlayerMarker", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSLocationRefType::RecordFlags::RecordFlag>(
+	{ RE::BGSLocationRefType::RecordFlags::RecordFlag::kDeleted, RE::BGSLocationRefType::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSMaterialObject::RecordFlags::RecordFlag>(
+	{ RE::BGSMaterialObject::RecordFlags::RecordFlag::kDeleted, RE::BGSMaterialObject::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSMaterialSwap::RecordFlags::RecordFlag>(
+	{ RE::BGSMaterialSwap::RecordFlags::RecordFlag::kDeleted, RE::BGSMaterialSwap::RecordFlags::RecordFlag::kIgnored, RE::BGSMaterialSwap::RecordFlags::RecordFlag::kCustomSwap },
+	{ "kDeleted", "kIgnored", "kCustomSwap" }));
+
+static_assert(test::RoundTrips<RE::BGSMaterialType::Flags>(
+	{ RE::BGSMaterialType::Flags::kNone, RE::BGSMaterialType::Flags::kStairs, RE::BGSMaterialType::Flags::kArrowsStick, RE::BGSMaterialType::Flags::kCanTunnel },
+	{ "kNone", "kStairs", "kArrowsStick", "kCanTunnel" }));
+
+static_assert(test::RoundTrips<RE::BGSMaterialType::RecordFlags::RecordFlag>(
+	{ RE::BGSMaterialType::RecordFlags::RecordFlag::kDeleted, RE::BGSMaterialType::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSMenuIcon::RecordFlags::RecordFlag>(
+	{ RE::BGSMenuIcon::RecordFlags::RecordFlag::kDeleted, RE::BGSMenuIcon::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSMessage::Flags>(
+	{ RE::BGSMessage::Flags::kNone, RE::BGSMessage::Flags::kMessageBox, RE::BGSMessage::Flags::kInitialDelay },
+	{ "kNone", "kMessageBox", "kInitialDelay" }));
+
+static_assert(test::RoundTrips<RE::BGSMessage::RecordFlags::RecordFlag>(
+	{ RE::BGSMessage::RecordFlags::RecordFlag::kDeleted, RE::BGSMessage::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSMovableStatic::RecordFlags::RecordFlag>(
+	{ RE::BGSMovableStatic::RecordFlags::RecordFlag::kDeleted, RE::BGSMovableStatic::RecordFlags::RecordFlag::kMustUpdateAnims, RE::BGSMovableStatic::RecordFlags::RecordFlag::kHiddenFromLocalMap, RE::BGSMovableStatic::RecordFlags::RecordFlag::kIgnored, RE::BGSMovableStatic::RecordFlags::RecordFlag::kHasDistantLOD, RE::BGSMovableStatic::RecordFlags::RecordFlag::kRandomAnimStart, RE::BGSMovableStatic::RecordFlags::RecordFlag::kHasCurrents, RE::BGSMovableStatic::RecordFlags::RecordFlag::kObstacle, RE::BGSMovableStatic::RecordFlags::RecordFlag::kNavMeshGeneration_Filter, RE::BGSMovableStatic::RecordFlags::RecordFlag::kNavMeshGeneration_BoundingBox, RE::BGSMovableStatic::RecordFlags::RecordFlag::kNavMeshGeneration_Ground },
+	{ "kDeleted", "kMustUpdateAnims", "kHiddenFromLocalMap", "kIgnored", "kHasDistantLOD", "kRandomAnimStart", "kHasCurrents", "kObstacle", "kNavMeshGeneration_Filter", "kNavMeshGeneration_BoundingBox", "kNavMeshGeneration_Ground" }));
+
+static_assert(test::RoundTrips<RE::BGSMovementType::RecordFlags::RecordFlag>(
+	{ RE::BGSMovementType::RecordFlags::RecordFlag::kDeleted, RE::BGSMovementType::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSMusicTrackFormWrapper::RecordFlags::RecordFlag>(
+	{ RE::BGSMusicTrackFormWrapper::RecordFlags::RecordFlag::kDeleted, RE::BGSMusicTrackFormWrapper::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSMusicType::RecordFlags::RecordFlag>(
+	{ RE::BGSMusicType::RecordFlags::RecordFlag::kDeleted, RE::BGSMusicType::RecordFlags::RecordFlag::kIgnored, RE::BGSMusicType::RecordFlags::RecordFlag::kMusicType_UsesPalette },
+	{ "kDeleted", "kIgnored", "kMusicType_UsesPalette" }));
+
+static_assert(test::RoundTrips<RE::BGSNote::NOTE_TYPE>(
+	{ RE::BGSNote::NOTE_TYPE::kVoice, RE::BGSNote::NOTE_TYPE::kScene, RE::BGSNote::NOTE_TYPE::kProgram, RE::BGSNote::NOTE_TYPE::kTerminal },
+	{ "kVoice", "kScene", "kProgram", "kTerminal" }));
+
+static_assert(test::RoundTrips<RE::BGSNote::RecordFlags::RecordFlag>(
+	{ RE::BGSNote::RecordFlags::RecordFlag::kDeleted, RE::BGSNote::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSNumericIDIndex::Flags>(
+	{ RE::BGSNumericIDIndex::Flags::kNone, RE::BGSNumericIDIndex::Flags::kDefault, RE::BGSNumericIDIndex::Flags::kCreated },
+	{ "kNone", "kDefault", "kCreated" }));
+
+static_assert(test::RoundTrips<RE::BGSOutfit::RecordFlags::RecordFlag>(
+	{ RE::BGSOutfit::RecordFlags::RecordFlag::kDeleted, RE::BGSOutfit::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSPackIn::RecordFlags::RecordFlag>(
+	{ RE::BGSPackIn::RecordFlags::RecordFlag::kDeleted, RE::BGSPackIn::RecordFlags::RecordFlag::kPrefab, RE::BGSPackIn::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kPrefab", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSPerk::RecordFlags::RecordFlag>(
+	{ RE::BGSPerk::RecordFlags::RecordFlag::kNonPlayable, RE::BGSPerk::RecordFlags::RecordFlag::kDeleted, RE::BGSPerk::RecordFlags::RecordFlag::kIgnored },
+	{ "kNonPlayable", "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSPrimitive::PRIMITIVE_TYPE>(
+	{ RE::BGSPrimitive::PRIMITIVE_TYPE::kNone, RE::BGSPrimitive::PRIMITIVE_TYPE::kBox, RE::BGSPrimitive::PRIMITIVE_TYPE::kSphere, RE::BGSPrimitive::PRIMITIVE_TYPE::kPlane, RE::BGSPrimitive::PRIMITIVE_TYPE::kLine, RE::BGSPrimitive::PRIMITIVE_TYPE::kEllipsoid },
+	{ "kNone", "kBox", "kSphere", "kPlane", "kLine", "kEllipsoid" }));
+
+static_assert(test::RoundTrips<RE::BGSProjectile::RecordFlags::RecordFlag>(
+	{ RE::BGSProjectile::RecordFlags::RecordFlag::kDeleted, RE::BGSProjectile::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSProjectileData::Flags>(
+	{ RE::BGSProjectileData::Flags::kNone, RE::BGSProjectileData::Flags::kHitScan, RE::BGSProjectileData::Flags::kExplosion, RE::BGSProjectileData::Flags::kExplosionAltTrigger, RE::BGSProjectileData::Flags::kMuzzleFlash, RE::BGSProjectileData::Flags::kCanTurnOff, RE::BGSProjectileData::Flags::kCanPickUp, RE::BGSProjectileData::Flags::kSupersonic, RE::BGSProjectileData::Flags::kPinsLimbs, RE::BGSProjectileData::Flags::kPassSmallTransparent, RE::BGSProjectileData::Flags::kDisableCombatAimCorrection, RE::BGSProjectileData::Flags::kPenetratesGeometry, RE::BGSProjectileData::Flags::kContinuousUpdate, RE::BGSProjectileData::Flags::kSeeksTarget },
+	{ "kNone", "kHitScan", "kExplosion", "kExplosionAltTrigger", "kMuzzleFlash", "kCanTurnOff", "kCanPickUp", "kSupersonic", "kPinsLimbs", "kPassSmallTransparent", "kDisableCombatAimCorrection", "kPenetratesGeometry", "kContinuousUpdate", "kSeeksTarget" }));
+
+static_assert(test::RoundTrips<RE::BGSProjectileData::Type>(
+	{ RE::BGSProjectileData::Type::kMissile, RE::BGSProjectileData::Type::kLobber, RE::BGSProjectileData::Type::kBeam, RE::BGSProjectileData::Type::kFlame, RE::BGSProjectileData::Type::kCone, RE::BGSProjectileData::Type::kBarrier, RE::BGSProjectileData::Type::kArrow },
+	{ "kMissile", "kLobber", "kBeam", "kFlame", "kCone", "kBarrier", "kArrow" }));
+
+static_assert(test::RoundTrips<RE::BGSRefAlias::FILL_TYPE>(
+	{ RE::BGSRefAlias::FILL_TYPE::kConditions, RE::BGSRefAlias::FILL_TYPE::kForced, RE::BGSRefAlias::FILL_TYPE::kFromAlias, RE::BGSRefAlias::FILL_TYPE::kFromEvent, RE::BGSRefAlias::FILL_TYPE::kCreated, RE::BGSRefAlias::FILL_TYPE::kFromExternal, RE::BGSRefAlias::FILL_TYPE::kUniqueActor, RE::BGSRefAlias::FILL_TYPE::kNearAlias },
+	{ "kConditions", "kForced", "kFromAlias", "kFromEvent", "kCreated", "kFromExternal", "kUniqueActor", "kNearAlias" }));
+
+static_assert(test::RoundTrips<RE::BGSReferenceEffect::Flags>(
+	{ RE::BGSReferenceEffect::Flags::kNone, RE::BGSReferenceEffect::Flags::kFaceTarget, RE::BGSReferenceEffect::Flags::kAttachToCamera, RE::BGSReferenceEffect::Flags::kInheritRotation },
+	{ "kNone", "kFaceTarget", "kAttachToCamera", "kInheritRotation" }));
+
+static_assert(test::RoundTrips<RE::BGSReferenceEffect::RecordFlags::RecordFlag>(
+	{ RE::BGSReferenceEffect::RecordFlags::RecordFlag::kDeleted, RE::BGSReferenceEffect::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSRelationship::RecordFlags::RecordFlag>(
+	{ RE::BGSRelationship::RecordFlags::RecordFlag::kDeleted, RE::BGSRelationship::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSReverbParameters::RecordFlags::RecordFlag>(
+	{ RE::BGSReverbParameters::RecordFlags::RecordFlag::kDeleted, RE::BGSReverbParameters::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSReverbParameters::ReverbClass>(
+	{ RE::BGSReverbParameters::ReverbClass::kDefault, RE::BGSReverbParameters::ReverbClass::kClassA, RE::BGSReverbParameters::ReverbClass::kClassB, RE::BGSReverbParameters::ReverbClass::kClassC, RE::BGSReverbParameters::ReverbClass::kClassD, RE::BGSReverbParameters::ReverbClass::kClassE },
+	{ "kDefault", "kClassA", "kClassB", "kClassC", "kClassD", "kClassE" }));
+
+static_assert(test::RoundTrips<RE::BGSSaveLoadManager::QUEUED_TASK>(
+	{ RE::BGSSaveLoadManager::QUEUED_TASK::kAutoSave, RE::BGSSaveLoadManager::QUEUED_TASK::kForceSave, RE::BGSSaveLoadManager::QUEUED_TASK::kLoadMostRecentSave, RE::BGSSaveLoadManager::QUEUED_TASK::kQuickSave, RE::BGSSaveLoadManager::QUEUED_TASK::kQuickLoad, RE::BGSSaveLoadManager::QUEUED_TASK::kQuickNewSave, RE::BGSSaveLoadManager::QUEUED_TASK::kLoadGame, RE::BGSSaveLoadManager::QUEUED_TASK::kSysUtilLoadGame, RE::BGSSaveLoadManager::QUEUED_TASK::kMissingContentLoad, RE::BGSSaveLoadManager::QUEUED_TASK::kAutoSaveCommit, RE::BGSSaveLoadManager::QUEUED_TASK::kQuickSaveCommit, RE::BGSSaveLoadManager::QUEUED_TASK::kCaptureFaceGen, RE::BGSSaveLoadManager::QUEUED_TASK::kBuildSaveGameList, RE::BGSSaveLoadManager::QUEUED_TASK::kRefreshScreenshot, RE::BGSSaveLoadManager::QUEUED_TASK::kSaveAndQuit, RE::BGSSaveLoadManager::QUEUED_TASK::kConfirmModsLoad, RE::BGSSaveLoadManager::QUEUED_TASK::kSaveAndQuitToDesktop },
+	{ "kAutoSave", "kForceSave", "kLoadMostRecentSave", "kQuickSave", "kQuickLoad", "kQuickNewSave", "kLoadGame", "kSysUtilLoadGame", "kMissingContentLoad", "kAutoSaveCommit", "kQuickSaveCommit", "kCaptureFaceGen", "kBuildSaveGameList", "kRefreshScreenshot", "kSaveAndQuit", "kConfirmModsLoad", "kSaveAndQuitToDesktop" }));
+
+static_assert(test::RoundTrips<RE::BGSScene::Flags>(
+	{ RE::BGSScene::Flags::kNone, RE::BGSScene::Flags::kBeginOnQuestStart, RE::BGSScene::Flags::kStopOnQuestEnd, RE::BGSScene::Flags::kRepeatConditionsWhileTrue, RE::BGSScene::Flags::kInterruptible },
+	{ "kNone", "kBeginOnQuestStart", "kStopOnQuestEnd", "kRepeatConditionsWhileTrue", "kInterruptible" }));
+
+static_assert(test::RoundTrips<RE::BGSScene::RecordFlags::RecordFlag>(
+	{ RE::BGSScene::RecordFlags::RecordFlag::kDeleted, RE::BGSScene::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSSceneAction::Flags>(
+	{ RE::BGSSceneAction::Flags::kNone, RE::BGSSceneAction::Flags::kPlayerUseDialogueSubtypePositive, RE::BGSSceneAction::Flags::kPlayerUseDialogueSubtypeNegative, RE::BGSSceneAction::Flags::kPlayerUseDialogueSubtypeNeutral, RE::BGSSceneAction::Flags::kUseDialogueSubtype, RE::BGSSceneAction::Flags::kPlayerUseDialogueSubtypeQuestion, RE::BGSSceneAction::Flags::kFaceTaget, RE::BGSSceneAction::Flags::kHeadTrackPlayer, RE::BGSSceneAction::Flags::kIngoreForCompletion, RE::BGSSceneAction::Flags::kCameraSpeakerTarget },
+	{ "kNone", "kPlayerUseDialogueSubtypePositive", "kPlayerUseDialogueSubtypeNegative", "kPlayerUseDialogueSubtypeNeutral", "kUseDialogueSubtype", "kPlayerUseDialogueSubtypeQuestion", "kFaceTaget", "kHeadTrackPlayer", "kIngoreForCompletion", "kCameraSpeakerTarget" }));
+
+static_assert(test::RoundTrips<RE::BGSSceneAction::SCENE_ACTION_PLAYER_RESPONSE_TYPE>(
+	{ RE::BGSSceneAction::SCENE_ACTION_PLAYER_RESPONSE_TYPE::kPositive, RE::BGSSceneAction::SCENE_ACTION_PLAYER_RESPONSE_TYPE::kNegative, RE::BGSSceneAction::SCENE_ACTION_PLAYER_RESPONSE_TYPE::kNeutral, RE::BGSSceneAction::SCENE_ACTION_PLAYER_RESPONSE_TYPE::kQuestion, RE::BGSSceneAction::SCENE_ACTION_PLAYER_RESPONSE_TYPE::kTotal, RE::BGSSceneAction::SCENE_ACTION_PLAYER_RESPONSE_TYPE::kNone },
+	{ "kPositive", "kNegative", "kNeutral", "kQuestion", "kTotal", "kNone" }));
+
+static_assert(test::RoundTrips<RE::BGSSceneAction::SCENE_ACTION_TYPE>(
+	{ RE::BGSSceneAction::SCENE_ACTION_TYPE::kDialogue, RE::BGSSceneAction::SCENE_ACTION_TYPE::kPackage, RE::BGSSceneAction::SCENE_ACTION_TYPE::kTimer, RE::BGSSceneAction::SCENE_ACTION_TYPE::kPlayerDialogue, RE::BGSSceneAction::SCENE_ACTION_TYPE::kStartScene, RE::BGSSceneAction::SCENE_ACTION_TYPE::kNPCResponse, RE::BGSSceneAction::SCENE_ACTION_TYPE::kRadio },
+	{ "kDialogue", "kPackage", "kTimer", "kPlayerDialogue", "kStartScene", "kNPCResponse", "kRadio" }));
+
+static_assert(test::RoundTrips<RE::BGSSceneAction::Status>(
+	{ RE::BGSSceneAction::Status::kStopped, RE::BGSSceneAction::Status::kRunning, RE::BGSSceneAction::Status::kComplete },
+	{ "kStopped", "kRunning", "kComplete" }));
+
+static_assert(test::RoundTrips<RE::BGSShaderParticleGeometryData::RecordFlags::RecordFlag>(
+	{ RE::BGSShaderParticleGeometryData::RecordFlags::RecordFlag::kDeleted, RE::BGSShaderParticleGeometryData::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSSoundCategory::RecordFlags::RecordFlag>(
+	{ RE::BGSSoundCategory::RecordFlags::RecordFlag::kDeleted, RE::BGSSoundCategory::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSSoundCategorySnapshot::RecordFlags::RecordFlag>(
+	{ RE::BGSSoundCategorySnapshot::RecordFlags::RecordFlag::kDeleted, RE::BGSSoundCategorySnapshot::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSSoundDescriptorForm::RecordFlags::RecordFlag>(
+	{ RE::BGSSoundDescriptorForm::RecordFlags::RecordFlag::kDeleted, RE::BGSSoundDescriptorForm::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSSoundKeywordMapping::RecordFlags::RecordFlag>(
+	{ RE::BGSSoundKeywordMapping::RecordFlags::RecordFlag::kDeleted, RE::BGSSoundKeywordMapping::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSSoundOutput::Flags>(
+	{ RE::BGSSoundOutput::Flags::kNone, RE::BGSSoundOutput::Flags::kAttenuatesWithDistance, RE::BGSSoundOutput::Flags::kAllowsRumble, RE::BGSSoundOutput::Flags::kAppliesDoppler, RE::BGSSoundOutput::Flags::kAppliesDistantDelay, RE::BGSSoundOutput::Flags::kPlayerOutputModel, RE::BGSSoundOutput::Flags::kTryPlayOnController, RE::BGSSoundOutput::Flags::kCausesDucking, RE::BGSSoundOutput::Flags::kAvoidsDucking },
+	{ "kNone", "kAttenuatesWithDistance", "kAllowsRumble", "kAppliesDoppler", "kAppliesDistantDelay", "kPlayerOutputModel", "kTryPlayOnController", "kCausesDucking", "kAvoidsDucking" }));
+
+static_assert(test::RoundTrips<RE::BGSSoundOutput::RecordFlags::RecordFlag>(
+	{ RE::BGSSoundOutput::RecordFlags::RecordFlag::kDeleted, RE::BGSSoundOutput::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSSoundTagSet::RecordFlags::RecordFlag>(
+	{ RE::BGSSoundTagSet::RecordFlags::RecordFlag::kDeleted, RE::BGSSoundTagSet::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSStaticCollection::RecordFlags::RecordFlag>(
+	{ RE::BGSStaticCollection::RecordFlags::RecordFlag::kNonOccluder, RE::BGSStaticCollection::RecordFlags::RecordFlag::kDeleted, RE::BGSStaticCollection::RecordFlags::RecordFlag::kHiddenFromLocalMap, RE::BGSStaticCollection::RecordFlags::RecordFlag::kLoadscreen, RE::BGSStaticCollection::RecordFlags::RecordFlag::kUsedAsPlatform, RE::BGSStaticCollection::RecordFlags::RecordFlag::kIgnored, RE::BGSStaticCollection::RecordFlags::RecordFlag::kHasDistantLOD, RE::BGSStaticCollection::RecordFlags::RecordFlag::kObstacle, RE::BGSStaticCollection::RecordFlags::RecordFlag::kNavMeshGeneration_Filter, RE::BGSStaticCollection::RecordFlags::RecordFlag::kNavMeshGeneration_BoundingBox, RE::BGSStaticCollection::RecordFlags::RecordFlag::kNavMeshGeneration_Ground },
+	{ "kNonOccluder", "kDeleted", "kHiddenFromLocalMap", "kLoadscreen", "kUsedAsPlatform", "kIgnored", "kHasDistantLOD", "kObstacle", "kNavMeshGeneration_Filter", "kNavMeshGeneration_BoundingBox", "kNavMeshGeneration_Ground" }));
+
+static_assert(test::RoundTrips<RE::BGSTalkingActivator::RecordFlags::RecordFlag>(
+	{ RE::BGSTalkingActivator::RecordFlags::RecordFlag::kDeleted, RE::BGSTalkingActivator::RecordFlags::RecordFlag::kHiddenFromLocalMap, RE::BGSTalkingActivator::RecordFlags::RecordFlag::kIgnored, RE::BGSTalkingActivator::RecordFlags::RecordFlag::kRandomAnimStart, RE::BGSTalkingActivator::RecordFlags::RecordFlag::kRadioStation },
+	{ "kDeleted", "kHiddenFromLocalMap", "kIgnored", "kRandomAnimStart", "kRadioStation" }));
+
+static_assert(test::RoundTrips<RE::BGSTerminal::MenuItem::Type>(
+	{ RE::BGSTerminal::MenuItem::Type::kSubMenu_Terminal, RE::BGSTerminal::MenuItem::Type::kSubMenu_ReturnToTopLevel, RE::BGSTerminal::MenuItem::Type::kSubMenu_ForceRedraw, RE::BGSTerminal::MenuItem::Type::kDisplayText, RE::BGSTerminal::MenuItem::Type::kDisplayImage },
+	{ "kSubMenu_Terminal", "kSubMenu_ReturnToTopLevel", "kSubMenu_ForceRedraw", "kDisplayText", "kDisplayImage" }));
+
+static_assert(test::RoundTrips<RE::BGSTerminal::RecordFlags::RecordFlag>(
+	{ RE::BGSTerminal::RecordFlags::RecordFlag::kDeleted, RE::BGSTerminal::RecordFlags::RecordFlag::kIgnored, RE::BGSTerminal::RecordFlags::RecordFlag::kHasDistantLOD, RE::BGSTerminal::RecordFlags::RecordFlag::kRandomAnimStart },
+	{ "kDeleted", "kIgnored", "kHasDistantLOD", "kRandomAnimStart" }));
+
+static_assert(test::RoundTrips<RE::BGSTransform::RecordFlags::RecordFlag>(
+	{ RE::BGSTransform::RecordFlags::RecordFlag::kDeleted, RE::BGSTransform::RecordFlags::RecordFlag::kIgnored, RE::BGSTransform::RecordFlags::RecordFlag::kAroundOrigin },
+	{ "kDeleted", "kIgnored", "kAroundOrigin" }));
+
+static_assert(test::RoundTrips<RE::BGSVoiceType::RecordFlags::RecordFlag>(
+	{ RE::BGSVoiceType::RecordFlags::RecordFlag::kDeleted, RE::BGSVoiceType::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BGSZoomData::Data::OverlayType>(
+	{ RE::BGSZoomData::Data::OverlayType::kDefault, RE::BGSZoomData::Data::OverlayType::kFine, RE::BGSZoomData::Data::OverlayType::kDuplex, RE::BGSZoomData::Data::OverlayType::kGerman, RE::BGSZoomData::Data::OverlayType::kDot, RE::BGSZoomData::Data::OverlayType::kMilitaryDot, RE::BGSZoomData::Data::OverlayType::kCircle, RE::BGSZoomData::Data::OverlayType::kOldRangefind, RE::BGSZoomData::Data::OverlayType::kModernRangefind, RE::BGSZoomData::Data::OverlayType::kSVD, RE::BGSZoomData::Data::OverlayType::kHandPainted, RE::BGSZoomData::Data::OverlayType::kBinoculars, RE::BGSZoomData::Data::OverlayType::kCross, RE::BGSZoomData::Data::OverlayType::kDoubleZero, RE::BGSZoomData::Data::OverlayType::kRangefinder01, RE::BGSZoomData::Data::OverlayType::kRangefinder02, RE::BGSZoomData::Data::OverlayType::kRectangle },
+	{ "kDefault", "kFine", "kDuplex", "kGerman", "kDot", "kMilitaryDot", "kCircle", "kOldRangefind", "kModernRangefind", "kSVD", "kHandPainted", "kBinoculars", "kCross", "kDoubleZero", "kRangefinder01", "kRangefinder02", "kRectangle" }));
+
+static_assert(test::RoundTrips<RE::BGSZoomData::RecordFlags::RecordFlag>(
+	{ RE::BGSZoomData::RecordFlags::RecordFlag::kDeleted, RE::BGSZoomData::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::BIPED_OBJECT>(
+	{ RE::BIPED_OBJECT::kNone, RE::BIPED_OBJECT::kEditorCount, RE::BIPED_OBJECT::kWeaponHand, RE::BIPED_OBJECT::kWeaponSword, RE::BIPED_OBJECT::kWeaponDagger, RE::BIPED_OBJECT::kWeaponAxe, RE::BIPED_OBJECT::kWeaponMace, RE::BIPED_OBJECT::kWeaponTwoHandMelee, RE::BIPED_OBJECT::kWeaponBow, RE::BIPED_OBJECT::kWeaponStaff, RE::BIPED_OBJECT::kQuiver, RE::BIPED_OBJECT::kWeaponGun, RE::BIPED_OBJECT::kWeaponGrenade, RE::BIPED_OBJECT::kWeaponMine, RE::BIPED_OBJECT::kTotal },
+	{ "kNone", "kEditorCount", "kWeaponHand", "kWeaponSword", "kWeaponDagger", "kWeaponAxe", "kWeaponMace", "kWeaponTwoHandMelee", "kWeaponBow", "kWeaponStaff", "kQuiver", "kWeaponGun", "kWeaponGrenade", "kWeaponMine", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM>(
+	{ RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kNone, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kLODLand, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kLODObjects, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kMultiIndexDecal, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kOpaqueDecal, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kBlendedDecal, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kRefrActive, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::k1stPersonNonRefractive, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kFading, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kNoShadow, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kLowAniso, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kUnderwaterFog, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kSSLR, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kZOnly, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kPostZOnly, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kSkyClouds, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kSmoothAlphaTest, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kVATSMaskDepthOnly, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kVATSMask, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kSunGlare, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kBloodSpatter, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kZPrepass, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kWaterStencil, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kWaterDepth, RE::BSBatchRenderer::GEOMETRY_GROUP_ENUM::kTotal },
+	{ "kNone", "kLODLand", "kLODObjects", "kMultiIndexDecal", "kOpaqueDecal", "kBlendedDecal", "kRefrActive", "k1stPersonNonRefractive", "kFading", "kNoShadow", "kLowAniso", "kUnderwaterFog", "kSSLR", "kZOnly", "kPostZOnly", "kSkyClouds", "kSmoothAlphaTest", "kVATSMaskDepthOnly", "kVATSMask", "kSunGlare", "kBloodSpatter", "kZPrepass", "kWaterStencil", "kWaterDepth", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::BSEventNotifyControl>(
+	{ RE::BSEventNotifyControl::kContinue, RE::BSEventNotifyControl::kStop },
+	{ "kContinue", "kStop" }));
+
+static_assert(test::RoundTrips<RE::BSGraphics::MultiSampleLevel>(
+	{ RE::BSGraphics::MultiSampleLevel::kNone, RE::BSGraphics::MultiSampleLevel::kTwo, RE::BSGraphics::MultiSampleLevel::kFour, RE::BSGraphics::MultiSampleLevel::kEight },
+	{ "kNone", "kTwo", "kFour", "kEight" }));
+
+static_assert(test::RoundTrips<RE::BSGraphics::TAA_STATE>(
+	{ RE::BSGraphics::TAA_STATE::kDisabled, RE::BSGraphics::TAA_STATE::kEnabled },
+	{ "kDisabled", "kEnabled" }));
+
+static_assert(test::RoundTrips<RE::BSGraphics::TextureFileFormat>(
+	{ RE::BSGraphics::TextureFileFormat::kBMP, RE::BSGraphics::TextureFileFormat::kJPG, RE::BSGraphics::TextureFileFormat::kTGA, RE::BSGraphics::TextureFileFormat::kPNG, RE::BSGraphics::TextureFileFormat::kDDS },
+	{ "kBMP", "kJPG", "kTGA", "kPNG", "kDDS" }));
+
+static_assert(test::RoundTrips<RE::BSGraphics::Vertex::Attribute>(
+	{ RE::BSGraphics::Vertex::Attribute::VA_POSITION, RE::BSGraphics::Vertex::Attribute::VA_TEXCOORD0, RE::BSGraphics::Vertex::Attribute::VA_TEXCOORD1, RE::BSGraphics::Vertex::Attribute::VA_NORMAL, RE::BSGraphics::Vertex::Attribute::VA_BINORMAL, RE::BSGraphics::Vertex::Attribute::VA_COLOR, RE::BSGraphics::Vertex::Attribute::VA_SKINNING, RE::BSGraphics::Vertex::Attribute::VA_LANDDATA, RE::BSGraphics::Vertex::Attribute::VA_EYEDATA, RE::BSGraphics::Vertex::Attribute::VA_COUNT },
+	{ "VA_POSITION", "VA_TEXCOORD0", "VA_TEXCOORD1", "VA_NORMAL", "VA_BINORMAL", "VA_COLOR", "VA_SKINNING", "VA_LANDDATA", "VA_EYEDATA", "VA_COUNT" }));
+
+static_assert(test::RoundTrips<RE::BSGraphics::Vertex::Flags>(
+	{ RE::BSGraphics::Vertex::Flags::VF_VERTEX, RE::BSGraphics::Vertex::Flags::VF_UV, RE::BSGraphics::Vertex::Flags::VF_UV_2, RE::BSGraphics::Vertex::Flags::VF_NORMAL, RE::BSGraphics::Vertex::Flags::VF_TANGENT, RE::BSGraphics::Vertex::Flags::VF_COLORS, RE::BSGraphics::Vertex::Flags::VF_SKINNED, RE::BSGraphics::Vertex::Flags::VF_LANDDATA, RE::BSGraphics::Vertex::Flags::VF_EYEDATA, RE::BSGraphics::Vertex::Flags::VF_FULLPREC },
+	{ "VF_VERTEX", "VF_UV", "VF_UV_2", "VF_NORMAL", "VF_TANGENT", "VF_COLORS", "VF_SKINNED", "VF_LANDDATA", "VF_EYEDATA", "VF_FULLPREC" }));
+
+static_assert(test::RoundTrips<RE::BSGraphics::Vertex::Masks>(
+	{ RE::BSGraphics::Vertex::Masks::DESC_MASK_VERT, RE::BSGraphics::Vertex::Masks::DESC_MASK_UVS, RE::BSGraphics::Vertex::Masks::DESC_MASK_NBT, RE::BSGraphics::Vertex::Masks::DESC_MASK_SKCOL, RE::BSGraphics::Vertex::Masks::DESC_MASK_DATA, RE::BSGraphics::Vertex::Masks::DESC_MASK_OFFSET, RE::BSGraphics::Vertex::Masks::DESC_MASK_FLAGS },
+	{ "DESC_MASK_VERT", "DESC_MASK_UVS", "DESC_MASK_NBT", "DESC_MASK_SKCOL", "DESC_MASK_DATA", "DESC_MASK_OFFSET", "DESC_MASK_FLAGS" }));
+
+static_assert(test::RoundTrips<RE::BSInputDeviceManager::BS_DEVICES>(
+	{ RE::BSInputDeviceManager::BS_DEVICES::kKeyboard, RE::BSInputDeviceManager::BS_DEVICES::kMouse, RE::BSInputDeviceManager::BS_DEVICES::kGamepad, RE::BSInputDeviceManager::BS_DEVICES::kDebugGamepad, RE::BSInputDeviceManager::BS_DEVICES::kVirtualKeyboard, RE::BSInputDeviceManager::BS_DEVICES::kTotal },
+	{ "kKeyboard", "kMouse", "kGamepad", "kDebugGamepad", "kVirtualKeyboard", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::BSMTAManager::MODE>(
+	{ RE::BSMTAManager::MODE::kIdle, RE::BSMTAManager::MODE::kCollecting, RE::BSMTAManager::MODE::kExecuting },
+	{ "kIdle", "kCollecting", "kExecuting" }));
+
+static_assert(test::RoundTrips<RE::BSShaderData::LightingShaderEnum>(
+	{ RE::BSShaderData::LightingShaderEnum::kStandard, RE::BSShaderData::LightingShaderEnum::kWater, RE::BSShaderData::LightingShaderEnum::kEffect, RE::BSShaderData::LightingShaderEnum::kSky, RE::BSShaderData::LightingShaderEnum::kTallGrass },
+	{ "kStandard", "kWater", "kEffect", "kSky", "kTallGrass" }));
+
+static_assert(test::RoundTrips<RE::BSShaderMaterial::Feature>(
+	{ RE::BSShaderMaterial::Feature::kNone, RE::BSShaderMaterial::Feature::kDefault, RE::BSShaderMaterial::Feature::kEnvmap, RE::BSShaderMaterial::Feature::kGlowmap, RE::BSShaderMaterial::Feature::kParallax, RE::BSShaderMaterial::Feature::kFace, RE::BSShaderMaterial::Feature::kSkinTint, RE::BSShaderMaterial::Feature::kHairTint, RE::BSShaderMaterial::Feature::kParallaxOcc, RE::BSShaderMaterial::Feature::kLandscape, RE::BSShaderMaterial::Feature::kLODLandscape, RE::BSShaderMaterial::Feature::kSnow, RE::BSShaderMaterial::Feature::kMultiLayerParallax, RE::BSShaderMaterial::Feature::kTreeAnim, RE::BSShaderMaterial::Feature::kLODObjects, RE::BSShaderMaterial::Feature::kMultiIndexSnow, RE::BSShaderMaterial::Feature::kLODObjectsHD, RE::BSShaderMaterial::Feature::kEye, RE::BSShaderMaterial::Feature::kCloud, RE::BSShaderMaterial::Feature::kLODLandscapeNoise, RE::BSShaderMaterial::Feature::kLODLandscapeBlend, RE::BSShaderMaterial::Feature::kDismemberment },
+	{ "kNone", "kDefault", "kEnvmap", "kGlowmap", "kParallax", "kFace", "kSkinTint", "kHairTint", "kParallaxOcc", "kLandscape", "kLODLandscape", "kSnow", "kMultiLayerParallax", "kTreeAnim", "kLODObjects", "kMultiIndexSnow", "kLODObjectsHD", "kEye", "kCloud", "kLODLandscapeNoise", "kLODLandscapeBlend", "kDismemberment" }));
+
+static_assert(test::RoundTrips<RE::BSShaderMaterial::Type>(
+	{ RE::BSShaderMaterial::Type::kBase, RE::BSShaderMaterial::Type::kEffect, RE::BSShaderMaterial::Type::kLighting, RE::BSShaderMaterial::Type::kWater },
+	{ "kBase", "kEffect", "kLighting", "kWater" }));
+
+static_assert(test::RoundTrips<RE::BSShaderProperty::EShaderPropertyFlags>(
+	{ RE::BSShaderProperty::EShaderPropertyFlags::kSpecular, RE::BSShaderProperty::EShaderPropertyFlags::kSkinned, RE::BSShaderProperty::EShaderPropertyFlags::kTempRefraction, RE::BSShaderProperty::EShaderPropertyFlags::kVertexAlpha, RE::BSShaderProperty::EShaderPropertyFlags::kGrayscaleToPaletteColor, RE::BSShaderProperty::EShaderPropertyFlags::kGrayscaleToPaletteAlpha, RE::BSShaderProperty::EShaderPropertyFlags::kFalloff, RE::BSShaderProperty::EShaderPropertyFlags::kEnvMap, RE::BSShaderProperty::EShaderPropertyFlags::kRGBFalloff, RE::BSShaderProperty::EShaderPropertyFlags::kCastShadows, RE::BSShaderProperty::EShaderPropertyFlags::kFace, RE::BSShaderProperty::EShaderPropertyFlags::kUIMaskRects, RE::BSShaderProperty::EShaderPropertyFlags::kModelSpaceNormals, RE::BSShaderProperty::EShaderPropertyFlags::kRefractionClamp, RE::BSShaderProperty::EShaderPropertyFlags::kMultiTextureLandscape, RE::BSShaderProperty::EShaderPropertyFlags::kRefraction, RE::BSShaderProperty::EShaderPropertyFlags::kRefractionFalloff, RE::BSShaderProperty::EShaderPropertyFlags::kEyeReflect, RE::BSShaderProperty::EShaderPropertyFlags::kHairTint, RE::BSShaderProperty::EShaderPropertyFlags::kScreendoorAlphaFade, RE::BSShaderProperty::EShaderPropertyFlags::kLocalMapClear, RE::BSShaderProperty::EShaderPropertyFlags::kFaceGenRGBTint, RE::BSShaderProperty::EShaderPropertyFlags::kOwnEmit, RE::BSShaderProperty::EShaderPropertyFlags::kProjectedUV, RE::BSShaderProperty::EShaderPropertyFlags::kMultipleTextures, RE::BSShaderProperty::EShaderPropertyFlags::kTesselate, RE::BSShaderProperty::EShaderPropertyFlags::kDecal, RE::BSShaderProperty::EShaderPropertyFlags::kDynamicDecal, RE::BSShaderProperty::EShaderPropertyFlags::kCharacterLight, RE::BSShaderProperty::EShaderPropertyFlags::kExternalEmittance, RE::BSShaderProperty::EShaderPropertyFlags::kSoftEffect, RE::BSShaderProperty::EShaderPropertyFlags::kZBufferTest, RE::BSShaderProperty::EShaderPropertyFlags::kZBufferWrite, RE::BSShaderProperty::EShaderPropertyFlags::kLODLandscape, RE::BSShaderProperty::EShaderPropertyFlags::kLODObjects, RE::BSShaderProperty::EShaderPropertyFlags::kNoFade, RE::BSShaderProperty::EShaderPropertyFlags::kTwoSided, RE::BSShaderProperty::EShaderPropertyFlags::kVertexColors, RE::BSShaderProperty::EShaderPropertyFlags::kGlowMap, RE::BSShaderProperty::EShaderPropertyFlags::kTransformChanged, RE::BSShaderProperty::EShaderPropertyFlags::kDismembermentMeatCuff, RE::BSShaderProperty::EShaderPropertyFlags::kTint, RE::BSShaderProperty::EShaderPropertyFlags::kVertexLighting, RE::BSShaderProperty::EShaderPropertyFlags::kUniformScale, RE::BSShaderProperty::EShaderPropertyFlags::kFitSlope, RE::BSShaderProperty::EShaderPropertyFlags::kBillboard, RE::BSShaderProperty::EShaderPropertyFlags::kLODLandBlend, RE::BSShaderProperty::EShaderPropertyFlags::kDismemberment, RE::BSShaderProperty::EShaderPropertyFlags::kWireframe, RE::BSShaderProperty::EShaderPropertyFlags::kWeaponBlood, RE::BSShaderProperty::EShaderPropertyFlags::kHideOnLocalMap, RE::BSShaderProperty::EShaderPropertyFlags::kPremultAlpha, RE::BSShaderProperty::EShaderPropertyFlags::kVATSTarget, RE::BSShaderProperty::EShaderPropertyFlags::kAnisotropicLighting, RE::BSShaderProperty::EShaderPropertyFlags::kSkewSpecularAlpha, RE::BSShaderProperty::EShaderPropertyFlags::kMenuScreen, RE::BSShaderProperty::EShaderPropertyFlags::kMultiLayerParallax, RE::BSShaderProperty::EShaderPropertyFlags::kAlphaTest, RE::BSShaderProperty::EShaderPropertyFlags::kInvertedFadePattern, RE::BSShaderProperty::EShaderPropertyFlags::kVATSTargetDrawAll, RE::BSShaderProperty::EShaderPropertyFlags::kPipboyScreen, RE::BSShaderProperty::EShaderPropertyFlags::kTreeAnim, RE::BSShaderProperty::EShaderPropertyFlags::kEffectLighting, RE::BSShaderProperty::EShaderPropertyFlags::kRefractionWritesDepth },
+	{ "kSpecular", "kSkinned", "kTempRefraction", "kVertexAlpha", "kGrayscaleToPaletteColor", "kGrayscaleToPaletteAlpha", "kFalloff", "kEnvMap", "kRGBFalloff", "kCastShadows", "kFace", "kUIMaskRects", "kModelSpaceNormals", "kRefractionClamp", "kMultiTextureLandscape", "kRefraction", "kRefractionFalloff", "kEyeReflect", "kHairTint", "kScreendoorAlphaFade", "kLocalMapClear", "kFaceGenRGBTint", "kOwnEmit", "kProjectedUV", "kMultipleTextures", "kTesselate", "kDecal", "kDynamicDecal", "kCharacterLight", "kExternalEmittance", "kSoftEffect", "kZBufferTest", "kZBufferWrite", "kLODLandscape", "kLODObjects", "kNoFade", "kTwoSided", "kVertexColors", "kGlowMap", "kTransformChanged", "kDismembermentMeatCuff", "kTint", "kVertexLighting", "kUniformScale", "kFitSlope", "kBillboard", "kLODLandBlend", "kDismemberment", "kWireframe", "kWeaponBlood", "kHideOnLocalMap", "kPremultAlpha", "kVATSTarget", "kAnisotropicLighting", "kSkewSpecularAlpha", "kMenuScreen", "kMultiLayerParallax", "kAlphaTest", "kInvertedFadePattern", "kVATSTargetDrawAll", "kPipboyScreen", "kTreeAnim", "kEffectLighting", "kRefractionWritesDepth" }));
+
+static_assert(test::RoundTrips<RE::BSShaderProperty::TextureTypeEnum>(
+	{ RE::BSShaderProperty::TextureTypeEnum::kBase, RE::BSShaderProperty::TextureTypeEnum::kNormal, RE::BSShaderProperty::TextureTypeEnum::kGlow, RE::BSShaderProperty::TextureTypeEnum::kHeight, RE::BSShaderProperty::TextureTypeEnum::kEnv, RE::BSShaderProperty::TextureTypeEnum::kWrinkles, RE::BSShaderProperty::TextureTypeEnum::kMultilayer, RE::BSShaderProperty::TextureTypeEnum::kBacklightMask, RE::BSShaderProperty::TextureTypeEnum::kSmoothSpec, RE::BSShaderProperty::TextureTypeEnum::kTotal },
+	{ "kBase", "kNormal", "kGlow", "kHeight", "kEnv", "kWrinkles", "kMultilayer", "kBacklightMask", "kSmoothSpec", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::BSThreadEvent::Event>(
+	{ RE::BSThreadEvent::Event::kOnStartup, RE::BSThreadEvent::Event::kOnShutdown },
+	{ "kOnStartup", "kOnShutdown" }));
+
+static_assert(test::RoundTrips<RE::BSVisit::BSVisitControl>(
+	{ RE::BSVisit::BSVisitControl::kContinue, RE::BSVisit::BSVisitControl::kStop },
+	{ "kContinue", "kStop" }));
+
+static_assert(test::RoundTrips<RE::BS_BUTTON_CODE>(
+	{ RE::BS_BUTTON_CODE::kBackspace, RE::BS_BUTTON_CODE::kTab, RE::BS_BUTTON_CODE::kEnter, RE::BS_BUTTON_CODE::kPause, RE::BS_BUTTON_CODE::kCapsLock, RE::BS_BUTTON_CODE::kEscape, RE::BS_BUTTON_CODE::kSpace, RE::BS_BUTTON_CODE::kPageUp, RE::BS_BUTTON_CODE::kPageDown, RE::BS_BUTTON_CODE::kEnd, RE::BS_BUTTON_CODE::kHome, RE::BS_BUTTON_CODE::kLeft, RE::BS_BUTTON_CODE::kUp, RE::BS_BUTTON_CODE::kRight, RE::BS_BUTTON_CODE::kDown, RE::BS_BUTTON_CODE::kPrintScreen, RE::BS_BUTTON_CODE::kInsert, RE::BS_BUTTON_CODE::kDelete, RE::BS_BUTTON_CODE::k0, RE::BS_BUTTON_CODE::k1, RE::BS_BUTTON_CODE::k2, RE::BS_BUTTON_CODE::k3, RE::BS_BUTTON_CODE::k4, RE::BS_BUTTON_CODE::k5, RE::BS_BUTTON_CODE::k6, RE::BS_BUTTON_CODE::k7, RE::BS_BUTTON_CODE::k8, RE::BS_BUTTON_CODE::k9, RE::BS_BUTTON_CODE::kA, RE::BS_BUTTON_CODE::kB, RE::BS_BUTTON_CODE::kC, RE::BS_BUTTON_CODE::kD, RE::BS_BUTTON_CODE::kE, RE::BS_BUTTON_CODE::kF, RE::BS_BUTTON_CODE::kG, RE::BS_BUTTON_CODE::kH, RE::BS_BUTTON_CODE::kI, RE::BS_BUTTON_CODE::kJ, RE::BS_BUTTON_CODE::kK, RE::BS_BUTTON_CODE::kL, RE::BS_BUTTON_CODE::kM, RE::BS_BUTTON_CODE::kN, RE::BS_BUTTON_CODE::kO, RE::BS_BUTTON_CODE::kP, RE::BS_BUTTON_CODE::kQ, RE::BS_BUTTON_CODE::kR, RE::BS_BUTTON_CODE::kS, RE::BS_BUTTON_CODE::kT, RE::BS_BUTTON_CODE::kU, RE::BS_BUTTON_CODE::kV, RE::BS_BUTTON_CODE::kW, RE::BS_BUTTON_CODE::kX, RE::BS_BUTTON_CODE::kY, RE::BS_BUTTON_CODE::kZ, RE::BS_BUTTON_CODE::kApps, RE::BS_BUTTON_CODE::kNumpad_0, RE::BS_BUTTON_CODE::kNumpad_1, RE::BS_BUTTON_CODE::kNumpad_2, RE::BS_BUTTON_CODE::kNumpad_3, RE::BS_BUTTON_CODE::kNumpad_4, RE::BS_BUTTON_CODE::kNumpad_5, RE::BS_BUTTON_CODE::kNumpad_6, RE::BS_BUTTON_CODE::kNumpad_7, RE::BS_BUTTON_CODE::kNumpad_8, RE::BS_BUTTON_CODE::kNumpad_9, RE::BS_BUTTON_CODE::kNumpad_Multiply, RE::BS_BUTTON_CODE::kNumpad_Plus, RE::BS_BUTTON_CODE::kNumpad_Minus, RE::BS_BUTTON_CODE::kNumpad_Period, RE::BS_BUTTON_CODE::kNumpad_Divide, RE::BS_BUTTON_CODE::kF1, RE::BS_BUTTON_CODE::kF2, RE::BS_BUTTON_CODE::kF3, RE::BS_BUTTON_CODE::kF4, RE::BS_BUTTON_CODE::kF5, RE::BS_BUTTON_CODE::kF6, RE::BS_BUTTON_CODE::kF7, RE::BS_BUTTON_CODE::kF8, RE::BS_BUTTON_CODE::kF9, RE::BS_BUTTON_CODE::kF10, RE::BS_BUTTON_CODE::kF11, RE::BS_BUTTON_CODE::kF12, RE::BS_BUTTON_CODE::kSemicolon, RE::BS_BUTTON_CODE::kComma, RE::BS_BUTTON_CODE::kEquals, RE::BS_BUTTON_CODE::kMinus, RE::BS_BUTTON_CODE::kPeriod, RE::BS_BUTTON_CODE::kDivide, RE::BS_BUTTON_CODE::kLBracket, RE::BS_BUTTON_CODE::kBackslash, RE::BS_BUTTON_CODE::kRBracket, RE::BS_BUTTON_CODE::kApostrophe, RE::BS_BUTTON_CODE::kLShift, RE::BS_BUTTON_CODE::kRShift, RE::BS_BUTTON_CODE::kLControl, RE::BS_BUTTON_CODE::kRControl, RE::BS_BUTTON_CODE::kLAlt, RE::BS_BUTTON_CODE::kRAlt, RE::BS_BUTTON_CODE::kNumLock, RE::BS_BUTTON_CODE::kScrollLock, RE::BS_BUTTON_CODE::kGamepad, RE::BS_BUTTON_CODE::kDPAD_Up, RE::BS_BUTTON_CODE::kDPAD_Down, RE::BS_BUTTON_CODE::kDPAD_Left, RE::BS_BUTTON_CODE::kDPAD_Right, RE::BS_BUTTON_CODE::kLTrigger, RE::BS_BUTTON_CODE::kRTrigger, RE::BS_BUTTON_CODE::kStart, RE::BS_BUTTON_CODE::kBack, RE::BS_BUTTON_CODE::kLStick, RE::BS_BUTTON_CODE::kRStick, RE::BS_BUTTON_CODE::kLShoulder, RE::BS_BUTTON_CODE::kRShoulder, RE::BS_BUTTON_CODE::kAButton, RE::BS_BUTTON_CODE::kBButton, RE::BS_BUTTON_CODE::kXButton, RE::BS_BUTTON_CODE::kYButton, RE::BS_BUTTON_CODE::kWheelUp, RE::BS_BUTTON_CODE::kWheelDown },
+	{ "kBackspace", "kTab", "kEnter", "kPause", "kCapsLock", "kEscape", "kSpace", "kPageUp", "kPageDown", "kEnd", "kHome", "kLeft", "kUp", "kRight", "kDown", "kPrintScreen", "kInsert", "kDelete", "k0", "k1", "k2", "k3", "k4", "k5", "k6", "k7", "k8", "k9", "kA", "kB", "kC", "kD", "kE", "kF", "kG", "kH", "kI", "kJ", "kK", "kL", "kM", "kN", "kO", "kP", "kQ", "kR", "kS", "kT", "kU", "kV", "kW", "kX", "kY", "kZ", "kApps", "kNumpad_0", "kNumpad_1", "kNumpad_2", "kNumpad_3", "kNumpad_4", "kNumpad_5", "kNumpad_6", "kNumpad_7", "kNumpad_8", "kNumpad_9", "kNumpad_Multiply", "kNumpad_Plus", "kNumpad_Minus", "kNumpad_Period", "kNumpad_Divide", "kF1", "kF2", "kF3", "kF4", "kF5", "kF6", "kF7", "kF8", "kF9", "kF10", "kF11", "kF12", "kSemicolon", "kComma", "kEquals", "kMinus", "kPeriod", "kDivide", "kLBracket", "kBackslash", "kRBracket", "kApostrophe", "kLShift", "kRShift", "kLControl", "kRControl", "kLAlt", "kRAlt", "kNumLock", "kScrollLock", "kGamepad", "kDPAD_Up", "kDPAD_Down", "kDPAD_Left", "kDPAD_Right", "kLTrigger", "kRTrigger", "kStart", "kBack", "kLStick", "kRStick", "kLShoulder", "kRShoulder", "kAButton", "kBButton", "kXButton", "kYButton", "kWheelUp", "kWheelDown" }));
+
+static_assert(test::RoundTrips<RE::CHANGE_TYPES::CHANGE_TYPE>(
+	{ RE::CHANGE_TYPES::CHANGE_TYPE::kFormCreated, RE::CHANGE_TYPES::CHANGE_TYPE::kFormFlags, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrMove, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrHavokMove, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrCellChange, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrScale, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrInventory, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrExtraOwnership, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrBaseObject, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrExtraLinkRef, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrExtraWorkshop, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrExtraGameOnly, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrExtraCreatedOnly, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrExtraEncounterZone, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrAnimation, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrLeveledInventory, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrExtraActivatingChildren, RE::CHANGE_TYPES::CHANGE_TYPE::kRefrPromoted, RE::CHANGE_TYPES::CHANGE_TYPE::kActorLifestate, RE::CHANGE_TYPES::CHANGE_TYPE::kActorExtraPackageData, RE::CHANGE_TYPES::CHANGE_TYPE::kActorExtraMerchantContainer, RE::CHANGE_TYPES::CHANGE_TYPE::kActorPermanentModifiers, RE::CHANGE_TYPES::CHANGE_TYPE::kActorOverrideModifiers, RE::CHANGE_TYPES::CHANGE_TYPE::kActorDamageModifiers, RE::CHANGE_TYPES::CHANGE_TYPE::kActorTempModifiers, RE::CHANGE_TYPES::CHANGE_TYPE::kActorDispositionModifiers, RE::CHANGE_TYPES::CHANGE_TYPE::kActorExtraLeveledActor, RE::CHANGE_TYPES::CHANGE_TYPE::kActorExtraDismemberedLimbs, RE::CHANGE_TYPES::CHANGE_TYPE::kObjectExtraItemData, RE::CHANGE_TYPES::CHANGE_TYPE::kObjectExtraAmmo, RE::CHANGE_TYPES::CHANGE_TYPE::kObjectExtraLock, RE::CHANGE_TYPES::CHANGE_TYPE::kObjectForceMove, RE::CHANGE_TYPES::CHANGE_TYPE::kObjectOpenState, RE::CHANGE_TYPES::CHANGE_TYPE::kObjectOpenDefaultState, RE::CHANGE_TYPES::CHANGE_TYPE::kObjectEmpty, RE::CHANGE_TYPES::CHANGE_TYPE::kDoorExtraTeleport, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestFlags, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestScriptDelay, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestStages, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestScript, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestObjectives, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestRunData, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestInstances, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestAlreadyRun, RE::CHANGE_TYPES::CHANGE_TYPE::kTopicSaidPlayer, RE::CHANGE_TYPES::CHANGE_TYPE::kTopicSaidOnce, RE::CHANGE_TYPES::CHANGE_TYPE::kRelationshipData, RE::CHANGE_TYPES::CHANGE_TYPE::kLocationSpecRefs, RE::CHANGE_TYPES::CHANGE_TYPE::kLocationNewRefs, RE::CHANGE_TYPES::CHANGE_TYPE::kLocationKeywordData, RE::CHANGE_TYPES::CHANGE_TYPE::kLocationCleared, RE::CHANGE_TYPES::CHANGE_TYPE::kNoteRead, RE::CHANGE_TYPES::CHANGE_TYPE::kCellSeenData, RE::CHANGE_TYPES::CHANGE_TYPE::kCellDetachTime, RE::CHANGE_TYPES::CHANGE_TYPE::kCellExteriorChar, RE::CHANGE_TYPES::CHANGE_TYPE::kCellExteriorShort, RE::CHANGE_TYPES::CHANGE_TYPE::kCellFlags, RE::CHANGE_TYPES::CHANGE_TYPE::kCellFullname, RE::CHANGE_TYPES::CHANGE_TYPE::kCellOwnership, RE::CHANGE_TYPES::CHANGE_TYPE::kFactionFlags, RE::CHANGE_TYPES::CHANGE_TYPE::kFactionReactions, RE::CHANGE_TYPES::CHANGE_TYPE::kFactionVendorData, RE::CHANGE_TYPES::CHANGE_TYPE::kFactionCrimeCounts, RE::CHANGE_TYPES::CHANGE_TYPE::kPackageNeverRun, RE::CHANGE_TYPES::CHANGE_TYPE::kPackageWaiting, RE::CHANGE_TYPES::CHANGE_TYPE::kBaseObjectValue, RE::CHANGE_TYPES::CHANGE_TYPE::kBaseObjectFullName, RE::CHANGE_TYPES::CHANGE_TYPE::kBookTeaches, RE::CHANGE_TYPES::CHANGE_TYPE::kBookRead, RE::CHANGE_TYPES::CHANGE_TYPE::kTalkingActivatorSpeaker, RE::CHANGE_TYPES::CHANGE_TYPE::kActorBaseData, RE::CHANGE_TYPES::CHANGE_TYPE::kActorBaseAttributes, RE::CHANGE_TYPES::CHANGE_TYPE::kActorBaseAIData, RE::CHANGE_TYPES::CHANGE_TYPE::kActorBaseSpellList, RE::CHANGE_TYPES::CHANGE_TYPE::kActorBaseFullName, RE::CHANGE_TYPES::CHANGE_TYPE::kActorBaseFactions, RE::CHANGE_TYPES::CHANGE_TYPE::kNPCSkills, RE::CHANGE_TYPES::CHANGE_TYPE::kNPCClass, RE::CHANGE_TYPES::CHANGE_TYPE::kNPCFace, RE::CHANGE_TYPES::CHANGE_TYPE::kNPCDefaultOutfit, RE::CHANGE_TYPES::CHANGE_TYPE::kNPCSleepOutfit, RE::CHANGE_TYPES::CHANGE_TYPE::kNPCBodyScales, RE::CHANGE_TYPES::CHANGE_TYPE::kNPCRace, RE::CHANGE_TYPES::CHANGE_TYPE::kNPCGender, RE::CHANGE_TYPES::CHANGE_TYPE::kCreatureSkills, RE::CHANGE_TYPES::CHANGE_TYPE::kClassTagSkills, RE::CHANGE_TYPES::CHANGE_TYPE::kEncounterZoneFlags, RE::CHANGE_TYPES::CHANGE_TYPE::kEncounterZoneGameData, RE::CHANGE_TYPES::CHANGE_TYPE::kQuestNodeRunTime, RE::CHANGE_TYPES::CHANGE_TYPE::kSceneActive, RE::CHANGE_TYPES::CHANGE_TYPE::kFormListAddedForm, RE::CHANGE_TYPES::CHANGE_TYPE::kLeveledListAddedObject, RE::CHANGE_TYPES::CHANGE_TYPE::kIngredientUse, RE::CHANGE_TYPES::CHANGE_TYPE::kINRMergeTarget },
+	{ "kFormCreated", "kFormFlags", "kRefrMove", "kRefrHavokMove", "kRefrCellChange", "kRefrScale", "kRefrInventory", "kRefrExtraOwnership", "kRefrBaseObject", "kRefrExtraLinkRef", "kRefrExtraWorkshop", "kRefrExtraGameOnly", "kRefrExtraCreatedOnly", "kRefrExtraEncounterZone", "kRefrAnimation", "kRefrLeveledInventory", "kRefrExtraActivatingChildren", "kRefrPromoted", "kActorLifestate", "kActorExtraPackageData", "kActorExtraMerchantContainer", "kActorPermanentModifiers", "kActorOverrideModifiers", "kActorDamageModifiers", "kActorTempModifiers", "kActorDispositionModifiers", "kActorExtraLeveledActor", "kActorExtraDismemberedLimbs", "kObjectExtraItemData", "kObjectExtraAmmo", "kObjectExtraLock", "kObjectForceMove", "kObjectOpenState", "kObjectOpenDefaultState", "kObjectEmpty", "kDoorExtraTeleport", "kQuestFlags", "kQuestScriptDelay", "kQuestStages", "kQuestScript", "kQuestObjectives", "kQuestRunData", "kQuestInstances", "kQuestAlreadyRun", "kTopicSaidPlayer", "kTopicSaidOnce", "kRelationshipData", "kLocationSpecRefs", "kLocationNewRefs", "kLocationKeywordData", "kLocationCleared", "kNoteRead", "kCellSeenData", "kCellDetachTime", "kCellExteriorChar", "kCellExteriorShort", "kCellFlags", "kCellFullname", "kCellOwnership", "kFactionFlags", "kFactionReactions", "kFactionVendorData", "kFactionCrimeCounts", "kPackageNeverRun", "kPackageWaiting", "kBaseObjectValue", "kBaseObjectFullName", "kBookTeaches", "kBookRead", "kTalkingActivatorSpeaker", "kActorBaseData", "kActorBaseAttributes", "kActorBaseAIData", "kActorBaseSpellList", "kActorBaseFullName", "kActorBaseFactions", "kNPCSkills", "kNPCClass", "kNPCFace", "kNPCDefaultOutfit", "kNPCSleepOutfit", "kNPCBodyScales", "kNPCRace", "kNPCGender", "kCreatureSkills", "kClassTagSkills", "kEncounterZoneFlags", "kEncounterZoneGameData", "kQuestNodeRunTime", "kSceneActive", "kFormListAddedForm", "kLeveledListAddedObject", "kIngredientUse", "kINRMergeTarget" }));
+
+static_assert(test::RoundTrips<RE::COL_LAYER>(
+	{ RE::COL_LAYER::kUnidentified, RE::COL_LAYER::kStatic, RE::COL_LAYER::kAnimStatic, RE::COL_LAYER::kTransparent, RE::COL_LAYER::kClutter, RE::COL_LAYER::kWeapon, RE::COL_LAYER::kProjectile, RE::COL_LAYER::kSpell, RE::COL_LAYER::kBiped, RE::COL_LAYER::kTrees, RE::COL_LAYER::kProps, RE::COL_LAYER::kWater, RE::COL_LAYER::kTrigger, RE::COL_LAYER::kTerrain, RE::COL_LAYER::kTrap, RE::COL_LAYER::kNonCollidable, RE::COL_LAYER::kCloudTrap, RE::COL_LAYER::kGround, RE::COL_LAYER::kPortal, RE::COL_LAYER::kDebrisSmall, RE::COL_LAYER::kDebrisLarge, RE::COL_LAYER::kAcousticSpace, RE::COL_LAYER::kActorZone, RE::COL_LAYER::kProjectileZone, RE::COL_LAYER::kGasTrap, RE::COL_LAYER::kShellCasting, RE::COL_LAYER::kTransparentWall, RE::COL_LAYER::kInvisibleWall, RE::COL_LAYER::kTransparentSmallAnim, RE::COL_LAYER::kClutterLarge, RE::COL_LAYER::kCharController, RE::COL_LAYER::kStairHelper, RE::COL_LAYER::kDeadBip, RE::COL_LAYER::kBipedNoCC, RE::COL_LAYER::kAvoidBox, RE::COL_LAYER::kCollisionBox, RE::COL_LAYER::kCameraSphere, RE::COL_LAYER::kDoorDetection, RE::COL_LAYER::kConeProjectile, RE::COL_LAYER::kCamera, RE::COL_LAYER::kItemPicker, RE::COL_LAYER::kLOS, RE::COL_LAYER::kPathingPick, RE::COL_LAYER::kUnused0, RE::COL_LAYER::kUnused1, RE::COL_LAYER::kSpellExplosion, RE::COL_LAYER::kDroppingPick },
+	{ "kUnidentified", "kStatic", "kAnimStatic", "kTransparent", "kClutter", "kWeapon", "kProjectile", "kSpell", "kBiped", "kTrees", "kProps", "kWater", "kTrigger", "kTerrain", "kTrap", "kNonCollidable", "kCloudTrap", "kGround", "kPortal", "kDebrisSmall", "kDebrisLarge", "kAcousticSpace", "kActorZone", "kProjectileZone", "kGasTrap", "kShellCasting", "kTransparentWall", "kInvisibleWall", "kTransparentSmallAnim", "kClutterLarge", "kCharController", "kStairHelper", "kDeadBip", "kBipedNoCC", "kAvoidBox", "kCollisionBox", "kCameraSphere", "kDoorDetection", "kConeProjectile", "kCamera", "kItemPicker", "kLOS", "kPathingPick", "kUnused0", "kUnused1", "kSpellExplosion", "kDroppingPick" }));
+
+static_assert(test::RoundTrips<RE::COMMAND_TYPE>(
+	{ RE::COMMAND_TYPE::kNone, RE::COMMAND_TYPE::kCall, RE::COMMAND_TYPE::kFollow, RE::COMMAND_TYPE::kMove, RE::COMMAND_TYPE::kAttack, RE::COMMAND_TYPE::kInspect, RE::COMMAND_TYPE::kRetrieve, RE::COMMAND_TYPE::kStay, RE::COMMAND_TYPE::kRelease, RE::COMMAND_TYPE::kHeal, RE::COMMAND_TYPE::kAssign, RE::COMMAND_TYPE::kRide, RE::COMMAND_TYPE::kEnter },
+	{ "kNone", "kCall", "kFollow", "kMove", "kAttack", "kInspect", "kRetrieve", "kStay", "kRelease", "kHeal", "kAssign", "kRide", "kEnter" }));
+
+static_assert(test::RoundTrips<RE::COMPILER_NAME>(
+	{ RE::COMPILER_NAME::kDefault, RE::COMPILER_NAME::kSystemWindow, RE::COMPILER_NAME::kDialogue },
+	{ "kDefault", "kSystemWindow", "kDialogue" }));
+
+static_assert(test::RoundTrips<RE::CONDITIONITEMOBJECT>(
+	{ RE::CONDITIONITEMOBJECT::kSelf, RE::CONDITIONITEMOBJECT::kTarget, RE::CONDITIONITEMOBJECT::kRef, RE::CONDITIONITEMOBJECT::kCombatTarget, RE::CONDITIONITEMOBJECT::kLinkedRef, RE::CONDITIONITEMOBJECT::kQuestAlias, RE::CONDITIONITEMOBJECT::kPackData, RE::CONDITIONITEMOBJECT::kEventData, RE::CONDITIONITEMOBJECT::kCommandTarget, RE::CONDITIONITEMOBJECT::kEventCameraRef, RE::CONDITIONITEMOBJECT::kMyKiller },
+	{ "kSelf", "kTarget", "kRef", "kCombatTarget", "kLinkedRef", "kQuestAlias", "kPackData", "kEventData", "kCommandTarget", "kEventCameraRef", "kMyKiller" }));
+
+static_assert(test::RoundTrips<RE::CONT_DATA::Flags>(
+	{ RE::CONT_DATA::Flags::kNone, RE::CONT_DATA::Flags::kAllowsSoundsWhenAnimation, RE::CONT_DATA::Flags::kRespawn, RE::CONT_DATA::Flags::kShowOwner },
+	{ "kNone", "kAllowsSoundsWhenAnimation", "kRespawn", "kShowOwner" }));
+
+static_assert(test::RoundTrips<RE::Calendar::Months::Month>(
+	{ RE::Calendar::Months::Month::kJanuary, RE::Calendar::Months::Month::kFebruary, RE::Calendar::Months::Month::kMarch, RE::Calendar::Months::Month::kApril, RE::Calendar::Months::Month::kMay, RE::Calendar::Months::Month::kJune, RE::Calendar::Months::Month::kJuly, RE::Calendar::Months::Month::kAugust, RE::Calendar::Months::Month::kSeptember, RE::Calendar::Months::Month::kOctober, RE::Calendar::Months::Month::kNovember, RE::Calendar::Months::Month::kDecember, RE::Calendar::Months::Month::kTotal },
+	{ "kJanuary", "kFebruary", "kMarch", "kApril", "kMay", "kJune", "kJuly", "kAugust", "kSeptember", "kOctober", "kNovember", "kDecember", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::CameraStates::CameraState>(
+	{ RE::CameraStates::CameraState::kFirstPerson, RE::CameraStates::CameraState::kAutoVanity, RE::CameraStates::CameraState::kVATS, RE::CameraStates::CameraState::kFree, RE::CameraStates::CameraState::kIronSights, RE::CameraStates::CameraState::kPCTransition, RE::CameraStates::CameraState::kTween, RE::CameraStates::CameraState::kAnimated, RE::CameraStates::CameraState::k3rdPerson, RE::CameraStates::CameraState::kFurniture, RE::CameraStates::CameraState::kMount, RE::CameraStates::CameraState::kBleedout, RE::CameraStates::CameraState::kDialogue, RE::CameraStates::CameraState::kTotal },
+	{ "kFirstPerson", "kAutoVanity", "kVATS", "kFree", "kIronSights", "kPCTransition", "kTween", "kAnimated", "k3rdPerson", "kFurniture", "kMount", "kBleedout", "kDialogue", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::CannotCastReason>(
+	{ RE::CannotCastReason::kOK, RE::CannotCastReason::kMagicka, RE::CannotCastReason::kPowerUsed, RE::CannotCastReason::kRangedUnderWater, RE::CannotCastReason::kMultipleCast, RE::CannotCastReason::kItemCharge, RE::CannotCastReason::kCastWhileShouting, RE::CannotCastReason::kShoutWhileCasting, RE::CannotCastReason::kShoutWhileRecovering, RE::CannotCastReason::kCustomReasonNoStart },
+	{ "kOK", "kMagicka", "kPowerUsed", "kRangedUnderWater", "kMultipleCast", "kItemCharge", "kCastWhileShouting", "kShoutWhileCasting", "kShoutWhileRecovering", "kCustomReasonNoStart" }));
+
+static_assert(test::RoundTrips<RE::CastingSource>(
+	{ RE::CastingSource::kLeftHand, RE::CastingSource::kRightHand, RE::CastingSource::kOther, RE::CastingSource::kInstant },
+	{ "kLeftHand", "kRightHand", "kOther", "kInstant" }));
+
+static_assert(test::RoundTrips<RE::CastingType>(
+	{ RE::CastingType::kConstantEffect, RE::CastingType::kFireAndForget, RE::CastingType::kConcentration, RE::CastingType::kScroll },
+	{ "kConstantEffect", "kFireAndForget", "kConcentration", "kScroll" }));
+
+static_assert(test::RoundTrips<RE::CellAttachDetachEvent::EVENT_TYPE>(
+	{ RE::CellAttachDetachEvent::EVENT_TYPE::kPreAttach, RE::CellAttachDetachEvent::EVENT_TYPE::kPostAttach, RE::CellAttachDetachEvent::EVENT_TYPE::kPreDetach, RE::CellAttachDetachEvent::EVENT_TYPE::kPostDetach },
+	{ "kPreAttach", "kPostAttach", "kPreDetach", "kPostDetach" }));
+
+static_assert(test::RoundTrips<RE::CodeTasklet::OpCode>(
+	{ RE::CodeTasklet::OpCode::kNOP, RE::CodeTasklet::OpCode::kIADD, RE::CodeTasklet::OpCode::kFADD, RE::CodeTasklet::OpCode::kISUB, RE::CodeTasklet::OpCode::kFSUB, RE::CodeTasklet::OpCode::kIMUL, RE::CodeTasklet::OpCode::kFMUL, RE::CodeTasklet::OpCode::kIDIV, RE::CodeTasklet::OpCode::kFDIV, RE::CodeTasklet::OpCode::kIMOD, RE::CodeTasklet::OpCode::kNOT, RE::CodeTasklet::OpCode::kINEG, RE::CodeTasklet::OpCode::kFNEG, RE::CodeTasklet::OpCode::kASSIGN, RE::CodeTasklet::OpCode::kCAST, RE::CodeTasklet::OpCode::kCMP_EQ, RE::CodeTasklet::OpCode::kCMP_LT, RE::CodeTasklet::OpCode::kCMP_LTE, RE::CodeTasklet::OpCode::kCMP_GT, RE::CodeTasklet::OpCode::kCMP_GTE, RE::CodeTasklet::OpCode::kJMP, RE::CodeTasklet::OpCode::kJMPT, RE::CodeTasklet::OpCode::kJMPF, RE::CodeTasklet::OpCode::kCALLMETHOD, RE::CodeTasklet::OpCode::kCALLPARENT, RE::CodeTasklet::OpCode::kCALLSTATIC, RE::CodeTasklet::OpCode::kRETURN, RE::CodeTasklet::OpCode::kSTRCAT, RE::CodeTasklet::OpCode::kPROPGET, RE::CodeTasklet::OpCode::kPROPSET, RE::CodeTasklet::OpCode::kARRAY_CREATE, RE::CodeTasklet::OpCode::kARRAY_LENGTH, RE::CodeTasklet::OpCode::kARRAY_GETELEMENT, RE::CodeTasklet::OpCode::kARRAY_SETELEMENT, RE::CodeTasklet::OpCode::kARRAY_FINDELEMENT, RE::CodeTasklet::OpCode::kARRAY_RFINDELEMENT, RE::CodeTasklet::OpCode::kIS, RE::CodeTasklet::OpCode::kSTRUCT_CREATE, RE::CodeTasklet::OpCode::kSTRUCT_GET, RE::CodeTasklet::OpCode::kSTRUCT_SET, RE::CodeTasklet::OpCode::kARRAY_FINDSTRUCT, RE::CodeTasklet::OpCode::kARRAY_RFINDSTRUCT, RE::CodeTasklet::OpCode::kARRAY_ADD, RE::CodeTasklet::OpCode::kARRAY_INSERT, RE::CodeTasklet::OpCode::kARRAY_REMOVELAST, RE::CodeTasklet::OpCode::kARRAY_REMOVE, RE::CodeTasklet::OpCode::kARRAY_CLEAR },
+	{ "kNOP", "kIADD", "kFADD", "kISUB", "kFSUB", "kIMUL", "kFMUL", "kIDIV", "kFDIV", "kIMOD", "kNOT", "kINEG", "kFNEG", "kASSIGN", "kCAST", "kCMP_EQ", "kCMP_LT", "kCMP_LTE", "kCMP_GT", "kCMP_GTE", "kJMP", "kJMPT", "kJMPF", "kCALLMETHOD", "kCALLPARENT", "kCALLSTATIC", "kRETURN", "kSTRCAT", "kPROPGET", "kPROPSET", "kARRAY_CREATE", "kARRAY_LENGTH", "kARRAY_GETELEMENT", "kARRAY_SETELEMENT", "kARRAY_FINDELEMENT", "kARRAY_RFINDELEMENT", "kIS", "kSTRUCT_CREATE", "kSTRUCT_GET", "kSTRUCT_SET", "kARRAY_FINDSTRUCT", "kARRAY_RFINDSTRUCT", "kARRAY_ADD", "kARRAY_INSERT", "kARRAY_REMOVELAST", "kARRAY_REMOVE", "kARRAY_CLEAR" }));
+
+static_assert(test::RoundTrips<RE::CodeTasklet::ResumeReason>(
+	{ RE::CodeTasklet::ResumeReason::kNotResuming, RE::CodeTasklet::ResumeReason::kNotResumingNoIncrement, RE::CodeTasklet::ResumeReason::kInitialStart, RE::CodeTasklet::ResumeReason::kFunctionReturn, RE::CodeTasklet::ResumeReason::kRetryInstruction, RE::CodeTasklet::ResumeReason::kFunctionCall },
+	{ "kNotResuming", "kNotResumingNoIncrement", "kInitialStart", "kFunctionReturn", "kRetryInstruction", "kFunctionCall" }));
+
+static_assert(test::RoundTrips<RE::ContainerMenuBase::ItemSorter::SORT_ON_FIELD>(
+	{ RE::ContainerMenuBase::ItemSorter::SORT_ON_FIELD::kAlphabetical, RE::ContainerMenuBase::ItemSorter::SORT_ON_FIELD::kDamage, RE::ContainerMenuBase::ItemSorter::SORT_ON_FIELD::kRateOfFire, RE::ContainerMenuBase::ItemSorter::SORT_ON_FIELD::kRange, RE::ContainerMenuBase::ItemSorter::SORT_ON_FIELD::kAccuracy, RE::ContainerMenuBase::ItemSorter::SORT_ON_FIELD::kValue, RE::ContainerMenuBase::ItemSorter::SORT_ON_FIELD::kWeight },
+	{ "kAlphabetical", "kDamage", "kRateOfFire", "kRange", "kAccuracy", "kValue", "kWeight" }));
+
+static_assert(test::RoundTrips<RE::DECAL_DATA_DATA::Flags>(
+	{ RE::DECAL_DATA_DATA::Flags::kNone, RE::DECAL_DATA_DATA::Flags::kNoDecalData },
+	{ "kNone", "kNoDecalData" }));
+
+static_assert(test::RoundTrips<RE::DEFAULT_OBJECT>(
+	{ RE::DEFAULT_OBJECT::kSittingAngleLimit, RE::DEFAULT_OBJECT::kAllowPlayerShout, RE::DEFAULT_OBJECT::kGold, RE::DEFAULT_OBJECT::kLockpick, RE::DEFAULT_OBJECT::kSkeletonKey, RE::DEFAULT_OBJECT::kPlayerFaction, RE::DEFAULT_OBJECT::kGuardFaction, RE::DEFAULT_OBJECT::kBattleMusic, RE::DEFAULT_OBJECT::kDeathMusic, RE::DEFAULT_OBJECT::kDungeonClearedMusic, RE::DEFAULT_OBJECT::kPlayerVoiceMale, RE::DEFAULT_OBJECT::kPlayerVoiceMaleChild, RE::DEFAULT_OBJECT::kPlayerVoiceFemale, RE::DEFAULT_OBJECT::kPlayerVoiceFemaleChild, RE::DEFAULT_OBJECT::kEatPackageDefaultFood, RE::DEFAULT_OBJECT::kVoiceEquip, RE::DEFAULT_OBJECT::kPotionEquip, RE::DEFAULT_OBJECT::kEveryActorAbility, RE::DEFAULT_OBJECT::kCommandedActorAbility, RE::DEFAULT_OBJECT::kDrugWearsOffImageSpace, RE::DEFAULT_OBJECT::kFootstepSet, RE::DEFAULT_OBJECT::kLandscapeMaterial, RE::DEFAULT_OBJECT::kDragonLandZoneMarker, RE::DEFAULT_OBJECT::kDragonCrashZoneMarker, RE::DEFAULT_OBJECT::kCombatStyle, RE::DEFAULT_OBJECT::kDefaultPackList, RE::DEFAULT_OBJECT::kWaitForDialoguePackage, RE::DEFAULT_OBJECT::kVirtualLocation, RE::DEFAULT_OBJECT::kPersistAllLocation, RE::DEFAULT_OBJECT::kPathingTestNPC, RE::DEFAULT_OBJECT::kActionSwimStateChange, RE::DEFAULT_OBJECT::kActionLook, RE::DEFAULT_OBJECT::kActionLeftAttack, RE::DEFAULT_OBJECT::kActionLeftReady, RE::DEFAULT_OBJECT::kActionLeftRelease, RE::DEFAULT_OBJECT::kActionLeftInterrupt, RE::DEFAULT_OBJECT::kActionRightAttack, RE::DEFAULT_OBJECT::kActionRightReady, RE::DEFAULT_OBJECT::kActionRightRelease, RE::DEFAULT_OBJECT::kActionRightInterrupt, RE::DEFAULT_OBJECT::kActionDualAttack, RE::DEFAULT_OBJECT::kActionDualRelease, RE::DEFAULT_OBJECT::kActionActivate, RE::DEFAULT_OBJECT::kActionJump, RE::DEFAULT_OBJECT::kActionFall, RE::DEFAULT_OBJECT::kActionLand, RE::DEFAULT_OBJECT::kActionMantle, RE::DEFAULT_OBJECT::kActionSneak, RE::DEFAULT_OBJECT::kActionVoice, RE::DEFAULT_OBJECT::kActionVoiceReady, RE::DEFAULT_OBJECT::kActionVoiceRelease, RE::DEFAULT_OBJECT::kActionVoiceInterrupt, RE::DEFAULT_OBJECT::kActionIdle, RE::DEFAULT_OBJECT::kActionSprintStart, RE::DEFAULT_OBJECT::kActionSprintStop, RE::DEFAULT_OBJECT::kActionDraw, RE::DEFAULT_OBJECT::kActionSheath, RE::DEFAULT_OBJECT::kActionLeftPowerAttack, RE::DEFAULT_OBJECT::kActionRightPowerAttack, RE::DEFAULT_OBJECT::kActionDualPowerAttack, RE::DEFAULT_OBJECT::kActionLeftSyncAttack, RE::DEFAULT_OBJECT::kActionRightSyncAttack, RE::DEFAULT_OBJECT::kActionStaggerStart, RE::DEFAULT_OBJECT::kActionBlockHit, RE::DEFAULT_OBJECT::kActionBlockAnticipate, RE::DEFAULT_OBJECT::kActionRecoil, RE::DEFAULT_OBJECT::kActionLargeRecoil, RE::DEFAULT_OBJECT::kActionBleedoutStart, RE::DEFAULT_OBJECT::kActionBleedoutStop, RE::DEFAULT_OBJECT::kActionIdleStop, RE::DEFAULT_OBJECT::kActionWardHit, RE::DEFAULT_OBJECT::kActionForceEquip, RE::DEFAULT_OBJECT::kActionShieldChange, RE::DEFAULT_OBJECT::kActionPathStart, RE::DEFAULT_OBJECT::kActionPathEnd, RE::DEFAULT_OBJECT::kActionLargeMovementDelta, RE::DEFAULT_OBJECT::kActionFlyStart, RE::DEFAULT_OBJECT::kActionFlyStop, RE::DEFAULT_OBJECT::kActionHoverStart, RE::DEFAULT_OBJECT::kActionHoverStop, RE::DEFAULT_OBJECT::kActionBumpedInto, RE::DEFAULT_OBJECT::kActionSummonedStart, RE::DEFAULT_OBJECT::kActionDialogueTalking, RE::DEFAULT_OBJECT::kActionDialogueListen, RE::DEFAULT_OBJECT::kActionDialogueListenPositive, RE::DEFAULT_OBJECT::kActionDialogueListenNegative, RE::DEFAULT_OBJECT::kActionDialogueListenQuestion, RE::DEFAULT_OBJECT::kActionDialogueListenNeutral, RE::DEFAULT_OBJECT::kActionDialogueEnter, RE::DEFAULT_OBJECT::kActionDialogueExit, RE::DEFAULT_OBJECT::kActionDeath, RE::DEFAULT_OBJECT::kActionDeathWait, RE::DEFAULT_OBJECT::kActionIdleWarn, RE::DEFAULT_OBJECT::kActionMoveStart, RE::DEFAULT_OBJECT::kActionMoveStop, RE::DEFAULT_OBJECT::kActionTurnRight, RE::DEFAULT_OBJECT::kActionTurnLeft, RE::DEFAULT_OBJECT::kActionTurnStop, RE::DEFAULT_OBJECT::kActionMoveForward, RE::DEFAULT_OBJECT::kActionMoveBackward, RE::DEFAULT_OBJECT::kActionMoveLeft, RE::DEFAULT_OBJECT::kActionMoveRight, RE::DEFAULT_OBJECT::kActionKnockdown, RE::DEFAULT_OBJECT::kActionGetUp, RE::DEFAULT_OBJECT::kActionIdleStopInstant, RE::DEFAULT_OBJECT::kActionRagdollInstant, RE::DEFAULT_OBJECT::kActionWaterwalkStart, RE::DEFAULT_OBJECT::kActionReload, RE::DEFAULT_OBJECT::kActionBoltCharge, RE::DEFAULT_OBJECT::kActionSighted, RE::DEFAULT_OBJECT::kActionSightedRelease, RE::DEFAULT_OBJECT::kActionMelee, RE::DEFAULT_OBJECT::kActionFireSingle, RE::DEFAULT_OBJECT::kActionFireCharge, RE::DEFAULT_OBJECT::kActionFireChargeHold, RE::DEFAULT_OBJECT::kActionFireAuto, RE::DEFAULT_OBJECT::kActionFireEmpty, RE::DEFAULT_OBJECT::kActionThrow, RE::DEFAULT_OBJECT::kActionEnterCover, RE::DEFAULT_OBJECT::kActionExitCover, RE::DEFAULT_OBJECT::kActionCoverSprintStart, RE::DEFAULT_OBJECT::kActionShuffle, RE::DEFAULT_OBJECT::kActionPipboy, RE::DEFAULT_OBJECT::kActionPipboyClose, RE::DEFAULT_OBJECT::kActionPipboyZoom, RE::DEFAULT_OBJECT::kActionPipboyStats, RE::DEFAULT_OBJECT::kActionPipboyInventory, RE::DEFAULT_OBJECT::kActionPipboyData, RE::DEFAULT_OBJECT::kActionPipboyMap, RE::DEFAULT_OBJECT::kActionPipboyTab, RE::DEFAULT_OBJECT::kActionPipboyTabPrevious, RE::DEFAULT_OBJECT::kActionPipboySelect, RE::DEFAULT_OBJECT::kActionPipboyRadioOn, RE::DEFAULT_OBJECT::kActionPipboyRadioOff, RE::DEFAULT_OBJECT::kActionPipboyLoadHolotape, RE::DEFAULT_OBJECT::kActionPipboyInspect, RE::DEFAULT_OBJECT::kActionNonSupportContact, RE::DEFAULT_OBJECT::kActionInteractionEnter, RE::DEFAULT_OBJECT::kActionInteractionExit, RE::DEFAULT_OBJECT::kActionInteractionExitAlternate, RE::DEFAULT_OBJECT::kActionInteractionExitQuick, RE::DEFAULT_OBJECT::kActionIntimidate, RE::DEFAULT_OBJECT::kActionGunChargeStart, RE::DEFAULT_OBJECT::kActionGunDown, RE::DEFAULT_OBJECT::kActionGunRelaxed, RE::DEFAULT_OBJECT::kActionGunAlert, RE::DEFAULT_OBJECT::kActionGunReady, RE::DEFAULT_OBJECT::kActionFlipThrow, RE::DEFAULT_OBJECT::kActionEnterCombat, RE::DEFAULT_OBJECT::kActionExitCombat, RE::DEFAULT_OBJECT::kActionLimbCritical, RE::DEFAULT_OBJECT::kActionEvade, RE::DEFAULT_OBJECT::kActionDodge, RE::DEFAULT_OBJECT::kActionAoEAttack, RE::DEFAULT_OBJECT::kActionPanic, RE::DEFAULT_OBJECT::kActionCower, RE::DEFAULT_OBJECT::kActionTunnel, RE::DEFAULT_OBJECT::kActionHide, RE::DEFAULT_OBJECT::kPickupSoundGeneric, RE::DEFAULT_OBJECT::kPutdownSoundGeneric, RE::DEFAULT_OBJECT::kPickupSoundWeapon, RE::DEFAULT_OBJECT::kPutdownSoundWeapon, RE::DEFAULT_OBJECT::kPickupSoundArmor, RE::DEFAULT_OBJECT::kPutdownSoundArmor, RE::DEFAULT_OBJECT::kPickupSoundBook, RE::DEFAULT_OBJECT::kPutdownSoundBook, RE::DEFAULT_OBJECT::kPickupSoundIngredient, RE::DEFAULT_OBJECT::kPutdownSoundIngredient, RE::DEFAULT_OBJECT::kHarvestSound, RE::DEFAULT_OBJECT::kHarvestFailedSound, RE::DEFAULT_OBJECT::kWardBreakSound, RE::DEFAULT_OBJECT::kWardAbsorbSound, RE::DEFAULT_OBJECT::kWardDeflectSound, RE::DEFAULT_OBJECT::kMagicFailSound, RE::DEFAULT_OBJECT::kShoutFailSound, RE::DEFAULT_OBJECT::kHeartbeatSoundFast, RE::DEFAULT_OBJECT::kHeartbeatSoundSlow, RE::DEFAULT_OBJECT::kImagespaceLowHealth, RE::DEFAULT_OBJECT::kSoulCapturedSound, RE::DEFAULT_OBJECT::kNoActivationSound, RE::DEFAULT_OBJECT::kMapMenuLoopingSound, RE::DEFAULT_OBJECT::kDialogueVoiceCategory, RE::DEFAULT_OBJECT::kNonDialogueVoiceCategory, RE::DEFAULT_OBJECT::kSFXToFadeInDialogueCategory, RE::DEFAULT_OBJECT::kPauseDuringMenuCategoryFade, RE::DEFAULT_OBJECT::kPauseDuringMenuCategoryImmediate, RE::DEFAULT_OBJECT::kPauseDuringLoadingMenuCategory, RE::DEFAULT_OBJECT::kMusicSoundCategory, RE::DEFAULT_OBJECT::kStatsMuteCategory, RE::DEFAULT_OBJECT::kStatsMusic, RE::DEFAULT_OBJECT::kMasterSoundCategory, RE::DEFAULT_OBJECT::kDialogueOutputModel3D, RE::DEFAULT_OBJECT::kDialogueOutputModel2D, RE::DEFAULT_OBJECT::kPlayersOutputModel1stPerson, RE::DEFAULT_OBJECT::kPlayersOutputModel3rdPerson, RE::DEFAULT_OBJECT::kInterfaceOutputModel, RE::DEFAULT_OBJECT::kReverbType, RE::DEFAULT_OBJECT::kUnderwaterLoopSound, RE::DEFAULT_OBJECT::kUnderwaterReverbType, RE::DEFAULT_OBJECT::kKeywordHorse, RE::DEFAULT_OBJECT::kKeywordUndead, RE::DEFAULT_OBJECT::kKeywordNPC, RE::DEFAULT_OBJECT::kKeywordDummyObject, RE::DEFAULT_OBJECT::kKeywordUseGeometryEmitter, RE::DEFAULT_OBJECT::kKeywordMustStop, RE::DEFAULT_OBJECT::kMaleFaceTextureSetHead, RE::DEFAULT_OBJECT::kMaleFaceTextureSetMouth, RE::DEFAULT_OBJECT::kMaleFaceTextureSetEyes, RE::DEFAULT_OBJECT::kFemaleFaceTextureSetHead, RE::DEFAULT_OBJECT::kFemaleFaceTextureSetMouth, RE::DEFAULT_OBJECT::kFemaleFaceTextureSetEyes, RE::DEFAULT_OBJECT::kImageSpaceModifierForInventoryMenu, RE::DEFAULT_OBJECT::kImageSpaceModifierForPipboyMenuInPowerArmor, RE::DEFAULT_OBJECT::kPackageTemplate, RE::DEFAULT_OBJECT::kMainMenuCell, RE::DEFAULT_OBJECT::kDefaultMovementTypeDefault, RE::DEFAULT_OBJECT::kDefaultMovementTypeSwim, RE::DEFAULT_OBJECT::kDefaultMovementTypeFly, RE::DEFAULT_OBJECT::kDefaultMovementTypeSneak, RE::DEFAULT_OBJECT::kKeywordSpecialFurniture, RE::DEFAULT_OBJECT::kKeywordFurnitureForces1stPerson, RE::DEFAULT_OBJECT::kKeywordFurnitureForces3rdPerson, RE::DEFAULT_OBJECT::kKeywordActivatorFurnitureNoPlayer, RE::DEFAULT_OBJECT::kTelekinesisGrabSound, RE::DEFAULT_OBJECT::kTelekinesisThrowSound, RE::DEFAULT_OBJECT::kWorldMapWeather, RE::DEFAULT_OBJECT::kHelpManualPC, RE::DEFAULT_OBJECT::kHelpManualXBox, RE::DEFAULT_OBJECT::kKeywordTypeAmmo, RE::DEFAULT_OBJECT::kKeywordTypeArmor, RE::DEFAULT_OBJECT::kKeywordTypeBook, RE::DEFAULT_OBJECT::kKeywordTypeIngredient, RE::DEFAULT_OBJECT::kKeywordTypeKey, RE::DEFAULT_OBJECT::kKeywordTypeMisc, RE::DEFAULT_OBJECT::kKeywordTypeSoulGem, RE::DEFAULT_OBJECT::kKeywordTypeWeapon, RE::DEFAULT_OBJECT::kKeywordTypePotion, RE::DEFAULT_OBJECT::kBaseWeaponEnchantment, RE::DEFAULT_OBJECT::kBaseArmorEnchantment, RE::DEFAULT_OBJECT::kBasePotion, RE::DEFAULT_OBJECT::kBasePoison, RE::DEFAULT_OBJECT::kKeywordDragon, RE::DEFAULT_OBJECT::kKeywordMovable, RE::DEFAULT_OBJECT::kArtObjectAbsorbEffect, RE::DEFAULT_OBJECT::kWeaponMaterialList, RE::DEFAULT_OBJECT::kArmorMaterialList, RE::DEFAULT_OBJECT::kKeywordDisallowEnchanting, RE::DEFAULT_OBJECT::kFavortravelmarkerlocation, RE::DEFAULT_OBJECT::kTeammateReadyWeapon, RE::DEFAULT_OBJECT::kKeywordHoldLocation, RE::DEFAULT_OBJECT::kKeywordCivilWarOwner, RE::DEFAULT_OBJECT::kKeywordCivilWarNeutral, RE::DEFAULT_OBJECT::kLocRefTypeCivilWarSoldier, RE::DEFAULT_OBJECT::kKeywordClearableLocation, RE::DEFAULT_OBJECT::kLocRefTypeResourceDestructible, RE::DEFAULT_OBJECT::kFormListHairColorList, RE::DEFAULT_OBJECT::kComplexSceneObject, RE::DEFAULT_OBJECT::kKeywordReusableSoulGem, RE::DEFAULT_OBJECT::kKeywordAnimal, RE::DEFAULT_OBJECT::kKeywordDaedra, RE::DEFAULT_OBJECT::kKeywordRobot, RE::DEFAULT_OBJECT::kKeywordNirnroot, RE::DEFAULT_OBJECT::kFightersGuildFaction, RE::DEFAULT_OBJECT::kMagesGuildFaction, RE::DEFAULT_OBJECT::kThievesGuildFaction, RE::DEFAULT_OBJECT::kDarkBrotherhoodFaction, RE::DEFAULT_OBJECT::kJarlFaction, RE::DEFAULT_OBJECT::kBunnyFaction, RE::DEFAULT_OBJECT::kPlayerIsVampireVariable, RE::DEFAULT_OBJECT::kRoadMarker, RE::DEFAULT_OBJECT::kKeywordScaleActorTo10, RE::DEFAULT_OBJECT::kKeywordVampire, RE::DEFAULT_OBJECT::kKeywordForge, RE::DEFAULT_OBJECT::kKeywordCookingPot, RE::DEFAULT_OBJECT::kKeywordSmelter, RE::DEFAULT_OBJECT::kKeywordTanningRack, RE::DEFAULT_OBJECT::kHelpBasicLockpickingPC, RE::DEFAULT_OBJECT::kHelpBasicLockpickingConsole, RE::DEFAULT_OBJECT::kHelpBasicForging, RE::DEFAULT_OBJECT::kHelpBasicCooking, RE::DEFAULT_OBJECT::kHelpBasicSmelting, RE::DEFAULT_OBJECT::kHelpBasicTanning, RE::DEFAULT_OBJECT::kHelpBasicObjectCreation, RE::DEFAULT_OBJECT::kHelpBasicEnchanting, RE::DEFAULT_OBJECT::kHelpBasicSmithingWeapon, RE::DEFAULT_OBJECT::kHelpBasicSmithingArmor, RE::DEFAULT_OBJECT::kHelpBasicAlchemy, RE::DEFAULT_OBJECT::kHelpBarter, RE::DEFAULT_OBJECT::kHelpLevelingup, RE::DEFAULT_OBJECT::kHelpSkillsMenu, RE::DEFAULT_OBJECT::kHelpMapMenu, RE::DEFAULT_OBJECT::kHelpJournal, RE::DEFAULT_OBJECT::kHelpLowHealth, RE::DEFAULT_OBJECT::kHelpLowMagicka, RE::DEFAULT_OBJECT::kHelpLowStamina, RE::DEFAULT_OBJECT::kHelpJail, RE::DEFAULT_OBJECT::kHelpTeamateFavor, RE::DEFAULT_OBJECT::kHelpWeaponCharge, RE::DEFAULT_OBJECT::kHelpFavorites, RE::DEFAULT_OBJECT::kKinectHelpFormList, RE::DEFAULT_OBJECT::kImagespaceLoadscreen, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialDaedric, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialDraugr, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialDraugrHoned, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialDwarven, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialEbony, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialElven, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialFalmer, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialFalmerHoned, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialGlass, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialImperial, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialIron, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialOrcish, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialSteel, RE::DEFAULT_OBJECT::kKeywordWeaponMaterialWood, RE::DEFAULT_OBJECT::kKeywordWeaponTypeBoundArrow, RE::DEFAULT_OBJECT::kKeywordArmorMaterialDaedric, RE::DEFAULT_OBJECT::kKeywordArmorMaterialDragonplate, RE::DEFAULT_OBJECT::kKeywordArmorMaterialDragonscale, RE::DEFAULT_OBJECT::kKeywordArmorMaterialDragonbone, RE::DEFAULT_OBJECT::kKeywordArmorMaterialDwarven, RE::DEFAULT_OBJECT::kKeywordArmorMaterialEbony, RE::DEFAULT_OBJECT::kKeywordArmorMaterialElven, RE::DEFAULT_OBJECT::kKeywordArmorMaterialElvenSplinted, RE::DEFAULT_OBJECT::kKeywordArmorMaterialFullLeather, RE::DEFAULT_OBJECT::kKeywordArmorMaterialGlass, RE::DEFAULT_OBJECT::kKeywordArmorMaterialHide, RE::DEFAULT_OBJECT::kKeywordArmorMaterialImperial, RE::DEFAULT_OBJECT::kKeywordArmorMaterialImperialHeavy, RE::DEFAULT_OBJECT::kKeywordArmorMaterialImperialReinforced, RE::DEFAULT_OBJECT::kKeywordArmorMaterialIron, RE::DEFAULT_OBJECT::kKeywordArmorMaterialIronBanded, RE::DEFAULT_OBJECT::kKeywordArmorMaterialOrcish, RE::DEFAULT_OBJECT::kKeywordArmorMaterialScaled, RE::DEFAULT_OBJECT::kKeywordArmorMaterialSteel, RE::DEFAULT_OBJECT::kKeywordArmorMaterialSteelPlate, RE::DEFAULT_OBJECT::kKeywordArmorMaterialStormcloak, RE::DEFAULT_OBJECT::kKeywordArmorMaterialStudded, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword01, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword02, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword03, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword04, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword05, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword06, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword07, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword08, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword09, RE::DEFAULT_OBJECT::kKeywordGenericCraftableKeyword10, RE::DEFAULT_OBJECT::kKeywordnullptrMOD, RE::DEFAULT_OBJECT::kKeywordJewelry, RE::DEFAULT_OBJECT::kKeywordCuirass, RE::DEFAULT_OBJECT::kLocalMapHidePlane, RE::DEFAULT_OBJECT::kSnowLODMaterial, RE::DEFAULT_OBJECT::kSnowLODMaterialHD, RE::DEFAULT_OBJECT::kDialogueImagespace, RE::DEFAULT_OBJECT::kDialogueFollowerQuest, RE::DEFAULT_OBJECT::kPotentialFollowerFaction, RE::DEFAULT_OBJECT::kVampireAvailablePerks, RE::DEFAULT_OBJECT::kVampireRace, RE::DEFAULT_OBJECT::kVampireSpells, RE::DEFAULT_OBJECT::kKeywordMount, RE::DEFAULT_OBJECT::kVerletCape, RE::DEFAULT_OBJECT::kFurnitureTestNPC, RE::DEFAULT_OBJECT::kKeywordConditionalExplosion, RE::DEFAULT_OBJECT::kDefaultLight1, RE::DEFAULT_OBJECT::kDefaultLight2, RE::DEFAULT_OBJECT::kDefaultLight3, RE::DEFAULT_OBJECT::kDefaultLight4, RE::DEFAULT_OBJECT::kPipboyLight, RE::DEFAULT_OBJECT::kActionBeginLoopingActivate, RE::DEFAULT_OBJECT::kActionEndLoopingActivate, RE::DEFAULT_OBJECT::kWorkshopPlayerOwnership, RE::DEFAULT_OBJECT::kQuestMarkerFollower, RE::DEFAULT_OBJECT::kQuestMarkerLocation, RE::DEFAULT_OBJECT::kQuestMarkerEnemy, RE::DEFAULT_OBJECT::kQuestMarkerEnemyAbove, RE::DEFAULT_OBJECT::kQuestMarkerEnemyBelow, RE::DEFAULT_OBJECT::kWorkshopMiscItemKeyword, RE::DEFAULT_OBJECT::kHeavyWeaponItemKeyword, RE::DEFAULT_OBJECT::kMineItemKeyword, RE::DEFAULT_OBJECT::kGrenadeItemKeyword, RE::DEFAULT_OBJECT::kChemItemKeyword, RE::DEFAULT_OBJECT::kAlcoholItemKeyword, RE::DEFAULT_OBJECT::kFoodItemKeyword, RE::DEFAULT_OBJECT::kRepairKitItemKeyword, RE::DEFAULT_OBJECT::kMedbagitemKeyword, RE::DEFAULT_OBJECT::kGlovesitemKeyword, RE::DEFAULT_OBJECT::kHelmetitemkeyword, RE::DEFAULT_OBJECT::kClothesitemkeyword, RE::DEFAULT_OBJECT::kTotal },
+	{ "kSittingAngleLimit", "kAllowPlayerShout", "kGold", "kLockpick", "kSkeletonKey", "kPlayerFaction", "kGuardFaction", "kBattleMusic", "kDeathMusic", "kDungeonClearedMusic", "kPlayerVoiceMale", "kPlayerVoiceMaleChild", "kPlayerVoiceFemale", "kPlayerVoiceFemaleChild", "kEatPackageDefaultFood", "kVoiceEquip", "kPotionEquip", "kEveryActorAbility", "kCommandedActorAbility", "kDrugWearsOffImageSpace", "kFootstepSet", "kLandscapeMaterial", "kDragonLandZoneMarker", "kDragonCrashZoneMarker", "kCombatStyle", "kDefaultPackList", "kWaitForDialoguePackage", "kVirtualLocation", "kPersistAllLocation", "kPathingTestNPC", "kActionSwimStateChange", "kActionLook", "kActionLeftAttack", "kActionLeftReady", "kActionLeftRelease", "kActionLeftInterrupt", "kActionRightAttack", "kActionRightReady", "kActionRightRelease", "kActionRightInterrupt", "kActionDualAttack", "kActionDualRelease", "kActionActivate", "kActionJump", "kActionFall", "kActionLand", "kActionMantle", "kActionSneak", "kActionVoice", "kActionVoiceReady", "kActionVoiceRelease", "kActionVoiceInterrupt", "kActionIdle", "kActionSprintStart", "kActionSprintStop", "kActionDraw", "kActionSheath", "kActionLeftPowerAttack", "kActionRightPowerAttack", "kActionDualPowerAttack", "kActionLeftSyncAttack", "kActionRightSyncAttack", "kActionStaggerStart", "kActionBlockHit", "kActionBlockAnticipate", "kActionRecoil", "kActionLargeRecoil", "kActionBleedoutStart", "kActionBleedoutStop", "kActionIdleStop", "kActionWardHit", "kActionForceEquip", "kActionShieldChange", "kActionPathStart", "kActionPathEnd", "kActionLargeMovementDelta", "kActionFlyStart", "kActionFlyStop", "kActionHoverStart", "kActionHoverStop", "kActionBumpedInto", "kActionSummonedStart", "kActionDialogueTalking", "kActionDialogueListen", "kActionDialogueListenPositive", "kActionDialogueListenNegative", "kActionDialogueListenQuestion", "kActionDialogueListenNeutral", "kActionDialogueEnter", "kActionDialogueExit", "kActionDeath", "kActionDeathWait", "kActionIdleWarn", "kActionMoveStart", "kActionMoveStop", "kActionTurnRight", "kActionTurnLeft", "kActionTurnStop", "kActionMoveForward", "kActionMoveBackward", "kActionMoveLeft", "kActionMoveRight", "kActionKnockdown", "kActionGetUp", "kActionIdleStopInstant", "kActionRagdollInstant", "kActionWaterwalkStart", "kActionReload", "kActionBoltCharge", "kActionSighted", "kActionSightedRelease", "kActionMelee", "kActionFireSingle", "kActionFireCharge", "kActionFireChargeHold", "kActionFireAuto", "kActionFireEmpty", "kActionThrow", "kActionEnterCover", "kActionExitCover", "kActionCoverSprintStart", "kActionShuffle", "kActionPipboy", "kActionPipboyClose", "kActionPipboyZoom", "kActionPipboyStats", "kActionPipboyInventory", "kActionPipboyData", "kActionPipboyMap", "kActionPipboyTab", "kActionPipboyTabPrevious", "kActionPipboySelect", "kActionPipboyRadioOn", "kActionPipboyRadioOff", "kActionPipboyLoadHolotape", "kActionPipboyInspect", "kActionNonSupportContact", "kActionInteractionEnter", "kActionInteractionExit", "kActionInteractionExitAlternate", "kActionInteractionExitQuick", "kActionIntimidate", "kActionGunChargeStart", "kActionGunDown", "kActionGunRelaxed", "kActionGunAlert", "kActionGunReady", "kActionFlipThrow", "kActionEnterCombat", "kActionExitCombat", "kActionLimbCritical", "kActionEvade", "kActionDodge", "kActionAoEAttack", "kActionPanic", "kActionCower", "kActionTunnel", "kActionHide", "kPickupSoundGeneric", "kPutdownSoundGeneric", "kPickupSoundWeapon", "kPutdownSoundWeapon", "kPickupSoundArmor", "kPutdownSoundArmor", "kPickupSoundBook", "kPutdownSoundBook", "kPickupSoundIngredient", "kPutdownSoundIngredient", "kHarvestSound", "kHarvestFailedSound", "kWardBreakSound", "kWardAbsorbSound", "kWardDeflectSound", "kMagicFailSound", "kShoutFailSound", "kHeartbeatSoundFast", "kHeartbeatSoundSlow", "kImagespaceLowHealth", "kSoulCapturedSound", "kNoActivationSound", "kMapMenuLoopingSound", "kDialogueVoiceCategory", "kNonDialogueVoiceCategory", "kSFXToFadeInDialogueCategory", "kPauseDuringMenuCategoryFade", "kPauseDuringMenuCategoryImmediate", "kPauseDuringLoadingMenuCategory", "kMusicSoundCategory", "kStatsMuteCategory", "kStatsMusic", "kMasterSoundCategory", "kDialogueOutputModel3D", "kDialogueOutputModel2D", "kPlayersOutputModel1stPerson", "kPlayersOutputModel3rdPerson", "kInterfaceOutputModel", "kReverbType", "kUnderwaterLoopSound", "kUnderwaterReverbType", "kKeywordHorse", "kKeywordUndead", "kKeywordNPC", "kKeywordDummyObject", "kKeywordUseGeometryEmitter", "kKeywordMustStop", "kMaleFaceTextureSetHead", "kMaleFaceTextureSetMouth", "kMaleFaceTextureSetEyes", "kFemaleFaceTextureSetHead", "kFemaleFaceTextureSetMouth", "kFemaleFaceTextureSetEyes", "kImageSpaceModifierForInventoryMenu", "kImageSpaceModifierForPipboyMenuInPowerArmor", "kPackageTemplate", "kMainMenuCell", "kDefaultMovementTypeDefault", "kDefaultMovementTypeSwim", "kDefaultMovementTypeFly", "kDefaultMovementTypeSneak", "kKeywordSpecialFurniture", "kKeywordFurnitureForces1stPerson", "kKeywordFurnitureForces3rdPerson", "kKeywordActivatorFurnitureNoPlayer", "kTelekinesisGrabSound", "kTelekinesisThrowSound", "kWorldMapWeather", "kHelpManualPC", "kHelpManualXBox", "kKeywordTypeAmmo", "kKeywordTypeArmor", "kKeywordTypeBook", "kKeywordTypeIngredient", "kKeywordTypeKey", "kKeywordTypeMisc", "kKeywordTypeSoulGem", "kKeywordTypeWeapon", "kKeywordTypePotion", "kBaseWeaponEnchantment", "kBaseArmorEnchantment", "kBasePotion", "kBasePoison", "kKeywordDragon", "kKeywordMovable", "kArtObjectAbsorbEffect", "kWeaponMaterialList", "kArmorMaterialList", "kKeywordDisallowEnchanting", "kFavortravelmarkerlocation", "kTeammateReadyWeapon", "kKeywordHoldLocation", "kKeywordCivilWarOwner", "kKeywordCivilWarNeutral", "kLocRefTypeCivilWarSoldier", "kKeywordClearableLocation", "kLocRefTypeResourceDestructible", "kFormListHairColorList", "kComplexSceneObject", "kKeywordReusableSoulGem", "kKeywordAnimal", "kKeywordDaedra", "kKeywordRobot", "kKeywordNirnroot", "kFightersGuildFaction", "kMagesGuildFaction", "kThievesGuildFaction", "kDarkBrotherhoodFaction", "kJarlFaction", "kBunnyFaction", "kPlayerIsVampireVariable", "kRoadMarker", "kKeywordScaleActorTo10", "kKeywordVampire", "kKeywordForge", "kKeywordCookingPot", "kKeywordSmelter", "kKeywordTanningRack", "kHelpBasicLockpickingPC", "kHelpBasicLockpickingConsole", "kHelpBasicForging", "kHelpBasicCooking", "kHelpBasicSmelting", "kHelpBasicTanning", "kHelpBasicObjectCreation", "kHelpBasicEnchanting", "kHelpBasicSmithingWeapon", "kHelpBasicSmithingArmor", "kHelpBasicAlchemy", "kHelpBarter", "kHelpLevelingup", "kHelpSkillsMenu", "kHelpMapMenu", "kHelpJournal", "kHelpLowHealth", "kHelpLowMagicka", "kHelpLowStamina", "kHelpJail", "kHelpTeamateFavor", "kHelpWeaponCharge", "kHelpFavorites", "kKinectHelpFormList", "kImagespaceLoadscreen", "kKeywordWeaponMaterialDaedric", "kKeywordWeaponMaterialDraugr", "kKeywordWeaponMaterialDraugrHoned", "kKeywordWeaponMaterialDwarven", "kKeywordWeaponMaterialEbony", "kKeywordWeaponMaterialElven", "kKeywordWeaponMaterialFalmer", "kKeywordWeaponMaterialFalmerHoned", "kKeywordWeaponMaterialGlass", "kKeywordWeaponMaterialImperial", "kKeywordWeaponMaterialIron", "kKeywordWeaponMaterialOrcish", "kKeywordWeaponMaterialSteel", "kKeywordWeaponMaterialWood", "kKeywordWeaponTypeBoundArrow", "kKeywordArmorMaterialDaedric", "kKeywordArmorMaterialDragonplate", "kKeywordArmorMaterialDragonscale", "kKeywordArmorMaterialDragonbone", "kKeywordArmorMaterialDwarven", "kKeywordArmorMaterialEbony", "kKeywordArmorMaterialElven", "kKeywordArmorMaterialElvenSplinted", "kKeywordArmorMaterialFullLeather", "kKeywordArmorMaterialGlass", "kKeywordArmorMaterialHide", "kKeywordArmorMaterialImperial", "kKeywordArmorMaterialImperialHeavy", "kKeywordArmorMaterialImperialReinforced", "kKeywordArmorMaterialIron", "kKeywordArmorMaterialIronBanded", "kKeywordArmorMaterialOrcish", "kKeywordArmorMaterialScaled", "kKeywordArmorMaterialSteel", "kKeywordArmorMaterialSteelPlate", "kKeywordArmorMaterialStormcloak", "kKeywordArmorMaterialStudded", "kKeywordGenericCraftableKeyword01", "kKeywordGenericCraftableKeyword02", "kKeywordGenericCraftableKeyword03", "kKeywordGenericCraftableKeyword04", "kKeywordGenericCraftableKeyword05", "kKeywordGenericCraftableKeyword06", "kKeywordGenericCraftableKeyword07", "kKeywordGenericCraftableKeyword08", "kKeywordGenericCraftableKeyword09", "kKeywordGenericCraftableKeyword10", "kKeywordnullptrMOD", "kKeywordJewelry", "kKeywordCuirass", "kLocalMapHidePlane", "kSnowLODMaterial", "kSnowLODMaterialHD", "kDialogueImagespace", "kDialogueFollowerQuest", "kPotentialFollowerFaction", "kVampireAvailablePerks", "kVampireRace", "kVampireSpells", "kKeywordMount", "kVerletCape", "kFurnitureTestNPC", "kKeywordConditionalExplosion", "kDefaultLight1", "kDefaultLight2", "kDefaultLight3", "kDefaultLight4", "kPipboyLight", "kActionBeginLoopingActivate", "kActionEndLoopingActivate", "kWorkshopPlayerOwnership", "kQuestMarkerFollower", "kQuestMarkerLocation", "kQuestMarkerEnemy", "kQuestMarkerEnemyAbove", "kQuestMarkerEnemyBelow", "kWorkshopMiscItemKeyword", "kHeavyWeaponItemKeyword", "kMineItemKeyword", "kGrenadeItemKeyword", "kChemItemKeyword", "kAlcoholItemKeyword", "kFoodItemKeyword", "kRepairKitItemKeyword", "kMedbagitemKeyword", "kGlovesitemKeyword", "kHelmetitemkeyword", "kClothesitemkeyword", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::DEFAULT_OBJECT_TYPE>(
+	{ RE::DEFAULT_OBJECT_TYPE::kMisc, RE::DEFAULT_OBJECT_TYPE::kFacegen, RE::DEFAULT_OBJECT_TYPE::kMovement, RE::DEFAULT_OBJECT_TYPE::kActions, RE::DEFAULT_OBJECT_TYPE::kItems, RE::DEFAULT_OBJECT_TYPE::kSounds, RE::DEFAULT_OBJECT_TYPE::kKeywords },
+	{ "kMisc", "kFacegen", "kMovement", "kActions", "kItems", "kSounds", "kKeywords" }));
+
+static_assert(test::RoundTrips<RE::DIALOGUE_SUBTYPE>(
+	{ RE::DIALOGUE_SUBTYPE::kPlayerDialogue_Custom, RE::DIALOGUE_SUBTYPE::kPlayerDialogue_Force_Greet, RE::DIALOGUE_SUBTYPE::kPlayerDialogue_Player_Rumor, RE::DIALOGUE_SUBTYPE::kPlayerDialogue_End, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Custom, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Call, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Follow, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Move, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Attack, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Inspect, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Retrieve, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Stay, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Release, RE::DIALOGUE_SUBTYPE::kCommandDialogue_ShowRelationships, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Reject, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Heal, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Assign, RE::DIALOGUE_SUBTYPE::kCommandDialogue_Enter, RE::DIALOGUE_SUBTYPE::kSceneDialogue_Custom, RE::DIALOGUE_SUBTYPE::kFavor_Show, RE::DIALOGUE_SUBTYPE::kFavor_Agree, RE::DIALOGUE_SUBTYPE::kFavor_Refuse, RE::DIALOGUE_SUBTYPE::kFavor_Exit_State, RE::DIALOGUE_SUBTYPE::kFavor_Morality_Refuse, RE::DIALOGUE_SUBTYPE::kFavor_Trade, RE::DIALOGUE_SUBTYPE::kFavor_Pathing_Reject, RE::DIALOGUE_SUBTYPE::kCombat_Attack, RE::DIALOGUE_SUBTYPE::kCombat_Power_Attack, RE::DIALOGUE_SUBTYPE::kCombat_Bash, RE::DIALOGUE_SUBTYPE::kCombat_Hit, RE::DIALOGUE_SUBTYPE::kCombat_Flee, RE::DIALOGUE_SUBTYPE::kCombat_Bleed_Out, RE::DIALOGUE_SUBTYPE::kCombat_Avoid_Threat, RE::DIALOGUE_SUBTYPE::kCombat_Death, RE::DIALOGUE_SUBTYPE::kCombat_Block, RE::DIALOGUE_SUBTYPE::kCombat_Taunt, RE::DIALOGUE_SUBTYPE::kCombat_Throw_Grenade, RE::DIALOGUE_SUBTYPE::kCombat_Ally_Killed, RE::DIALOGUE_SUBTYPE::kCombat_Order_Fallback, RE::DIALOGUE_SUBTYPE::kCombat_Order_Advance, RE::DIALOGUE_SUBTYPE::kCombat_Order_Flank, RE::DIALOGUE_SUBTYPE::kCombat_Order_Take_Cover, RE::DIALOGUE_SUBTYPE::kCombat_Fallback, RE::DIALOGUE_SUBTYPE::kCombat_Request_Support, RE::DIALOGUE_SUBTYPE::kCombat_Provide_Support, RE::DIALOGUE_SUBTYPE::kCombat_Crippled_Limb, RE::DIALOGUE_SUBTYPE::kCombat_Paired_Attack, RE::DIALOGUE_SUBTYPE::kCombat_Steal, RE::DIALOGUE_SUBTYPE::kCombat_Yield, RE::DIALOGUE_SUBTYPE::kCombat_Accept_Yield, RE::DIALOGUE_SUBTYPE::kCombat_Pickpocket, RE::DIALOGUE_SUBTYPE::kCombat_Assault, RE::DIALOGUE_SUBTYPE::kCombat_Murder, RE::DIALOGUE_SUBTYPE::kCombat_Assault_NC, RE::DIALOGUE_SUBTYPE::kCombat_Murder_NC, RE::DIALOGUE_SUBTYPE::kCombat_Pickpocket_NC, RE::DIALOGUE_SUBTYPE::kCombat_Steal_NC, RE::DIALOGUE_SUBTYPE::kCombat_Trespass_NC, RE::DIALOGUE_SUBTYPE::kCombat_Guard_Trespass, RE::DIALOGUE_SUBTYPE::kCombat_Unused, RE::DIALOGUE_SUBTYPE::kCombat_Voice_Power_Start, RE::DIALOGUE_SUBTYPE::kCombat_Voice_Power_Start_Short, RE::DIALOGUE_SUBTYPE::kCombat_Voice_Power_Start_Long, RE::DIALOGUE_SUBTYPE::kCombat_Voice_Power_End_Short, RE::DIALOGUE_SUBTYPE::kCombat_Voice_Power_End_Long, RE::DIALOGUE_SUBTYPE::kCombat_Voice_Power_End, RE::DIALOGUE_SUBTYPE::kDetection_Alert_Idle, RE::DIALOGUE_SUBTYPE::kDetection_Lost_Idle, RE::DIALOGUE_SUBTYPE::kDetection_Normal_To_Alert, RE::DIALOGUE_SUBTYPE::kDetection_Normal_To_Combat, RE::DIALOGUE_SUBTYPE::kDetection_Normal_To_Lost, RE::DIALOGUE_SUBTYPE::kDetection_Alert_To_Normal, RE::DIALOGUE_SUBTYPE::kDetection_Alert_To_Combat, RE::DIALOGUE_SUBTYPE::kDetection_Combat_To_Normal, RE::DIALOGUE_SUBTYPE::kDetection_Combat_To_Lost, RE::DIALOGUE_SUBTYPE::kDetection_Lost_To_Normal, RE::DIALOGUE_SUBTYPE::kDetection_Lost_To_Combat, RE::DIALOGUE_SUBTYPE::kDetection_Detect_Friend_Die, RE::DIALOGUE_SUBTYPE::kService_Refusal, RE::DIALOGUE_SUBTYPE::kService_Repair, RE::DIALOGUE_SUBTYPE::kService_Travel, RE::DIALOGUE_SUBTYPE::kService_Training, RE::DIALOGUE_SUBTYPE::kService_Barter_Exit, RE::DIALOGUE_SUBTYPE::kService_Repair_Exit, RE::DIALOGUE_SUBTYPE::kService_Recharge, RE::DIALOGUE_SUBTYPE::kService_Recharge_Exit, RE::DIALOGUE_SUBTYPE::kService_Training_Exit, RE::DIALOGUE_SUBTYPE::kMisc_Observe_Combat, RE::DIALOGUE_SUBTYPE::kMisc_Corpse, RE::DIALOGUE_SUBTYPE::kMisc_Time_To_Go, RE::DIALOGUE_SUBTYPE::kMisc_Goodbye, RE::DIALOGUE_SUBTYPE::kMisc_Hello, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Swing_Melee_Weapon, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Shoot_Bow, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Z_Key_Object, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Jumping, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Knocking_Over_Objects, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Destroy_Object, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Stand_On_Furniture, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Locked_Object, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Pickpocket, RE::DIALOGUE_SUBTYPE::kMisc_Pursue_Idle, RE::DIALOGUE_SUBTYPE::kMisc_InfoData, RE::DIALOGUE_SUBTYPE::kMisc_SceneChoice, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Cast_Projectile_Spell, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Cast_Self_Spell, RE::DIALOGUE_SUBTYPE::kMisc_Player_Action_Shout, RE::DIALOGUE_SUBTYPE::kMisc_Idle, RE::DIALOGUE_SUBTYPE::kMisc_Breath_Sprint_Sound, RE::DIALOGUE_SUBTYPE::kMisc_Breath_Enter_Bow_Zoom_Sound, RE::DIALOGUE_SUBTYPE::kMisc_Breath_Exit_Bow_Zoom_Sound, RE::DIALOGUE_SUBTYPE::kMisc_Actor_Collide_With_Actor, RE::DIALOGUE_SUBTYPE::kMisc_Player_Iron_Sights, RE::DIALOGUE_SUBTYPE::kMisc_Out_Off_Breath_Sound, RE::DIALOGUE_SUBTYPE::kMisc_Combat_Grunt, RE::DIALOGUE_SUBTYPE::kMisc_Breath_Leave_Water, RE::DIALOGUE_SUBTYPE::kMisc_Impatient_Positive, RE::DIALOGUE_SUBTYPE::kMisc_Impatient_Negative, RE::DIALOGUE_SUBTYPE::kMisc_Impatient_Neutral, RE::DIALOGUE_SUBTYPE::kMisc_Impatient_Question, RE::DIALOGUE_SUBTYPE::kMisc_Waiting_Player_Input, RE::DIALOGUE_SUBTYPE::kMisc_Greeting, RE::DIALOGUE_SUBTYPE::kMisc_Player_Activate_Door, RE::DIALOGUE_SUBTYPE::kMisc_Player_Activate_Terminals, RE::DIALOGUE_SUBTYPE::kMisc_Player_Activate_Furniture, RE::DIALOGUE_SUBTYPE::kMisc_Player_Activate_Activators, RE::DIALOGUE_SUBTYPE::kMisc_Player_Activate_Container, RE::DIALOGUE_SUBTYPE::kMisc_Player_Aquire_Featured_Item },
+	{ "kPlayerDialogue_Custom", "kPlayerDialogue_Force_Greet", "kPlayerDialogue_Player_Rumor", "kPlayerDialogue_End", "kCommandDialogue_Custom", "kCommandDialogue_Call", "kCommandDialogue_Follow", "kCommandDialogue_Move", "kCommandDialogue_Attack", "kCommandDialogue_Inspect", "kCommandDialogue_Retrieve", "kCommandDialogue_Stay", "kCommandDialogue_Release", "kCommandDialogue_ShowRelationships", "kCommandDialogue_Reject", "kCommandDialogue_Heal", "kCommandDialogue_Assign", "kCommandDialogue_Enter", "kSceneDialogue_Custom", "kFavor_Show", "kFavor_Agree", "kFavor_Refuse", "kFavor_Exit_State", "kFavor_Morality_Refuse", "kFavor_Trade", "kFavor_Pathing_Reject", "kCombat_Attack", "kCombat_Power_Attack", "kCombat_Bash", "kCombat_Hit", "kCombat_Flee", "kCombat_Bleed_Out", "kCombat_Avoid_Threat", "kCombat_Death", "kCombat_Block", "kCombat_Taunt", "kCombat_Throw_Grenade", "kCombat_Ally_Killed", "kCombat_Order_Fallback", "kCombat_Order_Advance", "kCombat_Order_Flank", "kCombat_Order_Take_Cover", "kCombat_Fallback", "kCombat_Request_Support", "kCombat_Provide_Support", "kCombat_Crippled_Limb", "kCombat_Paired_Attack", "kCombat_Steal", "kCombat_Yield", "kCombat_Accept_Yield", "kCombat_Pickpocket", "kCombat_Assault", "kCombat_Murder", "kCombat_Assault_NC", "kCombat_Murder_NC", "kCombat_Pickpocket_NC", "kCombat_Steal_NC", "kCombat_Trespass_NC", "kCombat_Guard_Trespass", "kCombat_Unused", "kCombat_Voice_Power_Start", "kCombat_Voice_Power_Start_Short", "kCombat_Voice_Power_Start_Long", "kCombat_Voice_Power_End_Short", "kCombat_Voice_Power_End_Long", "kCombat_Voice_Power_End", "kDetection_Alert_Idle", "kDetection_Lost_Idle", "kDetection_Normal_To_Alert", "kDetection_Normal_To_Combat", "kDetection_Normal_To_Lost", "kDetection_Alert_To_Normal", "kDetection_Alert_To_Combat", "kDetection_Combat_To_Normal", "kDetection_Combat_To_Lost", "kDetection_Lost_To_Normal", "kDetection_Lost_To_Combat", "kDetection_Detect_Friend_Die", "kService_Refusal", "kService_Repair", "kService_Travel", "kService_Training", "kService_Barter_Exit", "kService_Repair_Exit", "kService_Recharge", "kService_Recharge_Exit", "kService_Training_Exit", "kMisc_Observe_Combat", "kMisc_Corpse", "kMisc_Time_To_Go", "kMisc_Goodbye", "kMisc_Hello", "kMisc_Player_Action_Swing_Melee_Weapon", "kMisc_Player_Action_Shoot_Bow", "kMisc_Player_Action_Z_Key_Object", "kMisc_Player_Action_Jumping", "kMisc_Player_Action_Knocking_Over_Objects", "kMisc_Player_Action_Destroy_Object", "kMisc_Player_Action_Stand_On_Furniture", "kMisc_Player_Action_Locked_Object", "kMisc_Player_Action_Pickpocket", "kMisc_Pursue_Idle", "kMisc_InfoData", "kMisc_SceneChoice", "kMisc_Player_Action_Cast_Projectile_Spell", "kMisc_Player_Action_Cast_Self_Spell", "kMisc_Player_Action_Shout", "kMisc_Idle", "kMisc_Breath_Sprint_Sound", "kMisc_Breath_Enter_Bow_Zoom_Sound", "kMisc_Breath_Exit_Bow_Zoom_Sound", "kMisc_Actor_Collide_With_Actor", "kMisc_Player_Iron_Sights", "kMisc_Out_Off_Breath_Sound", "kMisc_Combat_Grunt", "kMisc_Breath_Leave_Water", "kMisc_Impatient_Positive", "kMisc_Impatient_Negative", "kMisc_Impatient_Neutral", "kMisc_Impatient_Question", "kMisc_Waiting_Player_Input", "kMisc_Greeting", "kMisc_Player_Activate_Door", "kMisc_Player_Activate_Terminals", "kMisc_Player_Activate_Furniture", "kMisc_Player_Activate_Activators", "kMisc_Player_Activate_Container", "kMisc_Player_Aquire_Featured_Item" }));
+
+static_assert(test::RoundTrips<RE::DIALOGUE_TYPE>(
+	{ RE::DIALOGUE_TYPE::kPlayerDialogue, RE::DIALOGUE_TYPE::kCommandDialogue, RE::DIALOGUE_TYPE::kSceneDialogue, RE::DIALOGUE_TYPE::kCombat, RE::DIALOGUE_TYPE::kFavors, RE::DIALOGUE_TYPE::kDetection, RE::DIALOGUE_TYPE::kService, RE::DIALOGUE_TYPE::kMiscellaneous },
+	{ "kPlayerDialogue", "kCommandDialogue", "kSceneDialogue", "kCombat", "kFavors", "kDetection", "kService", "kMiscellaneous" }));
+
+static_assert(test::RoundTrips<RE::DIFFICULTY_LEVEL>(
+	{ RE::DIFFICULTY_LEVEL::kVeryEasy, RE::DIFFICULTY_LEVEL::kLow, RE::DIFFICULTY_LEVEL::kEasy, RE::DIFFICULTY_LEVEL::kNormal, RE::DIFFICULTY_LEVEL::kHard, RE::DIFFICULTY_LEVEL::kVeryHard, RE::DIFFICULTY_LEVEL::kSurvival, RE::DIFFICULTY_LEVEL::kTrueSurvival, RE::DIFFICULTY_LEVEL::kHigh },
+	{ "kVeryEasy", "kLow", "kEasy", "kNormal", "kHard", "kVeryHard", "kSurvival", "kTrueSurvival", "kHigh" }));
+
+static_assert(test::RoundTrips<RE::DIRECTION_VAL>(
+	{ RE::DIRECTION_VAL::kNone, RE::DIRECTION_VAL::kUp, RE::DIRECTION_VAL::kRight, RE::DIRECTION_VAL::kDown, RE::DIRECTION_VAL::kLeft },
+	{ "kNone", "kUp", "kRight", "kDown", "kLeft" }));
+
+static_assert(test::RoundTrips<RE::Delivery>(
+	{ RE::Delivery::kSelf, RE::Delivery::kTouch, RE::Delivery::kAimed, RE::Delivery::kTargetActor, RE::Delivery::kTargetLocation },
+	{ "kSelf", "kTouch", "kAimed", "kTargetActor", "kTargetLocation" }));
+
+static_assert(test::RoundTrips<RE::ENCOUNTER_ZONE_DATA::Flags>(
+	{ RE::ENCOUNTER_ZONE_DATA::Flags::kNeverReset, RE::ENCOUNTER_ZONE_DATA::Flags::kMatchPCBelowMin, RE::ENCOUNTER_ZONE_DATA::Flags::kDisableCombatBoundary, RE::ENCOUNTER_ZONE_DATA::Flags::kWorkshopZone },
+	{ "kNeverReset", "kMatchPCBelowMin", "kDisableCombatBoundary", "kWorkshopZone" }));
+
+static_assert(test::RoundTrips<RE::ENUM_COMPARISON_CONDITION>(
+	{ RE::ENUM_COMPARISON_CONDITION::kEqual, RE::ENUM_COMPARISON_CONDITION::kNotEqual, RE::ENUM_COMPARISON_CONDITION::kGreaterThan, RE::ENUM_COMPARISON_CONDITION::kGreaterThanEqual, RE::ENUM_COMPARISON_CONDITION::kLessThan, RE::ENUM_COMPARISON_CONDITION::kLessThanEqual },
+	{ "kEqual", "kNotEqual", "kGreaterThan", "kGreaterThanEqual", "kLessThan", "kLessThanEqual" }));
+
+static_assert(test::RoundTrips<RE::ENUM_FORMTYPE>(
+	{ RE::ENUM_FORMTYPE::kNONE, RE::ENUM_FORMTYPE::kTES4, RE::ENUM_FORMTYPE::kGRUP, RE::ENUM_FORMTYPE::kGMST, RE::ENUM_FORMTYPE::kKYWD, RE::ENUM_FORMTYPE::kLCRT, RE::ENUM_FORMTYPE::kAACT, RE::ENUM_FORMTYPE::kTRNS, RE::ENUM_FORMTYPE::kCMPO, RE::ENUM_FORMTYPE::kTXST, RE::ENUM_FORMTYPE::kMICN, RE::ENUM_FORMTYPE::kGLOB, RE::ENUM_FORMTYPE::kDMGT, RE::ENUM_FORMTYPE::kCLAS, RE::ENUM_FORMTYPE::kFACT, RE::ENUM_FORMTYPE::kHDPT, RE::ENUM_FORMTYPE::kEYES, RE::ENUM_FORMTYPE::kRACE, RE::ENUM_FORMTYPE::kSOUN, RE::ENUM_FORMTYPE::kASPC, RE::ENUM_FORMTYPE::kSKIL, RE::ENUM_FORMTYPE::kMGEF, RE::ENUM_FORMTYPE::kSCPT, RE::ENUM_FORMTYPE::kLTEX, RE::ENUM_FORMTYPE::kENCH, RE::ENUM_FORMTYPE::kSPEL, RE::ENUM_FORMTYPE::kSCRL, RE::ENUM_FORMTYPE::kACTI, RE::ENUM_FORMTYPE::kTACT, RE::ENUM_FORMTYPE::kARMO, RE::ENUM_FORMTYPE::kBOOK, RE::ENUM_FORMTYPE::kCONT, RE::ENUM_FORMTYPE::kDOOR, RE::ENUM_FORMTYPE::kINGR, RE::ENUM_FORMTYPE::kLIGH, RE::ENUM_FORMTYPE::kMISC, RE::ENUM_FORMTYPE::kSTAT, RE::ENUM_FORMTYPE::kSCOL, RE::ENUM_FORMTYPE::kMSTT, RE::ENUM_FORMTYPE::kGRAS, RE::ENUM_FORMTYPE::kTREE, RE::ENUM_FORMTYPE::kFLOR, RE::ENUM_FORMTYPE::kFURN, RE::ENUM_FORMTYPE::kWEAP, RE::ENUM_FORMTYPE::kAMMO, RE::ENUM_FORMTYPE::kNPC_, RE::ENUM_FORMTYPE::kLVLN, RE::ENUM_FORMTYPE::kKEYM, RE::ENUM_FORMTYPE::kALCH, RE::ENUM_FORMTYPE::kIDLM, RE::ENUM_FORMTYPE::kNOTE, RE::ENUM_FORMTYPE::kPROJ, RE::ENUM_FORMTYPE::kHAZD, RE::ENUM_FORMTYPE::kBNDS, RE::ENUM_FORMTYPE::kSLGM, RE::ENUM_FORMTYPE::kTERM, RE::ENUM_FORMTYPE::kLVLI, RE::ENUM_FORMTYPE::kWTHR, RE::ENUM_FORMTYPE::kCLMT, RE::ENUM_FORMTYPE::kSPGD, RE::ENUM_FORMTYPE::kRFCT, RE::ENUM_FORMTYPE::kREGN, RE::ENUM_FORMTYPE::kNAVI, RE::ENUM_FORMTYPE::kCELL, RE::ENUM_FORMTYPE::kREFR, RE::ENUM_FORMTYPE::kACHR, RE::ENUM_FORMTYPE::kPMIS, RE::ENUM_FORMTYPE::kPARW, RE::ENUM_FORMTYPE::kPGRE, RE::ENUM_FORMTYPE::kPBEA, RE::ENUM_FORMTYPE::kPFLA, RE::ENUM_FORMTYPE::kPCON, RE::ENUM_FORMTYPE::kPBAR, RE::ENUM_FORMTYPE::kPHZD, RE::ENUM_FORMTYPE::kWRLD, RE::ENUM_FORMTYPE::kLAND, RE::ENUM_FORMTYPE::kNAVM, RE::ENUM_FORMTYPE::kTLOD, RE::ENUM_FORMTYPE::kDIAL, RE::ENUM_FORMTYPE::kINFO, RE::ENUM_FORMTYPE::kQUST, RE::ENUM_FORMTYPE::kIDLE, RE::ENUM_FORMTYPE::kPACK, RE::ENUM_FORMTYPE::kCSTY, RE::ENUM_FORMTYPE::kLSCR, RE::ENUM_FORMTYPE::kLVSP, RE::ENUM_FORMTYPE::kANIO, RE::ENUM_FORMTYPE::kWATR, RE::ENUM_FORMTYPE::kEFSH, RE::ENUM_FORMTYPE::kTOFT, RE::ENUM_FORMTYPE::kEXPL, RE::ENUM_FORMTYPE::kDEBR, RE::ENUM_FORMTYPE::kIMGS, RE::ENUM_FORMTYPE::kIMAD, RE::ENUM_FORMTYPE::kFLST, RE::ENUM_FORMTYPE::kPERK, RE::ENUM_FORMTYPE::kBPTD, RE::ENUM_FORMTYPE::kADDN, RE::ENUM_FORMTYPE::kAVIF, RE::ENUM_FORMTYPE::kCAMS, RE::ENUM_FORMTYPE::kCPTH, RE::ENUM_FORMTYPE::kVTYP, RE::ENUM_FORMTYPE::kMATT, RE::ENUM_FORMTYPE::kIPCT, RE::ENUM_FORMTYPE::kIPDS, RE::ENUM_FORMTYPE::kARMA, RE::ENUM_FORMTYPE::kECZN, RE::ENUM_FORMTYPE::kLCTN, RE::ENUM_FORMTYPE::kMESG, RE::ENUM_FORMTYPE::kRGDL, RE::ENUM_FORMTYPE::kDOBJ, RE::ENUM_FORMTYPE::kDFOB, RE::ENUM_FORMTYPE::kLGTM, RE::ENUM_FORMTYPE::kMUSC, RE::ENUM_FORMTYPE::kFSTP, RE::ENUM_FORMTYPE::kFSTS, RE::ENUM_FORMTYPE::kSMBN, RE::ENUM_FORMTYPE::kSMQN, RE::ENUM_FORMTYPE::kSMEN, RE::ENUM_FORMTYPE::kDLBR, RE::ENUM_FORMTYPE::kMUST, RE::ENUM_FORMTYPE::kDLVW, RE::ENUM_FORMTYPE::kWOOP, RE::ENUM_FORMTYPE::kSHOU, RE::ENUM_FORMTYPE::kEQUP, RE::ENUM_FORMTYPE::kRELA, RE::ENUM_FORMTYPE::kSCEN, RE::ENUM_FORMTYPE::kASTP, RE::ENUM_FORMTYPE::kOTFT, RE::ENUM_FORMTYPE::kARTO, RE::ENUM_FORMTYPE::kMATO, RE::ENUM_FORMTYPE::kMOVT, RE::ENUM_FORMTYPE::kSNDR, RE::ENUM_FORMTYPE::kDUAL, RE::ENUM_FORMTYPE::kSNCT, RE::ENUM_FORMTYPE::kSOPM, RE::ENUM_FORMTYPE::kCOLL, RE::ENUM_FORMTYPE::kCLFM, RE::ENUM_FORMTYPE::kREVB, RE::ENUM_FORMTYPE::kPKIN, RE::ENUM_FORMTYPE::kRFGP, RE::ENUM_FORMTYPE::kAMDL, RE::ENUM_FORMTYPE::kLAYR, RE::ENUM_FORMTYPE::kCOBJ, RE::ENUM_FORMTYPE::kOMOD, RE::ENUM_FORMTYPE::kMSWP, RE::ENUM_FORMTYPE::kZOOM, RE::ENUM_FORMTYPE::kINNR, RE::ENUM_FORMTYPE::kKSSM, RE::ENUM_FORMTYPE::kAECH, RE::ENUM_FORMTYPE::kSCCO, RE::ENUM_FORMTYPE::kAORU, RE::ENUM_FORMTYPE::kSCSN, RE::ENUM_FORMTYPE::kSTAG, RE::ENUM_FORMTYPE::kNOCM, RE::ENUM_FORMTYPE::kLENS, RE::ENUM_FORMTYPE::kLSPR, RE::ENUM_FORMTYPE::kGDRY, RE::ENUM_FORMTYPE::kOVIS, RE::ENUM_FORMTYPE::kTotal, RE::ENUM_FORMTYPE::kActiveEffect },
+	{ "kNONE", "kTES4", "kGRUP", "kGMST", "kKYWD", "kLCRT", "kAACT", "kTRNS", "kCMPO", "kTXST", "kMICN", "kGLOB", "kDMGT", "kCLAS", "kFACT", "kHDPT", "kEYES", "kRACE", "kSOUN", "kASPC", "kSKIL", "kMGEF", "kSCPT", "kLTEX", "kENCH", "kSPEL", "kSCRL", "kACTI", "kTACT", "kARMO", "kBOOK", "kCONT", "kDOOR", "kINGR", "kLIGH", "kMISC", "kSTAT", "kSCOL", "kMSTT", "kGRAS", "kTREE", "kFLOR", "kFURN", "kWEAP", "kAMMO", "kNPC_", "kLVLN", "kKEYM", "kALCH", "kIDLM", "kNOTE", "kPROJ", "kHAZD", "kBNDS", "kSLGM", "kTERM", "kLVLI", "kWTHR", "kCLMT", "kSPGD", "kRFCT", "kREGN", "kNAVI", "kCELL", "kREFR", "kACHR", "kPMIS", "kPARW", "kPGRE", "kPBEA", "kPFLA", "kPCON", "kPBAR", "kPHZD", "kWRLD", "kLAND", "kNAVM", "kTLOD", "kDIAL", "kINFO", "kQUST", "kIDLE", "kPACK", "kCSTY", "kLSCR", "kLVSP", "kANIO", "kWATR", "kEFSH", "kTOFT", "kEXPL", "kDEBR", "kIMGS", "kIMAD", "kFLST", "kPERK", "kBPTD", "kADDN", "kAVIF", "kCAMS", "kCPTH", "kVTYP", "kMATT", "kIPCT", "kIPDS", "kARMA", "kECZN", "kLCTN", "kMESG", "kRGDL", "kDOBJ", "kDFOB", "kLGTM", "kMUSC", "kFSTP", "kFSTS", "kSMBN", "kSMQN", "kSMEN", "kDLBR", "kMUST", "kDLVW", "kWOOP", "kSHOU", "kEQUP", "kRELA", "kSCEN", "kASTP", "kOTFT", "kARTO", "kMATO", "kMOVT", "kSNDR", "kDUAL", "kSNCT", "kSOPM", "kCOLL", "kCLFM", "kREVB", "kPKIN", "kRFGP", "kAMDL", "kLAYR", "kCOBJ", "kOMOD", "kMSWP", "kZOOM", "kINNR", "kKSSM", "kAECH", "kSCCO", "kAORU", "kSCSN", "kSTAG", "kNOCM", "kLENS", "kLSPR", "kGDRY", "kOVIS", "kTotal", "kActiveEffect" }));
+
+static_assert(test::RoundTrips<RE::ENUM_LOD_MULT>(
+	{ RE::ENUM_LOD_MULT::kNone, RE::ENUM_LOD_MULT::kObjects, RE::ENUM_LOD_MULT::kItems, RE::ENUM_LOD_MULT::kActors, RE::ENUM_LOD_MULT::kTrees, RE::ENUM_LOD_MULT::kLandscape, RE::ENUM_LOD_MULT::kDistantLOD, RE::ENUM_LOD_MULT::kActorBodyPart, RE::ENUM_LOD_MULT::kRenderedMenu, RE::ENUM_LOD_MULT::kInvisible, RE::ENUM_LOD_MULT::kSkyCell },
+	{ "kNone", "kObjects", "kItems", "kActors", "kTrees", "kLandscape", "kDistantLOD", "kActorBodyPart", "kRenderedMenu", "kInvisible", "kSkyCell" }));
+
+static_assert(test::RoundTrips<RE::EXTRA_DATA_TYPE>(
+	{ RE::EXTRA_DATA_TYPE::kNone, RE::EXTRA_DATA_TYPE::kHavok, RE::EXTRA_DATA_TYPE::kCell3D, RE::EXTRA_DATA_TYPE::kWaterType, RE::EXTRA_DATA_TYPE::kRegionList, RE::EXTRA_DATA_TYPE::kSeenData, RE::EXTRA_DATA_TYPE::kEditorID, RE::EXTRA_DATA_TYPE::kCellMusicType, RE::EXTRA_DATA_TYPE::kSkyRegion, RE::EXTRA_DATA_TYPE::kCellMidLowProcess, RE::EXTRA_DATA_TYPE::kCellDetachTime, RE::EXTRA_DATA_TYPE::kPersistentCell, RE::EXTRA_DATA_TYPE::kKeywords, RE::EXTRA_DATA_TYPE::kAction, RE::EXTRA_DATA_TYPE::kStartingPosition, RE::EXTRA_DATA_TYPE::kAnim, RE::EXTRA_DATA_TYPE::kHavokAnim, RE::EXTRA_DATA_TYPE::kBiped, RE::EXTRA_DATA_TYPE::kUsedMarkers, RE::EXTRA_DATA_TYPE::kDistantData, RE::EXTRA_DATA_TYPE::kRagdollData, RE::EXTRA_DATA_TYPE::kCellPrevisRefs, RE::EXTRA_DATA_TYPE::kInitActions, RE::EXTRA_DATA_TYPE::kEssentialProtected, RE::EXTRA_DATA_TYPE::kPackagesStartLoc, RE::EXTRA_DATA_TYPE::kPackage, RE::EXTRA_DATA_TYPE::kTrespassPackage, RE::EXTRA_DATA_TYPE::kRunOncePackages, RE::EXTRA_DATA_TYPE::kReferenceHandle, RE::EXTRA_DATA_TYPE::kFollower, RE::EXTRA_DATA_TYPE::kLevCreaMod, RE::EXTRA_DATA_TYPE::kGhost, RE::EXTRA_DATA_TYPE::kOriginalReference, RE::EXTRA_DATA_TYPE::kOwnership, RE::EXTRA_DATA_TYPE::kGlobal, RE::EXTRA_DATA_TYPE::kRank, RE::EXTRA_DATA_TYPE::kCount, RE::EXTRA_DATA_TYPE::kHealth, RE::EXTRA_DATA_TYPE::kRangeDistOverride, RE::EXTRA_DATA_TYPE::kTimeLeft, RE::EXTRA_DATA_TYPE::kCharge, RE::EXTRA_DATA_TYPE::kLight, RE::EXTRA_DATA_TYPE::kLock, RE::EXTRA_DATA_TYPE::kTeleport, RE::EXTRA_DATA_TYPE::kMapMarker, RE::EXTRA_DATA_TYPE::kLeveledCreature, RE::EXTRA_DATA_TYPE::kLevelItem, RE::EXTRA_DATA_TYPE::kScale, RE::EXTRA_DATA_TYPE::kSeed, RE::EXTRA_DATA_TYPE::kMagicCaster, RE::EXTRA_DATA_TYPE::kMagicTarget, RE::EXTRA_DATA_TYPE::kMasterFileCell, RE::EXTRA_DATA_TYPE::kPlayerCrimeList, RE::EXTRA_DATA_TYPE::kObjectInstance, RE::EXTRA_DATA_TYPE::kEnableStateParent, RE::EXTRA_DATA_TYPE::kEnableStateChildren, RE::EXTRA_DATA_TYPE::kItemDropper, RE::EXTRA_DATA_TYPE::kDroppedItemList, RE::EXTRA_DATA_TYPE::kTeleportMarker, RE::EXTRA_DATA_TYPE::kInactivePowerArmor, RE::EXTRA_DATA_TYPE::kSavedHavokData, RE::EXTRA_DATA_TYPE::kCannotWear, RE::EXTRA_DATA_TYPE::kPoison, RE::EXTRA_DATA_TYPE::kMagicLight, RE::EXTRA_DATA_TYPE::kLastFinishedSequence, RE::EXTRA_DATA_TYPE::kSavedAnimation, RE::EXTRA_DATA_TYPE::kNorthRotation, RE::EXTRA_DATA_TYPE::kSpawnCount, RE::EXTRA_DATA_TYPE::kFriendHits, RE::EXTRA_DATA_TYPE::kHeadTrackTarget, RE::EXTRA_DATA_TYPE::kBoundArmor, RE::EXTRA_DATA_TYPE::kRefractionProperty, RE::EXTRA_DATA_TYPE::kStartingWorldOrCell, RE::EXTRA_DATA_TYPE::kFavorite, RE::EXTRA_DATA_TYPE::kEditorRef3DData, RE::EXTRA_DATA_TYPE::kEditorRefMoveData, RE::EXTRA_DATA_TYPE::kInfoGeneralTopic, RE::EXTRA_DATA_TYPE::kNoRumors, RE::EXTRA_DATA_TYPE::kSound, RE::EXTRA_DATA_TYPE::kTerminalState, RE::EXTRA_DATA_TYPE::kLinkedRef, RE::EXTRA_DATA_TYPE::kLinkedRefChildren, RE::EXTRA_DATA_TYPE::kActivateRef, RE::EXTRA_DATA_TYPE::kActivateRefChildren, RE::EXTRA_DATA_TYPE::kTalkToPlayer, RE::EXTRA_DATA_TYPE::kObjectHealth, RE::EXTRA_DATA_TYPE::kImageSpace, RE::EXTRA_DATA_TYPE::kNavmeshPortal, RE::EXTRA_DATA_TYPE::kModelSwap, RE::EXTRA_DATA_TYPE::kRadius, RE::EXTRA_DATA_TYPE::kRadiation, RE::EXTRA_DATA_TYPE::kFactionChanges, RE::EXTRA_DATA_TYPE::kDismemberedLimbs, RE::EXTRA_DATA_TYPE::kActorCause, RE::EXTRA_DATA_TYPE::kMultibound, RE::EXTRA_DATA_TYPE::kMultiboundData, RE::EXTRA_DATA_TYPE::kMultiboundRef, RE::EXTRA_DATA_TYPE::kReflectedRefs, RE::EXTRA_DATA_TYPE::kReflectorRefs, RE::EXTRA_DATA_TYPE::kEmittanceSource, RE::EXTRA_DATA_TYPE::kRadioData, RE::EXTRA_DATA_TYPE::kCombatStyle, RE::EXTRA_DATA_TYPE::kLinkColorPair, RE::EXTRA_DATA_TYPE::kPrimitive, RE::EXTRA_DATA_TYPE::kOpenCloseActivateRef, RE::EXTRA_DATA_TYPE::kAnimNoteReceiver, RE::EXTRA_DATA_TYPE::kAmmo, RE::EXTRA_DATA_TYPE::kPatrolRefData, RE::EXTRA_DATA_TYPE::kPackageData, RE::EXTRA_DATA_TYPE::kOcclusionShape, RE::EXTRA_DATA_TYPE::kCollisionData, RE::EXTRA_DATA_TYPE::kSayOnceADayTopicInfo, RE::EXTRA_DATA_TYPE::kEncounterZone, RE::EXTRA_DATA_TYPE::kSayToTopicInfo, RE::EXTRA_DATA_TYPE::kOcclusionPlaneRefData, RE::EXTRA_DATA_TYPE::kPortalRefData, RE::EXTRA_DATA_TYPE::kPortal, RE::EXTRA_DATA_TYPE::kRoom, RE::EXTRA_DATA_TYPE::kGodRays, RE::EXTRA_DATA_TYPE::kRoomRefData, RE::EXTRA_DATA_TYPE::kGuardedRefData, RE::EXTRA_DATA_TYPE::kCreatureAwakeSound, RE::EXTRA_DATA_TYPE::kWaterZoneMap, RE::EXTRA_DATA_TYPE::kHorse, RE::EXTRA_DATA_TYPE::kIgnoredBySandbox, RE::EXTRA_DATA_TYPE::kCellAcousticSpace, RE::EXTRA_DATA_TYPE::kReservedMarkers, RE::EXTRA_DATA_TYPE::kCellTransCount, RE::EXTRA_DATA_TYPE::kWaterLightRefs, RE::EXTRA_DATA_TYPE::kLitWaterRefs, RE::EXTRA_DATA_TYPE::kRadioRepeater, RE::EXTRA_DATA_TYPE::kActivateLoopSound, RE::EXTRA_DATA_TYPE::kPatrolRefInUseData, RE::EXTRA_DATA_TYPE::kAshpileRef, RE::EXTRA_DATA_TYPE::kCreatureMovementSound, RE::EXTRA_DATA_TYPE::kFollowerSwimBreadcrumbs, RE::EXTRA_DATA_TYPE::kAliasInstanceArray, RE::EXTRA_DATA_TYPE::kLocation, RE::EXTRA_DATA_TYPE::kMasterLocation, RE::EXTRA_DATA_TYPE::kLocationRefType, RE::EXTRA_DATA_TYPE::kPromotedRef, RE::EXTRA_DATA_TYPE::kAnimSequencer, RE::EXTRA_DATA_TYPE::kOutfitItem, RE::EXTRA_DATA_TYPE::kEditorLocation, RE::EXTRA_DATA_TYPE::kLeveledItemBase, RE::EXTRA_DATA_TYPE::kLightData, RE::EXTRA_DATA_TYPE::kScene, RE::EXTRA_DATA_TYPE::kBadPosition, RE::EXTRA_DATA_TYPE::kHeadTrackingWeight, RE::EXTRA_DATA_TYPE::kFromAlias, RE::EXTRA_DATA_TYPE::kShouldWear, RE::EXTRA_DATA_TYPE::kFavorCost, RE::EXTRA_DATA_TYPE::kAttachArrows3D, RE::EXTRA_DATA_TYPE::kTextDisplayData, RE::EXTRA_DATA_TYPE::kAlphaCutoff, RE::EXTRA_DATA_TYPE::kEnchantment, RE::EXTRA_DATA_TYPE::kSoul, RE::EXTRA_DATA_TYPE::kForcedTarget, RE::EXTRA_DATA_TYPE::kSoundOutput, RE::EXTRA_DATA_TYPE::kUniqueID, RE::EXTRA_DATA_TYPE::kFlags, RE::EXTRA_DATA_TYPE::kRefrPath, RE::EXTRA_DATA_TYPE::kDecalGroup, RE::EXTRA_DATA_TYPE::kLockList, RE::EXTRA_DATA_TYPE::kForcedLandingMarker, RE::EXTRA_DATA_TYPE::kLargeRefOwnerCells, RE::EXTRA_DATA_TYPE::kCellWaterEnvMap, RE::EXTRA_DATA_TYPE::kCellGrassData, RE::EXTRA_DATA_TYPE::kTeleportName, RE::EXTRA_DATA_TYPE::kActorInteraction, RE::EXTRA_DATA_TYPE::kWaterData, RE::EXTRA_DATA_TYPE::kWaterCurrentZoneData, RE::EXTRA_DATA_TYPE::kAttachRef, RE::EXTRA_DATA_TYPE::kAttachRefChildren, RE::EXTRA_DATA_TYPE::kGroupConstraint, RE::EXTRA_DATA_TYPE::kScriptedAnimDependence, RE::EXTRA_DATA_TYPE::kCachedScale, RE::EXTRA_DATA_TYPE::kRaceData, RE::EXTRA_DATA_TYPE::kGIDBuffer, RE::EXTRA_DATA_TYPE::kMissingRefIDs, RE::EXTRA_DATA_TYPE::kBendableSplineParams, RE::EXTRA_DATA_TYPE::kReferenceGroup, RE::EXTRA_DATA_TYPE::kLayer, RE::EXTRA_DATA_TYPE::kMovementController, RE::EXTRA_DATA_TYPE::kReferenceCharacterController, RE::EXTRA_DATA_TYPE::kMaterialSwap, RE::EXTRA_DATA_TYPE::kInstanceData, RE::EXTRA_DATA_TYPE::kPowerArmor, RE::EXTRA_DATA_TYPE::kAcousticParent, RE::EXTRA_DATA_TYPE::kInputEnableLayer, RE::EXTRA_DATA_TYPE::kProjectedDecalRef, RE::EXTRA_DATA_TYPE::kWorkshop, RE::EXTRA_DATA_TYPE::kRadioReceiver, RE::EXTRA_DATA_TYPE::kCulledBone, RE::EXTRA_DATA_TYPE::kActorValueStorage, RE::EXTRA_DATA_TYPE::kDirectAtTarget, RE::EXTRA_DATA_TYPE::kActivateText, RE::EXTRA_DATA_TYPE::kCellCombinedRefs, RE::EXTRA_DATA_TYPE::kObjectBreakable, RE::EXTRA_DATA_TYPE::kSavedDynamicIdles, RE::EXTRA_DATA_TYPE::kIgnoredAttractKeywords, RE::EXTRA_DATA_TYPE::kModRank, RE::EXTRA_DATA_TYPE::kInteriorLODWorldspace, RE::EXTRA_DATA_TYPE::kActorBoneScaleMap, RE::EXTRA_DATA_TYPE::kActorFXPickNodes, RE::EXTRA_DATA_TYPE::kPowerArmorPreload, RE::EXTRA_DATA_TYPE::kAnimGraphPreload, RE::EXTRA_DATA_TYPE::kAnimSounds, RE::EXTRA_DATA_TYPE::kPowerLinks, RE::EXTRA_DATA_TYPE::kSavedUnrecoverableSubgraphs, RE::EXTRA_DATA_TYPE::kRefWeaponSounds, RE::EXTRA_DATA_TYPE::kRefInvestedGold, RE::EXTRA_DATA_TYPE::kRefFurnitureEntryData, RE::EXTRA_DATA_TYPE::kVoiceType, RE::EXTRA_DATA_TYPE::kTotal },
+	{ "kNone", "kHavok", "kCell3D", "kWaterType", "kRegionList", "kSeenData", "kEditorID", "kCellMusicType", "kSkyRegion", "kCellMidLowProcess", "kCellDetachTime", "kPersistentCell", "kKeywords", "kAction", "kStartingPosition", "kAnim", "kHavokAnim", "kBiped", "kUsedMarkers", "kDistantData", "kRagdollData", "kCellPrevisRefs", "kInitActions", "kEssentialProtected", "kPackagesStartLoc", "kPackage", "kTrespassPackage", "kRunOncePackages", "kReferenceHandle", "kFollower", "kLevCreaMod", "kGhost", "kOriginalReference", "kOwnership", "kGlobal", "kRank", "kCount", "kHealth", "kRangeDistOverride", "kTimeLeft", "kCharge", "kLight", "kLock", "kTeleport", "kMapMarker", "kLeveledCreature", "kLevelItem", "kScale", "kSeed", "kMagicCaster", "kMagicTarget", "kMasterFileCell", "kPlayerCrimeList", "kObjectInstance", "kEnableStateParent", "kEnableStateChildren", "kItemDropper", "kDroppedItemList", "kTeleportMarker", "kInactivePowerArmor", "kSavedHavokData", "kCannotWear", "kPoison", "kMagicLight", "kLastFinishedSequence", "kSavedAnimation", "kNorthRotation", "kSpawnCount", "kFriendHits", "kHeadTrackTarget", "kBoundArmor", "kRefractionProperty", "kStartingWorldOrCell", "kFavorite", "kEditorRef3DData", "kEditorRefMoveData", "kInfoGeneralTopic", "kNoRumors", "kSound", "kTerminalState", "kLinkedRef", "kLinkedRefChildren", "kActivateRef", "kActivateRefChildren", "kTalkToPlayer", "kObjectHealth", "kImageSpace", "kNavmeshPortal", "kModelSwap", "kRadius", "kRadiation", "kFactionChanges", "kDismemberedLimbs", "kActorCause", "kMultibound", "kMultiboundData", "kMultiboundRef", "kReflectedRefs", "kReflectorRefs", "kEmittanceSource", "kRadioData", "kCombatStyle", "kLinkColorPair", "kPrimitive", "kOpenCloseActivateRef", "kAnimNoteReceiver", "kAmmo", "kPatrolRefData", "kPackageData", "kOcclusionShape", "kCollisionData", "kSayOnceADayTopicInfo", "kEncounterZone", "kSayToTopicInfo", "kOcclusionPlaneRefData", "kPortalRefData", "kPortal", "kRoom", "kGodRays", "kRoomRefData", "kGuardedRefData", "kCreatureAwakeSound", "kWaterZoneMap", "kHorse", "kIgnoredBySandbox", "kCellAcousticSpace", "kReservedMarkers", "kCellTransCount", "kWaterLightRefs", "kLitWaterRefs", "kRadioRepeater", "kActivateLoopSound", "kPatrolRefInUseData", "kAshpileRef", "kCreatureMovementSound", "kFollowerSwimBreadcrumbs", "kAliasInstanceArray", "kLocation", "kMasterLocation", "kLocationRefType", "kPromotedRef", "kAnimSequencer", "kOutfitItem", "kEditorLocation", "kLeveledItemBase", "kLightData", "kScene", "kBadPosition", "kHeadTrackingWeight", "kFromAlias", "kShouldWear", "kFavorCost", "kAttachArrows3D", "kTextDisplayData", "kAlphaCutoff", "kEnchantment", "kSoul", "kForcedTarget", "kSoundOutput", "kUniqueID", "kFlags", "kRefrPath", "kDecalGroup", "kLockList", "kForcedLandingMarker", "kLargeRefOwnerCells", "kCellWaterEnvMap", "kCellGrassData", "kTeleportName", "kActorInteraction", "kWaterData", "kWaterCurrentZoneData", "kAttachRef", "kAttachRefChildren", "kGroupConstraint", "kScriptedAnimDependence", "kCachedScale", "kRaceData", "kGIDBuffer", "kMissingRefIDs", "kBendableSplineParams", "kReferenceGroup", "kLayer", "kMovementController", "kReferenceCharacterController", "kMaterialSwap", "kInstanceData", "kPowerArmor", "kAcousticParent", "kInputEnableLayer", "kProjectedDecalRef", "kWorkshop", "kRadioReceiver", "kCulledBone", "kActorValueStorage", "kDirectAtTarget", "kActivateText", "kCellCombinedRefs", "kObjectBreakable", "kSavedDynamicIdles", "kIgnoredAttractKeywords", "kModRank", "kInteriorLODWorldspace", "kActorBoneScaleMap", "kActorFXPickNodes", "kPowerArmorPreload", "kAnimGraphPreload", "kAnimSounds", "kPowerLinks", "kSavedUnrecoverableSubgraphs", "kRefWeaponSounds", "kRefInvestedGold", "kRefFurnitureEntryData", "kVoiceType", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::EffectArchetypes::ArchetypeID>(
+	{ RE::EffectArchetypes::ArchetypeID::kNone, RE::EffectArchetypes::ArchetypeID::kValueModifier, RE::EffectArchetypes::ArchetypeID::kScript, RE::EffectArchetypes::ArchetypeID::kDispel, RE::EffectArchetypes::ArchetypeID::kCureDisease, RE::EffectArchetypes::ArchetypeID::kAbsorb, RE::EffectArchetypes::ArchetypeID::kDualValueModifier, RE::EffectArchetypes::ArchetypeID::kCalm, RE::EffectArchetypes::ArchetypeID::kDemoralize, RE::EffectArchetypes::ArchetypeID::kFrenzy, RE::EffectArchetypes::ArchetypeID::kDisarm, RE::EffectArchetypes::ArchetypeID::kCommandSummoned, RE::EffectArchetypes::ArchetypeID::kInvisibility, RE::EffectArchetypes::ArchetypeID::kLight, RE::EffectArchetypes::ArchetypeID::kDarkness, RE::EffectArchetypes::ArchetypeID::kNightEye, RE::EffectArchetypes::ArchetypeID::kLock, RE::EffectArchetypes::ArchetypeID::kOpen, RE::EffectArchetypes::ArchetypeID::kBoundWeapon, RE::EffectArchetypes::ArchetypeID::kSummonCreature, RE::EffectArchetypes::ArchetypeID::kDetectLife, RE::EffectArchetypes::ArchetypeID::kTelekinesis, RE::EffectArchetypes::ArchetypeID::kParalyze, RE::EffectArchetypes::ArchetypeID::kReanimate, RE::EffectArchetypes::ArchetypeID::kSoulTrap, RE::EffectArchetypes::ArchetypeID::kTurnUndead, RE::EffectArchetypes::ArchetypeID::kGuide, RE::EffectArchetypes::ArchetypeID::kUnused01, RE::EffectArchetypes::ArchetypeID::kCureParalysis, RE::EffectArchetypes::ArchetypeID::kCureAddiction, RE::EffectArchetypes::ArchetypeID::kCurePoison, RE::EffectArchetypes::ArchetypeID::kConcussion, RE::EffectArchetypes::ArchetypeID::kStimpak, RE::EffectArchetypes::ArchetypeID::kAccumulatingMagnitude, RE::EffectArchetypes::ArchetypeID::kStagger, RE::EffectArchetypes::ArchetypeID::kPeakValueModifier, RE::EffectArchetypes::ArchetypeID::kCloak, RE::EffectArchetypes::ArchetypeID::kUnused02, RE::EffectArchetypes::ArchetypeID::kSlowTime, RE::EffectArchetypes::ArchetypeID::kRally, RE::EffectArchetypes::ArchetypeID::kEnhanceWeapon, RE::EffectArchetypes::ArchetypeID::kSpawnHazard, RE::EffectArchetypes::ArchetypeID::kEtherealize, RE::EffectArchetypes::ArchetypeID::kBanish, RE::EffectArchetypes::ArchetypeID::kSpawnScriptedRef, RE::EffectArchetypes::ArchetypeID::kDisguise, RE::EffectArchetypes::ArchetypeID::kDamage, RE::EffectArchetypes::ArchetypeID::kImmunity, RE::EffectArchetypes::ArchetypeID::kPermanentReanimate, RE::EffectArchetypes::ArchetypeID::kJetpack, RE::EffectArchetypes::ArchetypeID::kChameleon },
+	{ "kNone", "kValueModifier", "kScript", "kDispel", "kCureDisease", "kAbsorb", "kDualValueModifier", "kCalm", "kDemoralize", "kFrenzy", "kDisarm", "kCommandSummoned", "kInvisibility", "kLight", "kDarkness", "kNightEye", "kLock", "kOpen", "kBoundWeapon", "kSummonCreature", "kDetectLife", "kTelekinesis", "kParalyze", "kReanimate", "kSoulTrap", "kTurnUndead", "kGuide", "kUnused01", "kCureParalysis", "kCureAddiction", "kCurePoison", "kConcussion", "kStimpak", "kAccumulatingMagnitude", "kStagger", "kPeakValueModifier", "kCloak", "kUnused02", "kSlowTime", "kRally", "kEnhanceWeapon", "kSpawnHazard", "kEtherealize", "kBanish", "kSpawnScriptedRef", "kDisguise", "kDamage", "kImmunity", "kPermanentReanimate", "kJetpack", "kChameleon" }));
+
+static_assert(test::RoundTrips<RE::EffectSetting::EffectSettingData::Flags>(
+	{ RE::EffectSetting::EffectSettingData::Flags::kNone, RE::EffectSetting::EffectSettingData::Flags::kHostile, RE::EffectSetting::EffectSettingData::Flags::kRecover, RE::EffectSetting::EffectSettingData::Flags::kDetrimental, RE::EffectSetting::EffectSettingData::Flags::kSnapToNavMesh, RE::EffectSetting::EffectSettingData::Flags::kNoHitEvent, RE::EffectSetting::EffectSettingData::Flags::kDispelWithKeywords, RE::EffectSetting::EffectSettingData::Flags::kNoDuration, RE::EffectSetting::EffectSettingData::Flags::kNoMagnitude, RE::EffectSetting::EffectSettingData::Flags::kNoArea, RE::EffectSetting::EffectSettingData::Flags::kFXPersist, RE::EffectSetting::EffectSettingData::Flags::kGoryVisuals, RE::EffectSetting::EffectSettingData::Flags::kHideInUI, RE::EffectSetting::EffectSettingData::Flags::kNoRecast, RE::EffectSetting::EffectSettingData::Flags::kPowerAffectsMagnitude, RE::EffectSetting::EffectSettingData::Flags::kPowerAffectsDuration, RE::EffectSetting::EffectSettingData::Flags::kPainless, RE::EffectSetting::EffectSettingData::Flags::kNoHitEffect, RE::EffectSetting::EffectSettingData::Flags::kNoDeathDispel },
+	{ "kNone", "kHostile", "kRecover", "kDetrimental", "kSnapToNavMesh", "kNoHitEvent", "kDispelWithKeywords", "kNoDuration", "kNoMagnitude", "kNoArea", "kFXPersist", "kGoryVisuals", "kHideInUI", "kNoRecast", "kPowerAffectsMagnitude", "kPowerAffectsDuration", "kPainless", "kNoHitEffect", "kNoDeathDispel" }));
+
+static_assert(test::RoundTrips<RE::EffectSetting::RecordFlags::RecordFlag>(
+	{ RE::EffectSetting::RecordFlags::RecordFlag::kDeleted, RE::EffectSetting::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::EnchantmentItem::Flags>(
+	{ RE::EnchantmentItem::Flags::kNone, RE::EnchantmentItem::Flags::kCostOverride, RE::EnchantmentItem::Flags::kFoodItem, RE::EnchantmentItem::Flags::kExtendDuration },
+	{ "kNone", "kCostOverride", "kFoodItem", "kExtendDuration" }));
+
+static_assert(test::RoundTrips<RE::EnchantmentItem::RecordFlags::RecordFlag>(
+	{ RE::EnchantmentItem::RecordFlags::RecordFlag::kDeleted, RE::EnchantmentItem::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::ErrorCode>(
+	{ RE::ErrorCode::kNone, RE::ErrorCode::kNotExist, RE::ErrorCode::kInvalidPath, RE::ErrorCode::kFileError, RE::ErrorCode::kInvalidType, RE::ErrorCode::kMemoryError, RE::ErrorCode::kBusy, RE::ErrorCode::kInvalidParam, RE::ErrorCode::kUnsupported },
+	{ "kNone", "kNotExist", "kInvalidPath", "kFileError", "kInvalidType", "kMemoryError", "kBusy", "kInvalidParam", "kUnsupported" }));
+
+static_assert(test::RoundTrips<RE::ErrorLogger::Severity>(
+	{ RE::ErrorLogger::Severity::kInfo, RE::ErrorLogger::Severity::kWarning, RE::ErrorLogger::Severity::kError, RE::ErrorLogger::Severity::kFatal },
+	{ "kInfo", "kWarning", "kError", "kFatal" }));
+
+static_assert(test::RoundTrips<RE::ExamineConfirmMenu::CONFIRM_TYPE>(
+	{ RE::ExamineConfirmMenu::CONFIRM_TYPE::kSimple, RE::ExamineConfirmMenu::CONFIRM_TYPE::kBuild, RE::ExamineConfirmMenu::CONFIRM_TYPE::kScrap, RE::ExamineConfirmMenu::CONFIRM_TYPE::kRepairFailure },
+	{ "kSimple", "kBuild", "kScrap", "kRepairFailure" }));
+
+static_assert(test::RoundTrips<RE::Explosion::Flags>(
+	{ RE::Explosion::Flags::kNone, RE::Explosion::Flags::kIgnoreImageSpaceSwap, RE::Explosion::Flags::kInWater },
+	{ "kNone", "kIgnoreImageSpaceSwap", "kInWater" }));
+
+static_assert(test::RoundTrips<RE::ExtraTextDisplayData::DisplayDataType>(
+	{ RE::ExtraTextDisplayData::DisplayDataType::kUninitialized, RE::ExtraTextDisplayData::DisplayDataType::kCustomName },
+	{ "kUninitialized", "kCustomName" }));
+
+static_assert(test::RoundTrips<RE::FACTION_DATA::Flags>(
+	{ RE::FACTION_DATA::Flags::kNone, RE::FACTION_DATA::Flags::kHiddenFromNPC, RE::FACTION_DATA::Flags::kSpecialCombat, RE::FACTION_DATA::Flags::kPlayerIsExpelled, RE::FACTION_DATA::Flags::kPlayerIsEnemy, RE::FACTION_DATA::Flags::kTrackCrime, RE::FACTION_DATA::Flags::kIgnoresCrimes_Murder, RE::FACTION_DATA::Flags::kIgnoresCrimes_Assault, RE::FACTION_DATA::Flags::kIgnoresCrimes_Stealing, RE::FACTION_DATA::Flags::kIgnoresCrimes_Trespass, RE::FACTION_DATA::Flags::kDoNotReportCrimesAgainstMembers, RE::FACTION_DATA::Flags::kCrimeGold_UseDefaults, RE::FACTION_DATA::Flags::kIgnoresCrimes_Pickpocket, RE::FACTION_DATA::Flags::kVendor, RE::FACTION_DATA::Flags::kCanBeOwner },
+	{ "kNone", "kHiddenFromNPC", "kSpecialCombat", "kPlayerIsExpelled", "kPlayerIsEnemy", "kTrackCrime", "kIgnoresCrimes_Murder", "kIgnoresCrimes_Assault", "kIgnoresCrimes_Stealing", "kIgnoresCrimes_Trespass", "kDoNotReportCrimesAgainstMembers", "kCrimeGold_UseDefaults", "kIgnoresCrimes_Pickpocket", "kVendor", "kCanBeOwner" }));
+
+static_assert(test::RoundTrips<RE::FIGHT_REACTION>(
+	{ RE::FIGHT_REACTION::kNeutral, RE::FIGHT_REACTION::kEnemy, RE::FIGHT_REACTION::kAlly, RE::FIGHT_REACTION::kFriend },
+	{ "kNeutral", "kEnemy", "kAlly", "kFriend" }));
+
+static_assert(test::RoundTrips<RE::FORM_FLAG::FORM_FLAGS>(
+	{ RE::FORM_FLAG::FORM_FLAGS::kNone, RE::FORM_FLAG::FORM_FLAGS::kDestructible, RE::FORM_FLAG::FORM_FLAGS::kMaster, RE::FORM_FLAG::FORM_FLAGS::kUnlocked, RE::FORM_FLAG::FORM_FLAGS::kAltered, RE::FORM_FLAG::FORM_FLAGS::kPlayable, RE::FORM_FLAG::FORM_FLAGS::kInitialized, RE::FORM_FLAG::FORM_FLAGS::kNonOccluder, RE::FORM_FLAG::FORM_FLAGS::kDeleted, RE::FORM_FLAG::FORM_FLAGS::kBorderRegion, RE::FORM_FLAG::FORM_FLAGS::kGlobalConstant, RE::FORM_FLAG::FORM_FLAGS::kHasSpokenFlag, RE::FORM_FLAG::FORM_FLAGS::kKnown, RE::FORM_FLAG::FORM_FLAGS::kInPlaceableWater, RE::FORM_FLAG::FORM_FLAGS::kFireOff, RE::FORM_FLAG::FORM_FLAGS::kMustUpdate, RE::FORM_FLAG::FORM_FLAGS::kOnLocalMap, RE::FORM_FLAG::FORM_FLAGS::kPersistent, RE::FORM_FLAG::FORM_FLAGS::kDisabled, RE::FORM_FLAG::FORM_FLAGS::kUsedAsMovingPlatform, RE::FORM_FLAG::FORM_FLAGS::kIgnored, RE::FORM_FLAG::FORM_FLAGS::kEmpty, RE::FORM_FLAG::FORM_FLAGS::kResetDestruction, RE::FORM_FLAG::FORM_FLAGS::kTemporary, RE::FORM_FLAG::FORM_FLAGS::kPartialForm, RE::FORM_FLAG::FORM_FLAGS::kMustBeVisibleDistant, RE::FORM_FLAG::FORM_FLAGS::kRestricted, RE::FORM_FLAG::FORM_FLAGS::kRandomAnim, RE::FORM_FLAG::FORM_FLAGS::kDangerous, RE::FORM_FLAG::FORM_FLAGS::kHasCurrents, RE::FORM_FLAG::FORM_FLAGS::kIgnoreFriendlyHits, RE::FORM_FLAG::FORM_FLAGS::kStillLoading, RE::FORM_FLAG::FORM_FLAGS::kFormRetainsID, RE::FORM_FLAG::FORM_FLAGS::kDestroyed, RE::FORM_FLAG::FORM_FLAGS::kUnk24, RE::FORM_FLAG::FORM_FLAGS::kNoAIAcquire, RE::FORM_FLAG::FORM_FLAGS::kObstacle, RE::FORM_FLAG::FORM_FLAGS::kVATSTargetOverride, RE::FORM_FLAG::FORM_FLAGS::kDisableFade, RE::FORM_FLAG::FORM_FLAGS::kReflectedByAutoWater, RE::FORM_FLAG::FORM_FLAGS::kShowOnWorldMap, RE::FORM_FLAG::FORM_FLAGS::kChildCanUse, RE::FORM_FLAG::FORM_FLAGS::kNavMeshGeneration_Filter, RE::FORM_FLAG::FORM_FLAGS::kNavMeshGeneration_BoundingBox, RE::FORM_FLAG::FORM_FLAGS::kNavMeshGeneration_Ground },
+	{ "kNone", "kDestructible", "kMaster", "kUnlocked", "kAltered", "kPlayable", "kInitialized", "kNonOccluder", "kDeleted", "kBorderRegion", "kGlobalConstant", "kHasSpokenFlag", "kKnown", "kInPlaceableWater", "kFireOff", "kMustUpdate", "kOnLocalMap", "kPersistent", "kDisabled", "kUsedAsMovingPlatform", "kIgnored", "kEmpty", "kResetDestruction", "kTemporary", "kPartialForm", "kMustBeVisibleDistant", "kRestricted", "kRandomAnim", "kDangerous", "kHasCurrents", "kIgnoreFriendlyHits", "kStillLoading", "kFormRetainsID", "kDestroyed", "kUnk24", "kNoAIAcquire", "kObstacle", "kVATSTargetOverride", "kDisableFade", "kReflectedByAutoWater", "kShowOnWorldMap", "kChildCanUse", "kNavMeshGeneration_Filter", "kNavMeshGeneration_BoundingBox", "kNavMeshGeneration_Ground" }));
+
+static_assert(test::RoundTrips<RE::ForEachResult>(
+	{ RE::ForEachResult::kContinue, RE::ForEachResult::kStop },
+	{ "kContinue", "kStop" }));
+
+static_assert(test::RoundTrips<RE::FunctionMessage::Type>(
+	{ RE::FunctionMessage::Type::kInvalid, RE::FunctionMessage::Type::kCall, RE::FunctionMessage::Type::kReturn },
+	{ "kInvalid", "kCall", "kReturn" }));
+
+static_assert(test::RoundTrips<RE::GUN_STATE>(
+	{ RE::GUN_STATE::kDrawn, RE::GUN_STATE::kRelaxed, RE::GUN_STATE::kBlocked, RE::GUN_STATE::kAlert, RE::GUN_STATE::kReloading, RE::GUN_STATE::kThrowing, RE::GUN_STATE::kSighted, RE::GUN_STATE::kFire, RE::GUN_STATE::kFireSighted },
+	{ "kDrawn", "kRelaxed", "kBlocked", "kAlert", "kReloading", "kThrowing", "kSighted", "kFire", "kFireSighted" }));
+
+static_assert(test::RoundTrips<RE::GamePlayFormulas::EXPERIENCE_ACTIVITY>(
+	{ RE::GamePlayFormulas::EXPERIENCE_ACTIVITY::kKillNPC, RE::GamePlayFormulas::EXPERIENCE_ACTIVITY::kHackComputer },
+	{ "kKillNPC", "kHackComputer" }));
+
+static_assert(test::RoundTrips<RE::GameScript::DelayFunctor::FunctorType>(
+	{ RE::GameScript::DelayFunctor::FunctorType::kMoveTo, RE::GameScript::DelayFunctor::FunctorType::kMoveToOwnEditorLoc, RE::GameScript::DelayFunctor::FunctorType::kDamageObject, RE::GameScript::DelayFunctor::FunctorType::kEnable, RE::GameScript::DelayFunctor::FunctorType::kDisable, RE::GameScript::DelayFunctor::FunctorType::kDelete, RE::GameScript::DelayFunctor::FunctorType::kSetPosition, RE::GameScript::DelayFunctor::FunctorType::kSetAngle, RE::GameScript::DelayFunctor::FunctorType::kSetMotionType, RE::GameScript::DelayFunctor::FunctorType::kNonLatentDelete, RE::GameScript::DelayFunctor::FunctorType::kMoveToPackLoc, RE::GameScript::DelayFunctor::FunctorType::kSetScale, RE::GameScript::DelayFunctor::FunctorType::kDropObject, RE::GameScript::DelayFunctor::FunctorType::kAttachAshPile, RE::GameScript::DelayFunctor::FunctorType::kAddRemoveConstraint, RE::GameScript::DelayFunctor::FunctorType::kAddRemoveRagdoll, RE::GameScript::DelayFunctor::FunctorType::kApplyHavokImpulse, RE::GameScript::DelayFunctor::FunctorType::kResetRefr, RE::GameScript::DelayFunctor::FunctorType::kSendPlayerToJail, RE::GameScript::DelayFunctor::FunctorType::kAddItem, RE::GameScript::DelayFunctor::FunctorType::kResurrect, RE::GameScript::DelayFunctor::FunctorType::kCast, RE::GameScript::DelayFunctor::FunctorType::kScrollCast, RE::GameScript::DelayFunctor::FunctorType::kRemoveItem, RE::GameScript::DelayFunctor::FunctorType::kWaitFor3D, RE::GameScript::DelayFunctor::FunctorType::kPlayBink, RE::GameScript::DelayFunctor::FunctorType::kMoveToNearestNavmesh, RE::GameScript::DelayFunctor::FunctorType::kClearDestruction, RE::GameScript::DelayFunctor::FunctorType::kWaitForResourceRecalc, RE::GameScript::DelayFunctor::FunctorType::kRemoveComponent, RE::GameScript::DelayFunctor::FunctorType::kDropRef },
+	{ "kMoveTo", "kMoveToOwnEditorLoc", "kDamageObject", "kEnable", "kDisable", "kDelete", "kSetPosition", "kSetAngle", "kSetMotionType", "kNonLatentDelete", "kMoveToPackLoc", "kSetScale", "kDropObject", "kAttachAshPile", "kAddRemoveConstraint", "kAddRemoveRagdoll", "kApplyHavokImpulse", "kResetRefr", "kSendPlayerToJail", "kAddItem", "kResurrect", "kCast", "kScrollCast", "kRemoveItem", "kWaitFor3D", "kPlayBink", "kMoveToNearestNavmesh", "kClearDestruction", "kWaitForResourceRecalc", "kRemoveComponent", "kDropRef" }));
+
+static_assert(test::RoundTrips<RE::HUDColorTypes>(
+	{ RE::HUDColorTypes::kNoColorMultiplier, RE::HUDColorTypes::kMenuNoColorBackground, RE::HUDColorTypes::kGameplayHUDColor, RE::HUDColorTypes::kPlayerSetColor, RE::HUDColorTypes::kPowerArmorColorOnly, RE::HUDColorTypes::kWarningColor, RE::HUDColorTypes::kAltWarningColor, RE::HUDColorTypes::kCustomColor },
+	{ "kNoColorMultiplier", "kMenuNoColorBackground", "kGameplayHUDColor", "kPlayerSetColor", "kPowerArmorColorOnly", "kWarningColor", "kAltWarningColor", "kCustomColor" }));
+
+static_assert(test::RoundTrips<RE::HUDMenu::ShowMenuState>(
+	{ RE::HUDMenu::ShowMenuState::kConstructed, RE::HUDMenu::ShowMenuState::kShown, RE::HUDMenu::ShowMenuState::kHidden, RE::HUDMenu::ShowMenuState::kReshowOnDestructor },
+	{ "kConstructed", "kShown", "kHidden", "kReshowOnDestructor" }));
+
+static_assert(test::RoundTrips<RE::HitData::Flags>(
+	{ RE::HitData::Flags::kNone, RE::HitData::Flags::kBlocked, RE::HitData::Flags::kBlockWithWeapon, RE::HitData::Flags::kBlockCandidate, RE::HitData::Flags::kCritical, RE::HitData::Flags::kCriticalOnDeath, RE::HitData::Flags::kFatal, RE::HitData::Flags::kDismemberLimb, RE::HitData::Flags::kExplodeLimb, RE::HitData::Flags::kCrippleLimb, RE::HitData::Flags::kDisarm, RE::HitData::Flags::kDisableWeapon, RE::HitData::Flags::kSneakAttack, RE::HitData::Flags::kIgnoreCritical, RE::HitData::Flags::kPredictDamage, RE::HitData::Flags::kPredictBaseDamage, RE::HitData::Flags::kBash, RE::HitData::Flags::kTimedBash, RE::HitData::Flags::kPowerAttack, RE::HitData::Flags::kMeleeAttack, RE::HitData::Flags::kRicochet, RE::HitData::Flags::kExplosion },
+	{ "kNone", "kBlocked", "kBlockWithWeapon", "kBlockCandidate", "kCritical", "kCriticalOnDeath", "kFatal", "kDismemberLimb", "kExplodeLimb", "kCrippleLimb", "kDisarm", "kDisableWeapon", "kSneakAttack", "kIgnoreCritical", "kPredictDamage", "kPredictBaseDamage", "kBash", "kTimedBash", "kPowerAttack", "kMeleeAttack", "kRicochet", "kExplosion" }));
+
+static_assert(test::RoundTrips<RE::IFuncCallQuery::CallType>(
+	{ RE::IFuncCallQuery::CallType::kMember, RE::IFuncCallQuery::CallType::kStatic, RE::IFuncCallQuery::CallType::kGetter, RE::IFuncCallQuery::CallType::kSetter },
+	{ "kMember", "kStatic", "kGetter", "kSetter" }));
+
+static_assert(test::RoundTrips<RE::IFunction::CallResult>(
+	{ RE::IFunction::CallResult::kCompleted, RE::IFunction::CallResult::kSetupForVM, RE::IFunction::CallResult::kInProgress, RE::IFunction::CallResult::kFailedRetry, RE::IFunction::CallResult::kFailedAbort },
+	{ "kCompleted", "kSetupForVM", "kInProgress", "kFailedRetry", "kFailedAbort" }));
+
+static_assert(test::RoundTrips<RE::IFunction::FunctionType>(
+	{ RE::IFunction::FunctionType::kNormal, RE::IFunction::FunctionType::kPropertyGetter, RE::IFunction::FunctionType::kPropertySetter },
+	{ "kNormal", "kPropertyGetter", "kPropertySetter" }));
+
+static_assert(test::RoundTrips<RE::INPUT_DEVICE>(
+	{ RE::INPUT_DEVICE::kNone, RE::INPUT_DEVICE::kKeyboard, RE::INPUT_DEVICE::kMouse, RE::INPUT_DEVICE::kGamepad, RE::INPUT_DEVICE::kSupported, RE::INPUT_DEVICE::kKinect, RE::INPUT_DEVICE::kVirtualKeyboard, RE::INPUT_DEVICE::kTotal },
+	{ "kNone", "kKeyboard", "kMouse", "kGamepad", "kSupported", "kKinect", "kVirtualKeyboard", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::INPUT_EVENT_TYPE>(
+	{ RE::INPUT_EVENT_TYPE::kButton, RE::INPUT_EVENT_TYPE::kMouseMove, RE::INPUT_EVENT_TYPE::kCursorMove, RE::INPUT_EVENT_TYPE::kChar, RE::INPUT_EVENT_TYPE::kThumbstick, RE::INPUT_EVENT_TYPE::kDeviceConnect, RE::INPUT_EVENT_TYPE::kKinect, RE::INPUT_EVENT_TYPE::kNone },
+	{ "kButton", "kMouseMove", "kCursorMove", "kChar", "kThumbstick", "kDeviceConnect", "kKinect", "kNone" }));
+
+static_assert(test::RoundTrips<RE::INTERACTING_STATE>(
+	{ RE::INTERACTING_STATE::kNotInteracting, RE::INTERACTING_STATE::kWaitingToInteract, RE::INTERACTING_STATE::kInteracting, RE::INTERACTING_STATE::kWaitingToStopInteracting },
+	{ "kNotInteracting", "kWaitingToInteract", "kInteracting", "kWaitingToStopInteracting" }));
+
+static_assert(test::RoundTrips<RE::ITEM_REMOVE_REASON>(
+	{ RE::ITEM_REMOVE_REASON::kNone, RE::ITEM_REMOVE_REASON::kStealing, RE::ITEM_REMOVE_REASON::kSelling, RE::ITEM_REMOVE_REASON::KDropping, RE::ITEM_REMOVE_REASON::kStoreContainer, RE::ITEM_REMOVE_REASON::kStoreTeammate },
+	{ "kNone", "kStealing", "kSelling", "KDropping", "kStoreContainer", "kStoreTeammate" }));
+
+static_assert(test::RoundTrips<RE::ImageSpaceManager::ImageSpaceEffectEnum>(
+	{ RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_WORLD_CAMERA, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_TEMPORAL_AA_PRE_HDR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SUNBEAMS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_HDR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_HDR_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_REFRACTION, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_DEPTH_OF_FIELD, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_DEPTH_OF_FIELD_SPLIT_SCREEN, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_RADIAL_BLUR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_FULLSCREEN_BLUR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_MOTIONBLUR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_GETHIT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_VATS_TARGET, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_FULLSCREEN_COLOR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_GAMMA_CORRECT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_GAMMA_CORRECT_LUT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_GAMMA_CORRECT_RESIZE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_FXAA, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_TEMPORAL_AA, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_TEMPORAL_OLD_AA, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BOKEH_DEPTH_OF_FIELD, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_UPSAMPLE_DYNAMIC_RESOLUTION, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_ENDOFFRAME_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_MAP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR3, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR5, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR7, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR9, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR11, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR13, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR15, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NONHDR_BLUR3, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NONHDR_BLUR5, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NONHDR_BLUR7, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NONHDR_BLUR9, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NONHDR_BLUR11, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NONHDR_BLUR13, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NONHDR_BLUR15, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR3, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR5, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR7, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR9, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR11, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR13, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR15, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_HDR_BLUR15_320x180CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_HDR_BLUR15_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_HDR_BLUR15_1024x1024CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR_CS_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR3_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR5_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR7_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR9_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR11_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR13_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR15_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BLUR_CS_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR3_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR5_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR7_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR9_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR11_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR13_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_BRIGHTPASS_BLUR15_480x270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_WATER_DISPLACEMENT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NOISE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_RAINSPLASH, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_VLS_LIGHT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_VLS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_PIPBOY_SCREEN, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_HUD_GLASS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_MOD_MENU, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_AO, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SAO, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SAO_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_TOP_LEVEL_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_NIGHTVISION, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_COPY, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_COPY_SCALE_BIAS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_COPY_VIS_ALPHA, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_GREYSCALE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_DOWNSAMPLE_DEPTH, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_COPY_STENCIL, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_COPY_WATER_MASK, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_COPY_SHADOWMAPTOARRAY, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_REFRACTION, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_DOUBLEVIS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_TEXTUREMASK, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_MAP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WORLD_CAMERA, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WORLD_CAMERA_NO_SKY_BLUR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_DEPTH_OF_FIELD, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_DEPTH_OF_FIELD_FOGGED, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_DEPTH_OF_FIELD_SPLIT_SCREEN, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS1, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS2, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS3, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS4, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS4_FOGGED, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_DISTANT_BLUR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_DISTANT_BLUR_FOGGED, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_RADIAL_BLUR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_RADIAL_BLUR_MED, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_RADIAL_BLUR_HIGH, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_BLENDINSHADER_CINEMATIC, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_BLENDINSHADER_CINEMATIC_FADE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE16, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE4, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE16LUM, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE4RGB2LUM, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE4_LUMCLAMP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE4_LIGHTADAPT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE16_LUMCLAMP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE16_LIGHTADAPT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE4CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE64RGB2LUMCS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE4LUMCS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE16LUMCS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_DOWNSAMPLE2_LIGHTADAPTCS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR3, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR5, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR7, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR9, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR11, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR13, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR15, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BLUR_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_BLURX15_320CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_BLURX15_480CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HDR_BLURX15_1024CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR3, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR5, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR7, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR9, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR11, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR13, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR15, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NONHDR_BLUR_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR3, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR5, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR7, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR9, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR11, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR13, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR15, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_BLUR_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_HDR_BLURY15_180CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_HDR_BLURY15_270CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_HDR_BLURY15_1024CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_CLEAR_SIMULATION, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_TEX_OFFSET, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_WADING_RIPPLE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_RAIN_RIPPLE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_WADING_HEIGHTMAP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_RAIN_HEIGHTMAP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_BLEND_HEIGHTMAPS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_SMOOTH_HEIGHTMAP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_NORMALS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_WATER_DISPLACEMENT_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NOISE_SCROLL_AND_BLEND, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_NOISE_NORMALMAP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_LOCAL_MAP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_LOCAL_MAP_COMPANION, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ALPHA_BLEND, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_PIPBOY_SCREEN, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HUD_GLASS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HUD_GLASS_DROPSHADOW, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HUD_GLASS_BLURY, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HUD_GLASS_BLURX, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HUD_GLASS_MARKERS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VATS_TARGET_DEBUG, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VATS_TARGET, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_MOD_MENU_EFFECT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_MOD_MENU_GLOW_COMPOSITE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_AO, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_AO_BLUR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_SPOTLIGHT, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_APPLICATION, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_COMPOSITE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_SLICE_COORD, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_SLICE_INTERP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_SLICE_STENCIL, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_SLICE_SCATTER_RAY, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_SLICE_SCATTER_INTERP, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_VLS_SCATTER_ACCUM, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_CAMERAZ, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_MINIFY, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_RAWAO, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_BLUR_H, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_BLUR_V, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_RAWAO_EDITOR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_CAMERAZ_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_MINIFY_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_CAMERAZ_AND_MIPS_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_MIPS_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_RAWAO_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_BLUR_H_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SAO_BLUR_V_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_MOTIONBLUR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_TEMPORAL_AA, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_TEMPORAL_AA_MASKED, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_TEMPORAL_AA_POWERARMOR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_GAMMA_LINEARIZE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SUNBEAMS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SSR_PREPASS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SSR_RAYTRACING, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SSR_BLURH, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_SSR_BLURV, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_LENSFLARE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_RAINSPLASH_SPAWN, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_RAINSPLASH_UPDATE, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_RAINSPLASH_DRAW, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_LENSFLAREVISIBILITY, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_UPSAMPLE_DYNAMIC_RESOLUTION, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_FULLSCREEN_COLOR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HUDGLASS_CLEAR, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_HUDGLASS_COPY, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_CS_V_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur3_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur5_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur7_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur9_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur11_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur13_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur15_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_CS_V_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_CS_H_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur3_H_480_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur5_H_480_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur7_H_480_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur9_H_480_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur11_H_480_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur13_H_480_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBlur15_H_480_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_CS_H_END, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_CS_V_START, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBrightPassBlur3_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBrightPassBlur5_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBrightPassBlur7_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBrightPassBlur9_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBrightPassBlur11_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBrightPassBlur13_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_ISBrightPassBlur15_V_270_CS, RE::ImageSpaceManager::ImageSpaceEffectEnum::EFFECT_SHADER_BRIGHTPASS_CS_V_END },
+	{ "EFFECT_WORLD_CAMERA", "EFFECT_TEMPORAL_AA_PRE_HDR", "EFFECT_SUNBEAMS", "EFFECT_HDR", "EFFECT_HDR_CS", "EFFECT_REFRACTION", "EFFECT_DEPTH_OF_FIELD", "EFFECT_DEPTH_OF_FIELD_SPLIT_SCREEN", "EFFECT_RADIAL_BLUR", "EFFECT_FULLSCREEN_BLUR", "EFFECT_MOTIONBLUR", "EFFECT_GETHIT", "EFFECT_VATS_TARGET", "EFFECT_FULLSCREEN_COLOR", "EFFECT_SHADER_GAMMA_CORRECT", "EFFECT_SHADER_GAMMA_CORRECT_LUT", "EFFECT_SHADER_GAMMA_CORRECT_RESIZE", "EFFECT_SHADER_FXAA", "EFFECT_TEMPORAL_AA", "EFFECT_TEMPORAL_OLD_AA", "EFFECT_BOKEH_DEPTH_OF_FIELD", "EFFECT_UPSAMPLE_DYNAMIC_RESOLUTION", "EFFECT_ENDOFFRAME_END", "EFFECT_MAP", "EFFECT_BLUR_START", "EFFECT_BLUR3", "EFFECT_BLUR5", "EFFECT_BLUR7", "EFFECT_BLUR9", "EFFECT_BLUR11", "EFFECT_BLUR13", "EFFECT_BLUR15", "EFFECT_BLUR_END", "EFFECT_NONHDR_BLUR3", "EFFECT_NONHDR_BLUR5", "EFFECT_NONHDR_BLUR7", "EFFECT_NONHDR_BLUR9", "EFFECT_NONHDR_BLUR11", "EFFECT_NONHDR_BLUR13", "EFFECT_NONHDR_BLUR15", "EFFECT_BRIGHTPASS_BLUR3", "EFFECT_BRIGHTPASS_BLUR5", "EFFECT_BRIGHTPASS_BLUR7", "EFFECT_BRIGHTPASS_BLUR9", "EFFECT_BRIGHTPASS_BLUR11", "EFFECT_BRIGHTPASS_BLUR13", "EFFECT_BRIGHTPASS_BLUR15", "EFFECT_BRIGHTPASS_HDR_BLUR15_320x180CS", "EFFECT_BRIGHTPASS_HDR_BLUR15_480x270CS", "EFFECT_BRIGHTPASS_HDR_BLUR15_1024x1024CS", "EFFECT_BLUR_CS_START", "EFFECT_BLUR3_480x270CS", "EFFECT_BLUR5_480x270CS", "EFFECT_BLUR7_480x270CS", "EFFECT_BLUR9_480x270CS", "EFFECT_BLUR11_480x270CS", "EFFECT_BLUR13_480x270CS", "EFFECT_BLUR15_480x270CS", "EFFECT_BLUR_CS_END", "EFFECT_BRIGHTPASS_BLUR3_480x270CS", "EFFECT_BRIGHTPASS_BLUR5_480x270CS", "EFFECT_BRIGHTPASS_BLUR7_480x270CS", "EFFECT_BRIGHTPASS_BLUR9_480x270CS", "EFFECT_BRIGHTPASS_BLUR11_480x270CS", "EFFECT_BRIGHTPASS_BLUR13_480x270CS", "EFFECT_BRIGHTPASS_BLUR15_480x270CS", "EFFECT_WATER_DISPLACEMENT", "EFFECT_NOISE", "EFFECT_RAINSPLASH", "EFFECT_VLS_LIGHT", "EFFECT_VLS", "EFFECT_PIPBOY_SCREEN", "EFFECT_HUD_GLASS", "EFFECT_MOD_MENU", "EFFECT_AO", "EFFECT_SAO", "EFFECT_SAO_CS", "EFFECT_TOP_LEVEL_END", "EFFECT_NIGHTVISION", "EFFECT_END", "EFFECT_SHADER_START", "EFFECT_SHADER_COPY", "EFFECT_SHADER_COPY_SCALE_BIAS", "EFFECT_SHADER_COPY_VIS_ALPHA", "EFFECT_SHADER_GREYSCALE", "EFFECT_SHADER_DOWNSAMPLE_DEPTH", "EFFECT_SHADER_COPY_STENCIL", "EFFECT_SHADER_COPY_WATER_MASK", "EFFECT_SHADER_COPY_SHADOWMAPTOARRAY", "EFFECT_SHADER_REFRACTION", "EFFECT_SHADER_DOUBLEVIS", "EFFECT_SHADER_TEXTUREMASK", "EFFECT_SHADER_MAP", "EFFECT_SHADER_WORLD_CAMERA", "EFFECT_SHADER_WORLD_CAMERA_NO_SKY_BLUR", "EFFECT_SHADER_DEPTH_OF_FIELD", "EFFECT_SHADER_DEPTH_OF_FIELD_FOGGED", "EFFECT_SHADER_DEPTH_OF_FIELD_SPLIT_SCREEN", "EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS1", "EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS2", "EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS3", "EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS4", "EFFECT_SHADER_BOKEH_DEPTH_OF_FIELD_PASS4_FOGGED", "EFFECT_SHADER_DISTANT_BLUR", "EFFECT_SHADER_DISTANT_BLUR_FOGGED", "EFFECT_SHADER_RADIAL_BLUR", "EFFECT_SHADER_RADIAL_BLUR_MED", "EFFECT_SHADER_RADIAL_BLUR_HIGH", "EFFECT_SHADER_HDR_BLENDINSHADER_CINEMATIC", "EFFECT_SHADER_HDR_BLENDINSHADER_CINEMATIC_FADE", "EFFECT_SHADER_HDR_DOWNSAMPLE16", "EFFECT_SHADER_HDR_DOWNSAMPLE4", "EFFECT_SHADER_HDR_DOWNSAMPLE16LUM", "EFFECT_SHADER_HDR_DOWNSAMPLE4RGB2LUM", "EFFECT_SHADER_HDR_DOWNSAMPLE4_LUMCLAMP", "EFFECT_SHADER_HDR_DOWNSAMPLE4_LIGHTADAPT", "EFFECT_SHADER_HDR_DOWNSAMPLE16_LUMCLAMP", "EFFECT_SHADER_HDR_DOWNSAMPLE16_LIGHTADAPT", "EFFECT_SHADER_HDR_DOWNSAMPLE4CS", "EFFECT_SHADER_HDR_DOWNSAMPLE64RGB2LUMCS", "EFFECT_SHADER_HDR_DOWNSAMPLE4LUMCS", "EFFECT_SHADER_HDR_DOWNSAMPLE16LUMCS", "EFFECT_SHADER_HDR_DOWNSAMPLE2_LIGHTADAPTCS", "EFFECT_SHADER_BLUR_START", "EFFECT_SHADER_BLUR3", "EFFECT_SHADER_BLUR5", "EFFECT_SHADER_BLUR7", "EFFECT_SHADER_BLUR9", "EFFECT_SHADER_BLUR11", "EFFECT_SHADER_BLUR13", "EFFECT_SHADER_BLUR15", "EFFECT_SHADER_BLUR_END", "EFFECT_SHADER_HDR_BLURX15_320CS", "EFFECT_SHADER_HDR_BLURX15_480CS", "EFFECT_SHADER_HDR_BLURX15_1024CS", "EFFECT_SHADER_NONHDR_BLUR_START", "EFFECT_SHADER_NONHDR_BLUR3", "EFFECT_SHADER_NONHDR_BLUR5", "EFFECT_SHADER_NONHDR_BLUR7", "EFFECT_SHADER_NONHDR_BLUR9", "EFFECT_SHADER_NONHDR_BLUR11", "EFFECT_SHADER_NONHDR_BLUR13", "EFFECT_SHADER_NONHDR_BLUR15", "EFFECT_SHADER_NONHDR_BLUR_END", "EFFECT_SHADER_BRIGHTPASS_BLUR_START", "EFFECT_SHADER_BRIGHTPASS_BLUR3", "EFFECT_SHADER_BRIGHTPASS_BLUR5", "EFFECT_SHADER_BRIGHTPASS_BLUR7", "EFFECT_SHADER_BRIGHTPASS_BLUR9", "EFFECT_SHADER_BRIGHTPASS_BLUR11", "EFFECT_SHADER_BRIGHTPASS_BLUR13", "EFFECT_SHADER_BRIGHTPASS_BLUR15", "EFFECT_SHADER_BRIGHTPASS_BLUR_END", "EFFECT_SHADER_BRIGHTPASS_HDR_BLURY15_180CS", "EFFECT_SHADER_BRIGHTPASS_HDR_BLURY15_270CS", "EFFECT_SHADER_BRIGHTPASS_HDR_BLURY15_1024CS", "EFFECT_SHADER_WATER_DISPLACEMENT_START", "EFFECT_SHADER_WATER_DISPLACEMENT_CLEAR_SIMULATION", "EFFECT_SHADER_WATER_DISPLACEMENT_TEX_OFFSET", "EFFECT_SHADER_WATER_DISPLACEMENT_WADING_RIPPLE", "EFFECT_SHADER_WATER_DISPLACEMENT_RAIN_RIPPLE", "EFFECT_SHADER_WATER_DISPLACEMENT_WADING_HEIGHTMAP", "EFFECT_SHADER_WATER_DISPLACEMENT_RAIN_HEIGHTMAP", "EFFECT_SHADER_WATER_DISPLACEMENT_BLEND_HEIGHTMAPS", "EFFECT_SHADER_WATER_DISPLACEMENT_SMOOTH_HEIGHTMAP", "EFFECT_SHADER_WATER_DISPLACEMENT_NORMALS", "EFFECT_SHADER_WATER_DISPLACEMENT_END", "EFFECT_SHADER_NOISE_SCROLL_AND_BLEND", "EFFECT_SHADER_NOISE_NORMALMAP", "EFFECT_SHADER_LOCAL_MAP", "EFFECT_SHADER_LOCAL_MAP_COMPANION", "EFFECT_SHADER_ALPHA_BLEND", "EFFECT_SHADER_PIPBOY_SCREEN", "EFFECT_SHADER_HUD_GLASS", "EFFECT_SHADER_HUD_GLASS_DROPSHADOW", "EFFECT_SHADER_HUD_GLASS_BLURY", "EFFECT_SHADER_HUD_GLASS_BLURX", "EFFECT_SHADER_HUD_GLASS_MARKERS", "EFFECT_SHADER_VATS_TARGET_DEBUG", "EFFECT_SHADER_VATS_TARGET", "EFFECT_SHADER_MOD_MENU_EFFECT", "EFFECT_SHADER_MOD_MENU_GLOW_COMPOSITE", "EFFECT_SHADER_AO", "EFFECT_SHADER_AO_BLUR", "EFFECT_SHADER_VLS_SPOTLIGHT", "EFFECT_SHADER_VLS_APPLICATION", "EFFECT_SHADER_VLS_COMPOSITE", "EFFECT_SHADER_VLS_SLICE_COORD", "EFFECT_SHADER_VLS_SLICE_INTERP", "EFFECT_SHADER_VLS_SLICE_STENCIL", "EFFECT_SHADER_VLS_SLICE_SCATTER_RAY", "EFFECT_SHADER_VLS_SLICE_SCATTER_INTERP", "EFFECT_SHADER_VLS_SCATTER_ACCUM", "EFFECT_SHADER_SAO_CAMERAZ", "EFFECT_SHADER_SAO_MINIFY", "EFFECT_SHADER_SAO_RAWAO", "EFFECT_SHADER_SAO_BLUR_H", "EFFECT_SHADER_SAO_BLUR_V", "EFFECT_SHADER_SAO_RAWAO_EDITOR", "EFFECT_SHADER_SAO_CAMERAZ_CS", "EFFECT_SHADER_SAO_MINIFY_CS", "EFFECT_SHADER_SAO_CAMERAZ_AND_MIPS_CS", "EFFECT_SHADER_SAO_MIPS_CS", "EFFECT_SHADER_SAO_RAWAO_CS", "EFFECT_SHADER_SAO_BLUR_H_CS", "EFFECT_SHADER_SAO_BLUR_V_CS", "EFFECT_SHADER_MOTIONBLUR", "EFFECT_SHADER_TEMPORAL_AA", "EFFECT_SHADER_TEMPORAL_AA_MASKED", "EFFECT_SHADER_TEMPORAL_AA_POWERARMOR", "EFFECT_SHADER_GAMMA_LINEARIZE", "EFFECT_SHADER_SUNBEAMS", "EFFECT_SHADER_SSR_PREPASS", "EFFECT_SHADER_SSR_RAYTRACING", "EFFECT_SHADER_SSR_BLURH", "EFFECT_SHADER_SSR_BLURV", "EFFECT_SHADER_LENSFLARE", "EFFECT_SHADER_RAINSPLASH_SPAWN", "EFFECT_SHADER_RAINSPLASH_UPDATE", "EFFECT_SHADER_RAINSPLASH_DRAW", "EFFECT_SHADER_LENSFLAREVISIBILITY", "EFFECT_SHADER_UPSAMPLE_DYNAMIC_RESOLUTION", "EFFECT_SHADER_FULLSCREEN_COLOR", "EFFECT_SHADER_HUDGLASS_CLEAR", "EFFECT_SHADER_HUDGLASS_COPY", "EFFECT_SHADER_CS_V_START", "EFFECT_SHADER_ISBlur3_V_270_CS", "EFFECT_SHADER_ISBlur5_V_270_CS", "EFFECT_SHADER_ISBlur7_V_270_CS", "EFFECT_SHADER_ISBlur9_V_270_CS", "EFFECT_SHADER_ISBlur11_V_270_CS", "EFFECT_SHADER_ISBlur13_V_270_CS", "EFFECT_SHADER_ISBlur15_V_270_CS", "EFFECT_SHADER_CS_V_END", "EFFECT_SHADER_CS_H_START", "EFFECT_SHADER_ISBlur3_H_480_CS", "EFFECT_SHADER_ISBlur5_H_480_CS", "EFFECT_SHADER_ISBlur7_H_480_CS", "EFFECT_SHADER_ISBlur9_H_480_CS", "EFFECT_SHADER_ISBlur11_H_480_CS", "EFFECT_SHADER_ISBlur13_H_480_CS", "EFFECT_SHADER_ISBlur15_H_480_CS", "EFFECT_SHADER_CS_H_END", "EFFECT_SHADER_BRIGHTPASS_CS_V_START", "EFFECT_SHADER_ISBrightPassBlur3_V_270_CS", "EFFECT_SHADER_ISBrightPassBlur5_V_270_CS", "EFFECT_SHADER_ISBrightPassBlur7_V_270_CS", "EFFECT_SHADER_ISBrightPassBlur9_V_270_CS", "EFFECT_SHADER_ISBrightPassBlur11_V_270_CS", "EFFECT_SHADER_ISBrightPassBlur13_V_270_CS", "EFFECT_SHADER_ISBrightPassBlur15_V_270_CS", "EFFECT_SHADER_BRIGHTPASS_CS_V_END" }));
+
+static_assert(test::RoundTrips<RE::ImageSpaceModifierInstance::Flags>(
+	{ RE::ImageSpaceModifierInstance::Flags::kNone, RE::ImageSpaceModifierInstance::Flags::kPermanent, RE::ImageSpaceModifierInstance::Flags::kCrossfade, RE::ImageSpaceModifierInstance::Flags::kPreviousCrossfade, RE::ImageSpaceModifierInstance::Flags::kMenuIMOD, RE::ImageSpaceModifierInstance::Flags::kStopped },
+	{ "kNone", "kPermanent", "kCrossfade", "kPreviousCrossfade", "kMenuIMOD", "kStopped" }));
+
+static_assert(test::RoundTrips<RE::ImageSpaceModifierInstanceDOF::DepthOfFieldMode>(
+	{ RE::ImageSpaceModifierInstanceDOF::DepthOfFieldMode::kFrontBack, RE::ImageSpaceModifierInstanceDOF::DepthOfFieldMode::kFront, RE::ImageSpaceModifierInstanceDOF::DepthOfFieldMode::kBack, RE::ImageSpaceModifierInstanceDOF::DepthOfFieldMode::kNone },
+	{ "kFrontBack", "kFront", "kBack", "kNone" }));
+
+static_assert(test::RoundTrips<RE::ImpactResult>(
+	{ RE::ImpactResult::kNone, RE::ImpactResult::kDestroy, RE::ImpactResult::kBounce, RE::ImpactResult::kImpale, RE::ImpactResult::kStick },
+	{ "kNone", "kDestroy", "kBounce", "kImpale", "kStick" }));
+
+static_assert(test::RoundTrips<RE::IngredientItem::Flags>(
+	{ RE::IngredientItem::Flags::kNone, RE::IngredientItem::Flags::kCostOverride, RE::IngredientItem::Flags::kFoodItem, RE::IngredientItem::Flags::kExtendDuration, RE::IngredientItem::Flags::kReferencesPersist },
+	{ "kNone", "kCostOverride", "kFoodItem", "kExtendDuration", "kReferencesPersist" }));
+
+static_assert(test::RoundTrips<RE::IngredientItem::RecordFlags::RecordFlag>(
+	{ RE::IngredientItem::RecordFlags::RecordFlag::kDeleted, RE::IngredientItem::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::InputEvent::HANDLED_RESULT>(
+	{ RE::InputEvent::HANDLED_RESULT::kUnhandled, RE::InputEvent::HANDLED_RESULT::kContinue, RE::InputEvent::HANDLED_RESULT::kStop },
+	{ "kUnhandled", "kContinue", "kStop" }));
+
+static_assert(test::RoundTrips<RE::Interface3D::BackgroundMode>(
+	{ RE::Interface3D::BackgroundMode::kLive, RE::Interface3D::BackgroundMode::kStatic, RE::Interface3D::BackgroundMode::kSolidColor },
+	{ "kLive", "kStatic", "kSolidColor" }));
+
+static_assert(test::RoundTrips<RE::Interface3D::HighlightEffect>(
+	{ RE::Interface3D::HighlightEffect::kNone, RE::Interface3D::HighlightEffect::kVATS },
+	{ "kNone", "kVATS" }));
+
+static_assert(test::RoundTrips<RE::Interface3D::LightType>(
+	{ RE::Interface3D::LightType::kSpot, RE::Interface3D::LightType::kShadowSpot, RE::Interface3D::LightType::kPoint },
+	{ "kSpot", "kShadowSpot", "kPoint" }));
+
+static_assert(test::RoundTrips<RE::Interface3D::OffscreenMenuBlendMode>(
+	{ RE::Interface3D::OffscreenMenuBlendMode::kAdditive, RE::Interface3D::OffscreenMenuBlendMode::kAlpha },
+	{ "kAdditive", "kAlpha" }));
+
+static_assert(test::RoundTrips<RE::Interface3D::OffscreenMenuSize>(
+	{ RE::Interface3D::OffscreenMenuSize::kPipboy, RE::Interface3D::OffscreenMenuSize::kFullFrame, RE::Interface3D::OffscreenMenuSize::kFullFrameText },
+	{ "kPipboy", "kFullFrame", "kFullFrameText" }));
+
+static_assert(test::RoundTrips<RE::Interface3D::PostEffect>(
+	{ RE::Interface3D::PostEffect::kNone, RE::Interface3D::PostEffect::kPipboy, RE::Interface3D::PostEffect::kHUDGlass, RE::Interface3D::PostEffect::kHUDGlassWithMod, RE::Interface3D::PostEffect::kModMenu, RE::Interface3D::PostEffect::kModMenuHighlightAll, RE::Interface3D::PostEffect::kModMenuHighlightAllNoPulseOrScanLines },
+	{ "kNone", "kPipboy", "kHUDGlass", "kHUDGlassWithMod", "kModMenu", "kModMenuHighlightAll", "kModMenuHighlightAllNoPulseOrScanLines" }));
+
+static_assert(test::RoundTrips<RE::Interface3D::ScreenMode>(
+	{ RE::Interface3D::ScreenMode::kNone, RE::Interface3D::ScreenMode::kWorldAttached, RE::Interface3D::ScreenMode::kScreenAttached },
+	{ "kNone", "kWorldAttached", "kScreenAttached" }));
+
+static_assert(test::RoundTrips<RE::KeywordType>(
+	{ RE::KeywordType::kNone, RE::KeywordType::kComponentTechLevel, RE::KeywordType::kAttachPoint, RE::KeywordType::kComponentProperty, RE::KeywordType::kInstantiationFilter, RE::KeywordType::kModAssociation, RE::KeywordType::kSound, RE::KeywordType::kAnimArchetype, RE::KeywordType::kFunctionCall, RE::KeywordType::kRecipeFilter, RE::KeywordType::kAttractionType, RE::KeywordType::kDialogueSubtype, RE::KeywordType::kQuestTarget, RE::KeywordType::kAnimFlavor, RE::KeywordType::kAnimGender, RE::KeywordType::kAnimFaceArchetype, RE::KeywordType::kQuestGroup, RE::KeywordType::kAnimInjured, RE::KeywordType::kDispelEffect, RE::KeywordType::kTotal },
+	{ "kNone", "kComponentTechLevel", "kAttachPoint", "kComponentProperty", "kInstantiationFilter", "kModAssociation", "kSound", "kAnimArchetype", "kFunctionCall", "kRecipeFilter", "kAttractionType", "kDialogueSubtype", "kQuestTarget", "kAnimFlavor", "kAnimGender", "kAnimFaceArchetype", "kQuestGroup", "kAnimInjured", "kDispelEffect", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::LIMB_ENUMS::LIMB_ENUM>(
+	{ RE::LIMB_ENUMS::LIMB_ENUM::kNone, RE::LIMB_ENUMS::LIMB_ENUM::kTorso, RE::LIMB_ENUMS::LIMB_ENUM::kHead, RE::LIMB_ENUMS::LIMB_ENUM::kEye, RE::LIMB_ENUMS::LIMB_ENUM::kLookAt, RE::LIMB_ENUMS::LIMB_ENUM::kFlyGrab, RE::LIMB_ENUMS::LIMB_ENUM::kSaddle, RE::LIMB_ENUMS::LIMB_ENUM::kTotal },
+	{ "kNone", "kTorso", "kHead", "kEye", "kLookAt", "kFlyGrab", "kSaddle", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::LOCK_LEVEL>(
+	{ RE::LOCK_LEVEL::kUnlocked, RE::LOCK_LEVEL::kEasy, RE::LOCK_LEVEL::kAverage, RE::LOCK_LEVEL::kHard, RE::LOCK_LEVEL::kVeryHard, RE::LOCK_LEVEL::kRequiresKey, RE::LOCK_LEVEL::kInaccessible, RE::LOCK_LEVEL::kTerminal, RE::LOCK_LEVEL::kBarred, RE::LOCK_LEVEL::kChained },
+	{ "kUnlocked", "kEasy", "kAverage", "kHard", "kVeryHard", "kRequiresKey", "kInaccessible", "kTerminal", "kBarred", "kChained" }));
+
+static_assert(test::RoundTrips<RE::MELEE_ATTACK_SPEED>(
+	{ RE::MELEE_ATTACK_SPEED::kVerySlow, RE::MELEE_ATTACK_SPEED::kSlow, RE::MELEE_ATTACK_SPEED::kMedium, RE::MELEE_ATTACK_SPEED::kFast, RE::MELEE_ATTACK_SPEED::kVeryFast },
+	{ "kVerySlow", "kSlow", "kMedium", "kFast", "kVeryFast" }));
+
+static_assert(test::RoundTrips<RE::MENU_RENDER_CONTEXT>(
+	{ RE::MENU_RENDER_CONTEXT::kMenuDelete, RE::MENU_RENDER_CONTEXT::kPreDisplay, RE::MENU_RENDER_CONTEXT::kRenderScreenspace, RE::MENU_RENDER_CONTEXT::kRenderCopyQuads, RE::MENU_RENDER_CONTEXT::kRenderImagespace, RE::MENU_RENDER_CONTEXT::kEnsureDisplayMenuCalled, RE::MENU_RENDER_CONTEXT::kPostDisplay },
+	{ "kMenuDelete", "kPreDisplay", "kRenderScreenspace", "kRenderCopyQuads", "kRenderImagespace", "kEnsureDisplayMenuCalled", "kPostDisplay" }));
+
+static_assert(test::RoundTrips<RE::MapMarkerData::MARKER_TYPE>(
+	{ RE::MapMarkerData::MARKER_TYPE::kCave, RE::MapMarkerData::MARKER_TYPE::kCity, RE::MapMarkerData::MARKER_TYPE::kDiamondCity, RE::MapMarkerData::MARKER_TYPE::kEncampment, RE::MapMarkerData::MARKER_TYPE::kIndustrial, RE::MapMarkerData::MARKER_TYPE::kGovtBuilding, RE::MapMarkerData::MARKER_TYPE::kMetro, RE::MapMarkerData::MARKER_TYPE::kMilitaryBase, RE::MapMarkerData::MARKER_TYPE::kLandmark, RE::MapMarkerData::MARKER_TYPE::kOffice, RE::MapMarkerData::MARKER_TYPE::kRuinsTown, RE::MapMarkerData::MARKER_TYPE::kRuinsUrban, RE::MapMarkerData::MARKER_TYPE::kSanctuary, RE::MapMarkerData::MARKER_TYPE::kSettlement, RE::MapMarkerData::MARKER_TYPE::kSewer, RE::MapMarkerData::MARKER_TYPE::kVault, RE::MapMarkerData::MARKER_TYPE::kAirfield, RE::MapMarkerData::MARKER_TYPE::kBunkerHill, RE::MapMarkerData::MARKER_TYPE::kCamper, RE::MapMarkerData::MARKER_TYPE::kCar, RE::MapMarkerData::MARKER_TYPE::kChurch, RE::MapMarkerData::MARKER_TYPE::kCountryClub, RE::MapMarkerData::MARKER_TYPE::kCustomHouse, RE::MapMarkerData::MARKER_TYPE::kDriveIn, RE::MapMarkerData::MARKER_TYPE::kElevatedHighway, RE::MapMarkerData::MARKER_TYPE::kFaneuilHall, RE::MapMarkerData::MARKER_TYPE::kFarm, RE::MapMarkerData::MARKER_TYPE::kFillingStation, RE::MapMarkerData::MARKER_TYPE::kForest, RE::MapMarkerData::MARKER_TYPE::kGoodNeighbor, RE::MapMarkerData::MARKER_TYPE::kGraveyard, RE::MapMarkerData::MARKER_TYPE::kHospital, RE::MapMarkerData::MARKER_TYPE::kIndustrialDome, RE::MapMarkerData::MARKER_TYPE::kIndustrialStacks, RE::MapMarkerData::MARKER_TYPE::kInstitute, RE::MapMarkerData::MARKER_TYPE::kIrishPride, RE::MapMarkerData::MARKER_TYPE::kJunkyard, RE::MapMarkerData::MARKER_TYPE::kObservatory, RE::MapMarkerData::MARKER_TYPE::kPier, RE::MapMarkerData::MARKER_TYPE::kPondOrLake, RE::MapMarkerData::MARKER_TYPE::kQuarry, RE::MapMarkerData::MARKER_TYPE::kRadioactiveArea, RE::MapMarkerData::MARKER_TYPE::kRadioTower, RE::MapMarkerData::MARKER_TYPE::kSalem, RE::MapMarkerData::MARKER_TYPE::kSchool, RE::MapMarkerData::MARKER_TYPE::kShipwreck, RE::MapMarkerData::MARKER_TYPE::kSubmarine, RE::MapMarkerData::MARKER_TYPE::kSwanPond, RE::MapMarkerData::MARKER_TYPE::kSynthHead, RE::MapMarkerData::MARKER_TYPE::kTown, RE::MapMarkerData::MARKER_TYPE::kBOS, RE::MapMarkerData::MARKER_TYPE::kBrownstone, RE::MapMarkerData::MARKER_TYPE::kBunker, RE::MapMarkerData::MARKER_TYPE::kCastle, RE::MapMarkerData::MARKER_TYPE::kSkyscraper, RE::MapMarkerData::MARKER_TYPE::kLibertalia, RE::MapMarkerData::MARKER_TYPE::kLowrise, RE::MapMarkerData::MARKER_TYPE::kMinutemen, RE::MapMarkerData::MARKER_TYPE::kPoliceStation, RE::MapMarkerData::MARKER_TYPE::kPrydwen, RE::MapMarkerData::MARKER_TYPE::kRailroadFaction, RE::MapMarkerData::MARKER_TYPE::kRailroad, RE::MapMarkerData::MARKER_TYPE::kSatellite, RE::MapMarkerData::MARKER_TYPE::kSentinel, RE::MapMarkerData::MARKER_TYPE::kUSSConstitution, RE::MapMarkerData::MARKER_TYPE::kMechanist, RE::MapMarkerData::MARKER_TYPE::kRaiderSettlement, RE::MapMarkerData::MARKER_TYPE::kVassalSettlement, RE::MapMarkerData::MARKER_TYPE::kPotentialVassalSettlement, RE::MapMarkerData::MARKER_TYPE::kBottlingPlant, RE::MapMarkerData::MARKER_TYPE::kGalactic, RE::MapMarkerData::MARKER_TYPE::kHub, RE::MapMarkerData::MARKER_TYPE::kKiddieKingdom, RE::MapMarkerData::MARKER_TYPE::kMonorail, RE::MapMarkerData::MARKER_TYPE::kRides, RE::MapMarkerData::MARKER_TYPE::kSafari, RE::MapMarkerData::MARKER_TYPE::kWildWest, RE::MapMarkerData::MARKER_TYPE::kPOI, RE::MapMarkerData::MARKER_TYPE::kDisciples, RE::MapMarkerData::MARKER_TYPE::kOperators, RE::MapMarkerData::MARKER_TYPE::kPack, RE::MapMarkerData::MARKER_TYPE::kDoor, RE::MapMarkerData::MARKER_TYPE::kCountEditor, RE::MapMarkerData::MARKER_TYPE::kQuest, RE::MapMarkerData::MARKER_TYPE::kQuestDoor, RE::MapMarkerData::MARKER_TYPE::kQuestMultiple, RE::MapMarkerData::MARKER_TYPE::kPlayerSet, RE::MapMarkerData::MARKER_TYPE::kPlayerLocation, RE::MapMarkerData::MARKER_TYPE::kPowerArmorLocation, RE::MapMarkerData::MARKER_TYPE::kDogmeat, RE::MapMarkerData::MARKER_TYPE::kTeammate, RE::MapMarkerData::MARKER_TYPE::kCountTotal },
+	{ "kCave", "kCity", "kDiamondCity", "kEncampment", "kIndustrial", "kGovtBuilding", "kMetro", "kMilitaryBase", "kLandmark", "kOffice", "kRuinsTown", "kRuinsUrban", "kSanctuary", "kSettlement", "kSewer", "kVault", "kAirfield", "kBunkerHill", "kCamper", "kCar", "kChurch", "kCountryClub", "kCustomHouse", "kDriveIn", "kElevatedHighway", "kFaneuilHall", "kFarm", "kFillingStation", "kForest", "kGoodNeighbor", "kGraveyard", "kHospital", "kIndustrialDome", "kIndustrialStacks", "kInstitute", "kIrishPride", "kJunkyard", "kObservatory", "kPier", "kPondOrLake", "kQuarry", "kRadioactiveArea", "kRadioTower", "kSalem", "kSchool", "kShipwreck", "kSubmarine", "kSwanPond", "kSynthHead", "kTown", "kBOS", "kBrownstone", "kBunker", "kCastle", "kSkyscraper", "kLibertalia", "kLowrise", "kMinutemen", "kPoliceStation", "kPrydwen", "kRailroadFaction", "kRailroad", "kSatellite", "kSentinel", "kUSSConstitution", "kMechanist", "kRaiderSettlement", "kVassalSettlement", "kPotentialVassalSettlement", "kBottlingPlant", "kGalactic", "kHub", "kKiddieKingdom", "kMonorail", "kRides", "kSafari", "kWildWest", "kPOI", "kDisciples", "kOperators", "kPack", "kDoor", "kCountEditor", "kQuest", "kQuestDoor", "kQuestMultiple", "kPlayerSet", "kPlayerLocation", "kPowerArmorLocation", "kDogmeat", "kTeammate", "kCountTotal" }));
+
+static_assert(test::RoundTrips<RE::OBJ_BOOK::Flags>(
+	{ RE::OBJ_BOOK::Flags::kNone, RE::OBJ_BOOK::Flags::kAdvancesActorValue, RE::OBJ_BOOK::Flags::kCannotTake, RE::OBJ_BOOK::Flags::kAddSpell, RE::OBJ_BOOK::Flags::kHasBeenRead, RE::OBJ_BOOK::Flags::kAddPerk },
+	{ "kNone", "kAdvancesActorValue", "kCannotTake", "kAddSpell", "kHasBeenRead", "kAddPerk" }));
+
+static_assert(test::RoundTrips<RE::OBJ_LAND::LAND>(
+	{ RE::OBJ_LAND::LAND::kHeightAltered, RE::OBJ_LAND::LAND::kCLRAltered, RE::OBJ_LAND::LAND::kTexAltered, RE::OBJ_LAND::LAND::kLoaded, RE::OBJ_LAND::LAND::kGoodNormals, RE::OBJ_LAND::LAND::kHiResHeightfield, RE::OBJ_LAND::LAND::kRemapped, RE::OBJ_LAND::LAND::kDataAltered },
+	{ "kHeightAltered", "kCLRAltered", "kTexAltered", "kLoaded", "kGoodNormals", "kHiResHeightfield", "kRemapped", "kDataAltered" }));
+
+static_assert(test::RoundTrips<RE::ObjectTypeInfo::LinkValidState>(
+	{ RE::ObjectTypeInfo::LinkValidState::kNotLinked, RE::ObjectTypeInfo::LinkValidState::kCurrentlyLinking, RE::ObjectTypeInfo::LinkValidState::kLinkedInvalid, RE::ObjectTypeInfo::LinkValidState::kLinkedValid },
+	{ "kNotLinked", "kCurrentlyLinking", "kLinkedInvalid", "kLinkedValid" }));
+
+static_assert(test::RoundTrips<RE::OtherInputEvents::OTHER_EVENT_FLAGS>(
+	{ RE::OtherInputEvents::OTHER_EVENT_FLAGS::kAll, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kJournalTabs, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kActivation, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kFastTravel, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kPOVChange, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kVATS, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kFavorites, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kPipboyLight, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kZKey, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kRunning, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kCursor, RE::OtherInputEvents::OTHER_EVENT_FLAGS::kSprinting },
+	{ "kAll", "kJournalTabs", "kActivation", "kFastTravel", "kPOVChange", "kVATS", "kFavorites", "kPipboyLight", "kZKey", "kRunning", "kCursor", "kSprinting" }));
+
+static_assert(test::RoundTrips<RE::PC_GAMEPAD_TYPE>(
+	{ RE::PC_GAMEPAD_TYPE::kDirectX, RE::PC_GAMEPAD_TYPE::kOrbis, RE::PC_GAMEPAD_TYPE::kTotal },
+	{ "kDirectX", "kOrbis", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::PERK_ENTRY_TYPE>(
+	{ RE::PERK_ENTRY_TYPE::kQuest, RE::PERK_ENTRY_TYPE::kAbility, RE::PERK_ENTRY_TYPE::kEntryPoint },
+	{ "kQuest", "kAbility", "kEntryPoint" }));
+
+static_assert(test::RoundTrips<RE::PIPBOY_PAGES>(
+	{ RE::PIPBOY_PAGES::kStat, RE::PIPBOY_PAGES::kInv, RE::PIPBOY_PAGES::kData, RE::PIPBOY_PAGES::kMap, RE::PIPBOY_PAGES::kRadio },
+	{ "kStat", "kInv", "kData", "kMap", "kRadio" }));
+
+static_assert(test::RoundTrips<RE::PTYPE>(
+	{ RE::PTYPE::kExplore, RE::PTYPE::kFollow, RE::PTYPE::kEscore, RE::PTYPE::kEat, RE::PTYPE::kSleep, RE::PTYPE::kWander, RE::PTYPE::kTravel, RE::PTYPE::kAccompany, RE::PTYPE::kUseItemAt, RE::PTYPE::kAmbush, RE::PTYPE::kFleeNonCombat, RE::PTYPE::kCastMagic, RE::PTYPE::kSandbox, RE::PTYPE::kPatrol, RE::PTYPE::kGuard, RE::PTYPE::kDialogue, RE::PTYPE::kUseWeapon, RE::PTYPE::kFind, RE::PTYPE::kCustom, RE::PTYPE::kTemplate, RE::PTYPE::kActivate, RE::PTYPE::kAlarm, RE::PTYPE::kFlee, RE::PTYPE::kTrespass, RE::PTYPE::kSpectator, RE::PTYPE::kGreet, RE::PTYPE::kGetUp, RE::PTYPE::kDoNothing, RE::PTYPE::kInGameDialogue, RE::PTYPE::kSurface, RE::PTYPE::kSearchForAttacker, RE::PTYPE::kAvoidReference, RE::PTYPE::kBumpReaction, RE::PTYPE::kGrenadeMineReaction, RE::PTYPE::kStealWarning, RE::PTYPE::kPickpocketWarning, RE::PTYPE::kMovementBlocked, RE::PTYPE::kVampireFeed, RE::PTYPE::kCannibal, RE::PTYPE::kLand, RE::PTYPE::kUnused, RE::PTYPE::kMountActor, RE::PTYPE::kDismountActor, RE::PTYPE::kClearMountPosition, RE::PTYPE::kClearPowerArmorExit, RE::PTYPE::kCount },
+	{ "kExplore", "kFollow", "kEscore", "kEat", "kSleep", "kWander", "kTravel", "kAccompany", "kUseItemAt", "kAmbush", "kFleeNonCombat", "kCastMagic", "kSandbox", "kPatrol", "kGuard", "kDialogue", "kUseWeapon", "kFind", "kCustom", "kTemplate", "kActivate", "kAlarm", "kFlee", "kTrespass", "kSpectator", "kGreet", "kGetUp", "kDoNothing", "kInGameDialogue", "kSurface", "kSearchForAttacker", "kAvoidReference", "kBumpReaction", "kGrenadeMineReaction", "kStealWarning", "kPickpocketWarning", "kMovementBlocked", "kVampireFeed", "kCannibal", "kLand", "kUnused", "kMountActor", "kDismountActor", "kClearMountPosition", "kClearPowerArmorExit", "kCount" }));
+
+static_assert(test::RoundTrips<RE::PerkValueEvents::Type>(
+	{ RE::PerkValueEvents::Type::kAdd, RE::PerkValueEvents::Type::kRemove },
+	{ "kAdd", "kRemove" }));
+
+static_assert(test::RoundTrips<RE::PipboyInventoryData::ENTRY_TYPE>(
+	{ RE::PipboyInventoryData::ENTRY_TYPE::ENTRY_INT, RE::PipboyInventoryData::ENTRY_TYPE::ENTRY_FIXED_STRING, RE::PipboyInventoryData::ENTRY_TYPE::ENTRY_FLOAT },
+	{ "ENTRY_INT", "ENTRY_FIXED_STRING", "ENTRY_FLOAT" }));
+
+static_assert(test::RoundTrips<RE::PipboyInventoryData::SORT_ON_FIELD>(
+	{ RE::PipboyInventoryData::SORT_ON_FIELD::SOF_ALPHABETICALLY, RE::PipboyInventoryData::SORT_ON_FIELD::SOF_DAMAGE, RE::PipboyInventoryData::SORT_ON_FIELD::SOF_ROF, RE::PipboyInventoryData::SORT_ON_FIELD::SOF_RANGE, RE::PipboyInventoryData::SORT_ON_FIELD::SOF_ACCURARY, RE::PipboyInventoryData::SORT_ON_FIELD::SOF_VALUE, RE::PipboyInventoryData::SORT_ON_FIELD::SOF_WEIGHT },
+	{ "SOF_ALPHABETICALLY", "SOF_DAMAGE", "SOF_ROF", "SOF_RANGE", "SOF_ACCURARY", "SOF_VALUE", "SOF_WEIGHT" }));
+
+static_assert(test::RoundTrips<RE::PipboyManager::LOWER_REASON>(
+	{ RE::PipboyManager::LOWER_REASON::kNone, RE::PipboyManager::LOWER_REASON::kBook, RE::PipboyManager::LOWER_REASON::kPerkGrid, RE::PipboyManager::LOWER_REASON::kInspect },
+	{ "kNone", "kBook", "kPerkGrid", "kInspect" }));
+
+static_assert(test::RoundTrips<RE::PipboyValue::SERIALIZATION_DATA_TYPE>(
+	{ RE::PipboyValue::SERIALIZATION_DATA_TYPE::kBool, RE::PipboyValue::SERIALIZATION_DATA_TYPE::kInt8, RE::PipboyValue::SERIALIZATION_DATA_TYPE::kUint8, RE::PipboyValue::SERIALIZATION_DATA_TYPE::kInt32, RE::PipboyValue::SERIALIZATION_DATA_TYPE::kUint32, RE::PipboyValue::SERIALIZATION_DATA_TYPE::kFloat, RE::PipboyValue::SERIALIZATION_DATA_TYPE::kString, RE::PipboyValue::SERIALIZATION_DATA_TYPE::kArray, RE::PipboyValue::SERIALIZATION_DATA_TYPE::kObject },
+	{ "kBool", "kInt8", "kUint8", "kInt32", "kUint32", "kFloat", "kString", "kArray", "kObject" }));
+
+static_assert(test::RoundTrips<RE::PlayerActiveEffectChanged::Status>(
+	{ RE::PlayerActiveEffectChanged::Status::kAdded, RE::PlayerActiveEffectChanged::Status::kRemoved, RE::PlayerActiveEffectChanged::Status::kStatusChanged },
+	{ "kAdded", "kRemoved", "kStatusChanged" }));
+
+static_assert(test::RoundTrips<RE::PlayerCharacterQuestEvent::Type>(
+	{ RE::PlayerCharacterQuestEvent::Type::kAddObjective, RE::PlayerCharacterQuestEvent::Type::kUpdateObjective, RE::PlayerCharacterQuestEvent::Type::kRemoveQuest, RE::PlayerCharacterQuestEvent::Type::kRemoveQuestTarget, RE::PlayerCharacterQuestEvent::Type::kUpdateQuestTarget },
+	{ "kAddObjective", "kUpdateObjective", "kRemoveQuest", "kRemoveQuestTarget", "kUpdateQuestTarget" }));
+
+static_assert(test::RoundTrips<RE::PositionPlayerEvent::EVENT_TYPE>(
+	{ RE::PositionPlayerEvent::EVENT_TYPE::PRE_POSITION_PLAYER, RE::PositionPlayerEvent::EVENT_TYPE::POSITION_PLAYER_PRE_UPDATE_PACKAGES, RE::PositionPlayerEvent::EVENT_TYPE::POSITION_PLAYER_POST_UPDATE_PACKAGES, RE::PositionPlayerEvent::EVENT_TYPE::POST_POSITION_PLAYER, RE::PositionPlayerEvent::EVENT_TYPE::FINISH_POSITION_PLAYER },
+	{ "PRE_POSITION_PLAYER", "POSITION_PLAYER_PRE_UPDATE_PACKAGES", "POSITION_PLAYER_POST_UPDATE_PACKAGES", "POST_POSITION_PLAYER", "FINISH_POSITION_PLAYER" }));
+
+static_assert(test::RoundTrips<RE::ProcessLists::PROCESS_LEVEL>(
+	{ RE::ProcessLists::PROCESS_LEVEL::kProcessLevel_High, RE::ProcessLists::PROCESS_LEVEL::kProcessLevel_MiddleHigh, RE::ProcessLists::PROCESS_LEVEL::kProcessLevel_MiddleLow, RE::ProcessLists::PROCESS_LEVEL::kProcessLevel_Low, RE::ProcessLists::PROCESS_LEVEL::kProcessLevel_Min, RE::ProcessLists::PROCESS_LEVEL::kProcessLevel_Max, RE::ProcessLists::PROCESS_LEVEL::kProcessLevel_Count },
+	{ "kProcessLevel_High", "kProcessLevel_MiddleHigh", "kProcessLevel_MiddleLow", "kProcessLevel_Low", "kProcessLevel_Min", "kProcessLevel_Max", "kProcessLevel_Count" }));
+
+static_assert(test::RoundTrips<RE::Property::OP>(
+	{ RE::Property::OP::kSet, RE::Property::OP::kMul, RE::Property::OP::kAnd, RE::Property::OP::kRem, RE::Property::OP::kAdd, RE::Property::OP::kOr },
+	{ "kSet", "kMul", "kAnd", "kRem", "kAdd", "kOr" }));
+
+static_assert(test::RoundTrips<RE::Property::TYPE>(
+	{ RE::Property::TYPE::kInt, RE::Property::TYPE::kFloat, RE::Property::TYPE::kBool, RE::Property::TYPE::kString, RE::Property::TYPE::kForm, RE::Property::TYPE::kEnum, RE::Property::TYPE::kPair },
+	{ "kInt", "kFloat", "kBool", "kString", "kForm", "kEnum", "kPair" }));
+
+static_assert(test::RoundTrips<RE::QUEST_DATA::Flags>(
+	{ RE::QUEST_DATA::Flags::kStopStart, RE::QUEST_DATA::Flags::kNone, RE::QUEST_DATA::Flags::kEnabled, RE::QUEST_DATA::Flags::kCompleted, RE::QUEST_DATA::Flags::kAddIdleToHello, RE::QUEST_DATA::Flags::kAllowRepeatStages, RE::QUEST_DATA::Flags::kStartsEnabled, RE::QUEST_DATA::Flags::kDisplayedInHUD, RE::QUEST_DATA::Flags::kFailed, RE::QUEST_DATA::Flags::kStageWait, RE::QUEST_DATA::Flags::kRunOnce, RE::QUEST_DATA::Flags::kExcludeFromExport, RE::QUEST_DATA::Flags::kWarnOnAliasFillFailure, RE::QUEST_DATA::Flags::kActive, RE::QUEST_DATA::Flags::kRepeatsConditions, RE::QUEST_DATA::Flags::kKeepInstance, RE::QUEST_DATA::Flags::kWantDormant, RE::QUEST_DATA::Flags::kHasDialogueData },
+	{ "kStopStart", "kNone", "kEnabled", "kCompleted", "kAddIdleToHello", "kAllowRepeatStages", "kStartsEnabled", "kDisplayedInHUD", "kFailed", "kStageWait", "kRunOnce", "kExcludeFromExport", "kWarnOnAliasFillFailure", "kActive", "kRepeatsConditions", "kKeepInstance", "kWantDormant", "kHasDialogueData" }));
+
+static_assert(test::RoundTrips<RE::QUEST_DATA::Type>(
+	{ RE::QUEST_DATA::Type::kNone, RE::QUEST_DATA::Type::kMainQuest, RE::QUEST_DATA::Type::kBrotherhoodOfSteel, RE::QUEST_DATA::Type::kInstitute, RE::QUEST_DATA::Type::kMinutemen, RE::QUEST_DATA::Type::kRailroad, RE::QUEST_DATA::Type::kMiscellaneous, RE::QUEST_DATA::Type::kSideQuest, RE::QUEST_DATA::Type::kDLC01, RE::QUEST_DATA::Type::kDLC02, RE::QUEST_DATA::Type::kDLC03, RE::QUEST_DATA::Type::kDLC04, RE::QUEST_DATA::Type::kDLC05, RE::QUEST_DATA::Type::kDLC06, RE::QUEST_DATA::Type::kDLC07 },
+	{ "kNone", "kMainQuest", "kBrotherhoodOfSteel", "kInstitute", "kMinutemen", "kRailroad", "kMiscellaneous", "kSideQuest", "kDLC01", "kDLC02", "kDLC03", "kDLC04", "kDLC05", "kDLC06", "kDLC07" }));
+
+static_assert(test::RoundTrips<RE::QuickContainerMode>(
+	{ RE::QuickContainerMode::kLoot, RE::QuickContainerMode::kTeammate, RE::QuickContainerMode::kPowerArmor, RE::QuickContainerMode::kTurret, RE::QuickContainerMode::kWorkshop, RE::QuickContainerMode::kCrafting, RE::QuickContainerMode::kStealing, RE::QuickContainerMode::kStealingPowerArmor },
+	{ "kLoot", "kTeammate", "kPowerArmor", "kTurret", "kWorkshop", "kCrafting", "kStealing", "kStealingPowerArmor" }));
+
+static_assert(test::RoundTrips<RE::RACE_SIZE>(
+	{ RE::RACE_SIZE::kSmall, RE::RACE_SIZE::kMedium, RE::RACE_SIZE::kLarge, RE::RACE_SIZE::kExtraLarge },
+	{ "kSmall", "kMedium", "kLarge", "kExtraLarge" }));
+
+static_assert(test::RoundTrips<RE::REFR_LOCK::Flags>(
+	{ RE::REFR_LOCK::Flags::kNone, RE::REFR_LOCK::Flags::kLocked, RE::REFR_LOCK::Flags::kLeveled },
+	{ "kNone", "kLocked", "kLeveled" }));
+
+static_assert(test::RoundTrips<RE::RESET_3D_FLAGS>(
+	{ RE::RESET_3D_FLAGS::kModel, RE::RESET_3D_FLAGS::kSkin, RE::RESET_3D_FLAGS::kHead, RE::RESET_3D_FLAGS::kFace, RE::RESET_3D_FLAGS::kScale, RE::RESET_3D_FLAGS::kSkeleton, RE::RESET_3D_FLAGS::kInitDefault, RE::RESET_3D_FLAGS::kSkyCellSkin, RE::RESET_3D_FLAGS::kHavok, RE::RESET_3D_FLAGS::kDontAddOutfit, RE::RESET_3D_FLAGS::kKeepHead, RE::RESET_3D_FLAGS::kDismemberment },
+	{ "kModel", "kSkin", "kHead", "kFace", "kScale", "kSkeleton", "kInitDefault", "kSkyCellSkin", "kHavok", "kDontAddOutfit", "kKeepHead", "kDismemberment" }));
+
+static_assert(test::RoundTrips<RE::SCRIPT_OUTPUT>(
+	{ RE::SCRIPT_OUTPUT::START_OF_FLOW_SECTION, RE::SCRIPT_OUTPUT::FLOW_BEGIN, RE::SCRIPT_OUTPUT::FLOW_END, RE::SCRIPT_OUTPUT::FLOW_SHORT, RE::SCRIPT_OUTPUT::FLOW_LONG, RE::SCRIPT_OUTPUT::FLOW_FLOAT, RE::SCRIPT_OUTPUT::FLOW_SET, RE::SCRIPT_OUTPUT::FLOW_IF, RE::SCRIPT_OUTPUT::FLOW_ELSE, RE::SCRIPT_OUTPUT::FLOW_ELSEIF, RE::SCRIPT_OUTPUT::FLOW_ENDIF, RE::SCRIPT_OUTPUT::FLOW_WHILE, RE::SCRIPT_OUTPUT::FLOW_ENDWHILE, RE::SCRIPT_OUTPUT::FLOW_REFERENCE_FUNCTION, RE::SCRIPT_OUTPUT::FLOW_SCRIPTNAME, RE::SCRIPT_OUTPUT::FLOW_RETURN, RE::SCRIPT_OUTPUT::FLOW_REF, RE::SCRIPT_OUTPUT::END_OF_FLOW_SECTION, RE::SCRIPT_OUTPUT::FLOW_COUNT, RE::SCRIPT_OUTPUT::START_OF_CONSOLE_SECTION, RE::SCRIPT_OUTPUT::FUNCTION_SHOW, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_VARS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_GLOBAL_VARS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_QUEST_VARS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_QUESTS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_QUEST_ALIASES, RE::SCRIPT_OUTPUT::FUNCTION_SET_PAPYRUS_QUEST_VAR, RE::SCRIPT_OUTPUT::FUNCTION_SET_PAPYRUS_VAR, RE::SCRIPT_OUTPUT::FUNCTION_SET_QUEST_ALIASES, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_QUEST_ALIASES, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_COMBAT_STATS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SAFE_ZONE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_AI, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_CG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_HRHG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_BORDERS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SKY, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_WIREFRAME, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_COLLISION, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_DEBUG_TEXT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MENUS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_PRIMITIVES, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_SCENEGRAPH, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_FULL_SCENEGRAPH, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MAGIC_STATS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_ANIM, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_1ST_PERSON, RE::SCRIPT_OUTPUT::FUNCTION_HELP, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_NAVMESH, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_PATHLINE, RE::SCRIPT_OUTPUT::FUNCTION_PICK_REF_BY_ID, RE::SCRIPT_OUTPUT::FUNCTION_PICK_LAST_REF, RE::SCRIPT_OUTPUT::FUNCTION_PICK_NEXT_REF, RE::SCRIPT_OUTPUT::FUNCTION_PICK_NEXT_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_PICK_CLOSEST_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_GET_SELECTED_REF, RE::SCRIPT_OUTPUT::FUNCTION_IS_LAST_REF, RE::SCRIPT_OUTPUT::FUNCTION_LIGHTING_PASSES, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_LOD_LAND, RE::SCRIPT_OUTPUT::FUNCTION_TRIGGER_PIPBOY_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_CHARACTER_LIGHT, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_LIGHT_BOUNDS, RE::SCRIPT_OUTPUT::FUNCTION_VATS_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_AO, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SAO, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MB, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SSR, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SSSSS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_FXAA, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_TAA, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_HDRCS, RE::SCRIPT_OUTPUT::FUNCTION_VIEW_GBUFFER, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_COMBINED_WEAPON, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_COMBINEMODE_GPU, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_WEAPON_COMBINATION, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_WEAPON_COMBINATION_BOUNDS, RE::SCRIPT_OUTPUT::FUNCTION_THREADS_MESHCOMBINER, RE::SCRIPT_OUTPUT::FUNCTION_COMBINED_OBJECT_WEAPON, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_HANDS_CULLED, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_BOKEH, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_LENSFLARE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SUNBEAMS, RE::SCRIPT_OUTPUT::FUNCTION_RENDER_LOCAL_MAP, RE::SCRIPT_OUTPUT::FUNCTION_SET_LOD_OBJECT_DISTANCE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_GRASS_UPDATE, RE::SCRIPT_OUTPUT::FUNCTION_CENTER_ON_CELL, RE::SCRIPT_OUTPUT::FUNCTION_SET_GAMESETTING, RE::SCRIPT_OUTPUT::FUNCTION_SET_INISETTING, RE::SCRIPT_OUTPUT::FUNCTION_GET_INISETTING, RE::SCRIPT_OUTPUT::FUNCTION_CENTER_ON_EXTERIOR, RE::SCRIPT_OUTPUT::FUNCTION_CALC_PATH_TO_POINT, RE::SCRIPT_OUTPUT::FUNCTION_CALC_LOWPATH_TO_POINT, RE::SCRIPT_OUTPUT::FUNCTION_SET_FOG_DEPTH, RE::SCRIPT_OUTPUT::FUNCTION_SET_CLIP_DIST, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SHADOW_VOLUMES, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_WETNESS, RE::SCRIPT_OUTPUT::FUNCTION_SET_WORLD_WETNESS_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_SET_WORLD_RAIN_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_SET_IMAGE_SPACE_GLOW, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_DETECTION, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_HIGHPROCESS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_LOWPROCESS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MIDDLELOWPROCESS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MIDDLEHIGHPROCESS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_AISCHEDULES, RE::SCRIPT_OUTPUT::FUNCTION_SPEAK_SOUND, RE::SCRIPT_OUTPUT::FUNCTION_BETA_COMMENT, RE::SCRIPT_OUTPUT::FUNCTION_GAME_COMMENT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_CELL_NODE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_TREES, RE::SCRIPT_OUTPUT::FUNCTION_CAMERA_FOV, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_GOD_MODE, RE::SCRIPT_OUTPUT::FUNCTION_RELOAD_SHADERS, RE::SCRIPT_OUTPUT::FUNCTION_RELOAD_FXP, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SCRIPTS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_CONVERSATION_STATS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_FULL_HELP, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_QUEST_LOG, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_FULL_QUEST_LOG, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_TEXTURE_PALETTE, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_MODEL_MAP, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_SOUND_MAP, RE::SCRIPT_OUTPUT::FUNCTION_CENTER_ON_WORLD, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_GRASS, RE::SCRIPT_OUTPUT::FUNCTION_CREATE_GRASS_AT, RE::SCRIPT_OUTPUT::FUNCTION_ADD_FACE_ANIM_NOTE, RE::SCRIPT_OUTPUT::FUNCTION_REFRESH_INI, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_EMOTIONS, RE::SCRIPT_OUTPUT::FUNCTION_ADD_DECAL, RE::SCRIPT_OUTPUT::FUNCTION_TESTCODE, RE::SCRIPT_OUTPUT::FUNCTION_PLAYER_SPELLBOOK, RE::SCRIPT_OUTPUT::FUNCTION_AI_PROCESS_LISTS_PRINT, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_QUEST_TARGETS, RE::SCRIPT_OUTPUT::FUNCTION_HAIR_TINT, RE::SCRIPT_OUTPUT::FUNCTION_SAVE_GAME, RE::SCRIPT_OUTPUT::FUNCTION_LOAD_GAME, RE::SCRIPT_OUTPUT::FUNCTION_DISPLAY_PLAYER_IDS, RE::SCRIPT_OUTPUT::FUNCTION_SET_DISPLAY_PLAYER_ID, RE::SCRIPT_OUTPUT::FUNCTION_TEST_ALL_CELLS, RE::SCRIPT_OUTPUT::FUNCTION_RENDERTESTCELL, RE::SCRIPT_OUTPUT::FUNCTION_RENDERTESTHERE, RE::SCRIPT_OUTPUT::FUNCTION_SAVE_WORLD, RE::SCRIPT_OUTPUT::FUNCTION_RELOAD_CURRENT_CLIMATE, RE::SCRIPT_OUTPUT::FUNCTION_RELOAD_CURRENT_WEATHER, RE::SCRIPT_OUTPUT::FUNCTION_TESTSEENDATA, RE::SCRIPT_OUTPUT::FUNCTION_TESTLOCALMAP, RE::SCRIPT_OUTPUT::FUNCTION_MOVE_TO_QUEST_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_PRINT_NPC_DIALOG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SUBTITLE, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_RENDER_PASSES, RE::SCRIPT_OUTPUT::FUNCTION_FREEZE_RENDER_ACCUM, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_OCCLUSION, RE::SCRIPT_OUTPUT::FUNCTION_OUTPUT_MEM_CONTEXTS, RE::SCRIPT_OUTPUT::FUNCTION_OUTPUT_MEM_STATS, RE::SCRIPT_OUTPUT::FUNCTION_SET_MEM_CHECK_POINT, RE::SCRIPT_OUTPUT::FUNCTION_GET_MEM_CHECK_POINT, RE::SCRIPT_OUTPUT::FUNCTION_INC_MEM_CHECK_POINT, RE::SCRIPT_OUTPUT::FUNCTION_OUTPUT_ALLOCATIONS, RE::SCRIPT_OUTPUT::FUNCTION_ADD_WATCH_ADDRESS, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_WATCH_ADDRESS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLEDETECTIONSTATS, RE::SCRIPT_OUTPUT::FUNCTION_SETTARGETREFRACTION, RE::SCRIPT_OUTPUT::FUNCTION_SETTARGETREFRACTIONFIRE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLEREFRACTIONDEBUG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_TCCS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_HEADTRACK_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_SET_CINEMATIC_PARAM, RE::SCRIPT_OUTPUT::FUNCTION_SET_TINT_PARAM, RE::SCRIPT_OUTPUT::FUNCTION_SET_HDR_PARAM, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_REF_POS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_PIVOT, RE::SCRIPT_OUTPUT::FUNCTION_PRINT_HDR_PARAM, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_HDR_DEBUG, RE::SCRIPT_OUTPUT::FUNCTION_REVERT_WORLD, RE::SCRIPT_OUTPUT::FUNCTION_OUTPUT_ARCHIVE_PROFILE, RE::SCRIPT_OUTPUT::FUNCTION_QUITGAME, RE::SCRIPT_OUTPUT::FUNCTION_SCREENSHOT, RE::SCRIPT_OUTPUT::FUNCTION_SAVEINI, RE::SCRIPT_OUTPUT::FUNCTION_SET_DEBUG_TEXT, RE::SCRIPT_OUTPUT::FUNCTION_GET_DEBUG_TEXT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLELITEBRITE, RE::SCRIPT_OUTPUT::FUNCTION_RUN_MEMORY_PASS, RE::SCRIPT_OUTPUT::FUNCTION_RESET_MEM_CONTEXTS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_WATER_SYSTEM, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_WATER_RADIUS, RE::SCRIPT_OUTPUT::FUNCTION_ACTORS_WHO_DETECT_PLAYER, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_COMBAT_AI, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_GAMEPAUSE, RE::SCRIPT_OUTPUT::FUNCTION_STEP_ONE_FRAME, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_FLYCAM, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_FXCAM, RE::SCRIPT_OUTPUT::FUNCTION_MOD_WATER_SHADER, RE::SCRIPT_OUTPUT::FUNCTION_MOD_WATER_COLOR, RE::SCRIPT_OUTPUT::FUNCTION_BEGIN_TRACE, RE::SCRIPT_OUTPUT::FUNCTION_RUN_CELL_TEST, RE::SCRIPT_OUTPUT::FUNCTION_START_ALL_QUESTS, RE::SCRIPT_OUTPUT::FUNCTION_COMPLETE_ALL_QUEST_STAGES, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_FOG_OF_WAR, RE::SCRIPT_OUTPUT::FUNCTION_OUTPUT_LOCAL_MAP, RE::SCRIPT_OUTPUT::FUNCTION_SET_GAMMA, RE::SCRIPT_OUTPUT::FUNCTION_WASTE_MEMORY, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_ADAPTEDLIGHT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_CAST_SHADOWS, RE::SCRIPT_OUTPUT::FUNCTION_SET_HUD_GLOW_CONSTANTS, RE::SCRIPT_OUTPUT::FUNCTION_CLOSE_FILE, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_MIPMAP_BIAS, RE::SCRIPT_OUTPUT::FUNCTION_SEND_DEBUG_TEXT, RE::SCRIPT_OUTPUT::FUNCTION_OUTPUT_MEM_STATS_FULL_WALK, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_EXPLOSION, RE::SCRIPT_OUTPUT::FUNCTION_SET_DEPTH_OF_FIELD, RE::SCRIPT_OUTPUT::FUNCTION_SET_DEPTH_OF_FIELD_RANGE, RE::SCRIPT_OUTPUT::FUNCTION_SETTARGETDOF, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLEFULLSCREENMOTIONBLUR, RE::SCRIPT_OUTPUT::FUNCTION_SETMOTIONBLUR, RE::SCRIPT_OUTPUT::FUNCTION_SET_VEL, RE::SCRIPT_OUTPUT::FUNCTION_DEBUG_COMBAT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_COMBAT_DEBUG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_PATHING_INFO, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_INVENTORY, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_INVENTORY_VARS, RE::SCRIPT_OUTPUT::FUNCTION_RESET_PERFORMANCE_TIMERS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_DECAL_DEBUG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_DECAL_RENDERING, RE::SCRIPT_OUTPUT::FUNCTION_SET_IMAGESPACE_MODIFIERS_ENABLE, RE::SCRIPT_OUTPUT::FUNCTION_SET_FREE_CAM_SPEED_MULT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_TESTLIGHT, RE::SCRIPT_OUTPUT::FUNCTION_PLACE_LOCATION_MARKER, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_LOCATION_MARKERS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MULTIBOUND, RE::SCRIPT_OUTPUT::FUNCTION_ADD_OCCLUSIONPLANE, RE::SCRIPT_OUTPUT::FUNCTION_SET_GLOBAL_RADIAL_BLUR, RE::SCRIPT_OUTPUT::FUNCTION_OUTPUT_TEXTUREUSEMAP, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_SCREEN_BLOOD, RE::SCRIPT_OUTPUT::FUNCTION_RESET_DIALOGUE_FLAGS, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_VALUE_INFO, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLEBOUNDVIS, RE::SCRIPT_OUTPUT::FUNCTION_SET_CONSOLE_OUPUT_FILE, RE::SCRIPT_OUTPUT::FUNCTION_IGNORE_RENDER_PASS, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_VATS_CAMERAS, RE::SCRIPT_OUTPUT::FUNCTION_SETTARGETFALLOFF, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_ACTOR_MOVER, RE::SCRIPT_OUTPUT::FUNCTION_COPY_SAVE_GAMES, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLEIMAGESPACE, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_FILE_CACHE, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_NI_UPDATES, RE::SCRIPT_OUTPUT::FUNCTION_TEST_DEGRADE_TEX, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_DEPTH_BIAS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SPU_RENDER_BATCH, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SPU_TRANSFORM_UPDATE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SPU_CULLING, RE::SCRIPT_OUTPUT::FUNCTION_MODIFY_FACEGEN, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_RSX_CRASH, RE::SCRIPT_OUTPUT::FUNCTION_SET_EMITTER_PARTICLE_MAX, RE::SCRIPT_OUTPUT::FUNCTION_SET_MPS_PARTICLE_MAX, RE::SCRIPT_OUTPUT::FUNCTION_SET_TASK_THREAD_SLEEP, RE::SCRIPT_OUTPUT::FUNCTION_SET_TASK_THREAD_UPDATE_SLEEP, RE::SCRIPT_OUTPUT::FUNCTION_EVAL_ACTOR_TEXTURES, RE::SCRIPT_OUTPUT::FUNCTION_CREATE_SAVE_DATA, RE::SCRIPT_OUTPUT::FUNCTION_CREATE_GAME_DATA, RE::SCRIPT_OUTPUT::FUNCTION_LOAD_FLASH_MOVIE, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_MENU, RE::SCRIPT_OUTPUT::FUNCTION_HIDE_MENU, RE::SCRIPT_OUTPUT::FUNCTION_RECV_ANIM_EVENT, RE::SCRIPT_OUTPUT::FUNCTION_RUN_CONSOLE_BATCH, RE::SCRIPT_OUTPUT::FUNCTION_SET_MOVEMENT_GRAPH, RE::SCRIPT_OUTPUT::FUNCTION_SET_LOOKING_GRAPH, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_HEAP_TRACKING, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_POOL_TRACKING, RE::SCRIPT_OUTPUT::FUNCTION_RUMBLE_MANAGER, RE::SCRIPT_OUTPUT::FUNCTION_INSTALL_MEMORY_TRACKER, RE::SCRIPT_OUTPUT::FUNCTION_UNINSTALL_MEMORY_TRACKER, RE::SCRIPT_OUTPUT::FUNCTION_CHECK_MEMORY, RE::SCRIPT_OUTPUT::FUNCTION_SET_STACK_DEPTH, RE::SCRIPT_OUTPUT::FUNCTION_PATH_TO_REF, RE::SCRIPT_OUTPUT::FUNCTION_START_PLAYER_TEST_PATH, RE::SCRIPT_OUTPUT::FUNCTION_TEST_HANDLE_MANAGER_SHUTDOWN, RE::SCRIPT_OUTPUT::FUNCTION_SET_FACE_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_PRECOMPUTED_LOS_GENERATION, RE::SCRIPT_OUTPUT::FUNCTION_PRECOMPUTED_LOS_DEBUG, RE::SCRIPT_OUTPUT::FUNCTION_GENERATE_COVER_EDGES, RE::SCRIPT_OUTPUT::FUNCTION_GENERATE_COVER_DEBUG, RE::SCRIPT_OUTPUT::FUNCTION_SET_PATH_SPRINTING, RE::SCRIPT_OUTPUT::FUNCTION_SET_ANIM_GRAPH_VAR, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_TRUNK_FLEXIBILITY, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_BRANCH_FLEXIBILITY, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_BRANCH_ANIMATION_RANGE, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_LEAF_FLEXIBILITY, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_LEAF_AMPLITUDE, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_LEAF_FREQUENCY, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_WIND_DIRECTION, RE::SCRIPT_OUTPUT::FUNCTION_SET_TREE_WIND_MAGNITUDE, RE::SCRIPT_OUTPUT::FUNCTION_SET_BLOOD_PARAM, RE::SCRIPT_OUTPUT::FUNCTION_REGISTER_PREFIX, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_EVENT_LOG, RE::SCRIPT_OUTPUT::FUNCTION_EXPORT_PERF_TRACKING_DATA, RE::SCRIPT_OUTPUT::FUNCTION_DISPLAY_GRAPH_VARIABLE, RE::SCRIPT_OUTPUT::FUNCTION_SET_MOTION_DRIVEN, RE::SCRIPT_OUTPUT::FUNCTION_SET_CONTROLS_DRIVEN, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_GUI_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_MODIFY_GUI_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_ADD_CUSTOM_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_SET_CUSTOM_OVERLAY_FORM, RE::SCRIPT_OUTPUT::FUNCTION_CLOSE_CUSTOM_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_SET_CURRENT_SCENE_ACTION_COMPLETE, RE::SCRIPT_OUTPUT::FUNCTION_SET_CONSOLE_SCOPE_QUEST, RE::SCRIPT_OUTPUT::FUNCTION_GET_DISTANCE_FROM_ACTOR_S_PATH, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_CONSOLE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MARKERS, RE::SCRIPT_OUTPUT::FUNCTION_KILL_ALL_PROJECTILES, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_TERRAIN_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_CELLINFO, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_TEXTURES, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_TIMING, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_POLYGONS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_ACTORS_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_QUEST_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_PARTICLES_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MEMORY, RE::SCRIPT_OUTPUT::FUNCTION_FILE_STREAMER_STATS, RE::SCRIPT_OUTPUT::FUNCTION_SET_GRAPHIC_MEMORY_HYSTERESIS, RE::SCRIPT_OUTPUT::FUNCTION_ALLOCATE_GRAPHIC_MEMORY, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_NODES, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_BONES, RE::SCRIPT_OUTPUT::FUNCTION_DPAGE_SNAPSHOT, RE::SCRIPT_OUTPUT::FUNCTION_OUTPUT_FIXED_STRING_TABLE, RE::SCRIPT_OUTPUT::FUNCTION_ATTACH_PAPYRUS_SCRIPT, RE::SCRIPT_OUTPUT::FUNCTION_SAVE_HAVOK_SNAPSHOT, RE::SCRIPT_OUTPUT::FUNCTION_SET_NPC_WEIGHT, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_CLOSEST_LOCATION_FOR_SPHERE, RE::SCRIPT_OUTPUT::FUNCTION_PRINT_SHADER_MACROS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_AUDIO_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_PAPYRUS_LOG, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_CONTEXT_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_OUT_OF_MEMORY, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MOVEMENT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_ANIMATIONS, RE::SCRIPT_OUTPUT::FUNCTION_SET_WARNING, RE::SCRIPT_OUTPUT::FUNCTION_TEST_FADENODES, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_LOW_MAXHEIGHTS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_HIGH_MAXHEIGHTS, RE::SCRIPT_OUTPUT::FUNCTION_ENABLE_STORY_MANAGER_LOGGING, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_PAPYRUS_LOGS, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_PAPYRUS_TIMERS, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_PAPYRUS_LOS_EVENTS, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_PAPYRUS_DISTANCE_EVENTS, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_PAPYRUS_PERSISTENCE_INFO, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_PAPYRUS_EVENT_REGISTRATIONS, RE::SCRIPT_OUTPUT::FUNCTION_SOUND_CAT_MOD, RE::SCRIPT_OUTPUT::FUNCTION_RUN_COMPACTION, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_ANIMATOR_CAM, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_IMMORTAL_MODE, RE::SCRIPT_OUTPUT::FUNCTION_SET_SUBGRAPH_TO_DEBUG, RE::SCRIPT_OUTPUT::FUNCTION_ENABLE_RUMBLE, RE::SCRIPT_OUTPUT::FUNCTION_HAVOK_VDB_CAPTURE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MAP_CAMERA, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_NAVMESH_INFO, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_SYNC_ANIM, RE::SCRIPT_OUTPUT::FUNCTION_SET_FORM_KNOWN, RE::SCRIPT_OUTPUT::FUNCTION_SET_DEBUG_QUEST, RE::SCRIPT_OUTPUT::FUNCTION_SET_QUEST_ALIAS_LOGGING, RE::SCRIPT_OUTPUT::FUNCTION_SET_RACE, RE::SCRIPT_OUTPUT::FUNCTION_FIND_FORM, RE::SCRIPT_OUTPUT::FUNCTION_START_PAPYRUS_SCRIPT_PROFILE, RE::SCRIPT_OUTPUT::FUNCTION_STOP_PAPYRUS_SCRIPT_PROFILE, RE::SCRIPT_OUTPUT::FUNCTION_START_PAPYRUS_FORM_PROFILE, RE::SCRIPT_OUTPUT::FUNCTION_STOP_PAPYRUS_FORM_PROFILE, RE::SCRIPT_OUTPUT::FUNCTION_START_PAPYRUS_STACK_ROOT_PROFILE, RE::SCRIPT_OUTPUT::FUNCTION_STOP_PAPYRUS_STACK_ROOT_PROFILE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_PAPYRUS_GLOBAL_PROFILE, RE::SCRIPT_OUTPUT::FUNCTION_PRINT_QUEST_SCENE_INFO, RE::SCRIPT_OUTPUT::FUNCTION_IS_INVULNERABLE, RE::SCRIPT_OUTPUT::FUNCTION_EXPORT_INVENTORY_ITEM_INFO, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_COLLISION_MESH, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_HAVOK_STEP_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_ISOLATE_RENDERING, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_WATER_CURRENT_GEOMETRY, RE::SCRIPT_OUTPUT::FUNCTION_PERFORM_ACTION, RE::SCRIPT_OUTPUT::FUNCTION_START_TRACK_PLAYER_DOORS, RE::SCRIPT_OUTPUT::FUNCTION_STOP_TRACK_PLAYER_DOORS, RE::SCRIPT_OUTPUT::FUNCTION_CHECK_PLAYER_DOORS, RE::SCRIPT_OUTPUT::FUNCTION_SET_IN_CHARGEN, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_ACHIEVEMENT, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_RESET, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_CLOSE_FILES, RE::SCRIPT_OUTPUT::FUNCTION_HOT_LOAD_PLUGIN, RE::SCRIPT_OUTPUT::FUNCTION_GENERATE_BENDABLE_SPLINE, RE::SCRIPT_OUTPUT::FUNCTION_RELOAD_SCRIPT, RE::SCRIPT_OUTPUT::FUNCTION_TEST_AIM, RE::SCRIPT_OUTPUT::FUNCTION_PUSH_CAMERA, RE::SCRIPT_OUTPUT::FUNCTION_MOVE_TO_EDITOR_CAMERA, RE::SCRIPT_OUTPUT::FUNCTION_MOVE_TO_EDITOR_SELECTION, RE::SCRIPT_OUTPUT::FUNCTION_PLACE_FURN_TEST, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_CONDITION_FUNCTIONS, RE::SCRIPT_OUTPUT::FUNCTION_RELOAD_ANIMATION_GRAPHS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_HUD_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_SET_HUD_OVERLAY_MODE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_WEAPON_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_DETECT, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_ANIMATION_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_WARNINGS_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_SPECIAL_MENU, RE::SCRIPT_OUTPUT::FUNCTION_CHANGE_ANIM_ARCHETYPE, RE::SCRIPT_OUTPUT::FUNCTION_CHANGE_ANIM_FLAVOR, RE::SCRIPT_OUTPUT::FUNCTION_SET_ANGRY_WITH_PLAYER, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_REPATH, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_PATH_FAILURE, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_FORMLIST, RE::SCRIPT_OUTPUT::FUNCTION_TRACE_ANIM_EVENTS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_MODS, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_INPUT_ENABLE_LAYERS, RE::SCRIPT_OUTPUT::FUNCTION_ATTACH_MOD, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_MOD, RE::SCRIPT_OUTPUT::FUNCTION_SPAWN_TEMPLATED_OBJECT, RE::SCRIPT_OUTPUT::FUNCTION_CALL_PAPYRUS_FUNCTION, RE::SCRIPT_OUTPUT::FUNCTION_CALL_QUEST_PAPYRUS_FUNCTION, RE::SCRIPT_OUTPUT::FUNCTION_CALL_GLOBAL_PAPYRUS_FUNCTION, RE::SCRIPT_OUTPUT::FUNCTION_RESET_INPUT_ENABLE_LAYER, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_ENABLE_PLAYER_CONTROLS, RE::SCRIPT_OUTPUT::FUNCTION_RESET_FORCE_ENABLED_PLAYER_CONTROLS, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_OWNER, RE::SCRIPT_OUTPUT::FUNCTION_SET_ACTOR_OWNER, RE::SCRIPT_OUTPUT::FUNCTION_HAS_ACTOR_OWNER, RE::SCRIPT_OUTPUT::FUNCTION_SET_OUTFIT, RE::SCRIPT_OUTPUT::FUNCTION_PASS_TIME, RE::SCRIPT_OUTPUT::FUNCTION_LINK_LOCATIONS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_LINKED_LOCATIONS, RE::SCRIPT_OUTPUT::FUNCTION_SET_LINKED_REF, RE::SCRIPT_OUTPUT::FUNCTION_RESET_CONTAINER, RE::SCRIPT_OUTPUT::FUNCTION_SET_DEBUG_SCENE, RE::SCRIPT_OUTPUT::FUNCTION_PRELOAD_EXTERIOR, RE::SCRIPT_OUTPUT::FUNCTION_TEST_PATH, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_CONTROLS_OVERLAY, RE::SCRIPT_OUTPUT::FUNCTION_REFRESH, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MTR, RE::SCRIPT_OUTPUT::FUNCTION_DYNAMIC_RESOLUTION, RE::SCRIPT_OUTPUT::FUNCTION_TEST_LOADING_MENU, RE::SCRIPT_OUTPUT::FUNCTION_RECALC_INSTANCE_DATA, RE::SCRIPT_OUTPUT::FUNCTION_DISMEMBER, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_REF_POSE, RE::SCRIPT_OUTPUT::FUNCTION_PYCONSOLE, RE::SCRIPT_OUTPUT::FUNCTION_LUACONSOLE, RE::SCRIPT_OUTPUT::FUNCTION_SET_PERSIST_LOC, RE::SCRIPT_OUTPUT::FUNCTION_SET_LOC_REF_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_LOC_DATA, RE::SCRIPT_OUTPUT::FUNCTION_RESERVE_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_UPDATE_AWAKE_SOUND, RE::SCRIPT_OUTPUT::FUNCTION_PRINT_AUDIO_DEVICE_INFO, RE::SCRIPT_OUTPUT::FUNCTION_SET_HARVESTED, RE::SCRIPT_OUTPUT::FUNCTION_PAUSE_SCENE, RE::SCRIPT_OUTPUT::FUNCTION_SPAWN_DUPE, RE::SCRIPT_OUTPUT::FUNCTION_COMBINE_LOADED_OBJECTS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_COMBINED_OBJECTS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_MESH_LOD, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_KILL_SOUND, RE::SCRIPT_OUTPUT::FUNCTION_DISABLE_DISTANT_REFERENCES, RE::SCRIPT_OUTPUT::FUNCTION_FIRE_ASSERT, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_PERSISTENT, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_EVENT_CAMERA, RE::SCRIPT_OUTPUT::FUNCTION_CHANGE_STANCE, RE::SCRIPT_OUTPUT::FUNCTION_AUDITION_SOUND_DESCRIPTOR, RE::SCRIPT_OUTPUT::FUNCTION_PUSH_SOUND_CATEGORY_SNAPSHOT, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_SOUND_CATEGORY_SNAPSHOT, RE::SCRIPT_OUTPUT::FUNCTION_BUILD_ANIMATION_DATA, RE::SCRIPT_OUTPUT::FUNCTION_SET_NUM_MTR_JOBS, RE::SCRIPT_OUTPUT::FUNCTION_SWITCH_SKELETON, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_GREETING, RE::SCRIPT_OUTPUT::FUNCTION_CAPTURE_NEXT_FRAME_GPU, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_PRECULLING, RE::SCRIPT_OUTPUT::FUNCTION_HIDE_NONOCCLUDERS, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_POWER_GRIDS, RE::SCRIPT_OUTPUT::FUNCTION_SET_BONE_TINT_REGION, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_CONTEXTROLL_OPTIM, RE::SCRIPT_OUTPUT::FUNCTION_SEND_DIALOGUE_EVENT, RE::SCRIPT_OUTPUT::FUNCTION_REFRESH_GLOBAL_TEXTURE, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_SPEECHCHALLENGEALWAYSSUCCEED, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_SPEECHCHALLENGEALWAYSFAIL, RE::SCRIPT_OUTPUT::FUNCTION_RUN_MATERIALS_ANALYSIS, RE::SCRIPT_OUTPUT::FUNCTION_CAPTURE_MESSAGES, RE::SCRIPT_OUTPUT::FUNCTION_SET_SSR_INTENSITY, RE::SCRIPT_OUTPUT::FUNCTION_SET_SSR_BLENDING_POWER, RE::SCRIPT_OUTPUT::FUNCTION_SET_SSR_ANGLE_THRESHOLD, RE::SCRIPT_OUTPUT::FUNCTION_SET_SSR_EDGE_FADE_FACTOR, RE::SCRIPT_OUTPUT::FUNCTION_SET_SSR_VERTICAL_BLUR_POWER, RE::SCRIPT_OUTPUT::FUNCTION_SET_SSR_VERTICAL_ALIGNMENT_POWER, RE::SCRIPT_OUTPUT::FUNCTION_SET_SSR_VERTICAL_STRETCHING_POWER, RE::SCRIPT_OUTPUT::FUNCTION_SET_SSR_RAY_STEP_SCALE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_ZPREPASS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_RAIN_OCCLUSION, RE::SCRIPT_OUTPUT::FUNCTION_SET_GPU_MEMORY_PRIORITY, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_RAIN_SPLASH, RE::SCRIPT_OUTPUT::FUNCTION_CAPTURE_MESSAGE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_TRIJUICE, RE::SCRIPT_OUTPUT::FUNCTION_SET_PRESENT_THRESHOLD, RE::SCRIPT_OUTPUT::FUNCTION_LOGIN, RE::SCRIPT_OUTPUT::FUNCTION_LOGIN_SSO, RE::SCRIPT_OUTPUT::FUNCTION_LOGOUT, RE::SCRIPT_OUTPUT::FUNCTION_IS_LOGGED_IN, RE::SCRIPT_OUTPUT::FUNCTION_CREATE_ACCOUNT, RE::SCRIPT_OUTPUT::FUNCTION_LINK_ACCOUNT, RE::SCRIPT_OUTPUT::FUNCTION_UNLINK_ACCOUNT, RE::SCRIPT_OUTPUT::FUNCTION_REQUEST_OTP, RE::SCRIPT_OUTPUT::FUNCTION_VERIFY_OTP, RE::SCRIPT_OUTPUT::FUNCTION_GET_LEGAL_DOCS, RE::SCRIPT_OUTPUT::FUNCTION_ACCEPT_LEGAL_DOC, RE::SCRIPT_OUTPUT::FUNCTION_SUBSCRIBE_UGC, RE::SCRIPT_OUTPUT::FUNCTION_UNSUBSCRIBE_UGC, RE::SCRIPT_OUTPUT::FUNCTION_GET_SUBSCRIBED_LIST, RE::SCRIPT_OUTPUT::FUNCTION_FOLLOW_UGC, RE::SCRIPT_OUTPUT::FUNCTION_UNFOLLOW_UGC, RE::SCRIPT_OUTPUT::FUNCTION_GET_FOLLOWED_LIST, RE::SCRIPT_OUTPUT::FUNCTION_GET_UGC_DETAILS, RE::SCRIPT_OUTPUT::FUNCTION_DOWNLOAD_UGC, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MTR_DEFERRED_LIGHTS, RE::SCRIPT_OUTPUT::FUNCTION_NV_GODRAY_SETTINGS, RE::SCRIPT_OUTPUT::FUNCTION_NV_FLEX_SETTINGS, RE::SCRIPT_OUTPUT::FUNCTION_NV_HBAO_SETTINGS, RE::SCRIPT_OUTPUT::FUNCTION_EXPORT_WORKSHOP_POWER_GRID, RE::SCRIPT_OUTPUT::FUNCTION_ENTER_WORKSHOP_MODE, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_VBLANK_OPTIM, RE::SCRIPT_OUTPUT::FUNCTION_PROCESS_VALID_DISMEMBERMENTS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_SEGMENT_VISIBILITY, RE::SCRIPT_OUTPUT::FUNCTION_ADD_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_SET_AMBIENT_PARTICLES_ENABLED, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_DOQM, RE::SCRIPT_OUTPUT::FUNCTION_SCRAP_ALL, RE::SCRIPT_OUTPUT::FUNCTION_GET_BUDGET_COUNTS, RE::SCRIPT_OUTPUT::FUNCTION_WORKSHOP_BUDGET, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_LOOKAT_DEBUG, RE::SCRIPT_OUTPUT::FUNCTION_SET_ESRAM_SETUP, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_ESRAM, RE::SCRIPT_OUTPUT::FUNCTION_SET_BOOKVIEWPORT, RE::SCRIPT_OUTPUT::FUNCTION_SET_BOOKOFFSET, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_MTA, RE::SCRIPT_OUTPUT::FUNCTION_SET_PRESENT_INTERVAL, RE::SCRIPT_OUTPUT::FUNCTION_SET_CALLSTACK_DEPTH, RE::SCRIPT_OUTPUT::FUNCTION_COMMANDED_ACTIVATE, RE::SCRIPT_OUTPUT::FUNCTION_STORE_IN_WORKSHOP, RE::SCRIPT_OUTPUT::FUNCTION_EXPORT_INR_TO_FILE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ORBIS_MOD_INFO, RE::SCRIPT_OUTPUT::END_OF_CONSOLE_SECTION, RE::SCRIPT_OUTPUT::CONSOLE_COUNT, RE::SCRIPT_OUTPUT::START_OF_FUNCTION_SECTION, RE::SCRIPT_OUTPUT::FUNCTION_GET_WANT_BLOCKING, RE::SCRIPT_OUTPUT::FUNCTION_GET_DISTANCE, RE::SCRIPT_OUTPUT::FUNCTION_ADD_ITEM, RE::SCRIPT_OUTPUT::FUNCTION_SET_ESSENTIAL, RE::SCRIPT_OUTPUT::FUNCTION_ROTATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_LOCKED, RE::SCRIPT_OUTPUT::FUNCTION_GET_POS, RE::SCRIPT_OUTPUT::FUNCTION_SET_POS, RE::SCRIPT_OUTPUT::FUNCTION_GET_ANGLE, RE::SCRIPT_OUTPUT::FUNCTION_SET_ANGLE, RE::SCRIPT_OUTPUT::FUNCTION_GET_STARTING_POS, RE::SCRIPT_OUTPUT::FUNCTION_GET_STARTING_ANGLE, RE::SCRIPT_OUTPUT::FUNCTION_GET_SECONDS_PASSED, RE::SCRIPT_OUTPUT::FUNCTION_ACTIVATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_SET_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_MOD_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_SET_AT_START, RE::SCRIPT_OUTPUT::FUNCTION_GET_CURRENT_TIME, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_GROUP, RE::SCRIPT_OUTPUT::FUNCTION_LOOP_GROUP, RE::SCRIPT_OUTPUT::FUNCTION_SKIP_ANIM, RE::SCRIPT_OUTPUT::FUNCTION_START_COMBAT, RE::SCRIPT_OUTPUT::FUNCTION_STOP_COMBAT, RE::SCRIPT_OUTPUT::FUNCTION_GET_SCALE, RE::SCRIPT_OUTPUT::FUNCTION_IS_MOVING, RE::SCRIPT_OUTPUT::FUNCTION_IS_TURNING, RE::SCRIPT_OUTPUT::FUNCTION_GET_LINE_OF_SIGHT, RE::SCRIPT_OUTPUT::FUNCTION_ADD_SPELL, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_SPELL, RE::SCRIPT_OUTPUT::FUNCTION_CAST, RE::SCRIPT_OUTPUT::FUNCTION_GET_BUTTON_PRESSED, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_SAME_CELL, RE::SCRIPT_OUTPUT::FUNCTION_ENABLE, RE::SCRIPT_OUTPUT::FUNCTION_DISABLE, RE::SCRIPT_OUTPUT::FUNCTION_GET_DISABLED, RE::SCRIPT_OUTPUT::FUNCTION_MENU_MODE, RE::SCRIPT_OUTPUT::FUNCTION_PLACE_AT_ME, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_SOUND, RE::SCRIPT_OUTPUT::FUNCTION_GET_DISEASE, RE::SCRIPT_OUTPUT::FUNCTION_FAIL_ALL_OBJECTIVES, RE::SCRIPT_OUTPUT::FUNCTION_GET_CLOTHING_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_SAME_FACTION, RE::SCRIPT_OUTPUT::FUNCTION_SAME_RACE, RE::SCRIPT_OUTPUT::FUNCTION_SAME_SEX, RE::SCRIPT_OUTPUT::FUNCTION_GET_DETECTED, RE::SCRIPT_OUTPUT::FUNCTION_GET_DEAD, RE::SCRIPT_OUTPUT::FUNCTION_GET_ITEM_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_GET_GOLD, RE::SCRIPT_OUTPUT::FUNCTION_GET_SLEEPING, RE::SCRIPT_OUTPUT::FUNCTION_GET_TALKED_TO_PC, RE::SCRIPT_OUTPUT::FUNCTION_SAY, RE::SCRIPT_OUTPUT::FUNCTION_SAY_TO, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_HELP_MESSAGE, RE::SCRIPT_OUTPUT::FUNCTION_START_QUEST, RE::SCRIPT_OUTPUT::FUNCTION_STOP_QUEST, RE::SCRIPT_OUTPUT::FUNCTION_GET_QUEST_RUNNING, RE::SCRIPT_OUTPUT::FUNCTION_SET_STAGE, RE::SCRIPT_OUTPUT::FUNCTION_GET_STAGE, RE::SCRIPT_OUTPUT::FUNCTION_GET_STAGE_DONE, RE::SCRIPT_OUTPUT::FUNCTION_GET_FACTION_RANK_DIFFERENCE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ALARMED, RE::SCRIPT_OUTPUT::FUNCTION_IS_RAINING, RE::SCRIPT_OUTPUT::FUNCTION_GET_ATTACKED, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_CREATURE, RE::SCRIPT_OUTPUT::FUNCTION_GET_LOCK_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_GET_SHOULD_ATTACK, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_CELL, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_CLASS, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_RACE, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_SEX, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_FACTION, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_ID, RE::SCRIPT_OUTPUT::FUNCTION_GET_FACTION_RANK, RE::SCRIPT_OUTPUT::FUNCTION_GET_GLOBAL_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_IS_SNOWING, RE::SCRIPT_OUTPUT::FUNCTION_FAST_TRAVEL, RE::SCRIPT_OUTPUT::FUNCTION_GET_RANDOMPERCENT, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_MUSIC, RE::SCRIPT_OUTPUT::FUNCTION_WOULD_BE_STEALING, RE::SCRIPT_OUTPUT::FUNCTION_GET_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_IS_ROTATING, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_ITEM, RE::SCRIPT_OUTPUT::FUNCTION_GET_LEVELEDENCOUNTER_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_GET_DEAD_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_ADD_TO_MAP, RE::SCRIPT_OUTPUT::FUNCTION_START_CONVERSATION, RE::SCRIPT_OUTPUT::FUNCTION_DROP, RE::SCRIPT_OUTPUT::FUNCTION_ADD_TOPIC, RE::SCRIPT_OUTPUT::FUNCTION_MESSAGE, RE::SCRIPT_OUTPUT::FUNCTION_SET_ALERT, RE::SCRIPT_OUTPUT::FUNCTION_GET_ALERT, RE::SCRIPT_OUTPUT::FUNCTION_LOOK, RE::SCRIPT_OUTPUT::FUNCTION_STOP_LOOK, RE::SCRIPT_OUTPUT::FUNCTION_EVALUATE_PACKAGE, RE::SCRIPT_OUTPUT::FUNCTION_SEND_ASSAULT_ALARM, RE::SCRIPT_OUTPUT::FUNCTION_ENABLE_PLAYER_CONTROLS, RE::SCRIPT_OUTPUT::FUNCTION_DISABLE_PLAYER_CONTROLS, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_CONTROLS_DISABLED, RE::SCRIPT_OUTPUT::FUNCTION_GET_HEADING_ANGLE, RE::SCRIPT_OUTPUT::FUNCTION_PICK_IDLE, RE::SCRIPT_OUTPUT::FUNCTION_IS_WEAPON_MAGIC_OUT, RE::SCRIPT_OUTPUT::FUNCTION_IS_TORCH_OUT, RE::SCRIPT_OUTPUT::FUNCTION_IS_SHIELD_OUT, RE::SCRIPT_OUTPUT::FUNCTION_CREATE_DETECTION_EVENT, RE::SCRIPT_OUTPUT::FUNCTION_IS_ACTION_REF, RE::SCRIPT_OUTPUT::FUNCTION_IS_FACING_UP, RE::SCRIPT_OUTPUT::FUNCTION_GET_KNOCKED_STATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_WEAPON_ANIM_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_IS_WEAPON_SKILL_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_GET_CURRENT_AI_PACKAGE, RE::SCRIPT_OUTPUT::FUNCTION_IS_WAITING, RE::SCRIPT_OUTPUT::FUNCTION_IS_IDLE_PLAYING, RE::SCRIPT_OUTPUT::FUNCTION_COMPLETE_QUEST, RE::SCRIPT_OUTPUT::FUNCTION_LOCK, RE::SCRIPT_OUTPUT::FUNCTION_UNLOCK, RE::SCRIPT_OUTPUT::FUNCTION_IS_INTIMIDATED, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYER_IN_REGION, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_AGGRO_RADIUS_VIOLATION, RE::SCRIPT_OUTPUT::FUNCTION_GET_CRIME_KNOWN, RE::SCRIPT_OUTPUT::FUNCTION_SET_ENEMY, RE::SCRIPT_OUTPUT::FUNCTION_SET_ALLY, RE::SCRIPT_OUTPUT::FUNCTION_GET_CRIME, RE::SCRIPT_OUTPUT::FUNCTION_IS_GREETING_PLAYER, RE::SCRIPT_OUTPUT::FUNCTION_START_SANDMAN, RE::SCRIPT_OUTPUT::FUNCTION_IS_GUARD, RE::SCRIPT_OUTPUT::FUNCTION_START_CANNIBAL, RE::SCRIPT_OUTPUT::FUNCTION_HAS_BEEN_EATEN, RE::SCRIPT_OUTPUT::FUNCTION_GET_STAMINA_PERCENT, RE::SCRIPT_OUTPUT::FUNCTION_HAS_BEEN_READ, RE::SCRIPT_OUTPUT::FUNCTION_GET_DYING, RE::SCRIPT_OUTPUT::FUNCTION_GET_SCENE_ACTION_PERCENT, RE::SCRIPT_OUTPUT::FUNCTION_WOULD_REFUSE_COMMAND, RE::SCRIPT_OUTPUT::FUNCTION_SAME_FACTION_PC, RE::SCRIPT_OUTPUT::FUNCTION_SAME_RACE_PC, RE::SCRIPT_OUTPUT::FUNCTION_SAME_SEX_PC, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_REF, RE::SCRIPT_OUTPUT::FUNCTION_SET_FACTION_RANK, RE::SCRIPT_OUTPUT::FUNCTION_MOD_FACTION_RANK, RE::SCRIPT_OUTPUT::FUNCTION_KILL_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_RESURRECT_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_IS_TALKING, RE::SCRIPT_OUTPUT::FUNCTION_GET_COMPONENT_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_GET_CURRENT_AI_PROCEDURE, RE::SCRIPT_OUTPUT::FUNCTION_GET_TRESPASS_WARNING_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_IS_TRESPASSING, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_MY_OWNED_CELL, RE::SCRIPT_OUTPUT::FUNCTION_GET_WIND_SPEED, RE::SCRIPT_OUTPUT::FUNCTION_GET_WEATHER_PCT, RE::SCRIPT_OUTPUT::FUNCTION_GET_WEATHER, RE::SCRIPT_OUTPUT::FUNCTION_IS_CONTINUING_PACKAGE_PCNEAR, RE::SCRIPT_OUTPUT::FUNCTION_SET_CRIMEFACTION, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_CRIMEFACTION, RE::SCRIPT_OUTPUT::FUNCTION_CAN_HAVE_FLAMES, RE::SCRIPT_OUTPUT::FUNCTION_HAS_FLAMES, RE::SCRIPT_OUTPUT::FUNCTION_ADD_FLAMES, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_FLAMES, RE::SCRIPT_OUTPUT::FUNCTION_GET_OPEN_STATE, RE::SCRIPT_OUTPUT::FUNCTION_MOVE_TO_MARKER, RE::SCRIPT_OUTPUT::FUNCTION_GET_SITTING, RE::SCRIPT_OUTPUT::FUNCTION_GET_FURNITURE_MARKER_ID, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_CURRENT_PACKAGE, RE::SCRIPT_OUTPUT::FUNCTION_IS_CURRENT_FURNITURE_REF, RE::SCRIPT_OUTPUT::FUNCTION_IS_CURRENT_FURNITURE_OBJ, RE::SCRIPT_OUTPUT::FUNCTION_SETSIZE, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_ME, RE::SCRIPT_OUTPUT::FUNCTION_DROP_ME, RE::SCRIPT_OUTPUT::FUNCTION_GET_FACTION_REACTION, RE::SCRIPT_OUTPUT::FUNCTION_SET_FACTION_REACTION, RE::SCRIPT_OUTPUT::FUNCTION_MOD_FACTION_REACTION, RE::SCRIPT_OUTPUT::FUNCTION_GET_DAY_OF_WEEK, RE::SCRIPT_OUTPUT::FUNCTION_IGNORE_CRIME, RE::SCRIPT_OUTPUT::FUNCTION_GET_TALKED_TO_PC_PARAM, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_ALL_ITEMS, RE::SCRIPT_OUTPUT::FUNCTION_WAKE_UP_PC, RE::SCRIPT_OUTPUT::FUNCTION_IS_PC_SLEEPING, RE::SCRIPT_OUTPUT::FUNCTION_IS_PC_A_MURDERER, RE::SCRIPT_OUTPUT::FUNCTION_SET_COMBAT_STYLE, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_SOUND3D, RE::SCRIPT_OUTPUT::FUNCTION_SELECT_PLAYER_SPELL, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_SAME_LOC_AS_REF, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_SAME_LOC_AS_REFALIAS, RE::SCRIPT_OUTPUT::FUNCTION_GET_EQUIPPED, RE::SCRIPT_OUTPUT::FUNCTION_WAIT, RE::SCRIPT_OUTPUT::FUNCTION_STOP_WAITING, RE::SCRIPT_OUTPUT::FUNCTION_IS_SWIMMING, RE::SCRIPT_OUTPUT::FUNCTION_SCRIPT_EFFECT_ELAPSED_SECONDS, RE::SCRIPT_OUTPUT::FUNCTION_SET_CELL_PUBLIC, RE::SCRIPT_OUTPUT::FUNCTION_GET_PC_SLEEP_HOURS, RE::SCRIPT_OUTPUT::FUNCTION_SET_PC_SLEEP_HOURS, RE::SCRIPT_OUTPUT::FUNCTION_GET_AMOUNT_SOLD_STOLEN, RE::SCRIPT_OUTPUT::FUNCTION_MOD_AMOUNT_SOLD_STOLEN, RE::SCRIPT_OUTPUT::FUNCTION_GET_IGNORING_CRIME, RE::SCRIPT_OUTPUT::FUNCTION_GET_PC_EXPELLED, RE::SCRIPT_OUTPUT::FUNCTION_SET_PC_EXPELLED, RE::SCRIPT_OUTPUT::FUNCTION_GET_PC_FACTION_MURDER, RE::SCRIPT_OUTPUT::FUNCTION_SET_PC_FACTION_MURDER, RE::SCRIPT_OUTPUT::FUNCTION_GET_PC_ENEMY_OF_FACTION, RE::SCRIPT_OUTPUT::FUNCTION_SET_PC_ENEMY_OF_FACTION, RE::SCRIPT_OUTPUT::FUNCTION_GET_PC_FACTION_ATTACK, RE::SCRIPT_OUTPUT::FUNCTION_SET_PC_FACTION_ATTACK, RE::SCRIPT_OUTPUT::FUNCTION_START_SCENE, RE::SCRIPT_OUTPUT::FUNCTION_STOP_SCENE, RE::SCRIPT_OUTPUT::FUNCTION_GET_DESTROYED, RE::SCRIPT_OUTPUT::FUNCTION_SET_DESTROYED, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTION_REF, RE::SCRIPT_OUTPUT::FUNCTION_GET_SELF, RE::SCRIPT_OUTPUT::FUNCTION_GET_CONTAINER, RE::SCRIPT_OUTPUT::FUNCTION_GET_FORCE_RUN, RE::SCRIPT_OUTPUT::FUNCTION_SET_FORCE_RUN, RE::SCRIPT_OUTPUT::FUNCTION_GET_FORCE_SNEAK, RE::SCRIPT_OUTPUT::FUNCTION_SET_FORCE_SNEAK, RE::SCRIPT_OUTPUT::FUNCTION_ADVANCE_SKILL, RE::SCRIPT_OUTPUT::FUNCTION_ADVANCE_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_HAS_MAGIC_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_GET_DEFAULT_OPEN, RE::SCRIPT_OUTPUT::FUNCTION_SET_DEFAULT_OPEN, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_CLASS_MENU, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_LOOKS_MENU, RE::SCRIPT_OUTPUT::FUNCTION_SPAWN, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_NAME_MENU, RE::SCRIPT_OUTPUT::FUNCTION_SET_OPEN_STATE, RE::SCRIPT_OUTPUT::FUNCTION_RESET_REFERENCE, RE::SCRIPT_OUTPUT::FUNCTION_IS_SPELL_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_GET_VATS_MODE, RE::SCRIPT_OUTPUT::FUNCTION_GET_PERSUASSION_NUMBER, RE::SCRIPT_OUTPUT::FUNCTION_GET_VAMPIRE_FEED, RE::SCRIPT_OUTPUT::FUNCTION_GET_CANNIBAL, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_DEFAULT_CLASS, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_MYCLASS_DEFAULT, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_CELL_PARAM, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_DIALOGUE_INPUT, RE::SCRIPT_OUTPUT::FUNCTION_GET_COMBAT_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_GET_PACKAGE_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_SPELLMAKING_MENU, RE::SCRIPT_OUTPUT::FUNCTION_GET_VATS_TARGET_HEIGHT, RE::SCRIPT_OUTPUT::FUNCTION_SET_GHOST, RE::SCRIPT_OUTPUT::FUNCTION_GET_GHOST, RE::SCRIPT_OUTPUT::FUNCTION_EQUIP_OBJECT, RE::SCRIPT_OUTPUT::FUNCTION_UNEQUIP_OBJECT, RE::SCRIPT_OUTPUT::FUNCTION_SET_CLASS, RE::SCRIPT_OUTPUT::FUNCTION_SET_UNCONSCIOUS, RE::SCRIPT_OUTPUT::FUNCTION_GET_UNCONSCIOUS, RE::SCRIPT_OUTPUT::FUNCTION_SET_RESTRAINED, RE::SCRIPT_OUTPUT::FUNCTION_GET_RESTRAINED, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_FLEE, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_USED_ITEM, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_USED_ITEM_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_GET_SCENE_ACTIVE, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_DIALOGUE_WITH_PLAYER, RE::SCRIPT_OUTPUT::FUNCTION_GET_LOCATION_CLEARED, RE::SCRIPT_OUTPUT::FUNCTION_SET_LOCATION_CLEARED, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_INTO_ALIAS, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_ALIAS, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_PLAYABLE_RACE, RE::SCRIPT_OUTPUT::FUNCTION_GET_OFFERS_SERVICES_NOW, RE::SCRIPT_OUTPUT::FUNCTION_GET_GAMESETTING, RE::SCRIPT_OUTPUT::FUNCTION_STOP_COMBAT_ALARM_AGAINST_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_HAS_ASSOCIATION_TYPE_ID, RE::SCRIPT_OUTPUT::FUNCTION_HAS_FAMILY_RELATIONSHIP, RE::SCRIPT_OUTPUT::FUNCTION_SET_WEATHER, RE::SCRIPT_OUTPUT::FUNCTION_HAS_PARENT_RELATIONSHIP, RE::SCRIPT_OUTPUT::FUNCTION_IS_WARNING_ABOUT, RE::SCRIPT_OUTPUT::FUNCTION_IS_WEAPON_OUT, RE::SCRIPT_OUTPUT::FUNCTION_HAS_SPELL, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIME_PASSING, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLEASANT, RE::SCRIPT_OUTPUT::FUNCTION_IS_CLOUDY, RE::SCRIPT_OUTPUT::FUNCTION_TRAP_UPDATE, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_QUEST_OBJECTIVES, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_INCREMENT_SKILL, RE::SCRIPT_OUTPUT::FUNCTION_DO_TRAP, RE::SCRIPT_OUTPUT::FUNCTION_SET_PLAYER_FAST_TRAVEL, RE::SCRIPT_OUTPUT::FUNCTION_IS_SMALL_BUMP, RE::SCRIPT_OUTPUT::FUNCTION_GET_PARENT_REF, RE::SCRIPT_OUTPUT::FUNCTION_UNUSED_22, RE::SCRIPT_OUTPUT::FUNCTION_GET_BASE_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_GET_OWNERSHIP, RE::SCRIPT_OUTPUT::FUNCTION_SET_OWNERSHIP, RE::SCRIPT_OUTPUT::FUNCTION_SETCELLOWNERSHIP, RE::SCRIPT_OUTPUT::FUNCTION_ISCELLOWNERSHIP, RE::SCRIPT_OUTPUT::FUNCTION_ISHORSE_STOLEN, RE::SCRIPT_OUTPUT::FUNCTION_SET_CELL_FULLNAME, RE::SCRIPT_OUTPUT::FUNCTION_SET_ACTOR_FULLNAME, RE::SCRIPT_OUTPUT::FUNCTION_IS_LEFT_UP, RE::SCRIPT_OUTPUT::FUNCTION_IS_SNEAKING, RE::SCRIPT_OUTPUT::FUNCTION_IS_RUNNING, RE::SCRIPT_OUTPUT::FUNCTION_FRIEND_NUMBER_HIT, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_COMBAT, RE::SCRIPT_OUTPUT::FUNCTION_SET_PACKAGE_DURATION, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_MAGIC_SHADER, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_MAGIC_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_STOP_MAGIC_SHADER, RE::SCRIPT_OUTPUT::FUNCTION_STOP_MAGIC_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_RESET_CELL, RE::SCRIPT_OUTPUT::FUNCTION_IS_ANIM_PLAYING, RE::SCRIPT_OUTPUT::FUNCTION_SET_ACTOR_ALPHA, RE::SCRIPT_OUTPUT::FUNCTION_ENABLE_LINKED_PATHPOINTS, RE::SCRIPT_OUTPUT::FUNCTION_DISABLE_LINKED_PATHPOINTS, RE::SCRIPT_OUTPUT::FUNCTION_GET_INTERIOR, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_WEATHER, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLE_ACTORS_AI, RE::SCRIPT_OUTPUT::FUNCTION_IS_ACTORS_AI_OFF, RE::SCRIPT_OUTPUT::FUNCTION_IS_WATER_OBJECT, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_ACTION, RE::SCRIPT_OUTPUT::FUNCTION_IS_USING_TORCH, RE::SCRIPT_OUTPUT::FUNCTION_SET_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_RESET_FALL_DAMAGE_TIMER, RE::SCRIPT_OUTPUT::FUNCTION_IS_XBOX, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_WORLDSPACE, RE::SCRIPT_OUTPUT::FUNCTION_MOD_PLAYER_MISC_STAT, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_MISC_STAT, RE::SCRIPT_OUTPUT::FUNCTION_GET_PAIRED_ANIMATION, RE::SCRIPT_OUTPUT::FUNCTION_IS_CRIME_VICTIM, RE::SCRIPT_OUTPUT::FUNCTION_GET_TOTAL_PERSUASSION_CHANGE, RE::SCRIPT_OUTPUT::FUNCTION_SET_SCALE, RE::SCRIPT_OUTPUT::FUNCTION_MOD_SCALE, RE::SCRIPT_OUTPUT::FUNCTION_GET_IDLE_DONE_IN_PROCEDURE, RE::SCRIPT_OUTPUT::FUNCTION_KILL_ALL_ACTORS, RE::SCRIPT_OUTPUT::FUNCTION_GET_NO_RUMORS, RE::SCRIPT_OUTPUT::FUNCTION_SET_NO_RUMORS, RE::SCRIPT_OUTPUT::FUNCTION_DISPEL, RE::SCRIPT_OUTPUT::FUNCTION_GET_COMBAT_STATE, RE::SCRIPT_OUTPUT::FUNCTION_TRIGGER_HIT_SHADER, RE::SCRIPT_OUTPUT::FUNCTION_GET_WITHIN_PACKAGE_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_RESET3DSTATE, RE::SCRIPT_OUTPUT::FUNCTION_IS_RIDING_MOUNT, RE::SCRIPT_OUTPUT::FUNCTION_DISPEL_ALL_SPELLS, RE::SCRIPT_OUTPUT::FUNCTION_IS_FLEEING, RE::SCRIPT_OUTPUT::FUNCTION_ADD_ACHIEVEMENT, RE::SCRIPT_OUTPUT::FUNCTION_DUPLICATE_CONTAINER_ITEMS, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_LAVA, RE::SCRIPT_OUTPUT::FUNCTION_ESSENTIAL_DEATH_RELOAD, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_QUEST_ITEMS, RE::SCRIPT_OUTPUT::FUNCTION_DUPLICATE_NPC_STATS, RE::SCRIPT_OUTPUT::FUNCTION_RESET_HEALTH, RE::SCRIPT_OUTPUT::FUNCTION_SET_IGNORE_FRIENDLY_HITS, RE::SCRIPT_OUTPUT::FUNCTION_GET_IGNORE_FRIENDLY_HITS, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYERS_LAST_RIDDEN_MOUNT, RE::SCRIPT_OUTPUT::FUNCTION_SETREFRACTION, RE::SCRIPT_OUTPUT::FUNCTION_SET_ITEM_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_SET_RIGID_BODY_MASS, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_VIEWER_STRINGS, RE::SCRIPT_OUTPUT::FUNCTION_RELEASE_WEATHER_OVERRIDE, RE::SCRIPT_OUTPUT::FUNCTION_SET_ALL_REACHABLE, RE::SCRIPT_OUTPUT::FUNCTION_SET_ALL_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_SET_NO_AVOIDANCE, RE::SCRIPT_OUTPUT::FUNCTION_SEND_TRESPASS_CRIME_ALARM, RE::SCRIPT_OUTPUT::FUNCTION_SET_SCENE_IS_COMPLEX, RE::SCRIPT_OUTPUT::FUNCTION_AUTOSAVE, RE::SCRIPT_OUTPUT::FUNCTION_START_MASTER_FILE_SEEK_DATA, RE::SCRIPT_OUTPUT::FUNCTION_DUMP_MASTER_FILE_SEEK_DATA, RE::SCRIPT_OUTPUT::FUNCTION_IS_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_IS_ESSENTIAL, RE::SCRIPT_OUTPUT::FUNCTION_PRELOAD_MAGIC_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_DIALOG_SUBTITLES_ALWAYS, RE::SCRIPT_OUTPUT::FUNCTION_RESISTING_ARREST, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYER_MOVINGINTO_NEW_SPACE, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_CURRENT_LOC, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_CURRENT_LOCALIAS, RE::SCRIPT_OUTPUT::FUNCTION_GET_TIME_DEAD, RE::SCRIPT_OUTPUT::FUNCTION_HAS_LINKED_REF, RE::SCRIPT_OUTPUT::FUNCTION_GET_LINKED_REF, RE::SCRIPT_OUTPUT::FUNCTION_DAMAGE_OBJECT, RE::SCRIPT_OUTPUT::FUNCTION_IS_CHILD, RE::SCRIPT_OUTPUT::FUNCTION_GET_FACTIONS_STOLEN_ITEM_VALUE_NO_CRIME, RE::SCRIPT_OUTPUT::FUNCTION_GET_LAST_PLAYER_ACTION, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYER_ACTION_ACTIVE, RE::SCRIPT_OUTPUT::FUNCTION_SET_TALKING_ACTIVATOR_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_IS_TALKING_ACTIVATOR_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_BARTER_MENU, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_LIST, RE::SCRIPT_OUTPUT::FUNCTION_GET_FACTIONS_STOLEN_ITEM_VALUE_CRIME, RE::SCRIPT_OUTPUT::FUNCTION_ADD_PERK, RE::SCRIPT_OUTPUT::FUNCTION_GETCRIMEGOLD_VIOLENT, RE::SCRIPT_OUTPUT::FUNCTION_GETCRIMEGOLD_NONVIOLENT, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_REPAIR_MENU, RE::SCRIPT_OUTPUT::FUNCTION_IS_OWNED_BY, RE::SCRIPT_OUTPUT::FUNCTION_ADD_NOTE, RE::SCRIPT_OUTPUT::FUNCTION_GETDISTANCE_TO_COMMANDED_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_GETDISTANCE_TO_COMMANDED_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_ADD_FACTION, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_FACTION, RE::SCRIPT_OUTPUT::FUNCTION_DAMAGE_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_RESTORE_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_TRIGGER_HUD_SHUDDER, RE::SCRIPT_OUTPUT::FUNCTION_GET_OBJECTIVE_FAILED, RE::SCRIPT_OUTPUT::FUNCTION_SET_OBJECTIVE_FAILED, RE::SCRIPT_OUTPUT::FUNCTION_SET_GLOBAL_TIME_MULTIPLIER, RE::SCRIPT_OUTPUT::FUNCTION_GET_HIT_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_IS_PC_1ST_PERSON, RE::SCRIPT_OUTPUT::FUNCTION_PURGECELLBUFFERS, RE::SCRIPT_OUTPUT::FUNCTION_PUSH_ACTOR_AWAY, RE::SCRIPT_OUTPUT::FUNCTION_SET_ACTORS_AI, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_OWNERSHIP, RE::SCRIPT_OUTPUT::FUNCTION_GET_CAUSE_OF_DEATH, RE::SCRIPT_OUTPUT::FUNCTION_IS_LIMB_GONE, RE::SCRIPT_OUTPUT::FUNCTION_IS_WEAPON_IN_LIST, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_IDLE, RE::SCRIPT_OUTPUT::FUNCTION_APPLY_IMAGESPACE_MODIFIER, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_IMAGESPACE_MODIFIER, RE::SCRIPT_OUTPUT::FUNCTION_IS_BRIBED, RE::SCRIPT_OUTPUT::FUNCTION_GET_RELATIONSHIP_RANK, RE::SCRIPT_OUTPUT::FUNCTION_SET_RELATIONSHIP_RANK, RE::SCRIPT_OUTPUT::FUNCTION_SETCELLIMAGESPACE, RE::SCRIPT_OUTPUT::FUNCTION_SHOWCHARGENMENU, RE::SCRIPT_OUTPUT::FUNCTION_GET_VATS_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_GET_KILLER, RE::SCRIPT_OUTPUT::FUNCTION_GET_KILLER_OBJECT, RE::SCRIPT_OUTPUT::FUNCTION_GET_COMBAT_FACTION_REACTION, RE::SCRIPT_OUTPUT::FUNCTION_USE_WEAPON, RE::SCRIPT_OUTPUT::FUNCTION_EVALUATE_SPELL_CONDITIONS, RE::SCRIPT_OUTPUT::FUNCTION_TOGGLEMOTIONBLUR, RE::SCRIPT_OUTPUT::FUNCTION_EXISTS, RE::SCRIPT_OUTPUT::FUNCTION_GET_GROUP_MEMBER_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_GET_GROUP_TARGET_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_SET_OBJECTIVE_COMPLETED, RE::SCRIPT_OUTPUT::FUNCTION_SET_OBJECTIVE_DISPLAYED, RE::SCRIPT_OUTPUT::FUNCTION_GET_OBJECTIVE_COMPLETED, RE::SCRIPT_OUTPUT::FUNCTION_GET_OBJECTIVE_DISPLAYED, RE::SCRIPT_OUTPUT::FUNCTION_SETIMAGESPACE, RE::SCRIPT_OUTPUT::FUNCTION_PIPBOY_RADIO, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_PERK, RE::SCRIPT_OUTPUT::FUNCTION_DISABLE_ALL_ACTORS, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_FORM_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_VOICE_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLANTED_EXPLOSIVE, RE::SCRIPT_OUTPUT::FUNCTION_COMPLETE_ALL_OBJECTIVES, RE::SCRIPT_OUTPUT::FUNCTION_IS_SCENE_PACKAGE_RUNNING, RE::SCRIPT_OUTPUT::FUNCTION_GET_HEALTH_PERCENT, RE::SCRIPT_OUTPUT::FUNCTION_SET_AUDIO_MULTITHREADING, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_OBJECT_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_SHOWCHARGENMENUPARAMS, RE::SCRIPT_OUTPUT::FUNCTION_PLAYER_VISUAL_DETECTION, RE::SCRIPT_OUTPUT::FUNCTION_PLAYER_AUDIO_DETECTION, RE::SCRIPT_OUTPUT::FUNCTION_EXIT_GAME, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_CREATURE_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_HAS_KEY, RE::SCRIPT_OUTPUT::FUNCTION_IS_FURN_ENTRYTYPE, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_WARNING, RE::SCRIPT_OUTPUT::FUNCTION_TRIGGER, RE::SCRIPT_OUTPUT::FUNCTION_MARK_FOR_DELETE, RE::SCRIPT_OUTPUT::FUNCTION_SET_PLAYER_AI_DRIVEN, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_CURRENT_LOC_FORMLIST, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_ZONE, RE::SCRIPT_OUTPUT::FUNCTION_GET_VELOCITY, RE::SCRIPT_OUTPUT::FUNCTION_GET_GRAPH_VARIABLE_FLOAT, RE::SCRIPT_OUTPUT::FUNCTION_HAS_PERK, RE::SCRIPT_OUTPUT::FUNCTION_GET_FACTION_RELATION, RE::SCRIPT_OUTPUT::FUNCTION_IS_LAST_IDLE_PLAYED, RE::SCRIPT_OUTPUT::FUNCTION_SET_NPC_RADIO, RE::SCRIPT_OUTPUT::FUNCTION_SET_PLAYER_TEAMMATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_TEAMMATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_TEAMMATE_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_OPEN_ACTOR_CONTAINER, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_PLAYER_FACTION_ENEMY, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_ACTORS_FACTION_PLAYER_ENEMY, RE::SCRIPT_OUTPUT::FUNCTION_IS_ACTOR_CRIME_ENEMY_PLAYER, RE::SCRIPT_OUTPUT::FUNCTION_GET_CRIME_GOLD, RE::SCRIPT_OUTPUT::FUNCTION_SET_CRIME_GOLD, RE::SCRIPT_OUTPUT::FUNCTION_MOD_CRIME_GOLD, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_GRABBED_REF, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYER_GRABBED_REF, RE::SCRIPT_OUTPUT::FUNCTION_PLACE_LEVELED_ACTOR_AT_ME, RE::SCRIPT_OUTPUT::FUNCTION_GET_KEYWORD_ITEM_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_LOCKPICK_MENU, RE::SCRIPT_OUTPUT::FUNCTION_GET_BROADCAST_STATE, RE::SCRIPT_OUTPUT::FUNCTION_SET_BROADCAST_STATE, RE::SCRIPT_OUTPUT::FUNCTION_START_RADIO_CONVERSATION, RE::SCRIPT_OUTPUT::FUNCTION_GET_DESTRUCTION_STAGE, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_DESTRUCTION, RE::SCRIPT_OUTPUT::FUNCTION_CAST_IMMEDIATE_SELF, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_ALIGNMENT, RE::SCRIPT_OUTPUT::FUNCTION_RESET_QUEST, RE::SCRIPT_OUTPUT::FUNCTION_SET_QUEST_DELAY, RE::SCRIPT_OUTPUT::FUNCTION_IS_PROTECTED, RE::SCRIPT_OUTPUT::FUNCTION_GET_THREAT_RATIO, RE::SCRIPT_OUTPUT::FUNCTION_MATCH_FACE_GEOMETRY, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_USEDITEM_EQUIPTYPE, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_NAME, RE::SCRIPT_OUTPUT::FUNCTION_FIRE_WEAPON, RE::SCRIPT_OUTPUT::FUNCTION_PAY_FINE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_ACTIVATED, RE::SCRIPT_OUTPUT::FUNCTION_MATCH_RACE, RE::SCRIPT_OUTPUT::FUNCTION_GET_FULLY_ENABLED_ACTORS_IN_HIGH, RE::SCRIPT_OUTPUT::FUNCTION_SEX_CHANGE, RE::SCRIPT_OUTPUT::FUNCTION_IS_CARRYABLE, RE::SCRIPT_OUTPUT::FUNCTION_GET_CONCUSSED, RE::SCRIPT_OUTPUT::FUNCTION_SET_ZONE_RESPAWNS, RE::SCRIPT_OUTPUT::FUNCTION_SET_VATS_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_GET_MAP_MARKER_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_RESETINVENTORY, RE::SCRIPT_OUTPUT::FUNCTION_PLAYER_KNOWS, RE::SCRIPT_OUTPUT::FUNCTION_GET_PERMANENT_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_GET_KILLING_BLOW_LIMB, RE::SCRIPT_OUTPUT::FUNCTION_SEND_PLAYER_TO_JAIL, RE::SCRIPT_OUTPUT::FUNCTION_GET_CAN_PAY_CRIME_GOLD, RE::SCRIPT_OUTPUT::FUNCTION_SERVE_TIME, RE::SCRIPT_OUTPUT::FUNCTION_GET_DAYS_IN_JAIL, RE::SCRIPT_OUTPUT::FUNCTION_EP_ALCHEMY_GET_MAKING_POISON, RE::SCRIPT_OUTPUT::FUNCTION_EP_ALCHEMY_EFFECT_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_ALL_MAP_MARKERS, RE::SCRIPT_OUTPUT::FUNCTION_GET_ALLOW_WORLD_INTERACTIONS, RE::SCRIPT_OUTPUT::FUNCTION_RESET_AI, RE::SCRIPT_OUTPUT::FUNCTION_SET_RUMBLE, RE::SCRIPT_OUTPUT::FUNCTION_DIALOGUE_GETAV, RE::SCRIPT_OUTPUT::FUNCTION_DIALOGUE_HASPERK, RE::SCRIPT_OUTPUT::FUNCTION_IS_LAST_HIT_CRITICAL, RE::SCRIPT_OUTPUT::FUNCTION_ADD_MUSIC, RE::SCRIPT_OUTPUT::FUNCTION_DIALOGUE_GETITEM_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_LAST_CRIPPLED_ACTOR_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_HAS_SHARED_POWER_GRID, RE::SCRIPT_OUTPUT::FUNCTION_IS_COMBAT_TARGET, RE::SCRIPT_OUTPUT::FUNCTION_TRIGGER_SCREEN_BLOOD, RE::SCRIPT_OUTPUT::FUNCTION_VATS_RIGHT_AREA_FREE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_LEFT_AREA_FREE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_BACK_AREA_FREE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_FRONT_AREA_FREE, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_LOCK_BROKEN, RE::SCRIPT_OUTPUT::FUNCTION_IS_PS3, RE::SCRIPT_OUTPUT::FUNCTION_IS_PC, RE::SCRIPT_OUTPUT::FUNCTION_VATS_RIGHT_TARGET_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_LEFT_TARGET_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_BACK_TARGET_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_FRONT_TARGET_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_ATTACH_ASH_PILE, RE::SCRIPT_OUTPUT::FUNCTION_SET_CRITICAL_STAGE, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_CRITICAL_STAGE, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_FROM_ALL_FACTIONS, RE::SCRIPT_OUTPUT::FUNCTION_GET_XP_FOR_NEXT_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_LOCKPICK_MENU_DEBUG, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_SAVE, RE::SCRIPT_OUTPUT::FUNCTION_GET_INFAMY, RE::SCRIPT_OUTPUT::FUNCTION_GET_INFAMY_VIOLENT, RE::SCRIPT_OUTPUT::FUNCTION_GET_INFAMY_NON_VIOLENT, RE::SCRIPT_OUTPUT::FUNCTION_GET_TYPE_OF_COMMAND_ACTOR_PREFORMING, RE::SCRIPT_OUTPUT::FUNCTION_SIN, RE::SCRIPT_OUTPUT::FUNCTION_COS, RE::SCRIPT_OUTPUT::FUNCTION_TAN, RE::SCRIPT_OUTPUT::FUNCTION_SQRT, RE::SCRIPT_OUTPUT::FUNCTION_LOG, RE::SCRIPT_OUTPUT::FUNCTION_ABS, RE::SCRIPT_OUTPUT::FUNCTION_GET_QUEST_COMPLETED, RE::SCRIPT_OUTPUT::FUNCTION_GET_CHALLENGE_SUCCESS_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_RADIO_SHUT_OFF, RE::SCRIPT_OUTPUT::FUNCTION_AUTO_DISPLAY_OBJECTIVES, RE::SCRIPT_OUTPUT::FUNCTION_IS_GORE_DISABLED, RE::SCRIPT_OUTPUT::FUNCTION_FADE_SFX, RE::SCRIPT_OUTPUT::FUNCTION_SET_MINIMAL_USE, RE::SCRIPT_OUTPUT::FUNCTION_IS_SCENE_ACTION_COMPLETE, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_QUEST_STAGES, RE::SCRIPT_OUTPUT::FUNCTION_GET_SPELL_USAGE_NUMBER, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_RADIO_STATION_UPDATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTORS_IN_HIGH, RE::SCRIPT_OUTPUT::FUNCTION_HAS_LOADED_3D, RE::SCRIPT_OUTPUT::FUNCTION_DISABLE_ALL_MINES, RE::SCRIPT_OUTPUT::FUNCTION_SET_LAST_EXT_DOOR_ACTIVATED, RE::SCRIPT_OUTPUT::FUNCTION_KILLQUESTUPDATES, RE::SCRIPT_OUTPUT::FUNCTION_IS_IMAGESPACE_ACTIVE, RE::SCRIPT_OUTPUT::FUNCTION_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_HAS_REFTYPE, RE::SCRIPT_OUTPUT::FUNCTION_LOCATION_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_LOCATION_HAS_REFTYPE, RE::SCRIPT_OUTPUT::FUNCTION_CREATE_EVENT, RE::SCRIPT_OUTPUT::FUNCTION_IN_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_IS_ALIASREF, RE::SCRIPT_OUTPUT::FUNCTION_IN_ALIASLOC, RE::SCRIPT_OUTPUT::FUNCTION_IS_SPRINTING, RE::SCRIPT_OUTPUT::FUNCTION_IS_BLOCKING, RE::SCRIPT_OUTPUT::FUNCTION_HAS_EQUIPPED_SPELL, RE::SCRIPT_OUTPUT::FUNCTION_GET_CURRENT_CASTING_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_GET_CURRENT_DELIVERY_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_EQUIP_SPELL, RE::SCRIPT_OUTPUT::FUNCTION_GET_ATTACK_STATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ALIASED_REF, RE::SCRIPT_OUTPUT::FUNCTION_GET_EVENT_DATA, RE::SCRIPT_OUTPUT::FUNCTION_IS_CLOSER_TO_A_THAN_B, RE::SCRIPT_OUTPUT::FUNCTION_LEVEL_MINUS_PC_LEVEL, RE::SCRIPT_OUTPUT::UNUSED_FUNCTION_GET_EQUIPPED_SHOUT, RE::SCRIPT_OUTPUT::FUNCTION_IS_BLEEDING_OUT, RE::SCRIPT_OUTPUT::FUNCTION_UNLOCK_WORD, RE::SCRIPT_OUTPUT::FUNCTION_TEACH_WORD, RE::SCRIPT_OUTPUT::FUNCTION_ADDTOCONTAINER, RE::SCRIPT_OUTPUT::FUNCTION_GET_RELATIVE_ANGLE, RE::SCRIPT_OUTPUT::FUNCTION_SEND_ANIM_EVENT, RE::SCRIPT_OUTPUT::UNUSED_FUNCTION_SHOUT, RE::SCRIPT_OUTPUT::UNUSED_FUNCTION_ADD_SHOUT, RE::SCRIPT_OUTPUT::UNUSED_FUNCTION_REMOVE_SHOUT, RE::SCRIPT_OUTPUT::FUNCTION_GET_MOVEMENT_DIRECTION, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_SCENE, RE::SCRIPT_OUTPUT::FUNCTION_GET_REFTYPE_DEAD_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_GET_REFTYPE_ALIVE_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_APPLY_HAVOK_IMPULSE, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_FLYING, RE::SCRIPT_OUTPUT::FUNCTION_IS_CURRENT_SPELL, RE::SCRIPT_OUTPUT::FUNCTION_CURRENT_SPELL_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_GET_EQUIPPED_ITEM_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_GET_LOCATION_ALIAS_CLEARED, RE::SCRIPT_OUTPUT::FUNCTION_SET_LOCATION_ALIAS_CLEARED, RE::SCRIPT_OUTPUT::FUNCTION_GET_LOCALIAS_REFTYPE_DEAD_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_GET_LOCALIAS_REFTYPE_ALIVE_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_IS_WARD_STATE, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_SAME_CURR_LOC_AS_REF, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_SAME_CURR_LOC_AS_REFALIAS, RE::SCRIPT_OUTPUT::FUNCTION_LOC_ALIAS_IS_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_GET_KEYWORDDATA_FOR_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_SET_KEYWORDDATA_FOR_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_GET_KEYWORDDATA_FOR_LOCALIAS, RE::SCRIPT_OUTPUT::FUNCTION_SET_KEYWORDDATA_FOR_LOCALIAS, RE::SCRIPT_OUTPUT::FUNCTION_LOC_ALIAS_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_IS_NULL_PACKAGE_DATA, RE::SCRIPT_OUTPUT::FUNCTION_GET_NUMERIC_PACKAGE_DATA, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYER_RADIO_ON, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_RADIO_FREQUENCY, RE::SCRIPT_OUTPUT::FUNCTION_GET_HIGHEST_RELATIONSHIP_RANK, RE::SCRIPT_OUTPUT::FUNCTION_GET_LOWEST_RELATIONSHIP_RANK, RE::SCRIPT_OUTPUT::FUNCTION_HAS_ASSOCIATION_TYPE_ANY, RE::SCRIPT_OUTPUT::FUNCTION_HAS_FAMILY_ANY, RE::SCRIPT_OUTPUT::FUNCTION_PATHING_GET_OFFSET, RE::SCRIPT_OUTPUT::FUNCTION_PATHING_GET_ANGLE_OFFSET, RE::SCRIPT_OUTPUT::FUNCTION_PATHING_GET_SPEED, RE::SCRIPT_OUTPUT::FUNCTION_PATHING_GET_SPEED_ANGLE, RE::SCRIPT_OUTPUT::FUNCTION_GET_MOVEMENT_SPEED, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_CONTAINER, RE::SCRIPT_OUTPUT::FUNCTION_IS_LOCATION_LOADED, RE::SCRIPT_OUTPUT::FUNCTION_IS_LOC_ALIAS_LOADED, RE::SCRIPT_OUTPUT::FUNCTION_IS_DUAL_CASTING, RE::SCRIPT_OUTPUT::FUNCTION_DUAL_CAST_SPELL, RE::SCRIPT_OUTPUT::FUNCTION_GET_VM_QUEST_VAR, RE::SCRIPT_OUTPUT::FUNCTION_AUDIO_DETECTION_ON_COMBATTARGET, RE::SCRIPT_OUTPUT::FUNCTION_VISUAL_DETECTION_ON_COMBATTARGET, RE::SCRIPT_OUTPUT::FUNCTION_IS_CASTING, RE::SCRIPT_OUTPUT::FUNCTION_GET_FLYING_STATE, RE::SCRIPT_OUTPUT::FUNCTION_SET_FAVOR_STATE, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_FAVOR_STATE, RE::SCRIPT_OUTPUT::FUNCTION_HAS_TWO_HANDED_WEAPON, RE::SCRIPT_OUTPUT::FUNCTION_IS_FURN_EXITTYPE, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_FRIEND_STATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_WITHIN_DISTANCE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTORVALUE_PERCENT, RE::SCRIPT_OUTPUT::FUNCTION_IS_UNIQUE, RE::SCRIPT_OUTPUT::FUNCTION_GET_LAST_BUMP_DIRECTION, RE::SCRIPT_OUTPUT::FUNCTION_CAMERA_SHAKE, RE::SCRIPT_OUTPUT::FUNCTION_GET_INF0_CHALLENGE_SUCCESS_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_INJURED, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_CRASH_LAND_REQUEST, RE::SCRIPT_OUTPUT::FUNCTION_GET_IS_HASTY_LAND_REQUEST, RE::SCRIPT_OUTPUT::FUNCTION_UPDATE_QUEST_INSTANCE_GLOBAL, RE::SCRIPT_OUTPUT::FUNCTION_SET_ALLOW_FLYING, RE::SCRIPT_OUTPUT::FUNCTION_IS_LINKED_TO, RE::SCRIPT_OUTPUT::FUNCTION_GET_KEYWORD_DATA_FOR_CURRENT_LOCATION, RE::SCRIPT_OUTPUT::FUNCTION_GET_IN_SHARED_CRIME_FACTION, RE::SCRIPT_OUTPUT::FUNCTION_GET_BRIBE_AMOUNT, RE::SCRIPT_OUTPUT::FUNCTION_GET_BRIBE_SUCCESS, RE::SCRIPT_OUTPUT::FUNCTION_GET_INTIMIDATE_SUCCESS, RE::SCRIPT_OUTPUT::FUNCTION_GET_ARRESTED_STATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ARRESTING_ACTOR_STATE, RE::SCRIPT_OUTPUT::FUNCTION_CLEAR_ARREST_STATE, RE::SCRIPT_OUTPUT::FUNCTION_HAS_VM_SCRIPT, RE::SCRIPT_OUTPUT::FUNCTION_GET_VM_SCRIPT_VAR, RE::SCRIPT_OUTPUT::FUNCTION_GET_WORKSHOP_RESOURCE_DAMAGE, RE::SCRIPT_OUTPUT::FUNCTION_UNUSED_21, RE::SCRIPT_OUTPUT::FUNCTION_FORCE_LOC_INTO_ALIAS, RE::SCRIPT_OUTPUT::FUNCTION_HAS_VALID_RUMOR_TOPIC, RE::SCRIPT_OUTPUT::FUNCTION_SET_ACTOR_HORSE, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_REFERENCE_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_STOP_REFERENCE_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_SHADER_PARTICLE_GEOMETRY, RE::SCRIPT_OUTPUT::FUNCTION_STOP_SHADER_PARTICLE_GEOMETRY, RE::SCRIPT_OUTPUT::FUNCTION_APPLY_IMAGESPACE_MODIFIER_CROSS_FADE, RE::SCRIPT_OUTPUT::FUNCTION_REMOVE_IMAGESPACE_MODIFIER_CROSS_FADE, RE::SCRIPT_OUTPUT::FUNCTION_IS_ATTACKING, RE::SCRIPT_OUTPUT::FUNCTION_IS_POWER_ATTACKING, RE::SCRIPT_OUTPUT::FUNCTION_IS_LAST_HOSTILE_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_GET_GRAPH_VARIABLE_INT, RE::SCRIPT_OUTPUT::UNUSED_FUNCTION_GET_CURRENT_SHOUT_VARIATION, RE::SCRIPT_OUTPUT::FUNCTION_PLAY_IMPACT_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_SHOULD_ATTACK_KILL, RE::SCRIPT_OUTPUT::FUNCTION_SEND_STEAL_ALARM, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTIVATION_HEIGHT, RE::SCRIPT_OUTPUT::FUNCTION_UNUSED_16, RE::SCRIPT_OUTPUT::FUNCTION_WORN_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_PATHING_GET_CURRENT_SPEED, RE::SCRIPT_OUTPUT::FUNCTION_PATHING_GET_CURRENT_SPEED_ANGLE, RE::SCRIPT_OUTPUT::FUNCTION_KNOCK_AREA_EFFECT, RE::SCRIPT_OUTPUT::FUNCTION_INTERRUPT_CAST, RE::SCRIPT_OUTPUT::FUNCTION_ADD_FORM_TO_FORMLIST, RE::SCRIPT_OUTPUT::FUNCTION_REVERT_FORMLIST, RE::SCRIPT_OUTPUT::FUNCTION_ADD_FORM_TO_LEVELEDLIST, RE::SCRIPT_OUTPUT::FUNCTION_REVERT_LEVELEDLIST, RE::SCRIPT_OUTPUT::FUNCTION_GET_WORKSHOP_OBJECT_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_UNUSED_18, RE::SCRIPT_OUTPUT::FUNCTION_EP_SPELL_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_GET_NO_BLEEDOUT_RECOVERY, RE::SCRIPT_OUTPUT::FUNCTION_SET_NO_BLEEDOUT_RECOVERY, RE::SCRIPT_OUTPUT::FUNCTION_EP_SPELL_HAS_SKILL, RE::SCRIPT_OUTPUT::FUNCTION_IS_ATTACK_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ALLOW_FLYING, RE::SCRIPT_OUTPUT::FUNCTION_HAS_MAGIC_EFFECT_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_IS_COMMANDED_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_IS_STAGGERED, RE::SCRIPT_OUTPUT::FUNCTION_IS_RECOILING, RE::SCRIPT_OUTPUT::FUNCTION_HAS_SCOPE_WEAPON, RE::SCRIPT_OUTPUT::FUNCTION_IS_PATHING, RE::SCRIPT_OUTPUT::FUNCTION_GET_SHOULD_HELP, RE::SCRIPT_OUTPUT::FUNCTION_HAS_BOUND_WEAPON, RE::SCRIPT_OUTPUT::FUNCTION_GET_COMBAT_TARGET_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_UPDATE_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_GET_COMBAT_GROUP_MEMBER_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_IS_IGNORING_COMBAT, RE::SCRIPT_OUTPUT::FUNCTION_GET_LIGHT_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_SAVE_PC_FACE, RE::SCRIPT_OUTPUT::FUNCTION_SPELL_HAS_CASTING_PERK, RE::SCRIPT_OUTPUT::FUNCTION_IS_BEING_RIDDEN, RE::SCRIPT_OUTPUT::FUNCTION_IS_UNDEAD, RE::SCRIPT_OUTPUT::FUNCTION_GET_REAL_HOURS_PASSED, RE::SCRIPT_OUTPUT::FUNCTION_UNEQUIP_ALL, RE::SCRIPT_OUTPUT::FUNCTION_IS_UNLOCKED_DOOR, RE::SCRIPT_OUTPUT::FUNCTION_IS_HOSTILE_TO_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_GET_TARGET_HEIGHT, RE::SCRIPT_OUTPUT::FUNCTION_IS_POISON, RE::SCRIPT_OUTPUT::FUNCTION_APPAREL_HAS_KEYWORD_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_GETITEMHEALTHPERCENT, RE::SCRIPT_OUTPUT::FUNCTION_EFFECT_WAS_DUAL_CAST, RE::SCRIPT_OUTPUT::FUNCTION_GET_KNOCKSTATE_ENUM, RE::SCRIPT_OUTPUT::FUNCTION_DOES_NOT_EXIST, RE::SCRIPT_OUTPUT::FUNCTION_SHOW_GENERIC_MENU, RE::SCRIPT_OUTPUT::FUNCTION_GET_PLAYER_WALKAWAY_DIALOGUE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_STANCE, RE::SCRIPT_OUTPUT::FUNCTION_UNUSED_24, RE::SCRIPT_OUTPUT::FUNCTION_UNEQUIP_ITEM_SLOT, RE::SCRIPT_OUTPUT::FUNCTION_MOUNT_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_DISMOUNT_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_CAN_PRODUCE_FOR_WORKSHOP, RE::SCRIPT_OUTPUT::FUNCTION_CAN_FLY_HERE, RE::SCRIPT_OUTPUT::FUNCTION_EP_IS_DAMAGE_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_UNUSED_15, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_GUN_STATE, RE::SCRIPT_OUTPUT::FUNCTION_GET_VOICE_LINE_LENGTH, RE::SCRIPT_OUTPUT::FUNCTION_MOD_POS, RE::SCRIPT_OUTPUT::FUNCTION_OTI_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_OTI_CHECK_NAME, RE::SCRIPT_OUTPUT::FUNCTION_OTI_GET_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_MOVEMENT_IDLE_MATCHES, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTION_DATA, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTION_DATA_SHORT, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTION_DATA_BYTE, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTION_DATA_FLAG, RE::SCRIPT_OUTPUT::FUNCTION_MODDED_ITEM_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_GET_ANGRY_WITH_PLAYER, RE::SCRIPT_OUTPUT::FUNCTION_IS_CAMERA_UNDER_WATER, RE::SCRIPT_OUTPUT::FUNCTION_MOD_ANGLE, RE::SCRIPT_OUTPUT::FUNCTION_GET_REF_OWNERSHIP, RE::SCRIPT_OUTPUT::FUNCTION_HAS_REF_OWNERSHIP, RE::SCRIPT_OUTPUT::FUNCTION_PLACE_THERE, RE::SCRIPT_OUTPUT::FUNCTION_GET_LOADED_AMMO_COUNT, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_SUNRISE, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_MORNING, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_AFTERNOON, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_EVENING, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_SUNSET, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_NIGHT, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_MIDNIGHT, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_DAY_ANY, RE::SCRIPT_OUTPUT::FUNCTION_IS_TIMESPAN_NIGHT_ANY, RE::SCRIPT_OUTPUT::FUNCTION_CURR_FURN_HAS_KEYWORD, RE::SCRIPT_OUTPUT::FUNCTION_GET_WEAPON_EQUIP_INDEX, RE::SCRIPT_OUTPUT::FUNCTION_KILL_ALL_HOSTILE_ACTORS, RE::SCRIPT_OUTPUT::FUNCTION_IS_OVERENCUMBERED, RE::SCRIPT_OUTPUT::FUNCTION_IS_PACKAGE_REQUESTING_BLOCKED_IDLES, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTION_DATA_INT, RE::SCRIPT_OUTPUT::FUNCTION_VATS_RIGHT_MINUS_LEFT_AREA_FREE, RE::SCRIPT_OUTPUT::FUNCITON_GET_IN_IRONSIGHTS, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_STAGGER_DIRECTION, RE::SCRIPT_OUTPUT::FUNCTION_GET_ACTOR_STAGGER_MAGNITUDE, RE::SCRIPT_OUTPUT::FUNCTION_WORN_COVERS_BIPEDSLOT, RE::SCRIPT_OUTPUT::FUNCTION_GET_INVENTORY_VALUE, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYER_IN_CONVERSATION, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_DIALOGUE_CAMERA, RE::SCRIPT_OUTPUT::FUNCTION_IS_DIALOGUE_TARGET_PLAYER, RE::SCRIPT_OUTPUT::FUNCTION_IS_DIALOGUE_TARGET_ACTOR, RE::SCRIPT_OUTPUT::FUNCTION_GET_DIALOGUE_TARGET_DISTANCE, RE::SCRIPT_OUTPUT::FUNCTION_IS_SEAT_OCCUPIED, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYER_RIDING, RE::SCRIPT_OUTPUT::FUNCTION_IS_TRYING_EVENT_CAMERA, RE::SCRIPT_OUTPUT::FUNCTION_USE_LEFT_SIDE_DIALOGUE_CAMERA, RE::SCRIPT_OUTPUT::FUNCTION_GET_NOTETYPE, RE::SCRIPT_OUTPUT::FUNCTION_LOCATION_HAS_PLAYER_WORKSHOP, RE::SCRIPT_OUTPUT::FUNCTION_IS_STARTING_ACTION, RE::SCRIPT_OUTPUT::FUNCTION_IS_MID_ACTION, RE::SCRIPT_OUTPUT::FUNCTION_IS_WEAPON_CHARGE_ATTACK, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_WORKSHOP_MODE, RE::SCRIPT_OUTPUT::FUNCTION_IS_WEAPON_CHARGING_HOLD_ATTACK, RE::SCRIPT_OUTPUT::FUNCTION_IS_ENCOUNTER_ABOVE_PLAYER_LEVEL, RE::SCRIPT_OUTPUT::FUNCTION_IS_MELEE_ATTACKING, RE::SCRIPT_OUTPUT::FUNCTION_VATS_GET_QUEUED_TARGETS_UNIQUE, RE::SCRIPT_OUTPUT::FUNCTION_GET_CURRENT_LOCATION_CLEARED, RE::SCRIPT_OUTPUT::FUNCTION_IS_POWERED, RE::SCRIPT_OUTPUT::FUNCTION_GET_TRANSMITTER_DISTANCE, RE::SCRIPT_OUTPUT::FUNCTION_GET_CAMERA_PLAYBACK_TIME, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_WATER, RE::SCRIPT_OUTPUT::FUNCTION_GET_WITHIN_ACTIVATE_DIST, RE::SCRIPT_OUTPUT::FUNCTION_IS_UNDER_WATER, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_SAME_SPACE, RE::SCRIPT_OUTPUT::FUNCTION_LOCATION_ALLOWS_RESET, RE::SCRIPT_OUTPUT::FUNCTION_VATS_BACK_RIGHT_AREA_FREE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_BACK_LEFT_AREA_FREE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_BACK_RIGHT_TARGET_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_BACK_LEFT_TARGET_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_VATS_TARGET_LIMB_VISIBLE, RE::SCRIPT_OUTPUT::FUNCTION_IS_PLAYER_LISTENING, RE::SCRIPT_OUTPUT::FUNCTION_PATHING_REQUESTED_QUICK_TURN, RE::SCRIPT_OUTPUT::FUNCTION_EP_IS_CALCULATING_BASE_DAMAGE, RE::SCRIPT_OUTPUT::FUNCTION_GET_REANIMATING, RE::SCRIPT_OUTPUT::FUNCTION_MATLOCK_CAPTURE, RE::SCRIPT_OUTPUT::FUNCTION_SET_VOICE_TYPE, RE::SCRIPT_OUTPUT::FUNCTION_IS_IN_ROBOT_WORKBENCH, RE::SCRIPT_OUTPUT::END_OF_FUNCTION_SECTION, RE::SCRIPT_OUTPUT::FUNCTION_COUNT, RE::SCRIPT_OUTPUT::SCRIPT_DONE },
+	{ "START_OF_FLOW_SECTION", "FLOW_BEGIN", "FLOW_END", "FLOW_SHORT", "FLOW_LONG", "FLOW_FLOAT", "FLOW_SET", "FLOW_IF", "FLOW_ELSE", "FLOW_ELSEIF", "FLOW_ENDIF", "FLOW_WHILE", "FLOW_ENDWHILE", "FLOW_REFERENCE_FUNCTION", "FLOW_SCRIPTNAME", "FLOW_RETURN", "FLOW_REF", "END_OF_FLOW_SECTION", "FLOW_COUNT", "START_OF_CONSOLE_SECTION", "FUNCTION_SHOW", "FUNCTION_SHOW_VARS", "FUNCTION_SHOW_GLOBAL_VARS", "FUNCTION_SHOW_QUEST_VARS", "FUNCTION_SHOW_QUESTS", "FUNCTION_SHOW_QUEST_ALIASES", "FUNCTION_SET_PAPYRUS_QUEST_VAR", "FUNCTION_SET_PAPYRUS_VAR", "FUNCTION_SET_QUEST_ALIASES", "FUNCTION_CLEAR_QUEST_ALIASES", "FUNCTION_TOGGLE_COMBAT_STATS", "FUNCTION_TOGGLE_SAFE_ZONE", "FUNCTION_TOGGLE_AI", "FUNCTION_TOGGLE_CG", "FUNCTION_TOGGLE_MG", "FUNCTION_TOGGLE_SG", "FUNCTION_TOGGLE_HRHG", "FUNCTION_TOGGLE_BORDERS", "FUNCTION_TOGGLE_SKY", "FUNCTION_TOGGLE_WIREFRAME", "FUNCTION_TOGGLE_COLLISION", "FUNCTION_TOGGLE_DEBUG_TEXT", "FUNCTION_TOGGLE_MENUS", "FUNCTION_TOGGLE_PRIMITIVES", "FUNCTION_SHOW_SCENEGRAPH", "FUNCTION_SHOW_FULL_SCENEGRAPH", "FUNCTION_TOGGLE_MAGIC_STATS", "FUNCTION_SHOW_ANIM", "FUNCTION_SHOW_1ST_PERSON", "FUNCTION_HELP", "FUNCTION_TOGGLE_NAVMESH", "FUNCTION_TOGGLE_PATHLINE", "FUNCTION_PICK_REF_BY_ID", "FUNCTION_PICK_LAST_REF", "FUNCTION_PICK_NEXT_REF", "FUNCTION_PICK_NEXT_ACTOR", "FUNCTION_PICK_CLOSEST_ACTOR", "FUNCTION_GET_SELECTED_REF", "FUNCTION_IS_LAST_REF", "FUNCTION_LIGHTING_PASSES", "FUNCTION_TOGGLE_LOD_LAND", "FUNCTION_TRIGGER_PIPBOY_EFFECT", "FUNCTION_CHARACTER_LIGHT", "FUNCTION_SHOW_LIGHT_BOUNDS", "FUNCTION_VATS_TARGET", "FUNCTION_TOGGLE_AO", "FUNCTION_TOGGLE_SAO", "FUNCTION_TOGGLE_MB", "FUNCTION_TOGGLE_SSR", "FUNCTION_TOGGLE_SSSSS", "FUNCTION_TOGGLE_FXAA", "FUNCTION_TOGGLE_TAA", "FUNCTION_TOGGLE_HDRCS", "FUNCTION_VIEW_GBUFFER", "FUNCTION_TOGGLE_COMBINED_WEAPON", "FUNCTION_TOGGLE_COMBINEMODE_GPU", "FUNCTION_TOGGLE_WEAPON_COMBINATION", "FUNCTION_TOGGLE_WEAPON_COMBINATION_BOUNDS", "FUNCTION_THREADS_MESHCOMBINER", "FUNCTION_COMBINED_OBJECT_WEAPON", "FUNCTION_TOGGLE_HANDS_CULLED", "FUNCTION_TOGGLE_BOKEH", "FUNCTION_TOGGLE_LENSFLARE", "FUNCTION_TOGGLE_SUNBEAMS", "FUNCTION_RENDER_LOCAL_MAP", "FUNCTION_SET_LOD_OBJECT_DISTANCE", "FUNCTION_TOGGLE_GRASS_UPDATE", "FUNCTION_CENTER_ON_CELL", "FUNCTION_SET_GAMESETTING", "FUNCTION_SET_INISETTING", "FUNCTION_GET_INISETTING", "FUNCTION_CENTER_ON_EXTERIOR", "FUNCTION_CALC_PATH_TO_POINT", "FUNCTION_CALC_LOWPATH_TO_POINT", "FUNCTION_SET_FOG_DEPTH", "FUNCTION_SET_CLIP_DIST", "FUNCTION_TOGGLE_SHADOW_VOLUMES", "FUNCTION_FORCE_WETNESS", "FUNCTION_SET_WORLD_WETNESS_LEVEL", "FUNCTION_SET_WORLD_RAIN_LEVEL", "FUNCTION_SET_IMAGE_SPACE_GLOW", "FUNCTION_TOGGLE_DETECTION", "FUNCTION_TOGGLE_HIGHPROCESS", "FUNCTION_TOGGLE_LOWPROCESS", "FUNCTION_TOGGLE_MIDDLELOWPROCESS", "FUNCTION_TOGGLE_MIDDLEHIGHPROCESS", "FUNCTION_TOGGLE_AISCHEDULES", "FUNCTION_SPEAK_SOUND", "FUNCTION_BETA_COMMENT", "FUNCTION_GAME_COMMENT", "FUNCTION_TOGGLE_CELL_NODE", "FUNCTION_TOGGLE_TREES", "FUNCTION_CAMERA_FOV", "FUNCTION_TOGGLE_GOD_MODE", "FUNCTION_RELOAD_SHADERS", "FUNCTION_RELOAD_FXP", "FUNCTION_TOGGLE_SCRIPTS", "FUNCTION_TOGGLE_CONVERSATION_STATS", "FUNCTION_TOGGLE_FULL_HELP", "FUNCTION_SHOW_QUEST_LOG", "FUNCTION_SHOW_FULL_QUEST_LOG", "FUNCTION_DUMP_TEXTURE_PALETTE", "FUNCTION_DUMP_MODEL_MAP", "FUNCTION_DUMP_SOUND_MAP", "FUNCTION_CENTER_ON_WORLD", "FUNCTION_TOGGLE_GRASS", "FUNCTION_CREATE_GRASS_AT", "FUNCTION_ADD_FACE_ANIM_NOTE", "FUNCTION_REFRESH_INI", "FUNCTION_TOGGLE_EMOTIONS", "FUNCTION_ADD_DECAL", "FUNCTION_TESTCODE", "FUNCTION_PLAYER_SPELLBOOK", "FUNCTION_AI_PROCESS_LISTS_PRINT", "FUNCTION_SHOW_QUEST_TARGETS", "FUNCTION_HAIR_TINT", "FUNCTION_SAVE_GAME", "FUNCTION_LOAD_GAME", "FUNCTION_DISPLAY_PLAYER_IDS", "FUNCTION_SET_DISPLAY_PLAYER_ID", "FUNCTION_TEST_ALL_CELLS", "FUNCTION_RENDERTESTCELL", "FUNCTION_RENDERTESTHERE", "FUNCTION_SAVE_WORLD", "FUNCTION_RELOAD_CURRENT_CLIMATE", "FUNCTION_RELOAD_CURRENT_WEATHER", "FUNCTION_TESTSEENDATA", "FUNCTION_TESTLOCALMAP", "FUNCTION_MOVE_TO_QUEST_TARGET", "FUNCTION_PRINT_NPC_DIALOG", "FUNCTION_TOGGLE_SUBTITLE", "FUNCTION_SHOW_RENDER_PASSES", "FUNCTION_FREEZE_RENDER_ACCUM", "FUNCTION_TOGGLE_OCCLUSION", "FUNCTION_OUTPUT_MEM_CONTEXTS", "FUNCTION_OUTPUT_MEM_STATS", "FUNCTION_SET_MEM_CHECK_POINT", "FUNCTION_GET_MEM_CHECK_POINT", "FUNCTION_INC_MEM_CHECK_POINT", "FUNCTION_OUTPUT_ALLOCATIONS", "FUNCTION_ADD_WATCH_ADDRESS", "FUNCTION_REMOVE_WATCH_ADDRESS", "FUNCTION_TOGGLEDETECTIONSTATS", "FUNCTION_SETTARGETREFRACTION", "FUNCTION_SETTARGETREFRACTIONFIRE", "FUNCTION_TOGGLEREFRACTIONDEBUG", "FUNCTION_TOGGLE_TCCS", "FUNCTION_SHOW_HEADTRACK_TARGET", "FUNCTION_SET_CINEMATIC_PARAM", "FUNCTION_SET_TINT_PARAM", "FUNCTION_SET_HDR_PARAM", "FUNCTION_SHOW_REF_POS", "FUNCTION_SHOW_PIVOT", "FUNCTION_PRINT_HDR_PARAM", "FUNCTION_TOGGLE_HDR_DEBUG", "FUNCTION_REVERT_WORLD", "FUNCTION_OUTPUT_ARCHIVE_PROFILE", "FUNCTION_QUITGAME", "FUNCTION_SCREENSHOT", "FUNCTION_SAVEINI", "FUNCTION_SET_DEBUG_TEXT", "FUNCTION_GET_DEBUG_TEXT", "FUNCTION_TOGGLELITEBRITE", "FUNCTION_RUN_MEMORY_PASS", "FUNCTION_RESET_MEM_CONTEXTS", "FUNCTION_TOGGLE_WATER_SYSTEM", "FUNCTION_TOGGLE_WATER_RADIUS", "FUNCTION_ACTORS_WHO_DETECT_PLAYER", "FUNCTION_TOGGLE_COMBAT_AI", "FUNCTION_TOGGLE_GAMEPAUSE", "FUNCTION_STEP_ONE_FRAME", "FUNCTION_TOGGLE_FLYCAM", "FUNCTION_TOGGLE_FXCAM", "FUNCTION_MOD_WATER_SHADER", "FUNCTION_MOD_WATER_COLOR", "FUNCTION_BEGIN_TRACE", "FUNCTION_RUN_CELL_TEST", "FUNCTION_START_ALL_QUESTS", "FUNCTION_COMPLETE_ALL_QUEST_STAGES", "FUNCTION_TOGGLE_FOG_OF_WAR", "FUNCTION_OUTPUT_LOCAL_MAP", "FUNCTION_SET_GAMMA", "FUNCTION_WASTE_MEMORY", "FUNCTION_CLEAR_ADAPTEDLIGHT", "FUNCTION_TOGGLE_CAST_SHADOWS", "FUNCTION_SET_HUD_GLOW_CONSTANTS", "FUNCTION_CLOSE_FILE", "FUNCTION_SET_TREE_MIPMAP_BIAS", "FUNCTION_SEND_DEBUG_TEXT", "FUNCTION_OUTPUT_MEM_STATS_FULL_WALK", "FUNCTION_PLAY_EXPLOSION", "FUNCTION_SET_DEPTH_OF_FIELD", "FUNCTION_SET_DEPTH_OF_FIELD_RANGE", "FUNCTION_SETTARGETDOF", "FUNCTION_TOGGLEFULLSCREENMOTIONBLUR", "FUNCTION_SETMOTIONBLUR", "FUNCTION_SET_VEL", "FUNCTION_DEBUG_COMBAT", "FUNCTION_TOGGLE_COMBAT_DEBUG", "FUNCTION_TOGGLE_PATHING_INFO", "FUNCTION_SHOW_INVENTORY", "FUNCTION_SHOW_INVENTORY_VARS", "FUNCTION_RESET_PERFORMANCE_TIMERS", "FUNCTION_TOGGLE_DECAL_DEBUG", "FUNCTION_TOGGLE_DECAL_RENDERING", "FUNCTION_SET_IMAGESPACE_MODIFIERS_ENABLE", "FUNCTION_SET_FREE_CAM_SPEED_MULT", "FUNCTION_TOGGLE_TESTLIGHT", "FUNCTION_PLACE_LOCATION_MARKER", "FUNCTION_CLEAR_LOCATION_MARKERS", "FUNCTION_TOGGLE_MULTIBOUND", "FUNCTION_ADD_OCCLUSIONPLANE", "FUNCTION_SET_GLOBAL_RADIAL_BLUR", "FUNCTION_OUTPUT_TEXTUREUSEMAP", "FUNCTION_CLEAR_SCREEN_BLOOD", "FUNCTION_RESET_DIALOGUE_FLAGS", "FUNCTION_GET_ACTOR_VALUE_INFO", "FUNCTION_TOGGLEBOUNDVIS", "FUNCTION_SET_CONSOLE_OUPUT_FILE", "FUNCTION_IGNORE_RENDER_PASS", "FUNCTION_PLAY_VATS_CAMERAS", "FUNCTION_SETTARGETFALLOFF", "FUNCTION_TOGGLE_ACTOR_MOVER", "FUNCTION_COPY_SAVE_GAMES", "FUNCTION_TOGGLEIMAGESPACE", "FUNCTION_FORCE_FILE_CACHE", "FUNCTION_DUMP_NI_UPDATES", "FUNCTION_TEST_DEGRADE_TEX", "FUNCTION_TOGGLE_DEPTH_BIAS", "FUNCTION_TOGGLE_SPU_RENDER_BATCH", "FUNCTION_TOGGLE_SPU_TRANSFORM_UPDATE", "FUNCTION_TOGGLE_SPU_CULLING", "FUNCTION_MODIFY_FACEGEN", "FUNCTION_FORCE_RSX_CRASH", "FUNCTION_SET_EMITTER_PARTICLE_MAX", "FUNCTION_SET_MPS_PARTICLE_MAX", "FUNCTION_SET_TASK_THREAD_SLEEP", "FUNCTION_SET_TASK_THREAD_UPDATE_SLEEP", "FUNCTION_EVAL_ACTOR_TEXTURES", "FUNCTION_CREATE_SAVE_DATA", "FUNCTION_CREATE_GAME_DATA", "FUNCTION_LOAD_FLASH_MOVIE", "FUNCTION_SHOW_MENU", "FUNCTION_HIDE_MENU", "FUNCTION_RECV_ANIM_EVENT", "FUNCTION_RUN_CONSOLE_BATCH", "FUNCTION_SET_MOVEMENT_GRAPH", "FUNCTION_SET_LOOKING_GRAPH", "FUNCTION_TOGGLE_HEAP_TRACKING", "FUNCTION_TOGGLE_POOL_TRACKING", "FUNCTION_RUMBLE_MANAGER", "FUNCTION_INSTALL_MEMORY_TRACKER", "FUNCTION_UNINSTALL_MEMORY_TRACKER", "FUNCTION_CHECK_MEMORY", "FUNCTION_SET_STACK_DEPTH", "FUNCTION_PATH_TO_REF", "FUNCTION_START_PLAYER_TEST_PATH", "FUNCTION_TEST_HANDLE_MANAGER_SHUTDOWN", "FUNCTION_SET_FACE_TARGET", "FUNCTION_PRECOMPUTED_LOS_GENERATION", "FUNCTION_PRECOMPUTED_LOS_DEBUG", "FUNCTION_GENERATE_COVER_EDGES", "FUNCTION_GENERATE_COVER_DEBUG", "FUNCTION_SET_PATH_SPRINTING", "FUNCTION_SET_ANIM_GRAPH_VAR", "FUNCTION_SET_TREE_TRUNK_FLEXIBILITY", "FUNCTION_SET_TREE_BRANCH_FLEXIBILITY", "FUNCTION_SET_TREE_BRANCH_ANIMATION_RANGE", "FUNCTION_SET_TREE_LEAF_FLEXIBILITY", "FUNCTION_SET_TREE_LEAF_AMPLITUDE", "FUNCTION_SET_TREE_LEAF_FREQUENCY", "FUNCTION_SET_TREE_WIND_DIRECTION", "FUNCTION_SET_TREE_WIND_MAGNITUDE", "FUNCTION_SET_BLOOD_PARAM", "FUNCTION_REGISTER_PREFIX", "FUNCTION_TOGGLE_EVENT_LOG", "FUNCTION_EXPORT_PERF_TRACKING_DATA", "FUNCTION_DISPLAY_GRAPH_VARIABLE", "FUNCTION_SET_MOTION_DRIVEN", "FUNCTION_SET_CONTROLS_DRIVEN", "FUNCTION_TOGGLE_GUI_OVERLAY", "FUNCTION_MODIFY_GUI_OVERLAY", "FUNCTION_ADD_CUSTOM_OVERLAY", "FUNCTION_SET_CUSTOM_OVERLAY_FORM", "FUNCTION_CLOSE_CUSTOM_OVERLAY", "FUNCTION_SET_CURRENT_SCENE_ACTION_COMPLETE", "FUNCTION_SET_CONSOLE_SCOPE_QUEST", "FUNCTION_GET_DISTANCE_FROM_ACTOR_S_PATH", "FUNCTION_CLEAR_CONSOLE", "FUNCTION_TOGGLE_MARKERS", "FUNCTION_KILL_ALL_PROJECTILES", "FUNCTION_PLAY_TERRAIN_EFFECT", "FUNCTION_TOGGLE_CELLINFO", "FUNCTION_TOGGLE_TEXTURES", "FUNCTION_TOGGLE_TIMING", "FUNCTION_TOGGLE_POLYGONS", "FUNCTION_TOGGLE_ACTORS_OVERLAY", "FUNCTION_TOGGLE_QUEST_OVERLAY", "FUNCTION_TOGGLE_PARTICLES_OVERLAY", "FUNCTION_TOGGLE_MEMORY", "FUNCTION_FILE_STREAMER_STATS", "FUNCTION_SET_GRAPHIC_MEMORY_HYSTERESIS", "FUNCTION_ALLOCATE_GRAPHIC_MEMORY", "FUNCTION_SHOW_NODES", "FUNCTION_SHOW_BONES", "FUNCTION_DPAGE_SNAPSHOT", "FUNCTION_OUTPUT_FIXED_STRING_TABLE", "FUNCTION_ATTACH_PAPYRUS_SCRIPT", "FUNCTION_SAVE_HAVOK_SNAPSHOT", "FUNCTION_SET_NPC_WEIGHT", "FUNCTION_SHOW_CLOSEST_LOCATION_FOR_SPHERE", "FUNCTION_PRINT_SHADER_MACROS", "FUNCTION_TOGGLE_AUDIO_OVERLAY", "FUNCTION_TOGGLE_PAPYRUS_LOG", "FUNCTION_TOGGLE_CONTEXT_OVERLAY", "FUNCTION_FORCE_OUT_OF_MEMORY", "FUNCTION_TOGGLE_MOVEMENT", "FUNCTION_TOGGLE_ANIMATIONS", "FUNCTION_SET_WARNING", "FUNCTION_TEST_FADENODES", "FUNCTION_SHOW_LOW_MAXHEIGHTS", "FUNCTION_SHOW_HIGH_MAXHEIGHTS", "FUNCTION_ENABLE_STORY_MANAGER_LOGGING", "FUNCTION_DUMP_PAPYRUS_LOGS", "FUNCTION_DUMP_PAPYRUS_TIMERS", "FUNCTION_DUMP_PAPYRUS_LOS_EVENTS", "FUNCTION_DUMP_PAPYRUS_DISTANCE_EVENTS", "FUNCTION_DUMP_PAPYRUS_PERSISTENCE_INFO", "FUNCTION_DUMP_PAPYRUS_EVENT_REGISTRATIONS", "FUNCTION_SOUND_CAT_MOD", "FUNCTION_RUN_COMPACTION", "FUNCTION_TOGGLE_ANIMATOR_CAM", "FUNCTION_TOGGLE_IMMORTAL_MODE", "FUNCTION_SET_SUBGRAPH_TO_DEBUG", "FUNCTION_ENABLE_RUMBLE", "FUNCTION_HAVOK_VDB_CAPTURE", "FUNCTION_TOGGLE_MAP_CAMERA", "FUNCTION_TOGGLE_NAVMESH_INFO", "FUNCTION_PLAY_SYNC_ANIM", "FUNCTION_SET_FORM_KNOWN", "FUNCTION_SET_DEBUG_QUEST", "FUNCTION_SET_QUEST_ALIAS_LOGGING", "FUNCTION_SET_RACE", "FUNCTION_FIND_FORM", "FUNCTION_START_PAPYRUS_SCRIPT_PROFILE", "FUNCTION_STOP_PAPYRUS_SCRIPT_PROFILE", "FUNCTION_START_PAPYRUS_FORM_PROFILE", "FUNCTION_STOP_PAPYRUS_FORM_PROFILE", "FUNCTION_START_PAPYRUS_STACK_ROOT_PROFILE", "FUNCTION_STOP_PAPYRUS_STACK_ROOT_PROFILE", "FUNCTION_TOGGLE_PAPYRUS_GLOBAL_PROFILE", "FUNCTION_PRINT_QUEST_SCENE_INFO", "FUNCTION_IS_INVULNERABLE", "FUNCTION_EXPORT_INVENTORY_ITEM_INFO", "FUNCTION_TOGGLE_COLLISION_MESH", "FUNCTION_TOGGLE_HAVOK_STEP_OVERLAY", "FUNCTION_ISOLATE_RENDERING", "FUNCTION_TOGGLE_WATER_CURRENT_GEOMETRY", "FUNCTION_PERFORM_ACTION", "FUNCTION_START_TRACK_PLAYER_DOORS", "FUNCTION_STOP_TRACK_PLAYER_DOORS", "FUNCTION_CHECK_PLAYER_DOORS", "FUNCTION_SET_IN_CHARGEN", "FUNCTION_CLEAR_ACHIEVEMENT", "FUNCTION_FORCE_RESET", "FUNCTION_FORCE_CLOSE_FILES", "FUNCTION_HOT_LOAD_PLUGIN", "FUNCTION_GENERATE_BENDABLE_SPLINE", "FUNCTION_RELOAD_SCRIPT", "FUNCTION_TEST_AIM", "FUNCTION_PUSH_CAMERA", "FUNCTION_MOVE_TO_EDITOR_CAMERA", "FUNCTION_MOVE_TO_EDITOR_SELECTION", "FUNCTION_PLACE_FURN_TEST", "FUNCTION_DUMP_CONDITION_FUNCTIONS", "FUNCTION_RELOAD_ANIMATION_GRAPHS", "FUNCTION_TOGGLE_HUD_OVERLAY", "FUNCTION_SET_HUD_OVERLAY_MODE", "FUNCTION_TOGGLE_WEAPON_OVERLAY", "FUNCTION_FORCE_DETECT", "FUNCTION_TOGGLE_ANIMATION_OVERLAY", "FUNCTION_TOGGLE_WARNINGS_OVERLAY", "FUNCTION_SHOW_SPECIAL_MENU", "FUNCTION_CHANGE_ANIM_ARCHETYPE", "FUNCTION_CHANGE_ANIM_FLAVOR", "FUNCTION_SET_ANGRY_WITH_PLAYER", "FUNCTION_FORCE_REPATH", "FUNCTION_FORCE_PATH_FAILURE", "FUNCTION_DUMP_FORMLIST", "FUNCTION_TRACE_ANIM_EVENTS", "FUNCTION_SHOW_MODS", "FUNCTION_DUMP_INPUT_ENABLE_LAYERS", "FUNCTION_ATTACH_MOD", "FUNCTION_REMOVE_MOD", "FUNCTION_SPAWN_TEMPLATED_OBJECT", "FUNCTION_CALL_PAPYRUS_FUNCTION", "FUNCTION_CALL_QUEST_PAPYRUS_FUNCTION", "FUNCTION_CALL_GLOBAL_PAPYRUS_FUNCTION", "FUNCTION_RESET_INPUT_ENABLE_LAYER", "FUNCTION_FORCE_ENABLE_PLAYER_CONTROLS", "FUNCTION_RESET_FORCE_ENABLED_PLAYER_CONTROLS", "FUNCTION_GET_ACTOR_OWNER", "FUNCTION_SET_ACTOR_OWNER", "FUNCTION_HAS_ACTOR_OWNER", "FUNCTION_SET_OUTFIT", "FUNCTION_PASS_TIME", "FUNCTION_LINK_LOCATIONS", "FUNCTION_SHOW_LINKED_LOCATIONS", "FUNCTION_SET_LINKED_REF", "FUNCTION_RESET_CONTAINER", "FUNCTION_SET_DEBUG_SCENE", "FUNCTION_PRELOAD_EXTERIOR", "FUNCTION_TEST_PATH", "FUNCTION_TOGGLE_CONTROLS_OVERLAY", "FUNCTION_REFRESH", "FUNCTION_TOGGLE_MTR", "FUNCTION_DYNAMIC_RESOLUTION", "FUNCTION_TEST_LOADING_MENU", "FUNCTION_RECALC_INSTANCE_DATA", "FUNCTION_DISMEMBER", "FUNCTION_TOGGLE_REF_POSE", "FUNCTION_PYCONSOLE", "FUNCTION_LUACONSOLE", "FUNCTION_SET_PERSIST_LOC", "FUNCTION_SET_LOC_REF_TYPE", "FUNCTION_SHOW_LOC_DATA", "FUNCTION_RESERVE_LOCATION", "FUNCTION_UPDATE_AWAKE_SOUND", "FUNCTION_PRINT_AUDIO_DEVICE_INFO", "FUNCTION_SET_HARVESTED", "FUNCTION_PAUSE_SCENE", "FUNCTION_SPAWN_DUPE", "FUNCTION_COMBINE_LOADED_OBJECTS", "FUNCTION_SHOW_COMBINED_OBJECTS", "FUNCTION_SHOW_MESH_LOD", "FUNCTION_FORCE_KILL_SOUND", "FUNCTION_DISABLE_DISTANT_REFERENCES", "FUNCTION_FIRE_ASSERT", "FUNCTION_FORCE_PERSISTENT", "FUNCTION_PLAY_EVENT_CAMERA", "FUNCTION_CHANGE_STANCE", "FUNCTION_AUDITION_SOUND_DESCRIPTOR", "FUNCTION_PUSH_SOUND_CATEGORY_SNAPSHOT", "FUNCTION_REMOVE_SOUND_CATEGORY_SNAPSHOT", "FUNCTION_BUILD_ANIMATION_DATA", "FUNCTION_SET_NUM_MTR_JOBS", "FUNCTION_SWITCH_SKELETON", "FUNCTION_GET_PLAYER_GREETING", "FUNCTION_CAPTURE_NEXT_FRAME_GPU", "FUNCTION_TOGGLE_PRECULLING", "FUNCTION_HIDE_NONOCCLUDERS", "FUNCTION_DUMP_POWER_GRIDS", "FUNCTION_SET_BONE_TINT_REGION", "FUNCTION_TOGGLE_CONTEXTROLL_OPTIM", "FUNCTION_SEND_DIALOGUE_EVENT", "FUNCTION_REFRESH_GLOBAL_TEXTURE", "FUNCTION_FORCE_SPEECHCHALLENGEALWAYSSUCCEED", "FUNCTION_FORCE_SPEECHCHALLENGEALWAYSFAIL", "FUNCTION_RUN_MATERIALS_ANALYSIS", "FUNCTION_CAPTURE_MESSAGES", "FUNCTION_SET_SSR_INTENSITY", "FUNCTION_SET_SSR_BLENDING_POWER", "FUNCTION_SET_SSR_ANGLE_THRESHOLD", "FUNCTION_SET_SSR_EDGE_FADE_FACTOR", "FUNCTION_SET_SSR_VERTICAL_BLUR_POWER", "FUNCTION_SET_SSR_VERTICAL_ALIGNMENT_POWER", "FUNCTION_SET_SSR_VERTICAL_STRETCHING_POWER", "FUNCTION_SET_SSR_RAY_STEP_SCALE", "FUNCTION_TOGGLE_ZPREPASS", "FUNCTION_TOGGLE_RAIN_OCCLUSION", "FUNCTION_SET_GPU_MEMORY_PRIORITY", "FUNCTION_TOGGLE_RAIN_SPLASH", "FUNCTION_CAPTURE_MESSAGE", "FUNCTION_TOGGLE_TRIJUICE", "FUNCTION_SET_PRESENT_THRESHOLD", "FUNCTION_LOGIN", "FUNCTION_LOGIN_SSO", "FUNCTION_LOGOUT", "FUNCTION_IS_LOGGED_IN", "FUNCTION_CREATE_ACCOUNT", "FUNCTION_LINK_ACCOUNT", "FUNCTION_UNLINK_ACCOUNT", "FUNCTION_REQUEST_OTP", "FUNCTION_VERIFY_OTP", "FUNCTION_GET_LEGAL_DOCS", "FUNCTION_ACCEPT_LEGAL_DOC", "FUNCTION_SUBSCRIBE_UGC", "FUNCTION_UNSUBSCRIBE_UGC", "FUNCTION_GET_SUBSCRIBED_LIST", "FUNCTION_FOLLOW_UGC", "FUNCTION_UNFOLLOW_UGC", "FUNCTION_GET_FOLLOWED_LIST", "FUNCTION_GET_UGC_DETAILS", "FUNCTION_DOWNLOAD_UGC", "FUNCTION_TOGGLE_MTR_DEFERRED_LIGHTS", "FUNCTION_NV_GODRAY_SETTINGS", "FUNCTION_NV_FLEX_SETTINGS", "FUNCTION_NV_HBAO_SETTINGS", "FUNCTION_EXPORT_WORKSHOP_POWER_GRID", "FUNCTION_ENTER_WORKSHOP_MODE", "FUNCTION_TOGGLE_VBLANK_OPTIM", "FUNCTION_PROCESS_VALID_DISMEMBERMENTS", "FUNCTION_TOGGLE_SEGMENT_VISIBILITY", "FUNCTION_ADD_KEYWORD", "FUNCTION_SET_AMBIENT_PARTICLES_ENABLED", "FUNCTION_TOGGLE_DOQM", "FUNCTION_SCRAP_ALL", "FUNCTION_GET_BUDGET_COUNTS", "FUNCTION_WORKSHOP_BUDGET", "FUNCTION_TOGGLE_LOOKAT_DEBUG", "FUNCTION_SET_ESRAM_SETUP", "FUNCTION_TOGGLE_ESRAM", "FUNCTION_SET_BOOKVIEWPORT", "FUNCTION_SET_BOOKOFFSET", "FUNCTION_TOGGLE_MTA", "FUNCTION_SET_PRESENT_INTERVAL", "FUNCTION_SET_CALLSTACK_DEPTH", "FUNCTION_COMMANDED_ACTIVATE", "FUNCTION_STORE_IN_WORKSHOP", "FUNCTION_EXPORT_INR_TO_FILE", "FUNCTION_GET_ORBIS_MOD_INFO", "END_OF_CONSOLE_SECTION", "CONSOLE_COUNT", "START_OF_FUNCTION_SECTION", "FUNCTION_GET_WANT_BLOCKING", "FUNCTION_GET_DISTANCE", "FUNCTION_ADD_ITEM", "FUNCTION_SET_ESSENTIAL", "FUNCTION_ROTATE", "FUNCTION_GET_LOCKED", "FUNCTION_GET_POS", "FUNCTION_SET_POS", "FUNCTION_GET_ANGLE", "FUNCTION_SET_ANGLE", "FUNCTION_GET_STARTING_POS", "FUNCTION_GET_STARTING_ANGLE", "FUNCTION_GET_SECONDS_PASSED", "FUNCTION_ACTIVATE", "FUNCTION_GET_ACTOR_VALUE", "FUNCTION_SET_ACTOR_VALUE", "FUNCTION_MOD_ACTOR_VALUE", "FUNCTION_SET_AT_START", "FUNCTION_GET_CURRENT_TIME", "FUNCTION_PLAY_GROUP", "FUNCTION_LOOP_GROUP", "FUNCTION_SKIP_ANIM", "FUNCTION_START_COMBAT", "FUNCTION_STOP_COMBAT", "FUNCTION_GET_SCALE", "FUNCTION_IS_MOVING", "FUNCTION_IS_TURNING", "FUNCTION_GET_LINE_OF_SIGHT", "FUNCTION_ADD_SPELL", "FUNCTION_REMOVE_SPELL", "FUNCTION_CAST", "FUNCTION_GET_BUTTON_PRESSED", "FUNCTION_GET_IN_SAME_CELL", "FUNCTION_ENABLE", "FUNCTION_DISABLE", "FUNCTION_GET_DISABLED", "FUNCTION_MENU_MODE", "FUNCTION_PLACE_AT_ME", "FUNCTION_PLAY_SOUND", "FUNCTION_GET_DISEASE", "FUNCTION_FAIL_ALL_OBJECTIVES", "FUNCTION_GET_CLOTHING_VALUE", "FUNCTION_SAME_FACTION", "FUNCTION_SAME_RACE", "FUNCTION_SAME_SEX", "FUNCTION_GET_DETECTED", "FUNCTION_GET_DEAD", "FUNCTION_GET_ITEM_COUNT", "FUNCTION_GET_GOLD", "FUNCTION_GET_SLEEPING", "FUNCTION_GET_TALKED_TO_PC", "FUNCTION_SAY", "FUNCTION_SAY_TO", "FUNCTION_SHOW_HELP_MESSAGE", "FUNCTION_START_QUEST", "FUNCTION_STOP_QUEST", "FUNCTION_GET_QUEST_RUNNING", "FUNCTION_SET_STAGE", "FUNCTION_GET_STAGE", "FUNCTION_GET_STAGE_DONE", "FUNCTION_GET_FACTION_RANK_DIFFERENCE", "FUNCTION_GET_ALARMED", "FUNCTION_IS_RAINING", "FUNCTION_GET_ATTACKED", "FUNCTION_GET_IS_CREATURE", "FUNCTION_GET_LOCK_LEVEL", "FUNCTION_GET_SHOULD_ATTACK", "FUNCTION_GET_IN_CELL", "FUNCTION_GET_IS_CLASS", "FUNCTION_GET_IS_RACE", "FUNCTION_GET_IS_SEX", "FUNCTION_GET_IN_FACTION", "FUNCTION_GET_IS_ID", "FUNCTION_GET_FACTION_RANK", "FUNCTION_GET_GLOBAL_VALUE", "FUNCTION_IS_SNOWING", "FUNCTION_FAST_TRAVEL", "FUNCTION_GET_RANDOMPERCENT", "FUNCTION_REMOVE_MUSIC", "FUNCTION_WOULD_BE_STEALING", "FUNCTION_GET_LEVEL", "FUNCTION_IS_ROTATING", "FUNCTION_REMOVE_ITEM", "FUNCTION_GET_LEVELEDENCOUNTER_VALUE", "FUNCTION_GET_DEAD_COUNT", "FUNCTION_ADD_TO_MAP", "FUNCTION_START_CONVERSATION", "FUNCTION_DROP", "FUNCTION_ADD_TOPIC", "FUNCTION_MESSAGE", "FUNCTION_SET_ALERT", "FUNCTION_GET_ALERT", "FUNCTION_LOOK", "FUNCTION_STOP_LOOK", "FUNCTION_EVALUATE_PACKAGE", "FUNCTION_SEND_ASSAULT_ALARM", "FUNCTION_ENABLE_PLAYER_CONTROLS", "FUNCTION_DISABLE_PLAYER_CONTROLS", "FUNCTION_GET_PLAYER_CONTROLS_DISABLED", "FUNCTION_GET_HEADING_ANGLE", "FUNCTION_PICK_IDLE", "FUNCTION_IS_WEAPON_MAGIC_OUT", "FUNCTION_IS_TORCH_OUT", "FUNCTION_IS_SHIELD_OUT", "FUNCTION_CREATE_DETECTION_EVENT", "FUNCTION_IS_ACTION_REF", "FUNCTION_IS_FACING_UP", "FUNCTION_GET_KNOCKED_STATE", "FUNCTION_GET_WEAPON_ANIM_TYPE", "FUNCTION_IS_WEAPON_SKILL_TYPE", "FUNCTION_GET_CURRENT_AI_PACKAGE", "FUNCTION_IS_WAITING", "FUNCTION_IS_IDLE_PLAYING", "FUNCTION_COMPLETE_QUEST", "FUNCTION_LOCK", "FUNCTION_UNLOCK", "FUNCTION_IS_INTIMIDATED", "FUNCTION_IS_PLAYER_IN_REGION", "FUNCTION_GET_ACTOR_AGGRO_RADIUS_VIOLATION", "FUNCTION_GET_CRIME_KNOWN", "FUNCTION_SET_ENEMY", "FUNCTION_SET_ALLY", "FUNCTION_GET_CRIME", "FUNCTION_IS_GREETING_PLAYER", "FUNCTION_START_SANDMAN", "FUNCTION_IS_GUARD", "FUNCTION_START_CANNIBAL", "FUNCTION_HAS_BEEN_EATEN", "FUNCTION_GET_STAMINA_PERCENT", "FUNCTION_HAS_BEEN_READ", "FUNCTION_GET_DYING", "FUNCTION_GET_SCENE_ACTION_PERCENT", "FUNCTION_WOULD_REFUSE_COMMAND", "FUNCTION_SAME_FACTION_PC", "FUNCTION_SAME_RACE_PC", "FUNCTION_SAME_SEX_PC", "FUNCTION_GET_IS_REF", "FUNCTION_SET_FACTION_RANK", "FUNCTION_MOD_FACTION_RANK", "FUNCTION_KILL_ACTOR", "FUNCTION_RESURRECT_ACTOR", "FUNCTION_IS_TALKING", "FUNCTION_GET_COMPONENT_COUNT", "FUNCTION_GET_CURRENT_AI_PROCEDURE", "FUNCTION_GET_TRESPASS_WARNING_LEVEL", "FUNCTION_IS_TRESPASSING", "FUNCTION_IS_IN_MY_OWNED_CELL", "FUNCTION_GET_WIND_SPEED", "FUNCTION_GET_WEATHER_PCT", "FUNCTION_GET_WEATHER", "FUNCTION_IS_CONTINUING_PACKAGE_PCNEAR", "FUNCTION_SET_CRIMEFACTION", "FUNCTION_GET_IS_CRIMEFACTION", "FUNCTION_CAN_HAVE_FLAMES", "FUNCTION_HAS_FLAMES", "FUNCTION_ADD_FLAMES", "FUNCTION_REMOVE_FLAMES", "FUNCTION_GET_OPEN_STATE", "FUNCTION_MOVE_TO_MARKER", "FUNCTION_GET_SITTING", "FUNCTION_GET_FURNITURE_MARKER_ID", "FUNCTION_GET_IS_CURRENT_PACKAGE", "FUNCTION_IS_CURRENT_FURNITURE_REF", "FUNCTION_IS_CURRENT_FURNITURE_OBJ", "FUNCTION_SETSIZE", "FUNCTION_REMOVE_ME", "FUNCTION_DROP_ME", "FUNCTION_GET_FACTION_REACTION", "FUNCTION_SET_FACTION_REACTION", "FUNCTION_MOD_FACTION_REACTION", "FUNCTION_GET_DAY_OF_WEEK", "FUNCTION_IGNORE_CRIME", "FUNCTION_GET_TALKED_TO_PC_PARAM", "FUNCTION_REMOVE_ALL_ITEMS", "FUNCTION_WAKE_UP_PC", "FUNCTION_IS_PC_SLEEPING", "FUNCTION_IS_PC_A_MURDERER", "FUNCTION_SET_COMBAT_STYLE", "FUNCTION_PLAY_SOUND3D", "FUNCTION_SELECT_PLAYER_SPELL", "FUNCTION_IS_IN_SAME_LOC_AS_REF", "FUNCTION_IS_IN_SAME_LOC_AS_REFALIAS", "FUNCTION_GET_EQUIPPED", "FUNCTION_WAIT", "FUNCTION_STOP_WAITING", "FUNCTION_IS_SWIMMING", "FUNCTION_SCRIPT_EFFECT_ELAPSED_SECONDS", "FUNCTION_SET_CELL_PUBLIC", "FUNCTION_GET_PC_SLEEP_HOURS", "FUNCTION_SET_PC_SLEEP_HOURS", "FUNCTION_GET_AMOUNT_SOLD_STOLEN", "FUNCTION_MOD_AMOUNT_SOLD_STOLEN", "FUNCTION_GET_IGNORING_CRIME", "FUNCTION_GET_PC_EXPELLED", "FUNCTION_SET_PC_EXPELLED", "FUNCTION_GET_PC_FACTION_MURDER", "FUNCTION_SET_PC_FACTION_MURDER", "FUNCTION_GET_PC_ENEMY_OF_FACTION", "FUNCTION_SET_PC_ENEMY_OF_FACTION", "FUNCTION_GET_PC_FACTION_ATTACK", "FUNCTION_SET_PC_FACTION_ATTACK", "FUNCTION_START_SCENE", "FUNCTION_STOP_SCENE", "FUNCTION_GET_DESTROYED", "FUNCTION_SET_DESTROYED", "FUNCTION_GET_ACTION_REF", "FUNCTION_GET_SELF", "FUNCTION_GET_CONTAINER", "FUNCTION_GET_FORCE_RUN", "FUNCTION_SET_FORCE_RUN", "FUNCTION_GET_FORCE_SNEAK", "FUNCTION_SET_FORCE_SNEAK", "FUNCTION_ADVANCE_SKILL", "FUNCTION_ADVANCE_LEVEL", "FUNCTION_HAS_MAGIC_EFFECT", "FUNCTION_GET_DEFAULT_OPEN", "FUNCTION_SET_DEFAULT_OPEN", "FUNCTION_SHOW_CLASS_MENU", "FUNCTION_SHOW_LOOKS_MENU", "FUNCTION_SPAWN", "FUNCTION_SHOW_NAME_MENU", "FUNCTION_SET_OPEN_STATE", "FUNCTION_RESET_REFERENCE", "FUNCTION_IS_SPELL_TARGET", "FUNCTION_GET_VATS_MODE", "FUNCTION_GET_PERSUASSION_NUMBER", "FUNCTION_GET_VAMPIRE_FEED", "FUNCTION_GET_CANNIBAL", "FUNCTION_GET_IS_DEFAULT_CLASS", "FUNCTION_GET_IS_MYCLASS_DEFAULT", "FUNCTION_GET_IN_CELL_PARAM", "FUNCTION_GET_PLAYER_DIALOGUE_INPUT", "FUNCTION_GET_COMBAT_TARGET", "FUNCTION_GET_PACKAGE_TARGET", "FUNCTION_SHOW_SPELLMAKING_MENU", "FUNCTION_GET_VATS_TARGET_HEIGHT", "FUNCTION_SET_GHOST", "FUNCTION_GET_GHOST", "FUNCTION_EQUIP_OBJECT", "FUNCTION_UNEQUIP_OBJECT", "FUNCTION_SET_CLASS", "FUNCTION_SET_UNCONSCIOUS", "FUNCTION_GET_UNCONSCIOUS", "FUNCTION_SET_RESTRAINED", "FUNCTION_GET_RESTRAINED", "FUNCTION_FORCE_FLEE", "FUNCTION_GET_IS_USED_ITEM", "FUNCTION_GET_IS_USED_ITEM_TYPE", "FUNCTION_GET_SCENE_ACTIVE", "FUNCTION_IS_IN_DIALOGUE_WITH_PLAYER", "FUNCTION_GET_LOCATION_CLEARED", "FUNCTION_SET_LOCATION_CLEARED", "FUNCTION_FORCE_INTO_ALIAS", "FUNCTION_CLEAR_ALIAS", "FUNCTION_GET_IS_PLAYABLE_RACE", "FUNCTION_GET_OFFERS_SERVICES_NOW", "FUNCTION_GET_GAMESETTING", "FUNCTION_STOP_COMBAT_ALARM_AGAINST_ACTOR", "FUNCTION_HAS_ASSOCIATION_TYPE_ID", "FUNCTION_HAS_FAMILY_RELATIONSHIP", "FUNCTION_SET_WEATHER", "FUNCTION_HAS_PARENT_RELATIONSHIP", "FUNCTION_IS_WARNING_ABOUT", "FUNCTION_IS_WEAPON_OUT", "FUNCTION_HAS_SPELL", "FUNCTION_IS_TIME_PASSING", "FUNCTION_IS_PLEASANT", "FUNCTION_IS_CLOUDY", "FUNCTION_TRAP_UPDATE", "FUNCTION_SHOW_QUEST_OBJECTIVES", "FUNCTION_FORCE_ACTOR_VALUE", "FUNCTION_INCREMENT_SKILL", "FUNCTION_DO_TRAP", "FUNCTION_SET_PLAYER_FAST_TRAVEL", "FUNCTION_IS_SMALL_BUMP", "FUNCTION_GET_PARENT_REF", "FUNCTION_UNUSED_22", "FUNCTION_GET_BASE_ACTOR_VALUE", "FUNCTION_GET_OWNERSHIP", "FUNCTION_SET_OWNERSHIP", "FUNCTION_SETCELLOWNERSHIP", "FUNCTION_ISCELLOWNERSHIP", "FUNCTION_ISHORSE_STOLEN", "FUNCTION_SET_CELL_FULLNAME", "FUNCTION_SET_ACTOR_FULLNAME", "FUNCTION_IS_LEFT_UP", "FUNCTION_IS_SNEAKING", "FUNCTION_IS_RUNNING", "FUNCTION_FRIEND_NUMBER_HIT", "FUNCTION_IS_IN_COMBAT", "FUNCTION_SET_PACKAGE_DURATION", "FUNCTION_PLAY_MAGIC_SHADER", "FUNCTION_PLAY_MAGIC_EFFECT", "FUNCTION_STOP_MAGIC_SHADER", "FUNCTION_STOP_MAGIC_EFFECT", "FUNCTION_RESET_CELL", "FUNCTION_IS_ANIM_PLAYING", "FUNCTION_SET_ACTOR_ALPHA", "FUNCTION_ENABLE_LINKED_PATHPOINTS", "FUNCTION_DISABLE_LINKED_PATHPOINTS", "FUNCTION_GET_INTERIOR", "FUNCTION_FORCE_WEATHER", "FUNCTION_TOGGLE_ACTORS_AI", "FUNCTION_IS_ACTORS_AI_OFF", "FUNCTION_IS_WATER_OBJECT", "FUNCTION_GET_PLAYER_ACTION", "FUNCTION_IS_USING_TORCH", "FUNCTION_SET_LEVEL", "FUNCTION_RESET_FALL_DAMAGE_TIMER", "FUNCTION_IS_XBOX", "FUNCTION_GET_IN_WORLDSPACE", "FUNCTION_MOD_PLAYER_MISC_STAT", "FUNCTION_GET_PLAYER_MISC_STAT", "FUNCTION_GET_PAIRED_ANIMATION", "FUNCTION_IS_CRIME_VICTIM", "FUNCTION_GET_TOTAL_PERSUASSION_CHANGE", "FUNCTION_SET_SCALE", "FUNCTION_MOD_SCALE", "FUNCTION_GET_IDLE_DONE_IN_PROCEDURE", "FUNCTION_KILL_ALL_ACTORS", "FUNCTION_GET_NO_RUMORS", "FUNCTION_SET_NO_RUMORS", "FUNCTION_DISPEL", "FUNCTION_GET_COMBAT_STATE", "FUNCTION_TRIGGER_HIT_SHADER", "FUNCTION_GET_WITHIN_PACKAGE_LOCATION", "FUNCTION_RESET3DSTATE", "FUNCTION_IS_RIDING_MOUNT", "FUNCTION_DISPEL_ALL_SPELLS", "FUNCTION_IS_FLEEING", "FUNCTION_ADD_ACHIEVEMENT", "FUNCTION_DUPLICATE_CONTAINER_ITEMS", "FUNCTION_IS_IN_LAVA", "FUNCTION_ESSENTIAL_DEATH_RELOAD", "FUNCTION_SHOW_QUEST_ITEMS", "FUNCTION_DUPLICATE_NPC_STATS", "FUNCTION_RESET_HEALTH", "FUNCTION_SET_IGNORE_FRIENDLY_HITS", "FUNCTION_GET_IGNORE_FRIENDLY_HITS", "FUNCTION_IS_PLAYERS_LAST_RIDDEN_MOUNT", "FUNCTION_SETREFRACTION", "FUNCTION_SET_ITEM_VALUE", "FUNCTION_SET_RIGID_BODY_MASS", "FUNCTION_SHOW_VIEWER_STRINGS", "FUNCTION_RELEASE_WEATHER_OVERRIDE", "FUNCTION_SET_ALL_REACHABLE", "FUNCTION_SET_ALL_VISIBLE", "FUNCTION_SET_NO_AVOIDANCE", "FUNCTION_SEND_TRESPASS_CRIME_ALARM", "FUNCTION_SET_SCENE_IS_COMPLEX", "FUNCTION_AUTOSAVE", "FUNCTION_START_MASTER_FILE_SEEK_DATA", "FUNCTION_DUMP_MASTER_FILE_SEEK_DATA", "FUNCTION_IS_ACTOR", "FUNCTION_IS_ESSENTIAL", "FUNCTION_PRELOAD_MAGIC_EFFECT", "FUNCTION_SHOW_DIALOG_SUBTITLES_ALWAYS", "FUNCTION_RESISTING_ARREST", "FUNCTION_IS_PLAYER_MOVINGINTO_NEW_SPACE", "FUNCTION_GET_IN_CURRENT_LOC", "FUNCTION_GET_IN_CURRENT_LOCALIAS", "FUNCTION_GET_TIME_DEAD", "FUNCTION_HAS_LINKED_REF", "FUNCTION_GET_LINKED_REF", "FUNCTION_DAMAGE_OBJECT", "FUNCTION_IS_CHILD", "FUNCTION_GET_FACTIONS_STOLEN_ITEM_VALUE_NO_CRIME", "FUNCTION_GET_LAST_PLAYER_ACTION", "FUNCTION_IS_PLAYER_ACTION_ACTIVE", "FUNCTION_SET_TALKING_ACTIVATOR_ACTOR", "FUNCTION_IS_TALKING_ACTIVATOR_ACTOR", "FUNCTION_SHOW_BARTER_MENU", "FUNCTION_IS_IN_LIST", "FUNCTION_GET_FACTIONS_STOLEN_ITEM_VALUE_CRIME", "FUNCTION_ADD_PERK", "FUNCTION_GETCRIMEGOLD_VIOLENT", "FUNCTION_GETCRIMEGOLD_NONVIOLENT", "FUNCTION_SHOW_REPAIR_MENU", "FUNCTION_IS_OWNED_BY", "FUNCTION_ADD_NOTE", "FUNCTION_GETDISTANCE_TO_COMMANDED_ACTOR", "FUNCTION_GETDISTANCE_TO_COMMANDED_LOCATION", "FUNCTION_ADD_FACTION", "FUNCTION_REMOVE_FACTION", "FUNCTION_DAMAGE_ACTOR_VALUE", "FUNCTION_RESTORE_ACTOR_VALUE", "FUNCTION_TRIGGER_HUD_SHUDDER", "FUNCTION_GET_OBJECTIVE_FAILED", "FUNCTION_SET_OBJECTIVE_FAILED", "FUNCTION_SET_GLOBAL_TIME_MULTIPLIER", "FUNCTION_GET_HIT_LOCATION", "FUNCTION_IS_PC_1ST_PERSON", "FUNCTION_PURGECELLBUFFERS", "FUNCTION_PUSH_ACTOR_AWAY", "FUNCTION_SET_ACTORS_AI", "FUNCTION_CLEAR_OWNERSHIP", "FUNCTION_GET_CAUSE_OF_DEATH", "FUNCTION_IS_LIMB_GONE", "FUNCTION_IS_WEAPON_IN_LIST", "FUNCTION_PLAY_IDLE", "FUNCTION_APPLY_IMAGESPACE_MODIFIER", "FUNCTION_REMOVE_IMAGESPACE_MODIFIER", "FUNCTION_IS_BRIBED", "FUNCTION_GET_RELATIONSHIP_RANK", "FUNCTION_SET_RELATIONSHIP_RANK", "FUNCTION_SETCELLIMAGESPACE", "FUNCTION_SHOWCHARGENMENU", "FUNCTION_GET_VATS_VALUE", "FUNCTION_GET_KILLER", "FUNCTION_GET_KILLER_OBJECT", "FUNCTION_GET_COMBAT_FACTION_REACTION", "FUNCTION_USE_WEAPON", "FUNCTION_EVALUATE_SPELL_CONDITIONS", "FUNCTION_TOGGLEMOTIONBLUR", "FUNCTION_EXISTS", "FUNCTION_GET_GROUP_MEMBER_COUNT", "FUNCTION_GET_GROUP_TARGET_COUNT", "FUNCTION_SET_OBJECTIVE_COMPLETED", "FUNCTION_SET_OBJECTIVE_DISPLAYED", "FUNCTION_GET_OBJECTIVE_COMPLETED", "FUNCTION_GET_OBJECTIVE_DISPLAYED", "FUNCTION_SETIMAGESPACE", "FUNCTION_PIPBOY_RADIO", "FUNCTION_REMOVE_PERK", "FUNCTION_DISABLE_ALL_ACTORS", "FUNCTION_GET_IS_FORM_TYPE", "FUNCTION_GET_IS_VOICE_TYPE", "FUNCTION_GET_PLANTED_EXPLOSIVE", "FUNCTION_COMPLETE_ALL_OBJECTIVES", "FUNCTION_IS_SCENE_PACKAGE_RUNNING", "FUNCTION_GET_HEALTH_PERCENT", "FUNCTION_SET_AUDIO_MULTITHREADING", "FUNCTION_GET_IS_OBJECT_TYPE", "FUNCTION_SHOWCHARGENMENUPARAMS", "FUNCTION_PLAYER_VISUAL_DETECTION", "FUNCTION_PLAYER_AUDIO_DETECTION", "FUNCTION_EXIT_GAME", "FUNCTION_GET_IS_CREATURE_TYPE", "FUNCTION_HAS_KEY", "FUNCTION_IS_FURN_ENTRYTYPE", "FUNCTION_SHOW_WARNING", "FUNCTION_TRIGGER", "FUNCTION_MARK_FOR_DELETE", "FUNCTION_SET_PLAYER_AI_DRIVEN", "FUNCTION_GET_IN_CURRENT_LOC_FORMLIST", "FUNCTION_GET_IN_ZONE", "FUNCTION_GET_VELOCITY", "FUNCTION_GET_GRAPH_VARIABLE_FLOAT", "FUNCTION_HAS_PERK", "FUNCTION_GET_FACTION_RELATION", "FUNCTION_IS_LAST_IDLE_PLAYED", "FUNCTION_SET_NPC_RADIO", "FUNCTION_SET_PLAYER_TEAMMATE", "FUNCTION_GET_PLAYER_TEAMMATE", "FUNCTION_GET_PLAYER_TEAMMATE_COUNT", "FUNCTION_OPEN_ACTOR_CONTAINER", "FUNCTION_CLEAR_PLAYER_FACTION_ENEMY", "FUNCTION_CLEAR_ACTORS_FACTION_PLAYER_ENEMY", "FUNCTION_IS_ACTOR_CRIME_ENEMY_PLAYER", "FUNCTION_GET_CRIME_GOLD", "FUNCTION_SET_CRIME_GOLD", "FUNCTION_MOD_CRIME_GOLD", "FUNCTION_GET_PLAYER_GRABBED_REF", "FUNCTION_IS_PLAYER_GRABBED_REF", "FUNCTION_PLACE_LEVELED_ACTOR_AT_ME", "FUNCTION_GET_KEYWORD_ITEM_COUNT", "FUNCTION_SHOW_LOCKPICK_MENU", "FUNCTION_GET_BROADCAST_STATE", "FUNCTION_SET_BROADCAST_STATE", "FUNCTION_START_RADIO_CONVERSATION", "FUNCTION_GET_DESTRUCTION_STAGE", "FUNCTION_CLEAR_DESTRUCTION", "FUNCTION_CAST_IMMEDIATE_SELF", "FUNCTION_GET_IS_ALIGNMENT", "FUNCTION_RESET_QUEST", "FUNCTION_SET_QUEST_DELAY", "FUNCTION_IS_PROTECTED", "FUNCTION_GET_THREAT_RATIO", "FUNCTION_MATCH_FACE_GEOMETRY", "FUNCTION_GET_IS_USEDITEM_EQUIPTYPE", "FUNCTION_GET_PLAYER_NAME", "FUNCTION_FIRE_WEAPON", "FUNCTION_PAY_FINE", "FUNCTION_GET_ACTOR_ACTIVATED", "FUNCTION_MATCH_RACE", "FUNCTION_GET_FULLY_ENABLED_ACTORS_IN_HIGH", "FUNCTION_SEX_CHANGE", "FUNCTION_IS_CARRYABLE", "FUNCTION_GET_CONCUSSED", "FUNCTION_SET_ZONE_RESPAWNS", "FUNCTION_SET_VATS_TARGET", "FUNCTION_GET_MAP_MARKER_VISIBLE", "FUNCTION_RESETINVENTORY", "FUNCTION_PLAYER_KNOWS", "FUNCTION_GET_PERMANENT_ACTOR_VALUE", "FUNCTION_GET_KILLING_BLOW_LIMB", "FUNCTION_SEND_PLAYER_TO_JAIL", "FUNCTION_GET_CAN_PAY_CRIME_GOLD", "FUNCTION_SERVE_TIME", "FUNCTION_GET_DAYS_IN_JAIL", "FUNCTION_EP_ALCHEMY_GET_MAKING_POISON", "FUNCTION_EP_ALCHEMY_EFFECT_HAS_KEYWORD", "FUNCTION_SHOW_ALL_MAP_MARKERS", "FUNCTION_GET_ALLOW_WORLD_INTERACTIONS", "FUNCTION_RESET_AI", "FUNCTION_SET_RUMBLE", "FUNCTION_DIALOGUE_GETAV", "FUNCTION_DIALOGUE_HASPERK", "FUNCTION_IS_LAST_HIT_CRITICAL", "FUNCTION_ADD_MUSIC", "FUNCTION_DIALOGUE_GETITEM_COUNT", "FUNCTION_LAST_CRIPPLED_ACTOR_VALUE", "FUNCTION_HAS_SHARED_POWER_GRID", "FUNCTION_IS_COMBAT_TARGET", "FUNCTION_TRIGGER_SCREEN_BLOOD", "FUNCTION_VATS_RIGHT_AREA_FREE", "FUNCTION_VATS_LEFT_AREA_FREE", "FUNCTION_VATS_BACK_AREA_FREE", "FUNCTION_VATS_FRONT_AREA_FREE", "FUNCTION_GET_IS_LOCK_BROKEN", "FUNCTION_IS_PS3", "FUNCTION_IS_PC", "FUNCTION_VATS_RIGHT_TARGET_VISIBLE", "FUNCTION_VATS_LEFT_TARGET_VISIBLE", "FUNCTION_VATS_BACK_TARGET_VISIBLE", "FUNCTION_VATS_FRONT_TARGET_VISIBLE", "FUNCTION_ATTACH_ASH_PILE", "FUNCTION_SET_CRITICAL_STAGE", "FUNCTION_IS_IN_CRITICAL_STAGE", "FUNCTION_REMOVE_FROM_ALL_FACTIONS", "FUNCTION_GET_XP_FOR_NEXT_LEVEL", "FUNCTION_SHOW_LOCKPICK_MENU_DEBUG", "FUNCTION_FORCE_SAVE", "FUNCTION_GET_INFAMY", "FUNCTION_GET_INFAMY_VIOLENT", "FUNCTION_GET_INFAMY_NON_VIOLENT", "FUNCTION_GET_TYPE_OF_COMMAND_ACTOR_PREFORMING", "FUNCTION_SIN", "FUNCTION_COS", "FUNCTION_TAN", "FUNCTION_SQRT", "FUNCTION_LOG", "FUNCTION_ABS", "FUNCTION_GET_QUEST_COMPLETED", "FUNCTION_GET_CHALLENGE_SUCCESS_LEVEL", "FUNCTION_RADIO_SHUT_OFF", "FUNCTION_AUTO_DISPLAY_OBJECTIVES", "FUNCTION_IS_GORE_DISABLED", "FUNCTION_FADE_SFX", "FUNCTION_SET_MINIMAL_USE", "FUNCTION_IS_SCENE_ACTION_COMPLETE", "FUNCTION_SHOW_QUEST_STAGES", "FUNCTION_GET_SPELL_USAGE_NUMBER", "FUNCTION_FORCE_RADIO_STATION_UPDATE", "FUNCTION_GET_ACTORS_IN_HIGH", "FUNCTION_HAS_LOADED_3D", "FUNCTION_DISABLE_ALL_MINES", "FUNCTION_SET_LAST_EXT_DOOR_ACTIVATED", "FUNCTION_KILLQUESTUPDATES", "FUNCTION_IS_IMAGESPACE_ACTIVE", "FUNCTION_HAS_KEYWORD", "FUNCTION_HAS_REFTYPE", "FUNCTION_LOCATION_HAS_KEYWORD", "FUNCTION_LOCATION_HAS_REFTYPE", "FUNCTION_CREATE_EVENT", "FUNCTION_IN_LOCATION", "FUNCTION_IS_ALIASREF", "FUNCTION_IN_ALIASLOC", "FUNCTION_IS_SPRINTING", "FUNCTION_IS_BLOCKING", "FUNCTION_HAS_EQUIPPED_SPELL", "FUNCTION_GET_CURRENT_CASTING_TYPE", "FUNCTION_GET_CURRENT_DELIVERY_TYPE", "FUNCTION_EQUIP_SPELL", "FUNCTION_GET_ATTACK_STATE", "FUNCTION_GET_ALIASED_REF", "FUNCTION_GET_EVENT_DATA", "FUNCTION_IS_CLOSER_TO_A_THAN_B", "FUNCTION_LEVEL_MINUS_PC_LEVEL", "UNUSED_FUNCTION_GET_EQUIPPED_SHOUT", "FUNCTION_IS_BLEEDING_OUT", "FUNCTION_UNLOCK_WORD", "FUNCTION_TEACH_WORD", "FUNCTION_ADDTOCONTAINER", "FUNCTION_GET_RELATIVE_ANGLE", "FUNCTION_SEND_ANIM_EVENT", "UNUSED_FUNCTION_SHOUT", "UNUSED_FUNCTION_ADD_SHOUT", "UNUSED_FUNCTION_REMOVE_SHOUT", "FUNCTION_GET_MOVEMENT_DIRECTION", "FUNCTION_IS_IN_SCENE", "FUNCTION_GET_REFTYPE_DEAD_COUNT", "FUNCTION_GET_REFTYPE_ALIVE_COUNT", "FUNCTION_APPLY_HAVOK_IMPULSE", "FUNCTION_GET_IS_FLYING", "FUNCTION_IS_CURRENT_SPELL", "FUNCTION_CURRENT_SPELL_HAS_KEYWORD", "FUNCTION_GET_EQUIPPED_ITEM_TYPE", "FUNCTION_GET_LOCATION_ALIAS_CLEARED", "FUNCTION_SET_LOCATION_ALIAS_CLEARED", "FUNCTION_GET_LOCALIAS_REFTYPE_DEAD_COUNT", "FUNCTION_GET_LOCALIAS_REFTYPE_ALIVE_COUNT", "FUNCTION_IS_WARD_STATE", "FUNCTION_IS_IN_SAME_CURR_LOC_AS_REF", "FUNCTION_IS_IN_SAME_CURR_LOC_AS_REFALIAS", "FUNCTION_LOC_ALIAS_IS_LOCATION", "FUNCTION_GET_KEYWORDDATA_FOR_LOCATION", "FUNCTION_SET_KEYWORDDATA_FOR_LOCATION", "FUNCTION_GET_KEYWORDDATA_FOR_LOCALIAS", "FUNCTION_SET_KEYWORDDATA_FOR_LOCALIAS", "FUNCTION_LOC_ALIAS_HAS_KEYWORD", "FUNCTION_IS_NULL_PACKAGE_DATA", "FUNCTION_GET_NUMERIC_PACKAGE_DATA", "FUNCTION_IS_PLAYER_RADIO_ON", "FUNCTION_GET_PLAYER_RADIO_FREQUENCY", "FUNCTION_GET_HIGHEST_RELATIONSHIP_RANK", "FUNCTION_GET_LOWEST_RELATIONSHIP_RANK", "FUNCTION_HAS_ASSOCIATION_TYPE_ANY", "FUNCTION_HAS_FAMILY_ANY", "FUNCTION_PATHING_GET_OFFSET", "FUNCTION_PATHING_GET_ANGLE_OFFSET", "FUNCTION_PATHING_GET_SPEED", "FUNCTION_PATHING_GET_SPEED_ANGLE", "FUNCTION_GET_MOVEMENT_SPEED", "FUNCTION_GET_IN_CONTAINER", "FUNCTION_IS_LOCATION_LOADED", "FUNCTION_IS_LOC_ALIAS_LOADED", "FUNCTION_IS_DUAL_CASTING", "FUNCTION_DUAL_CAST_SPELL", "FUNCTION_GET_VM_QUEST_VAR", "FUNCTION_AUDIO_DETECTION_ON_COMBATTARGET", "FUNCTION_VISUAL_DETECTION_ON_COMBATTARGET", "FUNCTION_IS_CASTING", "FUNCTION_GET_FLYING_STATE", "FUNCTION_SET_FAVOR_STATE", "FUNCTION_IS_IN_FAVOR_STATE", "FUNCTION_HAS_TWO_HANDED_WEAPON", "FUNCTION_IS_FURN_EXITTYPE", "FUNCTION_IS_IN_FRIEND_STATE", "FUNCTION_GET_WITHIN_DISTANCE", "FUNCTION_GET_ACTORVALUE_PERCENT", "FUNCTION_IS_UNIQUE", "FUNCTION_GET_LAST_BUMP_DIRECTION", "FUNCTION_CAMERA_SHAKE", "FUNCTION_GET_INF0_CHALLENGE_SUCCESS_LEVEL", "FUNCTION_GET_IS_INJURED", "FUNCTION_GET_IS_CRASH_LAND_REQUEST", "FUNCTION_GET_IS_HASTY_LAND_REQUEST", "FUNCTION_UPDATE_QUEST_INSTANCE_GLOBAL", "FUNCTION_SET_ALLOW_FLYING", "FUNCTION_IS_LINKED_TO", "FUNCTION_GET_KEYWORD_DATA_FOR_CURRENT_LOCATION", "FUNCTION_GET_IN_SHARED_CRIME_FACTION", "FUNCTION_GET_BRIBE_AMOUNT", "FUNCTION_GET_BRIBE_SUCCESS", "FUNCTION_GET_INTIMIDATE_SUCCESS", "FUNCTION_GET_ARRESTED_STATE", "FUNCTION_GET_ARRESTING_ACTOR_STATE", "FUNCTION_CLEAR_ARREST_STATE", "FUNCTION_HAS_VM_SCRIPT", "FUNCTION_GET_VM_SCRIPT_VAR", "FUNCTION_GET_WORKSHOP_RESOURCE_DAMAGE", "FUNCTION_UNUSED_21", "FUNCTION_FORCE_LOC_INTO_ALIAS", "FUNCTION_HAS_VALID_RUMOR_TOPIC", "FUNCTION_SET_ACTOR_HORSE", "FUNCTION_PLAY_REFERENCE_EFFECT", "FUNCTION_STOP_REFERENCE_EFFECT", "FUNCTION_PLAY_SHADER_PARTICLE_GEOMETRY", "FUNCTION_STOP_SHADER_PARTICLE_GEOMETRY", "FUNCTION_APPLY_IMAGESPACE_MODIFIER_CROSS_FADE", "FUNCTION_REMOVE_IMAGESPACE_MODIFIER_CROSS_FADE", "FUNCTION_IS_ATTACKING", "FUNCTION_IS_POWER_ATTACKING", "FUNCTION_IS_LAST_HOSTILE_ACTOR", "FUNCTION_GET_GRAPH_VARIABLE_INT", "UNUSED_FUNCTION_GET_CURRENT_SHOUT_VARIATION", "FUNCTION_PLAY_IMPACT_EFFECT", "FUNCTION_SHOULD_ATTACK_KILL", "FUNCTION_SEND_STEAL_ALARM", "FUNCTION_GET_ACTIVATION_HEIGHT", "FUNCTION_UNUSED_16", "FUNCTION_WORN_HAS_KEYWORD", "FUNCTION_PATHING_GET_CURRENT_SPEED", "FUNCTION_PATHING_GET_CURRENT_SPEED_ANGLE", "FUNCTION_KNOCK_AREA_EFFECT", "FUNCTION_INTERRUPT_CAST", "FUNCTION_ADD_FORM_TO_FORMLIST", "FUNCTION_REVERT_FORMLIST", "FUNCTION_ADD_FORM_TO_LEVELEDLIST", "FUNCTION_REVERT_LEVELEDLIST", "FUNCTION_GET_WORKSHOP_OBJECT_COUNT", "FUNCTION_UNUSED_18", "FUNCTION_EP_SPELL_HAS_KEYWORD", "FUNCTION_GET_NO_BLEEDOUT_RECOVERY", "FUNCTION_SET_NO_BLEEDOUT_RECOVERY", "FUNCTION_EP_SPELL_HAS_SKILL", "FUNCTION_IS_ATTACK_TYPE", "FUNCTION_GET_ALLOW_FLYING", "FUNCTION_HAS_MAGIC_EFFECT_KEYWORD", "FUNCTION_IS_COMMANDED_ACTOR", "FUNCTION_IS_STAGGERED", "FUNCTION_IS_RECOILING", "FUNCTION_HAS_SCOPE_WEAPON", "FUNCTION_IS_PATHING", "FUNCTION_GET_SHOULD_HELP", "FUNCTION_HAS_BOUND_WEAPON", "FUNCTION_GET_COMBAT_TARGET_HAS_KEYWORD", "FUNCTION_UPDATE_LEVEL", "FUNCTION_GET_COMBAT_GROUP_MEMBER_COUNT", "FUNCTION_IS_IGNORING_COMBAT", "FUNCTION_GET_LIGHT_LEVEL", "FUNCTION_SAVE_PC_FACE", "FUNCTION_SPELL_HAS_CASTING_PERK", "FUNCTION_IS_BEING_RIDDEN", "FUNCTION_IS_UNDEAD", "FUNCTION_GET_REAL_HOURS_PASSED", "FUNCTION_UNEQUIP_ALL", "FUNCTION_IS_UNLOCKED_DOOR", "FUNCTION_IS_HOSTILE_TO_ACTOR", "FUNCTION_GET_TARGET_HEIGHT", "FUNCTION_IS_POISON", "FUNCTION_APPAREL_HAS_KEYWORD_COUNT", "FUNCTION_GETITEMHEALTHPERCENT", "FUNCTION_EFFECT_WAS_DUAL_CAST", "FUNCTION_GET_KNOCKSTATE_ENUM", "FUNCTION_DOES_NOT_EXIST", "FUNCTION_SHOW_GENERIC_MENU", "FUNCTION_GET_PLAYER_WALKAWAY_DIALOGUE", "FUNCTION_GET_ACTOR_STANCE", "FUNCTION_UNUSED_24", "FUNCTION_UNEQUIP_ITEM_SLOT", "FUNCTION_MOUNT_ACTOR", "FUNCTION_DISMOUNT_ACTOR", "FUNCTION_CAN_PRODUCE_FOR_WORKSHOP", "FUNCTION_CAN_FLY_HERE", "FUNCTION_EP_IS_DAMAGE_TYPE", "FUNCTION_UNUSED_15", "FUNCTION_GET_ACTOR_GUN_STATE", "FUNCTION_GET_VOICE_LINE_LENGTH", "FUNCTION_MOD_POS", "FUNCTION_OTI_HAS_KEYWORD", "FUNCTION_OTI_CHECK_NAME", "FUNCTION_OTI_GET_LEVEL", "FUNCTION_MOVEMENT_IDLE_MATCHES", "FUNCTION_GET_ACTION_DATA", "FUNCTION_GET_ACTION_DATA_SHORT", "FUNCTION_GET_ACTION_DATA_BYTE", "FUNCTION_GET_ACTION_DATA_FLAG", "FUNCTION_MODDED_ITEM_HAS_KEYWORD", "FUNCTION_GET_ANGRY_WITH_PLAYER", "FUNCTION_IS_CAMERA_UNDER_WATER", "FUNCTION_MOD_ANGLE", "FUNCTION_GET_REF_OWNERSHIP", "FUNCTION_HAS_REF_OWNERSHIP", "FUNCTION_PLACE_THERE", "FUNCTION_GET_LOADED_AMMO_COUNT", "FUNCTION_IS_TIMESPAN_SUNRISE", "FUNCTION_IS_TIMESPAN_MORNING", "FUNCTION_IS_TIMESPAN_AFTERNOON", "FUNCTION_IS_TIMESPAN_EVENING", "FUNCTION_IS_TIMESPAN_SUNSET", "FUNCTION_IS_TIMESPAN_NIGHT", "FUNCTION_IS_TIMESPAN_MIDNIGHT", "FUNCTION_IS_TIMESPAN_DAY_ANY", "FUNCTION_IS_TIMESPAN_NIGHT_ANY", "FUNCTION_CURR_FURN_HAS_KEYWORD", "FUNCTION_GET_WEAPON_EQUIP_INDEX", "FUNCTION_KILL_ALL_HOSTILE_ACTORS", "FUNCTION_IS_OVERENCUMBERED", "FUNCTION_IS_PACKAGE_REQUESTING_BLOCKED_IDLES", "FUNCTION_GET_ACTION_DATA_INT", "FUNCTION_VATS_RIGHT_MINUS_LEFT_AREA_FREE", "FUNCITON_GET_IN_IRONSIGHTS", "FUNCTION_GET_ACTOR_STAGGER_DIRECTION", "FUNCTION_GET_ACTOR_STAGGER_MAGNITUDE", "FUNCTION_WORN_COVERS_BIPEDSLOT", "FUNCTION_GET_INVENTORY_VALUE", "FUNCTION_IS_PLAYER_IN_CONVERSATION", "FUNCTION_IS_IN_DIALOGUE_CAMERA", "FUNCTION_IS_DIALOGUE_TARGET_PLAYER", "FUNCTION_IS_DIALOGUE_TARGET_ACTOR", "FUNCTION_GET_DIALOGUE_TARGET_DISTANCE", "FUNCTION_IS_SEAT_OCCUPIED", "FUNCTION_IS_PLAYER_RIDING", "FUNCTION_IS_TRYING_EVENT_CAMERA", "FUNCTION_USE_LEFT_SIDE_DIALOGUE_CAMERA", "FUNCTION_GET_NOTETYPE", "FUNCTION_LOCATION_HAS_PLAYER_WORKSHOP", "FUNCTION_IS_STARTING_ACTION", "FUNCTION_IS_MID_ACTION", "FUNCTION_IS_WEAPON_CHARGE_ATTACK", "FUNCTION_IS_IN_WORKSHOP_MODE", "FUNCTION_IS_WEAPON_CHARGING_HOLD_ATTACK", "FUNCTION_IS_ENCOUNTER_ABOVE_PLAYER_LEVEL", "FUNCTION_IS_MELEE_ATTACKING", "FUNCTION_VATS_GET_QUEUED_TARGETS_UNIQUE", "FUNCTION_GET_CURRENT_LOCATION_CLEARED", "FUNCTION_IS_POWERED", "FUNCTION_GET_TRANSMITTER_DISTANCE", "FUNCTION_GET_CAMERA_PLAYBACK_TIME", "FUNCTION_IS_IN_WATER", "FUNCTION_GET_WITHIN_ACTIVATE_DIST", "FUNCTION_IS_UNDER_WATER", "FUNCTION_IS_IN_SAME_SPACE", "FUNCTION_LOCATION_ALLOWS_RESET", "FUNCTION_VATS_BACK_RIGHT_AREA_FREE", "FUNCTION_VATS_BACK_LEFT_AREA_FREE", "FUNCTION_VATS_BACK_RIGHT_TARGET_VISIBLE", "FUNCTION_VATS_BACK_LEFT_TARGET_VISIBLE", "FUNCTION_VATS_TARGET_LIMB_VISIBLE", "FUNCTION_IS_PLAYER_LISTENING", "FUNCTION_PATHING_REQUESTED_QUICK_TURN", "FUNCTION_EP_IS_CALCULATING_BASE_DAMAGE", "FUNCTION_GET_REANIMATING", "FUNCTION_MATLOCK_CAPTURE", "FUNCTION_SET_VOICE_TYPE", "FUNCTION_IS_IN_ROBOT_WORKBENCH", "END_OF_FUNCTION_SECTION", "FUNCTION_COUNT", "SCRIPT_DONE" }));
+
+static_assert(test::RoundTrips<RE::SCRIPT_PARAM_TYPE>(
+	{ RE::SCRIPT_PARAM_TYPE::kChar, RE::SCRIPT_PARAM_TYPE::kInt, RE::SCRIPT_PARAM_TYPE::kFloat, RE::SCRIPT_PARAM_TYPE::kInventoryObject, RE::SCRIPT_PARAM_TYPE::kObjectRef, RE::SCRIPT_PARAM_TYPE::kActorValue, RE::SCRIPT_PARAM_TYPE::kActor, RE::SCRIPT_PARAM_TYPE::kSpellItem, RE::SCRIPT_PARAM_TYPE::kAxis, RE::SCRIPT_PARAM_TYPE::kCell, RE::SCRIPT_PARAM_TYPE::kAnimGroup, RE::SCRIPT_PARAM_TYPE::kMagicItem, RE::SCRIPT_PARAM_TYPE::kSound, RE::SCRIPT_PARAM_TYPE::kTopic, RE::SCRIPT_PARAM_TYPE::kQuest, RE::SCRIPT_PARAM_TYPE::kRace, RE::SCRIPT_PARAM_TYPE::kClass, RE::SCRIPT_PARAM_TYPE::kFaction, RE::SCRIPT_PARAM_TYPE::kSex, RE::SCRIPT_PARAM_TYPE::kGlobal, RE::SCRIPT_PARAM_TYPE::kFurnitureOrFormList, RE::SCRIPT_PARAM_TYPE::kObject, RE::SCRIPT_PARAM_TYPE::kScriptVar, RE::SCRIPT_PARAM_TYPE::kStage, RE::SCRIPT_PARAM_TYPE::kMapMarker, RE::SCRIPT_PARAM_TYPE::kActorBase, RE::SCRIPT_PARAM_TYPE::kContainerRef, RE::SCRIPT_PARAM_TYPE::kWorlOrList, RE::SCRIPT_PARAM_TYPE::kCrimeType, RE::SCRIPT_PARAM_TYPE::kPackage, RE::SCRIPT_PARAM_TYPE::kCombatStyle, RE::SCRIPT_PARAM_TYPE::kMagicEffect, RE::SCRIPT_PARAM_TYPE::kFormType, RE::SCRIPT_PARAM_TYPE::kWeather, RE::SCRIPT_PARAM_TYPE::kNPC, RE::SCRIPT_PARAM_TYPE::kOwner, RE::SCRIPT_PARAM_TYPE::kShaderEffect, RE::SCRIPT_PARAM_TYPE::kFormList, RE::SCRIPT_PARAM_TYPE::kMenuIcon, RE::SCRIPT_PARAM_TYPE::kPerk, RE::SCRIPT_PARAM_TYPE::kNote, RE::SCRIPT_PARAM_TYPE::kMiscStat, RE::SCRIPT_PARAM_TYPE::kImageSpaceMod, RE::SCRIPT_PARAM_TYPE::kImageSpace, RE::SCRIPT_PARAM_TYPE::kVATSValue, RE::SCRIPT_PARAM_TYPE::kVATSValueData, RE::SCRIPT_PARAM_TYPE::kEventFunction, RE::SCRIPT_PARAM_TYPE::kEventFunctionMember, RE::SCRIPT_PARAM_TYPE::kEventFunctionData, RE::SCRIPT_PARAM_TYPE::kVoiceType, RE::SCRIPT_PARAM_TYPE::kEncounterZone, RE::SCRIPT_PARAM_TYPE::kIdleForm, RE::SCRIPT_PARAM_TYPE::kMessage, RE::SCRIPT_PARAM_TYPE::kInvObjectOrFormList, RE::SCRIPT_PARAM_TYPE::kAlignment, RE::SCRIPT_PARAM_TYPE::kEquipType, RE::SCRIPT_PARAM_TYPE::kObjectOrFormList, RE::SCRIPT_PARAM_TYPE::kMusic, RE::SCRIPT_PARAM_TYPE::kCritStage, RE::SCRIPT_PARAM_TYPE::kKeyword, RE::SCRIPT_PARAM_TYPE::kRefType, RE::SCRIPT_PARAM_TYPE::kLocation, RE::SCRIPT_PARAM_TYPE::kForm, RE::SCRIPT_PARAM_TYPE::kAlias, RE::SCRIPT_PARAM_TYPE::kShout, RE::SCRIPT_PARAM_TYPE::kWordOfPower, RE::SCRIPT_PARAM_TYPE::kRelationshipRank, RE::SCRIPT_PARAM_TYPE::kBGSScene, RE::SCRIPT_PARAM_TYPE::kCastingSource, RE::SCRIPT_PARAM_TYPE::kAssociationType, RE::SCRIPT_PARAM_TYPE::kWardState, RE::SCRIPT_PARAM_TYPE::kPackageDataCanBeNull, RE::SCRIPT_PARAM_TYPE::kPackageDataNumeric, RE::SCRIPT_PARAM_TYPE::kPackageDataReference, RE::SCRIPT_PARAM_TYPE::kVMScriptVar, RE::SCRIPT_PARAM_TYPE::kReferenceEffect, RE::SCRIPT_PARAM_TYPE::kPackageDataLocation, RE::SCRIPT_PARAM_TYPE::kSoundCategory, RE::SCRIPT_PARAM_TYPE::kKnowableForm, RE::SCRIPT_PARAM_TYPE::kRegion, RE::SCRIPT_PARAM_TYPE::kAction, RE::SCRIPT_PARAM_TYPE::kMovementIdleFromState, RE::SCRIPT_PARAM_TYPE::kMovementIdleToState, RE::SCRIPT_PARAM_TYPE::kVMRefOrAliasScript, RE::SCRIPT_PARAM_TYPE::kDamageType, RE::SCRIPT_PARAM_TYPE::kSceneAction, RE::SCRIPT_PARAM_TYPE::kKeywordOrFormlist, RE::SCRIPT_PARAM_TYPE::kFurnEntryType },
+	{ "kChar", "kInt", "kFloat", "kInventoryObject", "kObjectRef", "kActorValue", "kActor", "kSpellItem", "kAxis", "kCell", "kAnimGroup", "kMagicItem", "kSound", "kTopic", "kQuest", "kRace", "kClass", "kFaction", "kSex", "kGlobal", "kFurnitureOrFormList", "kObject", "kScriptVar", "kStage", "kMapMarker", "kActorBase", "kContainerRef", "kWorlOrList", "kCrimeType", "kPackage", "kCombatStyle", "kMagicEffect", "kFormType", "kWeather", "kNPC", "kOwner", "kShaderEffect", "kFormList", "kMenuIcon", "kPerk", "kNote", "kMiscStat", "kImageSpaceMod", "kImageSpace", "kVATSValue", "kVATSValueData", "kEventFunction", "kEventFunctionMember", "kEventFunctionData", "kVoiceType", "kEncounterZone", "kIdleForm", "kMessage", "kInvObjectOrFormList", "kAlignment", "kEquipType", "kObjectOrFormList", "kMusic", "kCritStage", "kKeyword", "kRefType", "kLocation", "kForm", "kAlias", "kShout", "kWordOfPower", "kRelationshipRank", "kBGSScene", "kCastingSource", "kAssociationType", "kWardState", "kPackageDataCanBeNull", "kPackageDataNumeric", "kPackageDataReference", "kVMScriptVar", "kReferenceEffect", "kPackageDataLocation", "kSoundCategory", "kKnowableForm", "kRegion", "kAction", "kMovementIdleFromState", "kMovementIdleToState", "kVMRefOrAliasScript", "kDamageType", "kSceneAction", "kKeywordOrFormlist", "kFurnEntryType" }));
+
+static_assert(test::RoundTrips<RE::SEX>(
+	{ RE::SEX::kNone, RE::SEX::kMale, RE::SEX::kFemale, RE::SEX::kTotal },
+	{ "kNone", "kMale", "kFemale", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::SIT_SLEEP_STATE>(
+	{ RE::SIT_SLEEP_STATE::kNormal, RE::SIT_SLEEP_STATE::kWantToSit, RE::SIT_SLEEP_STATE::kWaitingForSitAnim, RE::SIT_SLEEP_STATE::kIsSitting, RE::SIT_SLEEP_STATE::kRidingMount, RE::SIT_SLEEP_STATE::kWantToStand, RE::SIT_SLEEP_STATE::kWantToSleep, RE::SIT_SLEEP_STATE::kWaitingForSleepAnim, RE::SIT_SLEEP_STATE::kIsSleeping, RE::SIT_SLEEP_STATE::kWantToWake },
+	{ "kNormal", "kWantToSit", "kWaitingForSitAnim", "kIsSitting", "kRidingMount", "kWantToStand", "kWantToSleep", "kWaitingForSleepAnim", "kIsSleeping", "kWantToWake" }));
+
+static_assert(test::RoundTrips<RE::SOUND_LEVEL>(
+	{ RE::SOUND_LEVEL::kLoud, RE::SOUND_LEVEL::kNormal, RE::SOUND_LEVEL::kSilent, RE::SOUND_LEVEL::kVeryLoud, RE::SOUND_LEVEL::kQuiet },
+	{ "kLoud", "kNormal", "kSilent", "kVeryLoud", "kQuiet" }));
+
+static_assert(test::RoundTrips<RE::SPEED_DIRECTIONS::SPEED_DIRECTION>(
+	{ RE::SPEED_DIRECTIONS::SPEED_DIRECTION::kLeft, RE::SPEED_DIRECTIONS::SPEED_DIRECTION::kRight, RE::SPEED_DIRECTIONS::SPEED_DIRECTION::kForward, RE::SPEED_DIRECTIONS::SPEED_DIRECTION::kBackward, RE::SPEED_DIRECTIONS::SPEED_DIRECTION::kPitch, RE::SPEED_DIRECTIONS::SPEED_DIRECTION::kRoll, RE::SPEED_DIRECTIONS::SPEED_DIRECTION::kYaw, RE::SPEED_DIRECTIONS::SPEED_DIRECTION::kTotal },
+	{ "kLeft", "kRight", "kForward", "kBackward", "kPitch", "kRoll", "kYaw", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::STAGGER_MAGNITUDE>(
+	{ RE::STAGGER_MAGNITUDE::kNone, RE::STAGGER_MAGNITUDE::kSmall, RE::STAGGER_MAGNITUDE::kMedium, RE::STAGGER_MAGNITUDE::kLarge, RE::STAGGER_MAGNITUDE::kExtraLarge },
+	{ "kNone", "kSmall", "kMedium", "kLarge", "kExtraLarge" }));
+
+static_assert(test::RoundTrips<RE::SeekMode>(
+	{ RE::SeekMode::kSet, RE::SeekMode::kCurrent, RE::SeekMode::kEnd },
+	{ "kSet", "kCurrent", "kEnd" }));
+
+static_assert(test::RoundTrips<RE::Setting::SETTING_TYPE>(
+	{ RE::Setting::SETTING_TYPE::kBinary, RE::Setting::SETTING_TYPE::kChar, RE::Setting::SETTING_TYPE::kUChar, RE::Setting::SETTING_TYPE::kInt, RE::Setting::SETTING_TYPE::kUInt, RE::Setting::SETTING_TYPE::kFloat, RE::Setting::SETTING_TYPE::kString, RE::Setting::SETTING_TYPE::kRGB, RE::Setting::SETTING_TYPE::kRGBA, RE::Setting::SETTING_TYPE::kNone },
+	{ "kBinary", "kChar", "kUChar", "kInt", "kUInt", "kFloat", "kString", "kRGB", "kRGBA", "kNone" }));
+
+static_assert(test::RoundTrips<RE::Sky::Flags>(
+	{ RE::Sky::Flags::kNone, RE::Sky::Flags::kFastTravel, RE::Sky::Flags::kHideSky, RE::Sky::Flags::kUpdateSunriseBegin, RE::Sky::Flags::kUpdateSunriseEnd, RE::Sky::Flags::kUpdateSunsetBegin, RE::Sky::Flags::kUpdateSunsetEnd, RE::Sky::Flags::kUpdateColorsSunriseBegin, RE::Sky::Flags::kUpdateColorsSunsetEnd, RE::Sky::Flags::kUpdateWind, RE::Sky::Flags::kReleaseWeatherOverride },
+	{ "kNone", "kFastTravel", "kHideSky", "kUpdateSunriseBegin", "kUpdateSunriseEnd", "kUpdateSunsetBegin", "kUpdateSunsetEnd", "kUpdateColorsSunriseBegin", "kUpdateColorsSunsetEnd", "kUpdateWind", "kReleaseWeatherOverride" }));
+
+static_assert(test::RoundTrips<RE::Sky::Mode>(
+	{ RE::Sky::Mode::kNone, RE::Sky::Mode::kInterior, RE::Sky::Mode::kSkyDomeOnly, RE::Sky::Mode::kFull, RE::Sky::Mode::kTotal },
+	{ "kNone", "kInterior", "kSkyDomeOnly", "kFull", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::SoundID>(
+	{ RE::SoundID::kDrawSheatheLPM, RE::SoundID::kCharge, RE::SoundID::kReadyLoop, RE::SoundID::kRelease, RE::SoundID::kCastLoop, RE::SoundID::kHit },
+	{ "kDrawSheatheLPM", "kCharge", "kReadyLoop", "kRelease", "kCastLoop", "kHit" }));
+
+static_assert(test::RoundTrips<RE::SpellItem::Flags>(
+	{ RE::SpellItem::Flags::kNone, RE::SpellItem::Flags::kManualCostCalc, RE::SpellItem::Flags::kPCStartSpell, RE::SpellItem::Flags::kInstantCast, RE::SpellItem::Flags::kAreaEffectIgnoresLOS, RE::SpellItem::Flags::kIgnoresResist, RE::SpellItem::Flags::kNoAbsorbReflect, RE::SpellItem::Flags::kNoDualCastMods },
+	{ "kNone", "kManualCostCalc", "kPCStartSpell", "kInstantCast", "kAreaEffectIgnoresLOS", "kIgnoresResist", "kNoAbsorbReflect", "kNoDualCastMods" }));
+
+static_assert(test::RoundTrips<RE::SpellItem::RecordFlags::RecordFlag>(
+	{ RE::SpellItem::RecordFlags::RecordFlag::kDeleted, RE::SpellItem::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::SpellType>(
+	{ RE::SpellType::kSpell, RE::SpellType::kDisease, RE::SpellType::kPower, RE::SpellType::kLesserPower, RE::SpellType::kAbility, RE::SpellType::kPoison, RE::SpellType::kEnchantment, RE::SpellType::kPotion, RE::SpellType::kAlchemy, RE::SpellType::kWortCraft, RE::SpellType::kIngredient, RE::SpellType::kLeveledSpell, RE::SpellType::kAddiction, RE::SpellType::kVoicePower, RE::SpellType::kStaffEnchantment, RE::SpellType::kScroll },
+	{ "kSpell", "kDisease", "kPower", "kLesserPower", "kAbility", "kPoison", "kEnchantment", "kPotion", "kAlchemy", "kWortCraft", "kIngredient", "kLeveledSpell", "kAddiction", "kVoicePower", "kStaffEnchantment", "kScroll" }));
+
+static_assert(test::RoundTrips<RE::Stack::FreezeState>(
+	{ RE::Stack::FreezeState::kUnfrozen, RE::Stack::FreezeState::kFreezing, RE::Stack::FreezeState::kFrozen },
+	{ "kUnfrozen", "kFreezing", "kFrozen" }));
+
+static_assert(test::RoundTrips<RE::Stack::State>(
+	{ RE::Stack::State::kRunning, RE::Stack::State::kFinished, RE::Stack::State::kWaitingOnMemory, RE::Stack::State::kWaitingOnLatentFunction, RE::Stack::State::kWaitingInOtherStackForCall, RE::Stack::State::kWaitingInOtherStackForReturn, RE::Stack::State::kWaitingInOtherStackForReturnNoPop, RE::Stack::State::kRetryReturnNoPop, RE::Stack::State::kRetryCall },
+	{ "kRunning", "kFinished", "kWaitingOnMemory", "kWaitingOnLatentFunction", "kWaitingInOtherStackForCall", "kWaitingInOtherStackForReturn", "kWaitingInOtherStackForReturnNoPop", "kRetryReturnNoPop", "kRetryCall" }));
+
+static_assert(test::RoundTrips<RE::StringIndexSize>(
+	{ RE::StringIndexSize::kSmall, RE::StringIndexSize::kLarge },
+	{ "kSmall", "kLarge" }));
+
+static_assert(test::RoundTrips<RE::StructTypeInfo::LinkValidState>(
+	{ RE::StructTypeInfo::LinkValidState::kNotLinked, RE::StructTypeInfo::LinkValidState::kCurrentlyLinking, RE::StructTypeInfo::LinkValidState::kLinkedInvalid, RE::StructTypeInfo::LinkValidState::kLinkedValid },
+	{ "kNotLinked", "kCurrentlyLinking", "kLinkedInvalid", "kLinkedValid" }));
+
+static_assert(test::RoundTrips<RE::TEMP_EFFECT_TYPE>(
+	{ RE::TEMP_EFFECT_TYPE::kTerrain, RE::TEMP_EFFECT_TYPE::kWeaponBlood, RE::TEMP_EFFECT_TYPE::kDecal, RE::TEMP_EFFECT_TYPE::kGeometryDecal, RE::TEMP_EFFECT_TYPE::kParticle, RE::TEMP_EFFECT_TYPE::kDebris, RE::TEMP_EFFECT_TYPE::kSPG, RE::TEMP_EFFECT_TYPE::kDefault, RE::TEMP_EFFECT_TYPE::kRefDefault, RE::TEMP_EFFECT_TYPE::kRefModel, RE::TEMP_EFFECT_TYPE::kRefShader, RE::TEMP_EFFECT_TYPE::kMagicSummon },
+	{ "kTerrain", "kWeaponBlood", "kDecal", "kGeometryDecal", "kParticle", "kDebris", "kSPG", "kDefault", "kRefDefault", "kRefModel", "kRefShader", "kMagicSummon" }));
+
+static_assert(test::RoundTrips<RE::TESAmmo::RecordFlags::RecordFlag>(
+	{ RE::TESAmmo::RecordFlags::RecordFlag::kNonPlayable, RE::TESAmmo::RecordFlags::RecordFlag::kDeleted, RE::TESAmmo::RecordFlags::RecordFlag::kIgnored },
+	{ "kNonPlayable", "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESClass::RecordFlags::RecordFlag>(
+	{ RE::TESClass::RecordFlags::RecordFlag::kDeleted, RE::TESClass::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESClimate::RecordFlags::RecordFlag>(
+	{ RE::TESClimate::RecordFlags::RecordFlag::kDeleted, RE::TESClimate::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESEffectShader::RecordFlags::RecordFlag>(
+	{ RE::TESEffectShader::RecordFlags::RecordFlag::kDeleted, RE::TESEffectShader::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESEyes::Flags>(
+	{ RE::TESEyes::Flags::kNone, RE::TESEyes::Flags::kPlayable, RE::TESEyes::Flags::kNotMale, RE::TESEyes::Flags::kNotFemale },
+	{ "kNone", "kPlayable", "kNotMale", "kNotFemale" }));
+
+static_assert(test::RoundTrips<RE::TESEyes::RecordFlags::RecordFlag>(
+	{ RE::TESEyes::RecordFlags::RecordFlag::kNonPlayable, RE::TESEyes::RecordFlags::RecordFlag::kDeleted, RE::TESEyes::RecordFlags::RecordFlag::kIgnored },
+	{ "kNonPlayable", "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESFaction::RecordFlags::RecordFlag>(
+	{ RE::TESFaction::RecordFlags::RecordFlag::kDeleted, RE::TESFaction::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESFile::RecordFlags>(
+	{ RE::TESFile::RecordFlags::kNone, RE::TESFile::RecordFlags::kMaster, RE::TESFile::RecordFlags::kAltered, RE::TESFile::RecordFlags::kChecked, RE::TESFile::RecordFlags::kActive, RE::TESFile::RecordFlags::kOptimizedFile, RE::TESFile::RecordFlags::kTempIDOwner, RE::TESFile::RecordFlags::kDelocalized, RE::TESFile::RecordFlags::kPrecalcDataOnly, RE::TESFile::RecordFlags::kSmallFile },
+	{ "kNone", "kMaster", "kAltered", "kChecked", "kActive", "kOptimizedFile", "kTempIDOwner", "kDelocalized", "kPrecalcDataOnly", "kSmallFile" }));
+
+static_assert(test::RoundTrips<RE::TESFlora::RecordFlags::RecordFlag>(
+	{ RE::TESFlora::RecordFlags::RecordFlag::kDeleted, RE::TESFlora::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESForm::InGameFormFlags>(
+	{ RE::TESForm::InGameFormFlags::kNone, RE::TESForm::InGameFormFlags::kWantsDelete, RE::TESForm::InGameFormFlags::kForcedPersistent, RE::TESForm::InGameFormFlags::kNoFavorAllowed, RE::TESForm::InGameFormFlags::kIsSkyObject, RE::TESForm::InGameFormFlags::kRefOriginalPersistent, RE::TESForm::InGameFormFlags::kRefPermanentlyDeleted },
+	{ "kNone", "kWantsDelete", "kForcedPersistent", "kNoFavorAllowed", "kIsSkyObject", "kRefOriginalPersistent", "kRefPermanentlyDeleted" }));
+
+static_assert(test::RoundTrips<RE::TESFurniture::RecordFlags::RecordFlag>(
+	{ RE::TESFurniture::RecordFlags::RecordFlag::kHasContainer, RE::TESFurniture::RecordFlags::RecordFlag::kDeleted, RE::TESFurniture::RecordFlags::RecordFlag::kIsPerch, RE::TESFurniture::RecordFlags::RecordFlag::kIgnored, RE::TESFurniture::RecordFlags::RecordFlag::kHasDistantLOD, RE::TESFurniture::RecordFlags::RecordFlag::kRandomAnimStart, RE::TESFurniture::RecordFlags::RecordFlag::kIsMarker, RE::TESFurniture::RecordFlags::RecordFlag::kIsPowerArmor, RE::TESFurniture::RecordFlags::RecordFlag::kMustExitToTalk, RE::TESFurniture::RecordFlags::RecordFlag::kChildCanUse },
+	{ "kHasContainer", "kDeleted", "kIsPerch", "kIgnored", "kHasDistantLOD", "kRandomAnimStart", "kIsMarker", "kIsPowerArmor", "kMustExitToTalk", "kChildCanUse" }));
+
+static_assert(test::RoundTrips<RE::TESFurnitureEvent::FurnitureEventType>(
+	{ RE::TESFurnitureEvent::FurnitureEventType::kEnter, RE::TESFurnitureEvent::FurnitureEventType::kExit },
+	{ "kEnter", "kExit" }));
+
+static_assert(test::RoundTrips<RE::TESGlobal::RecordFlags::RecordFlag>(
+	{ RE::TESGlobal::RecordFlags::RecordFlag::kDeleted, RE::TESGlobal::RecordFlags::RecordFlag::kConstant, RE::TESGlobal::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kConstant", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESGrass::GRASS_DATA::Flags>(
+	{ RE::TESGrass::GRASS_DATA::Flags::kNone, RE::TESGrass::GRASS_DATA::Flags::kVertexLighting, RE::TESGrass::GRASS_DATA::Flags::kUniformScale, RE::TESGrass::GRASS_DATA::Flags::kFitSlope },
+	{ "kNone", "kVertexLighting", "kUniformScale", "kFitSlope" }));
+
+static_assert(test::RoundTrips<RE::TESGrass::GRASS_WATER_STATE>(
+	{ RE::TESGrass::GRASS_WATER_STATE::kAboveOnlyAtLeast, RE::TESGrass::GRASS_WATER_STATE::kAboveOnlyAtMost, RE::TESGrass::GRASS_WATER_STATE::kBelowOnlyAtLeast, RE::TESGrass::GRASS_WATER_STATE::kBelowOnlyAtMost, RE::TESGrass::GRASS_WATER_STATE::kBothAtLeast, RE::TESGrass::GRASS_WATER_STATE::kBothAtMost, RE::TESGrass::GRASS_WATER_STATE::kBothAtMostAbove, RE::TESGrass::GRASS_WATER_STATE::kBothAtMostBelow },
+	{ "kAboveOnlyAtLeast", "kAboveOnlyAtMost", "kBelowOnlyAtLeast", "kBelowOnlyAtMost", "kBothAtLeast", "kBothAtMost", "kBothAtMostAbove", "kBothAtMostBelow" }));
+
+static_assert(test::RoundTrips<RE::TESGrass::RecordFlags::RecordFlag>(
+	{ RE::TESGrass::RecordFlags::RecordFlag::kDeleted, RE::TESGrass::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESIdleForm::RecordFlags::RecordFlag>(
+	{ RE::TESIdleForm::RecordFlags::RecordFlag::kDeleted, RE::TESIdleForm::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESImageSpace::RecordFlags::RecordFlag>(
+	{ RE::TESImageSpace::RecordFlags::RecordFlag::kDeleted, RE::TESImageSpace::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESImageSpaceModifier::RecordFlags::RecordFlag>(
+	{ RE::TESImageSpaceModifier::RecordFlags::RecordFlag::kDeleted, RE::TESImageSpaceModifier::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESLandTexture::RecordFlags::RecordFlag>(
+	{ RE::TESLandTexture::RecordFlags::RecordFlag::kDeleted, RE::TESLandTexture::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESLevCharacter::RecordFlags::RecordFlag>(
+	{ RE::TESLevCharacter::RecordFlags::RecordFlag::kDeleted, RE::TESLevCharacter::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESLevItem::RecordFlags::RecordFlag>(
+	{ RE::TESLevItem::RecordFlags::RecordFlag::kDeleted, RE::TESLevItem::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESLeveledList::LeveledListAllBelowForce>(
+	{ RE::TESLeveledList::LeveledListAllBelowForce::kNever, RE::TESLeveledList::LeveledListAllBelowForce::kDefault, RE::TESLeveledList::LeveledListAllBelowForce::kAlways, RE::TESLeveledList::LeveledListAllBelowForce::kShiftUp },
+	{ "kNever", "kDefault", "kAlways", "kShiftUp" }));
+
+static_assert(test::RoundTrips<RE::TESLoadScreen::RecordFlags::RecordFlag>(
+	{ RE::TESLoadScreen::RecordFlags::RecordFlag::kDeleted, RE::TESLoadScreen::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESNPC::RecordFlags::RecordFlag>(
+	{ RE::TESNPC::RecordFlags::RecordFlag::kDeleted, RE::TESNPC::RecordFlags::RecordFlag::kIgnored, RE::TESNPC::RecordFlags::RecordFlag::kCompressed, RE::TESNPC::RecordFlags::RecordFlag::kBleedoutOverride },
+	{ "kDeleted", "kIgnored", "kCompressed", "kBleedoutOverride" }));
+
+static_assert(test::RoundTrips<RE::TESObjectACTI::Flags>(
+	{ RE::TESObjectACTI::Flags::kNone, RE::TESObjectACTI::Flags::kNoDisplacement, RE::TESObjectACTI::Flags::kIgnoredBySandbox, RE::TESObjectACTI::Flags::kIsProceduralWater, RE::TESObjectACTI::Flags::kIsLODWater, RE::TESObjectACTI::Flags::kIsRadio },
+	{ "kNone", "kNoDisplacement", "kIgnoredBySandbox", "kIsProceduralWater", "kIsLODWater", "kIsRadio" }));
+
+static_assert(test::RoundTrips<RE::TESObjectACTI::RecordFlags::RecordFlag>(
+	{ RE::TESObjectACTI::RecordFlags::RecordFlag::kDeleted, RE::TESObjectACTI::RecordFlags::RecordFlag::kHasTreeLOD, RE::TESObjectACTI::RecordFlags::RecordFlag::kMustUpdateAnims, RE::TESObjectACTI::RecordFlags::RecordFlag::kHiddenFromLocalMap, RE::TESObjectACTI::RecordFlags::RecordFlag::kIgnored, RE::TESObjectACTI::RecordFlags::RecordFlag::kHasDistantLOD, RE::TESObjectACTI::RecordFlags::RecordFlag::kRandomAnimStart, RE::TESObjectACTI::RecordFlags::RecordFlag::kDangerous, RE::TESObjectACTI::RecordFlags::RecordFlag::kIgnoresObjectInteraction, RE::TESObjectACTI::RecordFlags::RecordFlag::kIsMarker, RE::TESObjectACTI::RecordFlags::RecordFlag::kObstacle, RE::TESObjectACTI::RecordFlags::RecordFlag::kNavMeshGeneration_Filter, RE::TESObjectACTI::RecordFlags::RecordFlag::kNavMeshGeneration_BoundingBox, RE::TESObjectACTI::RecordFlags::RecordFlag::kChildCanUse, RE::TESObjectACTI::RecordFlags::RecordFlag::kNavMeshGeneration_Ground },
+	{ "kDeleted", "kHasTreeLOD", "kMustUpdateAnims", "kHiddenFromLocalMap", "kIgnored", "kHasDistantLOD", "kRandomAnimStart", "kDangerous", "kIgnoresObjectInteraction", "kIsMarker", "kObstacle", "kNavMeshGeneration_Filter", "kNavMeshGeneration_BoundingBox", "kChildCanUse", "kNavMeshGeneration_Ground" }));
+
+static_assert(test::RoundTrips<RE::TESObjectANIO::RecordFlags::RecordFlag>(
+	{ RE::TESObjectANIO::RecordFlags::RecordFlag::kDeleted, RE::TESObjectANIO::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESObjectARMA::RecordFlags::RecordFlag>(
+	{ RE::TESObjectARMA::RecordFlags::RecordFlag::kDeleted, RE::TESObjectARMA::RecordFlags::RecordFlag::kNoUnderArmorScaling, RE::TESObjectARMA::RecordFlags::RecordFlag::kHasSculpData, RE::TESObjectARMA::RecordFlags::RecordFlag::kIgnored, RE::TESObjectARMA::RecordFlags::RecordFlag::kHighResFirstPersonOnly },
+	{ "kDeleted", "kNoUnderArmorScaling", "kHasSculpData", "kIgnored", "kHighResFirstPersonOnly" }));
+
+static_assert(test::RoundTrips<RE::TESObjectARMO::RecordFlags::RecordFlag>(
+	{ RE::TESObjectARMO::RecordFlags::RecordFlag::kNonPlayable, RE::TESObjectARMO::RecordFlags::RecordFlag::kDeleted, RE::TESObjectARMO::RecordFlags::RecordFlag::kShield, RE::TESObjectARMO::RecordFlags::RecordFlag::kIgnored },
+	{ "kNonPlayable", "kDeleted", "kShield", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESObjectBOOK::RecordFlags::RecordFlag>(
+	{ RE::TESObjectBOOK::RecordFlags::RecordFlag::kDeleted, RE::TESObjectBOOK::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESObjectCELL::CELL_STATE>(
+	{ RE::TESObjectCELL::CELL_STATE::kNotLoaded, RE::TESObjectCELL::CELL_STATE::kUnloading, RE::TESObjectCELL::CELL_STATE::kLoadingData, RE::TESObjectCELL::CELL_STATE::kLoading, RE::TESObjectCELL::CELL_STATE::kLoaded, RE::TESObjectCELL::CELL_STATE::kDetaching, RE::TESObjectCELL::CELL_STATE::kAttachQueued, RE::TESObjectCELL::CELL_STATE::kAttaching, RE::TESObjectCELL::CELL_STATE::kAttached },
+	{ "kNotLoaded", "kUnloading", "kLoadingData", "kLoading", "kLoaded", "kDetaching", "kAttachQueued", "kAttaching", "kAttached" }));
+
+static_assert(test::RoundTrips<RE::TESObjectCELL::Flags>(
+	{ RE::TESObjectCELL::Flags::kNone, RE::TESObjectCELL::Flags::kIsInterior, RE::TESObjectCELL::Flags::kHasWater, RE::TESObjectCELL::Flags::kCanTravelFromHere, RE::TESObjectCELL::Flags::kNoLODWater, RE::TESObjectCELL::Flags::kHasTempData, RE::TESObjectCELL::Flags::kPublicArea, RE::TESObjectCELL::Flags::kHandChanged, RE::TESObjectCELL::Flags::kShowSky, RE::TESObjectCELL::Flags::kUseSkyLighting, RE::TESObjectCELL::Flags::kWarnToLeave, RE::TESObjectCELL::Flags::kHiddenFromInteriorList, RE::TESObjectCELL::Flags::kSunlightShadows, RE::TESObjectCELL::Flags::kDistantLODOnly, RE::TESObjectCELL::Flags::kFollowersCannotTravelHere },
+	{ "kNone", "kIsInterior", "kHasWater", "kCanTravelFromHere", "kNoLODWater", "kHasTempData", "kPublicArea", "kHandChanged", "kShowSky", "kUseSkyLighting", "kWarnToLeave", "kHiddenFromInteriorList", "kSunlightShadows", "kDistantLODOnly", "kFollowersCannotTravelHere" }));
+
+static_assert(test::RoundTrips<RE::TESObjectCELL::RecordFlags::RecordFlag>(
+	{ RE::TESObjectCELL::RecordFlags::RecordFlag::kDeleted, RE::TESObjectCELL::RecordFlags::RecordFlag::kNoPreVis, RE::TESObjectCELL::RecordFlags::RecordFlag::kPersistent, RE::TESObjectCELL::RecordFlags::RecordFlag::kIgnored, RE::TESObjectCELL::RecordFlags::RecordFlag::kOffLimits, RE::TESObjectCELL::RecordFlags::RecordFlag::kCompressed, RE::TESObjectCELL::RecordFlags::RecordFlag::kCannotWait },
+	{ "kDeleted", "kNoPreVis", "kPersistent", "kIgnored", "kOffLimits", "kCompressed", "kCannotWait" }));
+
+static_assert(test::RoundTrips<RE::TESObjectCONT::RecordFlags::RecordFlag>(
+	{ RE::TESObjectCONT::RecordFlags::RecordFlag::kDeleted, RE::TESObjectCONT::RecordFlags::RecordFlag::kIgnored, RE::TESObjectCONT::RecordFlags::RecordFlag::kHasDistantLOD, RE::TESObjectCONT::RecordFlags::RecordFlag::kRandomAnimStart, RE::TESObjectCONT::RecordFlags::RecordFlag::kObstacle, RE::TESObjectCONT::RecordFlags::RecordFlag::kNavMeshGeneration_Filter, RE::TESObjectCONT::RecordFlags::RecordFlag::kNavMeshGeneration_BoundingBox, RE::TESObjectCONT::RecordFlags::RecordFlag::kNavMeshGeneration_Ground },
+	{ "kDeleted", "kIgnored", "kHasDistantLOD", "kRandomAnimStart", "kObstacle", "kNavMeshGeneration_Filter", "kNavMeshGeneration_BoundingBox", "kNavMeshGeneration_Ground" }));
+
+static_assert(test::RoundTrips<RE::TESObjectDOOR::Flags>(
+	{ RE::TESObjectDOOR::Flags::kNone, RE::TESObjectDOOR::Flags::kAutomatic, RE::TESObjectDOOR::Flags::kHidden, RE::TESObjectDOOR::Flags::kMinimalUse, RE::TESObjectDOOR::Flags::kSliding, RE::TESObjectDOOR::Flags::kDoNotOpenInCombatSearch, RE::TESObjectDOOR::Flags::kNoToText },
+	{ "kNone", "kAutomatic", "kHidden", "kMinimalUse", "kSliding", "kDoNotOpenInCombatSearch", "kNoToText" }));
+
+static_assert(test::RoundTrips<RE::TESObjectDOOR::RecordFlags::RecordFlag>(
+	{ RE::TESObjectDOOR::RecordFlags::RecordFlag::kDeleted, RE::TESObjectDOOR::RecordFlags::RecordFlag::kIgnored, RE::TESObjectDOOR::RecordFlags::RecordFlag::kHasDistantLOD, RE::TESObjectDOOR::RecordFlags::RecordFlag::kRandomAnimStart, RE::TESObjectDOOR::RecordFlags::RecordFlag::kIsMarker },
+	{ "kDeleted", "kIgnored", "kHasDistantLOD", "kRandomAnimStart", "kIsMarker" }));
+
+static_assert(test::RoundTrips<RE::TESObjectLAND::RecordFlags::RecordFlag>(
+	{ RE::TESObjectLAND::RecordFlags::RecordFlag::kDeleted, RE::TESObjectLAND::RecordFlags::RecordFlag::kIgnored, RE::TESObjectLAND::RecordFlags::RecordFlag::kCompressed },
+	{ "kDeleted", "kIgnored", "kCompressed" }));
+
+static_assert(test::RoundTrips<RE::TESObjectLIGH::RecordFlags::RecordFlag>(
+	{ RE::TESObjectLIGH::RecordFlags::RecordFlag::kDeleted, RE::TESObjectLIGH::RecordFlags::RecordFlag::kIgnored, RE::TESObjectLIGH::RecordFlags::RecordFlag::kHasDistantLOD, RE::TESObjectLIGH::RecordFlags::RecordFlag::kRandomAnimStart, RE::TESObjectLIGH::RecordFlags::RecordFlag::kObstacle, RE::TESObjectLIGH::RecordFlags::RecordFlag::kPortalStrict },
+	{ "kDeleted", "kIgnored", "kHasDistantLOD", "kRandomAnimStart", "kObstacle", "kPortalStrict" }));
+
+static_assert(test::RoundTrips<RE::TESObjectMISC::RecordFlags::RecordFlag>(
+	{ RE::TESObjectMISC::RecordFlags::RecordFlag::kDeleted, RE::TESObjectMISC::RecordFlags::RecordFlag::kCalculateFromComponents, RE::TESObjectMISC::RecordFlags::RecordFlag::kIgnored, RE::TESObjectMISC::RecordFlags::RecordFlag::kPackInUseOnly },
+	{ "kDeleted", "kCalculateFromComponents", "kIgnored", "kPackInUseOnly" }));
+
+static_assert(test::RoundTrips<RE::TESObjectREFR::RecordFlags::RecordFlag>(
+	{ RE::TESObjectREFR::RecordFlags::RecordFlag::kIsGroundPiece, RE::TESObjectREFR::RecordFlags::RecordFlag::kCollisionsDisabled, RE::TESObjectREFR::RecordFlags::RecordFlag::kDeleted, RE::TESObjectREFR::RecordFlags::RecordFlag::kHiddenFromLocalMap, RE::TESObjectREFR::RecordFlags::RecordFlag::kTurnOffFire, RE::TESObjectREFR::RecordFlags::RecordFlag::kInaccessible, RE::TESObjectREFR::RecordFlags::RecordFlag::kLODRespectsEnableState, RE::TESObjectREFR::RecordFlags::RecordFlag::kStartsDead, RE::TESObjectREFR::RecordFlags::RecordFlag::kDoesNotLightWater, RE::TESObjectREFR::RecordFlags::RecordFlag::kMotionBlur, RE::TESObjectREFR::RecordFlags::RecordFlag::kPersistent, RE::TESObjectREFR::RecordFlags::RecordFlag::kInitiallyDisabled, RE::TESObjectREFR::RecordFlags::RecordFlag::kIgnored, RE::TESObjectREFR::RecordFlags::RecordFlag::kStartUnconscious, RE::TESObjectREFR::RecordFlags::RecordFlag::kSkyMarker, RE::TESObjectREFR::RecordFlags::RecordFlag::kHarvested, RE::TESObjectREFR::RecordFlags::RecordFlag::kIsFullLOD, RE::TESObjectREFR::RecordFlags::RecordFlag::kNeverFades, RE::TESObjectREFR::RecordFlags::RecordFlag::kDoesNotLightLandscape, RE::TESObjectREFR::RecordFlags::RecordFlag::kIgnoreFriendlyHits, RE::TESObjectREFR::RecordFlags::RecordFlag::kNoAIAcquire, RE::TESObjectREFR::RecordFlags::RecordFlag::kCollisionGeometry_Filter, RE::TESObjectREFR::RecordFlags::RecordFlag::kCollisionGeometry_BoundingBox, RE::TESObjectREFR::RecordFlags::RecordFlag::kReflectedByAutoWater, RE::TESObjectREFR::RecordFlags::RecordFlag::kDontHavokSettle, RE::TESObjectREFR::RecordFlags::RecordFlag::kGround, RE::TESObjectREFR::RecordFlags::RecordFlag::kRespawns, RE::TESObjectREFR::RecordFlags::RecordFlag::kMultibound },
+	{ "kIsGroundPiece", "kCollisionsDisabled", "kDeleted", "kHiddenFromLocalMap", "kTurnOffFire", "kInaccessible", "kLODRespectsEnableState", "kStartsDead", "kDoesNotLightWater", "kMotionBlur", "kPersistent", "kInitiallyDisabled", "kIgnored", "kStartUnconscious", "kSkyMarker", "kHarvested", "kIsFullLOD", "kNeverFades", "kDoesNotLightLandscape", "kIgnoreFriendlyHits", "kNoAIAcquire", "kCollisionGeometry_Filter", "kCollisionGeometry_BoundingBox", "kReflectedByAutoWater", "kDontHavokSettle", "kGround", "kRespawns", "kMultibound" }));
+
+static_assert(test::RoundTrips<RE::TESObjectSTAT::RecordFlags::RecordFlag>(
+	{ RE::TESObjectSTAT::RecordFlags::RecordFlag::kNeverFades, RE::TESObjectSTAT::RecordFlags::RecordFlag::kDeleted, RE::TESObjectSTAT::RecordFlags::RecordFlag::kIsSkyObject, RE::TESObjectSTAT::RecordFlags::RecordFlag::kHasTreeLOD, RE::TESObjectSTAT::RecordFlags::RecordFlag::kAddOnLODObject, RE::TESObjectSTAT::RecordFlags::RecordFlag::kHiddenFromLocalMap, RE::TESObjectSTAT::RecordFlags::RecordFlag::kHasDistantLOD, RE::TESObjectSTAT::RecordFlags::RecordFlag::kUsesHDLODTexture, RE::TESObjectSTAT::RecordFlags::RecordFlag::kHasCurrents, RE::TESObjectSTAT::RecordFlags::RecordFlag::kIsMarker, RE::TESObjectSTAT::RecordFlags::RecordFlag::kObstacle, RE::TESObjectSTAT::RecordFlags::RecordFlag::kNavMeshGeneration_Filter, RE::TESObjectSTAT::RecordFlags::RecordFlag::kNavMeshGeneration_BoundingBox, RE::TESObjectSTAT::RecordFlags::RecordFlag::kShowInWorldMap, RE::TESObjectSTAT::RecordFlags::RecordFlag::kNavMeshGeneration_Ground },
+	{ "kNeverFades", "kDeleted", "kIsSkyObject", "kHasTreeLOD", "kAddOnLODObject", "kHiddenFromLocalMap", "kHasDistantLOD", "kUsesHDLODTexture", "kHasCurrents", "kIsMarker", "kObstacle", "kNavMeshGeneration_Filter", "kNavMeshGeneration_BoundingBox", "kShowInWorldMap", "kNavMeshGeneration_Ground" }));
+
+static_assert(test::RoundTrips<RE::TESObjectTREE::RecordFlags::RecordFlag>(
+	{ RE::TESObjectTREE::RecordFlags::RecordFlag::kDeleted, RE::TESObjectTREE::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESObjectTREE::etTreeType>(
+	{ RE::TESObjectTREE::etTreeType::kShortAndThin, RE::TESObjectTREE::etTreeType::kShortAndThick, RE::TESObjectTREE::etTreeType::kTallAndThin, RE::TESObjectTREE::etTreeType::kTallAndThick },
+	{ "kShortAndThin", "kShortAndThick", "kTallAndThin", "kTallAndThick" }));
+
+static_assert(test::RoundTrips<RE::TESObjectWEAP::RecordFlags::RecordFlag>(
+	{ RE::TESObjectWEAP::RecordFlags::RecordFlag::kNonPlayable, RE::TESObjectWEAP::RecordFlags::RecordFlag::kDeleted, RE::TESObjectWEAP::RecordFlags::RecordFlag::kIgnored },
+	{ "kNonPlayable", "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESPackage::RecordFlags::RecordFlag>(
+	{ RE::TESPackage::RecordFlags::RecordFlag::kDeleted, RE::TESPackage::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESProduceForm::SEASON::SEASONS>(
+	{ RE::TESProduceForm::SEASON::SEASONS::kNone, RE::TESProduceForm::SEASON::SEASONS::kSpring, RE::TESProduceForm::SEASON::SEASONS::kSummer, RE::TESProduceForm::SEASON::SEASONS::kFall, RE::TESProduceForm::SEASON::SEASONS::kWinter, RE::TESProduceForm::SEASON::SEASONS::kTotal },
+	{ "kNone", "kSpring", "kSummer", "kFall", "kWinter", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::TESQuest::RecordFlags::RecordFlag>(
+	{ RE::TESQuest::RecordFlags::RecordFlag::kDeleted, RE::TESQuest::RecordFlags::RecordFlag::kIgnored, RE::TESQuest::RecordFlags::RecordFlag::kPartialForm },
+	{ "kDeleted", "kIgnored", "kPartialForm" }));
+
+static_assert(test::RoundTrips<RE::TESQuestEvent::Type>(
+	{ RE::TESQuestEvent::Type::kUpdateQuestActiveStatus, RE::TESQuestEvent::Type::kUpdateQuestEnableStatus, RE::TESQuestEvent::Type::kUpdateQuestStageChange, RE::TESQuestEvent::Type::kUpdateMiscQuestVisibility },
+	{ "kUpdateQuestActiveStatus", "kUpdateQuestEnableStatus", "kUpdateQuestStageChange", "kUpdateMiscQuestVisibility" }));
+
+static_assert(test::RoundTrips<RE::TESRace::RecordFlags::RecordFlag>(
+	{ RE::TESRace::RecordFlags::RecordFlag::kDeleted, RE::TESRace::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESRegion::RecordFlags::RecordFlag>(
+	{ RE::TESRegion::RecordFlags::RecordFlag::kDeleted, RE::TESRegion::RecordFlags::RecordFlag::kBorderRegion, RE::TESRegion::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kBorderRegion", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESShout::RecordFlags::RecordFlag>(
+	{ RE::TESShout::RecordFlags::RecordFlag::kDeleted, RE::TESShout::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESSoulGem::RecordFlags::RecordFlag>(
+	{ RE::TESSoulGem::RecordFlags::RecordFlag::kDeleted, RE::TESSoulGem::RecordFlags::RecordFlag::kIgnored, RE::TESSoulGem::RecordFlags::RecordFlag::kCanHoldNPCSoul },
+	{ "kDeleted", "kIgnored", "kCanHoldNPCSoul" }));
+
+static_assert(test::RoundTrips<RE::TESSound::RecordFlags::RecordFlag>(
+	{ RE::TESSound::RecordFlags::RecordFlag::kDeleted, RE::TESSound::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESTopic::RecordFlags::RecordFlag>(
+	{ RE::TESTopic::RecordFlags::RecordFlag::kDeleted, RE::TESTopic::RecordFlags::RecordFlag::kIgnored, RE::TESTopic::RecordFlags::RecordFlag::kPartialForm },
+	{ "kDeleted", "kIgnored", "kPartialForm" }));
+
+static_assert(test::RoundTrips<RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY>(
+	{ RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_NONE, RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_EASY, RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_MEDIUM, RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_HARD, RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_ALWAYS_SUCCEEDS, RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_EASY_REPEATABLE, RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_MEDIUM_REPEATABLE, RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_HARD_REPEATABLE, RE::TESTopicInfo::CHARISMA_CHALLENGE_DIFFICULTY::CC_CHALLENGE_COUNT },
+	{ "CC_CHALLENGE_NONE", "CC_CHALLENGE_EASY", "CC_CHALLENGE_MEDIUM", "CC_CHALLENGE_HARD", "CC_CHALLENGE_ALWAYS_SUCCEEDS", "CC_CHALLENGE_EASY_REPEATABLE", "CC_CHALLENGE_MEDIUM_REPEATABLE", "CC_CHALLENGE_HARD_REPEATABLE", "CC_CHALLENGE_COUNT" }));
+
+static_assert(test::RoundTrips<RE::TESTopicInfo::CHARISMA_CHALLENGE_SUCCESS>(
+	{ RE::TESTopicInfo::CHARISMA_CHALLENGE_SUCCESS::CC_SUCCESS_NONE, RE::TESTopicInfo::CHARISMA_CHALLENGE_SUCCESS::CC_SUCCESS_FAIL, RE::TESTopicInfo::CHARISMA_CHALLENGE_SUCCESS::CC_SUCCESS_SUCCEED, RE::TESTopicInfo::CHARISMA_CHALLENGE_SUCCESS::CC_SUCCESS_COUNT },
+	{ "CC_SUCCESS_NONE", "CC_SUCCESS_FAIL", "CC_SUCCESS_SUCCEED", "CC_SUCCESS_COUNT" }));
+
+static_assert(test::RoundTrips<RE::TESTopicInfo::RecordFlags::RecordFlag>(
+	{ RE::TESTopicInfo::RecordFlags::RecordFlag::kDeleted, RE::TESTopicInfo::RecordFlags::RecordFlag::kInfoGroup, RE::TESTopicInfo::RecordFlags::RecordFlag::kExcludeFromExpert, RE::TESTopicInfo::RecordFlags::RecordFlag::kIgnored, RE::TESTopicInfo::RecordFlags::RecordFlag::kActorChanged },
+	{ "kDeleted", "kInfoGroup", "kExcludeFromExpert", "kIgnored", "kActorChanged" }));
+
+static_assert(test::RoundTrips<RE::TESWaterForm::RecordFlags::RecordFlag>(
+	{ RE::TESWaterForm::RecordFlags::RecordFlag::kDeleted, RE::TESWaterForm::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESWeather::RecordFlags::RecordFlag>(
+	{ RE::TESWeather::RecordFlags::RecordFlag::kDeleted, RE::TESWeather::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESWeather::SoundType>(
+	{ RE::TESWeather::SoundType::kDefault, RE::TESWeather::SoundType::kPrecipitation, RE::TESWeather::SoundType::kWind, RE::TESWeather::SoundType::kThunder },
+	{ "kDefault", "kPrecipitation", "kWind", "kThunder" }));
+
+static_assert(test::RoundTrips<RE::TESWeather::SpellContext>(
+	{ RE::TESWeather::SpellContext::kApplyOnLightning, RE::TESWeather::SpellContext::kApplyWhenActive },
+	{ "kApplyOnLightning", "kApplyWhenActive" }));
+
+static_assert(test::RoundTrips<RE::TESWordOfPower::RecordFlags::RecordFlag>(
+	{ RE::TESWordOfPower::RecordFlags::RecordFlag::kDeleted, RE::TESWordOfPower::RecordFlags::RecordFlag::kIgnored },
+	{ "kDeleted", "kIgnored" }));
+
+static_assert(test::RoundTrips<RE::TESWorldSpace::Flags>(
+	{ RE::TESWorldSpace::Flags::kNone, RE::TESWorldSpace::Flags::kSmallWorld, RE::TESWorldSpace::Flags::kCannotFastTravel, RE::TESWorldSpace::Flags::kNoLODWater, RE::TESWorldSpace::Flags::kNoLandscape, RE::TESWorldSpace::Flags::kNoSky, RE::TESWorldSpace::Flags::kFixedDimensions, RE::TESWorldSpace::Flags::kNoGrass },
+	{ "kNone", "kSmallWorld", "kCannotFastTravel", "kNoLODWater", "kNoLandscape", "kNoSky", "kFixedDimensions", "kNoGrass" }));
+
+static_assert(test::RoundTrips<RE::TESWorldSpace::PARENT_USE_FLAGS>(
+	{ RE::TESWorldSpace::PARENT_USE_FLAGS::kLand, RE::TESWorldSpace::PARENT_USE_FLAGS::kLOD, RE::TESWorldSpace::PARENT_USE_FLAGS::kMap, RE::TESWorldSpace::PARENT_USE_FLAGS::kWater, RE::TESWorldSpace::PARENT_USE_FLAGS::kClimate, RE::TESWorldSpace::PARENT_USE_FLAGS::kSkyCell },
+	{ "kLand", "kLOD", "kMap", "kWater", "kClimate", "kSkyCell" }));
+
+static_assert(test::RoundTrips<RE::TESWorldSpace::RecordFlags::RecordFlag>(
+	{ RE::TESWorldSpace::RecordFlags::RecordFlag::kDeleted, RE::TESWorldSpace::RecordFlags::RecordFlag::kIgnored, RE::TESWorldSpace::RecordFlags::RecordFlag::kPartialForm, RE::TESWorldSpace::RecordFlags::RecordFlag::kCannotWait },
+	{ "kDeleted", "kIgnored", "kPartialForm", "kCannotWait" }));
+
+static_assert(test::RoundTrips<RE::TES_LIGHT_FLAGS>(
+	{ RE::TES_LIGHT_FLAGS::kNone, RE::TES_LIGHT_FLAGS::kDynamic, RE::TES_LIGHT_FLAGS::kCanCarry, RE::TES_LIGHT_FLAGS::kNegative, RE::TES_LIGHT_FLAGS::kFlicker, RE::TES_LIGHT_FLAGS::kDeepCopy, RE::TES_LIGHT_FLAGS::kOffByDefault, RE::TES_LIGHT_FLAGS::kFlickerSlow, RE::TES_LIGHT_FLAGS::kPulse, RE::TES_LIGHT_FLAGS::kPulseSlow, RE::TES_LIGHT_FLAGS::kSpotlight, RE::TES_LIGHT_FLAGS::kSpotShadow, RE::TES_LIGHT_FLAGS::kHemiShadow, RE::TES_LIGHT_FLAGS::kOmniShadow, RE::TES_LIGHT_FLAGS::kPortalStrict, RE::TES_LIGHT_FLAGS::kNonShadowSpot, RE::TES_LIGHT_FLAGS::kNonSpecular, RE::TES_LIGHT_FLAGS::kAttenutationOnly, RE::TES_LIGHT_FLAGS::kNonShadowBox, RE::TES_LIGHT_FLAGS::kIgnoreRougness, RE::TES_LIGHT_FLAGS::kNoRimLighting, RE::TES_LIGHT_FLAGS::kAmbientOnly, RE::TES_LIGHT_FLAGS::kUnknown, RE::TES_LIGHT_FLAGS::kType },
+	{ "kNone", "kDynamic", "kCanCarry", "kNegative", "kFlicker", "kDeepCopy", "kOffByDefault", "kFlickerSlow", "kPulse", "kPulseSlow", "kSpotlight", "kSpotShadow", "kHemiShadow", "kOmniShadow", "kPortalStrict", "kNonShadowSpot", "kNonSpecular", "kAttenutationOnly", "kNonShadowBox", "kIgnoreRougness", "kNoRimLighting", "kAmbientOnly", "kUnknown", "kType" }));
+
+static_assert(test::RoundTrips<RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS>(
+	{ RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kNone, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kStartSceneOnEnd, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kRandom, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kSayOnce, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kRequirePlayerActivation, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kInfoRefusal, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kRandomEnd, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kEndRunningScene, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kIsForceGreet, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kPlaredAddress, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kGroupTracksData, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kForceSubtitle, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kGroupForceRandom, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kCanMoveWhileGreeitng, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kNoLIPFile, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kGroupDontDoAll, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kPostProcess, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kCustomSoundOutpt, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kDialogueInfoSaid, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kHasCapsData, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kAlreadySaidDoAllBeforeRepeating, RE::TOPIC_INFO_DATA::TOPIC_INFO_FLAGS::kEditorOnly },
+	{ "kNone", "kStartSceneOnEnd", "kRandom", "kSayOnce", "kRequirePlayerActivation", "kInfoRefusal", "kRandomEnd", "kEndRunningScene", "kIsForceGreet", "kPlaredAddress", "kGroupTracksData", "kForceSubtitle", "kGroupForceRandom", "kCanMoveWhileGreeitng", "kNoLIPFile", "kGroupDontDoAll", "kPostProcess", "kCustomSoundOutpt", "kDialogueInfoSaid", "kHasCapsData", "kAlreadySaidDoAllBeforeRepeating", "kEditorOnly" }));
+
+static_assert(test::RoundTrips<RE::TerminalMenu::Mode>(
+	{ RE::TerminalMenu::Mode::kInit, RE::TerminalMenu::Mode::kHack, RE::TerminalMenu::Mode::kLogin, RE::TerminalMenu::Mode::kList, RE::TerminalMenu::Mode::kText, RE::TerminalMenu::Mode::kImage, RE::TerminalMenu::Mode::kHolotape, RE::TerminalMenu::Mode::kWaitingForPapyrus },
+	{ "kInit", "kHack", "kLogin", "kList", "kText", "kImage", "kHolotape", "kWaitingForPapyrus" }));
+
+static_assert(test::RoundTrips<RE::TextureFileFormat>(
+	{ RE::TextureFileFormat::kBMP, RE::TextureFileFormat::kJPG, RE::TextureFileFormat::kTGA, RE::TextureFileFormat::kPNG, RE::TextureFileFormat::kDDS },
+	{ "kBMP", "kJPG", "kTGA", "kPNG", "kDDS" }));
+
+static_assert(test::RoundTrips<RE::ThumbstickEvent::THUMBSTICK_ID>(
+	{ RE::ThumbstickEvent::THUMBSTICK_ID::kLeft, RE::ThumbstickEvent::THUMBSTICK_ID::kRight },
+	{ "kLeft", "kRight" }));
+
+static_assert(test::RoundTrips<RE::TypeInfo::RawType>(
+	{ RE::TypeInfo::RawType::kNone, RE::TypeInfo::RawType::kObject, RE::TypeInfo::RawType::kString, RE::TypeInfo::RawType::kInt, RE::TypeInfo::RawType::kFloat, RE::TypeInfo::RawType::kBool, RE::TypeInfo::RawType::kVar, RE::TypeInfo::RawType::kStruct, RE::TypeInfo::RawType::kArrayStart, RE::TypeInfo::RawType::kArrayObject, RE::TypeInfo::RawType::kArrayString, RE::TypeInfo::RawType::kArrayInt, RE::TypeInfo::RawType::kArrayFloat, RE::TypeInfo::RawType::kArrayBool, RE::TypeInfo::RawType::kArrayVar, RE::TypeInfo::RawType::kArrayStruct, RE::TypeInfo::RawType::kArrayEnd },
+	{ "kNone", "kObject", "kString", "kInt", "kFloat", "kBool", "kVar", "kStruct", "kArrayStart", "kArrayObject", "kArrayString", "kArrayInt", "kArrayFloat", "kArrayBool", "kArrayVar", "kArrayStruct", "kArrayEnd" }));
+
+static_assert(test::RoundTrips<RE::UIShaderColors::Flags>(
+	{ RE::UIShaderColors::Flags::kNone, RE::UIShaderColors::Flags::kBackgroundQuad, RE::UIShaderColors::Flags::kColorMultiplier, RE::UIShaderColors::Flags::kVerticalGradient, RE::UIShaderColors::Flags::kUseAlphaForDropshadow },
+	{ "kNone", "kBackgroundQuad", "kColorMultiplier", "kVerticalGradient", "kUseAlphaForDropshadow" }));
+
+static_assert(test::RoundTrips<RE::UI_DEPTH_PRIORITY>(
+	{ RE::UI_DEPTH_PRIORITY::kUndefined, RE::UI_DEPTH_PRIORITY::k3DUnderHUD, RE::UI_DEPTH_PRIORITY::kBook, RE::UI_DEPTH_PRIORITY::kScope, RE::UI_DEPTH_PRIORITY::kSWFLoader, RE::UI_DEPTH_PRIORITY::kHUD, RE::UI_DEPTH_PRIORITY::kStandard, RE::UI_DEPTH_PRIORITY::kStandard3DModel, RE::UI_DEPTH_PRIORITY::kPipboy, RE::UI_DEPTH_PRIORITY::kTerminal, RE::UI_DEPTH_PRIORITY::kGameMessage, RE::UI_DEPTH_PRIORITY::kPauseMenu, RE::UI_DEPTH_PRIORITY::kLoadingFader, RE::UI_DEPTH_PRIORITY::kLoading3DModel, RE::UI_DEPTH_PRIORITY::kLoadingMenu, RE::UI_DEPTH_PRIORITY::kMessage, RE::UI_DEPTH_PRIORITY::kButtonBarMenu, RE::UI_DEPTH_PRIORITY::kButtonBarSupressingMenu, RE::UI_DEPTH_PRIORITY::kDebug, RE::UI_DEPTH_PRIORITY::kConsole, RE::UI_DEPTH_PRIORITY::kCursor },
+	{ "kUndefined", "k3DUnderHUD", "kBook", "kScope", "kSWFLoader", "kHUD", "kStandard", "kStandard3DModel", "kPipboy", "kTerminal", "kGameMessage", "kPauseMenu", "kLoadingFader", "kLoading3DModel", "kLoadingMenu", "kMessage", "kButtonBarMenu", "kButtonBarSupressingMenu", "kDebug", "kConsole", "kCursor" }));
+
+static_assert(test::RoundTrips<RE::UI_MENU_FLAGS>(
+	{ RE::UI_MENU_FLAGS::kPausesGame, RE::UI_MENU_FLAGS::kAlwaysOpen, RE::UI_MENU_FLAGS::kUsesCursor, RE::UI_MENU_FLAGS::kUsesMenuContext, RE::UI_MENU_FLAGS::kModal, RE::UI_MENU_FLAGS::kFreezeFrameBackground, RE::UI_MENU_FLAGS::kOnStack, RE::UI_MENU_FLAGS::kDisablePauseMenu, RE::UI_MENU_FLAGS::kRequiresUpdate, RE::UI_MENU_FLAGS::kTopmostRenderedMenu, RE::UI_MENU_FLAGS::kUpdateUsesCursor, RE::UI_MENU_FLAGS::kAllowSaving, RE::UI_MENU_FLAGS::kRendersOffscreenTargets, RE::UI_MENU_FLAGS::kInventoryItemMenu, RE::UI_MENU_FLAGS::kDontHideCursorWhenTopmost, RE::UI_MENU_FLAGS::kCustomRendering, RE::UI_MENU_FLAGS::kAssignCursorToRenderer, RE::UI_MENU_FLAGS::kApplicationMenu, RE::UI_MENU_FLAGS::kHasButtonBar, RE::UI_MENU_FLAGS::kIsTopButtonBar, RE::UI_MENU_FLAGS::kAdvancesUnderPauseMenu, RE::UI_MENU_FLAGS::kRendersUnderPauseMenu, RE::UI_MENU_FLAGS::kUsesBlurredBackground, RE::UI_MENU_FLAGS::kCompanionAppAllowed, RE::UI_MENU_FLAGS::kFreezeFramePause, RE::UI_MENU_FLAGS::kSkipRenderDuringFreezeFrameScreenshot, RE::UI_MENU_FLAGS::kLargeScaleformRenderCacheMode, RE::UI_MENU_FLAGS::kUsesMovementToDirection },
+	{ "kPausesGame", "kAlwaysOpen", "kUsesCursor", "kUsesMenuContext", "kModal", "kFreezeFrameBackground", "kOnStack", "kDisablePauseMenu", "kRequiresUpdate", "kTopmostRenderedMenu", "kUpdateUsesCursor", "kAllowSaving", "kRendersOffscreenTargets", "kInventoryItemMenu", "kDontHideCursorWhenTopmost", "kCustomRendering", "kAssignCursorToRenderer", "kApplicationMenu", "kHasButtonBar", "kIsTopButtonBar", "kAdvancesUnderPauseMenu", "kRendersUnderPauseMenu", "kUsesBlurredBackground", "kCompanionAppAllowed", "kFreezeFramePause", "kSkipRenderDuringFreezeFrameScreenshot", "kLargeScaleformRenderCacheMode", "kUsesMovementToDirection" }));
+
+static_assert(test::RoundTrips<RE::UI_MESSAGE_RESULTS>(
+	{ RE::UI_MESSAGE_RESULTS::kHandled, RE::UI_MESSAGE_RESULTS::kIgnore, RE::UI_MESSAGE_RESULTS::kPassOn },
+	{ "kHandled", "kIgnore", "kPassOn" }));
+
+static_assert(test::RoundTrips<RE::UI_MESSAGE_TYPE>(
+	{ RE::UI_MESSAGE_TYPE::kUpdate, RE::UI_MESSAGE_TYPE::kShow, RE::UI_MESSAGE_TYPE::kReshow, RE::UI_MESSAGE_TYPE::kHide, RE::UI_MESSAGE_TYPE::kForceHide, RE::UI_MESSAGE_TYPE::kScaleformEvent, RE::UI_MESSAGE_TYPE::kUserEvent, RE::UI_MESSAGE_TYPE::kInventoryUpdate, RE::UI_MESSAGE_TYPE::kUserProfileChange, RE::UI_MESSAGE_TYPE::kMUStatusChange, RE::UI_MESSAGE_TYPE::kResumeCaching, RE::UI_MESSAGE_TYPE::kUpdateController, RE::UI_MESSAGE_TYPE::kChatterEvent, RE::UI_MESSAGE_TYPE::kTotal },
+	{ "kUpdate", "kShow", "kReshow", "kHide", "kForceHide", "kScaleformEvent", "kUserEvent", "kInventoryUpdate", "kUserProfileChange", "kMUStatusChange", "kResumeCaching", "kUpdateController", "kChatterEvent", "kTotal" }));
+
+static_assert(test::RoundTrips<RE::UserEvents::INPUT_CONTEXT_ID>(
+	{ RE::UserEvents::INPUT_CONTEXT_ID::kMainGameplay, RE::UserEvents::INPUT_CONTEXT_ID::kBasicMenuNav, RE::UserEvents::INPUT_CONTEXT_ID::kThumbNav, RE::UserEvents::INPUT_CONTEXT_ID::kVirtualController, RE::UserEvents::INPUT_CONTEXT_ID::kCursor, RE::UserEvents::INPUT_CONTEXT_ID::kLThumbCursor, RE::UserEvents::INPUT_CONTEXT_ID::kConsole, RE::UserEvents::INPUT_CONTEXT_ID::kDebugText, RE::UserEvents::INPUT_CONTEXT_ID::kBook, RE::UserEvents::INPUT_CONTEXT_ID::kDebugOverlay, RE::UserEvents::INPUT_CONTEXT_ID::kTFC, RE::UserEvents::INPUT_CONTEXT_ID::kDebugMap, RE::UserEvents::INPUT_CONTEXT_ID::kLockpick, RE::UserEvents::INPUT_CONTEXT_ID::kVATS, RE::UserEvents::INPUT_CONTEXT_ID::kVATSPlayback, RE::UserEvents::INPUT_CONTEXT_ID::kMultiActivate, RE::UserEvents::INPUT_CONTEXT_ID::kWorkshop, RE::UserEvents::INPUT_CONTEXT_ID::kScope, RE::UserEvents::INPUT_CONTEXT_ID::kSitWait, RE::UserEvents::INPUT_CONTEXT_ID::kLooksMenu, RE::UserEvents::INPUT_CONTEXT_ID::kWorkshopAddendum, RE::UserEvents::INPUT_CONTEXT_ID::kPauseMenu, RE::UserEvents::INPUT_CONTEXT_ID::kLevelUpMenu, RE::UserEvents::INPUT_CONTEXT_ID::kLevelUpMenuPrevNext, RE::UserEvents::INPUT_CONTEXT_ID::kMainMenu, RE::UserEvents::INPUT_CONTEXT_ID::kQuickContainerMenu, RE::UserEvents::INPUT_CONTEXT_ID::kSpecialActivateRollover, RE::UserEvents::INPUT_CONTEXT_ID::kTwoButtonRollover, RE::UserEvents::INPUT_CONTEXT_ID::kQuickContainerMenuPerk, RE::UserEvents::INPUT_CONTEXT_ID::kVertibird, RE::UserEvents::INPUT_CONTEXT_ID::kPlayBinkMenu, RE::UserEvents::INPUT_CONTEXT_ID::kRobotModAddendum, RE::UserEvents::INPUT_CONTEXT_ID::kCreationClub, RE::UserEvents::INPUT_CONTEXT_ID::kTotal, RE::UserEvents::INPUT_CONTEXT_ID::kNone },
+	{ "kMainGameplay", "kBasicMenuNav", "kThumbNav", "kVirtualController", "kCursor", "kLThumbCursor", "kConsole", "kDebugText", "kBook", "kDebugOverlay", "kTFC", "kDebugMap", "kLockpick", "kVATS", "kVATSPlayback", "kMultiActivate", "kWorkshop", "kScope", "kSitWait", "kLooksMenu", "kWorkshopAddendum", "kPauseMenu", "kLevelUpMenu", "kLevelUpMenuPrevNext", "kMainMenu", "kQuickContainerMenu", "kSpecialActivateRollover", "kTwoButtonRollover", "kQuickContainerMenuPerk", "kVertibird", "kPlayBinkMenu", "kRobotModAddendum", "kCreationClub", "kTotal", "kNone" }));
+
+static_assert(test::RoundTrips<RE::UserEvents::SENDER_ID>(
+	{ RE::UserEvents::SENDER_ID::kNone, RE::UserEvents::SENDER_ID::kGameplay, RE::UserEvents::SENDER_ID::kMenu, RE::UserEvents::SENDER_ID::kScript },
+	{ "kNone", "kGameplay", "kMenu", "kScript" }));
+
+static_assert(test::RoundTrips<RE::UserEvents::USER_EVENT_FLAGS>(
+	{ RE::UserEvents::USER_EVENT_FLAGS::kAll, RE::UserEvents::USER_EVENT_FLAGS::kMovement, RE::UserEvents::USER_EVENT_FLAGS::kLooking, RE::UserEvents::USER_EVENT_FLAGS::kActivate, RE::UserEvents::USER_EVENT_FLAGS::kMenu, RE::UserEvents::USER_EVENT_FLAGS::kConsole, RE::UserEvents::USER_EVENT_FLAGS::kPOVSwitch, RE::UserEvents::USER_EVENT_FLAGS::kFighting, RE::UserEvents::USER_EVENT_FLAGS::kSneaking, RE::UserEvents::USER_EVENT_FLAGS::kMainFour, RE::UserEvents::USER_EVENT_FLAGS::kWheelZoom, RE::UserEvents::USER_EVENT_FLAGS::kJumping, RE::UserEvents::USER_EVENT_FLAGS::kVATS },
+	{ "kAll", "kMovement", "kLooking", "kActivate", "kMenu", "kConsole", "kPOVSwitch", "kFighting", "kSneaking", "kMainFour", "kWheelZoom", "kJumping", "kVATS" }));
+
+static_assert(test::RoundTrips<RE::VATS::VATS_MODE_ENUM>(
+	{ RE::VATS::VATS_MODE_ENUM::kNone, RE::VATS::VATS_MODE_ENUM::kPlayback },
+	{ "kNone", "kPlayback" }));
+
+static_assert(test::RoundTrips<RE::VOICE_TYPE_DATA::Flags>(
+	{ RE::VOICE_TYPE_DATA::Flags::kNone, RE::VOICE_TYPE_DATA::Flags::kAllowDefaultDialogue, RE::VOICE_TYPE_DATA::Flags::kFemale },
+	{ "kNone", "kAllowDefaultDialogue", "kFemale" }));
+
+static_assert(test::RoundTrips<RE::VirtualMachine::FreezeState>(
+	{ RE::VirtualMachine::FreezeState::kNotFrozen, RE::VirtualMachine::FreezeState::kFreezing, RE::VirtualMachine::FreezeState::kFrozen },
+	{ "kNotFrozen", "kFreezing", "kFrozen" }));
+
+static_assert(test::RoundTrips<RE::WARNING_TYPE>(
+	{ RE::WARNING_TYPE::kDefault, RE::WARNING_TYPE::kSystem, RE::WARNING_TYPE::kCombat, RE::WARNING_TYPE::kAnimation, RE::WARNING_TYPE::kAI, RE::WARNING_TYPE::kScripts, RE::WARNING_TYPE::kSaveLoad, RE::WARNING_TYPE::kDialogue, RE::WARNING_TYPE::kQuests, RE::WARNING_TYPE::kPackages, RE::WARNING_TYPE::kEditor, RE::WARNING_TYPE::kModels, RE::WARNING_TYPE::kTextures, RE::WARNING_TYPE::kPlugins, RE::WARNING_TYPE::kMasterFile, RE::WARNING_TYPE::kForms, RE::WARNING_TYPE::kMagic, RE::WARNING_TYPE::kShaders, RE::WARNING_TYPE::kRendering, RE::WARNING_TYPE::kPathfinding, RE::WARNING_TYPE::kMenus, RE::WARNING_TYPE::kAudio, RE::WARNING_TYPE::kCells, RE::WARNING_TYPE::kHavok, RE::WARNING_TYPE::kFaceGen, RE::WARNING_TYPE::kWater, RE::WARNING_TYPE::kInGameMessage, RE::WARNING_TYPE::kMemory, RE::WARNING_TYPE::kPerformance, RE::WARNING_TYPE::kLootJoy, RE::WARNING_TYPE::kVATS, RE::WARNING_TYPE::kDismember, RE::WARNING_TYPE::kCompanion, RE::WARNING_TYPE::kWorkshop },
+	{ "kDefault", "kSystem", "kCombat", "kAnimation", "kAI", "kScripts", "kSaveLoad", "kDialogue", "kQuests", "kPackages", "kEditor", "kModels", "kTextures", "kPlugins", "kMasterFile", "kForms", "kMagic", "kShaders", "kRendering", "kPathfinding", "kMenus", "kAudio", "kCells", "kHavok", "kFaceGen", "kWater", "kInGameMessage", "kMemory", "kPerformance", "kLootJoy", "kVATS", "kDismember", "kCompanion", "kWorkshop" }));
+
+static_assert(test::RoundTrips<RE::WEAPON_CULL_TYPE>(
+	{ RE::WEAPON_CULL_TYPE::kGeneral, RE::WEAPON_CULL_TYPE::kAnimation, RE::WEAPON_CULL_TYPE::kWeaponSwitch },
+	{ "kGeneral", "kAnimation", "kWeaponSwitch" }));
+
+static_assert(test::RoundTrips<RE::WEAPON_FLAGS>(
+	{ RE::WEAPON_FLAGS::kPlayerOnly, RE::WEAPON_FLAGS::kNPCsUseAmmo, RE::WEAPON_FLAGS::kNoJamAfterReload, RE::WEAPON_FLAGS::kChargingReload, RE::WEAPON_FLAGS::kMinorCrime, RE::WEAPON_FLAGS::kFixedRange, RE::WEAPON_FLAGS::kNotUsedInNormalCombat, RE::WEAPON_FLAGS::kCritEffectOnDeath, RE::WEAPON_FLAGS::kChargingAttack, RE::WEAPON_FLAGS::kHoldInputToPower, RE::WEAPON_FLAGS::kNonHostile, RE::WEAPON_FLAGS::kBoundWeapon, RE::WEAPON_FLAGS::kIgnoresNormalWeaponResistance, RE::WEAPON_FLAGS::kAutomatic, RE::WEAPON_FLAGS::kRepeatableSingleFire, RE::WEAPON_FLAGS::kCantDrop, RE::WEAPON_FLAGS::kHideBackpack, RE::WEAPON_FLAGS::kEmbeddedWeapon, RE::WEAPON_FLAGS::kNotPlayable, RE::WEAPON_FLAGS::kHasScope, RE::WEAPON_FLAGS::kBoltAction, RE::WEAPON_FLAGS::kSecondaryWeapon, RE::WEAPON_FLAGS::kDisableShells },
+	{ "kPlayerOnly", "kNPCsUseAmmo", "kNoJamAfterReload", "kChargingReload", "kMinorCrime", "kFixedRange", "kNotUsedInNormalCombat", "kCritEffectOnDeath", "kChargingAttack", "kHoldInputToPower", "kNonHostile", "kBoundWeapon", "kIgnoresNormalWeaponResistance", "kAutomatic", "kRepeatableSingleFire", "kCantDrop", "kHideBackpack", "kEmbeddedWeapon", "kNotPlayable", "kHasScope", "kBoltAction", "kSecondaryWeapon", "kDisableShells" }));
+
+static_assert(test::RoundTrips<RE::WEAPON_STATE>(
+	{ RE::WEAPON_STATE::kSheathed, RE::WEAPON_STATE::kWantToDraw, RE::WEAPON_STATE::kDrawing, RE::WEAPON_STATE::kDrawn, RE::WEAPON_STATE::kWantToSheathe, RE::WEAPON_STATE::kSheathing },
+	{ "kSheathed", "kWantToDraw", "kDrawing", "kDrawn", "kWantToSheathe", "kSheathing" }));
+
+static_assert(test::RoundTrips<RE::WEAPON_TYPE>(
+	{ RE::WEAPON_TYPE::kNone, RE::WEAPON_TYPE::kHandToHand, RE::WEAPON_TYPE::kOneHandSword, RE::WEAPON_TYPE::kOneHandDagger, RE::WEAPON_TYPE::kOneHandAxe, RE::WEAPON_TYPE::kOneHandMace, RE::WEAPON_TYPE::kTwoHandSword, RE::WEAPON_TYPE::kTwoHandAxe, RE::WEAPON_TYPE::kBow, RE::WEAPON_TYPE::kStaff, RE::WEAPON_TYPE::kGun, RE::WEAPON_TYPE::kGrenade, RE::WEAPON_TYPE::kMine },
+	{ "kNone", "kHandToHand", "kOneHandSword", "kOneHandDagger", "kOneHandAxe", "kOneHandMace", "kTwoHandSword", "kTwoHandAxe", "kBow", "kStaff", "kGun", "kGrenade", "kMine" }));
+
+static_assert(test::RoundTrips<RE::WardState>(
+	{ RE::WardState::kNone, RE::WardState::kAbsorb, RE::WardState::kBreak },
+	{ "kNone", "kAbsorb", "kBreak" }));
+
+static_assert(test::RoundTrips<RE::WorkbenchData::Type>(
+	{ RE::WorkbenchData::Type::kNone, RE::WorkbenchData::Type::kCreateObject, RE::WorkbenchData::Type::kWeapons, RE::WorkbenchData::Type::kEnchanting, RE::WorkbenchData::Type::kEnchantingExperiment, RE::WorkbenchData::Type::kAlchemy, RE::WorkbenchData::Type::kAlchemyExperiment, RE::WorkbenchData::Type::kArmor, RE::WorkbenchData::Type::kPowerArmor, RE::WorkbenchData::Type::kRobotMod },
+	{ "kNone", "kCreateObject", "kWeapons", "kEnchanting", "kEnchantingExperiment", "kAlchemy", "kAlchemyExperiment", "kArmor", "kPowerArmor", "kRobotMod" }));
+
+static_assert(test::RoundTrips<RE::WorkbenchMenuBase::HighlightMode>(
+	{ RE::WorkbenchMenuBase::HighlightMode::kModMenu, RE::WorkbenchMenuBase::HighlightMode::kAll, RE::WorkbenchMenuBase::HighlightMode::kWorld },
+	{ "kModMenu", "kAll", "kWorld" }));
+
+static_assert(test::RoundTrips<RE::hknpMotionPropertiesId::Preset>(
+	{ RE::hknpMotionPropertiesId::Preset::STATIC, RE::hknpMotionPropertiesId::Preset::DYNAMIC, RE::hknpMotionPropertiesId::Preset::KEYFRAMED, RE::hknpMotionPropertiesId::Preset::FROZEN, RE::hknpMotionPropertiesId::Preset::DEBRIS, RE::hknpMotionPropertiesId::Preset::NUM_PRESETS },
+	{ "STATIC", "DYNAMIC", "KEYFRAMED", "FROZEN", "DEBRIS", "NUM_PRESETS" }));
+
+int main()
+{
+	return EXIT_SUCCESS;
+}
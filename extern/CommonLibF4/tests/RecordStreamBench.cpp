@@ -0,0 +1,246 @@
+#include "F4SE/Serialization.hpp"
+
+namespace
+{
+	inline constexpr std::uint32_t TYPE = 0x48434E42;
+	inline constexpr std::uint32_t VERSION = 1;
+
+	struct result_t
+	{
+		std::string_view workload;
+		std::string_view method;
+		double nsPerOp;
+		double callsPerOp;
+	};
+
+	// opens the only record of the co-save for reading, as a load callback would
+	[[nodiscard]] std::uint32_t open_record(const F4SE::SerializationInterface& a_intfc)
+	{
+		a_intfc.Rewind();
+
+		std::uint32_t type = 0;
+		std::uint32_t version = 0;
+		std::uint32_t length = 0;
+		TEST_CHECK(a_intfc.GetNextRecordInfo(type, version, length));
+		return length;
+	}
+
+	// counts of every size, the way plugins save them, from a few bits to a full 64
+	[[nodiscard]] std::vector<std::int64_t> make_ints(std::mt19937_64& a_rng, std::size_t a_count)
+	{
+		std::vector<std::int64_t> result(a_count);
+		for (auto& value : result) {
+			value = static_cast<std::int64_t>(a_rng() >> (a_rng() % 64));
+		}
+		return result;
+	}
+
+	[[nodiscard]] std::vector<std::string> make_strings(std::mt19937_64& a_rng, std::size_t a_count)
+	{
+		std::vector<std::string> result(a_count);
+		for (auto& string : result) {
+			string.resize(8 + a_rng() % 33);
+			for (auto& c : string) {
+				c = static_cast<char>('a' + a_rng() % 26);
+			}
+		}
+		return result;
+	}
+
+	// most ids repeat, as references to the same few forms do across a save
+	[[nodiscard]] std::vector<RE::TESFormID> make_form_ids(std::mt19937_64& a_rng, std::size_t a_count, F4SE::SerializationInterface& a_intfc)
+	{
+		constexpr std::size_t DISTINCT = 1000;
+		for (std::size_t i = 0; i < DISTINCT; ++i) {
+			a_intfc.formIDs.emplace(static_cast<RE::TESFormID>(0x01000800 + i), static_cast<RE::TESFormID>(0x05000800 + i));
+		}
+
+		std::vector<RE::TESFormID> result(a_count);
+		for (auto& formID : result) {
+			formID = static_cast<RE::TESFormID>(0x01000800 + a_rng() % (DISTINCT + DISTINCT / 10));
+		}
+		return result;
+	}
+}
+
+/**
+ * Times saving and loading many small fields through RecordWriter and RecordReader, against one
+ * interface call per field, over the in-memory co-save of the tests. Also times a large write,
+ * reads past the end of a record, and resolving repeated form ids, and prints the results as JSON.
+ *
+ * <p>
+ * The in-memory co-save is called directly, so the timings leave out the cost of crossing into
+ * F4SE. The calls per op show what the streams save there.
+ * </p>
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto quick = test::quick(a_argc, a_argv);
+	const std::size_t count = quick ? 10'000 : 1'000'000;
+
+	std::mt19937_64 rng{ 33 };
+	F4SE::SerializationInterface intfc;
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_workload, std::string_view a_method, std::size_t a_ops, auto a_func) {
+		const auto calls = intfc.writeCalls + intfc.readCalls + intfc.resolveCalls;
+		const auto ns = test::time_ns(a_func);
+		const auto made = intfc.writeCalls + intfc.readCalls + intfc.resolveCalls - calls;
+		results.push_back({ a_workload, a_method, ns / a_ops, static_cast<double>(made) / a_ops });
+	};
+
+	// varints against fixed 8 byte fields
+	const auto ints = make_ints(rng, count);
+	intfc.Reset();
+	run("ints_save", "RecordWriter", count, [&] {
+		F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+		for (const auto value : ints) {
+			writer.write_varint(value);
+		}
+	});
+	run("ints_load", "RecordReader", count, [&] {
+		F4SE::RecordReader reader{ intfc, open_record(intfc) };
+		for (const auto value : ints) {
+			std::int64_t read = 0;
+			TEST_CHECK(reader.read_varint(read) && read == value);
+		}
+	});
+	const auto varintBytes = intfc.records.back().data.size();
+
+	intfc.Reset();
+	run("ints_save", "interface", count, [&] {
+		intfc.OpenRecord(TYPE, VERSION);
+		for (const auto value : ints) {
+			intfc.WriteRecordData(value);
+		}
+	});
+	run("ints_load", "interface", count, [&] {
+		std::ignore = open_record(intfc);
+		for (const auto value : ints) {
+			std::int64_t read = 0;
+			TEST_CHECK(intfc.ReadRecordData(read) == sizeof(read) && read == value);
+		}
+	});
+	const auto fixedBytes = intfc.records.back().data.size();
+
+	// length prefixed strings, where the interface needs a call for the length and one for the text
+	const auto strings = make_strings(rng, count);
+	intfc.Reset();
+	run("strings_save", "RecordWriter", count, [&] {
+		F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+		for (const auto& string : strings) {
+			writer.write_string(string);
+		}
+	});
+	run("strings_load", "RecordReader", count, [&] {
+		F4SE::RecordReader reader{ intfc, open_record(intfc) };
+		std::string read;
+		for (const auto& string : strings) {
+			TEST_CHECK(reader.read_string(read) && read == string);
+		}
+	});
+
+	intfc.Reset();
+	run("strings_save", "interface", count, [&] {
+		intfc.OpenRecord(TYPE, VERSION);
+		for (const auto& string : strings) {
+			intfc.WriteRecordData(static_cast<std::uint16_t>(string.size()));
+			intfc.WriteRecordData(string.data(), static_cast<std::uint32_t>(string.size()));
+		}
+	});
+	run("strings_load", "interface", count, [&] {
+		std::ignore = open_record(intfc);
+		std::string read;
+		for (const auto& string : strings) {
+			std::uint16_t length = 0;
+			TEST_CHECK(intfc.ReadRecordData(length) == sizeof(length));
+			read.resize(length);
+			TEST_CHECK(intfc.ReadRecordData(read.data(), length) == length && read == string);
+		}
+	});
+
+	// one large body, which the writer hands over without copying it into its buffer
+	std::vector<std::byte> large(count * 8);
+	for (auto& byte : large) {
+		byte = static_cast<std::byte>(rng());
+	}
+	const auto save_large = [&] {
+		F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+		writer.write(large.data(), large.size());
+	};
+	const auto write_large = [&] {
+		intfc.OpenRecord(TYPE, VERSION);
+		intfc.WriteRecordData(large.data(), static_cast<std::uint32_t>(large.size()));
+	};
+
+	// the first records this large fault in fresh pages, so each method keeps its fastest of a few rounds
+	std::array<double, 2> largeNs{ std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity() };
+	std::array<std::size_t, 2> largeCalls{};
+	for (int round = 0; round < 3; ++round) {
+		intfc.Reset();
+		largeNs[0] = std::min(largeNs[0], test::time_ns(save_large));
+		largeCalls[0] = intfc.writeCalls;
+		TEST_CHECK(intfc.records.back().data == large);
+
+		intfc.Reset();
+		largeNs[1] = std::min(largeNs[1], test::time_ns(write_large));
+		largeCalls[1] = intfc.writeCalls;
+	}
+	results.push_back({ "large_save", "RecordWriter", largeNs[0], static_cast<double>(largeCalls[0]) });
+	results.push_back({ "large_save", "interface", largeNs[1], static_cast<double>(largeCalls[1]) });
+
+	// a loader which keeps reading after the record ran out, e.g. an older version with fewer fields
+	intfc.Reset();
+	{
+		F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+		writer.write(std::uint64_t{ 0 });
+	}
+	run("overrun_load", "RecordReader", count, [&] {
+		F4SE::RecordReader reader{ intfc, open_record(intfc) };
+		for (std::size_t i = 0; i < count; ++i) {
+			std::uint64_t read = 0;
+			TEST_CHECK(reader.read(read) == (i == 0));
+		}
+	});
+	run("overrun_load", "interface", count, [&] {
+		std::ignore = open_record(intfc);
+		for (std::size_t i = 0; i < count; ++i) {
+			std::uint64_t read = 0;
+			TEST_CHECK((intfc.ReadRecordData(read) == sizeof(read)) == (i == 0));
+		}
+	});
+
+	// repeated form ids, resolved once each
+	intfc.Reset();
+	const auto formIDs = make_form_ids(rng, count, intfc);
+	auto resolved = formIDs;
+	run("resolve", "RecordReader", count, [&] {
+		F4SE::RecordReader reader{ intfc, 0 };
+		test::do_not_optimize(reader.resolve_form_ids(resolved));
+	});
+	auto each = formIDs;
+	run("resolve", "interface", count, [&] {
+		for (auto& formID : each) {
+			formID = intfc.ResolveFormID(formID).value_or(0);
+		}
+	});
+	TEST_CHECK(resolved == each);
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"workload\": \"%.*s\", \"method\": \"%.*s\", \"ns_per_op\": %.2f, \"calls_per_op\": %.4f }%s\n",
+			static_cast<int>(result.workload.size()), result.workload.data(),
+			static_cast<int>(result.method.size()), result.method.data(),
+			result.nsPerOp,
+			result.callsPerOp,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	// varints are smaller than the fixed fields they stand in for
+	TEST_CHECK(varintBytes < fixedBytes);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,247 @@
+#include "F4SE/Serialization.hpp"
+
+namespace
+{
+	inline constexpr std::uint32_t TYPE = 0x54534554;
+	inline constexpr std::uint32_t VERSION = 3;
+
+	struct point_t
+	{
+		[[nodiscard]] bool operator==(const point_t&) const = default;
+
+		float x;
+		float y;
+		std::uint16_t flags;
+	};
+
+	// opens the only record of the co-save for reading, as a load callback would
+	[[nodiscard]] std::uint32_t open_record(const F4SE::SerializationInterface& a_intfc)
+	{
+		a_intfc.Rewind();
+
+		std::uint32_t type = 0;
+		std::uint32_t version = 0;
+		std::uint32_t length = 0;
+		TEST_CHECK(a_intfc.GetNextRecordInfo(type, version, length));
+		TEST_CHECK(type == TYPE && version == VERSION);
+		return length;
+	}
+
+	template <class T>
+	[[nodiscard]] std::size_t varint_size(T a_value)
+	{
+		F4SE::SerializationInterface intfc;
+		{
+			F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+			TEST_CHECK(writer.write_varint(a_value));
+		}
+
+		F4SE::RecordReader reader{ intfc, open_record(intfc) };
+		T value{};
+		TEST_CHECK(reader.read_varint(value) && value == a_value);
+		TEST_CHECK(reader.remaining() == 0);
+		return intfc.records.front().data.size();
+	}
+
+	void test_varints()
+	{
+		// signed values are zigzag encoded, so small magnitudes of either sign stay short
+		TEST_CHECK(varint_size(0) == 1);
+		TEST_CHECK(varint_size(-1) == 1);
+		TEST_CHECK(varint_size(63) == 1);
+		TEST_CHECK(varint_size(-64) == 1);
+		TEST_CHECK(varint_size(64) == 2);
+		TEST_CHECK(varint_size(std::numeric_limits<std::int32_t>::min()) == 5);
+		TEST_CHECK(varint_size(std::numeric_limits<std::int64_t>::max()) == 10);
+		TEST_CHECK(varint_size(std::numeric_limits<std::int64_t>::min()) == 10);
+
+		TEST_CHECK(varint_size(127u) == 1);
+		TEST_CHECK(varint_size(128u) == 2);
+		TEST_CHECK(varint_size(std::uint8_t{ 255 }) == 2);
+		TEST_CHECK(varint_size(std::numeric_limits<std::uint64_t>::max()) == 10);
+
+		// a varint which never ends fails rather than reading on
+		F4SE::SerializationInterface intfc;
+		{
+			F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+			const std::vector<std::byte> endless(16, std::byte{ 0x80 });
+			TEST_CHECK(writer.write(endless.data(), endless.size()));
+		}
+
+		F4SE::RecordReader reader{ intfc, open_record(intfc) };
+		std::uint64_t value = 0;
+		TEST_CHECK(!reader.read_varint(value));
+		TEST_CHECK(!reader.good());
+	}
+
+	void test_round_trip()
+	{
+		F4SE::SerializationInterface intfc;
+
+		const std::vector<point_t> points{ { 1.0f, 2.0f, 3 }, { -4.5f, 0.0f, 0xFFFF } };
+		const std::string big(F4SE::RecordWriter::CHUNK_SIZE * 3 + 5, 'x');
+		{
+			F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+			TEST_CHECK(writer.write(std::uint32_t{ 0xDEADBEEF }));
+			TEST_CHECK(writer.write_string(""));
+			TEST_CHECK(writer.write(std::string_view{ "short" }));
+			TEST_CHECK(writer.write(points));
+			TEST_CHECK(writer.write(std::span<const point_t>{}));
+			TEST_CHECK(writer.write_varint(-12345));
+			TEST_CHECK(writer.write_string(big));
+			TEST_CHECK(writer.write(true));
+		}
+
+		F4SE::RecordReader reader{ intfc, open_record(intfc) };
+		std::uint32_t magic = 0;
+		std::string empty = "not empty";
+		std::string text;
+		std::vector<point_t> readPoints;
+		std::vector<point_t> none{ { 9.0f, 9.0f, 9 } };
+		int varint = 0;
+		std::string readBig;
+		bool flag = false;
+		TEST_CHECK(reader.read(magic) && magic == 0xDEADBEEF);
+		TEST_CHECK(reader.read_string(empty) && empty.empty());
+		TEST_CHECK(reader.read(text) && text == "short");
+		TEST_CHECK(reader.read(readPoints) && readPoints == points);
+		TEST_CHECK(reader.read(none) && none.empty());
+		TEST_CHECK(reader.read_varint(varint) && varint == -12345);
+		TEST_CHECK(reader.read_string(readBig) && readBig == big);
+		TEST_CHECK(reader.read(flag) && flag);
+		TEST_CHECK(reader.remaining() == 0 && reader.good());
+	}
+
+	void test_buffering()
+	{
+		F4SE::SerializationInterface intfc;
+
+		// thousands of small writes reach F4SE as a handful of chunks
+		constexpr int FIELDS = 100'000;
+		{
+			F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+			for (int i = 0; i < FIELDS; ++i) {
+				TEST_CHECK(writer.write(i));
+			}
+		}
+		const auto size = FIELDS * sizeof(int);
+		TEST_CHECK(intfc.writeCalls == (size + F4SE::RecordWriter::CHUNK_SIZE - 1) / F4SE::RecordWriter::CHUNK_SIZE);
+
+		// and are read back in chunks too
+		F4SE::RecordReader reader{ intfc, open_record(intfc) };
+		for (int i = 0; i < FIELDS; ++i) {
+			int value = -1;
+			TEST_CHECK(reader.read(value) && value == i);
+		}
+		TEST_CHECK(intfc.readCalls == (size + F4SE::RecordReader::CHUNK_SIZE - 1) / F4SE::RecordReader::CHUNK_SIZE);
+	}
+
+	void test_large_writes()
+	{
+		F4SE::SerializationInterface intfc;
+
+		// a chunk or more skips the buffer, after flushing what was buffered ahead of it
+		std::vector<std::byte> large(F4SE::RecordWriter::CHUNK_SIZE * 2);
+		for (std::size_t i = 0; i < large.size(); ++i) {
+			large[i] = static_cast<std::byte>(i * 7);
+		}
+		{
+			F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+			TEST_CHECK(writer.write(std::uint16_t{ 0xABCD }));
+			TEST_CHECK(intfc.writeCalls == 0);
+			TEST_CHECK(writer.write(large.data(), large.size()));
+			TEST_CHECK(intfc.writeCalls == 2);
+			TEST_CHECK(writer.write(std::uint16_t{ 0x1234 }));
+		}
+		TEST_CHECK(intfc.writeCalls == 3);
+
+		// reading it back in one piece goes straight into the destination as well
+		F4SE::RecordReader reader{ intfc, open_record(intfc) };
+		std::uint16_t head = 0;
+		std::vector<std::byte> readLarge(large.size());
+		std::uint16_t tail = 0;
+		TEST_CHECK(reader.read(head) && head == 0xABCD);
+		TEST_CHECK(intfc.readCalls == 1);
+		TEST_CHECK(reader.read(readLarge.data(), readLarge.size()) && readLarge == large);
+		TEST_CHECK(intfc.readCalls == 2);
+		TEST_CHECK(reader.read(tail) && tail == 0x1234);
+		TEST_CHECK(reader.remaining() == 0);
+	}
+
+	void test_failures()
+	{
+		F4SE::SerializationInterface intfc;
+
+		// once F4SE refuses a write, everything after it is dropped
+		{
+			F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+			TEST_CHECK(writer.write(1));
+			intfc.failWrites = true;
+			TEST_CHECK(!writer.flush());
+			intfc.failWrites = false;
+			TEST_CHECK(!writer.write(2) && !writer.good());
+		}
+		TEST_CHECK(intfc.records.front().data.empty());
+		TEST_CHECK(intfc.writeCalls == 1);
+
+		intfc.Reset();
+		{
+			F4SE::RecordWriter writer{ intfc, TYPE, VERSION };
+			TEST_CHECK(writer.write(std::uint32_t{ 7 }));
+			TEST_CHECK(writer.write_varint(std::size_t{ 1 } << 40));
+		}
+
+		// a read past the end fails without calling into F4SE, and the reader stays failed
+		{
+			F4SE::RecordReader reader{ intfc, open_record(intfc) };
+			std::uint64_t value = 0;
+			TEST_CHECK(!reader.read(std::addressof(value), 64));
+			TEST_CHECK(intfc.readCalls == 0);
+
+			std::uint32_t first = 0;
+			TEST_CHECK(!reader.read(first) && !reader.good());
+		}
+
+		// as does a count or length the record could not hold, before anything is allocated for it
+		{
+			F4SE::RecordReader reader{ intfc, open_record(intfc) };
+			std::uint32_t first = 0;
+			std::vector<std::uint64_t> values;
+			TEST_CHECK(reader.read(first) && first == 7);
+			TEST_CHECK(!reader.read(values) && values.empty());
+		}
+		{
+			F4SE::RecordReader reader{ intfc, open_record(intfc) };
+			std::uint32_t first = 0;
+			std::string text;
+			TEST_CHECK(reader.read(first));
+			TEST_CHECK(!reader.read_string(text) && text.empty());
+		}
+	}
+
+	void test_resolve()
+	{
+		F4SE::SerializationInterface intfc;
+		intfc.formIDs = { { 0x01000800, 0x05000800 }, { 0x00000014, 0x00000014 }, { 0x02000001, 0x06000001 } };
+
+		F4SE::RecordReader reader{ intfc, 0 };
+
+		// every distinct id is resolved once, unresolved ids become 0, and 0 stays 0 without a call
+		std::vector<RE::TESFormID> formIDs{ 0x01000800, 0x00000014, 0x01000800, 0, 0x03000000, 0x02000001, 0x03000000, 0x01000800 };
+		TEST_CHECK(reader.resolve_form_ids(formIDs) == 5);
+		TEST_CHECK(formIDs == std::vector<RE::TESFormID>({ 0x05000800, 0x00000014, 0x05000800, 0, 0, 0x06000001, 0, 0x05000800 }));
+		TEST_CHECK(intfc.resolveCalls == 4);
+	}
+}
+
+int main()
+{
+	test_varints();
+	test_round_trip();
+	test_buffering();
+	test_large_writes();
+	test_failures();
+	test_resolve();
+
+	return EXIT_SUCCESS;
+}
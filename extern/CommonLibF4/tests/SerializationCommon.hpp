@@ -0,0 +1,130 @@
+#pragma once
+
+// stand-ins for the F4SE interface Serialization.hpp needs, which it leaves out under F4SE_TEST_SUITE
+
+namespace RE
+{
+	using TESFormID = std::uint32_t;
+}
+
+namespace F4SE
+{
+	/**
+	 * An in-memory co-save with the record calls of the real interface, which counts the calls made
+	 * into it so the tests can check what the buffering saves.
+	 */
+	class SerializationInterface
+	{
+	public:
+		struct record_t
+		{
+			std::uint32_t type;
+			std::uint32_t version;
+			std::vector<std::byte> data;
+		};
+
+		bool OpenRecord(std::uint32_t a_type, std::uint32_t a_version) const
+		{
+			records.push_back({ a_type, a_version, {} });
+			return true;
+		}
+
+		bool WriteRecordData(const void* a_buf, std::uint32_t a_length) const
+		{
+			++writeCalls;
+			if (records.empty() || failWrites) {
+				return false;
+			}
+
+			const auto bytes = static_cast<const std::byte*>(a_buf);
+			records.back().data.insert(records.back().data.end(), bytes, bytes + a_length);
+			return true;
+		}
+
+		template <class T>
+		bool WriteRecordData(const T& a_buf) const
+		{
+			static_assert(!std::is_pointer_v<T>);
+			return WriteRecordData(std::addressof(a_buf), sizeof(T));
+		}
+
+		bool GetNextRecordInfo(std::uint32_t& a_type, std::uint32_t& a_version, std::uint32_t& a_length) const
+		{
+			if (next >= records.size()) {
+				return false;
+			}
+
+			current = next++;
+			pos = 0;
+
+			const auto& record = records[current];
+			a_type = record.type;
+			a_version = record.version;
+			a_length = static_cast<std::uint32_t>(record.data.size());
+			return true;
+		}
+
+		// like F4SE, reads stop at the end of the current record
+		std::uint32_t ReadRecordData(void* a_buf, std::uint32_t a_length) const
+		{
+			++readCalls;
+			if (current >= records.size()) {
+				return 0;
+			}
+
+			const auto& data = records[current].data;
+			const auto length = std::min<std::size_t>(a_length, data.size() - pos);
+			if (length != 0) {
+				std::memcpy(a_buf, data.data() + pos, length);
+			}
+			pos += length;
+			return static_cast<std::uint32_t>(length);
+		}
+
+		template <class T>
+		std::uint32_t ReadRecordData(T& a_buf) const
+		{
+			static_assert(!std::is_pointer_v<T>);
+			return ReadRecordData(std::addressof(a_buf), sizeof(T));
+		}
+
+		[[nodiscard]] std::optional<RE::TESFormID> ResolveFormID(RE::TESFormID a_formID) const
+		{
+			++resolveCalls;
+			const auto it = formIDs.find(a_formID);
+			return it != formIDs.end() ? std::make_optional(it->second) : std::nullopt;
+		}
+
+		// starts reading from the first record again, as a load after the save would
+		void Rewind() const
+		{
+			next = 0;
+			current = std::numeric_limits<std::size_t>::max();
+			pos = 0;
+		}
+
+		void Reset()
+		{
+			records.clear();
+			formIDs.clear();
+			failWrites = false;
+			writeCalls = 0;
+			readCalls = 0;
+			resolveCalls = 0;
+			Rewind();
+		}
+
+		mutable std::vector<record_t> records;
+		std::unordered_map<RE::TESFormID, RE::TESFormID> formIDs;
+		bool failWrites{ false };
+
+		mutable std::size_t writeCalls{ 0 };
+		mutable std::size_t readCalls{ 0 };
+		mutable std::size_t resolveCalls{ 0 };
+
+	private:
+		mutable std::size_t next{ 0 };
+		mutable std::size_t current{ std::numeric_limits<std::size_t>::max() };
+		mutable std::size_t pos{ 0 };
+	};
+}
@@ -0,0 +1,100 @@
+#include "REX/REX/JSON.hpp"
+
+#include <nlohmann/json.hpp>
+
+namespace
+{
+	using Store = REX::JSON::SettingStore;
+
+	struct result_t
+	{
+		std::string_view op;
+		double nsPerOp;
+	};
+
+	inline constexpr std::size_t SECTIONS = 50;
+}
+
+/**
+ * Times loading a JSON store without a snapshot, with a snapshot which must be rebuilt, and
+ * straight from an up to date snapshot, and prints the results as JSON.
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto count = test::quick(a_argc, a_argv) ? std::size_t{ 500 } : std::size_t{ 5000 };
+	const auto rounds = test::quick(a_argc, a_argv) ? 2 : 20;
+
+	const auto root = std::filesystem::temp_directory_path() / "f4se_setting_snapshot_bench";
+	std::filesystem::create_directories(root);
+	const F4SE::stl::scope_exit cleanup([&] {
+		std::error_code ec;
+		std::filesystem::remove_all(root, ec);
+	});
+
+	const auto base = (root / "base.json").string();
+	const auto user = (root / "user.json").string();
+	const auto snapshot = (root / "settings.bin").string();
+
+	// settings keep a view of their path, so every path is in place before the first is registered
+	std::vector<std::string> paths;
+	paths.reserve(count);
+	nlohmann::json json;
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto section = std::format("Section{}", i % SECTIONS);
+		const auto key = std::format("iKey{}", i);
+		paths.push_back(std::format("/{}/{}", section, key));
+		json[section][key] = static_cast<std::int32_t>(i);
+	}
+
+	{
+		std::ofstream file{ base, std::ios::trunc };
+		file << std::setw(4) << json;
+	}
+
+	std::vector<std::unique_ptr<REX::JSON::I32<>>> settings;
+	for (const auto& path : paths) {
+		settings.push_back(std::make_unique<REX::JSON::I32<>>(path, -1));
+	}
+
+	const auto store = Store::GetSingleton();
+	store->Init(base, user);
+
+	std::vector<result_t> results;
+	const auto run = [&](std::string_view a_op, auto a_func) {
+		a_func();
+		results.push_back({ a_op, test::time_ns([&] {
+			for (int i = 0; i < rounds; ++i) {
+				a_func();
+			}
+		}) / rounds });
+	};
+
+	run("parse", [&] { store->Load(); });
+
+	// every load parses the files and writes the snapshot afresh
+	store->SetSnapshot(snapshot);
+	run("cold", [&] {
+		std::filesystem::remove(snapshot);
+		store->Load();
+	});
+	TEST_CHECK(std::filesystem::exists(snapshot));
+
+	run("warm", [&] { store->Load(); });
+
+	TEST_CHECK(settings.front()->GetValue() == 0);
+	TEST_CHECK(settings.back()->GetValue() == static_cast<std::int32_t>(count - 1));
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"op\": \"%.*s\", \"settings\": %zu, \"ms_per_op\": %.3f }%s\n",
+			static_cast<int>(result.op.size()), result.op.data(),
+			count,
+			result.nsPerOp / 1e6,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,226 @@
+#include "REX/REX/Setting.hpp"
+
+namespace
+{
+	class TestStore
+		: public REX::TSettingStore<TestStore>
+	{
+	public:
+		virtual void Load() override {}
+		virtual void Save() override {}
+	};
+
+	// a setting fingerprinted by its name, the way the backends fingerprint their paths
+	template <class T>
+	class TestSetting
+		: public REX::TSetting<T, TestStore>
+	{
+	public:
+		TestSetting(std::string_view a_name, T a_default) :
+			REX::TSetting<T, TestStore>(std::move(a_default)),
+			_name(a_name)
+		{
+		}
+
+		virtual void Load(void*, bool) override {}
+		virtual void Save(void*) override {}
+
+		[[nodiscard]] virtual std::uint64_t GetSchema() const noexcept override
+		{
+			return REX::Impl::SchemaHash(_name, this->GetValueSchema());
+		}
+
+	private:
+		std::string_view _name;
+	};
+
+	struct files_t
+	{
+		files_t()
+		{
+			std::filesystem::create_directories(root);
+		}
+
+		~files_t()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(root, ec);
+		}
+
+		std::filesystem::path root{ std::filesystem::temp_directory_path() / "f4se_setting_snapshot_test" };
+		std::string base{ (root / "base.ini").string() };
+		std::string user{ (root / "user.ini").string() };
+		std::string snapshot{ (root / "settings.bin").string() };
+	};
+
+	void write(const std::string& a_path, std::string_view a_text)
+	{
+		std::ofstream file{ a_path, std::ios::binary | std::ios::trunc };
+		file << a_text;
+	}
+
+	TestSetting<std::int32_t> count{ "iCount", 1 };
+	TestSetting<float> scale{ "fScale", 1.0f };
+	TestSetting<std::string> name{ "sName", std::string("default") };
+
+	[[nodiscard]] std::vector<REX::ISetting*> settings()
+	{
+		return { std::addressof(count), std::addressof(scale), std::addressof(name) };
+	}
+
+	// saves a snapshot of known values, then scrambles them so only a restore brings them back
+	void save(const files_t& a_files, std::span<REX::ISetting* const> a_settings)
+	{
+		count.SetValue(42);
+		scale.SetValue(2.5f);
+		name.SetValue("saved");
+
+		const std::array sources{ std::string_view{ a_files.base }, std::string_view{ a_files.user } };
+		REX::Impl::SaveSnapshot(a_files.snapshot, sources, a_settings);
+
+		count.SetValue(0);
+		scale.SetValue(0.0f);
+		name.SetValue("");
+	}
+
+	[[nodiscard]] bool load(const files_t& a_files, std::span<REX::ISetting* const> a_settings)
+	{
+		const std::array sources{ std::string_view{ a_files.base }, std::string_view{ a_files.user } };
+		return REX::Impl::LoadSnapshot(a_files.snapshot, sources, a_settings);
+	}
+
+	void test_restore(const files_t& a_files)
+	{
+		const auto all = settings();
+		save(a_files, all);
+		TEST_CHECK(load(a_files, all));
+		TEST_CHECK(count.GetValue() == 42);
+		TEST_CHECK(scale.GetValue() == 2.5f);
+		TEST_CHECK(name.GetValue() == "saved");
+		TEST_CHECK(count.GetValueDefault() == 1);
+
+		// a missing snapshot
+		std::filesystem::remove(a_files.snapshot);
+		TEST_CHECK(!load(a_files, all));
+	}
+
+	// each of these must send the store back to its text parser
+	void test_settings_changed(const files_t& a_files)
+	{
+		TestSetting<std::int32_t> added{ "iAdded", 0 };
+		TestSetting<float> retyped{ "iCount", 1.0f };
+		TestSetting<std::int32_t> redefaulted{ "iCount", 2 };
+
+		const auto all = settings();
+
+		save(a_files, all);
+		const std::vector<REX::ISetting*> withAdded{ all[0], all[1], all[2], std::addressof(added) };
+		TEST_CHECK(!load(a_files, withAdded));
+
+		save(a_files, all);
+		const std::vector<REX::ISetting*> withoutLast{ all[0], all[1] };
+		TEST_CHECK(!load(a_files, withoutLast));
+
+		save(a_files, all);
+		const std::vector<REX::ISetting*> reordered{ all[1], all[0], all[2] };
+		TEST_CHECK(!load(a_files, reordered));
+
+		save(a_files, all);
+		const std::vector<REX::ISetting*> withRetyped{ std::addressof(retyped), all[1], all[2] };
+		TEST_CHECK(!load(a_files, withRetyped));
+
+		save(a_files, all);
+		const std::vector<REX::ISetting*> withRedefaulted{ std::addressof(redefaulted), all[1], all[2] };
+		TEST_CHECK(!load(a_files, withRedefaulted));
+
+		// none of the failed loads touched a value
+		TEST_CHECK(count.GetValue() == 0);
+		TEST_CHECK(name.GetValue().empty());
+	}
+
+	void test_sources_changed(const files_t& a_files)
+	{
+		const auto all = settings();
+
+		save(a_files, all);
+		write(a_files.base, "[General]\niCount=7\n");
+		TEST_CHECK(!load(a_files, all));
+
+		// the same size, but a later write time
+		save(a_files, all);
+		write(a_files.base, "[General]\niCount=8\n");
+		std::filesystem::last_write_time(a_files.base, std::filesystem::last_write_time(a_files.base) + std::chrono::seconds{ 2 });
+		TEST_CHECK(!load(a_files, all));
+
+		save(a_files, all);
+		write(a_files.user, "[General]\niCount=9\n");
+		TEST_CHECK(!load(a_files, all));
+
+		save(a_files, all);
+		std::filesystem::remove(a_files.user);
+		TEST_CHECK(!load(a_files, all));
+
+		save(a_files, all);
+		TEST_CHECK(load(a_files, all));
+	}
+
+	[[nodiscard]] std::string read_snapshot(const files_t& a_files)
+	{
+		std::ifstream file{ a_files.snapshot, std::ios::binary };
+		return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	}
+
+	void test_corrupt_snapshot(const files_t& a_files)
+	{
+		const auto all = settings();
+		save(a_files, all);
+		const auto good = read_snapshot(a_files);
+
+		// the header is magic, version, schema, two 24 byte sources, then the payload size and hash
+		constexpr std::size_t HEADER = 80;
+		constexpr std::size_t PAYLOAD_SIZE = 64;
+		TEST_CHECK(good.size() > HEADER);
+
+		// every byte of the payload is covered by its hash
+		for (auto i = HEADER; i < good.size(); ++i) {
+			auto corrupt = good;
+			corrupt[i] ^= 0x5A;
+			write(a_files.snapshot, corrupt);
+			TEST_CHECK(!load(a_files, all));
+		}
+
+		// truncated anywhere, including inside the header
+		for (const auto size : { std::size_t{ 0 }, HEADER / 2, HEADER, good.size() - 1 }) {
+			write(a_files.snapshot, std::string_view{ good }.substr(0, size));
+			TEST_CHECK(!load(a_files, all));
+		}
+
+		// a payload size far beyond the file is refused before it is allocated
+		auto huge = good;
+		const std::uint64_t size = std::uint64_t{ 1 } << 60;
+		std::memcpy(huge.data() + PAYLOAD_SIZE, std::addressof(size), sizeof(size));
+		write(a_files.snapshot, huge);
+		TEST_CHECK(!load(a_files, all));
+
+		// trailing bytes past the payload
+		write(a_files.snapshot, good + "x");
+		TEST_CHECK(!load(a_files, all));
+
+		write(a_files.snapshot, good);
+		TEST_CHECK(load(a_files, all));
+		TEST_CHECK(name.GetValue() == "saved");
+	}
+}
+
+int main()
+{
+	const files_t files;
+	write(files.base, "[General]\niCount=5\n");
+
+	test_restore(files);
+	test_settings_changed(files);
+	test_sources_changed(files);
+	test_corrupt_snapshot(files);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+#include "REX/REX/Setting.hpp"
+
+namespace
+{
+	// a store which loads from memory, so the tests can drive layered loads by hand
+	class TestStore
+		: public REX::TSettingStore<TestStore>
+	{
+	public:
+		virtual void Load() override {}
+		virtual void Save() override {}
+
+		[[nodiscard]] std::span<REX::ISetting* const> GetSettings() const noexcept { return m_settings; }
+	};
+
+	template <class T, bool Concurrent>
+	class TestSetting
+		: public REX::TSetting<T, TestStore, Concurrent>
+	{
+	public:
+		using REX::TSetting<T, TestStore, Concurrent>::TSetting;
+
+		// a_data points at the value of the layer being loaded
+		virtual void Load(void* a_data, bool a_isBase) override
+		{
+			this->LoadValue(a_isBase, [&](T& a_value, T&) {
+				a_value = *static_cast<const T*>(a_data);
+			});
+		}
+
+		virtual void Save(void*) override {}
+	};
+
+	// too wide for a lock free atomic, so it is published as a shared copy
+	struct wide_t
+	{
+		std::uint64_t a;
+		std::uint64_t b;
+		std::uint64_t c;
+		std::uint64_t d;
+	};
+
+	[[nodiscard]] wide_t make_wide(std::uint64_t a_value) noexcept { return { a_value, a_value, a_value, a_value }; }
+	[[nodiscard]] std::string make_string(std::uint64_t a_value) { return std::string(8 + a_value % 57, static_cast<char>('a' + a_value % 26)); }
+
+	[[nodiscard]] bool is_whole(const wide_t& a_value) noexcept { return a_value.a == a_value.b && a_value.b == a_value.c && a_value.c == a_value.d; }
+	[[nodiscard]] bool is_whole(const std::string& a_value) { return a_value.size() >= 8 && a_value == std::string(a_value.size(), a_value.front()); }
+
+	TestSetting<std::int32_t, true> concurrentInt{ 0 };
+	TestSetting<wide_t, true> concurrentWide{ make_wide(0) };
+	TestSetting<std::string, true> concurrentString{ make_string(0) };
+	TestSetting<std::int32_t, false> plainInt{ 5 };
+
+	static_assert(REX::Impl::lock_free_value<std::int32_t>);
+	static_assert(!REX::Impl::lock_free_value<wide_t>);
+
+	// runs one store load, a base and a user layer, the way the backends do
+	template <class T, bool C>
+	void load(TestSetting<T, C>& a_setting, T a_base, T a_user)
+	{
+		// the store commits through ISetting, TSetting keeps its override protected
+		REX::ISetting& setting = a_setting;
+		setting.Load(std::addressof(a_base), true);
+		setting.Load(std::addressof(a_user), false);
+		setting.Commit();
+	}
+
+	void test_load_publishes_once()
+	{
+		const auto generation = plainInt.GetGeneration();
+		load<std::int32_t>(plainInt, 10, 20);
+		TEST_CHECK(plainInt.GetValue() == 20);
+		TEST_CHECK(plainInt.GetValueDefault() == 10);
+		TEST_CHECK(plainInt.GetGeneration() == generation + 1);
+
+		// the staged values are invisible until the commit
+		REX::ISetting& setting = plainInt;
+		std::int32_t user = 30;
+		setting.Load(std::addressof(user), false);
+		TEST_CHECK(plainInt.GetValue() == 20);
+		setting.Commit();
+		TEST_CHECK(plainInt.GetValue() == 30);
+		TEST_CHECK(plainInt.GetValueDefault() == 10);
+
+		// a commit with nothing staged changes nothing
+		setting.Commit();
+		TEST_CHECK(plainInt.GetGeneration() == generation + 2);
+
+		TEST_CHECK(TestStore::GetSingleton()->GetSettings().size() == 4);
+	}
+
+	/**
+	 * Readers on several threads race one writer, which interleaves plain writes with store loads.
+	 * No reader may see a torn value, or the generation of a setting go backwards.
+	 */
+	void test_concurrent_readers(std::uint64_t a_writes)
+	{
+		constexpr std::uint32_t READERS = 4;
+
+		std::atomic_bool done{ false };
+		std::atomic<std::uint32_t> started{ 0 };
+		std::atomic<std::uint64_t> reads{ 0 };
+
+		const auto reader = [&] {
+			started.fetch_add(1, std::memory_order_relaxed);
+			std::uint32_t lastGeneration = 0;
+			std::uint64_t count = 0;
+			do {
+				const auto generation = concurrentWide.GetGeneration();
+				TEST_CHECK(generation >= lastGeneration);
+				lastGeneration = generation;
+
+				TEST_CHECK(is_whole(concurrentWide.GetValue()));
+				TEST_CHECK(is_whole(static_cast<std::string>(concurrentString)));
+				TEST_CHECK(concurrentInt.GetValue() >= 0);
+				++count;
+			} while (!done.load(std::memory_order_acquire));
+			reads.fetch_add(count, std::memory_order_relaxed);
+		};
+
+		std::vector<std::jthread> readers;
+		for (std::uint32_t i = 0; i < READERS; ++i) {
+			readers.emplace_back(reader);
+		}
+		while (started.load(std::memory_order_relaxed) < READERS) {
+			std::this_thread::yield();
+		}
+
+		for (std::uint64_t i = 1; i <= a_writes; ++i) {
+			if (i % 8 == 0) {
+				load(concurrentWide, make_wide(i), make_wide(i + 1));
+				load(concurrentString, make_string(i), make_string(i + 1));
+				load(concurrentInt, static_cast<std::int32_t>(i), static_cast<std::int32_t>(i + 1));
+			}
+			else {
+				concurrentWide.SetValue(make_wide(i));
+				concurrentString.SetValue(make_string(i));
+				concurrentInt.SetValue(static_cast<std::int32_t>(i));
+			}
+
+			if (i % 256 == 0) {
+				std::this_thread::yield();
+			}
+		}
+
+		done.store(true, std::memory_order_release);
+		readers.clear();
+
+		TEST_CHECK(concurrentWide.GetValue().a == a_writes + 1);
+		TEST_CHECK(concurrentWide.GetGeneration() == a_writes);
+		TEST_CHECK(reads.load() >= READERS);
+	}
+}
+
+int main()
+{
+	test_load_publishes_once();
+	test_concurrent_readers(20'000);
+
+	return EXIT_SUCCESS;
+}
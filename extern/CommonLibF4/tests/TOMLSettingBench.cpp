@@ -0,0 +1,210 @@
+#include "REX/REX/TOML.hpp"
+
+#include <toml.hpp>
+
+namespace
+{
+	using Store = REX::TOML::SettingStore;
+
+	struct result_t
+	{
+		std::string_view method;
+		std::string_view op;
+		std::size_t settings;
+		std::size_t depth;
+		std::size_t width;
+		double nsPerOp;
+	};
+
+	// the number of settings, the tables each sits under, and the settings per innermost table
+	struct shape_t
+	{
+		std::size_t settings;
+		std::size_t depth;
+		std::size_t width;
+	};
+
+	inline constexpr std::array SHAPES{
+		// sizes, as a plugin's config grows
+		shape_t{ 100, 2, 1 },
+		shape_t{ 1000, 2, 10 },
+		shape_t{ 10000, 2, 100 },
+		// widths, from many small tables to one flat one
+		shape_t{ 10000, 2, 10 },
+		shape_t{ 10000, 2, 1000 },
+		shape_t{ 10000, 2, 10000 },
+		// depths
+		shape_t{ 10000, 1, 100 },
+		shape_t{ 10000, 4, 100 },
+		shape_t{ 10000, 8, 100 },
+	};
+
+	struct key_entry_t
+	{
+		REX::TOML::sec_t section;
+		std::string key;
+	};
+
+	// the store has no way to drop a setting, so the bench clears its list between shapes
+	struct StoreAccess
+		: public Store
+	{
+		static void clear() { (Store::GetSingleton()->*(&StoreAccess::m_settings)).clear(); }
+	};
+
+	// the path of table a_table of a_tables, a_depth tables deep, branching evenly on the way down
+	[[nodiscard]] REX::TOML::sec_t table_path(std::size_t a_table, std::size_t a_tables, std::size_t a_depth)
+	{
+		const auto leaves = [&](std::size_t a_branches) {
+			std::size_t result = 1;
+			for (std::size_t level = 0; level < a_depth; ++level) {
+				result *= a_branches;
+			}
+			return result;
+		};
+
+		std::size_t branches = 1;
+		while (leaves(branches) < a_tables) {
+			++branches;
+		}
+
+		REX::TOML::sec_t path(a_depth);
+		for (auto level = a_depth; level-- > 0; a_table /= branches) {
+			path[level] = std::format("Table{}", a_table % branches);
+		}
+		return path;
+	}
+
+	// how settings were loaded before tables were cached, scanning each table on the way to every setting
+	[[nodiscard]] const toml::value* linear_table(const toml::value& a_root, const REX::TOML::sec_t& a_section)
+	{
+		const auto* node = std::addressof(a_root);
+		for (const auto& section : a_section) {
+			if (!node->is_table()) {
+				return nullptr;
+			}
+
+			const toml::value* next = nullptr;
+			for (const auto& [key, value] : node->as_table()) {
+				if (key == section) {
+					next = std::addressof(value);
+					break;
+				}
+			}
+
+			if (!next) {
+				return nullptr;
+			}
+			node = next;
+		}
+		return node;
+	}
+
+	[[nodiscard]] std::int64_t linear_load(const std::string& a_file, std::span<const key_entry_t> a_keys)
+	{
+		const auto root = toml::parse(a_file);
+
+		std::int64_t sum = 0;
+		for (const auto& key : a_keys) {
+			if (const auto table = linear_table(root, key.section)) {
+				sum += toml::find_or<std::int32_t>(*table, key.key, -1);
+			}
+		}
+		return sum;
+	}
+}
+
+/**
+ * Times loading and saving stores of integer settings, against scanning for each setting's
+ * tables, and prints the results as JSON.
+ *
+ * <p>
+ * Stores range over 100 to 10k settings, innermost tables over 10 to 10k settings, and settings
+ * over 1 to 8 tables deep. <code>--quick</code> runs each shape with a tenth of the settings.
+ * </p>
+ */
+int main(int a_argc, char* a_argv[])
+{
+	const auto quick = test::quick(a_argc, a_argv);
+	const auto rounds = quick ? 2 : 10;
+
+	const auto root = std::filesystem::temp_directory_path() / "f4se_toml_setting_bench";
+	std::filesystem::create_directories(root);
+	const F4SE::stl::scope_exit cleanup([&] {
+		std::error_code ec;
+		std::filesystem::remove_all(root, ec);
+	});
+
+	const auto base = (root / "base.toml").string();
+	const auto user = (root / "user.toml").string();
+
+	const auto store = Store::GetSingleton();
+	store->Init(base, user);
+
+	std::vector<result_t> results;
+	for (const auto& shape : SHAPES) {
+		const auto size = quick ? shape.settings / 10 : shape.settings;
+		const auto width = std::min(shape.width, size);
+		const auto tables = (size + width - 1) / width;
+
+		// settings keep a view of their key, so the keys must never reallocate
+		std::vector<key_entry_t> keys;
+		keys.reserve(size);
+		std::vector<std::unique_ptr<REX::TOML::I32<>>> settings;
+		StoreAccess::clear();
+
+		toml::value document{ toml::table{} };
+		for (std::size_t i = 0; i < size; ++i) {
+			auto& key = keys.emplace_back(table_path(i / width, tables, shape.depth), std::format("iKey{}", i));
+
+			auto* node = std::addressof(document);
+			std::string section;
+			for (const auto& table : key.section) {
+				node = std::addressof((*node)[table]);
+				section += section.empty() ? table : "." + table;
+			}
+			(*node)[key.key] = static_cast<std::int32_t>(i);
+
+			settings.push_back(std::make_unique<REX::TOML::I32<>>(section, key.key, -1));
+		}
+
+		{
+			std::ofstream file{ base, std::ios::trunc };
+			file << toml::format(document);
+		}
+
+		const auto run = [&](std::string_view a_method, std::string_view a_op, auto a_func) {
+			a_func();
+			results.push_back({ a_method, a_op, size, shape.depth, width, test::time_ns([&] {
+				for (int i = 0; i < rounds; ++i) {
+					a_func();
+				}
+			}) / rounds });
+		};
+
+		run("SettingStore", "load", [&] { store->Load(); });
+		run("linear", "load", [&] { test::do_not_optimize(linear_load(base, keys)); });
+		run("SettingStore", "save", [&] { store->Save(); });
+
+		TEST_CHECK(settings.front()->GetValue() == 0);
+		TEST_CHECK(settings.back()->GetValue() == static_cast<std::int32_t>(size - 1));
+	}
+	StoreAccess::clear();
+
+	std::printf("[\n");
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		std::printf(
+			"\t{ \"method\": \"%.*s\", \"op\": \"%.*s\", \"settings\": %zu, \"depth\": %zu, \"width\": %zu, \"ms_per_op\": %.3f }%s\n",
+			static_cast<int>(result.method.size()), result.method.data(),
+			static_cast<int>(result.op.size()), result.op.data(),
+			result.settings,
+			result.depth,
+			result.width,
+			result.nsPerOp / 1e6,
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("]\n");
+
+	return EXIT_SUCCESS;
+}
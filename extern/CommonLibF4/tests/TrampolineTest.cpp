@@ -0,0 +1,207 @@
+#include "F4SE/Logger.hpp"
+#include "F4SE/Trampoline.hpp"
+
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <sstream>
+
+namespace
+{
+	inline constexpr auto INT3 = std::byte{ 0xCC };
+
+	// mov rax, [rsp+8]; ret
+	inline constexpr std::array STUB{ std::byte{ 0x48 }, std::byte{ 0x8B }, std::byte{ 0x44 }, std::byte{ 0x24 }, std::byte{ 0x08 }, std::byte{ 0xC3 } };
+
+	// xor eax, eax; ret
+	inline constexpr std::array OTHER_STUB{ std::byte{ 0x31 }, std::byte{ 0xC0 }, std::byte{ 0xC3 } };
+
+	std::ostringstream output;
+
+	[[nodiscard]] std::vector<std::string> take_lines()
+	{
+		std::vector<std::string> lines;
+		std::istringstream in(output.str());
+		for (std::string line; std::getline(in, line);) {
+			lines.push_back(line);
+		}
+		output.str({});
+		return lines;
+	}
+
+	[[nodiscard]] bool filled(const void* a_mem, std::size_t a_size, std::byte a_value)
+	{
+		return std::ranges::all_of(std::span{ static_cast<const std::byte*>(a_mem), a_size }, [&](std::byte a_byte) { return a_byte == a_value; });
+	}
+
+	template <class T>
+	[[nodiscard]] T read(std::uintptr_t a_address)
+	{
+		T result;
+		std::memcpy(std::addressof(result), reinterpret_cast<const void*>(a_address), sizeof(T));
+		return result;
+	}
+
+	void test_reuse()
+	{
+		std::vector<std::byte> buffer(256);
+		std::vector<std::size_t> freed;
+
+		F4SE::Trampoline trampoline{ "test" };
+		trampoline.set_trampoline(buffer.data(), buffer.size(), [&](void*, std::size_t a_size) { freed.push_back(a_size); });
+		TEST_CHECK(filled(buffer.data(), buffer.size(), INT3));
+
+		const auto data = buffer.data();
+		const auto a = static_cast<std::byte*>(trampoline.allocate(24));
+		const auto b = static_cast<std::byte*>(trampoline.allocate(16));
+		const auto c = static_cast<std::byte*>(trampoline.allocate(8));
+		TEST_CHECK(a == data && b == data + 24 && c == data + 40);
+		TEST_CHECK(trampoline.allocated_size() == 48 && trampoline.free_size() == 208);
+
+		// a freed block is filled with int3 again and binned for reuse
+		std::memset(a, 0, 24);
+		trampoline.deallocate(a, 24);
+		TEST_CHECK(filled(a, 24, INT3));
+		TEST_CHECK(trampoline.reusable_size() == 24 && trampoline.allocated_size() == 24);
+
+		// a smaller request takes the block, and its tail is binned on its own
+		TEST_CHECK(trampoline.allocate(16) == a);
+		TEST_CHECK(trampoline.reusable_size() == 8);
+		TEST_CHECK(trampoline.allocate(8) == a + 16);
+		TEST_CHECK(trampoline.reusable_size() == 0 && trampoline.free_size() == 208);
+
+		// the block at the end of the bump region goes straight back to it
+		trampoline.deallocate(c, 8);
+		TEST_CHECK(trampoline.reusable_size() == 0 && trampoline.free_size() == 216);
+		TEST_CHECK(trampoline.allocate(8) == c);
+
+		// a tail too small for a branch target is counted as waste instead of binned
+		trampoline.deallocate(a, 16);
+		TEST_CHECK(trampoline.allocate(12) == a);
+		TEST_CHECK(trampoline.reusable_size() == 0 && trampoline.wasted_size() == 4);
+
+		// nothing fits in the bins, so the bump region serves it
+		TEST_CHECK(trampoline.allocate(32) == data + 48);
+
+		// replacing the buffer hands the old one to its deleter
+		std::vector<std::byte> other(64);
+		trampoline.set_trampoline(other.data(), other.size());
+		TEST_CHECK(freed == std::vector<std::size_t>({ 256 }));
+		TEST_CHECK(trampoline.allocated_size() == 0 && trampoline.wasted_size() == 0);
+		TEST_CHECK(trampoline.allocate(8) == other.data());
+	}
+
+	void test_stubs()
+	{
+		std::vector<std::byte> buffer(64);
+		F4SE::Trampoline trampoline{ "test" };
+		trampoline.set_trampoline(buffer.data(), buffer.size());
+
+		// identical code is copied once, and other code gets its own copy
+		const auto first = trampoline.allocate_stub(STUB);
+		TEST_CHECK(first == buffer.data());
+		TEST_CHECK(std::memcmp(first, STUB.data(), STUB.size()) == 0);
+		TEST_CHECK(trampoline.allocate_stub(STUB) == first);
+
+		const auto other = trampoline.allocate_stub(OTHER_STUB);
+		TEST_CHECK(other == buffer.data() + STUB.size());
+		TEST_CHECK(std::memcmp(other, OTHER_STUB.data(), OTHER_STUB.size()) == 0);
+		TEST_CHECK(trampoline.allocated_size() == STUB.size() + OTHER_STUB.size());
+	}
+
+	void test_branches()
+	{
+		// the call sites and the trampoline share one buffer, so every displacement is in range
+		std::vector<std::byte> buffer(512, INT3);
+		const auto code = reinterpret_cast<std::uintptr_t>(buffer.data());
+		const auto mem = buffer.data() + 256;
+		constexpr std::uintptr_t DST = 0x1122334455667788;
+
+		F4SE::Trampoline trampoline{ "test" };
+		trampoline.set_trampoline(mem, 256);
+
+		// call rel32 to code + 0x80, which write_call hands back as the function it replaced
+		buffer[0] = std::byte{ 0xE8 };
+		const std::int32_t disp = 0x80 - 5;
+		std::memcpy(buffer.data() + 1, std::addressof(disp), sizeof(disp));
+		TEST_CHECK(trampoline.write_call<5>(code, DST) == code + 0x80);
+
+		TEST_CHECK(read<std::uint8_t>(code) == 0xE8);
+		TEST_CHECK(code + 5 + read<std::int32_t>(code + 1) == reinterpret_cast<std::uintptr_t>(mem));
+		TEST_CHECK(read<std::uint8_t>(reinterpret_cast<std::uintptr_t>(mem)) == 0xFF);
+		TEST_CHECK(read<std::uint8_t>(reinterpret_cast<std::uintptr_t>(mem) + 1) == 0x25);
+		TEST_CHECK(read<std::int32_t>(reinterpret_cast<std::uintptr_t>(mem) + 2) == 0);
+		TEST_CHECK(read<std::uintptr_t>(reinterpret_cast<std::uintptr_t>(mem) + 6) == DST);
+		TEST_CHECK(trampoline.allocated_size() == 14);
+
+		// a jump to the same destination shares the stub
+		buffer[16] = std::byte{ 0xE9 };
+		std::memset(buffer.data() + 17, 0, 4);
+		std::ignore = trampoline.write_branch<5>(code + 16, DST);
+		TEST_CHECK(read<std::uint8_t>(code + 16) == 0xE9);
+		TEST_CHECK(code + 21 + read<std::int32_t>(code + 17) == reinterpret_cast<std::uintptr_t>(mem));
+		TEST_CHECK(trampoline.allocated_size() == 14);
+
+		// an indirect call gets an address slot, which an indirect jump to the same destination shares
+		std::memset(buffer.data() + 32, 0, 6);
+		std::ignore = trampoline.write_call<6>(code + 32, DST);
+		TEST_CHECK(read<std::uint8_t>(code + 32) == 0xFF && read<std::uint8_t>(code + 33) == 0x15);
+		const auto slot = code + 38 + read<std::int32_t>(code + 34);
+		TEST_CHECK(slot == reinterpret_cast<std::uintptr_t>(mem) + 14);
+		TEST_CHECK(read<std::uintptr_t>(slot) == DST);
+
+		std::memset(buffer.data() + 48, 0, 6);
+		std::ignore = trampoline.write_branch<6>(code + 48, DST);
+		TEST_CHECK(read<std::uint8_t>(code + 49) == 0x25);
+		TEST_CHECK(code + 54 + read<std::int32_t>(code + 50) == slot);
+		TEST_CHECK(trampoline.allocated_size() == 14 + sizeof(std::uintptr_t));
+	}
+
+	void test_callers()
+	{
+		std::vector<std::byte> buffer(256);
+		F4SE::Trampoline trampoline{ "test" };
+		trampoline.set_trampoline(buffer.data(), buffer.size());
+
+		const auto blocks = std::source_location::current();
+		const auto stubs = std::source_location::current();
+
+		const auto first = trampoline.allocate(16, blocks);
+		std::ignore = trampoline.allocate(8, blocks);
+		trampoline.deallocate(first, 16);
+		std::ignore = trampoline.allocate(16, blocks);
+
+		std::ignore = trampoline.allocate_stub(STUB, stubs);
+		std::ignore = trampoline.allocate_stub(STUB, stubs);
+
+		// the breakdown is one message, keyed and ordered by call site
+		output.str({});
+		trampoline.log_stats(true);
+		const auto file = std::string(blocks.file_name());
+		TEST_CHECK(take_lines() == std::vector<std::string>({
+									   "debug test => 30B / 256B (11.72%), 0B reusable, 0B wasted",
+									   "debug test callers:",
+									   std::format("\t{}:{} => 40B in 3 allocation(s), 1 reused, 0 shared", file, blocks.line()),
+									   std::format("\t{}:{} => 6B in 1 allocation(s), 0 reused, 1 shared", file, stubs.line()),
+								   }));
+
+		// and only the summary is logged without it
+		trampoline.log_stats();
+		TEST_CHECK(take_lines().size() == 1);
+	}
+}
+
+int main()
+{
+	auto logger = std::make_shared<spdlog::logger>("test", std::make_shared<spdlog::sinks::ostream_sink_st>(output));
+	logger->set_level(spdlog::level::debug);
+	logger->set_pattern("%l %v");
+	spdlog::set_default_logger(std::move(logger));
+	F4SE::log::set_rate_limit(0);
+
+	test_reuse();
+	test_stubs();
+	test_branches();
+	test_callers();
+
+	return EXIT_SUCCESS;
+}
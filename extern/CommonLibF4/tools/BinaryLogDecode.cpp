@@ -0,0 +1,40 @@
+#include "F4SE/BinaryLog.hpp"
+
+#include <iostream>
+
+/**
+ * Renders a log written by F4SE::log::BinaryLog as text, into a file or to stdout.
+ *
+ * <p>
+ * usage: BinaryLogDecode &lt;log&gt; [&lt;output&gt;]
+ * </p>
+ */
+int main(int a_argc, char* a_argv[])
+{
+	if (a_argc != 2 && a_argc != 3) {
+		std::fprintf(stderr, "usage: %s <log> [<output>]\n", a_argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::ifstream in{ a_argv[1], std::ios::binary };
+	if (!in) {
+		std::fprintf(stderr, "failed to open %s\n", a_argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	std::ofstream file;
+	if (a_argc == 3) {
+		file.open(a_argv[2], std::ios::trunc);
+		if (!file) {
+			std::fprintf(stderr, "failed to open %s\n", a_argv[2]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (!F4SE::log::DecodeBinaryLog(in, a_argc == 3 ? file : std::cout)) {
+		std::fprintf(stderr, "%s is not a valid binary log\n", a_argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -4,9 +4,10 @@ namespace Internal::Events
 {
 	namespace Callbacks
 	{
-		// public REX::Singleton<CrosshairRefHandler>,
+		// created on kPostLoad, read on every crosshair update. Intentionally leaked: F4SE sends no
+		// exit message, and by static destruction the event source it would unregister from is gone
 		class CrosshairRefHandler final
-			: public REX::Singleton<CrosshairRefHandler>,
+			: public REX::EagerSingleton<CrosshairRefHandler>,
 			  public RE::BSTEventSink<RE::ViewCasterUpdateEvent>
 
 		{
@@ -3,6 +3,11 @@
 
 namespace Internal::Messaging
 {
+	static void OnPostLoad()
+	{
+		Internal::Events::Callbacks::CrosshairRefHandler::Create();
+	}
+
 	static void OnGameStart()
 	{
 		Internal::Events::Callbacks::CrosshairRefHandler::GetSingleton()->Register();
@@ -11,10 +16,11 @@ namespace Internal::Messaging
 	// handles various F4SE callback events
 	void Callback(F4SE::MessagingInterface::Message* a_msg)
 	{
-		logger::info("Messaging: Received message of type: {}"sv, a_msg->type);
+		logger::debug("Messaging: Received message of type: {}"sv, a_msg->type);
 
 		switch (a_msg->type) {
 			case F4SE::MessagingInterface::kPostLoad: {
+				OnPostLoad();
 				break;
 			}
 			case F4SE::MessagingInterface::kPostPostLoad: {
@@ -25,6 +31,7 @@ namespace Internal::Messaging
 			}
 			case F4SE::MessagingInterface::kPostLoadGame: {
 				OnGameStart();
+				break;
 			}
 			case F4SE::MessagingInterface::kPreSaveGame: {
 				break;
@@ -51,7 +58,5 @@ namespace Internal::Messaging
 				break;
 			}
 		}
-
-		logger::info("Messaging: Finished processing for message of type: {}"sv, a_msg->type);
 	}
 }
\ No newline at end of file